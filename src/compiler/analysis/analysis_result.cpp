@@ -31,6 +31,7 @@
 #include <compiler/statement/loop_statement.h>
 #include <compiler/analysis/symbol_table.h>
 #include <compiler/package.h>
+#include <compiler/compile_server.h>
 #include <compiler/parser/parser.h>
 #include <compiler/option.h>
 #include <compiler/analysis/function_scope.h>
@@ -1457,10 +1458,42 @@ void AnalysisResult::repartitionLargeCPP(const vector<string> &filenames,
     }
   }
   int64 averageSize = count > 1 ? (totalSize / count) : totalSize;
+
+  // compile times measured by CompileServer in the last build are a better
+  // guide than file sizes, so files with a known cost are split by that
+  CompileServer::CostMap costs;
+  vector<double> fileCosts(filenames.size(), 0.0);
+  double averageCost = 0.0;
+  if (!Option::CompileCostFile.empty()) {
+    CompileServer::LoadCosts(Option::CompileCostFile, costs);
+    string root = getOutputPath() + "/";
+    int known = 0;
+    for (unsigned int i = 0; i < filenames.size(); i++) {
+      const string &filename = filenames[i];
+      if (filename.compare(0, root.size(), root) == 0) {
+        fileCosts[i] = CompileServer::GetCost(costs,
+                                              filename.substr(root.size()));
+        if (fileCosts[i] > 0.0) {
+          averageCost += fileCosts[i];
+          known++;
+        }
+      }
+    }
+    if (known) averageCost /= known;
+  }
+
   for (unsigned int i = 0; i < filenames.size(); i++) {
     const string &filename = filenames[i];
 
-    if (Option::PreprocessedPartitionConfig.empty()) {
+    if (fileCosts[i] > 0.0 && averageCost > 0.0) {
+      int count = (int)(fileCosts[i] / averageCost);
+      if (count > 1) {
+        struct stat results;
+        if (stat(filename.c_str(), &results) == 0) {
+          repartitionCPP(filename, results.st_size / count, true, true);
+        }
+      }
+    } else if (Option::PreprocessedPartitionConfig.empty()) {
       repartitionCPP(filename, averageSize, true, false);
     } else {
       int count = ppp[filename];
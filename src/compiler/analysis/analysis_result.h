@@ -236,6 +236,12 @@ public:
 
   void addFileScope(FileScopePtr fileScope);
 
+  /**
+   * Files f uses classes, functions or constants from.
+   */
+  void getTrueDeps(FileScopePtr f,
+                   std::map<std::string, FileScopePtr> &trueDeps);
+
   /**
    * To implement the silence operator correctly, we need to keep trace
    * of the current statement being parsed.
@@ -453,8 +459,6 @@ private:
   typedef std::map<vertex_descriptor, FileScopePtr> VertexToFileScopePtrMap;
   VertexToFileScopePtrMap m_fileVertMap;
   void link(FileScopePtr user, FileScopePtr provider);
-  void getTrueDeps(FileScopePtr f,
-                   std::map<std::string, FileScopePtr> &trueDeps);
   void clusterByFileSizes(StringToFileScopePtrVecMap &clusters,
                           int clusterCount);
   std::string getHashedName(int64 hash, int index, const char *prefix,
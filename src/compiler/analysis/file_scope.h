@@ -183,6 +183,16 @@ public:
     return m_pseudoMain;
   }
 
+  /**
+   * Files this one includes, as resolved at parse time.
+   */
+  void addIncludeTarget(const std::string &name) {
+    m_includeTargets.insert(name);
+  }
+  const std::set<std::string> &getIncludeTargets() const {
+    return m_includeTargets;
+  }
+
   void outputCPPForwardStaticDecl(CodeGenerator &cg, AnalysisResultPtr ar);
   void outputCPPForwardDeclHeader(CodeGenerator &cg, AnalysisResultPtr ar);
   void outputCPPDeclHeader(CodeGenerator &cg, AnalysisResultPtr ar);
@@ -244,6 +254,7 @@ private:
   std::set<std::string> m_usedDefaultValueScalarArrays;
   std::string m_pseudoMainName;
   std::set<std::string> m_pseudoMainVariables;
+  std::set<std::string> m_includeTargets;
 
   struct lambda {
     std::string rt;
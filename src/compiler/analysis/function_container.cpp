@@ -20,6 +20,7 @@
 #include <compiler/analysis/class_scope.h>
 #include <compiler/analysis/code_error.h>
 #include <compiler/statement/statement_list.h>
+#include <compiler/util/perfect_hash.h>
 #include <compiler/option.h>
 #include <util/util.h>
 #include <util/hash.h>
@@ -406,6 +407,80 @@ void FunctionContainer::outputCPPHashTableGetCallInfo(
   outputGetCallInfoTail(cg, system);
 }
 
+bool FunctionContainer::outputCPPPerfectHashGetCallInfo(
+  CodeGenerator &cg, bool system, bool needGlobals,
+  const StringToFunctionScopePtrVecMap *functions,
+  const vector<const char *> &funcs) {
+  // redeclared functions are found through globals, so they stay in a switch
+  vector<const char *> fixed;
+  vector<const char *> redeclared;
+  for (unsigned int i = 0; i < funcs.size(); i++) {
+    StringToFunctionScopePtrVecMap::const_iterator iterFuncs =
+      functions->find(funcs[i]);
+    ASSERT(iterFuncs != functions->end());
+    if (iterFuncs->second[0]->isRedeclaring()) {
+      redeclared.push_back(funcs[i]);
+    } else {
+      fixed.push_back(funcs[i]);
+    }
+  }
+  PerfectHashTable table(fixed, true);
+  if (!table.valid()) return false;
+
+  ASSERT(cg.getCurrentIndentation() == 0);
+  int bucketCount = table.getBucketCount();
+  int slotCount = table.getSlotCount();
+  cg_printf("\n"
+            "struct hashNodeCI {\n"
+            "  int64 hash;\n"
+            "  const char *name;\n"
+            "  const CallInfo *ci;\n"
+            "};\n"
+            "\n");
+  cg_indentBegin("static const unsigned short funcDisps[%d] = {\n",
+                 bucketCount);
+  for (int i = 0; i < bucketCount; i++) {
+    cg_printf(i % 16 == 15 || i == bucketCount - 1 ? "%d,\n" : "%d, ",
+              table.getDisplacement(i));
+  }
+  cg_indentEnd("};\n");
+  cg_indentBegin("static const hashNodeCI funcSlots[%d] = {\n", slotCount);
+  for (int i = 0; i < slotCount; i++) {
+    int key = table.getSlot(i);
+    if (key < 0) {
+      cg_printf("{-1, NULL, NULL},\n");
+      continue;
+    }
+    const char *name = fixed[key];
+    FunctionScopePtr func = functions->find(name)->second[0];
+    cg_printf("{0x%016llXLL, \"%s\", &%s%s},\n", table.getHash(key),
+              Util::escapeStringForCPP(name).c_str(),
+              Option::CallInfoPrefix, func->getId(cg).c_str());
+  }
+  cg_indentEnd("};\n");
+  cg_printf("\n");
+
+  outputGetCallInfoHeader(cg, system, needGlobals);
+  cg_printf("if (hash < 0) hash = hash_string(s);\n");
+  cg_printf("const hashNodeCI &p = funcSlots[perfect_hash_slot(hash, "
+            "funcDisps[hash & %d], %d)];\n", bucketCount - 1, slotCount - 1);
+  cg_indentBegin("if (p.hash == hash && !strcasecmp(p.name, s)) {\n");
+  cg_printf("ci = p.ci;\n");
+  cg_printf("return true;\n");
+  cg_indentEnd("}\n");
+  for (JumpTable fit(cg, redeclared, true, true, false); fit.ready();
+       fit.next()) {
+    const char *name = fit.key();
+    cg_indentBegin("HASH_GUARD(0x%016llXLL, %s) {\n",
+                   hash_string_i(name), cg.escapeLabel(name).c_str());
+    cg_printf("ci = g->GCI(%s);\n", cg.formatLabel(name).c_str());
+    cg_printf("return true;\n");
+    cg_indentEnd("}\n");
+  }
+  outputGetCallInfoTail(cg, system);
+  return true;
+}
+
 void FunctionContainer::outputCPPCodeInfoTable(CodeGenerator &cg,
     AnalysisResultPtr ar, bool support,
     const StringToFunctionScopePtrVecMap *functions /* = NULL */) {
@@ -432,6 +507,11 @@ void FunctionContainer::outputCPPCodeInfoTable(CodeGenerator &cg,
     outputCPPHashTableGetCallInfo(cg, system, functions, funcs);
     return;
   }
+  if (Option::GenPerfectHashCallInfo &&
+      outputCPPPerfectHashGetCallInfo(cg, system, needGlobals, functions,
+                                      funcs)) {
+    return;
+  }
   outputGetCallInfoHeader(cg, system, needGlobals);
 
   for (JumpTable fit(cg, funcs, true, true, false); fit.ready(); fit.next()) {
@@ -87,6 +87,9 @@ private:
        const std::vector<const char *> &funcs);
   void outputCPPHashTableEvalInvoke(CodeGenerator &cg,
        const std::vector<const char *> &funcs);
+  bool outputCPPPerfectHashGetCallInfo(CodeGenerator &cg, bool system,
+       bool needGlobals, const StringToFunctionScopePtrVecMap *functions,
+       const std::vector<const char *> &funcs);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,289 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <compiler/compile_server.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <fstream>
+#include <algorithm>
+#include <boost/lexical_cast.hpp>
+#include <util/process.h>
+#include <util/util.h>
+#include <util/logger.h>
+#include <util/timer.h>
+#include <util/hash.h>
+#include <util/lock.h>
+#include <util/job_queue.h>
+
+using namespace HPHP;
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+// cost file
+
+void CompileServer::LoadCosts(const string &file, CostMap &costs) {
+  ifstream f(file.c_str());
+  double seconds;
+  string name;
+  while (f >> seconds && getline(f, name)) {
+    size_t pos = name.find_first_not_of(' ');
+    if (pos == string::npos) continue;
+    costs[name.substr(pos)] = seconds;
+  }
+}
+
+void CompileServer::SaveCosts(const string &file, const CostMap &costs) {
+  string tmp = file + ".tmp";
+  {
+    ofstream f(tmp.c_str());
+    for (CostMap::const_iterator iter = costs.begin(); iter != costs.end();
+         ++iter) {
+      f << iter->second << " " << iter->first << "\n";
+    }
+    if (!f) {
+      Logger::Error("unable to write %s", tmp.c_str());
+      return;
+    }
+  }
+  Util::rename(tmp.c_str(), file.c_str());
+}
+
+double CompileServer::GetCost(const CostMap &costs, const string &file) {
+  double cost = 0.0;
+  CostMap::const_iterator iter = costs.find(file);
+  if (iter != costs.end()) {
+    cost += iter->second;
+  }
+  if (file.size() > 4 && file.substr(file.size() - 4) == ".cpp") {
+    // pieces repartitionCPP() split this file into
+    string prefix = file.substr(0, file.size() - 4) + "-";
+    for (iter = costs.lower_bound(prefix);
+         iter != costs.end() &&
+           iter->first.compare(0, prefix.size(), prefix) == 0;
+         ++iter) {
+      const string &rest = iter->first.substr(prefix.size());
+      if (rest.size() > 4 &&
+          rest.find_first_not_of("0123456789") == rest.size() - 4) {
+        cost += iter->second;
+      }
+    }
+  }
+  return cost;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// workers
+
+class CompileWorker : public JobQueueWorker<string> {
+public:
+  virtual void doJob(string source) {
+    ((CompileServer*)m_opaque)->compileOne(source);
+  }
+};
+
+static bool run_shell(const string &cmd, string &out, string &err) {
+  const char *argv[] = {"", "-c", cmd.c_str(), NULL};
+  return Process::Exec("/bin/sh", argv, NULL, out, &err);
+}
+
+static string object_name(const string &source) {
+  return source.substr(0, source.size() - 4) + ".o";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+CompileServer::CompileServer(const string &root, const string &compileCmd,
+                             const string &cacheDir, int jobs)
+    : m_root(root), m_compileCmd(compileCmd), m_cacheDir(cacheDir),
+      m_jobs(jobs), m_compiled(0), m_reused(0), m_failed(0) {
+  if (m_jobs <= 0) m_jobs = 1;
+  if (!m_cacheDir.empty()) {
+    Util::mkdir(m_cacheDir + "/");
+    m_costFile = m_cacheDir + "/compile_costs";
+  } else {
+    m_costFile = m_root + "/compile_costs";
+  }
+  LoadCosts(m_costFile, m_costs);
+}
+
+void CompileServer::findSources(const string &dir, vector<string> &out) {
+  DIR *d = opendir((m_root + "/" + dir).c_str());
+  if (!d) return;
+  dirent *e;
+  while ((e = readdir(d)) != NULL) {
+    string name = e->d_name;
+    if (name == "." || name == "..") continue;
+    string path = dir.empty() ? name : dir + "/" + name;
+    struct stat sb;
+    if (stat((m_root + "/" + path).c_str(), &sb)) continue;
+    if (S_ISDIR(sb.st_mode)) {
+      if (m_root + "/" + path != m_cacheDir) {
+        findSources(path, out);
+      }
+    } else if (name.size() > 4 && name.substr(name.size() - 4) == ".cpp") {
+      out.push_back(path);
+    }
+  }
+  closedir(d);
+}
+
+string CompileServer::getCommand(const string &source) const {
+  string cmd = m_compileCmd;
+  if (source.size() > 7 && source.substr(source.size() - 7) == ".no.cpp") {
+    cmd += " -O0"; // same as what CMakeLists.base.txt does
+  }
+  return cmd + " -o " + m_root + "/" + object_name(source) + " " +
+    m_root + "/" + source;
+}
+
+bool CompileServer::getCacheKey(const string &source, const string &cmd,
+                                string &key) {
+  string out, err;
+  if (!run_shell(m_compileCmd + " -E " + m_root + "/" + source, out, err)) {
+    return false;
+  }
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%016llx%016llx-%x",
+           (unsigned long long)hash_string_cs(out.data(), out.size()),
+           (unsigned long long)hash_string_cs(cmd.data(), cmd.size()),
+           (unsigned int)out.size());
+  key = buf;
+  return true;
+}
+
+void CompileServer::compileOne(const string &source) {
+  string cmd = getCommand(source);
+  string object = m_root + "/" + object_name(source);
+
+  string key;
+  string cached;
+  if (!m_cacheDir.empty() && getCacheKey(source, cmd, key)) {
+    cached = m_cacheDir + "/" + key + ".o";
+    struct stat sb;
+    if (stat(cached.c_str(), &sb) == 0 &&
+        Util::copy(cached.c_str(), object.c_str()) == 0) {
+      Logger::Verbose("reused %s", source.c_str());
+      Lock lock(m_mutex);
+      m_reused++;
+      return;
+    }
+  }
+
+  Timer timer(Timer::WallTime);
+  string out, err;
+  bool ok = run_shell(cmd, out, err);
+  double seconds = timer.getMicroSeconds() / 1000000.0;
+  if (!err.empty()) {
+    Logger::Error("%s", err.c_str());
+  }
+  if (!ok) {
+    Logger::Error("failed to compile %s", source.c_str());
+    Lock lock(m_mutex);
+    m_failed++;
+    return;
+  }
+  Logger::Verbose("compiled %s in %.1fs", source.c_str(), seconds);
+
+  if (!cached.empty()) {
+    // another hphp may be filling the same cache
+    string tmp = cached + "." + boost::lexical_cast<string>(getpid()) + "." +
+      boost::lexical_cast<string>(pthread_self());
+    if (Util::copy(object.c_str(), tmp.c_str()) == 0) {
+      Util::rename(tmp.c_str(), cached.c_str());
+    } else {
+      unlink(tmp.c_str());
+    }
+  }
+
+  Lock lock(m_mutex);
+  m_compiled++;
+  m_costs[source] = seconds;
+}
+
+bool CompileServer::compile(vector<string> &objects) {
+  vector<string> sources;
+  findSources("", sources);
+
+  // files never compiled before are estimated by size
+  double knownCost = 0.0;
+  int64 knownSize = 0;
+  vector<pair<double, int64> > estimates;
+  for (unsigned int i = 0; i < sources.size(); i++) {
+    struct stat sb;
+    int64 size = stat((m_root + "/" + sources[i]).c_str(), &sb) ?
+      0 : sb.st_size;
+    CostMap::const_iterator iter = m_costs.find(sources[i]);
+    double cost = iter == m_costs.end() ? -1.0 : iter->second;
+    if (cost >= 0.0) {
+      knownCost += cost;
+      knownSize += size;
+    }
+    estimates.push_back(pair<double, int64>(cost, size));
+  }
+  double perByte = knownSize ? knownCost / knownSize : 1.0;
+  vector<pair<double, string> > order;
+  for (unsigned int i = 0; i < sources.size(); i++) {
+    double cost = estimates[i].first;
+    if (cost < 0.0) cost = estimates[i].second * perByte;
+    order.push_back(pair<double, string>(-cost, sources[i]));
+  }
+  sort(order.begin(), order.end());
+
+  {
+    JobQueueDispatcher<string, CompileWorker>
+      dispatcher(m_jobs, true, 0, this);
+    for (unsigned int i = 0; i < order.size(); i++) {
+      dispatcher.enqueue(order[i].second);
+    }
+    dispatcher.run();
+  }
+
+  // forget files that are no longer generated
+  CostMap costs;
+  for (unsigned int i = 0; i < sources.size(); i++) {
+    CostMap::const_iterator iter = m_costs.find(sources[i]);
+    if (iter != m_costs.end()) costs[iter->first] = iter->second;
+    objects.push_back(m_root + "/" + object_name(sources[i]));
+  }
+  SaveCosts(m_costFile, costs);
+
+  Logger::Info("%d files compiled, %d object files reused, %d failed",
+               m_compiled, m_reused, m_failed);
+  return m_failed == 0;
+}
+
+bool CompileServer::link(const string &linkCmd,
+                         const vector<string> &objects) {
+  string all;
+  for (unsigned int i = 0; i < objects.size(); i++) {
+    if (i) all += ' ';
+    all += objects[i];
+  }
+  string cmd = linkCmd;
+  size_t pos = cmd.find("$OBJECTS");
+  if (pos == string::npos) {
+    cmd += " " + all;
+  } else {
+    cmd.replace(pos, strlen("$OBJECTS"), all);
+  }
+  string out, err;
+  bool ret = run_shell(cmd, out, err);
+  Logger::Verbose("%s", out.c_str());
+  if (!err.empty()) Logger::Error("%s", err.c_str());
+  return ret;
+}
@@ -0,0 +1,103 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __COMPILE_SERVER_H__
+#define __COMPILE_SERVER_H__
+
+#include <compiler/hphp.h>
+#include <util/mutex.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compiles generated .cpp files with a pool of g++ processes, instead of
+ * handing the output directory to cmake and make.
+ *
+ *  - Jobs are started longest first, by the compile time each file took in
+ *    previous builds, so one big file doesn't end up running alone at the end.
+ *  - Every object file is stored in a cache directory under a hash of its
+ *    preprocessed source and the compile command, and unchanged files are
+ *    copied back from there instead of being compiled again.
+ *  - Measured times are written back to a cost file, which the next build
+ *    also uses to decide how to split large cluster files.
+ */
+class CompileServer {
+public:
+  typedef std::map<std::string, double> CostMap;
+
+  /**
+   * Cost file format: one "<seconds> <path relative to output dir>" per line.
+   */
+  static void LoadCosts(const std::string &file, CostMap &costs);
+  static void SaveCosts(const std::string &file, const CostMap &costs);
+
+  /**
+   * Recorded cost of a generated file, including any "<base>-<n>.cpp" pieces
+   * it was split into last time. Returns 0.0 when it was never compiled.
+   */
+  static double GetCost(const CostMap &costs, const std::string &file);
+
+public:
+  /**
+   * compileCmd is run through /bin/sh with " -o <object> <source>" appended.
+   * cacheDir may be empty, in which case nothing is reused or saved.
+   */
+  CompileServer(const std::string &root, const std::string &compileCmd,
+                const std::string &cacheDir, int jobs);
+
+  /**
+   * Compiles all .cpp files under root. Object paths are returned in the
+   * same order as sources. Returns false if any file failed to compile.
+   */
+  bool compile(std::vector<std::string> &objects);
+
+  /**
+   * Runs linkCmd through /bin/sh after replacing $OBJECTS with all the
+   * object files from compile().
+   */
+  bool link(const std::string &linkCmd,
+            const std::vector<std::string> &objects);
+
+  int getCompiled() const { return m_compiled;}
+  int getReused() const { return m_reused;}
+
+  // called by worker threads
+  void compileOne(const std::string &source);
+
+private:
+  std::string m_root;
+  std::string m_compileCmd;
+  std::string m_cacheDir;
+  std::string m_costFile;
+  int m_jobs;
+
+  Mutex m_mutex;
+  CostMap m_costs;
+  int m_compiled;
+  int m_reused;
+  int m_failed;
+
+  void findSources(const std::string &dir, std::vector<std::string> &out);
+  std::string getCommand(const std::string &source) const;
+  bool getCacheKey(const std::string &source, const std::string &cmd,
+                   std::string &key);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __COMPILE_SERVER_H__
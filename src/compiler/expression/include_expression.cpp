@@ -194,7 +194,10 @@ string IncludeExpression::CheckInclude(ConstructPtr includeExp,
 
 void IncludeExpression::onParse(AnalysisResultConstPtr ar, FileScopePtr scope) {
   m_include = CheckInclude(shared_from_this(), m_exp, m_documentRoot);
-  if (!m_include.empty()) ar->parseOnDemand(m_include);
+  if (!m_include.empty()) {
+    scope->addIncludeTarget(m_include);
+    ar->parseOnDemand(m_include);
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,381 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <compiler/incremental_cache.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <utime.h>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <deque>
+#include <compiler/analysis/analysis_result.h>
+#include <compiler/analysis/file_scope.h>
+#include <compiler/option.h>
+#include <util/util.h>
+#include <util/logger.h>
+#include <util/hash.h>
+
+using namespace HPHP;
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void split_tabs(const string &line, vector<string> &fields) {
+  fields.clear();
+  size_t start = 0;
+  while (true) {
+    size_t pos = line.find('\t', start);
+    if (pos == string::npos) {
+      fields.push_back(line.substr(start));
+      return;
+    }
+    fields.push_back(line.substr(start, pos - start));
+    start = pos + 1;
+  }
+}
+
+string IncrementalCache::HashString(const string &s) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%016llx-%x",
+           (unsigned long long)hash_string_cs(s.data(), s.size()),
+           (unsigned int)s.size());
+  return buf;
+}
+
+string IncrementalCache::HashFile(const string &path) {
+  ifstream f(path.c_str(), ios::in | ios::binary);
+  if (!f) return "";
+  ostringstream content;
+  content << f.rdbuf();
+  return HashString(content.str());
+}
+
+string IncrementalCache::HashDir(const string &dir) {
+  DIR *d = opendir(dir.c_str());
+  if (!d) return "";
+  vector<string> names;
+  dirent *e;
+  while ((e = readdir(d)) != NULL) {
+    names.push_back(e->d_name);
+  }
+  closedir(d);
+  sort(names.begin(), names.end());
+  string listing;
+  for (unsigned int i = 0; i < names.size(); i++) {
+    listing += names[i];
+    listing += '\n';
+  }
+  return HashString(listing);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+IncrementalCache::IncrementalCache(const string &outputDir, const string &key)
+    : m_root(outputDir), m_sameLayout(false), m_affected(0),
+      m_outputChanged(0), m_outputUnchanged(0) {
+  if (!m_root.empty() && m_root[m_root.size() - 1] == '/') {
+    m_root = m_root.substr(0, m_root.size() - 1);
+  }
+  m_file = m_root + "/incremental_cache";
+  m_current.key = HashString(key);
+}
+
+string IncrementalCache::sourcePath(const string &name) const {
+  return name[0] == '/' ? name : m_sourceRoot + name;
+}
+
+string IncrementalCache::relativeName(const string &name) const {
+  if (!m_sourceRoot.empty() && name.find(m_sourceRoot) == 0) {
+    return name.substr(m_sourceRoot.size());
+  }
+  return name;
+}
+
+void IncrementalCache::load() {
+  ifstream f(m_file.c_str());
+  string line;
+  vector<string> fields;
+  Source *source = NULL;
+  while (getline(f, line)) {
+    split_tabs(line, fields);
+    const string &tag = fields[0];
+    if (tag == "key" && fields.size() == 2) {
+      m_last.key = fields[1];
+    } else if (tag == "input" && fields.size() == 2) {
+      m_last.inputs.insert(fields[1]);
+    } else if (tag == "source" && fields.size() == 3) {
+      source = &m_last.sources[fields[1]];
+      source->hash = fields[2];
+    } else if (tag == "include" && fields.size() == 2 && source) {
+      source->includes.push_back(fields[1]);
+    } else if (tag == "dep" && fields.size() == 2 && source) {
+      source->deps.push_back(fields[1]);
+    } else if (tag == "dir" && fields.size() == 3) {
+      m_last.dirs[fields[1]] = fields[2];
+    } else if (tag == "output" && fields.size() == 4) {
+      Output &output = m_last.outputs[fields[1]];
+      output.hash = fields[2];
+      output.mtime = atoll(fields[3].c_str());
+    } else {
+      Logger::Warning("ignoring bad line in %s: %s", m_file.c_str(),
+                      line.c_str());
+      m_last = Record(); // all or nothing
+      return;
+    }
+  }
+}
+
+bool IncrementalCache::upToDate(const string &root,
+                                const set<string> &inputs) {
+  m_sourceRoot = root;
+  m_current.inputs.clear();
+  for (set<string>::const_iterator iter = inputs.begin();
+       iter != inputs.end(); ++iter) {
+    m_current.inputs.insert(relativeName(*iter));
+  }
+
+  m_changed.clear();
+  for (SourceMap::const_iterator iter = m_last.sources.begin();
+       iter != m_last.sources.end(); ++iter) {
+    if (HashFile(sourcePath(iter->first)) != iter->second.hash) {
+      m_changed.insert(iter->first);
+    }
+  }
+  for (set<string>::const_iterator iter = m_current.inputs.begin();
+       iter != m_current.inputs.end(); ++iter) {
+    if (m_last.sources.find(*iter) == m_last.sources.end()) {
+      m_changed.insert(*iter);
+    }
+  }
+
+  m_sameLayout = !m_last.key.empty() && m_last.key == m_current.key &&
+    m_last.inputs == m_current.inputs;
+  for (map<string, string>::const_iterator iter = m_last.dirs.begin();
+       m_sameLayout && iter != m_last.dirs.end(); ++iter) {
+    if (HashDir(iter->first) != iter->second) {
+      m_sameLayout = false;
+    }
+  }
+  if (!m_sameLayout) {
+    return false;
+  }
+
+  findAffected();
+  return m_changed.empty() && !m_last.outputs.empty() && outputsUntouched();
+}
+
+void IncrementalCache::findAffected() {
+  map<string, vector<string> > users;
+  for (SourceMap::const_iterator iter = m_last.sources.begin();
+       iter != m_last.sources.end(); ++iter) {
+    const Source &source = iter->second;
+    for (unsigned int i = 0; i < source.deps.size(); i++) {
+      users[source.deps[i]].push_back(iter->first);
+    }
+    for (unsigned int i = 0; i < source.includes.size(); i++) {
+      users[source.includes[i]].push_back(iter->first);
+    }
+  }
+
+  set<string> reached(m_changed.begin(), m_changed.end());
+  deque<string> todo(m_changed.begin(), m_changed.end());
+  while (!todo.empty()) {
+    map<string, vector<string> >::const_iterator iter =
+      users.find(todo.front());
+    todo.pop_front();
+    if (iter == users.end()) continue;
+    for (unsigned int i = 0; i < iter->second.size(); i++) {
+      if (reached.insert(iter->second[i]).second) {
+        todo.push_back(iter->second[i]);
+      }
+    }
+  }
+  m_affected = reached.size() - m_changed.size();
+}
+
+void IncrementalCache::getPrefetch(vector<string> &files) {
+  files.clear();
+  if (!m_sameLayout) return;
+
+  set<string> reached(m_current.inputs.begin(), m_current.inputs.end());
+  deque<string> todo(m_current.inputs.begin(), m_current.inputs.end());
+  while (!todo.empty()) {
+    string name = todo.front();
+    todo.pop_front();
+    SourceMap::const_iterator iter = m_last.sources.find(name);
+    if (iter == m_last.sources.end() ||
+        m_changed.find(name) != m_changed.end()) {
+      continue; // we don't know what it includes now
+    }
+    const vector<string> &includes = iter->second.includes;
+    for (unsigned int i = 0; i < includes.size(); i++) {
+      const string &include = includes[i];
+      // only what parse-on-demand actually parsed last time
+      if (m_last.sources.find(include) != m_last.sources.end() &&
+          reached.insert(include).second) {
+        todo.push_back(include);
+        files.push_back(include);
+      }
+    }
+  }
+}
+
+bool IncrementalCache::outputsUntouched() const {
+  for (OutputMap::const_iterator iter = m_last.outputs.begin();
+       iter != m_last.outputs.end(); ++iter) {
+    struct stat sb;
+    if (stat((m_root + "/" + iter->first).c_str(), &sb) ||
+        sb.st_mtime != iter->second.mtime) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void IncrementalCache::snapshot() {
+  for (OutputMap::iterator iter = m_last.outputs.begin();
+       iter != m_last.outputs.end();) {
+    struct stat sb;
+    if (stat((m_root + "/" + iter->first).c_str(), &sb) ||
+        sb.st_mtime != iter->second.mtime) {
+      m_last.outputs.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+void IncrementalCache::findOutputs(const string &dir, vector<string> &out) {
+  DIR *d = opendir((m_root + "/" + dir).c_str());
+  if (!d) return;
+  dirent *e;
+  while ((e = readdir(d)) != NULL) {
+    string name = e->d_name;
+    if (name[0] == '.' || name == "CMakeFiles") continue; // not ours
+    string path = dir.empty() ? name : dir + "/" + name;
+    struct stat sb;
+    if (lstat((m_root + "/" + path).c_str(), &sb)) continue;
+    if (S_ISDIR(sb.st_mode)) {
+      findOutputs(path, out);
+    } else if (S_ISREG(sb.st_mode) &&
+               ((name.size() > 4 && name.substr(name.size() - 4) == ".cpp") ||
+                (name.size() > 2 && name.substr(name.size() - 2) == ".h"))) {
+      out.push_back(path);
+    }
+  }
+  closedir(d);
+}
+
+void IncrementalCache::update(AnalysisResultPtr ar, bool restoreTimes) {
+  const vector<FileScopePtr> &files = ar->getAllFilesVector();
+  for (unsigned int i = 0; i < files.size(); i++) {
+    FileScopePtr fs = files[i];
+    string name = relativeName(fs->getName());
+    string hash = HashFile(sourcePath(name));
+    if (hash.empty()) continue; // e.g. code from create_function()
+
+    Source &source = m_current.sources[name];
+    source.hash = hash;
+    const set<string> &includes = fs->getIncludeTargets();
+    for (set<string>::const_iterator iter = includes.begin();
+         iter != includes.end(); ++iter) {
+      source.includes.push_back(relativeName(*iter));
+    }
+    map<string, FileScopePtr> deps;
+    ar->getTrueDeps(fs, deps);
+    for (map<string, FileScopePtr>::const_iterator iter = deps.begin();
+         iter != deps.end(); ++iter) {
+      source.deps.push_back(relativeName(iter->first));
+    }
+
+    string path = sourcePath(name);
+    string dir = path.substr(0, path.rfind('/') + 1);
+    if (m_current.dirs.find(dir) == m_current.dirs.end()) {
+      m_current.dirs[dir] = HashDir(dir);
+    }
+  }
+  for (unsigned int i = 0; i < Option::IncludeSearchPaths.size(); i++) {
+    const string &dir = Option::IncludeSearchPaths[i];
+    m_current.dirs[dir] = HashDir(dir);
+  }
+
+  vector<string> outputs;
+  findOutputs("", outputs);
+  for (unsigned int i = 0; i < outputs.size(); i++) {
+    const string &name = outputs[i];
+    string path = m_root + "/" + name;
+    Output output;
+    struct stat sb;
+    output.hash = HashFile(path);
+    if (output.hash.empty() || stat(path.c_str(), &sb)) continue;
+    output.mtime = sb.st_mtime;
+
+    OutputMap::const_iterator iter = m_last.outputs.find(name);
+    if (iter != m_last.outputs.end() && iter->second.hash == output.hash &&
+        iter->second.mtime != output.mtime && restoreTimes) {
+      struct utimbuf times;
+      times.actime = times.modtime = iter->second.mtime;
+      if (utime(path.c_str(), &times) == 0) {
+        output.mtime = iter->second.mtime;
+      }
+    }
+    if (iter != m_last.outputs.end() && iter->second.hash == output.hash) {
+      m_outputUnchanged++;
+    } else {
+      m_outputChanged++;
+    }
+    m_current.outputs[name] = output;
+  }
+}
+
+bool IncrementalCache::save() {
+  string tmp = m_file + ".tmp";
+  {
+    ofstream f(tmp.c_str());
+    f << "key\t" << m_current.key << "\n";
+    for (set<string>::const_iterator iter = m_current.inputs.begin();
+         iter != m_current.inputs.end(); ++iter) {
+      f << "input\t" << *iter << "\n";
+    }
+    for (SourceMap::const_iterator iter = m_current.sources.begin();
+         iter != m_current.sources.end(); ++iter) {
+      const Source &source = iter->second;
+      f << "source\t" << iter->first << "\t" << source.hash << "\n";
+      for (unsigned int i = 0; i < source.includes.size(); i++) {
+        f << "include\t" << source.includes[i] << "\n";
+      }
+      for (unsigned int i = 0; i < source.deps.size(); i++) {
+        f << "dep\t" << source.deps[i] << "\n";
+      }
+    }
+    for (map<string, string>::const_iterator iter = m_current.dirs.begin();
+         iter != m_current.dirs.end(); ++iter) {
+      f << "dir\t" << iter->first << "\t" << iter->second << "\n";
+    }
+    for (OutputMap::const_iterator iter = m_current.outputs.begin();
+         iter != m_current.outputs.end(); ++iter) {
+      f << "output\t" << iter->first << "\t" << iter->second.hash << "\t"
+        << (long long)iter->second.mtime << "\n";
+    }
+    if (!f) {
+      Logger::Error("unable to write %s", tmp.c_str());
+      return false;
+    }
+  }
+  return Util::rename(tmp.c_str(), m_file.c_str()) == 0;
+}
@@ -0,0 +1,157 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __INCREMENTAL_CACHE_H__
+#define __INCREMENTAL_CACHE_H__
+
+#include <compiler/hphp.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+DECLARE_BOOST_TYPES(AnalysisResult);
+
+/**
+ * What one build into an output directory was made from, so the next build
+ * into the same directory can tell what changed.
+ *
+ * For every FileScope it records a hash of the source's content, the files
+ * it includes as resolved by the parser and the files it depends on for
+ * classes, functions and constants. For every generated .cpp and .h file it
+ * records a hash of the content and the modification time. The whole record
+ * is keyed by the command line, config files and hphp binary. Listings of
+ * the directories include paths are resolved in are recorded too, since a
+ * new file there can change what an unchanged source includes.
+ *
+ *  - When no source changed and the generated files are untouched, parsing,
+ *    analysis and code generation are skipped altogether.
+ *  - Otherwise, files that unchanged sources include are parsed in the
+ *    first round instead of being discovered one include level at a time.
+ *  - Generated files that come out the same as last time get their old
+ *    modification time back, so make only rebuilds what really changed.
+ *
+ * Type inference is whole-program: parameter types flow from callers into
+ * callees and global tables (literal strings, scalar arrays, class ids)
+ * are shared by all files. So a changed program is always analyzed in full;
+ * the dependency graph only tells how far a change reaches.
+ */
+class IncrementalCache {
+public:
+  /**
+   * "<64-bit hash>-<size>" of a file's content, or "" if it can't be read.
+   */
+  static std::string HashFile(const std::string &path);
+  static std::string HashString(const std::string &s);
+
+public:
+  IncrementalCache(const std::string &outputDir, const std::string &key);
+
+  /**
+   * Reads what the last build recorded, if anything.
+   */
+  void load();
+
+  /**
+   * Called before parsing with the package root and the files it was asked
+   * to parse, from the command line and from scanning input directories.
+   * True when the last build had the same key and inputs, none of the
+   * sources it parsed changed, and its generated files are untouched.
+   */
+  bool upToDate(const std::string &root, const std::set<std::string> &inputs);
+
+  /**
+   * After upToDate(): sources the last build reached from the inputs
+   * through includes of unchanged files. They will be included again, as
+   * long as the inputs themselves are the same. Changed files' includes are
+   * left to parse-on-demand.
+   */
+  void getPrefetch(std::vector<std::string> &files);
+
+  /**
+   * Changed, added or removed sources, and the number of other sources that
+   * depend on them directly or indirectly.
+   */
+  int getChangedCount() const { return m_changed.size();}
+  int getAffectedCount() const { return m_affected;}
+
+  /**
+   * Called before code generation: forgets generated files that were
+   * modified since the last build, so update() won't make them look older.
+   */
+  void snapshot();
+
+  /**
+   * Called after code generation: records the program's FileScopes and
+   * their dependencies, hashes all generated files, and gives the ones that
+   * didn't change their old modification time back if restoreTimes.
+   */
+  void update(AnalysisResultPtr ar, bool restoreTimes);
+
+  /**
+   * Writes the record. Only called when the build succeeded, so a failed
+   * build is never taken as up to date.
+   */
+  bool save();
+
+  int getOutputChanged() const { return m_outputChanged;}
+  int getOutputUnchanged() const { return m_outputUnchanged;}
+
+private:
+  struct Source {
+    std::string hash;
+    std::vector<std::string> includes;
+    std::vector<std::string> deps;
+  };
+  typedef std::map<std::string, Source> SourceMap;
+
+  struct Output {
+    std::string hash;
+    time_t mtime;
+  };
+  typedef std::map<std::string, Output> OutputMap;
+
+  struct Record {
+    std::string key;
+    std::set<std::string> inputs;
+    SourceMap sources;
+    std::map<std::string, std::string> dirs; // listings includes resolve in
+    OutputMap outputs;
+  };
+
+  std::string m_root;  // output directory
+  std::string m_file;
+  std::string m_sourceRoot;
+  Record m_last;
+  Record m_current;
+
+  std::set<std::string> m_changed;
+  bool m_sameLayout;
+  int m_affected;
+  int m_outputChanged;
+  int m_outputUnchanged;
+
+  std::string sourcePath(const std::string &name) const;
+  std::string relativeName(const std::string &name) const;
+  void findAffected();
+  static std::string HashDir(const std::string &dir);
+  bool outputsUntouched() const;
+  void findOutputs(const std::string &dir, std::vector<std::string> &out);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __INCREMENTAL_CACHE_H__
@@ -171,6 +171,7 @@ bool Option::GenConcat = false;
 bool Option::GenArrayCreate = false;
 bool Option::GenHashTableInvokeFile = true;
 bool Option::GenHashTableInvokeFunc = false;
+bool Option::GenPerfectHashCallInfo = true;
 bool Option::KeepStatementsWithNoEffect = false;
 
 int Option::ConditionalIncludeExpandLevel = 1;
@@ -185,6 +186,7 @@ std::string Option::JavaFFIRootPackage;
 
 std::string Option::ProgramName;
 std::string Option::PreprocessedPartitionConfig;
+std::string Option::CompileCostFile;
 
 bool Option::EnableHipHopSyntax = false;
 bool Option::EnableHipHopExperimentalSyntax = false;
@@ -155,6 +155,11 @@ public:
    */
   static bool GenHashTableInvokeFunc;
 
+  /**
+   * Generate perfect hash table lookup based get_call_info()
+   */
+  static bool GenPerfectHashCallInfo;
+
   /**
    * Separate compilation
    */
@@ -319,6 +324,7 @@ public:
 
   static std::string ProgramName;
   static std::string PreprocessedPartitionConfig; // generated by ppp.php
+  static std::string CompileCostFile; // written by CompileServer
 
   static bool EnableHipHopSyntax;
   static bool EnableHipHopExperimentalSyntax;
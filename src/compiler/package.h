@@ -58,6 +58,9 @@ public:
   int getLineCount() const { return m_lineCount;}
   int getCharCount() const { return m_charCount;}
   void getFiles(std::vector<std::string> &files) const;
+  const std::set<std::string> &getFilesToParse() const {
+    return m_filesToParse;
+  }
 
   void saveStatsToFile(const char *filename, int totalSeconds) const;
   int saveStatsToDB(ServerDataPtr server, int totalSeconds,
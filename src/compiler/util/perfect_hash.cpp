@@ -0,0 +1,98 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+#include <compiler/util/perfect_hash.h>
+#include <util/hash.h>
+#include <util/util.h>
+
+namespace HPHP {
+using namespace std;
+///////////////////////////////////////////////////////////////////////////////
+
+// displacements are emitted as unsigned short
+#define MAX_DISPLACEMENT 0xFFFF
+
+PerfectHashTable::PerfectHashTable(const vector<const char *> &keys,
+                                   bool caseInsensitive) {
+  if (keys.empty()) return;
+  set<int64> seen;
+  for (unsigned int i = 0; i < keys.size(); i++) {
+    int64 hash = caseInsensitive ?
+      hash_string_i(keys[i]) : hash_string_cs(keys[i], strlen(keys[i]));
+    if (!seen.insert(hash).second) return;
+    m_hashes.push_back(hash);
+  }
+
+  // keep at least 1/4 of the slots free, so displacements are found quickly
+  int slotCount = Util::roundUpToPowerOfTwo(keys.size() + keys.size() / 3);
+  for (int tries = 0; tries < 3; tries++, slotCount *= 2) {
+    if (build(slotCount)) return;
+  }
+  m_slots.clear();
+  m_disps.clear();
+}
+
+static bool bucket_greater(const vector<int> &b1, const vector<int> &b2) {
+  return b1.size() > b2.size();
+}
+
+bool PerfectHashTable::build(int slotCount) {
+  int bucketCount = slotCount / 4;
+  if (bucketCount < 1) bucketCount = 1;
+  int slotMask = slotCount - 1;
+  int bucketMask = bucketCount - 1;
+
+  // element 0 of each bucket is its index, keys follow
+  vector<vector<int> > buckets(bucketCount);
+  for (int i = 0; i < bucketCount; i++) {
+    buckets[i].push_back(i);
+  }
+  for (unsigned int i = 0; i < m_hashes.size(); i++) {
+    buckets[m_hashes[i] & bucketMask].push_back(i);
+  }
+  // largest buckets first, while most slots are still free
+  stable_sort(buckets.begin(), buckets.end(), bucket_greater);
+
+  m_slots.assign(slotCount, -1);
+  m_disps.assign(bucketCount, 0);
+  vector<int> slots;
+  for (unsigned int b = 0; b < buckets.size(); b++) {
+    const vector<int> &bucket = buckets[b];
+    if (bucket.size() == 1) break;
+    int disp = 0;
+    for (; disp <= MAX_DISPLACEMENT; disp++) {
+      slots.clear();
+      unsigned int k = 1;
+      for (; k < bucket.size(); k++) {
+        int slot = perfect_hash_slot(m_hashes[bucket[k]], disp, slotMask);
+        if (m_slots[slot] >= 0 ||
+            find(slots.begin(), slots.end(), slot) != slots.end()) {
+          break;
+        }
+        slots.push_back(slot);
+      }
+      if (k == bucket.size()) break;
+    }
+    if (disp > MAX_DISPLACEMENT) return false;
+    m_disps[bucket[0]] = disp;
+    for (unsigned int k = 1; k < bucket.size(); k++) {
+      m_slots[slots[k - 1]] = bucket[k];
+    }
+  }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
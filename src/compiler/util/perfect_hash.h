@@ -0,0 +1,67 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __PERFECT_HASH_H__
+#define __PERFECT_HASH_H__
+
+#include <compiler/hphp.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Places a fixed set of names into a table so that each one can be found
+ * with one probe, by hash and displacement: keys are grouped into buckets by
+ * the low bits of their hash, and every bucket gets a displacement that moves
+ * all its keys into free slots (see perfect_hash_slot() in util/hash.h).
+ *
+ * Generated code then looks up a name with
+ *
+ *   slots[perfect_hash_slot(hash, disp[hash & bucketMask], slotMask)]
+ *
+ * and one string compare, instead of a switch over hash values.
+ */
+class PerfectHashTable {
+public:
+  PerfectHashTable(const std::vector<const char *> &keys,
+                   bool caseInsensitive);
+
+  /**
+   * False if no table could be built, e.g. two keys have the same hash.
+   */
+  bool valid() const { return !m_slots.empty();}
+
+  int getSlotCount() const { return m_slots.size();}
+  int getBucketCount() const { return m_disps.size();}
+
+  /**
+   * Index into keys for each slot, or -1 for an empty slot.
+   */
+  int getSlot(int i) const { return m_slots[i];}
+  int getDisplacement(int i) const { return m_disps[i];}
+  int64 getHash(int key) const { return m_hashes[key];}
+
+private:
+  std::vector<int64> m_hashes;
+  std::vector<int> m_slots;
+  std::vector<int> m_disps;
+
+  bool build(int slotCount);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+#endif // __PERFECT_HASH_H__
@@ -18,8 +18,11 @@
 #include <boost/program_options/positional_options.hpp>
 #include <boost/program_options/variables_map.hpp>
 #include <boost/program_options/parsers.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include <compiler/package.h>
+#include <compiler/compile_server.h>
+#include <compiler/incremental_cache.h>
 #include <compiler/analysis/analysis_result.h>
 #include <compiler/analysis/alias_manager.h>
 #include <compiler/analysis/code_error.h>
@@ -38,6 +41,7 @@
 #include <util/async_func.h>
 
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <sys/wait.h>
 #include <dlfcn.h>
 
@@ -98,6 +102,12 @@ struct ProgramOptions {
   bool fl_annotate;
   string optimizations;
   string ppp;
+  int compileJobs;
+  string compileCommand;
+  string linkCommand;
+  string objectCache;
+  bool incremental;
+  string incrementalKey; // what else the generated code depends on
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -133,9 +143,10 @@ int lintTarget(const ProgramOptions &po);
 int analyzeTarget(const ProgramOptions &po, AnalysisResultPtr ar);
 int phpTarget(const ProgramOptions &po, AnalysisResultPtr ar);
 int cppTarget(const ProgramOptions &po, AnalysisResultPtr ar,
-              AsyncFileCacheSaver &fcThread, bool allowSys = true);
+              AsyncFileCacheSaver &fcThread, IncrementalCache *cache,
+              bool allowSys = true);
 int runTargetCheck(const ProgramOptions &po, AnalysisResultPtr ar,
-                   AsyncFileCacheSaver &fcThread);
+                   AsyncFileCacheSaver &fcThread, IncrementalCache *cache);
 int buildTarget(const ProgramOptions &po);
 int runTarget(const ProgramOptions &po);
 int generateSepExtCpp(const ProgramOptions &po, AnalysisResultPtr ar);
@@ -156,6 +167,12 @@ int main(int argc, char **argv) {
 
     Timer totalTimer(Timer::WallTime, "running hphp");
     createOutputDirectory(po);
+    if (po.compileJobs > 0) {
+      // so repartitioning can use what the last build measured
+      Option::CompileCostFile = (po.objectCache.empty() ?
+                                 po.outputDir : po.objectCache) +
+        "/compile_costs";
+    }
     if (ret == 0) {
       if (!po.nofork && !Process::IsUnderGDB()) {
         int pid = fork();
@@ -340,6 +357,31 @@ int prepareOptions(ProgramOptions &po, int argc, char **argv) {
      "files according to preprocessed file sizes, instead of original file "
      "sizes (default). Run bin/ppp.php to generate an HDF configuration file "
      "to specify here.")
+    ("compile-jobs",
+     value<int>(&po.compileJobs)->default_value(0),
+     "when building exe or lib, run this many g++ processes directly from "
+     "hphp instead of going through cmake and make. 0 (default) keeps using "
+     "the generated build files.")
+    ("compile-command",
+     value<string>(&po.compileCommand)->default_value(""),
+     "with --compile-jobs, the command to compile one .cpp file, for example "
+     "\"g++ -c -O3 -I$HPHP_HOME/src ...\". \"-o <object> <source>\" is "
+     "appended to it.")
+    ("link-command",
+     value<string>(&po.linkCommand)->default_value(""),
+     "with --compile-jobs, the command to link the program. $OBJECTS is "
+     "replaced with all object files, which are appended if it's missing.")
+    ("object-cache",
+     value<string>(&po.objectCache)->default_value(""),
+     "with --compile-jobs, a directory that keeps object files by a hash of "
+     "their preprocessed sources, plus measured compile times, so later "
+     "builds can skip unchanged files and balance the rest better.")
+    ("incremental",
+     value<bool>(&po.incremental)->default_value(false),
+     "with --target=cpp and --output-dir, remember what the last build into "
+     "the same directory was made from: skip parsing, analysis and code "
+     "generation when no source changed, and keep the old timestamps of "
+     "generated files that come out the same.")
     ;
 
   positional_options_description p;
@@ -462,6 +504,32 @@ int prepareOptions(ProgramOptions &po, int argc, char **argv) {
     Option::JavaFFIRootPackage = po.javaRoot;
   }
 
+  if (po.incremental) {
+    if (po.target != "cpp" || po.outputDir.empty() ||
+        !po.filecache.empty() || po.genStats || !po.dbStats.empty()) {
+      Logger::Warning("--incremental needs --target=cpp and --output-dir, "
+                      "and doesn't work with --file-cache or stats; "
+                      "ignoring it");
+      po.incremental = false;
+    } else {
+      // the command line, config files and the compiler itself decide what
+      // the same sources turn into
+      for (int i = 0; i < argc; i++) {
+        po.incrementalKey += argv[i];
+        po.incrementalKey += '\0';
+      }
+      for (unsigned int i = 0; i < po.config.size(); i++) {
+        po.incrementalKey += IncrementalCache::HashFile(po.config[i]);
+        po.incrementalKey += '\0';
+      }
+      struct stat sb;
+      if (stat("/proc/self/exe", &sb) == 0) {
+        po.incrementalKey += boost::lexical_cast<string>(sb.st_mtime) + "-" +
+          boost::lexical_cast<string>(sb.st_size);
+      }
+    }
+  }
+
   return 0;
 }
 
@@ -513,6 +581,11 @@ int process(const ProgramOptions &po) {
     ar->loadBuiltins();
   }
 
+  IncrementalCache *cache = NULL;
+  if (po.incremental) {
+    cache = new IncrementalCache(po.outputDir, po.incrementalKey);
+  }
+
   {
     Timer timer(Timer::WallTime, "parsing inputs");
     if (!po.inputs.empty() && po.target == "php" && po.format == "pickled") {
@@ -555,9 +628,29 @@ int process(const ProgramOptions &po) {
         }
       }
     }
+    if (cache) {
+      cache->load();
+      if (cache->upToDate(package.getRoot(), package.getFilesToParse())) {
+        Logger::Info("nothing changed since the last build into %s",
+                     po.outputDir.c_str());
+        delete cache;
+        return 0;
+      }
+      Logger::Info("%d files changed since the last build, "
+                   "%d more depend on them",
+                   cache->getChangedCount(), cache->getAffectedCount());
+      if (po.parseOnDemand) {
+        vector<string> prefetch;
+        cache->getPrefetch(prefetch);
+        for (unsigned int i = 0; i < prefetch.size(); i++) {
+          package.addSourceFile(prefetch[i].c_str());
+        }
+      }
+    }
     if (po.target != "filecache") {
       {
         if (!package.parse()) {
+          delete cache;
           return 1;
         }
       }
@@ -582,10 +675,10 @@ int process(const ProgramOptions &po) {
   } else if (po.target == "php") {
     ret = phpTarget(po, ar);
   } else if (po.target == "cpp") {
-    ret = cppTarget(po, ar, fileCacheThread);
+    ret = cppTarget(po, ar, fileCacheThread, cache);
     fatalErrorOnly = true;
   } else if (po.target == "run") {
-    ret = runTargetCheck(po, ar, fileCacheThread);
+    ret = runTargetCheck(po, ar, fileCacheThread, cache);
     fatalErrorOnly = true;
   } else if (po.target == "filecache") {
     // do nothing
@@ -628,6 +721,14 @@ int process(const ProgramOptions &po) {
   if (!po.filecache.empty()) {
     fileCacheThread.waitForEnd();
   }
+
+  if (cache) {
+    // with errors, the next build should report them again
+    if (ret == 0 && !Compiler::HasError()) {
+      cache->save();
+    }
+    delete cache;
+  }
   return ret;
 }
 
@@ -738,7 +839,8 @@ int phpTarget(const ProgramOptions &po, AnalysisResultPtr ar) {
 ///////////////////////////////////////////////////////////////////////////////
 
 int cppTarget(const ProgramOptions &po, AnalysisResultPtr ar,
-              AsyncFileCacheSaver &fcThread, bool allowSys /* = true */) {
+              AsyncFileCacheSaver &fcThread, IncrementalCache *cache,
+              bool allowSys /* = true */) {
   int ret = 0;
   int clusterCount = po.clusterCount;
   // format
@@ -789,6 +891,7 @@ int cppTarget(const ProgramOptions &po, AnalysisResultPtr ar,
   }
   ar->analyzeProgramFinal();
 
+  if (cache) cache->snapshot();
   {
     Timer timer(Timer::WallTime, "creating CPP files");
     if (po.syncDir.empty()) {
@@ -804,6 +907,12 @@ int cppTarget(const ProgramOptions &po, AnalysisResultPtr ar,
       boost::filesystem::remove_all(po.syncDir);
     }
   }
+  if (cache) {
+    // syncdir() already leaves identical files alone
+    cache->update(ar, po.syncDir.empty());
+    Logger::Info("%d generated files changed, %d stayed the same",
+                 cache->getOutputChanged(), cache->getOutputUnchanged());
+  }
 
   return ret;
 }
@@ -817,7 +926,32 @@ int generateSepExtCpp(const ProgramOptions &po, AnalysisResultPtr ar) {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+int compileTarget(const ProgramOptions &po) {
+  if (po.compileCommand.empty() || po.linkCommand.empty()) {
+    Logger::Error("--compile-jobs needs --compile-command and --link-command");
+    return 1;
+  }
+  Timer timer(Timer::WallTime, "compiling and linking CPP files");
+  CompileServer server(po.outputDir, po.compileCommand, po.objectCache,
+                       po.compileJobs);
+  vector<string> objects;
+  if (!server.compile(objects)) {
+    return 1;
+  }
+  string linkCommand = po.linkCommand;
+  if (po.format != "lib") {
+    linkCommand += " -o " + po.outputDir + "/" + po.program;
+  }
+  if (!server.link(linkCommand, objects)) {
+    return 1;
+  }
+  return 0;
+}
+
 int buildTarget(const ProgramOptions &po) {
+  if (po.compileJobs > 0) {
+    return compileTarget(po);
+  }
   const char *HPHP_HOME = getenv("HPHP_HOME");
   if (!HPHP_HOME || !*HPHP_HOME) {
     throw Exception("Environment variable HPHP_HOME is not set.");
@@ -853,9 +987,9 @@ int buildTarget(const ProgramOptions &po) {
 }
 
 int runTargetCheck(const ProgramOptions &po, AnalysisResultPtr ar,
-                   AsyncFileCacheSaver &fcThread) {
+                   AsyncFileCacheSaver &fcThread, IncrementalCache *cache) {
   // generate code
-  if (po.format != "sep" && cppTarget(po, ar, fcThread, false)) {
+  if (po.format != "sep" && cppTarget(po, ar, fcThread, cache, false)) {
     return 1;
   }
 
@@ -354,6 +354,30 @@ DefineFunction(
     ),
   ));
 
+DefineFunction(
+  array(
+    'name'   => "curl_multi_await",
+    'desc'   => "Blocks until at least one of the transfers on a cURL multi handle has completed, driving all of them in the meantime from an epoll set. Unlike a curl_multi_exec()/curl_multi_select() loop, this wakes up only when there is something to do, so waiting on many parallel transfers costs one wakeup instead of a spin.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Variant,
+      'desc'   => "Number of completed transfers that curl_multi_info_read() can now return, 0 on timeout or when nothing is running, -1 on failure.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "mh",
+        'type'   => Resource,
+        'desc'   => "A cURL multi handle returned by curl_multi_init().",
+      ),
+      array(
+        'name'   => "timeout",
+        'type'   => Double,
+        'value'  => "1.0",
+        'desc'   => "Time, in seconds, to wait for a transfer to complete.",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "curl_multi_getcontent",
@@ -718,6 +718,54 @@ DefineFunction(
     ),
   ));
 
+DefineFunction(
+  array(
+    'name'   => "mysql_async_query",
+    'desc'   => "Sends a query without waiting for its result, so queries to several connections can run at the same time. Collect the result with mysql_async_wait(). A connection holds at most one such query; any other query on it discards a result nobody collected.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Boolean,
+      'desc'   => "TRUE if the query was sent, FALSE on error.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "query",
+        'type'   => String,
+        'desc'   => "An SQL query.",
+      ),
+      array(
+        'name'   => "link_identifier",
+        'type'   => Variant,
+        'value'  => "null",
+        'desc'   => "The MySQL connection. If absent, default or current connection will be used.",
+      ),
+    ),
+  ));
+
+DefineFunction(
+  array(
+    'name'   => "mysql_async_wait",
+    'desc'   => "Waits until at least one of the connections has the result of its mysql_async_query() back, without tying up a thread per connection.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Variant,
+      'desc'   => "An array keyed like links, holding what mysql_query() would have returned for each query that completed. Empty on timeout or when none of the links has a pending query. FALSE on error.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "links",
+        'type'   => VariantVec,
+        'desc'   => "MySQL connections that have a query sent by mysql_async_query().",
+      ),
+      array(
+        'name'   => "timeout",
+        'type'   => Double,
+        'value'  => "1.0",
+        'desc'   => "How many seconds to wait for a result.",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "mysql_db_query",
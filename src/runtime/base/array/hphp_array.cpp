@@ -109,21 +109,24 @@ static inline bool isIntegerKey(CVarRef v) {
 //=============================================================================
 // Construction/destruction.
 
+inline size_t HphpArray::hashSize() const {
+  return m_packed ? 0 : computeTableSize(m_tableMask);
+}
+
 HphpArray::HphpArray(uint nSize /* = 0 */)
   : m_data(NULL), m_nextKI(0), m_nElms(0), m_hLoad(0), m_lastE(ElmIndEmpty),
-    m_linear(false), m_siPastEnd(false), m_dataPad(0), m_nIndirectElms(0) {
+    m_linear(false), m_siPastEnd(false), m_dataPad(0), m_packed(true),
+    m_nIndirectElms(0) {
 #ifdef PEDANTIC
   if (nSize > 0x7fffffffU) {
     raise_error("Cannot create an array with more than 2^31 - 1 elements");
   }
 #endif
   m_tableMask = computeMaskFromNumElms(nSize);
-  size_t tableSize = computeTableSize(m_tableMask);
   size_t maxElms = computeMaxElms(m_tableMask);
-  reallocData(maxElms, tableSize);
+  reallocData(maxElms, hashSize());
   Elm* elms = data2Elms(m_data);
   m_hash = elms2Hash(elms, maxElms);
-  initHash(m_hash, tableSize);
   m_pos = ArrayData::invalid_index;
 }
 
@@ -182,7 +185,7 @@ ssize_t HphpArray::size() const {
 
 void HphpArray::dumpDebugInfo() const {
   size_t maxElms = computeMaxElms(m_tableMask);
-  size_t tableSize = computeTableSize(m_tableMask);
+  size_t tableSize = hashSize();
   Elm* elms = data2Elms(m_data);
 
   fprintf(stderr,
@@ -387,7 +390,7 @@ CVarRef HphpArray::getValueRef(ssize_t pos) const {
 }
 
 bool HphpArray::isVectorData() const {
-  if (m_nElms == 0) {
+  if (m_packed || m_nElms == 0) {
     return true;
   }
   Elm* elms = data2Elms(m_data);
@@ -604,11 +607,18 @@ static bool hitIntKey(const HphpArray::Elm* e, int64 ki) {
   }
 
 ssize_t /*ElmInd*/ HphpArray::find(int64 ki) const {
+  if (m_packed) {
+    return size_t(ki) < size_t(m_lastE + 1) ? ssize_t(ki)
+                                             : ssize_t(ElmIndEmpty);
+  }
   FIND_BODY(ki, hitIntKey(&elms[pos], ki));
 }
 
 ssize_t /*ElmInd*/ HphpArray::find(const char* k, int len,
                                    int64 prehash) const {
+  if (m_packed) {
+    return ssize_t(ElmIndEmpty);
+  }
   FIND_BODY(prehash, hitStringKey(&elms[pos], k, len, prehash));
 }
 #undef FIND_BODY
@@ -648,17 +658,37 @@ ssize_t /*ElmInd*/ HphpArray::find(const char* k, int len,
     } \
   }
 
+// A packed array stays packed when an existing key or the next key to append
+// is looked up: m_packedSlot then plays the part of the hash table entry, so
+// callers need not know which layout they are dealing with. Any other key
+// needs a real hash table.
+
 HphpArray::ElmInd* HphpArray::findForInsert(int64 ki) const {
+  if (m_packed) {
+    if (size_t(ki) <= size_t(m_lastE + 1)) {
+      m_packedSlot = (ki <= m_lastE) ? ElmInd(ki) : ElmIndEmpty;
+      return &m_packedSlot;
+    }
+    const_cast<HphpArray*>(this)->unpack();
+  }
   FIND_FOR_INSERT_BODY(ki, hitIntKey(&elms[pos], ki));
 }
 
 HphpArray::ElmInd* HphpArray::findForInsert(const char* k, int len,
                                             int64 prehash) const {
+  if (m_packed) {
+    const_cast<HphpArray*>(this)->unpack();
+  }
   FIND_FOR_INSERT_BODY(prehash, hitStringKey(&elms[pos], k, len, prehash));
 }
 #undef FIND_FOR_INSERT_BODY
 
 HphpArray::ElmInd* HphpArray::findForNewInsert(size_t h0) const {
+  if (m_packed) {
+    // Only ever called for the next key to append.
+    m_packedSlot = ElmIndEmpty;
+    return &m_packedSlot;
+  }
   size_t tableMask = m_tableMask;
   size_t probeIndex = h0 & tableMask;
   ElmInd* ei = &m_hash[probeIndex];
@@ -977,7 +1007,7 @@ void HphpArray::reallocData(size_t maxElms, size_t tableSize) {
 
 void HphpArray::delinearize() {
   size_t maxElms = computeMaxElms(m_tableMask);
-  size_t tableSize = computeTableSize(m_tableMask);
+  size_t tableSize = hashSize();
   reallocData(maxElms, tableSize);
   Elm* elms = data2Elms(m_data);
   ElmInd* oldHash = m_hash;
@@ -1024,11 +1054,15 @@ void HphpArray::resize() {
 void HphpArray::grow() {
   ASSERT(m_tableMask <= 0x7fffffffU);
   m_tableMask = (uint)(size_t(m_tableMask) + size_t(m_tableMask) + size_t(1));
-  size_t tableSize = computeTableSize(m_tableMask);
+  size_t tableSize = hashSize();
   size_t maxElms = computeMaxElms(m_tableMask);
   reallocData(maxElms, tableSize);
   Elm* elms = data2Elms(m_data); // m_hash is currently invalid.
   m_hash = elms2Hash(elms, maxElms);
+  if (m_packed) {
+    m_hLoad = m_nElms;
+    return;
+  }
 
   // All the elements have been copied and their offsets from the base are
   // still the same, so we just need to build the new hash table.
@@ -1057,7 +1091,29 @@ void HphpArray::grow() {
   }
 }
 
+void HphpArray::unpack() {
+  ASSERT(m_packed);
+  m_packed = false;
+  size_t tableSize = computeTableSize(m_tableMask);
+  size_t maxElms = computeMaxElms(m_tableMask);
+  reallocData(maxElms, tableSize);
+  Elm* elms = data2Elms(m_data);
+  m_hash = elms2Hash(elms, maxElms);
+  initHash(m_hash, tableSize);
+  for (ElmInd pos = 0; pos <= m_lastE; ++pos) {
+    ElmInd* ei = findForNewInsert(pos);
+    *ei = pos;
+  }
+  m_hLoad = m_nElms;
+}
+
 void HphpArray::compact(bool renumber /* = false */) {
+  if (m_packed) {
+    // There are no tombstones to squeeze out, and the keys are 0..n-1
+    // already.
+    ASSERT(m_nElms == m_lastE + 1 && m_nextKI == m_nElms);
+    return;
+  }
   struct ElmKey {
     int64       h;
     StringData* key;
@@ -1985,6 +2041,16 @@ void HphpArray::erase(ElmInd* ei, bool updateNext /* = false */) {
   if (!validElmInd(pos)) {
     return;
   }
+  if (m_packed) {
+    if (pos == m_lastE && updateNext) {
+      // Popping the last element keeps the array packed.
+      --m_hLoad;
+    } else {
+      unpack();
+      ei = findForInsert(int64(pos));
+      ASSERT(*ei == pos);
+    }
+  }
 
   Elm* elms = data2Elms(m_data);
 
@@ -2082,7 +2148,13 @@ void HphpArray::erase(ElmInd* ei, bool updateNext /* = false */) {
   }
 }
 
+// Removing a key a packed array doesn't have leaves it packed, rather than
+// going through findForInsert(), which would build the hash table.
+
 ArrayData* HphpArray::remove(int64 k, bool copy) {
+  if (m_packed && find(k) == ssize_t(ElmIndEmpty)) {
+    return copy ? copyImpl() : NULL;
+  }
   if (copy) {
     HphpArray* a = copyImpl();
     a->erase(a->findForInsert(k));
@@ -2096,6 +2168,9 @@ ArrayData* HphpArray::remove(int64 k, bool copy) {
 }
 
 ArrayData* HphpArray::remove(CStrRef k, bool copy) {
+  if (m_packed) {
+    return copy ? copyImpl() : NULL;
+  }
   int64 prehash = k->hash();
   if (copy) {
     HphpArray* a = copyImpl();
@@ -2110,6 +2185,9 @@ ArrayData* HphpArray::remove(CStrRef k, bool copy) {
 }
 
 ArrayData* HphpArray::remove(litstr k, bool copy) {
+  if (m_packed) {
+    return copy ? copyImpl() : NULL;
+  }
   int len = strlen(k);
   int64 prehash = hash_string(k, len);
   if (copy) {
@@ -2126,6 +2204,9 @@ ArrayData* HphpArray::remove(litstr k, bool copy) {
 
 ArrayData* HphpArray::remove(CVarRef k, bool copy) {
   if (isIntegerKey(k)) {
+    if (m_packed && find(k.toInt64()) == ssize_t(ElmIndEmpty)) {
+      return copy ? copyImpl() : NULL;
+    }
     if (copy) {
       HphpArray* a = copyImpl();
       a->erase(a->findForInsert(k.toInt64()));
@@ -2137,6 +2218,9 @@ ArrayData* HphpArray::remove(CVarRef k, bool copy) {
     erase(findForInsert(k.toInt64()));
     return NULL;
   } else {
+    if (m_packed) {
+      return copy ? copyImpl() : NULL;
+    }
     StringData* key = k.getStringData();
     int64 prehash = key->hash();
     if (copy) {
@@ -2168,8 +2252,9 @@ HphpArray* HphpArray::copyImpl() const {
   target->m_linear = false;
   target->m_siPastEnd = false;
   target->m_dataPad = 0;
+  target->m_packed = m_packed;
   target->m_nIndirectElms = 0;
-  size_t tableSize = computeTableSize(m_tableMask);
+  size_t tableSize = hashSize();
   size_t maxElms = computeMaxElms(m_tableMask);
   target->reallocData(maxElms, tableSize);
   Elm* targetElms = data2Elms(target->m_data);
@@ -2367,7 +2452,9 @@ ArrayData* HphpArray::dequeue(Variant& value) {
     value = null;
   }
   // To match PHP-like semantics, the dequeue operation resets the array's
-  // internal iterator
+  // internal iterator. erase() may have moved the elements when the array
+  // was packed.
+  elms = data2Elms(m_data);
   m_pos = ssize_t(nextElm(elms, ElmIndEmpty));
   return NULL;
 }
@@ -2386,6 +2473,9 @@ ArrayData* HphpArray::prepend(CVarRef v, bool copy) {
   if (m_linear) {
     delinearize();
   }
+  if (m_packed) {
+    unpack();
+  }
 
   Elm* elms = data2Elms(m_data);
   if (elms[0].data.m_type != KindOfTombstone) {
@@ -2488,7 +2578,7 @@ CVarRef HphpArray::endRef() {
 bool HphpArray::calculate(int& size) {
   size += sizeof(void*); // Pointer to aligned data (starts out NULL).
   size += computeMaxElms(m_tableMask) * sizeof(Elm); // Array elements.
-  size += computeTableSize(m_tableMask) * sizeof(ElmInd); // Hash table.
+  size += hashSize() * sizeof(ElmInd); // Hash table.
   size += ElmAlignment; // Padding to allow for alignment in restore().
   return true;
 }
@@ -2535,8 +2625,7 @@ void HphpArray::backup(LinearAllocator& allocator) {
     allocator.backup((const char*)elms + ((m_lastE+1) * sizeof(Elm)),
                   (computeMaxElms(m_tableMask) - (m_lastE+1)) * sizeof(Elm));
   }
-  allocator.backup((const char*)m_hash,
-                   computeTableSize(m_tableMask) * sizeof(ElmInd));
+  allocator.backup((const char*)m_hash, hashSize() * sizeof(ElmInd));
   Elm pad;
   memset((void*)&pad, 0, sizeof(Elm));
   allocator.backup((const char*)&pad, sizeof(Elm));
@@ -2545,7 +2634,7 @@ void HphpArray::backup(LinearAllocator& allocator) {
 
 void HphpArray::restore(const char*& buffer) {
   size_t maxElms = computeMaxElms(m_tableMask);
-  size_t tableSize = computeTableSize(m_tableMask);
+  size_t tableSize = hashSize();
   void** alignedData = (void**)buffer;
   buffer += sizeof(void*);
 
@@ -205,6 +205,12 @@ private:
   //            +--------------------+
   //            | alignment padding? |
   //            +--------------------+
+  //
+  // An array starts out packed: as long as its keys are exactly 0..n-1 in
+  // order, element i lives in slot i, no hash table is allocated (m_hash
+  // points right past the element slots) and integer lookups index the
+  // slots directly. Any other key, or a gap left by unset(), converts the
+  // array to the hashed layout above for good; see unpack().
   void*   m_data;        // Contains elements and hash table.
   ElmInd* m_hash;        // Hash table.
   int64   m_nextKI;      // Next integer key to use for append.
@@ -216,8 +222,11 @@ private:
   char    m_siPastEnd;   // (true) ? strong iterators possibly past end.
   uchar   m_dataPad;     // Number of bytes that m_data was advanced to
                          //   achieve the required alignment
+  char    m_packed;      // (true) ? keys are 0..m_lastE, no hash table.
   ElmInd  m_nIndirectElms; // Total number of elements in the array with
                            //   m_type == KindOfIndirect
+  mutable ElmInd m_packedSlot; // Stands in for a hash table entry when
+                               //   m_packed, see findForInsert().
 
   inline void* getBlock() {
     return ((void*)(uintptr_t(m_data) - uintptr_t(m_dataPad)));
@@ -240,6 +249,17 @@ private:
    */
   inline ElmInd* ALWAYS_INLINE findForNewInsert(size_t h0) const;
 
+  /**
+   * Number of hash table entries allocated: none while the array is packed.
+   */
+  inline size_t hashSize() const;
+
+  /**
+   * unpack() builds the hash table for a packed array and leaves it in the
+   * hashed layout from then on.
+   */
+  void unpack() __attribute__((cold));
+
   bool nextInsert(CVarRef data);
   bool nextInsertWithRef(CVarRef data);
   bool addLvalImpl(int64 ki, Variant** pDest, bool doFind=true);
@@ -348,7 +348,10 @@ void pause_and_exit() {
   // NOTE: This is marked as __attribute__((noreturn)) in base/types.h
   // Signal sent, nothing can be trusted, don't do anything, as we might
   // write bad data, including calling exit handlers or destructors until the
-  // signal handler (StackTrace) has had a chance to exit.
+  // signal handler (StackTrace) has had a chance to exit. Log lines are the
+  // exception: they were queued before the fault, and the handler drains
+  // them too, so whichever gets there first writes them.
+  Logger::DrainAsyncWriter();
   sleep(300);
   // Should abort first, but it not try to exit
   pthread_exit(0);
@@ -358,6 +361,9 @@ void check_request_surprise(ThreadInfo *info) {
   RequestInjectionData &p = info->m_reqInjectionData;
   bool do_timedout, do_memExceeded, do_signaled;
 
+  // picks up directly malloc()ed memory, which may set memExceeded
+  info->m_mm->refreshStats();
+
   p.surpriseMutex.lock();
 
   // Even though we checked surprise outside of the lock, we don't need to
@@ -469,6 +475,8 @@ Variant throw_fatal_unset_static_property(const char *s, const char *prop) {
 }
 
 void check_request_timeout_ex(ThreadInfo *info, int lc) {
+  // loops may grow strings without making any calls
+  info->m_refreshStatsCountdown = 0;
   check_request_timeout(info);
   if (RuntimeOption::MaxLoopCount > 0 && lc > RuntimeOption::MaxLoopCount) {
     throw FatalErrorException(0, "loop iterated over %d times",
@@ -35,6 +35,7 @@
 #include <util/logger.h>
 #include <util/process.h>
 #include <util/text_color.h>
+#include <util/string_kernels.h>
 
 using namespace std;
 
@@ -49,6 +50,7 @@ ExecutionContext::ExecutionContext()
     m_maxTime(RuntimeOption::RequestTimeoutSeconds),
     m_cwd(Process::CurrentWorkingDirectory),
     m_out(NULL), m_implicitFlush(false), m_protectedLevel(0),
+    m_streamBytes(0), m_streamAfterHead(false),
     m_stdout(NULL), m_stdoutData(NULL),
     m_errorState(ExecutionContext::NoError),
     m_errorReportingLevel(RuntimeOption::RuntimeErrorReportingLevel),
@@ -219,12 +221,41 @@ void ExecutionContext::writeStdout(const char *s, int len) {
 void ExecutionContext::write(const char *s, int len) {
   if (m_out) {
     m_out->append(s, len);
+    if ((m_streamBytes || m_streamAfterHead) && len > 0) {
+      streamOutput(len);
+    }
   } else {
     writeStdout(s, len);
   }
   if (m_implicitFlush) flush();
 }
 
+void ExecutionContext::streamOutput(int len) {
+  // leave what ob_start() buffers are collecting alone
+  if (m_out != &m_buffers.front()->oss) return;
+
+  bool ready = m_streamBytes && m_out->size() >= m_streamBytes;
+  if (!ready && m_streamAfterHead) {
+    static const char head[] = "</head>";
+    const int headLen = sizeof(head) - 1;
+    // it may have started in the previous write
+    int start = m_out->size() - len - (headLen - 1);
+    if (start < 0) start = 0;
+    ready = StringKernels::FindCaseInsensitive(m_out->data() + start,
+                                               m_out->size() - start,
+                                               head, headLen) >= 0;
+    if (ready) m_streamAfterHead = false;
+  }
+  if (!ready) return;
+
+  flush();
+  if (!m_out->empty()) {
+    // not flushable (HTTP/1.0, HEAD, EnableEarlyFlush off), so stop trying
+    m_streamBytes = 0;
+    m_streamAfterHead = false;
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // output buffers
 
@@ -389,16 +420,21 @@ void ExecutionContext::flush() {
     StringBuffer &oss = m_buffers.front()->oss;
     if (!oss.empty()) {
       if (m_transport) {
-        m_transport->sendRaw((void*)oss.data(), oss.size(), 200, false, true);
+        m_transport->sendBuffer(oss, 200, true);
       } else {
         writeStdout(oss.data(), oss.size());
         fflush(stdout);
+        oss.reset();
       }
-      oss.reset();
     }
   }
 }
 
+void ExecutionContext::obSetStreaming(int bytes, bool afterHead) {
+  m_streamBytes = bytes > 0 ? bytes : 0;
+  m_streamAfterHead = afterHead;
+}
+
 void ExecutionContext::resetCurrentBuffer() {
   if (m_buffers.empty()) {
     m_out = NULL;
@@ -130,6 +130,7 @@ public:
   void obStart(CVarRef handler = null);
   String obCopyContents();
   String obDetachContents();
+  StringBuffer *obGetBuffer() { return m_out;} // NULL if not buffering
   int obGetContentLength();
   void obClean();
   bool obFlush();
@@ -143,6 +144,13 @@ public:
   void obProtect(bool on); // making sure obEnd() never passes current level
   void flush();
 
+  /**
+   * Early-flush page output while the request runs, each time bytes of it
+   * are pending (0 for never), and once "</head>" is written if afterHead.
+   * Output inside ob_start() buffers is not affected.
+   */
+  void obSetStreaming(int bytes, bool afterHead);
+
   /**
    * Request sequences and program execution hooks.
    */
@@ -227,6 +235,8 @@ private:
   std::list<OutputBuffer*> m_buffers; // a stack of output buffers
   bool m_implicitFlush;
   int m_protectedLevel;
+  int m_streamBytes;
+  bool m_streamAfterHead;
   PFUNC_STDOUT m_stdout;
   void *m_stdoutData;
 
@@ -263,6 +273,7 @@ private:
 
   // helper functions
   void resetCurrentBuffer();
+  void streamOutput(int len);
   void executeFunctions(CArrRef funcs);
 };
 
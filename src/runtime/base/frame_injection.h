@@ -65,25 +65,70 @@ public:
 
 public:
   // NOTE: obj has to be the root object
+  //
+  // These run on every generated function call, so they are all inline and
+  // share one init(). Walking the stack for backtraces is left to the rarely
+  // called static functions above.
+
   // constructors with hot profiler
-  FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name);
+  FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name)
+      : m_class(cls), m_name(name), m_object(NULL), m_line(0), m_flags(0),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, true);
+  }
   FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name,
-                 ObjectData *obj);
-  FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name, int fs);
+                 ObjectData *obj)
+      : m_class(cls), m_name(name), m_object(obj), m_line(0), m_flags(0),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, true);
+  }
+  FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name, int fs)
+      : m_class(cls), m_name(name), m_object(NULL), m_line(0), m_flags(fs),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, true);
+  }
   FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name,
-                 ObjectData *obj, int fs);
+                 ObjectData *obj, int fs)
+      : m_class(cls), m_name(name), m_object(obj), m_line(0), m_flags(fs),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, true);
+  }
 
   // constructors without hot profiler
   FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name,
-                 bool unused);
+                 bool unused)
+      : m_class(cls), m_name(name), m_object(NULL), m_line(0), m_flags(0),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, false);
+  }
   FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name,
-                 ObjectData *obj, bool unused);
+                 ObjectData *obj, bool unused)
+      : m_class(cls), m_name(name), m_object(obj), m_line(0), m_flags(0),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, false);
+  }
   FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name, int fs,
-                 bool unused);
+                 bool unused)
+      : m_class(cls), m_name(name), m_object(NULL), m_line(0), m_flags(fs),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, false);
+  }
   FrameInjection(ThreadInfo *&info, CStrRef cls, const char *name,
-                 ObjectData *obj, int fs, bool unused);
+                 ObjectData *obj, int fs, bool unused)
+      : m_class(cls), m_name(name), m_object(obj), m_line(0), m_flags(fs),
+        m_staticClass(NULL), m_callingObject(NULL) {
+    init(info, false);
+  }
 
-  virtual ~FrameInjection();
+  virtual ~FrameInjection() {
+    m_info->m_top = m_prev;
+#ifdef HOTPROFILER
+    if (m_prof) {
+      Profiler *prof = m_info->m_profiler;
+      if (prof) end_profiler_frame(prof);
+    }
+#endif
+  }
 
   /**
    * Simple accessors
@@ -147,19 +192,23 @@ private:
   const String   *m_staticClass;
   ObjectData     *m_callingObject;
 
-  inline ThreadInfo *doCommon() {
-    m_info = ThreadInfo::s_threadInfo.get();
+  inline void init(ThreadInfo *&info, bool prof) {
+    info = m_info = ThreadInfo::s_threadInfo.get();
     ASSERT(m_class.get());
     ASSERT(m_name);
-    m_prev = m_info->m_top;
-    m_info->m_top = this;
-    return m_info;
-  }
-  inline void hotProfilerInit(ThreadInfo *info, const char *name) {
+    m_prev = info->m_top;
+    info->m_top = this;
 #ifdef HOTPROFILER
-    m_prof = true;
-    Profiler *prof = m_info->m_profiler;
-    if (prof) begin_profiler_frame(prof, name);
+    m_prof = prof;
+    if (prof && info->m_profiler) {
+      begin_profiler_frame(info->m_profiler, m_name);
+    }
+#endif
+#ifdef INFINITE_RECURSION_DETECTION
+    check_recursion(info);
+#endif
+#ifdef REQUEST_TIMEOUT_DETECTION
+    check_request_timeout(info);
 #endif
   }
 
@@ -168,6 +168,8 @@ void *SmartAllocatorImpl::allocHelper() {
       if (m_stats->alloc > m_stats->peakAlloc) {
         m_stats->peakAlloc = m_stats->alloc;
       }
+      // the request grew: update peak usage and check the memory limit
+      MemoryManager::TheMemoryManager()->refreshStats();
     } else {
       // still have some blocks left from the last batch
       char *p = m_blocks.back() + m_colMax;
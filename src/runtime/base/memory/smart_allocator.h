@@ -180,7 +180,7 @@ public:
 #endif
     ASSERT(m_stats);
     // Just update the usage, while the peakUsage is maintained by
-    // FrameInjection.
+    // MemoryManager::refreshStats().
     m_stats->usage += m_itemSize;
     if (m_freelist.size() > 0) {
       // Fast path
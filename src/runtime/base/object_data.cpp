@@ -15,6 +15,8 @@
 */
 
 #include <runtime/base/object_data.h>
+#include <runtime/base/property_shape.h>
+#include <runtime/base/runtime_option.h>
 #include <runtime/base/complex_types.h>
 #include <runtime/base/type_conversions.h>
 #include <runtime/base/builtin_functions.h>
@@ -45,7 +47,7 @@ static StaticString s___callStatic("__callStatic");
 // constructor/destructor
 
 ObjectData::ObjectData(bool isResource /* = false */)
-    : o_properties(NULL), o_attribute(0) {
+    : o_properties(NULL), o_slots(NULL), o_attribute(0) {
   if (!isResource) {
     o_id = ++(*os_max_id);
   }
@@ -55,6 +57,9 @@ ObjectData::~ObjectData() {
   if (o_properties) {
     o_properties->release();
   }
+  if (o_slots) {
+    o_slots->release();
+  }
   int &pmax = *os_max_id;
   if (o_id && o_id == pmax) {
     --pmax;
@@ -224,10 +229,28 @@ Variant *ObjectData::o_realProp(CStrRef propName, int flags,
 }
 
 Variant *ObjectData::o_realPropPublic(CStrRef propName, int flags) const {
-  if (propName.size() > 0 &&
-      !(flags & RealPropNoDynamic) &&
-      (o_properties ||
-       ((flags & RealPropCreate) && (o_properties = NEW(Array)(), true)))) {
+  if (propName.size() == 0 || (flags & RealPropNoDynamic)) return NULL;
+
+  // Properties go into slots until the shape is full; after that, and for
+  // names added back after an unset, into o_properties, so that slots
+  // followed by o_properties is always in insertion order.
+  if (o_slots) {
+    bool found;
+    Variant *t = o_slots->find(propName, found);
+    if (t) return t;
+    if (!found && !o_properties && (flags & RealPropCreate) &&
+        (t = o_slots->add(propName))) {
+      return t;
+    }
+  } else if (!o_properties && (flags & RealPropCreate) &&
+             RuntimeOption::UseObjectShapes &&
+             PropertyShape::Empty()->transition(propName)) {
+    o_slots = NEW(PropertySlots)(PropertyShape::Empty());
+    return o_slots->add(propName);
+  }
+
+  if (o_properties ||
+      ((flags & RealPropCreate) && (o_properties = NEW(Array)(), true))) {
     return o_properties->lvalPtr(propName,
                                  flags & RealPropWrite, flags & RealPropCreate);
   }
@@ -365,6 +388,9 @@ void ObjectData::o_setArray(CArrRef properties) {
 }
 
 void ObjectData::o_getArray(Array &props, bool pubOnly /* = false */) const {
+  if (o_slots) {
+    o_slots->getArray(props);
+  }
   if (o_properties && !o_properties->empty()) {
     for (ArrayIter it(*o_properties); !it.end(); it.next()) {
       Variant key = it.first();
@@ -536,7 +562,18 @@ Array ObjectData::o_toIterArray(CStrRef context,
     dynamics.remove(prop->name);
   }
   if (!dynamics.empty()) {
-    if (getRef) {
+    if (getRef && o_slots) {
+      // dynamics is a copy built from the slots, so bind to the slots (or
+      // o_properties, past the shape) themselves
+      for (ArrayIter iter(dynamics); iter; ++iter) {
+        // Object property names are always strings.
+        String key = iter.first().toString();
+        if (Variant *value = o_realPropPublic(key, RealPropWrite)) {
+          Variant &av = ret.lvalAt(key, false, true);
+          av = ref(*value);
+        }
+      }
+    } else if (getRef) {
       for (ArrayIter iter(o_getDynamicProperties()); iter; ++iter) {
         // Object property names are always strings.
         String key = iter.first().toString();
@@ -554,6 +591,11 @@ Array ObjectData::o_toIterArray(CStrRef context,
 }
 
 Array ObjectData::o_getDynamicProperties() const {
+  if (o_slots) {
+    Array props = Array::Create();
+    ObjectData::o_getArray(props);
+    return props;
+  }
   if (o_properties) return *o_properties;
   return Array();
 }
@@ -767,6 +809,9 @@ ObjectData *ObjectData::clone() {
 }
 
 void ObjectData::cloneSet(ObjectData *clone) {
+  if (o_slots) {
+    clone->o_slots = o_slots->clone();
+  }
   if (o_properties) {
     clone->o_properties = NEW(Array)(*o_properties);
   }
@@ -820,6 +865,8 @@ void ObjectData::o_unset(CStrRef prop, CStrRef context) {
     if (Variant *t = o_realProp(prop,
                                 RealPropWrite|RealPropNoDynamic, context)) {
       unset(*t);
+    } else if (o_slots && o_slots->remove(prop)) {
+      // left a hole in the slots
     } else if (o_properties && o_properties->exists(prop, true)) {
       o_properties->weakRemove(prop, true);
     }
@@ -855,6 +902,11 @@ Variant *ObjectData::___lval(Variant v_name) {
   return NULL;
 }
 Variant &ObjectData::___offsetget_lval(Variant v_name) {
+  if (o_slots && v_name.isString()) {
+    Variant *t = ObjectData::o_realPropPublic(v_name.toString(),
+                                              RealPropCreate | RealPropWrite);
+    if (t) return *t;
+  }
   if (!o_properties) {
     // this is needed, since a lval() is actually going to create a null
     // element in properties array
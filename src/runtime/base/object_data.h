@@ -38,6 +38,7 @@ class IArrayIterator;
 typedef SmartPtr<IArrayIterator> ArrayIterPtr;
 class MutableArrayIter;
 typedef SmartPtr<MutableArrayIter> MutableArrayIterPtr;
+class PropertySlots;
 
 /**
  * Base class of all user-defined classes. All data members and methods in
@@ -314,6 +315,7 @@ class ObjectData : public Countable {
  protected:
   int o_id;                      // a numeric identifier of this object
   mutable Array *o_properties;   // dynamic properties
+  mutable PropertySlots *o_slots;// dynamic properties in shape order
  private:
   mutable int16  o_attribute;    // vairous flags
 
@@ -27,6 +27,7 @@
 #include <runtime/base/server/xbox_server.h>
 #include <runtime/base/server/http_server.h>
 #include <runtime/base/server/replay_transport.h>
+#include <runtime/base/server/replay_load.h>
 #include <runtime/base/server/http_request_handler.h>
 #include <runtime/base/server/admin_request_handler.h>
 #include <runtime/base/server/server_stats.h>
@@ -37,6 +38,7 @@
 #include <util/timer.h>
 #include <util/stack_trace.h>
 #include <util/light_process.h>
+#include <util/network.h>
 #include <runtime/base/source_info.h>
 #include <runtime/base/rtti_info.h>
 #include <runtime/base/frame_injection.h>
@@ -52,6 +54,7 @@
 #include <runtime/base/fiber_async_func.h>
 #include <runtime/base/util/simple_counter.h>
 #include <runtime/base/util/extended_logger.h>
+#include <runtime/base/util/stack_sampler.h>
 
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/positional_options.hpp>
@@ -83,6 +86,7 @@ struct ProgramOptions {
   string     lint;
   bool       isTempFile;
   int        count;
+  int        threads;
   bool       noSafeAccessCheck;
   StringVec  args;
   string     buildId;
@@ -482,6 +486,11 @@ static int start_server(const std::string &username) {
   // binary is paged into memory.
   pagein_self();
 
+  // error pages will symbolize native stacks; don't make the first one wait
+  if (RuntimeOption::ServerStackTrace || RuntimeOption::FullBacktrace) {
+    StackTrace::PreloadSymbols();
+  }
+
   RuntimeOption::ExecutionMode = "srv";
   HttpRequestHandler::GetAccessLog().init
     (RuntimeOption::AccessLogDefaultFormat, RuntimeOption::AccessLogs,
@@ -518,6 +527,11 @@ static int start_server(const std::string &username) {
   }
 #endif
 
+  if (RuntimeOption::EnableStackSampler &&
+      !StackSampler::Start(RuntimeOption::StackSamplerRate)) {
+    Logger::Error("Unable to start stack sampler");
+  }
+
   HttpServer::Server = HttpServerPtr(new HttpServer(sslCTX));
   HttpServer::Server->run();
   return 0;
@@ -636,7 +650,8 @@ static int execute_program_impl(int argc, char **argv) {
     ("compiler-id", "display the git hash for the compiler id")
 #endif
     ("mode,m", value<string>(&po.mode)->default_value("run"),
-     "run | debug (d) | server (s) | daemon | replay | translate (t)")
+     "run | debug (d) | server (s) | daemon | replay | replay-load | "
+     "translate (t)")
     ("config,c", value<string>(&po.config),
      "load specified config file")
     ("config-value,v", value<StringVec >(&po.confStrings)->composing(),
@@ -669,6 +684,8 @@ static int execute_program_impl(int argc, char **argv) {
      "file specified is temporary and removed after execution")
     ("count", value<int>(&po.count)->default_value(1),
      "how many times to repeat execution")
+    ("threads", value<int>(&po.threads)->default_value(1),
+     "how many threads replay-load runs requests on")
     ("no-safe-access-check",
       value<bool>(&po.noSafeAccessCheck)->default_value(false),
      "whether to ignore safe file access check")
@@ -771,7 +788,8 @@ static int execute_program_impl(int argc, char **argv) {
     close_server_log_file(ret);
   }
 
-  open_server_log_file();
+  bool logFile =
+    open_server_log_file() >= 0 && !RuntimeOption::LogFile.empty();
 
   // Defer the initialization of light processes until the log file handle
   // is created, so that light processes can log to the right place.
@@ -782,6 +800,13 @@ static int execute_program_impl(int argc, char **argv) {
   if (po.mode == "s") po.mode = "server";
   if (po.mode == "t") po.mode = "translate";
 
+  // Only servers log enough for it to matter, and only they have request
+  // threads to take the writes off. After forking light processes, which
+  // have to log synchronously.
+  if (logFile && (po.mode == "server" || po.mode == "daemon")) {
+    Logger::StartAsyncWriter();
+  }
+
   MethodIndexHMap::initialize(false);
   ShmCounters::initialize(true, Logger::Error);
 
@@ -901,6 +926,25 @@ static int execute_program_impl(int argc, char **argv) {
     return 0;
   }
 
+  if (po.mode == "replay-load" && !po.args.empty()) {
+    RuntimeOption::RecordInput = false;
+    RuntimeOption::ExecutionMode = "srv";
+    HttpServer server; // so we initialize runtime properly
+    ReplayLoad load(po.threads);
+    for (unsigned int i = 0; i < po.args.size(); i++) {
+      load.addInput(po.args[i]);
+    }
+    if (load.getInputCount() == 0) {
+      Logger::Error("No recorded requests to replay");
+      return -1;
+    }
+    load.run(po.count);
+    string report;
+    load.report(report);
+    printf("%s", report.c_str());
+    return 0;
+  }
+
   if (po.mode == "translate" && !po.args.empty()) {
     if (!access(po.args[0].c_str(), F_OK)) {
       translate_rtti(po.args[0].c_str());
@@ -1185,6 +1229,8 @@ void hphp_process_exit() {
   Eval::Debugger::Stop();
   Extension::ShutdownModules();
   LightProcess::Close();
+  Util::DnsCache::Stop();
+  Logger::StopAsyncWriter();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
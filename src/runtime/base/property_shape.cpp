@@ -0,0 +1,167 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+
+#include <runtime/base/property_shape.h>
+#include <runtime/base/runtime_option.h>
+#include <util/atomic.h>
+#include <util/hash.h>
+
+using namespace std;
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+// PropertyShape
+
+PropertyShape PropertyShape::s_empty;
+int PropertyShape::s_count = 0;
+
+bool PropertyShape::Name::matches(const StringData *sd, int64 h) const {
+  if (hint == sd) return true;
+  int len = sd->size();
+  if (hash != h || (int)str.size() != len ||
+      memcmp(str.data(), sd->data(), len)) {
+    return false;
+  }
+  if (!hint && sd->isStatic()) hint = sd;
+  return true;
+}
+
+PropertyShape::PropertyShape()
+    : m_size(0), m_children(NULL), m_sibling(NULL) {
+}
+
+PropertyShape::PropertyShape(const PropertyShape *parent, CStrRef name)
+    : m_size(parent->m_size + 1), m_children(NULL), m_sibling(NULL) {
+  for (int i = 0; i < parent->m_size; i++) {
+    m_names[i] = parent->m_names[i];
+  }
+  const StringData *sd = name.get();
+  Name &n = m_names[parent->m_size];
+  n.str = string(sd->data(), sd->size());
+  n.hash = sd->hash();
+  n.hint = sd->isStatic() ? sd : NULL;
+}
+
+int PropertyShape::find(CStrRef name) const {
+  const StringData *sd = name.get();
+  for (int i = 0; i < m_size; i++) {
+    if (m_names[i].hint == sd) return i;
+  }
+  int64 hash = sd->hash();
+  for (int i = 0; i < m_size; i++) {
+    if (m_names[i].matches(sd, hash)) return i;
+  }
+  return -1;
+}
+
+PropertyShape *PropertyShape::findChild(PropertyShape *first,
+                                        PropertyShape *last,
+                                        CStrRef name) const {
+  const StringData *sd = name.get();
+  int64 hash = sd->hash();
+  for (PropertyShape *child = first; child != last;
+       child = child->m_sibling) {
+    if (child->m_names[m_size].matches(sd, hash)) return child;
+  }
+  return NULL;
+}
+
+PropertyShape *PropertyShape::transition(CStrRef name) {
+  if (m_size == MaxSlots) return NULL;
+  PropertyShape *first = m_children;
+  PropertyShape *child = findChild(first, NULL, name);
+  if (child) return child;
+  if (s_count >= RuntimeOption::ObjectShapeLimit) return NULL;
+
+  child = new PropertyShape(this, name);
+  while (true) {
+    child->m_sibling = first;
+    if (__sync_bool_compare_and_swap(&m_children, first, child)) {
+      atomic_inc(s_count);
+      return child;
+    }
+    // another thread added a child meanwhile, possibly for the same name
+    PropertyShape *head = m_children;
+    PropertyShape *other = findChild(head, first, name);
+    if (other) {
+      delete child;
+      return other;
+    }
+    first = head;
+  }
+}
+
+String PropertyShape::name(int slot) const {
+  ASSERT(slot >= 0 && slot < m_size);
+  const Name &n = m_names[slot];
+  if (n.hint) return const_cast<StringData *>(n.hint);
+  return String(n.str.data(), n.str.size(), CopyString);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PropertySlots
+
+IMPLEMENT_SMART_ALLOCATION_NOCALLBACKS(PropertySlots);
+
+Variant *PropertySlots::find(CStrRef name, bool &found) {
+  int slot = m_shape->find(name);
+  found = (slot >= 0);
+  if (!found || (m_holes & (1 << slot))) return NULL;
+  return &m_values[slot];
+}
+
+Variant *PropertySlots::add(CStrRef name) {
+  PropertyShape *shape = m_shape->transition(name);
+  if (!shape) return NULL;
+  m_shape = shape;
+  return &m_values[shape->size() - 1];
+}
+
+bool PropertySlots::remove(CStrRef name) {
+  bool found;
+  Variant *value = find(name, found);
+  if (!value) return false;
+  value->unset();
+  m_holes |= 1 << (value - m_values);
+  return true;
+}
+
+void PropertySlots::getArray(Array &props) const {
+  for (int i = 0; i < m_shape->size(); i++) {
+    if (m_holes & (1 << i)) continue;
+    props.addLval(m_shape->name(i), true).setWithRef(m_values[i]);
+  }
+}
+
+PropertySlots *PropertySlots::clone() const {
+  PropertySlots *slots = NEW(PropertySlots)(m_shape);
+  slots->m_holes = m_holes;
+  for (int i = 0; i < m_shape->size(); i++) {
+    if (m_holes & (1 << i)) continue;
+    slots->m_values[i].setWithRef(m_values[i]);
+  }
+  return slots;
+}
+
+void PropertySlots::dump() const {
+  Array props = Array::Create();
+  getArray(props);
+  props.dump();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
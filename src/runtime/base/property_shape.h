@@ -0,0 +1,120 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+
+#ifndef __HPHP_PROPERTY_SHAPE_H__
+#define __HPHP_PROPERTY_SHAPE_H__
+
+#include <runtime/base/complex_types.h>
+#include <runtime/base/memory/smart_allocator.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The ordered list of dynamic property names an object has been given so
+ * far. Objects that add the same names in the same order share one shape,
+ * so each of them only needs a PropertySlots of values instead of a hash
+ * table of its own.
+ *
+ * Shapes are process-wide and never freed. They form a tree rooted at
+ * Empty(), with one child per name added; children are pushed onto their
+ * parent's list with a compare-and-swap, so lookups never take a lock.
+ */
+class PropertyShape {
+public:
+  static const int MaxSlots = 8;
+
+  static PropertyShape *Empty() { return &s_empty; }
+
+  int size() const { return m_size; }
+
+  /**
+   * Slot of a property name, or -1. Names are compared by pointer first,
+   * which is all it takes for the static strings generated code passes in.
+   */
+  int find(CStrRef name) const;
+
+  /**
+   * Shape with one more name, or NULL when this one is full or when
+   * RuntimeOption::ObjectShapeLimit shapes have been created already.
+   */
+  PropertyShape *transition(CStrRef name);
+
+  String name(int slot) const;
+
+private:
+  struct Name {
+    std::string str;
+    int64 hash;
+    mutable const StringData *hint; // static string with the same contents
+
+    bool matches(const StringData *sd, int64 h) const;
+  };
+
+  static PropertyShape s_empty;
+  static int s_count;
+
+  PropertyShape();
+  PropertyShape(const PropertyShape *parent, CStrRef name);
+
+  Name m_names[MaxSlots];
+  int m_size;
+  PropertyShape * volatile m_children;
+  PropertyShape *m_sibling;
+
+  PropertyShape *findChild(PropertyShape *first, PropertyShape *last,
+                           CStrRef name) const;
+};
+
+/**
+ * Values of an object's dynamic properties, in the order of its shape.
+ * Slots never move, so pointers handed out by o_realProp() stay valid for
+ * the lifetime of the object, and unset properties leave a hole behind.
+ */
+class PropertySlots {
+public:
+  PropertySlots(PropertyShape *shape) : m_shape(shape), m_holes(0) {}
+
+  /**
+   * Live slot of a property, or NULL. found is set whenever the name is in
+   * the shape, even if the property has been unset since.
+   */
+  Variant *find(CStrRef name, bool &found);
+
+  /**
+   * Appends a slot for a name that is not in the shape yet, or returns NULL
+   * if the shape cannot grow any more.
+   */
+  Variant *add(CStrRef name);
+
+  bool remove(CStrRef name);
+  void getArray(Array &props) const;
+  PropertySlots *clone() const;
+  void dump() const;
+
+  DECLARE_SMART_ALLOCATION_NOCALLBACKS(PropertySlots);
+
+private:
+  PropertyShape *m_shape;
+  unsigned int m_holes; // bit i set if slot i has been unset
+  Variant m_values[PropertyShape::MaxSlots];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HPHP_PROPERTY_SHAPE_H__
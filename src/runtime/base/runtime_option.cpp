@@ -115,6 +115,8 @@ bool RuntimeOption::EnableOutputBuffering = false;
 std::string RuntimeOption::OutputHandler;
 bool RuntimeOption::ImplicitFlush = false;
 bool RuntimeOption::EnableEarlyFlush = true;
+int RuntimeOption::EarlyFlushBytes = 0;
+bool RuntimeOption::EarlyFlushAfterHead = false;
 bool RuntimeOption::ForceChunkedEncoding = false;
 int64 RuntimeOption::MaxPostSize;
 bool RuntimeOption::AlwaysPopulateRawPostData = true;
@@ -210,6 +212,7 @@ bool RuntimeOption::MySQLKillOnTimeout = false;
 
 int RuntimeOption::HttpDefaultTimeout = 30;
 int RuntimeOption::HttpSlowQueryThreshold = 5000; // ms
+bool RuntimeOption::HttpShareCurlHandles = false;
 
 bool RuntimeOption::TranslateLeakStackTrace = false;
 bool RuntimeOption::NativeStackTrace = false;
@@ -240,6 +243,9 @@ std::string RuntimeOption::StatsXSL;
 std::string RuntimeOption::StatsXSLProxy;
 int RuntimeOption::StatsSlotDuration = 10 * 60; // 10 minutes
 int RuntimeOption::StatsMaxSlot = 12 * 6; // 12 hours
+bool RuntimeOption::EnableStackSampler = false;
+int RuntimeOption::StackSamplerRate = 100;
+int RuntimeOption::StackSamplerSlots = 4096;
 
 bool RuntimeOption::EnableAPCSizeStats = false;
 bool RuntimeOption::EnableAPCSizeGroup = false;
@@ -262,6 +268,8 @@ bool RuntimeOption::EnableMemoryManager = true;
 bool RuntimeOption::CheckMemory = false;
 bool RuntimeOption::UseHphpArray = false;
 bool RuntimeOption::UseSmallArray = false;
+bool RuntimeOption::UseObjectShapes = false;
+int RuntimeOption::ObjectShapeLimit = 10000;
 bool RuntimeOption::UseDirectCopy = false;
 bool RuntimeOption::EnableApc = true;
 bool RuntimeOption::EnableConstLoad = false;
@@ -464,6 +472,7 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */) {
     Logger::LogNativeStackTrace = logger["NativeStackTrace"].getBool(true);
     Logger::MaxMessagesPerRequest =
       logger["MaxMessagesPerRequest"].getInt32(-1);
+    Logger::AsyncQueueSize = logger["AsyncQueueSize"].getInt32(0);
 
     Logger::UseLogFile = logger["UseLogFile"].getBool(true);
     Logger::UseCronolog = logger["UseCronolog"].getBool(false);
@@ -586,6 +595,8 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */) {
     OutputHandler = server["OutputHandler"].getString();
     ImplicitFlush = server["ImplicitFlush"].getBool();
     EnableEarlyFlush = server["EnableEarlyFlush"].getBool(true);
+    EarlyFlushBytes = server["EarlyFlushBytes"].getInt32(0);
+    EarlyFlushAfterHead = server["EarlyFlushAfterHead"].getBool();
     ForceChunkedEncoding = server["ForceChunkedEncoding"].getBool();
     MaxPostSize = (server["MaxPostSize"].getInt32(100)) * (1LL << 20);
     AlwaysPopulateRawPostData = server["AlwaysPopulateRawPostData"].getBool();
@@ -667,6 +678,8 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */) {
     CheckMemory = server["CheckMemory"].getBool();
     UseHphpArray = server["UseHphpArray"].getBool(false);
     UseSmallArray = server["UseSmallArray"].getBool(false);
+    UseObjectShapes = server["UseObjectShapes"].getBool(false);
+    ObjectShapeLimit = server["ObjectShapeLimit"].getInt32(10000);
     UseDirectCopy = server["UseDirectCopy"].getBool(false);
     AlwaysUseRelativePath = server["AlwaysUseRelativePath"].getBool(false);
 
@@ -718,6 +731,14 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */) {
     DnsCacheMaximumCapacity = dns["MaximumCapacity"].getInt64(0);
     DnsCacheKeyFrequencyUpdatePeriod = dns["KeyFrequencyUpdatePeriod"].
       getInt32(1000);
+    Util::DnsCache::Enabled = EnableDnsCache;
+    Util::DnsCache::DefaultTTL = DnsCacheTTL;
+    Util::DnsCache::MaxTTL = dns["MaxTTL"].getInt32(3600);
+    Util::DnsCache::NegativeTTL = dns["NegativeTTL"].getInt32(10);
+    Util::DnsCache::HonorTTL = dns["HonorTTL"].getBool(true);
+    Util::DnsCache::RefreshAhead = dns["RefreshAhead"].getInt32(10);
+    Util::DnsCache::ResolverThreads = dns["ResolverThreads"].getInt32(2);
+    Util::DnsCache::MaxEntries = dns["MaximumEntries"].getInt32(65536);
 
     Hdf upload = server["Upload"];
     UploadMaxFileSize =
@@ -852,6 +873,7 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */) {
     Hdf http = config["Http"];
     HttpDefaultTimeout = http["DefaultTimeout"].getInt32(30);
     HttpSlowQueryThreshold = http["SlowQueryThreshold"].getInt32(5000);
+    HttpShareCurlHandles = http["ShareCurlHandles"].getBool();
   }
   {
     Hdf debug = config["Debug"];
@@ -909,6 +931,13 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */) {
     StatsSlotDuration = stats["SlotDuration"].getInt32(10 * 60); // 10 minutes
     StatsMaxSlot = stats["MaxSlot"].getInt32(12 * 6); // 12 hours
 
+    {
+      Hdf sampler = stats["StackSampler"];
+      EnableStackSampler = sampler["Enable"].getBool();
+      StackSamplerRate = sampler["Rate"].getInt32(100);
+      StackSamplerSlots = sampler["Slots"].getInt32(4096);
+    }
+
     {
       Hdf apcSize = stats["APCSize"];
       EnableAPCSizeStats = apcSize["Enable"].getBool();
@@ -110,6 +110,8 @@ public:
   static std::string OutputHandler;
   static bool ImplicitFlush;
   static bool EnableEarlyFlush;
+  static int EarlyFlushBytes;
+  static bool EarlyFlushAfterHead;
   static bool ForceChunkedEncoding;
   static int64 MaxPostSize;
   static bool AlwaysPopulateRawPostData;
@@ -206,6 +208,7 @@ public:
 
   static int  HttpDefaultTimeout;
   static int  HttpSlowQueryThreshold;
+  static bool HttpShareCurlHandles;
 
   static bool TranslateLeakStackTrace;
   static bool NativeStackTrace;
@@ -236,6 +239,9 @@ public:
   static std::string StatsXSLProxy;
   static int StatsSlotDuration;
   static int StatsMaxSlot;
+  static bool EnableStackSampler;
+  static int StackSamplerRate;
+  static int StackSamplerSlots;
 
   static bool EnableAPCSizeStats;
   static bool EnableAPCSizeGroup;
@@ -262,6 +268,8 @@ public:
   static bool CheckMemory;
   static bool UseHphpArray;
   static bool UseSmallArray;
+  static bool UseObjectShapes;
+  static int ObjectShapeLimit;
   static bool UseDirectCopy;
   static bool EnableApc;
   static bool EnableConstLoad;
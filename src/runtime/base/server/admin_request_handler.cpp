@@ -23,11 +23,13 @@
 #include <util/logger.h>
 #include <util/util.h>
 #include <util/mutex.h>
+#include <util/network.h>
 #include <runtime/base/time/datetime.h>
 #include <runtime/base/memory/memory_manager.h>
 #include <runtime/base/program_functions.h>
 #include <runtime/base/shared/shared_store_base.h>
 #include <runtime/base/memory/leak_detectable.h>
+#include <runtime/base/util/stack_sampler.h>
 #include <runtime/ext/mysql_stats.h>
 #include <runtime/base/shared/shared_store_stats.h>
 #include <util/alloc.h>
@@ -126,6 +128,9 @@ void AdminRequestHandler::handleRequest(Transport *transport) {
         "/check-mem:       report memory quick statistics in log file\n"
         "/check-apc:       report APC quick statistics\n"
         "/check-sql:       report SQL table statistics\n"
+        "/check-dns:       report DNS cache hit/miss and resolve latency\n"
+        "/check-log:       how many log lines were dropped by the async\n"
+        "                  log writer\n"
 
         "/status.xml:      show server status in XML\n"
         "/status.json:     show server status in JSON\n"
@@ -173,6 +178,13 @@ void AdminRequestHandler::handleRequest(Transport *transport) {
         "/dump-const:      dump all constant value in constant map to\n"
         "                  /tmp/const_map_dump\n"
 
+        "/prof-stack-on:   start sampling PHP stacks of all requests\n"
+        "    rate          optional, samples per CPU second, default 100\n"
+        "/prof-stack-off:  stop sampling PHP stacks\n"
+        "/prof-stack-clear:\n"
+        "                  clear sampled stacks\n"
+        "/prof-stack:      sampled stacks in folded format for flame graphs\n"
+
 #ifdef GOOGLE_CPU_PROFILER
         "/prof-cpu-on:     turn on CPU profiler\n"
         "/prof-cpu-off:    turn off CPU profiler\n"
@@ -499,6 +511,19 @@ bool AdminRequestHandler::handleCheckRequest(const std::string &cmd,
     transport->sendString(stats);
     return true;
   }
+  if (cmd == "check-dns") {
+    string stats = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+    stats += "<DNS>\n";
+    stats += Util::DnsCache::ReportStats();
+    stats += "</DNS>\n";
+    transport->sendString(stats);
+    return true;
+  }
+  if (cmd == "check-log") {
+    int count = Logger::GetDroppedLines();
+    transport->sendString(lexical_cast<string>(count));
+    return true;
+  }
   return false;
 }
 
@@ -628,6 +653,30 @@ bool AdminRequestHandler::handleProfileRequest(const std::string &cmd,
 
     return true;
   }
+  if (cmd == "prof-stack-on") {
+    int rate = transport->getIntParam("rate");
+    if (rate <= 0) rate = RuntimeOption::StackSamplerRate;
+    transport->sendString(StackSampler::Start(rate) ? "OK\n" :
+                          "Unable to start stack sampler\n");
+    return true;
+  }
+  if (cmd == "prof-stack-off") {
+    StackSampler::Stop();
+    transport->sendString("OK\n");
+    return true;
+  }
+  if (cmd == "prof-stack-clear") {
+    StackSampler::Clear();
+    transport->sendString("OK\n");
+    return true;
+  }
+  if (cmd == "prof-stack") {
+    string out;
+    StackSampler::Report(out);
+    transport->addHeader("Content-Type", "text/plain");
+    transport->sendString(out);
+    return true;
+  }
 #ifdef GOOGLE_CPU_PROFILER
   if (handleCPUProfilerRequest(cmd, transport)) {
     return true;
@@ -274,6 +274,11 @@ bool HttpRequestHandler::executePHPRequest(Transport *transport,
     }
   }
   context->setTransport(transport);
+  if (!cachableDynamicContent) {
+    // cached pages have to be captured whole
+    context->obSetStreaming(RuntimeOption::EarlyFlushBytes,
+                            RuntimeOption::EarlyFlushAfterHead);
+  }
 
   string file = reqURI.absolutePath().c_str();
   {
@@ -312,15 +317,19 @@ bool HttpRequestHandler::executePHPRequest(Transport *transport,
                       error, errorMsg);
 
     if (ret) {
-      String content = context->obDetachContents();
-      if (cachableDynamicContent && !content.empty()) {
+      StringBuffer *content = context->obGetBuffer();
+      if (cachableDynamicContent && content && !content->empty()) {
         ASSERT(transport->getUrl());
         string key = file + transport->getUrl();
-        DynamicContentCache::TheCache.store(key, content.data(),
-                                            content.size());
+        DynamicContentCache::TheCache.store(key, content->data(),
+                                            content->size());
       }
       code = 200;
-      transport->sendRaw((void*)content.data(), content.size(), code);
+      if (content) {
+        transport->sendBuffer(*content, code);
+      } else {
+        transport->sendRaw((void*)"", 0, code);
+      }
     } else if (error) {
       code = 500;
 
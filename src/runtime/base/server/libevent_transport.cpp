@@ -18,6 +18,7 @@
 #include <runtime/base/server/libevent_server.h>
 #include <runtime/base/server/server.h>
 #include <runtime/base/runtime_option.h>
+#include <runtime/base/util/string_buffer.h>
 #include <util/util.h>
 #include <util/logger.h>
 
@@ -29,6 +30,24 @@ struct m_evkeyvalq {
   struct evkeyval *tqh_first;
 };
 
+/**
+ * An evbuffer is a single malloc-ed block that libevent releases with free(),
+ * so an empty one can take over a malloc-ed buffer instead of copying it.
+ */
+static void evbuffer_adopt(evbuffer *buf, char *data, int size) {
+  ASSERT(EVBUFFER_LENGTH(buf) == 0);
+  if (buf->orig_buffer) {
+    free(buf->orig_buffer);
+  }
+  buf->orig_buffer = buf->buffer = (u_char *)data;
+  buf->misalign = 0;
+  buf->totallen = size + 1; // StringBuffer always allocates the extra NUL
+  buf->off = size;
+  if (buf->cb) {
+    (*buf->cb)(buf, 0, size, buf->cbarg);
+  }
+}
+
 LibEventTransport::LibEventTransport(LibEventServer *server,
                                      evhttp_request *request,
                                      int workerId)
@@ -247,8 +266,7 @@ void LibEventTransport::sendImpl(const void *data, int size, int code,
     ASSERT(m_method != HEAD);
     evbuffer *chunk = evbuffer_new();
     evbuffer_add(chunk, data, size);
-    m_server->onChunkedResponse(m_workerId, m_request, code, chunk,
-                               !m_sendStarted);
+    sendBody(chunk, code);
   } else {
     if (m_method != HEAD) {
       evbuffer_add(m_request->output_buffer, data, size);
@@ -257,6 +275,40 @@ void LibEventTransport::sendImpl(const void *data, int size, int code,
       snprintf(buf, sizeof(buf), "%d", size);
       addHeaderImpl("Content-Length", buf);
     }
+    sendBody(NULL, code);
+  }
+}
+
+void LibEventTransport::sendBufferImpl(StringBuffer &buf, int code,
+                                       bool chunked) {
+  ASSERT(!m_sendEnded);
+  ASSERT(!m_sendStarted || chunked);
+
+  if (m_method == HEAD ||
+      (!chunked && EVBUFFER_LENGTH(m_request->output_buffer))) {
+    Transport::sendBufferImpl(buf, code, chunked);
+    return;
+  }
+
+  // hand the page over to libevent, which frees it once it is written
+  int size;
+  char *data = buf.detach(size);
+  ASSERT(data);
+  if (chunked) {
+    evbuffer *chunk = evbuffer_new();
+    evbuffer_adopt(chunk, data, size);
+    sendBody(chunk, code);
+  } else {
+    evbuffer_adopt(m_request->output_buffer, data, size);
+    sendBody(NULL, code);
+  }
+}
+
+void LibEventTransport::sendBody(evbuffer *chunk, int code) {
+  if (chunk) {
+    m_server->onChunkedResponse(m_workerId, m_request, code, chunk,
+                               !m_sendStarted);
+  } else {
     m_server->onResponse(m_workerId, m_request, code, this);
     m_sendEnded = true;
   }
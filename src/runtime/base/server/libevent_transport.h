@@ -47,6 +47,7 @@ public:
   virtual void addRequestHeaderImpl(const char *name, const char *value);
   virtual void removeRequestHeaderImpl(const char *name);
   virtual void sendImpl(const void *data, int size, int code, bool chunked);
+  virtual void sendBufferImpl(StringBuffer &buf, int code, bool chunked);
   virtual void onSendEndImpl();
   virtual bool isServerStopping();
 
@@ -64,6 +65,12 @@ private:
   HeaderMap m_requestHeaders;
   bool m_sendStarted;
   bool m_sendEnded;
+
+  /**
+   * Queue the response for the libevent thread: a chunk of a chunked response
+   * if one is given, otherwise the whole of m_request->output_buffer.
+   */
+  void sendBody(evbuffer *chunk, int code);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
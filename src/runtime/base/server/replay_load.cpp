@@ -0,0 +1,203 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <runtime/base/server/replay_load.h>
+#include <runtime/base/server/replay_transport.h>
+#include <runtime/base/server/http_request_handler.h>
+#include <runtime/base/server/server_stats.h>
+#include <runtime/base/memory/memory_manager.h>
+#include <runtime/base/runtime_option.h>
+#include <util/job_queue.h>
+#include <util/logger.h>
+#include <util/hdf.h>
+#include <sys/resource.h>
+#include <math.h>
+#include <sys/stat.h>
+#include <dirent.h>
+
+using namespace std;
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+class ReplayLoadWorker : public JobQueueWorker<int> {
+public:
+  virtual void doJob(int index) {
+    ((ReplayLoad*)m_opaque)->replay(m_handler, index);
+  }
+
+  virtual void onThreadEnter() {
+    ((ReplayLoad*)m_opaque)->onThreadEnter();
+  }
+
+  virtual void onThreadExit() {
+    MemoryManager::TheMemoryManager().get()->cleanup();
+  }
+
+private:
+  HttpRequestHandler m_handler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+ReplayLoad::ReplayLoad(int threadCount)
+  : m_threadCount(threadCount > 0 ? threadCount : 1), m_total(0),
+    m_peakMemory(0), m_wallTime(0),
+    m_timeoutThreadData(m_threadCount, RuntimeOption::RequestTimeoutSeconds),
+    m_timeoutThread(&m_timeoutThreadData, &TimeoutThread::run) {
+}
+
+void ReplayLoad::addInput(const string &path) {
+  struct stat sb;
+  if (stat(path.c_str(), &sb)) {
+    Logger::Error("Unable to find %s", path.c_str());
+    return;
+  }
+
+  if (S_ISDIR(sb.st_mode)) {
+    DIR *dir = opendir(path.c_str());
+    if (!dir) return;
+    vector<string> files;
+    dirent *e;
+    while ((e = readdir(dir)) != NULL) {
+      if (e->d_name[0] != '.') files.push_back(path + "/" + e->d_name);
+    }
+    closedir(dir);
+    sort(files.begin(), files.end()); // same order on every run
+    for (unsigned int i = 0; i < files.size(); i++) {
+      addInput(files[i]);
+    }
+    return;
+  }
+
+  ifstream f(path.c_str());
+  ostringstream input;
+  input << f.rdbuf();
+  if (!f) {
+    Logger::Error("Unable to read %s", path.c_str());
+    return;
+  }
+  m_inputs.push_back(input.str());
+}
+
+void ReplayLoad::run(int count) {
+  RuntimeOption::EnableStats = true;
+  RuntimeOption::EnableWebStats = true;
+  ServerStats::Clear();
+
+  m_total = count * m_inputs.size();
+  m_latencies.reserve(m_total);
+  JobQueueDispatcher<int, ReplayLoadWorker>
+    dispatcher(m_threadCount, true, 0, this);
+  for (int i = 0; i < count; i++) {
+    for (unsigned int j = 0; j < m_inputs.size(); j++) {
+      dispatcher.enqueue(j);
+    }
+  }
+
+  timespec start, end;
+  gettime(CLOCK_MONOTONIC, &start);
+  dispatcher.start();
+  m_timeoutThread.start();
+  {
+    Lock lock(getMutex());
+    while ((int)m_latencies.size() < m_total) wait();
+  }
+  gettime(CLOCK_MONOTONIC, &end);
+  m_wallTime = gettime_diff_us(start, end);
+
+  // per-thread stats go away with worker threads
+  ServerStats::Report(m_stats, ServerStats::KVP, 0, 0, "*",
+                      ":^page\\.(wall|cpu)\\.:/hit,:^mem\\.:/hit",
+                      "", 0, "");
+  dispatcher.stop();
+  m_timeoutThreadData.stop();
+  m_timeoutThread.waitForEnd();
+}
+
+void ReplayLoad::onThreadEnter() {
+  m_timeoutThreadData.registerRequestThread
+    (&ThreadInfo::s_threadInfo->m_reqInjectionData);
+}
+
+void ReplayLoad::replay(HttpRequestHandler &handler, int index) {
+  Hdf hdf;
+  hdf.fromString(m_inputs[index].c_str());
+  ReplayTransport rt;
+  rt.replayInput(hdf);
+
+  timespec start, end;
+  gettime(CLOCK_MONOTONIC, &start);
+  handler.handleRequest(&rt);
+  gettime(CLOCK_MONOTONIC, &end);
+  int64 peak = MemoryManager::TheMemoryManager()->getStats().peakUsage;
+
+  Lock lock(getMutex());
+  m_latencies.push_back(gettime_diff_us(start, end));
+  m_codes[rt.getResponseCode()]++;
+  if (peak > m_peakMemory) m_peakMemory = peak;
+  if ((int)m_latencies.size() == m_total) notify();
+}
+
+static double percentile(const vector<int64> &sorted, double p) {
+  if (sorted.empty()) return 0;
+  int rank = (int)ceil(p * sorted.size()) - 1;
+  if (rank < 0) rank = 0;
+  return sorted[rank] / 1000.0;
+}
+
+void ReplayLoad::report(string &out) {
+  vector<int64> latencies = m_latencies;
+  sort(latencies.begin(), latencies.end());
+  int64 total = 0;
+  for (unsigned int i = 0; i < latencies.size(); i++) {
+    total += latencies[i];
+  }
+  int requests = latencies.size();
+  double seconds = m_wallTime / 1000000.0;
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+
+  char buf[1024];
+  snprintf(buf, sizeof(buf),
+           "requests:    %d (%d inputs, %d threads)\n"
+           "wall time:   %.3f s\n"
+           "throughput:  %.1f requests/s\n"
+           "latency ms:  min %.2f, p50 %.2f, p90 %.2f, p99 %.2f, "
+           "p99.9 %.2f, max %.2f, mean %.2f\n"
+           "memory:      %lld bytes peak per request, %ld KB max RSS\n"
+           "responses:  ",
+           requests, (int)m_inputs.size(), m_threadCount, seconds,
+           seconds > 0 ? requests / seconds : 0.0,
+           percentile(latencies, 0), percentile(latencies, 0.5),
+           percentile(latencies, 0.9), percentile(latencies, 0.99),
+           percentile(latencies, 0.999), percentile(latencies, 1),
+           requests ? total / 1000.0 / requests : 0.0,
+           (long long)m_peakMemory, ru.ru_maxrss);
+  out = buf;
+  for (map<int, int>::const_iterator iter = m_codes.begin();
+       iter != m_codes.end(); ++iter) {
+    snprintf(buf, sizeof(buf), " %d x %d", iter->first, iter->second);
+    out += buf;
+  }
+  out += "\n\nper request, by section (us and bytes):\n";
+  out += m_stats;
+  out += "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
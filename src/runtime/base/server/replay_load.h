@@ -0,0 +1,77 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HPHP_REPLAY_LOAD_H__
+#define __HPHP_REPLAY_LOAD_H__
+
+#include <util/base.h>
+#include <util/synchronizable.h>
+#include <util/async_func.h>
+#include <runtime/base/timeout_thread.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+class HttpRequestHandler;
+
+/**
+ * Replays recorded requests (see ReplayTransport) from many threads at once
+ * through HttpRequestHandler, without any sockets, and reports throughput,
+ * latency percentiles, memory high-water marks and per-section server stats.
+ * This measures server-level performance on a captured traffic mix.
+ */
+class ReplayLoad : public Synchronizable {
+public:
+  ReplayLoad(int threadCount);
+
+  /**
+   * Adds one recorded request file, or all files in a directory.
+   */
+  void addInput(const std::string &path);
+  int getInputCount() const { return m_inputs.size();}
+
+  /**
+   * Replays each input "count" times, spread over all worker threads.
+   */
+  void run(int count);
+  void report(std::string &out);
+
+  /**
+   * Called by worker threads. onThreadEnter() puts the thread under
+   * RequestTimeoutSeconds, as the page server's workers are.
+   */
+  void onThreadEnter();
+  void replay(HttpRequestHandler &handler, int index);
+
+private:
+  int m_threadCount;
+  std::vector<std::string> m_inputs; // HDF of each recorded request
+
+  int m_total;
+  std::vector<int64> m_latencies; // microseconds
+  std::map<int, int> m_codes;
+  int64 m_peakMemory;
+  int64 m_wallTime;
+  std::string m_stats;
+
+  TimeoutThread m_timeoutThreadData;
+  AsyncFunc<TimeoutThread> m_timeoutThread;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HPHP_REPLAY_LOAD_H__
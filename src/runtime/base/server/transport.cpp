@@ -24,6 +24,7 @@
 #include <runtime/base/zend/zend_url.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/server/access_log.h>
+#include <runtime/base/util/string_buffer.h>
 #include <util/compression.h>
 #include <util/util.h>
 #include <util/logger.h>
@@ -664,6 +665,26 @@ void Transport::sendRaw(void *data, int size, int code /* = 200 */,
                         bool chunked /* = false */,
                         const char *codeInfo /* = "" */
                         ) {
+  sendRawImpl(data, size, NULL, code, compressed, chunked, codeInfo);
+}
+
+void Transport::sendBuffer(StringBuffer &buf, int code /* = 200 */,
+                           bool chunked /* = false */) {
+  if (buf.empty()) {
+    sendRaw((void*)"", 0, code, false, chunked);
+  } else {
+    sendRawImpl(buf.data(), buf.size(), &buf, code, false, chunked, "");
+    buf.reset();
+  }
+}
+
+void Transport::sendBufferImpl(StringBuffer &buf, int code, bool chunked) {
+  sendImpl(buf.data(), buf.size(), code, chunked);
+}
+
+void Transport::sendRawImpl(const void *data, int size, StringBuffer *owner,
+                            int code, bool compressed, bool chunked,
+                            const char *codeInfo) {
   ASSERT(data || size == 0);
   ASSERT(size >= 0);
   FiberWriteLock lock(this);
@@ -702,7 +723,12 @@ void Transport::sendRaw(void *data, int size, int code /* = 200 */,
 
   m_responseSize += response.size();
   ServerStats::SetThreadMode(ServerStats::Writing);
-  sendImpl(response.data(), response.size(), m_responseCode, chunked);
+  if (owner && response.data() == data) {
+    // going out as is, so the transport may keep owner's memory
+    sendBufferImpl(*owner, m_responseCode, chunked);
+  } else {
+    sendImpl(response.data(), response.size(), m_responseCode, chunked);
+  }
   ServerStats::SetThreadMode(ServerStats::Processing);
 
   ServerStats::LogBytes(size);
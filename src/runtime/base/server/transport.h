@@ -28,6 +28,8 @@
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
 
+class StringBuffer;
+
 /**
  * For storing headers and cookies.
  */
@@ -187,6 +189,12 @@ public:
   virtual void sendImpl(const void *data, int size, int code,
                         bool chunked) = 0;
 
+  /**
+   * Send back a response whose memory the callee may take over, leaving buf
+   * empty. By default it is copied through sendImpl().
+   */
+  virtual void sendBufferImpl(StringBuffer &buf, int code, bool chunked);
+
   /**
    * Override to implement more send end logic.
    */
@@ -283,6 +291,11 @@ public:
   virtual void sendRaw(void *data, int size, int code = 200,
                        bool compressed = false, bool chunked = false,
                        const char *codeInfo = NULL);
+  /**
+   * Send buf uncompressed without copying it where the transport allows, or
+   * like sendRaw() otherwise. buf is empty afterwards and can be reused.
+   */
+  void sendBuffer(StringBuffer &buf, int code = 200, bool chunked = false);
   void sendString(const char *data, int code = 200, bool compressed = false,
                   bool chunked = false,
                   const char * codeInfo = NULL) {
@@ -384,6 +397,8 @@ protected:
   void prepareHeaders(bool compressed, const void *data, int size);
   String prepareResponse(const void *data, int size, bool &compressed,
                          bool last);
+  void sendRawImpl(const void *data, int size, StringBuffer *owner, int code,
+                   bool compressed, bool chunked, const char *codeInfo);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
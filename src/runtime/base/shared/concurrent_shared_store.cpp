@@ -350,8 +350,12 @@ bool ConcurrentTableSharedStore::store(CStrRef key, CVarRef val, int64 ttl,
 
 void ConcurrentTableSharedStore::prime
 (const std::vector<SharedStore::KeyValuePair> &vars) {
-  ReadLock l(m_lock);
-  // we are priming, so we are not checking existence or expiration
+  // The write lock publishes the batch as a whole: readers see none of it or
+  // all of it, and growing the table up front can't race with other inserts.
+  WriteLock l(m_lock);
+  m_vars.rehash(m_vars.size() + vars.size());
+  // we are priming, so we are not checking existence or expiration, and
+  // primed values never expire, so the expiration queue is left alone
   for (unsigned int i = 0; i < vars.size(); i++) {
     const SharedStore::KeyValuePair &item = vars[i];
     Map::accessor acc;
@@ -25,27 +25,55 @@ namespace HPHP {
 IMPLEMENT_SMART_ALLOCATION(SharedMap, SmartAllocatorImpl::NeedRestore);
 ///////////////////////////////////////////////////////////////////////////////
 
-SharedMap::SharedMap(SharedVariant* source) : m_arr(source) {
+SharedMap::SharedMap(SharedVariant* source)
+  : m_arr(source), m_localCache(NULL) {
   source->incRef();
 }
 
+SharedMap::~SharedMap() {
+  freeCache(true);
+  m_arr->decRef();
+}
+
+void SharedMap::freeCache(bool destruct) const {
+  if (!m_localCache) return;
+  for (ssize_t c = cacheChunks() - 1; c >= 0; c--) {
+    Variant *chunk = m_localCache[c];
+    if (!chunk) continue;
+    if (destruct) {
+      for (int i = CacheChunkSize - 1; i >= 0; i--) {
+        chunk[i].~Variant();
+      }
+    }
+    free(chunk);
+  }
+  free(m_localCache);
+  m_localCache = NULL;
+}
+
+Variant &SharedMap::cacheSlot(ssize_t pos) const {
+  ASSERT(pos >= 0 && pos < size());
+  if (!m_localCache) {
+    m_localCache = (Variant **)calloc(cacheChunks(), sizeof(Variant *));
+  }
+  Variant *&chunk = m_localCache[pos >> CacheChunkBits];
+  if (!chunk) {
+    // all zeros is a null Variant
+    chunk = (Variant *)calloc(CacheChunkSize, sizeof(Variant));
+  }
+  return chunk[pos & (CacheChunkSize - 1)];
+}
+
 Variant SharedMap::getValue(ssize_t pos) const {
-  SharedVariant *sv = m_arr->getValue(pos);
-  DataType t = sv->getType();
-  if (!IS_REFCOUNTED_TYPE(t)) return sv->asCVarRef();
-  Variant *pv = m_localCache.lvalPtr(pos, false, false);
-  if (pv) return *pv;
-  return sv->toLocal();
+  return getValueRef(pos);
 }
 
 CVarRef SharedMap::getValueRef(ssize_t pos) const {
   SharedVariant *sv = m_arr->getValue(pos);
   DataType t = sv->getType();
   if (!IS_REFCOUNTED_TYPE(t)) return sv->asCVarRef();
-  Variant *pv = m_localCache.lvalPtr(pos, false, false);
-  if (pv) return *pv;
-  Variant &r = m_localCache.addLval((int64)pos);
-  r = sv->toLocal();
+  Variant &r = cacheSlot(pos);
+  if (r.isNull()) r = sv->toLocal();
   return r;
 }
 
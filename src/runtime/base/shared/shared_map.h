@@ -28,14 +28,20 @@ namespace HPHP {
 
 /**
  * Wrapper for a shared memory map.
+ *
+ * Reads never copy the shared data. Scalars are returned straight from the
+ * SharedVariant; strings are wrapped in a StringData that points into shared
+ * memory, and nested arrays in another SharedMap, so only the level that is
+ * written to ever gets escalated into a local array. Those wrappers are kept
+ * in m_localCache, indexed by position in chunks of CacheChunkSize slots that
+ * are only allocated once an element in them is read, so touching a few
+ * entries of a huge array costs a few chunks rather than a slot per element.
  */
 class SharedMap : public ArrayData {
 public:
   SharedMap(SharedVariant* source);
 
-  ~SharedMap() {
-    m_arr->decRef();
-  }
+  ~SharedMap();
 
   virtual bool isSharedMap() const { return true; }
 
@@ -110,14 +116,31 @@ public:
   void backup(LinearAllocator &allocator) {
     m_arr->incRef(); // protect it
   }
-  void restore(const char *&data) { m_arr->incRef();}
-  void sweep() { m_arr->decRef();}
+  void restore(const char *&data) {
+    m_arr->incRef();
+    m_localCache = NULL; // freed by sweep(), refilled on demand
+  }
+  void sweep() {
+    // the cached wrappers are smart allocated and swept on their own
+    freeCache(false);
+    m_arr->decRef();
+  }
 
   virtual ArrayData *escalate(bool mutableIteration = false) const;
 
 private:
   SharedVariant *m_arr;
-  mutable Array m_localCache;
+  static const int CacheChunkBits = 6;
+  static const int CacheChunkSize = 1 << CacheChunkBits;
+
+  // one pointer per chunk, each null until an element in it is read
+  mutable Variant **m_localCache;
+
+  ssize_t cacheChunks() const {
+    return (size() + CacheChunkSize - 1) >> CacheChunkBits;
+  }
+  Variant &cacheSlot(ssize_t pos) const;
+  void freeCache(bool destruct) const;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
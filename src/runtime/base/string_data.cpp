@@ -36,7 +36,7 @@ IMPLEMENT_SMART_ALLOCATION(StringData, SmartAllocatorImpl::NeedRestoreOnce);
 
 StringData::StringData(const char *data,
                        StringDataMode mode /* = AttachLiteral */)
-  : m_data(NULL), _count(0), m_len(0) {
+  : m_data(NULL), _count(0), m_len(0), m_cap(0) {
   m_hash = 0;
 
   assign(data, mode);
@@ -45,7 +45,7 @@ StringData::StringData(const char *data,
 }
 
 StringData::StringData(SharedVariant *shared)
-  : m_data(NULL), _count(0), m_len(0) {
+  : m_data(NULL), _count(0), m_len(0), m_cap(0) {
   m_hash = 0;
 
   ASSERT(shared);
@@ -59,7 +59,7 @@ StringData::StringData(SharedVariant *shared)
 }
 
 StringData::StringData(const char *data, int len, StringDataMode mode)
-  : m_data(NULL), _count(0), m_len(0) {
+  : m_data(NULL), _count(0), m_len(0), m_cap(0) {
   m_hash = 0;
   assign(data, len, mode);
 
@@ -74,12 +74,13 @@ void StringData::releaseData() {
   if ((m_len & (IsLinear | IsLiteral)) == 0) {
     if (isShared()) {
       m_shared->decRef();
-    } else if (m_data) {
+    } else if (m_data && !isInline()) {
       free((void*)m_data);
       m_data = NULL;
     }
   }
   m_hash = 0;
+  m_cap = 0;
 }
 
 void StringData::assign(const char *data, StringDataMode mode) {
@@ -103,7 +104,14 @@ void StringData::assign(const char *data, int len, StringDataMode mode) {
     switch (mode) {
     case CopyString:
       {
-        char *buf = (char*)malloc(len + 1);
+        char *buf;
+        if (len <= SmallStringCap) {
+          buf = m_inline;
+          m_cap = SmallStringCap;
+        } else {
+          buf = (char*)malloc(len + 1);
+          m_cap = len;
+        }
         buf[len] = '\0';
         memcpy(buf, data, len);
         m_data = buf;
@@ -116,6 +124,7 @@ void StringData::assign(const char *data, int len, StringDataMode mode) {
       break;
     case AttachString:
       m_data = data;
+      m_cap = len;
       ASSERT(m_data[len] == '\0');// all PHP strings need NULL termination
       break;
     default:
@@ -141,42 +150,57 @@ void StringData::append(const char *s, int len) {
 
   ASSERT(!isStatic()); // never mess around with static strings!
 
-  if (!isMalloced()) {
-    int newlen;
-    m_data = string_concat(data(), size(), s, len, newlen);
-    if (isShared()) {
-      m_shared->decRef();
-    }
-    m_len = newlen;
-    m_hash = 0;
-  } else if (m_data == s) {
-    int newlen;
-    char *newdata = string_concat(data(), size(), s, len, newlen);
+  int dataLen = size();
+  int newLen = dataLen + len;
+  if (newLen & IsMask) {
     releaseData();
-    m_data = newdata;
-    m_len = newlen;
-  } else {
-    int dataLen = size();
-    ASSERT((m_data > s && m_data - s > len) ||
-           (m_data < s && s - m_data > dataLen)); // no overlapping
-    m_len = len + dataLen;
-    m_data = (const char*)realloc((void*)m_data, m_len + 1);
-    memcpy((void*)(m_data + dataLen), s, len);
-    ((char*)m_data)[m_len] = '\0';
-    m_hash = 0;
+    m_len = 0;
+    m_data = NULL;
+    throw FatalErrorException(0, "String length exceeded 2^29 - 1: %d",
+                              newLen);
   }
 
-  if (m_len & IsMask) {
-    int len = m_len;
-    m_len &= ~IsMask;
-    releaseData();
-    m_data = NULL;
-    throw FatalErrorException(0, "String length exceeded 2^29 - 1: %d", len);
+  if ((m_len & IsMask) || newLen > m_cap) {
+    // Grow by doubling, so a loop of appends only reallocs log(n) times.
+    int cap = dataLen * 2;
+    if (cap < newLen || (cap & IsMask)) cap = newLen;
+    bool self = s >= m_data && s < m_data + dataLen;
+    if (isMalloced() && !self) {
+      m_data = (const char*)realloc((void*)m_data, cap + 1);
+    } else {
+      // literal, shared, linear or inline data, or appending to itself:
+      // copy everything out before the old buffer goes away
+      char *buf;
+      if (newLen <= SmallStringCap && !isInline()) {
+        buf = m_inline;
+        cap = SmallStringCap;
+      } else {
+        buf = (char*)malloc(cap + 1);
+      }
+      memcpy(buf, m_data, dataLen);
+      memcpy(buf + dataLen, s, len);
+      releaseData();
+      m_data = buf;
+      s = NULL;
+    }
+    m_cap = cap;
   }
 
+  char *buf = (char*)m_data;
+  if (s) memcpy(buf + dataLen, s, len);
+  buf[newLen] = '\0';
+  m_len = newLen;
+  m_hash = 0;
+
   TAINT_OBSERVER_REGISTER_MUTATED(this);
 }
 
+void StringData::attach(char *data, int len, int cap) {
+  ASSERT(data && len >= 0 && len <= cap);
+  assign(data, len, AttachString);
+  if (len) m_cap = cap & LenMask;
+}
+
 StringData *StringData::copy(bool sharedMemory /* = false */) const {
   if (isStatic()) {
     // Static strings cannot change, and are always available.
@@ -201,7 +225,14 @@ void StringData::escalate() {
   int len = size();
   ASSERT(len);
 
-  char *buf = (char*)malloc(len+1);
+  char *buf;
+  if (len <= SmallStringCap) {
+    buf = m_inline;
+    m_cap = SmallStringCap;
+  } else {
+    buf = (char*)malloc(len+1);
+    m_cap = len;
+  }
   memcpy(buf, data(), len);
   buf[len] = '\0';
   m_len = len;
@@ -504,7 +535,7 @@ bool StringData::calculate(int &totalSize) {
   m_taint_data.clearMetadata();
 #endif
 
-  if (m_data && !isLiteral()) {
+  if (m_data && !isLiteral() && !isInline()) {
     totalSize += (size() + 1); // ending NULL
     return true;
   }
@@ -520,6 +551,7 @@ void StringData::restore(const char *&data) {
   m_data = data;
   m_len &= LenMask;
   m_len |= IsLinear;
+  m_cap = 0;
   m_hash = hash_string(m_data, size());
 #ifdef TAINTED
   ASSERT(m_taint_data.getOriginalStr() == NULL);
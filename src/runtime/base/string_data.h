@@ -42,6 +42,11 @@ struct FilePlace {
  * StringOffset classes should delegate real string work to this class,
  * although both String and StringOffset classes are more than welcome to test
  * nullability to avoid calling this class.
+ *
+ * Mutable strings remember their buffer's capacity in m_cap, and append()
+ * grows the buffer geometrically, so building a string with .= does a
+ * logarithmic number of reallocs. Strings of up to SmallStringCap bytes are
+ * kept in m_inline, inside the StringData itself, with no malloc at all.
  */
 class StringData {
  private:
@@ -80,7 +85,7 @@ class StringData {
    */
   void destruct() const { if (!isStatic()) delete this; }
 
-  StringData() : m_data(NULL), _count(0), m_len(0) {
+  StringData() : m_data(NULL), _count(0), m_len(0), m_cap(0) {
     m_hash = 0;
     TAINT_OBSERVER_REGISTER_MUTATED(this);
   }
@@ -96,6 +101,11 @@ class StringData {
   void assign(const char *data, StringDataMode mode);
   void assign(const char *data, int len, StringDataMode mode);
   void append(const char *s, int len);
+  /**
+   * Takes over a malloc-ed buffer of cap + 1 bytes holding a string of len
+   * bytes, e.g. from a StringBuffer, so appends can fill the rest of it.
+   */
+  void attach(char *data, int len, int cap);
   StringData *copy(bool sharedMemory = false) const;
 
   ~StringData();
@@ -112,7 +122,11 @@ class StringData {
   bool isLiteral() const { return m_len & IsLiteral;}
   bool isShared() const { return m_len & IsShared;}
   bool isLinear() const { return m_len & IsLinear;}
-  bool isMalloced() const { return (m_len & IsMask) == 0 && m_data;}
+  bool isInline() const { return m_data == m_inline;}
+  bool isMalloced() const {
+    return (m_len & IsMask) == 0 && m_data && !isInline();
+  }
+  int capacity() const { return m_cap;}
   bool isImmutable() const {
     return (m_len & (IsLiteral | IsShared | IsLinear)) || isStatic();
   }
@@ -215,6 +229,12 @@ class StringData {
 #ifdef TAINTED
   TaintData m_taint_data;
 #endif
+ public:
+  // rounds StringData up to 48 bytes
+  const static int SmallStringCap = 19;
+ private:
+  int m_cap; // bytes usable before a mutable buffer has to grow, without NUL
+  char m_inline[SmallStringCap + 1];
 
   void releaseData();
 
@@ -21,6 +21,7 @@
 #include <runtime/base/runtime_error.h>
 #include <runtime/base/array/array_iterator.h>
 #include <runtime/base/builtin_functions.h>
+#include <util/string_kernels.h>
 
 using namespace std;
 
@@ -31,7 +32,14 @@ namespace HPHP {
 String StringUtil::ToLower(CStrRef input) {
   if (input.empty()) return input;
   int len = input.size();
-  char *ret = string_to_lower(input.data(), len);
+  const char *s = input.data();
+  int pos = StringKernels::FindUpper(s, len);
+  if (pos == len) return input; // already lower case
+
+  char *ret = (char *)malloc(len + 1);
+  memcpy(ret, s, pos);
+  StringKernels::ToLower(ret + pos, s + pos, len - pos);
+  ret[len] = '\0';
   return String(ret, len, AttachString);
 }
 
@@ -42,7 +50,15 @@ String StringUtil::ToUpper(CStrRef input, ToUpperType type /*= ToUpperAll */) {
   char *ret = NULL;
   switch (type) {
   case ToUpperAll:
-    ret = string_to_upper(input.data(), len);
+    {
+      const char *s = input.data();
+      int pos = StringKernels::FindLower(s, len);
+      if (pos == len) return input; // already upper case
+      ret = (char *)malloc(len + 1);
+      memcpy(ret, s, pos);
+      StringKernels::ToUpper(ret + pos, s + pos, len - pos);
+      ret[len] = '\0';
+    }
     break;
   case ToUpperFirst:
     ret = string_to_upper_first(input.data(), len);
@@ -61,9 +77,10 @@ String StringUtil::Trim(CStrRef input, TrimType type  /* = TrimBoth */,
                         CStrRef charlist /* = k_HPHP_TRIM_CHARLIST */) {
   if (input.empty()) return input;
   int len = input.size();
-  char *ret = string_trim(input.data(), len,
-                          charlist.data(), charlist.length(), type);
-  return String(ret, len, AttachString);
+  const char *s = string_trim_span(input.data(), len,
+                                   charlist.data(), charlist.length(), type);
+  if (len == input.size()) return input; // nothing trimmed
+  return String(s, len, CopyString);
 }
 
 String StringUtil::Pad(CStrRef input, int final_length,
@@ -302,6 +319,7 @@ String StringUtil::CDecode(CStrRef input) {
 String StringUtil::SqlEncode(CStrRef input) {
   if (input.empty()) return input;
   int len = input.size();
+  if (string_addslashes_find(input.data(), len) == len) return input;
   char *ret = string_addslashes(input, len);
   return String(ret, len, AttachString);
 }
@@ -333,12 +351,17 @@ String StringUtil::HtmlEncode(CStrRef input, QuoteStyle quoteStyle,
   }
 
   int len = input.size();
-  char *ret = string_html_encode(input, len, quoteStyle != NoQuotes,
-                                 quoteStyle == BothQuotes, utf8, nbsp);
+  bool dq = quoteStyle != NoQuotes;
+  bool sq = quoteStyle == BothQuotes;
+  int size = string_html_encode_size(input.data(), len, dq, sq, utf8, nbsp);
+  if (size == len) return input; // nothing to encode
+
+  char *ret = (char *)malloc(size + 1);
   if (!ret) {
     raise_error("HtmlEncode called on too large input (%d)", len);
   }
-  return String(ret, len, AttachString);
+  string_html_encode(ret, input.data(), len, dq, sq, utf8, nbsp);
+  return String(ret, size, AttachString);
 }
 
 String StringUtil::HtmlDecode(CStrRef input, const char *charset, bool all) {
@@ -452,13 +475,22 @@ String StringUtil::Translate(CStrRef input, CStrRef from, CStrRef to) {
   if (input.empty()) return input;
 
   int len = input.size();
-  char *ret = (char *)malloc(len + 1);
-  memcpy(ret, input, len);
-  ret[len] = '\0';
   int fromSize = from.size();
   int toSize = to.size();
   int trlen = (fromSize < toSize) ? fromSize : toSize;
-  string_translate(ret, len, from, to, trlen);
+
+  // bytes that translate to something else; nothing to do without any
+  StringKernels::CharSet changed;
+  for (int i = 0; i < trlen; i++) {
+    if (from.data()[i] != to.data()[i]) changed.add(from.data()[i]);
+  }
+  int pos = StringKernels::FindAnyOf(input.data(), len, changed);
+  if (pos == len) return input;
+
+  char *ret = (char *)malloc(len + 1);
+  memcpy(ret, input, len);
+  ret[len] = '\0';
+  string_translate(ret + pos, len - pos, from, to, trlen);
   return String(ret, len, AttachString);
 }
 
@@ -71,6 +71,7 @@ void ThreadInfo::onSessionInit() {
 
   m_top = NULL;
   m_reqInjectionData.onSessionInit();
+  m_refreshStatsCountdown = RefreshStatsPeriod;
 
   // We assume that this will be called reasonably low in the call stack.
   // Taking the address of marker gives us a location in this stack frame;
@@ -220,6 +220,10 @@ public:
 
   MemoryManager* m_mm;
 
+  // Calls left until check_request_timeout() next refreshes memory stats.
+  static const int RefreshStatsPeriod = 64;
+  int m_refreshStatsCountdown;
+
   // This pointer is set by ProfilerFactory
   Profiler *m_profiler;
 
@@ -250,9 +254,19 @@ extern void check_request_surprise(ThreadInfo *info) ATTRIBUTE_COLD;
 extern bool SegFaulting;
 
 inline void check_request_timeout(ThreadInfo *info) {
-  if (SegFaulting) pause_and_exit();
-  info->m_mm->refreshStats();
-  if (info->m_reqInjectionData.surprised) check_request_surprise(info);
+  // Directly malloc()ed string and array buffers are only counted, and the
+  // memory limit only checked, by refreshStats(), which raises the surprise
+  // flag. Doing that every call is too slow, never doing it lets a request
+  // grow without bound.
+  if (--info->m_refreshStatsCountdown <= 0) {
+    info->m_refreshStatsCountdown = ThreadInfo::RefreshStatsPeriod;
+    info->m_mm->refreshStats();
+  }
+  // runs on every function call, so both rare conditions share one branch
+  if (SegFaulting | info->m_reqInjectionData.surprised) {
+    if (SegFaulting) pause_and_exit();
+    check_request_surprise(info);
+  }
 }
 
 void check_request_timeout_ex(ThreadInfo *info, int lc);
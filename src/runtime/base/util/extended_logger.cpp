@@ -18,6 +18,7 @@
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/frame_injection.h>
 #include <runtime/base/array/array_iterator.h>
+#include <util/async_log_writer.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -118,8 +119,21 @@ void ExtendedLogger::Log(bool err, CArrRef stackTrace,
 
   // TODO Should we also send the stacktrace to LogAggregator?
   if (UseLogFile) {
-    FILE *f = Output ? Output : (err ? stderr : stdout);
-    PrintStackTrace(f, stackTrace, escape, escapeMore);
+    AsyncLogWriter *writer = s_asyncWriter;
+    if (writer) {
+      // keep the frames in order with the message queued before them
+      char *buf = NULL;
+      size_t size = 0;
+      FILE *f = open_memstream(&buf, &size);
+      if (f) {
+        PrintStackTrace(f, stackTrace, escape, escapeMore);
+        fclose(f);
+        writer->write(buf, size, err);
+      }
+    } else {
+      FILE *f = Output ? Output : (err ? stderr : stdout);
+      PrintStackTrace(f, stackTrace, escape, escapeMore);
+    }
 
     FILE *tf = threadData->log;
     if (tf) {
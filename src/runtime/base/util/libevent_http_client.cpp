@@ -19,6 +19,7 @@
 #include <runtime/base/runtime_option.h>
 #include <util/compression.h>
 #include <util/logger.h>
+#include <util/network.h>
 #include <util/timer.h>
 
 using namespace std;
@@ -223,7 +224,14 @@ bool LibEventHttpClient::send(const std::string &url,
   // even if we had an m_conn immediately above, it may have been cleared out
   // by onConnectionClosed().
   if (m_conn == NULL) {
-    m_conn = evhttp_connection_new(m_address.c_str(), m_port);
+    // libevent would resolve the name synchronously on every new connection
+    string ip = Util::DnsCache::ResolveToIP(m_address.c_str());
+    if (ip.empty()) {
+      Logger::Error("unable to resolve %s", m_address.c_str());
+      evhttp_request_free(request);
+      return false;
+    }
+    m_conn = evhttp_connection_new(ip.c_str(), m_port);
     evhttp_connection_set_closecb(m_conn, on_connection_closed, this);
     evhttp_connection_set_base(m_conn, m_eventBase);
   }
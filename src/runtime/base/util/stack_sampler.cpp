@@ -0,0 +1,195 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <runtime/base/util/stack_sampler.h>
+#include <runtime/base/frame_injection.h>
+#include <runtime/base/runtime_option.h>
+#include <util/atomic.h>
+#include <util/lock.h>
+#include <util/hash.h>
+#include <util/util.h>
+#include <signal.h>
+#include <sys/time.h>
+
+using namespace std;
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+StackSampler::Entry *StackSampler::s_entries = NULL;
+int StackSampler::s_mask = 0;
+int StackSampler::s_rate = 0;
+int64 StackSampler::s_dropped = 0;
+
+static Mutex s_mutex;
+
+bool StackSampler::Start(int rate) {
+  if (rate <= 0 || rate > 1000000) return false;
+
+  Lock lock(s_mutex);
+  if (!s_entries) {
+    // never freed, as a signal handler may still be using it
+    int slots = Util::roundUpToPowerOfTwo(RuntimeOption::StackSamplerSlots);
+    if (slots < 16) slots = 16;
+    s_entries = (Entry*)calloc(slots, sizeof(Entry));
+    if (!s_entries) return false;
+    s_mask = slots - 1;
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = OnSignal;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, NULL)) return false;
+
+  struct itimerval timer;
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = 1000000 / rate;
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, NULL)) return false;
+  s_rate = rate;
+  return true;
+}
+
+void StackSampler::Stop() {
+  Lock lock(s_mutex);
+  struct itimerval timer;
+  memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, NULL);
+  s_rate = 0;
+}
+
+void StackSampler::Clear() {
+  Lock lock(s_mutex);
+  if (!s_entries) return;
+  // a sample landing in the middle of this is lost, or at worst leaves a
+  // slot with a count of 1 and hash 0 behind, which Report() skips and the
+  // next stack to claim the slot resets
+  for (int i = 0; i <= s_mask; i++) {
+    Entry &e = s_entries[i];
+    e.ready = 0;
+    e.count = 0;
+    e.hash = 0;
+  }
+  s_dropped = 0;
+}
+
+void StackSampler::Report(string &out) {
+  vector<pair<int64, const char *> > stacks;
+  {
+    Lock lock(s_mutex);
+    if (s_entries) {
+      for (int i = 0; i <= s_mask; i++) {
+        const Entry &e = s_entries[i];
+        if (e.hash && e.ready && e.count > 0) {
+          stacks.push_back(pair<int64, const char *>(-e.count, e.stack));
+        }
+      }
+    }
+  }
+  sort(stacks.begin(), stacks.end());
+
+  out.clear();
+  char buf[32];
+  for (unsigned int i = 0; i < stacks.size(); i++) {
+    snprintf(buf, sizeof(buf), " %lld\n", (long long)-stacks[i].first);
+    out += stacks[i].second;
+    out += buf;
+  }
+  if (s_dropped) {
+    snprintf(buf, sizeof(buf), " %lld\n", (long long)s_dropped);
+    out += "(dropped)";
+    out += buf;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// signal handler: no locks, no malloc
+
+void StackSampler::OnSignal(int sig) {
+  if (!s_entries || ThreadInfo::s_threadInfo.isNull()) return;
+  FrameInjection *frame = ThreadInfo::s_threadInfo.get()->m_top;
+  if (!frame) return; // not running PHP code
+
+  int saved = errno;
+  const char *names[MaxDepth];
+  int lens[MaxDepth];
+  int depth = 0;
+  for (; frame && depth < MaxDepth; frame = frame->getPrev()) {
+    const char *name = frame->getFunction();
+    if (!name || !*name) continue;
+    names[depth] = name;
+    lens[depth] = strlen(name);
+    depth++;
+  }
+
+  // innermost frames that fit, printed outermost first
+  int total = 0;
+  int kept = 0;
+  while (kept < depth && total + lens[kept] + 1 <= MaxStackSize - 4) {
+    total += lens[kept++] + 1;
+  }
+  if (kept == 0) {
+    errno = saved;
+    return;
+  }
+
+  char stack[MaxStackSize];
+  int size = 0;
+  if (frame || kept < depth) {
+    memcpy(stack, "...;", 4);
+    size = 4;
+  }
+  for (int i = kept - 1; i >= 0; i--) {
+    memcpy(stack + size, names[i], lens[i]);
+    size += lens[i];
+    stack[size++] = i ? ';' : '\0';
+  }
+  Record(stack, size - 1);
+  errno = saved;
+}
+
+void StackSampler::Record(const char *stack, int len) {
+  int64 hash = hash_string_cs(stack, len);
+  if (hash == 0) hash = 1;
+  for (int probe = 0; probe < 16; probe++) {
+    Entry &e = s_entries[(hash + probe) & s_mask];
+    int64 current = e.hash;
+    if (current == 0) {
+      if (__sync_bool_compare_and_swap(&e.hash, (int64)0, hash)) {
+        // ready and count may be left over from a sample racing Clear()
+        e.ready = 0;
+        e.count = 0;
+        __sync_synchronize();
+        memcpy(e.stack, stack, len + 1);
+        __sync_synchronize();
+        e.ready = 1;
+        atomic_add(e.count, (int64)1);
+        return;
+      }
+      current = e.hash;
+    }
+    if (current == hash) {
+      atomic_add(e.count, (int64)1);
+      return;
+    }
+  }
+  atomic_add(s_dropped, (int64)1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
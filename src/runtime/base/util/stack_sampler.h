@@ -0,0 +1,72 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HPHP_STACK_SAMPLER_H__
+#define __HPHP_STACK_SAMPLER_H__
+
+#include <util/base.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Process-wide sampling profiler. A SIGPROF timer interrupts whichever thread
+ * is using CPU, and if it's running PHP code, its FrameInjection chain is
+ * counted as one sample of that stack. Samples from all requests accumulate
+ * in a fixed-size table that the signal handler fills without locks or
+ * memory allocation, and Report() prints them in the folded format flame
+ * graph tools take, one "outer;inner;leaf count" line per stack.
+ *
+ * This uses the same signal as Google's CPU profiler, so they can't run at
+ * the same time.
+ */
+class StackSampler {
+public:
+  /**
+   * Starts sampling "rate" times per second of CPU time. Can be called again
+   * to change the rate.
+   */
+  static bool Start(int rate);
+  static void Stop();
+  static bool IsRunning() { return s_rate > 0;}
+
+  static void Clear();
+  static void Report(std::string &out);
+
+private:
+  static const int MaxDepth = 128;
+  static const int MaxStackSize = 1000;
+
+  struct Entry {
+    volatile int64 hash; // 0 for an empty slot
+    int64 count;
+    volatile int ready;  // set once "stack" is filled in
+    char stack[MaxStackSize];
+  };
+
+  static Entry *s_entries;
+  static int s_mask;
+  static int s_rate;
+  static int64 s_dropped;
+
+  static void OnSignal(int sig);
+  static void Record(const char *stack, int len);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HPHP_STACK_SAMPLER_H__
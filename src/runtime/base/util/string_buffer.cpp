@@ -111,7 +111,10 @@ String StringBuffer::detach() {
 
   if (m_buffer && m_pos) {
     m_buffer[m_pos] = '\0'; // fixup
-    String ret(m_buffer, m_pos, AttachString);
+    // hand the whole buffer over, so appending to the result is cheap
+    StringData *sd = NEW(StringData)();
+    sd->attach(m_buffer, m_pos, m_size);
+    String ret(sd);
     m_buffer = NULL;
     m_pos = 0;
     return ret;
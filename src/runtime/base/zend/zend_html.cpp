@@ -19,6 +19,10 @@
 #include <runtime/base/complex_types.h>
 #include <util/lock.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace HPHP {
 
 #define HTML_SPECIALCHARS   0
@@ -473,81 +477,136 @@ static void init_entity_table() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-char *string_html_encode(const char *input, int &len, bool encode_double_quote,
-                         bool encode_single_quote, bool utf8, bool nbsp) {
-  ASSERT(input);
-  if (!*input) {
-    return NULL;
+/**
+ * The bytes string_html_encode() has to stop at for one set of options, the
+ * ones that may become entities. Clean runs in between are found 16 bytes at
+ * a time with SSE2 and copied with memcpy.
+ */
+class HtmlSpecials {
+public:
+  HtmlSpecials(bool encode_double_quote, bool encode_single_quote,
+               bool utf8, bool nbsp) : m_utf8(utf8) {
+    // options that are off repeat '<', which is always special
+    m_chars[0] = '<';
+    m_chars[1] = '>';
+    m_chars[2] = '&';
+    m_chars[3] = encode_double_quote ? '"' : '<';
+    m_chars[4] = encode_single_quote ? '\'' : '<';
+    m_chars[5] = nbsp ? (utf8 ? '\xc2' : '\xa0') : '<';
+  }
+
+  bool isSpecial(char c) const {
+    return c == m_chars[0] || c == m_chars[1] || c == m_chars[2] ||
+      c == m_chars[3] || c == m_chars[4] || c == m_chars[5];
   }
 
   /**
-   * Though seems to be wasting memory a lot, we have to realize most of the
-   * time this function is called with small strings, or fragments of HTMLs.
-   * Allocating/deallocating anything less than 1K is trivial these days, and
-   * we want avoid string copying as much as possible. Of course, the return
-   * char * is really sent back at large, occupying unnessary space for
-   * potentially longer time than we need, we have to realize the two closest
-   * solutions are not that much better, either:
-   *
-   * 1. pre-calculate size by iterating through the string once: too time
-   *    consuming;
-   * 2. take a guess and double buffer size when over: still wasting, and
-   *    it may not save that much.
+   * First special byte in [p, end), or end.
    */
-  char *ret = (char *)malloc(len * 6 + 1);
-  if (!ret) {
-    return NULL;
-  }
-  char *q = ret;
-  for (const char *p = input; *p; p++) {
-    char c = *p;
-    switch (c) {
-    case '"':
-      if (encode_double_quote) {
-        *q++ = '&'; *q++ = 'q'; *q++ = 'u'; *q++ = 'o'; *q++ = 't'; *q++ = ';';
-      } else {
-        *q++ = c;
+  const char *next(const char *p, const char *end) const {
+#ifdef __SSE2__
+    if (end - p >= 16) {
+      __m128i c0 = _mm_set1_epi8(m_chars[0]);
+      __m128i c1 = _mm_set1_epi8(m_chars[1]);
+      __m128i c2 = _mm_set1_epi8(m_chars[2]);
+      __m128i c3 = _mm_set1_epi8(m_chars[3]);
+      __m128i c4 = _mm_set1_epi8(m_chars[4]);
+      __m128i c5 = _mm_set1_epi8(m_chars[5]);
+      for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i m = _mm_or_si128(
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0),
+                                    _mm_cmpeq_epi8(v, c1)),
+                       _mm_cmpeq_epi8(v, c2)),
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c3),
+                                    _mm_cmpeq_epi8(v, c4)),
+                       _mm_cmpeq_epi8(v, c5)));
+        int mask = _mm_movemask_epi8(m);
+        if (mask) return p + __builtin_ctz(mask);
       }
-      break;
-    case '\'':
-      if (encode_single_quote) {
-        *q++ = '&'; *q++ = '#'; *q++ = '0'; *q++ = '3'; *q++ = '9'; *q++ = ';';
-      } else {
-        *q++ = c;
-      }
-      break;
-    case '<':
-      *q++ = '&'; *q++ = 'l'; *q++ = 't'; *q++ = ';';
-      break;
-    case '>':
-      *q++ = '&'; *q++ = 'g'; *q++ = 't'; *q++ = ';';
-      break;
-    case '&':
-      *q++ = '&'; *q++ = 'a'; *q++ = 'm'; *q++ = 'p'; *q++ = ';';
-      break;
+    }
+#endif
+    for (; p < end; p++) {
+      if (isSpecial(*p)) return p;
+    }
+    return end;
+  }
+
+  /**
+   * Entity for the special byte at p, setting how many input bytes it
+   * replaces, or NULL if the byte stays as it is.
+   */
+  const char *entity(const char *p, const char *end, int &consumed) const {
+    consumed = 1;
+    switch (*p) {
+    case '<':  return "&lt;";
+    case '>':  return "&gt;";
+    case '&':  return "&amp;";
+    case '"':  return "&quot;";
+    case '\'': return "&#039;";
     case '\xc2':
-      if (nbsp && utf8 && *(p+1) == '\xa0') {
-        *q++ = '&'; *q++ = 'n'; *q++ = 'b'; *q++ = 's'; *q++ = 'p'; *q++ = ';';
-        p++;
-      } else {
-        *q++ = c;
+      if (m_utf8 && p + 1 < end && p[1] == '\xa0') {
+        consumed = 2;
+        return "&nbsp;";
       }
-      break;
+      return NULL;
     case '\xa0':
-      if (nbsp && !utf8) {
-        *q++ = '&'; *q++ = 'n'; *q++ = 'b'; *q++ = 's'; *q++ = 'p'; *q++ = ';';
-      } else {
-        *q++ = c;
-      }
-      break;
+      return m_utf8 ? NULL : "&nbsp;";
     default:
-      *q++ = c;
-      break;
+      return NULL;
     }
   }
+
+private:
+  char m_chars[6];
+  bool m_utf8;
+};
+
+int string_html_encode_size(const char *input, int len,
+                            bool encode_double_quote,
+                            bool encode_single_quote, bool utf8, bool nbsp) {
+  ASSERT(input);
+  HtmlSpecials specials(encode_double_quote, encode_single_quote, utf8, nbsp);
+  const char *p = input;
+  const char *end = input + len;
+  int size = 0;
+  while (true) {
+    const char *q = specials.next(p, end);
+    size += q - p;
+    p = q;
+    if (p == end) break;
+    int consumed;
+    const char *e = specials.entity(p, end, consumed);
+    size += e ? strlen(e) : 1;
+    p += consumed;
+  }
+  return size;
+}
+
+void string_html_encode(char *out, const char *input, int len,
+                        bool encode_double_quote, bool encode_single_quote,
+                        bool utf8, bool nbsp) {
+  ASSERT(out && input);
+  HtmlSpecials specials(encode_double_quote, encode_single_quote, utf8, nbsp);
+  const char *p = input;
+  const char *end = input + len;
+  char *q = out;
+  while (true) {
+    const char *s = specials.next(p, end);
+    memcpy(q, p, s - p);
+    q += s - p;
+    p = s;
+    if (p == end) break;
+    int consumed;
+    const char *e = specials.entity(p, end, consumed);
+    if (e) {
+      while (*e) *q++ = *e++;
+    } else {
+      *q++ = *p;
+    }
+    p += consumed;
+  }
   *q = 0;
-  len = q - ret;
-  return ret;
 }
 
 inline static bool decode_entity(char *entity, int *len,
@@ -46,8 +46,17 @@ namespace HPHP {
  *    a workaround of buggy coding. I don't find a legit use for that yet.
  */
 
-char *string_html_encode(const char *input, int &len, bool encode_double_quote,
-                         bool encode_single_quote, bool utf8, bool nbsp);
+/**
+ * Two passes of string_html_encode(): the first returns the exact size of
+ * the output, which equals len when nothing needs encoding, and the second
+ * writes it, plus a NUL, to out.
+ */
+int string_html_encode_size(const char *input, int len,
+                            bool encode_double_quote,
+                            bool encode_single_quote, bool utf8, bool nbsp);
+void string_html_encode(char *out, const char *input, int len,
+                        bool encode_double_quote, bool encode_single_quote,
+                        bool utf8, bool nbsp);
 char *string_html_decode(const char *input, int &len, const char *charset_hint,
                          bool all);
 Array string_get_html_translation_table(int which, int quote_style);
@@ -16,6 +16,7 @@
 */
 
 #include <runtime/base/zend/zend_string.h>
+#include <util/hash_kernels.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -63,6 +64,18 @@ static unsigned char PADDING[64] = {
 
 static void SHA1Transform(uint32 state[5], const unsigned char block[64]);
 
+/**
+ * Runs count blocks through SHA1Transform, or through the CPU's SHA
+ * instructions when it has them.
+ */
+static void SHA1Blocks(uint32 state[5], const unsigned char *blocks,
+                       unsigned int count) {
+  if (HashKernels::SHA1Blocks(state, blocks, count)) return;
+  for (; count; count--, blocks += 64) {
+    SHA1Transform(state, blocks);
+  }
+}
+
 /**
  * Encodes input (uint32) into output (unsigned char). Assumes len is
  * a multiple of 4.
@@ -137,11 +150,9 @@ void PHP_SHA1Update(PHP_SHA1_CTX * context, const unsigned char *input,
   if (inputLen >= partLen) {
     memcpy((unsigned char*) & context->buffer[index],
            (unsigned char*) input, partLen);
-    SHA1Transform(context->state, context->buffer);
-
-    for (i = partLen; i + 63 < inputLen; i += 64) {
-      SHA1Transform(context->state, &input[i]);
-    }
+    SHA1Blocks(context->state, context->buffer, 1);
+    SHA1Blocks(context->state, &input[partLen], (inputLen - partLen) / 64);
+    i = inputLen - (inputLen - partLen) % 64;
 
     index = 0;
   } else
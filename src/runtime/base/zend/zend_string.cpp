@@ -21,6 +21,8 @@
 #include <runtime/base/zend/utf8_to_utf16.h>
 
 #include <util/lock.h>
+#include <util/string_kernels.h>
+#include <util/hash_kernels.h>
 #include <math.h>
 #include <monetary.h>
 
@@ -350,9 +352,7 @@ int string_natural_cmp(char const *a, size_t a_len,
 char *string_to_lower(const char *s, int len) {
   ASSERT(s);
   char *ret = (char *)malloc(len + 1);
-  for (int i = 0; i < len; i++) {
-    ret[i] = tolower(s[i]);
-  }
+  StringKernels::ToLower(ret, s, len);
   ret[len] = '\0';
   return ret;
 }
@@ -360,9 +360,7 @@ char *string_to_lower(const char *s, int len) {
 char *string_to_upper(const char *s, int len) {
   ASSERT(s);
   char *ret = (char *)malloc(len + 1);
-  for (int i = 0; i < len; i++) {
-    ret[i] = toupper(s[i]);
-  }
+  StringKernels::ToUpper(ret, s, len);
   ret[len] = '\0';
   return ret;
 }
@@ -395,6 +393,14 @@ char *string_to_upper_words(const char *s, int len) {
 char *string_trim(const char *s, int &len,
                   const char *charlist, int charlistlen, int mode) {
   ASSERT(s);
+  s = string_trim_span(s, len, charlist, charlistlen, mode);
+  return string_duplicate(s, len);
+}
+
+const char *string_trim_span(const char *s, int &len,
+                             const char *charlist, int charlistlen,
+                             int mode) {
+  ASSERT(s);
   char mask[256];
   string_charmask(charlist, charlistlen, mask);
 
@@ -419,7 +425,7 @@ char *string_trim(const char *s, int &len,
       }
     }
   }
-  return string_duplicate(s, len);
+  return s;
 }
 
 #define STR_PAD_LEFT            0
@@ -506,23 +512,18 @@ int string_find(const char *input, int len, char ch, int pos,
                 bool case_sensitive) {
   ASSERT(input);
   if (len && pos < len) {
-    if (!case_sensitive) {
-      ch = tolower(ch);
-      char *lowered = string_to_lower(input, len);
-      int ret = string_find(lowered, len, ch, pos, true);
-      free(lowered);
-      return ret;
-    }
-
     int l = 1;
     if (!string_substr_check(len, pos, l)) {
       return -1;
     }
-    for (int i = pos; i < len; i++) {
-      if (input[i] == ch) {
-        return i;
-      }
+    if (!case_sensitive) {
+      char lch = StringKernels::LowerChar(ch);
+      int ret = StringKernels::FindCaseInsensitive(input + pos, len - pos,
+                                                   &lch, 1);
+      return ret < 0 ? -1 : ret + pos;
     }
+    const char *p = (const char *)memchr(input + pos, ch, len - pos);
+    return p ? p - input : -1;
   }
   return -1;
 }
@@ -571,25 +572,20 @@ int string_find(const char *input, int len, const char *s, int s_len,
     return -1;
   }
   if (len && pos < len) {
-    if (!case_sensitive) {
-      char *lowered_s = string_to_lower(s, s_len);
-      char *lowered = string_to_lower(input, len);
-      int ret = string_find(lowered, len, lowered_s, s_len, pos, true);
-      free(lowered);
-      free(lowered_s);
-      return ret;
-    }
-
     int l = 1;
     if (!string_substr_check(len, pos, l)) {
       return -1;
     }
-    int i_max = len - s_len + 1;
-    for (int i = pos; i < i_max; i++) {
-      if (input[i] == s[0] && memcmp(input+i, s, s_len) == 0) {
-        return i;
-      }
+    int ret;
+    if (!case_sensitive) {
+      char *lowered_s = string_to_lower(s, s_len);
+      ret = StringKernels::FindCaseInsensitive(input + pos, len - pos,
+                                               lowered_s, s_len);
+      free(lowered_s);
+    } else {
+      ret = StringKernels::Find(input + pos, len - pos, s, s_len);
     }
+    return ret < 0 ? -1 : ret + pos;
   }
   return -1;
 }
@@ -712,22 +708,18 @@ char *string_replace(const char *input, int &len,
 
   std::vector<int> founds;
   founds.reserve(16);
-  if (len_search == 1) {
-    for (int pos = string_find(input, len, *search, 0, case_sensitive);
-         pos >= 0;
-         pos = string_find(input, len, *search, pos + len_search,
-                           case_sensitive)) {
-      founds.push_back(pos);
-    }
-  } else {
-    for (int pos = string_find(input, len, search, len_search, 0,
-                               case_sensitive);
-         pos >= 0;
-         pos = string_find(input, len, search, len_search,
-                           pos + len_search, case_sensitive)) {
-      founds.push_back(pos);
-    }
-  }
+  // lower the search string once, not on every find
+  char *lowered = case_sensitive ? NULL : string_to_lower(search, len_search);
+  for (int pos = 0; pos + len_search <= len; pos += len_search) {
+    int found = lowered ?
+      StringKernels::FindCaseInsensitive(input + pos, len - pos,
+                                         lowered, len_search) :
+      StringKernels::Find(input + pos, len - pos, search, len_search);
+    if (found < 0) break;
+    pos += found;
+    founds.push_back(pos);
+  }
+  free(lowered);
 
   count = founds.size();
   if (count == 0) {
@@ -1454,6 +1446,12 @@ char *string_stripcslashes(const char *input, int &nlen) {
   return str;
 }
 
+static const StringKernels::CharSet s_slashed("\0'\"\\", 4);
+
+int string_addslashes_find(const char *str, int length) {
+  return StringKernels::FindAnyOf(str, length, s_slashed);
+}
+
 char *string_addslashes(const char *str, int &length) {
   ASSERT(str);
   if (length == 0) {
@@ -1466,6 +1464,13 @@ char *string_addslashes(const char *str, int &length) {
   char *target = new_str;
 
   while (source < end) {
+    // copy the run up to the next byte that needs a slash in one go
+    int run = string_addslashes_find(source, end - source);
+    memcpy(target, source, run);
+    target += run;
+    source += run;
+    if (source == end) break;
+
     switch (*source) {
     case '\0':
       *target++ = '\\';
@@ -1669,22 +1674,15 @@ char *string_quoted_printable_decode(const char *input, int &len) {
 }
 
 char *string_bin2hex(const char *input, int &len) {
-  static char hexconvtab[] = "0123456789abcdef";
-
   ASSERT(input);
   if (len == 0) {
     return NULL;
   }
 
-  int i, j;
   char *result = (char *)malloc((len << 1) + 1);
-
-  for (i = j = 0; i < len; i++) {
-    result[j++] = hexconvtab[(unsigned char)input[i] >> 4];
-    result[j++] = hexconvtab[(unsigned char)input[i] & 15];
-  }
-  result[j] = '\0';
-  len = j;
+  StringKernels::HexEncode(result, input, len);
+  len <<= 1;
+  result[len] = '\0';
   return result;
 }
 
@@ -2004,6 +2002,11 @@ static unsigned char *php_base64_encode(const unsigned char *str, int length,
   result = (unsigned char *)malloc(((length + 2) / 3) * 4 + 1);
   p = result;
 
+  int blocks = StringKernels::Base64EncodeBlocks((char *)p, current, length);
+  current += blocks;
+  length -= blocks;
+  p += blocks / 3 * 4;
+
   while (length > 2) { /* keep going until we have less than 24 bits */
     *p++ = base64_table[current[0] >> 2];
     *p++ = base64_table[((current[0] & 0x03) << 4) + (current[1] >> 4)];
@@ -2042,10 +2045,24 @@ static unsigned char *php_base64_decode(const unsigned char *str,
   /* this sucks for threaded environments */
   unsigned char *result;
 
-  result = (unsigned char *)malloc(length + 1);
+  // 3 bytes for every 4 characters, and room for a partial group and the
+  // terminator; the scratch byte of Base64DecodeBlocks() always fits
+  result = (unsigned char *)malloc(length / 4 * 3 + 3);
 
   /* run through the whole string, converting as we go */
-  while ((ch = *current++) != '\0' && length-- > 0) {
+  for (;;) {
+    if ((i & 3) == 0 && length >= 16) {
+      // runs of plain base64 characters, starting on a group boundary
+      int n = StringKernels::Base64DecodeBlocks(result + j,
+                                                (const char *)current,
+                                                length);
+      current += n;
+      length -= n;
+      i += n;
+      j += n / 4 * 3;
+    }
+    if ((ch = *current++) == '\0' || length-- <= 0) break;
+
     if (ch == base64_pad) {
       if (*current != '=' && (i % 4) == 1) {
         free(result);
@@ -2494,10 +2511,12 @@ static const unsigned int crc32tab[256] = {
 };
 
 int string_crc32(const char *p, int len) {
-  uint32 crcinit = 0;
-  register int32 crc = crcinit ^ 0xFFFFFFFF;
+  uint32 crc = 0xFFFFFFFF;
+  int folded = HashKernels::FoldCRC32(crc, (const unsigned char *)p, len);
+  p += folded;
+  len -= folded;
   for (; len--; ++p) {
-    crc = ((crc >> 8) & 0x00FFFFFF) ^ crc32tab[(crc ^ (*p)) & 0xFF];
+    crc = (crc >> 8) ^ crc32tab[(crc ^ (*p)) & 0xFF];
   }
   return crc ^ 0xFFFFFFFF;
 }
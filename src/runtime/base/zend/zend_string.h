@@ -156,6 +156,12 @@ char *string_to_upper_words(const char *s, int len);
  */
 char *string_trim(const char *s, int &len,
                   const char *charlist, int charlistlen, int mode);
+/**
+ * The part of s that string_trim() keeps, without copying it.
+ */
+const char *string_trim_span(const char *s, int &len,
+                             const char *charlist, int charlistlen,
+                             int mode);
 
 /**
  * Pad a string with pad_string to pad_length. "len" is
@@ -233,6 +239,10 @@ char *string_addcslashes(const char *str, int &length, const char *what,
                          int wlength);
 char *string_stripcslashes(const char *input, int &nlen);
 char *string_addslashes(const char *str, int &length);
+/**
+ * Position of the first byte string_addslashes() would escape, or length.
+ */
+int string_addslashes_find(const char *str, int length);
 char *string_stripslashes(const char *input, int &l);
 char *string_quotemeta(const char *input, int &len);
 char *string_quoted_printable_encode(const char *input, int &len);
@@ -17,6 +17,7 @@
 
 #include <runtime/base/zend/zend_url.h>
 #include <runtime/base/zend/zend_string.h>
+#include <util/string_kernels.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -308,37 +309,17 @@ static int php_htoi(char *s) {
    For added safety, we only leave -_. unencoded.
  */
 
-static unsigned char hexchars[] = "0123456789ABCDEF";
+static char *url_encode_impl(const char *s, int &len, bool raw) {
+  // sized exactly, rather than for the worst case of 3 * len
+  int escapes = StringKernels::CountURLEscapes(s, len, raw);
+  char *str = (char *)malloc(len + 2 * escapes + 1);
+  len = StringKernels::URLEncode(str, s, len, raw);
+  str[len] = '\0';
+  return str;
+}
 
 char *url_encode(const char *s, int &len) {
-  register unsigned char c;
-  unsigned char *to, *start;
-  unsigned char const *from, *end;
-
-  from = (unsigned char const *)s;
-  end = (unsigned char const *)s + len;
-  start = to = (unsigned char *)malloc(3 * len + 1);
-
-  while (from < end) {
-    c = *from++;
-
-    if (c == ' ') {
-      *to++ = '+';
-    } else if ((c < '0' && c != '-' && c != '.') ||
-           (c < 'A' && c > '9') ||
-           (c > 'Z' && c < 'a' && c != '_') ||
-           (c > 'z')) {
-      to[0] = '%';
-      to[1] = hexchars[c >> 4];
-      to[2] = hexchars[c & 15];
-      to += 3;
-    } else {
-      *to++ = c;
-    }
-  }
-  *to = 0;
-  len = to - start;
-  return (char *) start;
+  return url_encode_impl(s, len, false);
 }
 
 char *url_decode(const char *s, int &len) {
@@ -420,24 +401,7 @@ int url_decode_ex(char *value, int len) {
 }
 
 char *url_raw_encode(const char *s, int &len) {
-  register int x, y;
-  unsigned char *str;
-
-  str = (unsigned char *)malloc(3 * len + 1);
-  for (x = 0, y = 0; len--; x++, y++) {
-    str[y] = (unsigned char) s[x];
-    if ((str[y] < '0' && str[y] != '-' && str[y] != '.') ||
-      (str[y] < 'A' && str[y] > '9') ||
-        (str[y] > 'Z' && str[y] < 'a' && str[y] != '_') ||
-      (str[y] > 'z')) {
-      str[y++] = '%';
-      str[y++] = hexchars[(unsigned char) s[x] >> 4];
-      str[y] = hexchars[(unsigned char) s[x] & 15];
-    }
-  }
-  str[y] = '\0';
-  len = y;
-  return ((char *)str);
+  return url_encode_impl(s, len, true);
 }
 
 char *url_raw_decode(const char *s, int &len) {
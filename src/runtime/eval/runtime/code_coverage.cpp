@@ -17,61 +17,237 @@
 #include <runtime/eval/runtime/code_coverage.h>
 #include <runtime/base/complex_types.h>
 #include <util/logger.h>
+#include <util/atomic.h>
 
 using namespace std;
 
 namespace HPHP { namespace Eval {
 ///////////////////////////////////////////////////////////////////////////////
 
-Mutex CodeCoverage::s_mutex;
-CodeCoverage::CodeCoverageMap CodeCoverage::s_hits;
+/**
+ * src may be a shard's counters that its thread is still writing.
+ */
+static void add_lines(vector<int> &dest, const vector<int> &src) {
+  if (dest.size() < src.size()) {
+    dest.resize(src.size());
+  }
+  for (unsigned int i = 0; i < src.size(); i++) {
+    dest[i] += atomic_load_relaxed(src[i]);
+  }
+}
 
-void CodeCoverage::Record(const char *filename, int line0, int line1) {
-  if (!filename || !*filename || line0 <= 0 || line1 <= 0 || line0 > line1) {
-    return;
+static void add_hits(vector<vector<int> > &to,
+                     const vector<vector<int> > &from) {
+  if (to.size() < from.size()) {
+    to.resize(from.size());
+  }
+  for (unsigned int id = 0; id < from.size(); id++) {
+    add_lines(to[id], from[id]);
   }
+}
 
-  Lock lock(s_mutex);
+///////////////////////////////////////////////////////////////////////////////
 
-  CodeCoverageMap::iterator iter = s_hits.find(filename);
-  if (iter == s_hits.end()) {
-    vector<int> &lines = s_hits[filename];
-    lines.resize(line1 + 1);
-    for (int i = line0; i <= line1; i++) {
-      lines[i] = 1;
+/**
+ * One thread's counters. Only the owning thread writes them and counting a
+ * hit takes no lock, but as collect() may read them at the same time, they
+ * are only accessed with relaxed atomic loads and stores. Arrays are never resized in place: growing one
+ * publishes a bigger copy and frees the old one under s_mutex, which
+ * collect() is always called with, so readers never see freed memory.
+ */
+class CodeCoverage::Shard {
+public:
+  typedef std::vector<int> Lines;
+  typedef std::vector<Lines*> Files; // by file id, NULL if never hit
+
+  Shard() : m_files(new Files()), m_generation(s_generation),
+            m_lastFile(NULL), m_lastId(0) {
+    Lock lock(s_mutex);
+    s_shards.insert(this);
+  }
+
+  ~Shard() {
+    Lock lock(s_mutex);
+    s_shards.erase(this);
+    collect(s_retired);
+    for (unsigned int id = 0; id < m_files->size(); id++) {
+      delete (*m_files)[id];
     }
-  } else {
-    vector<int> &lines = iter->second;
-    if ((int)lines.size() < line1 + 1) {
-      lines.resize(line1 + 1);
+    delete m_files;
+  }
+
+  void record(const char *filename, int line0, int line1) {
+    if (m_generation != s_generation) {
+      restart();
+    }
+
+    int id;
+    if (m_lastFile && strcmp(m_lastFile, filename) == 0) {
+      id = m_lastId;
+    } else {
+      hphp_const_char_map<int>::const_iterator iter = m_fileIds.find(filename);
+      if (iter != m_fileIds.end()) {
+        m_lastFile = iter->first;
+        id = iter->second;
+      } else {
+        id = GetFileId(filename, m_lastFile);
+        m_fileIds[m_lastFile] = id;
+      }
+      m_lastId = id;
+    }
+
+    Files *files = m_files;
+    Lines *lines = id < (int)files->size() ? (*files)[id] : NULL;
+    if (!lines || (int)lines->size() <= line1) {
+      lines = grow(id, line1 + 1);
     }
     for (int i = line0; i <= line1; i++) {
-      ++lines[i];
+      int &count = (*lines)[i];
+      atomic_store_relaxed(count, count + 1); // we are the only writer
+    }
+  }
+
+  /**
+   * Called with s_mutex held, which also keeps s_generation still.
+   */
+  void collect(LineCounts &hits) const {
+    if (m_generation != s_generation) return; // not restarted since Reset()
+    const Files *files = m_files;
+    if (hits.size() < files->size()) {
+      hits.resize(files->size());
+    }
+    for (unsigned int id = 0; id < files->size(); id++) {
+      const Lines *lines = (*files)[id];
+      if (lines) {
+        add_lines(hits[id], *lines);
+      }
+    }
+  }
+
+private:
+  Files * volatile m_files;
+  volatile int m_generation;
+
+  // only touched by the owning thread
+  hphp_const_char_map<int> m_fileIds;
+  const char *m_lastFile;
+  int m_lastId;
+
+  Lines *grow(int id, int size) {
+    Files *files = m_files;
+    Files *oldFiles = NULL;
+    if ((int)files->size() <= id) {
+      oldFiles = files;
+      files = new Files(*oldFiles);
+      files->resize(id + 1);
+    }
+    Lines *oldLines = (*files)[id];
+    int capacity = oldLines ? oldLines->size() * 2 : 64;
+    if (capacity < size) capacity = size;
+    Lines *lines = new Lines(capacity);
+    if (oldLines) {
+      copy(oldLines->begin(), oldLines->end(), lines->begin());
+    }
+
+    __sync_synchronize(); // contents before pointers
+    (*files)[id] = lines;
+    __sync_synchronize();
+    m_files = files;
+
+    if (oldFiles || oldLines) {
+      Lock lock(s_mutex); // waits out any collect() still reading them
+      delete oldFiles;
+      delete oldLines;
+    }
+    return lines;
+  }
+
+  /**
+   * Zeroes counts left from before a Reset(). Until m_generation catches up
+   * collect() ignores this shard, so a half cleared shard is never read.
+   */
+  void restart() {
+    int generation = s_generation;
+    const Files *files = m_files;
+    for (unsigned int id = 0; id < files->size(); id++) {
+      Lines *lines = (*files)[id];
+      if (lines) {
+        for (unsigned int i = 0; i < lines->size(); i++) {
+          atomic_store_relaxed((*lines)[i], 0);
+        }
+      }
     }
+    __sync_synchronize();
+    m_generation = generation;
+  }
+};
+
+IMPLEMENT_THREAD_LOCAL(CodeCoverage::Shard, CodeCoverage::s_shard);
+volatile int CodeCoverage::s_generation = 0;
+Mutex CodeCoverage::s_mutex;
+std::set<CodeCoverage::Shard*> CodeCoverage::s_shards;
+CodeCoverage::LineCounts CodeCoverage::s_retired;
+std::vector<const char *> CodeCoverage::s_files;
+hphp_const_char_map<int> CodeCoverage::s_fileIds;
+
+int CodeCoverage::GetFileId(const char *filename, const char *&interned) {
+  Lock lock(s_mutex);
+  hphp_const_char_map<int>::const_iterator iter = s_fileIds.find(filename);
+  if (iter != s_fileIds.end()) {
+    interned = iter->first;
+    return iter->second;
   }
+  interned = strdup(filename); // never freed, file names are few
+  int id = s_files.size();
+  s_files.push_back(interned);
+  s_fileIds[interned] = id;
+  return id;
 }
 
-Array CodeCoverage::Report() {
+void CodeCoverage::Collect(LineCounts &hits, vector<const char *> &files) {
   Lock lock(s_mutex);
+  add_hits(hits, s_retired);
+  for (set<Shard*>::const_iterator iter = s_shards.begin();
+       iter != s_shards.end(); ++iter) {
+    (*iter)->collect(hits);
+  }
+  files = s_files;
+}
+
+void CodeCoverage::Record(const char *filename, int line0, int line1) {
+  if (!filename || !*filename || line0 <= 0 || line1 <= 0 || line0 > line1) {
+    return;
+  }
+  s_shard->record(filename, line0, line1);
+}
+
+Array CodeCoverage::Report() {
+  LineCounts hits;
+  vector<const char *> files;
+  Collect(hits, files);
 
   Array ret = Array::Create();
-  for (CodeCoverageMap::const_iterator iter = s_hits.begin();
-       iter != s_hits.end(); ++iter) {
-    const vector<int> &lines = iter->second;
+  for (unsigned int id = 0; id < hits.size(); id++) {
+    const vector<int> &lines = hits[id];
+    if (lines.empty()) continue;
     Array tmp = Array::Create();
     for (int i = 1; i < (int)lines.size(); i++) {
       if (lines[i]) {
         tmp.set(i, Variant((int64)lines[i]));
       }
     }
-    ret.set(String(iter->first), Variant(tmp));
+    if (!tmp.empty()) {
+      ret.set(String(files[id]), Variant(tmp));
+    }
   }
 
   return ret;
 }
 
 void CodeCoverage::Report(const std::string &filename) {
-  Lock lock(s_mutex);
+  LineCounts hits;
+  vector<const char *> files;
+  Collect(hits, files);
 
   ofstream f(filename.c_str());
   if (!f) {
@@ -80,11 +256,19 @@ void CodeCoverage::Report(const std::string &filename) {
   }
 
   f << "{\n";
-  for (CodeCoverageMap::const_iterator iter = s_hits.begin();
-       iter != s_hits.end();) {
-    const vector<int> &lines = iter->second;
-    f << "\"" << iter->first << "\": [";
+  bool first = true;
+  for (unsigned int id = 0; id < hits.size(); id++) {
+    const vector<int> &lines = hits[id];
     int count = lines.size();
+    while (count > 0 && !lines[count - 1]) {
+      count--; // shards over-allocate, drop the zero tail
+    }
+    if (!count) continue;
+    if (!first) {
+      f << ",\n";
+    }
+    first = false;
+    f << "\"" << files[id] << "\": [";
     for (int i = 0 /* not 1 */; i < count; i++) {
       f << lines[i];
       if (i < count - 1) {
@@ -92,9 +276,8 @@ void CodeCoverage::Report(const std::string &filename) {
       }
     }
     f << "]";
-    if (++iter != s_hits.end()) {
-      f << ",";
-    }
+  }
+  if (!first) {
     f << "\n";
   }
   f << "}\n";
@@ -104,7 +287,8 @@ void CodeCoverage::Report(const std::string &filename) {
 
 void CodeCoverage::Reset() {
   Lock lock(s_mutex);
-  s_hits.clear();
+  s_retired.clear();
+  s_generation++; // each shard zeroes itself on its next Record()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19,10 +19,15 @@
 
 #include <runtime/base/complex_types.h>
 #include <util/lock.h>
+#include <util/thread_local.h>
 
 namespace HPHP { namespace Eval {
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * Line hits are counted in per-thread shards without taking any lock, and
+ * only merged when a report is asked for.
+ */
 class CodeCoverage {
 public:
   static void Record(const char *filename, int line0, int line1);
@@ -49,10 +54,23 @@ public:
   static void Reset();
 
 private:
-  typedef hphp_const_char_map<std::vector<int> > CodeCoverageMap;
+  class Shard;
+  typedef std::vector<std::vector<int> > LineCounts;
 
+  static DECLARE_THREAD_LOCAL(Shard, s_shard);
+
+  // bumped by Reset(), shards from older generations don't count
+  static volatile int s_generation;
+
+  // all below are guarded by s_mutex
   static Mutex s_mutex;
-  static CodeCoverageMap s_hits;
+  static std::set<Shard*> s_shards;
+  static LineCounts s_retired; // from threads that have exited
+  static std::vector<const char *> s_files; // interned names, by file id
+  static hphp_const_char_map<int> s_fileIds;
+
+  static int GetFileId(const char *filename, const char *&interned);
+  static void Collect(LineCounts &hits, std::vector<const char *> &files);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@
 #include <runtime/base/runtime_option.h>
 #include <util/async_job.h>
 #include <util/timer.h>
+#include <util/logger.h>
 #include <dlfcn.h>
 #include <runtime/base/program_functions.h>
 #include <runtime/base/builtin_functions.h>
@@ -250,6 +251,9 @@ public:
 
 static size_t s_const_map_size = 0;
 
+// how many threads each priming section may use to build its SharedVariants
+static int s_prime_threads = 1;
+
 void apc_load(int thread) {
   static void *handle = NULL;
   if (handle ||
@@ -259,6 +263,7 @@ void apc_load(int thread) {
   }
 
   Timer timer(Timer::WallTime, "loading APC data");
+  int before = s_apc_store[0].size();
   handle = dlopen(RuntimeOption::ApcPrimeLibrary.c_str(), RTLD_LAZY);
   if (!handle) {
     throw Exception("Unable to open apc prime library %s: %s",
@@ -270,14 +275,25 @@ void apc_load(int thread) {
   } else {
     int count = ((int(*)())apc_load_func(handle, "_apc_load_count"))();
 
+    // Threads that have no file of their own help build values in batches,
+    // so one big file doesn't keep the others waiting.
+    int workers = count < thread ? count : thread;
+    s_prime_threads = workers > 0 ? thread / workers : 1;
+
     ApcLoadJobPtrVec jobs;
     jobs.reserve(count);
     for (int i = 0; i < count; i++) {
       jobs.push_back(ApcLoadJobPtr(new ApcLoadJob(handle, i)));
     }
     JobDispatcher<ApcLoadJob, ApcLoadWorker>(jobs, thread).run();
+    s_prime_threads = 1;
   }
 
+  int primed = s_apc_store[0].size() - before;
+  double seconds = timer.getMicroSeconds() / 1000000.0;
+  Logger::Info("primed %d APC keys in %.3f seconds (%.0f keys/sec)",
+               primed, seconds, seconds > 0 ? primed / seconds : 0.0);
+
   for (set<string>::const_iterator iter =
          RuntimeOption::ApcCompletionKeys.begin();
        iter != RuntimeOption::ApcCompletionKeys.end(); ++iter) {
@@ -323,6 +339,110 @@ size_t get_const_map_size() {
 //define in ext_fb.cpp
 extern void const_load_set(CStrRef key, CVarRef value);
 
+///////////////////////////////////////////////////////////////////////////////
+// Bulk priming: a section's keys are collected first, then its values are
+// unserialized and turned into SharedVariants by batches on several threads,
+// and the whole section goes into the store with one prime() call.
+
+enum PrimeKind {
+  PrimeString,
+  PrimeObject,
+  PrimeThrift,
+  PrimeOther,
+};
+
+struct PrimeValue {
+  const char *data;
+  int len;
+};
+
+static const int PrimeBatchSize = 1024;
+
+static void prime_construct(SharedStore &s, SharedStore::KeyValuePair &item,
+                            PrimeKind kind, const PrimeValue &raw) {
+  String value(raw.data, raw.len, AttachLiteral);
+  switch (kind) {
+  case PrimeString:
+    // Strings would be copied into APC anyway.
+    value.checkStatic();
+    item.value = s.construct(item.key, item.len, value, false);
+    break;
+  case PrimeObject:
+    item.value = s.construct(item.key, item.len, value, true);
+    break;
+  case PrimeThrift: {
+    Variant success;
+    Variant v = f_fb_thrift_unserialize(value, ref(success));
+    if (same(success, false)) {
+      throw Exception("bad apc archive, f_fb_thrift_unserialize failed");
+    }
+    item.value = s.construct(item.key, item.len, v);
+    break;
+  }
+  case PrimeOther: {
+    Variant v = f_unserialize(value);
+    if (same(v, false)) {
+      // we can't possibly get here if it was a boolean "false" that's
+      // supposed to be serialized as a char
+      throw Exception("bad apc archive, f_unserialize failed");
+    }
+    item.value = s.construct(item.key, item.len, v);
+    break;
+  }
+  }
+}
+
+DECLARE_BOOST_TYPES(ApcPrimeJob);
+class ApcPrimeJob {
+public:
+  ApcPrimeJob(SharedStore &s, std::vector<SharedStore::KeyValuePair> &vars,
+              const std::vector<PrimeValue> &raws, PrimeKind kind,
+              int begin, int end)
+    : m_store(s), m_vars(vars), m_raws(raws), m_kind(kind),
+      m_begin(begin), m_end(end) {}
+
+  void run() {
+    for (int i = m_begin; i < m_end; i++) {
+      prime_construct(m_store, m_vars[i], m_kind, m_raws[i]);
+    }
+  }
+
+private:
+  SharedStore &m_store;
+  std::vector<SharedStore::KeyValuePair> &m_vars;
+  const std::vector<PrimeValue> &m_raws;
+  PrimeKind m_kind;
+  int m_begin;
+  int m_end;
+};
+
+class ApcPrimeWorker {
+public:
+  void onThreadEnter() {}
+  void doJob(ApcPrimeJobPtr job) { job->run(); }
+  void onThreadExit() {}
+};
+
+static void prime_section(SharedStore &s,
+                          std::vector<SharedStore::KeyValuePair> &vars,
+                          const std::vector<PrimeValue> &raws,
+                          PrimeKind kind) {
+  int count = vars.size();
+  if (s_prime_threads <= 1 || count <= PrimeBatchSize) {
+    ApcPrimeJob(s, vars, raws, kind, 0, count).run();
+  } else {
+    ApcPrimeJobPtrVec jobs;
+    jobs.reserve((count + PrimeBatchSize - 1) / PrimeBatchSize);
+    for (int i = 0; i < count; i += PrimeBatchSize) {
+      int end = i + PrimeBatchSize < count ? i + PrimeBatchSize : count;
+      jobs.push_back(ApcPrimeJobPtr(new ApcPrimeJob(s, vars, raws, kind,
+                                                    i, end)));
+    }
+    JobDispatcher<ApcPrimeJob, ApcPrimeWorker>(jobs, s_prime_threads).run();
+  }
+  s.prime(vars);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Constant and APC priming with uncompressed data
 // Note (qixin): this is going to be deprecated by the compressed version.
@@ -479,74 +599,64 @@ void apc_load_impl(struct cache_info *info,
     int count = count_items(strings, 4);
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       const char **p = strings;
       for (int i = 0; i < count; i++, p += 4) {
         SharedStore::KeyValuePair &item = vars[i];
         item.key = *p;
         item.len = (int)(int64)*(p+1);
-        // Strings would be copied into APC anyway.
-        String value(*(p+2), (int)(int64)*(p+3), AttachLiteral);
-        value.checkStatic();
-        item.value = s.construct(item.key, item.len, value, false);
+        raws[i].data = *(p+2);
+        raws[i].len = (int)(int64)*(p+3);
       }
-      s.prime(vars);
+      prime_section(s, vars, raws, PrimeString);
     }
   }
   {
     int count = count_items(objects, 4);
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       const char **p = objects;
       for (int i = 0; i < count; i++, p += 4) {
         SharedStore::KeyValuePair &item = vars[i];
         item.key = *p;
         item.len = (int)(int64)*(p+1);
-        String value(*(p+2), (int)(int64)*(p+3), AttachLiteral);
-        item.value = s.construct(item.key, item.len, value, true);
+        raws[i].data = *(p+2);
+        raws[i].len = (int)(int64)*(p+3);
       }
-      s.prime(vars);
+      prime_section(s, vars, raws, PrimeObject);
     }
   }
   {
     int count = count_items(thrifts, 4);
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       const char **p = thrifts;
       for (int i = 0; i < count; i++, p += 4) {
         SharedStore::KeyValuePair &item = vars[i];
         item.key = *p;
         item.len = (int)(int64)*(p+1);
-        String value(*(p+2), (int)(int64)*(p+3), AttachLiteral);
-        Variant success;
-        Variant v = f_fb_thrift_unserialize(value, ref(success));
-        if (same(success, false)) {
-          throw Exception("bad apc archive, f_fb_thrift_unserialize failed");
-        }
-        item.value = s.construct(item.key, item.len, v);
+        raws[i].data = *(p+2);
+        raws[i].len = (int)(int64)*(p+3);
       }
-      s.prime(vars);
+      prime_section(s, vars, raws, PrimeThrift);
     }
   }
   {
     int count = count_items(others, 4);
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       const char **p = others;
       for (int i = 0; i < count; i++, p += 4) {
         SharedStore::KeyValuePair &item = vars[i];
         item.key = *p;
         item.len = (int)(int64)*(p+1);
-
-        String value(*(p+2), (int)(int64)*(p+3), AttachLiteral);
-        Variant v = f_unserialize(value);
-        if (same(v, false)) {
-          // we can't possibly get here if it was a boolean "false" that's
-          // supposed to be serialized as a char
-          throw Exception("bad apc archive, f_unserialize failed");
-        }
-        item.value = s.construct(item.key, item.len, v);
+        raws[i].data = *(p+2);
+        raws[i].len = (int)(int64)*(p+3);
       }
-      s.prime(vars);
+      prime_section(s, vars, raws, PrimeOther);
     }
   }
 }
@@ -756,6 +866,7 @@ void apc_load_impl_compressed
     int len = string_lens[1];
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       char *decoded = gzdecode(strings, len);
       if (decoded == NULL) throw Exception("bad compressed apc archive.");
       String holder(decoded, len, AttachString);
@@ -765,14 +876,12 @@ void apc_load_impl_compressed
         item.key = p;
         item.len = string_lens[i + i + 2];
         p += string_lens[i + i + 2] + 1; // skip \0
-        // Strings would be copied into APC anyway.
-        String value(p, string_lens[i + i + 3], AttachLiteral);
-        value.checkStatic();
-        item.value = s.construct(item.key, item.len, value, false);
+        raws[i].data = p;
+        raws[i].len = string_lens[i + i + 3];
         p += string_lens[i + i + 3] + 1; // skip \0
       }
-      s.prime(vars);
       ASSERT((p - decoded) == len);
+      prime_section(s, vars, raws, PrimeString);
     }
   }
   {
@@ -780,6 +889,7 @@ void apc_load_impl_compressed
     int len = object_lens[1];
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       char *decoded = gzdecode(objects, len);
       if (decoded == NULL) throw Exception("bad compressed APC archive.");
       String holder(decoded, len, AttachString);
@@ -789,12 +899,12 @@ void apc_load_impl_compressed
         item.key = p;
         item.len = object_lens[i + i + 2];
         p += object_lens[i + i + 2] + 1; // skip \0
-        String value(p, object_lens[i + i + 3], AttachLiteral);
-        item.value = s.construct(item.key, item.len, value, true);
+        raws[i].data = p;
+        raws[i].len = object_lens[i + i + 3];
         p += object_lens[i + i + 3] + 1; // skip \0
       }
-      s.prime(vars);
       ASSERT((p - decoded) == len);
+      prime_section(s, vars, raws, PrimeObject);
     }
   }
   {
@@ -802,6 +912,7 @@ void apc_load_impl_compressed
     int len = thrift_lens[1];
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       char *decoded = gzdecode(thrifts, len);
       if (decoded == NULL) throw Exception("bad compressed apc archive.");
       String holder(decoded, len, AttachString);
@@ -811,17 +922,12 @@ void apc_load_impl_compressed
         item.key = p;
         item.len = thrift_lens[i + i + 2];
         p += thrift_lens[i + i + 2] + 1; // skip \0
-        String value(p, thrift_lens[i + i + 3], AttachLiteral);
-        Variant success;
-        Variant v = f_fb_thrift_unserialize(value, ref(success));
-        if (same(success, false)) {
-          throw Exception("bad apc archive, f_fb_thrift_unserialize failed");
-        }
-        item.value = s.construct(item.key, item.len, v);
+        raws[i].data = p;
+        raws[i].len = thrift_lens[i + i + 3];
         p += thrift_lens[i + i + 3] + 1; // skip \0
       }
-      s.prime(vars);
       ASSERT((p - decoded) == len);
+      prime_section(s, vars, raws, PrimeThrift);
     }
   }
   {
@@ -829,6 +935,7 @@ void apc_load_impl_compressed
     int len = other_lens[1];
     if (count) {
       vector<SharedStore::KeyValuePair> vars(count);
+      vector<PrimeValue> raws(count);
       char *decoded = gzdecode(others, len);
       if (decoded == NULL) throw Exception("bad compressed apc archive.");
       String holder(decoded, len, AttachString);
@@ -838,18 +945,12 @@ void apc_load_impl_compressed
         item.key = p;
         item.len = other_lens[i + i + 2];
         p += other_lens[i + i + 2] + 1; // skip \0
-        String value(p, other_lens[i + i + 3], AttachLiteral);
-        Variant v = f_unserialize(value);
-        if (same(v, false)) {
-          // we can't possibly get here if it was a boolean "false" that's
-          // supposed to be serialized as a char
-          throw Exception("bad apc archive, f_unserialize failed");
-        }
-        item.value = s.construct(item.key, item.len, v);
+        raws[i].data = p;
+        raws[i].len = other_lens[i + i + 3];
         p += other_lens[i + i + 3] + 1; // skip \0
       }
-      s.prime(vars);
       ASSERT((p - decoded) == len);
+      prime_section(s, vars, raws, PrimeOther);
     }
   }
 }
@@ -21,6 +21,10 @@
 #include <runtime/base/util/libevent_http_client.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/server/server_stats.h>
+#include <runtime/base/zend/zend_url.h>
+#include <util/network.h>
+#include <util/lock.h>
+#include <sys/epoll.h>
 
 using namespace std;
 
@@ -38,6 +42,80 @@ using namespace std;
 
 namespace HPHP {
 IMPLEMENT_DEFAULT_EXTENSION(curl);
+///////////////////////////////////////////////////////////////////////////////
+// process-wide share
+
+/**
+ * One CURLSH for the whole process. Every easy handle attaches to it, so
+ * DNS answers, SSL session ids and (when libcurl supports it) idle keep-alive
+ * connections outlive the request that created them and get reused by
+ * whichever thread talks to the same host next.
+ */
+class CurlShare {
+public:
+  CurlShare() : m_share(NULL), m_inited(false) {}
+  ~CurlShare() {
+    if (m_share) {
+      curl_share_cleanup(m_share);
+    }
+  }
+
+  void attach(CURL *cp) {
+    if (!RuntimeOption::HttpShareCurlHandles) return;
+    CURLSH *share = get();
+    if (share) {
+      curl_easy_setopt(cp, CURLOPT_SHARE, share);
+    }
+  }
+
+private:
+  CURLSH *m_share;
+  bool m_inited;
+  Mutex m_initLock;
+  Mutex m_locks[CURL_LOCK_DATA_LAST];
+
+  CURLSH *get() {
+    if (!m_inited) {
+      Lock lock(m_initLock);
+      if (!m_inited) {
+        m_share = create();
+        m_inited = true;
+      }
+    }
+    return m_share;
+  }
+
+  CURLSH *create() {
+    CURLSH *share = curl_share_init();
+    if (share == NULL) return NULL;
+    curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lock_cb);
+    curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlock_cb);
+    curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+#if LIBCURL_VERSION_NUM >= 0x071000
+    curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x073900
+    curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+    return share;
+  }
+
+  static void lock_cb(CURL *cp, curl_lock_data data, curl_lock_access access,
+                      void *userptr) {
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+      ((CurlShare*)userptr)->m_locks[data].lock();
+    }
+  }
+
+  static void unlock_cb(CURL *cp, curl_lock_data data, void *userptr) {
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+      ((CurlShare*)userptr)->m_locks[data].unlock();
+    }
+  }
+};
+static CurlShare s_curl_share;
+
 ///////////////////////////////////////////////////////////////////////////////
 // helper data structure
 
@@ -91,7 +169,7 @@ public:
   // overriding ResourceData
   virtual CStrRef o_getClassName() const { return s_class_name; }
 
-  CurlResource(CStrRef url) : m_emptyPost(true) {
+  CurlResource(CStrRef url) : m_resolve(NULL), m_emptyPost(true) {
     m_cp = curl_easy_init();
     m_url = url;
 
@@ -122,6 +200,7 @@ public:
                      RuntimeOption::HttpDefaultTimeout);
     curl_easy_setopt(m_cp, CURLOPT_CONNECTTIMEOUT,
                      RuntimeOption::HttpDefaultTimeout);
+    s_curl_share.attach(m_cp);
 
     if (!url.empty()) {
 #if LIBCURL_VERSION_NUM >= 0x071100
@@ -136,9 +215,13 @@ public:
     }
   }
 
-  CurlResource(CurlResource *src) {
+  CurlResource(CurlResource *src) : m_resolve(NULL) {
     ASSERT(src && src != this);
     m_cp = curl_easy_duphandle(src->get());
+#if LIBCURL_VERSION_NUM >= 0x071503
+    // the duplicate would point at src's list, which src frees on its own
+    curl_easy_setopt(m_cp, CURLOPT_RESOLVE, NULL);
+#endif
 
     memset(m_error_str, 0, sizeof(m_error_str));
     m_error_no = CURLE_OK;
@@ -174,13 +257,65 @@ public:
       curl_easy_cleanup(m_cp);
       m_cp = NULL;
     }
+    if (m_resolve) {
+      curl_slist_free_all(m_resolve);
+      m_resolve = NULL;
+    }
+    m_pinned.clear();
     m_to_free.reset();
   }
 
+  /**
+   * Hands curl an address from the process-wide DNS cache, so the transfer
+   * never has to resolve the name on the request thread by itself.
+   *
+   * CURLOPT_RESOLVE entries are pinned in curl's DNS cache and never expire,
+   * so the one pinned by the previous transfer is removed first ("-host:port")
+   * and the handle only ever holds one list: DnsCache's TTLs stay in charge.
+   */
+  void resolveHost() {
+#if LIBCURL_VERSION_NUM >= 0x071503
+    if (m_cp == NULL) return;
+    string pin, entry;
+    Url url;
+    if (Util::DnsCache::Enabled && !m_url.empty() &&
+        url_parse(url, m_url.data(), m_url.size()) && url.host) {
+      int port = url.port;
+      if (port == 0) {
+        if (url.scheme == NULL || strcasecmp(url.scheme, "http") == 0) {
+          port = 80;
+        } else if (url.scheme && strcasecmp(url.scheme, "https") == 0) {
+          port = 443;
+        }
+      }
+      string ip;
+      if (port) ip = Util::DnsCache::ResolveToIP(url.host);
+      if (!ip.empty() && ip != url.host) {
+        pin = string(url.host) + ":" + boost::lexical_cast<string>(port);
+        entry = pin + ":" + ip;
+      }
+    }
+    if (entry.empty() && m_pinned.empty()) return;
+
+    curl_slist *slist = NULL;
+    if (!m_pinned.empty()) {
+      slist = curl_slist_append(slist, ("-" + m_pinned).c_str());
+    }
+    if (!entry.empty()) {
+      slist = curl_slist_append(slist, entry.c_str());
+    }
+    curl_easy_setopt(m_cp, CURLOPT_RESOLVE, slist);
+    if (m_resolve) curl_slist_free_all(m_resolve);
+    m_resolve = slist;
+    m_pinned = pin;
+#endif
+  }
+
   Variant execute() {
     if (m_cp == NULL) {
       return false;
     }
+    resolveHost();
     if (m_emptyPost) {
       // As per curl docs, an empty post must set POSTFIELDSIZE to be 0 or
       // the reader function will be called
@@ -641,6 +776,8 @@ private:
   CURLcode m_error_no;
 
   ToFreePtr m_to_free;
+  curl_slist *m_resolve; // CURLOPT_RESOLVE list set by resolveHost()
+  std::string m_pinned;  // host:port it pinned in curl's DNS cache
 
   String m_url;
   String m_header;
@@ -899,8 +1036,17 @@ public:
   // overriding ResourceData
   CStrRef o_getClassName() const { return s_class_name; }
 
-  CurlMultiResource() {
+  CurlMultiResource() : m_epfd(-1), m_deadline(-1) {
     m_multi = curl_multi_init();
+    // libcurl only announces a socket once, so the callbacks have to be in
+    // place before the first curl_multi_exec() opens any
+    m_epfd = epoll_create(16);
+    if (m_epfd >= 0) {
+      curl_multi_setopt(m_multi, CURLMOPT_SOCKETFUNCTION, socket_cb);
+      curl_multi_setopt(m_multi, CURLMOPT_SOCKETDATA, this);
+      curl_multi_setopt(m_multi, CURLMOPT_TIMERFUNCTION, timer_cb);
+      curl_multi_setopt(m_multi, CURLMOPT_TIMERDATA, this);
+    }
   }
 
   ~CurlMultiResource() {
@@ -913,6 +1059,11 @@ public:
       m_easyh.clear();
       m_multi = NULL;
     }
+    if (m_epfd >= 0) {
+      ::close(m_epfd);
+      m_epfd = -1;
+    }
+    m_done.clear();
   }
 
   void add(CObjRef ch) {
@@ -920,6 +1071,12 @@ public:
   }
 
   void remove(CurlResource *curle) {
+    for (unsigned int i = 0; i < m_done.size(); i++) {
+      if (m_done[i].easy == curle->get()) {
+        m_done.erase(m_done.begin() + i);
+        break;
+      }
+    }
     for (ArrayIter iter(m_easyh); iter; ++iter) {
       if (toObject(iter.second()).getTyped<CurlResource>()->get(true) ==
           curle->get()) {
@@ -945,16 +1102,169 @@ public:
     return m_multi;
   }
 
+  /**
+   * Completion messages are pulled off libcurl's queue eagerly, so await()
+   * can tell whether anything finished without consuming it on the caller's
+   * behalf. curl_multi_info_read() hands them out from here.
+   */
+  class DoneMsg {
+  public:
+    CURLMSG  msg;
+    CURL    *easy;
+    CURLcode result;
+  };
+
+  void collectDone() {
+    int queued;
+    CURLMsg *msg;
+    while ((msg = curl_multi_info_read(get(), &queued)) != NULL) {
+      DoneMsg done;
+      done.msg = msg->msg;
+      done.easy = msg->easy_handle;
+      done.result = msg->data.result;
+      m_done.push_back(done);
+    }
+  }
+
+  bool popDone(DoneMsg &done) {
+    collectDone();
+    if (m_done.empty()) return false;
+    done = m_done.front();
+    m_done.pop_front();
+    return true;
+  }
+
+  int doneCount() const { return m_done.size(); }
+
+  /**
+   * What curl_multi_exec() does: one pass over whatever is ready, without
+   * blocking. Once the socket callbacks are installed, libcurl must only be
+   * driven through curl_multi_socket_action(), never curl_multi_perform().
+   */
+  CURLMcode exec(int &running) {
+    if (m_epfd < 0) {
+      return curl_multi_perform(get(), &running);
+    }
+    CURLMcode ret = onTimeout(running); // also starts newly added handles
+    if (ret == CURLM_OK && drive(0, running) < 0) {
+      ret = CURLM_INTERNAL_ERROR;
+    }
+    return ret;
+  }
+
+  /**
+   * Drives all transfers from an epoll set that libcurl keeps up to date
+   * through its socket callback, returning as soon as at least one of them
+   * has completed, nothing is left running, or timeout_ms has passed.
+   */
+  int await(int timeout_ms) {
+    if (m_epfd < 0) return -1;
+
+    int running = 0;
+    collectDone();
+    if (m_done.empty()) {
+      // starts any handle added since the last exec() or await()
+      onTimeout(running);
+      collectDone();
+    }
+
+    int64 end = NowMs() + timeout_ms;
+    while (m_done.empty() && running > 0) {
+      int64 now = NowMs();
+      int64 wait = end - now;
+      if (wait <= 0) break;
+      if (m_deadline >= 0 && m_deadline - now < wait) {
+        wait = m_deadline > now ? m_deadline - now : 0;
+      }
+      if (drive(wait, running) < 0) {
+        return -1;
+      }
+    }
+    return m_done.size();
+  }
+
 private:
   int m_still_running;
   CURLM *m_multi;
   Array m_easyh;
+  int m_epfd;
+  int64 m_deadline; // when libcurl's timer fires, in NowMs() time, or -1
+  deque<DoneMsg> m_done;
+
+  static int64 NowMs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+  }
+
+  CURLMcode onTimeout(int &running) {
+    if (m_deadline >= 0 && NowMs() >= m_deadline) {
+      m_deadline = -1; // one-shot, libcurl sets the next one if it needs to
+    }
+    return curl_multi_socket_action(m_multi, CURL_SOCKET_TIMEOUT, 0,
+                                    &running);
+  }
+
+  /**
+   * Waits up to wait_ms for socket activity, then lets libcurl act on it
+   * and on its timer if that is due. Returns -1 if epoll failed.
+   */
+  int drive(int wait_ms, int &running) {
+    epoll_event events[64];
+    int n = epoll_wait(m_epfd, events, sizeof(events) / sizeof(events[0]),
+                       wait_ms);
+    if (n < 0) {
+      return errno == EINTR ? 0 : -1;
+    }
+    for (int i = 0; i < n; i++) {
+      int mask = 0;
+      if (events[i].events & (EPOLLIN | EPOLLHUP)) mask |= CURL_CSELECT_IN;
+      if (events[i].events & EPOLLOUT) mask |= CURL_CSELECT_OUT;
+      if (events[i].events & EPOLLERR) mask |= CURL_CSELECT_ERR;
+      curl_multi_socket_action(m_multi, events[i].data.fd, mask, &running);
+    }
+    if (m_deadline >= 0 && NowMs() >= m_deadline) {
+      onTimeout(running);
+    }
+    collectDone();
+    return n;
+  }
+
+  static int socket_cb(CURL *cp, curl_socket_t s, int what, void *userp,
+                       void *socketp) {
+    CurlMultiResource *curlm = (CurlMultiResource*)userp;
+    if (what == CURL_POLL_REMOVE) {
+      // the socket may already be closed, in which case epoll dropped it
+      epoll_ctl(curlm->m_epfd, EPOLL_CTL_DEL, s, NULL);
+      return 0;
+    }
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.data.fd = s;
+    if (what & CURL_POLL_IN) ev.events |= EPOLLIN;
+    if (what & CURL_POLL_OUT) ev.events |= EPOLLOUT;
+    if (epoll_ctl(curlm->m_epfd, EPOLL_CTL_MOD, s, &ev) < 0 &&
+        errno == ENOENT) {
+      epoll_ctl(curlm->m_epfd, EPOLL_CTL_ADD, s, &ev);
+    }
+    return 0;
+  }
+
+  static int timer_cb(CURLM *multi, long timeout_ms, void *userp) {
+    // relative to now, but await() may wait more than once before it fires
+    ((CurlMultiResource*)userp)->m_deadline =
+      timeout_ms < 0 ? -1 : NowMs() + timeout_ms;
+    return 0;
+  }
 };
 IMPLEMENT_OBJECT_ALLOCATION_NO_DEFAULT_SWEEP(CurlMultiResource);
 void CurlMultiResource::sweep() {
   if (m_multi) {
     curl_multi_cleanup(m_multi);
   }
+  if (m_epfd >= 0) {
+    ::close(m_epfd);
+  }
 }
 
 StaticString CurlMultiResource::s_class_name("cURL Multi Handle");
@@ -976,6 +1286,7 @@ Variant f_curl_multi_add_handle(CObjRef mh, CObjRef ch) {
   CHECK_MULTI_RESOURCE(curlm);
   CurlResource *curle = ch.getTyped<CurlResource>();
   curlm->add(ch);
+  curle->resolveHost();
   return curl_multi_add_handle(curlm->get(), curle->get());
 }
 
@@ -990,7 +1301,7 @@ Variant f_curl_multi_exec(CObjRef mh, Variant still_running) {
   CHECK_MULTI_RESOURCE(curlm);
   int running = still_running.toInt32();
   IOStatusHelper io("curl_multi_exec");
-  int result = curl_multi_perform(curlm->get(), &running);
+  int result = curlm->exec(running);
   still_running = running;
   return result;
 }
@@ -1013,23 +1324,28 @@ Variant f_curl_multi_info_read(CObjRef mh,
                                Variant msgs_in_queue /* = null */) {
   CHECK_MULTI_RESOURCE(curlm);
 
-  int queued_msgs;
-  CURLMsg *tmp_msg = curl_multi_info_read(curlm->get(), &queued_msgs);
-  if (tmp_msg == NULL) {
+  CurlMultiResource::DoneMsg done;
+  if (!curlm->popDone(done)) {
     return false;
   }
-  msgs_in_queue = queued_msgs;
+  msgs_in_queue = curlm->doneCount();
 
   Array ret;
-  ret.set("msg", tmp_msg->msg);
-  ret.set("result", tmp_msg->data.result);
-  Object curle = curlm->find(tmp_msg->easy_handle);
+  ret.set("msg", done.msg);
+  ret.set("result", done.result);
+  Object curle = curlm->find(done.easy);
   if (!curle.isNull()) {
     ret.set("handle", curle);
   }
   return ret;
 }
 
+Variant f_curl_multi_await(CObjRef mh, double timeout /* = 1.0 */) {
+  CHECK_MULTI_RESOURCE(curlm);
+  IOStatusHelper io("curl_multi_await");
+  return curlm->await((int)(timeout * 1000.0));
+}
+
 Variant f_curl_multi_close(CObjRef mh) {
   CHECK_MULTI_RESOURCE(curlm);
   curlm->close();
@@ -43,6 +43,7 @@ Variant f_curl_multi_add_handle(CObjRef mh, CObjRef ch);
 Variant f_curl_multi_remove_handle(CObjRef mh, CObjRef ch);
 Variant f_curl_multi_exec(CObjRef mh, Variant still_running);
 Variant f_curl_multi_select(CObjRef mh, double timeout = 1.0);
+Variant f_curl_multi_await(CObjRef mh, double timeout = 1.0);
 Variant f_curl_multi_getcontent(CObjRef ch);
 Variant f_curl_multi_info_read(CObjRef mh, Variant msgs_in_queue = null);
 Variant f_curl_multi_close(CObjRef mh);
@@ -25,8 +25,11 @@
 #include <runtime/base/util/extended_logger.h>
 #include <util/timer.h>
 #include <util/db_mysql.h>
+#include <util/network.h>
 #include <netinet/in.h>
 #include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
 
 using namespace std;
 
@@ -109,11 +112,18 @@ public:
   }
 
   virtual void requestShutdown() {
+    // a persistent link outlives the request; don't hand it to the next one
+    // with an unread result still on the wire
+    for (ArrayIter iter(asyncConns); iter; ++iter) {
+      iter.second().toObject().getTyped<MySQL>()->discardAsync();
+    }
+    asyncConns.reset();
     defaultConn.reset();
     totalRowCount = 0;
   }
 
   Object defaultConn;
+  Array asyncConns; // links that had mysql_async_query() sent on them
   int readTimeout;
   int totalRowCount; // from all queries in current request
 };
@@ -142,6 +152,10 @@ MYSQL *MySQL::GetConn(CVarRef link_identifier, MySQL **rconn /* = NULL */) {
   }
   if (ret == NULL) {
     raise_warning("supplied argument is not a valid MySQL-Link resource");
+  } else {
+    // every API that talks to the server comes through here; an unread
+    // async result would make it fail with "Commands out of sync"
+    mySQL->discardAsync();
   }
   if (rconn) {
     *rconn = mySQL;
@@ -228,7 +242,8 @@ static MYSQL *create_new_conn() {
 MySQL::MySQL(const char *host, int port, const char *username,
              const char *password, const char *database)
     : m_port(port), m_last_error_set(false), m_last_errno(0),
-      m_xaction_count(0) {
+      m_xaction_count(0), m_async_pending(false), m_async_sent(false),
+      m_async_xaction(0), m_async_start(0) {
   if (host) m_host = host;
   if (username) m_username = username;
   if (password) m_password = password;
@@ -255,12 +270,39 @@ void MySQL::close() {
     m_last_error_set = false;
     m_last_errno = 0;
     m_xaction_count = 0;
+    m_async_pending = false;
     m_last_error.clear();
     mysql_close(m_conn);
     m_conn = NULL;
   }
 }
 
+void MySQL::discardAsync() {
+  if (!m_async_pending) return;
+  m_async_pending = false;
+  if (m_async_sent && m_conn) {
+    raise_warning("runtime/ext_mysql: discarding result of async query [%s]",
+                  m_async_query.c_str());
+    if (!mysql_read_query_result(m_conn)) {
+      MYSQL_RES *res = mysql_store_result(m_conn);
+      if (res) mysql_free_result(res);
+    }
+  }
+}
+
+/**
+ * "localhost" tells libmysqlclient to use the unix socket; any other name is
+ * resolved through the shared DNS cache instead of inside mysql_real_connect.
+ */
+static std::string resolve_host(const char *host) {
+  if (!Util::DnsCache::Enabled || host == NULL || *host == '\0' ||
+      strcasecmp(host, "localhost") == 0) {
+    return host ? host : "";
+  }
+  std::string ip = Util::DnsCache::ResolveToIP(host);
+  return ip.empty() ? host : ip; // let libmysqlclient report the failure
+}
+
 bool MySQL::connect(CStrRef host, int port, CStrRef socket, CStrRef username,
                     CStrRef password, CStrRef database,
                     int client_flags, int connect_timeout) {
@@ -276,8 +318,8 @@ bool MySQL::connect(CStrRef host, int port, CStrRef socket, CStrRef username,
   }
   IOStatusHelper io("mysql::connect", host.data(), port);
   m_xaction_count = 0;
-  bool ret = mysql_real_connect(m_conn, host.data(), username.data(),
-                            password.data(),
+  bool ret = mysql_real_connect(m_conn, resolve_host(host.data()).c_str(),
+                            username.data(), password.data(),
                             (database.empty() ? NULL : database.data()),
                             port,
                             socket.empty() ? NULL : socket.data(),
@@ -306,12 +348,13 @@ bool MySQL::reconnect(CStrRef host, int port, CStrRef socket, CStrRef username,
       ServerStats::Log("sql.reconn_new", 1);
     }
     IOStatusHelper io("mysql::connect", host.data(), port);
-    return mysql_real_connect(m_conn, host.data(), username.data(),
-                              password.data(),
+    return mysql_real_connect(m_conn, resolve_host(host.data()).c_str(),
+                              username.data(), password.data(),
                               (database.empty() ? NULL : database.data()),
                               port, socket.data(), client_flags);
   }
 
+  discardAsync();
   if (!mysql_ping(m_conn)) {
     if (RuntimeOption::EnableStats && RuntimeOption::EnableSQLStats) {
       ServerStats::Log("sql.reconn_ok", 1);
@@ -331,8 +374,8 @@ bool MySQL::reconnect(CStrRef host, int port, CStrRef socket, CStrRef username,
   }
   IOStatusHelper io("mysql::connect", host.data(), port);
   m_xaction_count = 0;
-  return mysql_real_connect(m_conn, host.data(), username.data(),
-                            password.data(),
+  return mysql_real_connect(m_conn, resolve_host(host.data()).c_str(),
+                            username.data(), password.data(),
                             (database.empty() ? NULL : database.data()),
                             port, socket.data(), client_flags);
 }
@@ -786,19 +829,29 @@ static Variant php_mysql_localize_result(MYSQL *mysql) {
   return result;
 }
 
-static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
-                                          bool use_store) {
+static int64 php_mysql_now_usec() {
+  timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static bool php_mysql_read_only_skip(CStrRef query) {
   if (RuntimeOption::MySQLReadOnly &&
       same(f_preg_match("/^((\\/\\*.*?\\*\\/)|\\(|\\s)*select/i", query), 0)) {
     raise_notice("runtime/ext_mysql: write query not executed [%s]",
                     query.data());
     return true; // pretend it worked
   }
+  return false;
+}
 
-  MySQL *rconn = NULL;
-  MYSQL *conn = MySQL::GetConn(link_id, &rconn);
-  if (!conn || !rconn) return false;
-
+/**
+ * Logs query counters and, when table stats are on, fills in what
+ * MySqlStats::RecordTime() needs once the query has finished.
+ */
+static void php_mysql_record_stats(CStrRef query, MySQL *rconn,
+                                   string &verb, string &table,
+                                   int &xaction) {
   if (RuntimeOption::EnableStats && RuntimeOption::EnableSQLStats) {
     ServerStats::Log("sql.query", 1);
 
@@ -816,13 +869,14 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
                  q, ref(matches));
     int size = matches.toArray().size();
     if (size > 2) {
-      string verb = Util::toLower(matches[size - 2].toString().data());
-      string table = Util::toLower(matches[size - 1].toString().data());
+      verb = Util::toLower(matches[size - 2].toString().data());
+      table = Util::toLower(matches[size - 1].toString().data());
       if (!table.empty() && table[0] == '`') {
         table = table.substr(1, table.length() - 2);
       }
       ServerStats::Log(string("sql.query.") + table + "." + verb, 1);
       if (RuntimeOption::EnableStats && RuntimeOption::EnableSQLTableStats) {
+        xaction = rconn->m_xaction_count;
         MySqlStats::Record(verb, rconn->m_xaction_count, table);
         if (verb == "update") {
           f_preg_match("([^\\s,]+)\\s*=\\s*([^\\s,]+)[\\+\\-]",
@@ -836,6 +890,8 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
         if (rconn->m_xaction_count) {
           ++rconn->m_xaction_count;
         }
+      } else {
+        verb.clear();
       }
     } else {
       f_preg_match("/^(?:(?:\\/\\*.*?\\*\\/)|\\(|\\s)*"
@@ -843,11 +899,13 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
                    query, ref(matches));
       size = matches.toArray().size();
       if (size == 2) {
-        string verb = Util::toLower(matches[1].toString().data());
-        rconn->m_xaction_count = ((verb == "begin") ? 1 : 0);
-        ServerStats::Log(string("sql.query.") + verb, 1);
+        string v = Util::toLower(matches[1].toString().data());
+        rconn->m_xaction_count = ((v == "begin") ? 1 : 0);
+        ServerStats::Log(string("sql.query.") + v, 1);
         if (RuntimeOption::EnableStats && RuntimeOption::EnableSQLTableStats) {
-          MySqlStats::Record(verb);
+          MySqlStats::Record(v);
+          verb = v;
+          xaction = 0;
         }
       } else {
         raise_warning("Unable to record MySQL stats with: %s", query.data());
@@ -855,12 +913,67 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
       }
     }
   }
+}
+
+static Variant php_mysql_get_result(MYSQL *conn, CStrRef query,
+                                    bool use_store) {
+  MYSQL_RES *mysql_result;
+  if (use_store) {
+    if (RuntimeOption::MySQLLocalize) {
+      return php_mysql_localize_result(conn);
+    }
+    mysql_result = mysql_store_result(conn);
+  } else {
+    mysql_result = mysql_use_result(conn);
+  }
+  if (!mysql_result) {
+    if (mysql_field_count(conn) > 0) {
+      raise_warning("Unable to save result set");
+      return false;
+    }
+    return true;
+  }
+
+  MySQLResult *r = NEW(MySQLResult)(mysql_result);
+  Object ret(r);
+
+  if (RuntimeOption::MaxSQLRowCount > 0 &&
+      (s_mysql_data->totalRowCount += r->getRowCount())
+      > RuntimeOption::MaxSQLRowCount) {
+    ExtendedLogger::Error
+      ("MaxSQLRowCount is over: fetching at least %d rows: %s",
+       s_mysql_data->totalRowCount, query.data());
+    s_mysql_data->totalRowCount = 0; // so no repetitive logging
+  }
+
+  return ret;
+}
+
+static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
+                                          bool use_store) {
+  if (php_mysql_read_only_skip(query)) {
+    return true;
+  }
+
+  MySQL *rconn = NULL;
+  MYSQL *conn = MySQL::GetConn(link_id, &rconn);
+  if (!conn || !rconn) return false;
+
+  string verb, table;
+  int xaction = 0;
+  php_mysql_record_stats(query, rconn, verb, table, xaction);
 
   SlowTimer timer(RuntimeOption::MySQLSlowQueryThreshold,
                   "runtime/ext_mysql: slow query", query.data());
   IOStatusHelper io("mysql::query", rconn->m_host.c_str(), rconn->m_port);
   unsigned long tid = mysql_thread_id(conn);
-  if (mysql_real_query(conn, query.data(), query.size())) {
+  int64 start = php_mysql_now_usec();
+  bool failed = mysql_real_query(conn, query.data(), query.size());
+  if (!verb.empty()) {
+    MySqlStats::RecordTime(verb, xaction, table,
+                           php_mysql_now_usec() - start);
+  }
+  if (failed) {
     raise_notice("runtime/ext_mysql: failed executing [%s] [%s]", query.data(),
                  mysql_error(conn));
 
@@ -879,7 +992,8 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
           IOStatusHelper io("mysql::kill", rconn->m_host.c_str(),
                             rconn->m_port);
           MYSQL *connected = mysql_real_connect
-            (new_conn, rconn->m_host.c_str(), rconn->m_username.c_str(),
+            (new_conn, resolve_host(rconn->m_host.c_str()).c_str(),
+             rconn->m_username.c_str(),
              rconn->m_password.c_str(), NULL, rconn->m_port, NULL, 0);
           if (connected) {
             string killsql = "KILL " + boost::lexical_cast<string>(tid);
@@ -897,36 +1011,7 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
   Logger::Verbose("runtime/ext_mysql: successfully executed [%dms] [%s]",
                   (int)timer.getTime(), query.data());
 
-  MYSQL_RES *mysql_result;
-  if (use_store) {
-    if (RuntimeOption::MySQLLocalize) {
-      return php_mysql_localize_result(conn);
-    }
-    mysql_result = mysql_store_result(conn);
-  } else {
-    mysql_result = mysql_use_result(conn);
-  }
-  if (!mysql_result) {
-    if (mysql_field_count(conn) > 0) {
-      raise_warning("Unable to save result set");
-      return false;
-    }
-    return true;
-  }
-
-  MySQLResult *r = NEW(MySQLResult)(mysql_result);
-  Object ret(r);
-
-  if (RuntimeOption::MaxSQLRowCount > 0 &&
-      (s_mysql_data->totalRowCount += r->getRowCount())
-      > RuntimeOption::MaxSQLRowCount) {
-    ExtendedLogger::Error
-      ("MaxSQLRowCount is over: fetching at least %d rows: %s",
-       s_mysql_data->totalRowCount, query.data());
-    s_mysql_data->totalRowCount = 0; // so no repetitive logging
-  }
-
-  return ret;
+  return php_mysql_get_result(conn, query, use_store);
 }
 
 Variant f_mysql_query(CStrRef query, CVarRef link_identifier /* = null */) {
@@ -938,6 +1023,175 @@ Variant f_mysql_unbuffered_query(CStrRef query,
   return php_mysql_do_query_general(query, link_identifier, false);
 }
 
+bool f_mysql_async_query(CStrRef query, CVarRef link_identifier /* = null */) {
+  MySQL *rconn = NULL;
+  MYSQL *conn = MySQL::GetConn(link_identifier, &rconn);
+  if (!conn || !rconn) return false;
+
+  rconn->m_async_query = string(query.data(), query.size());
+  rconn->m_async_verb.clear();
+  rconn->m_async_table.clear();
+  rconn->m_async_xaction = 0;
+  if (php_mysql_read_only_skip(query)) {
+    rconn->m_async_pending = true;
+    rconn->m_async_sent = false;
+    return true;
+  }
+
+  php_mysql_record_stats(query, rconn, rconn->m_async_verb,
+                         rconn->m_async_table, rconn->m_async_xaction);
+
+  IOStatusHelper io("mysql::async_query", rconn->m_host.c_str(),
+                    rconn->m_port);
+  rconn->m_async_start = php_mysql_now_usec();
+  if (mysql_send_query(conn, query.data(), query.size())) {
+    raise_notice("runtime/ext_mysql: failed sending [%s] [%s]", query.data(),
+                 mysql_error(conn));
+    return false;
+  }
+  rconn->m_async_pending = true;
+  rconn->m_async_sent = true;
+  s_mysql_data->asyncConns.set((int64)(intptr_t)rconn, Object(rconn));
+  return true;
+}
+
+/**
+ * Whether the whole response to an async query is already in the socket
+ * buffer, so mysql_read_query_result() won't stall on a half-sent result.
+ * Otherwise sets *avail to how many bytes are there so far.
+ */
+static bool php_mysql_async_complete(MYSQL *conn, int *avail) {
+  *avail = 0;
+  if (conn->net.compress || mysql_get_ssl_cipher(conn)) {
+    return true; // can't parse the packets from outside the client library
+  }
+  char buf[16384];
+  int n = recv(conn->net.fd, buf, sizeof(buf), MSG_PEEK | MSG_DONTWAIT);
+  if (n < 0 && (errno == EAGAIN || errno == EINTR)) return false;
+  if (n <= 0) return true; // let the client library report the error
+  if (n == (int)sizeof(buf)) return true; // large result already streaming
+  *avail = n;
+
+  // OK, error and LOCAL INFILE responses are one packet; a result set ends
+  // with its second EOF packet (or an error packet in the middle of rows)
+  const unsigned char *p = (const unsigned char *)buf;
+  int eofs = 0;
+  for (int pos = 0; pos + 4 <= n; ) {
+    int len = p[pos] | (p[pos + 1] << 8) | (p[pos + 2] << 16);
+    if (pos + 4 + len > n) return false;
+    unsigned char type = len ? p[pos + 4] : 0;
+    if (pos == 0) {
+      if (type == 0x00 || type == 0xff || type == 0xfb) return true;
+    } else if (type == 0xff) {
+      return true;
+    } else if (type == 0xfe && len < 9 && ++eofs == 2) {
+      return true;
+    }
+    pos += 4 + len;
+  }
+  return false;
+}
+
+static Variant php_mysql_async_finish(MySQL *rconn) {
+  MYSQL *conn = rconn->get();
+  String query(rconn->m_async_query);
+  rconn->m_async_pending = false;
+
+  int lowat = 1;
+  setsockopt(conn->net.fd, SOL_SOCKET, SO_RCVLOWAT, &lowat, sizeof(lowat));
+
+  bool failed = mysql_read_query_result(conn);
+  int64 elapsed = php_mysql_now_usec() - rconn->m_async_start;
+  if (!rconn->m_async_verb.empty()) {
+    MySqlStats::RecordTime(rconn->m_async_verb, rconn->m_async_xaction,
+                           rconn->m_async_table, elapsed);
+  }
+  if (elapsed / 1000 >= RuntimeOption::MySQLSlowQueryThreshold) {
+    Logger::Error("SlowTimer [%dms] at runtime/ext_mysql: slow query: %s",
+                  (int)(elapsed / 1000), query.data());
+  }
+  if (failed) {
+    raise_notice("runtime/ext_mysql: failed executing [%s] [%s]", query.data(),
+                 mysql_error(conn));
+    return false;
+  }
+  Logger::Verbose("runtime/ext_mysql: successfully executed [%dms] [%s]",
+                  (int)(elapsed / 1000), query.data());
+  return php_mysql_get_result(conn, query, true);
+}
+
+Variant f_mysql_async_wait(CArrRef links, double timeout /* = 1.0 */) {
+  Array ret = Array::Create();
+  vector<pollfd> fds;
+  vector<Variant> keys;
+  vector<MySQL*> conns;
+  for (ArrayIter iter(links); iter; ++iter) {
+    // not GetConn(), which would discard the very results we're waiting for
+    MySQL *rconn = MySQL::Get(iter.second());
+    MYSQL *conn = rconn ? rconn->get() : NULL;
+    if (!conn || !rconn->m_async_pending) continue;
+    if (!rconn->m_async_sent) {
+      rconn->m_async_pending = false;
+      ret.set(iter.first(), true);
+      continue;
+    }
+    pollfd fd;
+    fd.fd = conn->net.fd;
+    fd.events = POLLIN;
+    fd.revents = 0;
+    fds.push_back(fd);
+    keys.push_back(iter.first());
+    conns.push_back(rconn);
+  }
+  if (!ret.empty() || fds.empty()) {
+    return ret;
+  }
+
+  // A readable socket may only hold the start of a result, and reading the
+  // rest through the client library would block. Until the whole response
+  // is buffered, raise the socket's low-water mark past what has arrived so
+  // poll() sleeps until more comes in, rather than spinning on it.
+  int64 deadline = php_mysql_now_usec() + (int64)(timeout * 1000000.0);
+  bool failed = false;
+  while (true) {
+    int64 remaining = deadline - php_mysql_now_usec();
+    if (remaining < 0) remaining = 0;
+    int n;
+    {
+      IOStatusHelper io("mysql::async_wait");
+      n = poll(&fds[0], fds.size(), (int)(remaining / 1000));
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0) {
+      raise_warning("runtime/ext_mysql: poll() failed: %s",
+                    Util::safe_strerror(errno).c_str());
+      failed = true;
+      break;
+    }
+    for (unsigned int i = 0; i < fds.size(); i++) {
+      if (!fds[i].revents) continue;
+      int avail;
+      if ((fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) ||
+          php_mysql_async_complete(conns[i]->get(), &avail)) {
+        ret.set(keys[i], php_mysql_async_finish(conns[i]));
+        fds[i].fd = -1; // poll() skips negative descriptors
+      } else {
+        int lowat = avail + 1;
+        setsockopt(fds[i].fd, SOL_SOCKET, SO_RCVLOWAT, &lowat, sizeof(lowat));
+      }
+    }
+    if (!ret.empty() || remaining == 0) break;
+  }
+  for (unsigned int i = 0; i < fds.size(); i++) {
+    if (fds[i].fd >= 0) {
+      int lowat = 1;
+      setsockopt(fds[i].fd, SOL_SOCKET, SO_RCVLOWAT, &lowat, sizeof(lowat));
+    }
+  }
+  if (failed) return false;
+  return ret;
+}
+
 Variant f_mysql_list_dbs(CVarRef link_identifier /* = null */) {
   MYSQL *conn = MySQL::GetConn(link_identifier);
   if (!conn) return false;
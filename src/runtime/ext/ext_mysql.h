@@ -108,6 +108,13 @@ public:
 
   MYSQL *get() { return m_conn;}
 
+  /**
+   * Reads back and throws away the result of a query mysql_async_query()
+   * sent but nobody waited for, so the connection can take a new command.
+   * GetConn(), reconnect() and request shutdown all call this.
+   */
+  void discardAsync();
+
 private:
   MYSQL *m_conn;
 
@@ -121,6 +128,16 @@ public:
   int m_last_errno;
   std::string m_last_error;
   int m_xaction_count;
+
+  // a query sent by mysql_async_query() that mysql_async_wait() hasn't
+  // collected yet
+  bool m_async_pending;
+  bool m_async_sent;     // false when read-only mode skipped the query
+  std::string m_async_query;
+  std::string m_async_verb;
+  std::string m_async_table;
+  int m_async_xaction;
+  int64 m_async_start;   // in microseconds
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -339,6 +356,8 @@ Variant f_mysql_query(CStrRef query, CVarRef link_identifier = null);
 
 Variant f_mysql_unbuffered_query(CStrRef query,
                                  CVarRef link_identifier = null);
+bool f_mysql_async_query(CStrRef query, CVarRef link_identifier = null);
+Variant f_mysql_async_wait(CArrRef links, double timeout = 1.0);
 inline Variant f_mysql_db_query(CStrRef database, CStrRef query,
                                 CVarRef link_identifier = null) {
   throw NotSupportedException
@@ -16,7 +16,6 @@
 */
 
 #include <runtime/ext/ext_network.h>
-#include <runtime/ext/ext_apc.h>
 #include <runtime/ext/ext_string.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/server/server_stats.h>
@@ -103,35 +102,14 @@ Variant f_gethostbyaddr(CStrRef ip_address) {
 
 String f_gethostbyname(CStrRef hostname) {
   IOStatusHelper io("gethostbyname", hostname.data());
-  if (RuntimeOption::EnableDnsCache) {
-    Variant success;
-    Variant resolved = f_apc_fetch(hostname, ref(success),
-                                   SHARED_STORE_DNS_CACHE);
-    if (same(success, true)) {
-      if (same(resolved, false)) {
-        return hostname;
-      }
-      return resolved.toString();
-    }
-  }
-
   Util::HostEnt result;
   if (!Util::safe_gethostbyname(hostname.data(), result)) {
-    if (RuntimeOption::EnableDnsCache) {
-      f_apc_store(hostname, false, RuntimeOption::DnsCacheTTL,
-                  SHARED_STORE_DNS_CACHE);
-    }
     return hostname;
   }
 
   struct in_addr in;
   memcpy(&in.s_addr, *(result.hostbuf.h_addr_list), sizeof(in.s_addr));
-  String ret(Util::safe_inet_ntoa(in));
-  if (RuntimeOption::EnableDnsCache) {
-    f_apc_store(hostname, ret, RuntimeOption::DnsCacheTTL,
-                SHARED_STORE_DNS_CACHE);
-  }
-  return ret;
+  return String(Util::safe_inet_ntoa(in));
 }
 
 Variant f_gethostbynamel(CStrRef hostname) {
@@ -29,6 +29,7 @@
 #include <runtime/base/array/array_iterator.h>
 #include <util/lock.h>
 #include <util/logger.h>
+#include <util/thread_local.h>
 #include <util/compatibility.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -88,6 +89,7 @@ public:
   std::string m_ps_gc;
 
   SessionSerializer *m_serializer;
+  bool m_serializer_set; // set by ini, not implied by the save handler
 
   bool m_auto_start;
   bool m_use_cookies;
@@ -108,6 +110,7 @@ public:
       m_cookie_httponly(false), m_mod(NULL), m_session_status(None),
       m_gc_probability(0), m_gc_divisor(0), m_gc_maxlifetime(0),
       m_module_number(0), m_cache_expire(0), m_serializer(NULL),
+      m_serializer_set(false),
       m_auto_start(false), m_use_cookies(false), m_use_only_cookies(false),
       m_use_trans_sid(false), m_apply_trans_sid(false),
       m_hash_bits_per_character(0), m_send_cookie(0), m_define_sid(0),
@@ -155,6 +158,7 @@ public:
                      ini_on_update_long,           &m_gc_maxlifetime);
     IniSetting::Bind("session.serialize_handler",  "php",
                      ini_on_update_serializer);
+    m_serializer_set = false; // only the default so far
     IniSetting::Bind("session.cookie_lifetime",    "0",
                      ini_on_update_long,           &m_cookie_lifetime);
     IniSetting::Bind("session.cookie_path",        "/",
@@ -216,6 +220,10 @@ public:
   virtual bool gc(int maxlifetime, int *nrdels) = 0;
   virtual String create_sid();
 
+  // serializer to switch to when this module is selected, if the current one
+  // is still the previous module's default
+  virtual const char *getDefaultSerializer() const { return "php"; }
+
 public:
   static SessionModule *Find(const char *name) {
     for (unsigned int i = 0; i < RegisteredModules.size(); i++) {
@@ -740,6 +748,183 @@ public:
 };
 static UserSessionModule s_user_session_module;
 
+///////////////////////////////////////////////////////////////////////////////
+// MemorySessionModule
+
+/**
+ * Keeps sessions in a table shared by all threads of this process, so they
+ * do not survive a restart. The table is split into segments, each under its
+ * own mutex that is only held for a lookup or a copy, and nothing is locked
+ * between read() and write(), so concurrent requests of one user do not wait
+ * on each other; the last write wins. A session that comes back unchanged is
+ * not written at all, except to refresh its timestamp now and then.
+ *
+ * Each segment keeps two generations. Writes go to the current one; gc()
+ * turns it into the previous one once every gc_maxlifetime, dropping the old
+ * previous generation, which by then only holds expired sessions. So gc()
+ * never walks the table, and locks one segment at a time for a swap. A
+ * segment whose current generation reaches its share of MaxSessions rotates
+ * early, evicting the oldest sessions to bound memory use.
+ */
+class MemorySessionModule : public SessionModule {
+public:
+  MemorySessionModule() : SessionModule("memory") {}
+
+  virtual const char *getDefaultSerializer() const { return "php_binary"; }
+
+  virtual bool open(const char *save_path, const char *session_name) {
+    s_last_read->reset();
+    return true;
+  }
+
+  virtual bool close() {
+    s_last_read->reset();
+    return true;
+  }
+
+  virtual bool read(const char *key, String &value) {
+    time_t now = time(NULL);
+    std::string skey(key);
+    Segment &seg = GetSegment(skey);
+    {
+      Lock lock(seg.mutex);
+      const Entry *e = seg.find(skey);
+      if (e && now - e->mtime <= PS(gc_maxlifetime)) {
+        value = String(e->data.data(), e->data.size(), CopyString);
+      } else {
+        value = "";
+      }
+    }
+    LastRead &last = *s_last_read.get();
+    last.key = skey;
+    last.data.assign(value.data(), value.size());
+    last.valid = true;
+    return true;
+  }
+
+  virtual bool write(const char *key, CStrRef value) {
+    time_t now = time(NULL);
+    std::string skey(key);
+    Segment &seg = GetSegment(skey);
+    LastRead &last = *s_last_read.get();
+    bool unchanged = last.valid && last.key == skey &&
+      last.data.size() == (size_t)value.size() &&
+      memcmp(last.data.data(), value.data(), value.size()) == 0;
+    if (unchanged && value.empty()) return true; // nothing worth keeping
+
+    Map dropped;
+    {
+      Lock lock(seg.mutex);
+      if (unchanged) {
+        // only entries in the current generation survive the next rotation
+        Map::const_iterator iter = seg.current.find(skey);
+        if (iter != seg.current.end() &&
+            now - iter->second.mtime < PS(gc_maxlifetime) / 4) {
+          return true;
+        }
+      }
+      if (seg.current.size() >= MaxSessions / SegmentCount &&
+          seg.current.find(skey) == seg.current.end()) {
+        seg.rotate(dropped, now);
+      }
+      seg.previous.erase(skey);
+      Entry &e = seg.current[skey];
+      e.data.assign(value.data(), value.size());
+      e.mtime = now;
+    }
+    return true; // dropped generation freed outside the lock
+  }
+
+  virtual bool destroy(const char *key) {
+    std::string skey(key);
+    Segment &seg = GetSegment(skey);
+    {
+      Lock lock(seg.mutex);
+      seg.current.erase(skey);
+      seg.previous.erase(skey);
+    }
+    s_last_read->reset();
+    return true;
+  }
+
+  virtual bool gc(int maxlifetime, int *nrdels) {
+    time_t now = time(NULL);
+    int deleted = 0;
+    for (int i = 0; i < SegmentCount; i++) {
+      Segment &seg = s_segments[i];
+      Map dropped;
+      {
+        Lock lock(seg.mutex);
+        if (now - seg.rotated < maxlifetime) continue;
+        seg.rotate(dropped, now);
+      }
+      deleted += dropped.size();
+    }
+    if (nrdels) *nrdels = deleted;
+    return true;
+  }
+
+private:
+  static const int SegmentCount = 64;
+  static const size_t MaxSessions = 1 << 20;
+
+  struct Entry {
+    Entry() : mtime(0) {}
+    std::string data;
+    time_t mtime;
+  };
+  typedef hphp_string_map<Entry> Map;
+
+  struct Segment {
+    Segment() : rotated(time(NULL)) {}
+
+    const Entry *find(const std::string &key) const {
+      Map::const_iterator iter = current.find(key);
+      if (iter != current.end()) return &iter->second;
+      iter = previous.find(key);
+      if (iter != previous.end()) return &iter->second;
+      return NULL;
+    }
+
+    // hands the previous generation to the caller to free unlocked
+    void rotate(Map &dropped, time_t now) {
+      dropped.swap(previous);
+      previous.swap(current);
+      rotated = now;
+    }
+
+    Mutex mutex;
+    Map current;
+    Map previous;
+    time_t rotated;
+  };
+
+  // what this thread's request read, to tell whether write() has news
+  struct LastRead {
+    LastRead() : valid(false) {}
+    void reset() {
+      valid = false;
+      key.clear();
+      data.clear();
+    }
+    bool valid;
+    std::string key;
+    std::string data;
+  };
+
+  static Segment &GetSegment(const std::string &key) {
+    return s_segments[string_hash()(key) % SegmentCount];
+  }
+
+  static Segment s_segments[SegmentCount];
+  static DECLARE_THREAD_LOCAL(LastRead, s_last_read);
+};
+MemorySessionModule::Segment
+  MemorySessionModule::s_segments[MemorySessionModule::SegmentCount];
+IMPLEMENT_THREAD_LOCAL(MemorySessionModule::LastRead,
+                       MemorySessionModule::s_last_read);
+static MemorySessionModule s_memory_session_module;
+
 ///////////////////////////////////////////////////////////////////////////////
 // session serializers
 
@@ -893,15 +1078,24 @@ static PhpSessionSerializer s_php_session_serializer;
     return false;                                                       \
   }
 
+static SessionSerializer *default_serializer(SessionModule *mod) {
+  return SessionSerializer::Find(mod ? mod->getDefaultSerializer() : "php");
+}
+
 bool ini_on_update_save_handler(CStrRef value, void *p) {
   SESSION_CHECK_ACTIVE_STATE;
-  PS(mod) = SessionModule::Find(value.data());
+  SessionModule *mod = SessionModule::Find(value.data());
+  if (mod != PS(mod) && !PS(serializer_set)) {
+    PS(serializer) = default_serializer(mod);
+  }
+  PS(mod) = mod;
   return true;
 }
 
 bool ini_on_update_serializer(CStrRef value, void *p) {
   SESSION_CHECK_ACTIVE_STATE;
   PS(serializer) = SessionSerializer::Find(value.data());
+  PS(serializer_set) = true;
   return true;
 }
 
@@ -1324,7 +1518,6 @@ Variant f_session_module_name(CStrRef newname /* = null_string */) {
     if (PS(mod)) {
       PS(mod)->close();
     }
-    PS(mod) = NULL;
 
     IniSetting::Set("session.save_handler", newname);
   }
@@ -21,6 +21,7 @@
 #include <runtime/base/zend/zend_url.h>
 #include <runtime/base/zend/zend_printf.h>
 #include <runtime/base/zend/zend_scanf.h>
+#include <util/string_kernels.h>
 #include <runtime/base/util/request_local.h>
 #include <util/lock.h>
 #include <locale.h>
@@ -602,20 +603,32 @@ Variant f_strtr(CStrRef str, CVarRef from, CVarRef to /* = null_variant */) {
     return str;
   }
 
+  // only positions starting with one of these can match any key
+  StringKernels::CharSet firsts;
   for (ArrayIter iter(arr); iter; ++iter) {
     String search = iter.first();
     int len = search.size();
     if (len < 1) return false;
     if (maxlen < len) maxlen = len;
     if (minlen == -1 || minlen > len) minlen = len;
+    firsts.add(search.data()[0]);
   }
 
   const char *s = str.data();
   int slen = str.size();
-  char *key = (char *)malloc(maxlen+1);
+  int run = StringKernels::FindAnyOf(s, slen, firsts);
+  if (run == slen) return str;
 
+  char *key = (char *)malloc(maxlen+1);
   StringBuffer result(slen);
+  bool replaced = false;
   for (int pos = 0; pos < slen; ) {
+    run = StringKernels::FindAnyOf(s + pos, slen - pos, firsts);
+    if (run) {
+      result.append(s + pos, run);
+      pos += run;
+      if (pos == slen) break;
+    }
     if ((pos + maxlen) > slen) {
       maxlen = slen - pos;
     }
@@ -629,7 +642,7 @@ Variant f_strtr(CStrRef str, CVarRef from, CVarRef to /* = null_variant */) {
           result += replace;
         }
         pos += len;
-        found = true;
+        found = replaced = true;
         break;
       }
     }
@@ -639,6 +652,7 @@ Variant f_strtr(CStrRef str, CVarRef from, CVarRef to /* = null_variant */) {
   }
   free(key);
 
+  if (!replaced) return str;
   return result.detach();
 }
 
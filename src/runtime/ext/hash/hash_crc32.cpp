@@ -17,6 +17,7 @@
 
 #include <runtime/ext/hash/hash_crc32.h>
 #include <runtime/ext/hash/php_hash_crc32_tables.h>
+#include <util/hash_kernels.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -39,12 +40,14 @@ void hash_crc32::hash_update(void *context_, const unsigned char *input,
   PHP_CRC32_CTX *context = (PHP_CRC32_CTX*)context_;
   size_t i;
   if (m_b) {
-    for (i = 0; i < len; ++i) {
+    i = HashKernels::FoldCRC32(context->state, input, len);
+    for (; i < len; ++i) {
       context->state = (context->state >> 8) ^
         crc32b_table[(context->state ^ input[i]) & 0xff];
     }
   } else {
-    for (i = 0; i < len; ++i) {
+    i = HashKernels::FoldCRC32MSB(context->state, input, len);
+    for (; i < len; ++i) {
       context->state = (context->state << 8) ^
         crc32_table[(context->state >> 24) ^ (input[i] & 0xff)];
     }
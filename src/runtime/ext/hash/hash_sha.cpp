@@ -16,6 +16,7 @@
 */
 
 #include <runtime/ext/hash/hash_sha.h>
+#include <util/hash_kernels.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -268,6 +269,18 @@ static void SHA1Transform(unsigned int state[5],
   memset((unsigned char*) x, 0, sizeof(x));
 }
 
+/*
+ * Runs count blocks through SHA1Transform, or through the CPU's SHA
+ * instructions when it has them.
+ */
+static void SHA1Blocks(unsigned int state[5], const unsigned char *blocks,
+                       unsigned int count) {
+  if (HashKernels::SHA1Blocks(state, blocks, count)) return;
+  for (; count; count--, blocks += 64) {
+    SHA1Transform(state, blocks);
+  }
+}
+
 /*
    SHA1 block update operation. Continues an SHA1 message-digest
    operation, processing another message block, and updating the
@@ -295,10 +308,9 @@ void hash_sha1::hash_update(void *context_, const unsigned char *input,
   if (inputLen >= partLen) {
     memcpy((unsigned char*) & context->buffer[index], (unsigned char*) input,
            partLen);
-    SHA1Transform(context->state, context->buffer);
-
-    for (i = partLen; i + 63 < inputLen; i += 64)
-      SHA1Transform(context->state, &input[i]);
+    SHA1Blocks(context->state, context->buffer, 1);
+    SHA1Blocks(context->state, &input[partLen], (inputLen - partLen) / 64);
+    i = inputLen - (inputLen - partLen) % 64;
 
     index = 0;
   } else
@@ -432,6 +444,17 @@ static void SHA256Transform(unsigned int state[8],
   memset((unsigned char*) x, 0, sizeof(x));
 }
 
+/*
+ * Same for SHA256.
+ */
+static void SHA256Blocks(unsigned int state[8], const unsigned char *blocks,
+                         unsigned int count) {
+  if (HashKernels::SHA256Blocks(state, blocks, count)) return;
+  for (; count; count--, blocks += 64) {
+    SHA256Transform(state, blocks);
+  }
+}
+
 /*
   SHA256 block update operation. Continues an SHA256 message-digest
   operation, processing another message block, and updating the
@@ -459,11 +482,9 @@ void hash_sha256::hash_update(void *context_, const unsigned char *input,
   if (inputLen >= partLen) {
     memcpy((unsigned char*) & context->buffer[index],
            (unsigned char*) input, partLen);
-    SHA256Transform(context->state, context->buffer);
-
-    for (i = partLen; i + 63 < inputLen; i += 64) {
-      SHA256Transform(context->state, &input[i]);
-    }
+    SHA256Blocks(context->state, context->buffer, 1);
+    SHA256Blocks(context->state, &input[partLen], (inputLen - partLen) / 64);
+    i = inputLen - (inputLen - partLen) % 64;
 
     index = 0;
   } else {
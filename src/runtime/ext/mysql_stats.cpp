@@ -105,6 +105,17 @@ const char * MySqlStats::Translate(Verb verb) {
   return NULL;
 }
 
+MySqlStats::Stats &MySqlStats::GetStats(const std::string &ltable) {
+  StatsMap::iterator iter = s_stats.find(ltable);
+  if (iter == s_stats.end()) {
+    StatsPtr stats(new Stats());
+    memset(stats.get(), 0, sizeof(Stats));
+    s_stats[ltable] = stats;
+    return *stats;
+  }
+  return *iter->second;
+}
+
 void MySqlStats::Record(const std::string &verb,
                         int xactionCount /* = 0 */,
                         const std::string &table /* = "" */) {
@@ -114,16 +125,18 @@ void MySqlStats::Record(const std::string &verb,
   string ltable = Util::toLower(table);
 
   Lock lock(s_mutex);
-  StatsMap::iterator iter = s_stats.find(ltable);
-  if (iter == s_stats.end()) {
-    StatsPtr stats(new Stats());
-    memset(stats.get(), 0, sizeof(Stats));
-    stats->actions[v] = 1;
-    s_stats[ltable] = stats;
-  } else {
-    Stats &stats = *iter->second;
-    ++stats.actions[v];
-  }
+  ++GetStats(ltable).actions[v];
+}
+
+void MySqlStats::RecordTime(const std::string &verb, int xactionCount,
+                            const std::string &table, int64 usec) {
+  Verb v = Translate(verb, xactionCount);
+  if (v == UNKNOWN) return;
+
+  string ltable = Util::toLower(table);
+
+  Lock lock(s_mutex);
+  GetStats(ltable).usecs[v] += usec;
 }
 
 std::string MySqlStats::ReportStats() {
@@ -149,6 +162,9 @@ std::string MySqlStats::ReportStats() {
       out << "  <" << name << ">";
       out << stats.actions[i];
       out << "</" << name << ">\n";
+      out << "  <" << name << "_usecs>";
+      out << stats.usecs[i];
+      out << "</" << name << "_usecs>\n";
     }
     out << "</" << table << ">\n";
   }
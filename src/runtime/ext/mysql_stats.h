@@ -63,12 +63,15 @@ public:
 public:
   static void Record(const std::string &verb, int xactionCount = 0,
                      const std::string &table = "");
+  static void RecordTime(const std::string &verb, int xactionCount,
+                         const std::string &table, int64 usec);
   static std::string ReportStats();
 
 private:
   DECLARE_BOOST_TYPES(Stats);
   struct Stats {
     int actions[VERB_COUNT];
+    int64 usecs[VERB_COUNT]; // total round trip time
   };
   typedef hphp_string_map<StatsPtr> StatsMap;
 
@@ -81,6 +84,7 @@ private:
 
   static void Init();
   static Verb Translate(const std::string &verb, int xactionCount);
+  static Stats &GetStats(const std::string &ltable);
   static const char *Translate(Verb verb);
 };
 
@@ -100,6 +100,11 @@ inline Variant x_curl_multi_select(CObjRef mh, double timeout = 1.0) {
   return f_curl_multi_select(mh, timeout);
 }
 
+inline Variant x_curl_multi_await(CObjRef mh, double timeout = 1.0) {
+  FUNCTION_INJECTION_BUILTIN(curl_multi_await);
+  return f_curl_multi_await(mh, timeout);
+}
+
 inline Variant x_curl_multi_getcontent(CObjRef ch) {
   FUNCTION_INJECTION_BUILTIN(curl_multi_getcontent);
   return f_curl_multi_getcontent(ch);
@@ -160,6 +160,16 @@ inline Variant x_mysql_unbuffered_query(CStrRef query, CVarRef link_identifier =
   return f_mysql_unbuffered_query(query, link_identifier);
 }
 
+inline bool x_mysql_async_query(CStrRef query, CVarRef link_identifier = null) {
+  FUNCTION_INJECTION_BUILTIN(mysql_async_query);
+  return f_mysql_async_query(query, link_identifier);
+}
+
+inline Variant x_mysql_async_wait(CArrRef links, double timeout = 1.0) {
+  FUNCTION_INJECTION_BUILTIN(mysql_async_wait);
+  return f_mysql_async_wait(links, timeout);
+}
+
 inline Variant x_mysql_db_query(CStrRef database, CStrRef query, CVarRef link_identifier = null) {
   FUNCTION_INJECTION_BUILTIN(mysql_db_query);
   return f_mysql_db_query(database, query, link_identifier);
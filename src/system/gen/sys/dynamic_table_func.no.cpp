@@ -39540,6 +39540,66 @@ Variant ifa_fb_call_user_func_array_safe(void *extra, int count, INVOKE_FEW_ARGS
   CVarRef arg1((a1));
   return (f_fb_call_user_func_array_safe(arg0, arg1));
 }
+Variant i_curl_multi_await(void *extra, CArrRef params) {
+  FUNCTION_INJECTION(curl_multi_await);
+  int count __attribute__((__unused__)) = params.size();
+  if (count < 1 || count > 2) return throw_wrong_arguments("curl_multi_await", count, 1, 2, 1);
+  {
+    ArrayData *ad(params.get());
+    ssize_t pos = ad ? ad->iter_begin() : ArrayData::invalid_index;
+    CVarRef arg0((ad->getValue(pos)));
+    if (count <= 1) return (f_curl_multi_await(arg0));
+    CVarRef arg1((ad->getValue(pos = ad->iter_advance(pos))));
+    return (f_curl_multi_await(arg0, arg1));
+  }
+}
+Variant ifa_curl_multi_await(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (count < 1 || count > 2) return throw_wrong_arguments("curl_multi_await", count, 1, 2, 1);
+  CVarRef arg0((a0));
+  if (count <= 1) return (f_curl_multi_await(arg0));
+  CVarRef arg1((a1));
+  return (f_curl_multi_await(arg0, arg1));
+}
+Variant i_mysql_async_query(void *extra, CArrRef params) {
+  FUNCTION_INJECTION(mysql_async_query);
+  int count __attribute__((__unused__)) = params.size();
+  if (count < 1 || count > 2) return throw_wrong_arguments("mysql_async_query", count, 1, 2, 1);
+  {
+    ArrayData *ad(params.get());
+    ssize_t pos = ad ? ad->iter_begin() : ArrayData::invalid_index;
+    CVarRef arg0((ad->getValue(pos)));
+    if (count <= 1) return (f_mysql_async_query(arg0));
+    CVarRef arg1((ad->getValue(pos = ad->iter_advance(pos))));
+    return (f_mysql_async_query(arg0, arg1));
+  }
+}
+Variant ifa_mysql_async_query(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (count < 1 || count > 2) return throw_wrong_arguments("mysql_async_query", count, 1, 2, 1);
+  CVarRef arg0((a0));
+  if (count <= 1) return (f_mysql_async_query(arg0));
+  CVarRef arg1((a1));
+  return (f_mysql_async_query(arg0, arg1));
+}
+Variant i_mysql_async_wait(void *extra, CArrRef params) {
+  FUNCTION_INJECTION(mysql_async_wait);
+  int count __attribute__((__unused__)) = params.size();
+  if (count < 1 || count > 2) return throw_wrong_arguments("mysql_async_wait", count, 1, 2, 1);
+  {
+    ArrayData *ad(params.get());
+    ssize_t pos = ad ? ad->iter_begin() : ArrayData::invalid_index;
+    CVarRef arg0((ad->getValue(pos)));
+    if (count <= 1) return (f_mysql_async_wait(arg0));
+    CVarRef arg1((ad->getValue(pos = ad->iter_advance(pos))));
+    return (f_mysql_async_wait(arg0, arg1));
+  }
+}
+Variant ifa_mysql_async_wait(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (count < 1 || count > 2) return throw_wrong_arguments("mysql_async_wait", count, 1, 2, 1);
+  CVarRef arg0((a0));
+  if (count <= 1) return (f_mysql_async_wait(arg0));
+  CVarRef arg1((a1));
+  return (f_mysql_async_wait(arg0, arg1));
+}
 Variant ei_utf8_encode(Eval::VariableEnvironment &env, const Eval::FunctionCallExpression *caller) {
   Variant a0;
   const std::vector<Eval::ExpressionPtr> &params = caller->params();
@@ -83118,6 +83178,69 @@ Variant ei_fb_call_user_func_array_safe(Eval::VariableEnvironment &env, const Ev
   if (count != 2) return throw_wrong_arguments("fb_call_user_func_array_safe", count, 2, 2, 1);
   return (x_fb_call_user_func_array_safe(a0, a1));
 }
+Variant ei_curl_multi_await(Eval::VariableEnvironment &env, const Eval::FunctionCallExpression *caller) {
+  Variant a0;
+  Variant a1;
+  const std::vector<Eval::ExpressionPtr> &params = caller->params();
+  std::vector<Eval::ExpressionPtr>::const_iterator it = params.begin();
+  do {
+    if (it == params.end()) break;
+    a0 = (*it)->eval(env);
+    it++;
+    if (it == params.end()) break;
+    a1 = (*it)->eval(env);
+    it++;
+  } while(false);
+  for (; it != params.end(); ++it) {
+    (*it)->eval(env);
+  }
+  int count __attribute__((__unused__)) = params.size();
+  if (count < 1 || count > 2) return throw_wrong_arguments("curl_multi_await", count, 1, 2, 1);
+  if (count <= 1) return (x_curl_multi_await(a0));
+  else return (x_curl_multi_await(a0, a1));
+}
+Variant ei_mysql_async_query(Eval::VariableEnvironment &env, const Eval::FunctionCallExpression *caller) {
+  Variant a0;
+  Variant a1;
+  const std::vector<Eval::ExpressionPtr> &params = caller->params();
+  std::vector<Eval::ExpressionPtr>::const_iterator it = params.begin();
+  do {
+    if (it == params.end()) break;
+    a0 = (*it)->eval(env);
+    it++;
+    if (it == params.end()) break;
+    a1 = (*it)->eval(env);
+    it++;
+  } while(false);
+  for (; it != params.end(); ++it) {
+    (*it)->eval(env);
+  }
+  int count __attribute__((__unused__)) = params.size();
+  if (count < 1 || count > 2) return throw_wrong_arguments("mysql_async_query", count, 1, 2, 1);
+  if (count <= 1) return (x_mysql_async_query(a0));
+  else return (x_mysql_async_query(a0, a1));
+}
+Variant ei_mysql_async_wait(Eval::VariableEnvironment &env, const Eval::FunctionCallExpression *caller) {
+  Variant a0;
+  Variant a1;
+  const std::vector<Eval::ExpressionPtr> &params = caller->params();
+  std::vector<Eval::ExpressionPtr>::const_iterator it = params.begin();
+  do {
+    if (it == params.end()) break;
+    a0 = (*it)->eval(env);
+    it++;
+    if (it == params.end()) break;
+    a1 = (*it)->eval(env);
+    it++;
+  } while(false);
+  for (; it != params.end(); ++it) {
+    (*it)->eval(env);
+  }
+  int count __attribute__((__unused__)) = params.size();
+  if (count < 1 || count > 2) return throw_wrong_arguments("mysql_async_wait", count, 1, 2, 1);
+  if (count <= 1) return (x_mysql_async_wait(a0));
+  else return (x_mysql_async_wait(a0, a1));
+}
 Variant Eval::invoke_from_eval_builtin(const char *s, Eval::VariableEnvironment &env, const Eval::FunctionCallExpression *caller, int64 hash, bool fatal) {
   if (hash < 0) hash = hash_string(s);
   switch (hash & 8191) {
@@ -83315,6 +83438,9 @@ Variant Eval::invoke_from_eval_builtin(const char *s, Eval::VariableEnvironment
     case 323:
       HASH_INVOKE_FROM_EVAL(0x296C739F28D6C143LL, drawsetfontsize);
       break;
+    case 324:
+      HASH_INVOKE_FROM_EVAL(0x3D913E0CCECBC144LL, mysql_async_query);
+      break;
     case 337:
       HASH_INVOKE_FROM_EVAL(0x3044E9F91628E151LL, mb_strlen);
       break;
@@ -83577,6 +83703,9 @@ Variant Eval::invoke_from_eval_builtin(const char *s, Eval::VariableEnvironment
     case 674:
       HASH_INVOKE_FROM_EVAL(0x1FBF8A270331C2A2LL, write_hdf_file);
       break;
+    case 677:
+      HASH_INVOKE_FROM_EVAL(0x17BC6942AAE442A5LL, curl_multi_await);
+      break;
     case 685:
       HASH_INVOKE_FROM_EVAL(0x35D259398CDDA2ADLL, pixelgetredquantum);
       HASH_INVOKE_FROM_EVAL(0x00AB6FC4E9EE62ADLL, imagefilledrectangle);
@@ -83651,6 +83780,9 @@ Variant Eval::invoke_from_eval_builtin(const char *s, Eval::VariableEnvironment
     case 818:
       HASH_INVOKE_FROM_EVAL(0x037055C215998332LL, bcsub);
       break;
+    case 822:
+      HASH_INVOKE_FROM_EVAL(0x07F83D5C022D8336LL, mysql_async_wait);
+      break;
     case 824:
       HASH_INVOKE_FROM_EVAL(0x549D51040C250338LL, cleardrawingwand);
       break;
@@ -91064,12154 +91196,4188 @@ CallInfo ci_imagecreatefromxpm((void*)&i_imagecreatefromxpm, (void*)&ifa_imagecr
 CallInfo ci_mysql_thread_id((void*)&i_mysql_thread_id, (void*)&ifa_mysql_thread_id, 1, 0, 0x0000000000000000LL, (void*)&ei_mysql_thread_id);
 CallInfo ci_mb_encode_numericentity((void*)&i_mb_encode_numericentity, (void*)&ifa_mb_encode_numericentity, 3, 0, 0x0000000000000000LL, (void*)&ei_mb_encode_numericentity);
 CallInfo ci_fb_call_user_func_array_safe((void*)&i_fb_call_user_func_array_safe, (void*)&ifa_fb_call_user_func_array_safe, 2, 0, 0x0000000000000000LL, (void*)&ei_fb_call_user_func_array_safe);
+CallInfo ci_curl_multi_await((void*)&i_curl_multi_await, (void*)&ifa_curl_multi_await, 2, 0, 0x0000000000000000LL, (void*)&ei_curl_multi_await);
+CallInfo ci_mysql_async_query((void*)&i_mysql_async_query, (void*)&ifa_mysql_async_query, 2, 0, 0x0000000000000000LL, (void*)&ei_mysql_async_query);
+CallInfo ci_mysql_async_wait((void*)&i_mysql_async_wait, (void*)&ifa_mysql_async_wait, 2, 0, 0x0000000000000000LL, (void*)&ei_mysql_async_wait);
+
+struct hashNodeCI {
+  int64 hash;
+  const char *name;
+  const CallInfo *ci;
+};
+
+static const unsigned short funcDisps[1024] = {
+  3, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 0, 0, 0, 2, 1, 0, 1, 3, 0, 1, 1, 2,
+  1, 1, 0, 1, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3, 1,
+  0, 0, 3, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 0, 2, 1, 3, 0, 0, 0, 4, 0, 0, 1, 0, 2, 0,
+  3, 0, 0, 0, 0, 0, 0, 2, 1, 0, 1, 2, 2, 1, 0, 0,
+  0, 0, 1, 0, 2, 0, 0, 2, 1, 0, 0, 0, 1, 2, 0, 0,
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 1,
+  1, 6, 2, 0, 0, 4, 0, 3, 2, 1, 0, 0, 1, 0, 2, 0,
+  1, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 1, 1,
+  0, 0, 2, 3, 0, 3, 0, 2, 1, 2, 5, 1, 0, 1, 0, 0,
+  0, 0, 0, 1, 0, 0, 0, 0, 6, 1, 2, 0, 0, 0, 3, 5,
+  4, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 2,
+  0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, 0, 0,
+  1, 0, 0, 3, 0, 0, 3, 1, 2, 0, 1, 0, 3, 0, 4, 0,
+  0, 3, 0, 1, 3, 0, 0, 0, 2, 0, 0, 6, 2, 1, 1, 1,
+  0, 0, 4, 1, 0, 3, 1, 2, 4, 0, 2, 0, 1, 0, 0, 1,
+  0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 7, 0, 1, 0, 1, 2,
+  0, 0, 0, 0, 0, 1, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 1, 2, 1, 0, 1, 0, 0, 1, 0, 0, 0, 2,
+  0, 1, 1, 1, 1, 3, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 4, 2, 10, 0, 0,
+  1, 3, 0, 5, 0, 0, 0, 1, 1, 3, 0, 1, 0, 0, 0, 0,
+  0, 1, 0, 0, 0, 0, 1, 0, 2, 0, 0, 1, 1, 0, 0, 5,
+  2, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 14, 1, 0,
+  3, 0, 0, 2, 0, 0, 0, 3, 0, 1, 5, 0, 0, 4, 0, 0,
+  0, 0, 0, 0, 0, 2, 8, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+  0, 0, 3, 3, 0, 2, 0, 1, 0, 0, 1, 0, 12, 0, 0, 1,
+  2, 2, 2, 1, 3, 0, 1, 0, 0, 0, 0, 0, 1, 2, 0, 3,
+  1, 1, 3, 1, 1, 3, 0, 0, 0, 0, 0, 1, 1, 2, 1, 1,
+  0, 2, 1, 3, 3, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1,
+  2, 0, 0, 3, 0, 0, 1, 0, 1, 0, 0, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 3, 7, 1, 0, 0, 2, 0, 1, 2,
+  0, 0, 3, 0, 0, 0, 2, 1, 1, 0, 0, 0, 6, 0, 0, 1,
+  1, 0, 0, 4, 0, 0, 0, 1, 0, 3, 1, 0, 3, 1, 2, 0,
+  0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 1,
+  0, 0, 2, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 1, 0, 0, 0, 3, 1, 0, 0, 0, 1, 2, 0, 2, 0,
+  1, 3, 0, 0, 0, 1, 0, 1, 7, 2, 3, 2, 8, 3, 0, 3,
+  0, 1, 1, 1, 0, 0, 3, 5, 0, 1, 5, 2, 0, 4, 2, 0,
+  3, 0, 1, 0, 5, 0, 2, 7, 3, 0, 2, 6, 0, 1, 1, 0,
+  2, 3, 0, 0, 0, 2, 2, 0, 0, 0, 0, 2, 1, 3, 1, 1,
+  0, 0, 3, 2, 0, 2, 0, 0, 1, 6, 3, 2, 1, 0, 7, 5,
+  0, 1, 6, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0,
+  6, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 1, 0, 1,
+  0, 0, 3, 0, 0, 0, 1, 0, 1, 1, 5, 0, 0, 0, 0, 0,
+  1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 6, 1, 0, 1,
+  0, 1, 0, 1, 2, 0, 0, 0, 0, 2, 1, 3, 1, 1, 2, 2,
+  1, 1, 0, 2, 8, 4, 3, 0, 0, 0, 3, 0, 0, 1, 0, 0,
+  4, 0, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 2,
+  4, 1, 0, 0, 0, 2, 7, 1, 0, 2, 0, 0, 0, 0, 3, 6,
+  1, 2, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+  1, 0, 2, 5, 0, 0, 1, 2, 1, 0, 1, 1, 3, 2, 0, 0,
+  1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 2, 0, 2, 0, 0, 0,
+  0, 1, 0, 3, 1, 1, 1, 0, 0, 0, 0, 6, 3, 1, 7, 3,
+  0, 1, 0, 0, 1, 3, 1, 2, 0, 4, 3, 1, 1, 0, 0, 2,
+  8, 0, 2, 1, 1, 0, 1, 2, 3, 5, 4, 0, 0, 3, 0, 0,
+  0, 3, 0, 0, 0, 1, 0, 1, 4, 2, 0, 0, 0, 3, 0, 0,
+  0, 0, 1, 0, 0, 0, 3, 0, 2, 6, 7, 4, 0, 0, 2, 7,
+  4, 5, 0, 1, 0, 3, 0, 1, 0, 2, 0, 4, 2, 2, 0, 1,
+  0, 1, 0, 0, 3, 0, 1, 1, 3, 1, 3, 0, 0, 0, 0, 9,
+  0, 0, 1, 0, 0, 0, 0, 0, 9, 7, 0, 0, 4, 0, 6, 0,
+  2, 1, 0, 0, 1, 2, 0, 0, 1, 5, 5, 0, 1, 0, 1, 1,
+  0, 5, 1, 0, 1, 0, 2, 2, 2, 5, 1, 0, 5, 1, 0, 0,
+};
+static const hashNodeCI funcSlots[4096] = {
+  {0x11BB3CDC5E4971F3LL, "xmlwriter_end_pi", &ci_xmlwriter_end_pi},
+  {0x382B5B1EF00153D7LL, "imagecreatefrompng", &ci_imagecreatefrompng},
+  {-1, NULL, NULL},
+  {0x48C4DB333172F6AALL, "parse_url", &ci_parse_url},
+  {-1, NULL, NULL},
+  {0x18E4CC945005E5F7LL, "drawpushclippath", &ci_drawpushclippath},
+  {0x66C3E73210067DC8LL, "magickgetimageunits", &ci_magickgetimageunits},
+  {0x0D558F552A784730LL, "ob_get_contents", &ci_ob_get_contents},
+  {0x7A1C6E429399CEE0LL, "iconv_set_encoding", &ci_iconv_set_encoding},
+  {-1, NULL, NULL},
+  {0x3D913E0CCECBC144LL, "mysql_async_query", &ci_mysql_async_query},
+  {0x24CBCBA5C4407B40LL, "evhttp_set_cache", &ci_evhttp_set_cache},
+  {0x4F028FA6AAEEC286LL, "call_user_method", &ci_call_user_method},
+  {0x017FF216C00D9751LL, "property_exists", &ci_property_exists},
+  {0x47C5BC101A512C96LL, "magickquantizeimage", &ci_magickquantizeimage},
+  {-1, NULL, NULL},
+  {0x53B4DBE58B356783LL, "imagesetthickness", &ci_imagesetthickness},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x20C24D873DC65413LL, "openssl_csr_get_subject", &ci_openssl_csr_get_subject},
+  {-1, NULL, NULL},
+  {0x6F3503C7FB12DB01LL, "lchgrp", &ci_lchgrp},
+  {0x2623917110168155LL, "fclose", &ci_fclose},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4E61FE901C1C29CDLL, "array_intersect_key", &ci_array_intersect_key},
+  {-1, NULL, NULL},
+  {0x0F9C0C82F40F2C89LL, "pixelsetcyanquantum", &ci_pixelsetcyanquantum},
+  {0x1248250E701DAD04LL, "magickgaussianblurimage", &ci_magickgaussianblurimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0B7ACBAB402015EALL, "mb_send_mail", &ci_mb_send_mail},
+  {-1, NULL, NULL},
+  {0x02A0F9CE4022BBD0LL, "imap_fetchbody", &ci_imap_fetchbody},
+  {0x18CF3E4A60E4AAACLL, "pi", &ci_pi},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x733137183026ACBCLL, "hphp_splfileobject_next", &ci_hphp_splfileobject_next},
+  {-1, NULL, NULL},
+  {0x1444DB037B4D5BF4LL, "imagegammacorrect", &ci_imagegammacorrect},
+  {-1, NULL, NULL},
+  {0x78EDB608B02A857DLL, "join", &ci_join},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4C0E2C6882051A3FLL, "magickgetresourcelimit", &ci_magickgetresourcelimit},
+  {0x3F869126D0336442LL, "trigger_error", &ci_trigger_error},
+  {0x7F65501600346592LL, "mcrypt_get_block_size", &ci_mcrypt_get_block_size},
+  {0x1778ED2AF035F714LL, "rsort", &ci_rsort},
+  {0x7F9E810BC93023A9LL, "memcache_close", &ci_memcache_close},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x14402B01D00E9F84LL, "magicksteganoimage", &ci_magicksteganoimage},
+  {0x0482E069503A91DALL, "posix_setgid", &ci_posix_setgid},
+  {0x4926EE59103B2A40LL, "destroydrawingwand", &ci_destroydrawingwand},
+  {-1, NULL, NULL},
+  {0x74599147803DC56ALL, "magickgetstringwidth", &ci_magickgetstringwidth},
+  {0x14E46EA3CBCFB168LL, "magickgetsamplingfactors", &ci_magickgetsamplingfactors},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x243BB8B284895949LL, "apache_get_rewrite_rules", &ci_apache_get_rewrite_rules},
+  {0x533642044A00520ELL, "pixelgetmagentaquantum", &ci_pixelgetmagentaquantum},
+  {0x0AC7CBCE30442A94LL, "imagepalettecopy", &ci_imagepalettecopy},
+  {-1, NULL, NULL},
+  {0x4120B8157ED413A8LL, "i18n_loc_set_strength", &ci_i18n_loc_set_strength},
+  {-1, NULL, NULL},
+  {0x65497D63C0D716AFLL, "getdate", &ci_getdate},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x49965C44E9EE3C33LL, "set_file_buffer", &ci_set_file_buffer},
+  {0x21F24104004CFDFELL, "evhttp_post", &ci_evhttp_post},
+  {0x1BAFB965204D0AB4LL, "openssl_x509_check_private_key", &ci_openssl_x509_check_private_key},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5F7DC3612050A285LL, "drawsetfontweight", &ci_drawsetfontweight},
+  {0x1601C1826E90B330LL, "strptime", &ci_strptime},
+  {-1, NULL, NULL},
+  {0x200864F8F053C08DLL, "magickgetversionstring", &ci_magickgetversionstring},
+  {-1, NULL, NULL},
+  {0x16CB9891EF26D7AFLL, "drawgetstrokedashoffset", &ci_drawgetstrokedashoffset},
+  {0x300F758BB0E16330LL, "mysql_num_rows", &ci_mysql_num_rows},
+  {-1, NULL, NULL},
+  {0x68AE04B02253B47FLL, "mb_parse_str", &ci_mb_parse_str},
+  {0x2E57E06900594409LL, "xbox_send_message", &ci_xbox_send_message},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x72B901C3605CB6BALL, "pixelsetopacity", &ci_pixelsetopacity},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1E77B3BCF062D628LL, "magickreadimage", &ci_magickreadimage},
+  {-1, NULL, NULL},
+  {0x33CBF1153473A657LL, "imap_base64", &ci_imap_base64},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3456885FF0679E28LL, "lchown", &ci_lchown},
+  {-1, NULL, NULL},
+  {0x54DB5DC6A069A185LL, "hphp_get_class_info", &ci_hphp_get_class_info},
+  {0x02ECD8C169DF579DLL, "feof", &ci_feof},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x191ECE88E06E6FF5LL, "dom_node_is_supported", &ci_dom_node_is_supported},
+  {-1, NULL, NULL},
+  {0x3CAEA6B8D1C92A2ALL, "stream_bucket_prepend", &ci_stream_bucket_prepend},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x129E39AC523A977BLL, "magickgethomeurl", &ci_magickgethomeurl},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x313D2A505076A533LL, "dir", &ci_dir},
+  {0x0644E5FB91C8134CLL, "array_udiff", &ci_array_udiff},
+  {0x2EA6E1D600786C99LL, "mb_strtoupper", &ci_mb_strtoupper},
+  {0x61C991F216E85273LL, "inet_ntop", &ci_inet_ntop},
+  {0x4ADFA265F07AB9E9LL, "drawgettextalignment", &ci_drawgettextalignment},
+  {0x0121CD6CDCE1C3A8LL, "mysql_pconnect_with_db", &ci_mysql_pconnect_with_db},
+  {-1, NULL, NULL},
+  {0x346B2DB3BA2378A9LL, "imagecolormatch", &ci_imagecolormatch},
+  {-1, NULL, NULL},
+  {0x7E0EC3E131BCA003LL, "token_name", &ci_token_name},
+  {0x4C67DEE74080E0CALL, "magicksetimagecompose", &ci_magicksetimagecompose},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x33FE101882726EB1LL, "proc_close", &ci_proc_close},
+  {-1, NULL, NULL},
+  {0x1569DCC552EE8E88LL, "cosh", &ci_cosh},
+  {-1, NULL, NULL},
+  {0x617AD1AD708785D7LL, "magickmodulateimage", &ci_magickmodulateimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x73B30E65808A6DF4LL, "ctype_xdigit", &ci_ctype_xdigit},
+  {0x36A80B48E08B753ELL, "implode", &ci_implode},
+  {-1, NULL, NULL},
+  {0x5B7F218FA08D8E21LL, "imagefilledellipse", &ci_imagefilledellipse},
+  {0x197A5D237BD4C507LL, "mb_ereg_search_getpos", &ci_mb_ereg_search_getpos},
+  {0x7064BEBF508F3F7ELL, "socket_read", &ci_socket_read},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x31C3A072D092FA3ELL, "socket_create_listen", &ci_socket_create_listen},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7B525920E026C208LL, "gztell", &ci_gztell},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x05BD68F1D09CEF24LL, "array_count_values", &ci_array_count_values},
+  {0x2B12B0E9109D0404LL, "iptcembed", &ci_iptcembed},
+  {0x665D2615E377A682LL, "pagelet_server_task_start", &ci_pagelet_server_task_start},
+  {0x034EDEBD109FD83CLL, "filesize", &ci_filesize},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2475D7045D9DEEC0LL, "magicksetimagecompression", &ci_magicksetimagecompression},
+  {0x40E0D496EE29B3A6LL, "call_user_func_array", &ci_call_user_func_array},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2394D4E030AB69FDLL, "getmypid", &ci_getmypid},
+  {-1, NULL, NULL},
+  {0x03098F16B0AD5838LL, "mcrypt_module_get_supported_key_sizes", &ci_mcrypt_module_get_supported_key_sizes},
+  {-1, NULL, NULL},
+  {0x1B6467AD87E167B9LL, "log1p", &ci_log1p},
+  {-1, NULL, NULL},
+  {0x0D76FFBE30B13EE3LL, "imap_mailboxmsginfo", &ci_imap_mailboxmsginfo},
+  {-1, NULL, NULL},
+  {0x72E3AE55A0B33B45LL, "ispixelwand", &ci_ispixelwand},
+  {0x791E946E04F50388LL, "magicksetresourcelimit", &ci_magicksetresourcelimit},
+  {0x7761D019E0B5EA94LL, "magickstripimage", &ci_magickstripimage},
+  {0x6467FFB910B8BEA3LL, "magickspliceimage", &ci_magickspliceimage},
+  {0x66DA89629BA5D399LL, "posix_getgrgid", &ci_posix_getgrgid},
+  {0x26729ECB00B8ECF5LL, "end_user_func_async", &ci_end_user_func_async},
+  {0x415B91CAEE0689CFLL, "magickgetimageinterlacescheme", &ci_magickgetimageinterlacescheme},
+  {-1, NULL, NULL},
+  {0x28E724EDE0BB6524LL, "mb_strcut", &ci_mb_strcut},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x72C01E1D90BE5932LL, "mcrypt_enc_get_block_size", &ci_mcrypt_enc_get_block_size},
+  {0x523AB2EA95DAD726LL, "get_included_files", &ci_get_included_files},
+  {0x41F8FDD700C0CB85LL, "socket_last_error", &ci_socket_last_error},
+  {0x3192209D50C1FE14LL, "pixelsetalpha", &ci_pixelsetalpha},
+  {-1, NULL, NULL},
+  {0x215547858BA7E398LL, "hphp_recursiveiteratoriterator___construct", &ci_hphp_recursiveiteratoriterator___construct},
+  {0x2939C5BAE0C4A40DLL, "nl2br", &ci_nl2br},
+  {0x53DB5D0490C51FD0LL, "xhprof_sample_disable", &ci_xhprof_sample_disable},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x75AFA49220C9B637LL, "collator_sort", &ci_collator_sort},
+  {-1, NULL, NULL},
+  {0x06DAF95935D221F6LL, "dom_namednodemap_item", &ci_dom_namednodemap_item},
+  {0x7A8F1104B0CCDF8ELL, "phpcredits", &ci_phpcredits},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1938C8715806E3F4LL, "spl_classes", &ci_spl_classes},
+  {-1, NULL, NULL},
+  {0x3C781898488687CALL, "xml_parse", &ci_xml_parse},
+  {-1, NULL, NULL},
+  {0x3304663FBC6C976DLL, "get_html_translation_table", &ci_get_html_translation_table},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1887622B9AAE75B2LL, "imap_mime_header_decode", &ci_imap_mime_header_decode},
+  {0x44563CC8FA9B11DELL, "memcache_set_server_params", &ci_memcache_set_server_params},
+  {0x4AC522FF7BB60898LL, "xmlwriter_write_dtd_entity", &ci_xmlwriter_write_dtd_entity},
+  {0x714001ABB0D76E6DLL, "magickgetinterlacescheme", &ci_magickgetinterlacescheme},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x522256BAA78159ACLL, "popen", &ci_popen},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x651A8CBB8D2A398DLL, "mysql_stat", &ci_mysql_stat},
+  {0x2FA7269AB0E1147CLL, "mysql_field_seek", &ci_mysql_field_seek},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7C07D66F70E43231LL, "mailparse_determine_best_xfer_encoding", &ci_mailparse_determine_best_xfer_encoding},
+  {0x4EFD7A9C90E559B8LL, "posix_ttyname", &ci_posix_ttyname},
+  {0x03047FD5FC67204CLL, "exif_read_data", &ci_exif_read_data},
+  {-1, NULL, NULL},
+  {0x31A30B274AD2DEBDLL, "call_user_func_array_rpc", &ci_call_user_func_array_rpc},
+  {0x793259E03C37CC57LL, "memcache_decrement", &ci_memcache_decrement},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x03979AACDBB24FAFLL, "mailparse_msg_get_part", &ci_mailparse_msg_get_part},
+  {0x10F7244AA9CB5803LL, "imagepstext", &ci_imagepstext},
+  {0x4AD554CBAB9CC089LL, "call_user_method_array", &ci_call_user_method_array},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1FD3FB2AB0F48CD2LL, "magickgetimagesignature", &ci_magickgetimagesignature},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x50296037C7968C9ELL, "preg_split", &ci_preg_split},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x460470C490FAFFC2LL, "dom_node_normalize", &ci_dom_node_normalize},
+  {-1, NULL, NULL},
+  {0x079EA27F72594F46LL, "gzgets", &ci_gzgets},
+  {-1, NULL, NULL},
+  {0x2D8DF100C30D06C9LL, "xmlwriter_set_indent_string", &ci_xmlwriter_set_indent_string},
+  {-1, NULL, NULL},
+  {0x1C30C8470100ECF7LL, "mcrypt_enc_is_block_mode", &ci_mcrypt_enc_is_block_mode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0E0C79E42812235ALL, "imagepng", &ci_imagepng},
+  {-1, NULL, NULL},
+  {0x78463112BE739F91LL, "connection_timeout", &ci_connection_timeout},
+  {-1, NULL, NULL},
+  {0x16BA422EB6C51AFDLL, "gzwrite", &ci_gzwrite},
+  {0x51FD8C9B5109F856LL, "dom_characterdata_replace_data", &ci_dom_characterdata_replace_data},
+  {0x414C2E31304E9A7DLL, "stream_get_filters", &ci_stream_get_filters},
+  {0x17C0D9B1C10B872ALL, "openssl_x509_export", &ci_openssl_x509_export},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1B1B2D70792D9563LL, "mysql_get_client_info", &ci_mysql_get_client_info},
+  {0x16A18007E10F48E4LL, "socket_getsockname", &ci_socket_getsockname},
+  {0x3033FE14E114FCC0LL, "magicksetimageblueprimary", &ci_magicksetimageblueprimary},
+  {0x57E8781CF111727FLL, "fileowner", &ci_fileowner},
+  {-1, NULL, NULL},
+  {0x76675F14C1138B14LL, "gzuncompress", &ci_gzuncompress},
+  {0x33FD10AC81146EF8LL, "thrift_protocol_read_binary", &ci_thrift_protocol_read_binary},
+  {0x7F4C1DF551150E46LL, "pixelgetnextiteratorrow", &ci_pixelgetnextiteratorrow},
+  {-1, NULL, NULL},
+  {0x632D4FC346797EABLL, "pixelgetexceptionstring", &ci_pixelgetexceptionstring},
+  {-1, NULL, NULL},
+  {0x27A4633381195F1BLL, "chown", &ci_chown},
+  {0x0E863EF8C11A598BLL, "is_writable", &ci_is_writable},
+  {-1, NULL, NULL},
+  {0x63E554E0F11CE838LL, "mysql_unbuffered_query", &ci_mysql_unbuffered_query},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6254E9BDC11F3E97LL, "imagecreatefromgd2", &ci_imagecreatefromgd2},
+  {0x2497295AC9F72DDCLL, "stream_set_blocking", &ci_stream_set_blocking},
+  {-1, NULL, NULL},
+  {0x5CC8BA5ADFAC0064LL, "imagegrabscreen", &ci_imagegrabscreen},
+  {0x6776C27C6123D531LL, "dl", &ci_dl},
+  {0x386378F2BA3234A9LL, "magickevaluateimage", &ci_magickevaluateimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5DAC1C64D8F08C4ELL, "openssl_pkey_get_private", &ci_openssl_pkey_get_private},
+  {0x6AF50085AC2AC761LL, "xmlwriter_write_element", &ci_xmlwriter_write_element},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4C3B6BE9112E63CBLL, "str_split", &ci_str_split},
+  {0x767806D6F1053C81LL, "sin", &ci_sin},
+  {0x43461C4D9130103ELL, "exit", &ci_exit},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5C5B0CC85133B9CALL, "mkdir", &ci_mkdir},
+  {-1, NULL, NULL},
+  {0x21DBCE74EB1FC95DLL, "xmlwriter_text", &ci_xmlwriter_text},
+  {0x38BBEE42F136D6A7LL, "magickgetimageblueprimary", &ci_magickgetimageblueprimary},
+  {-1, NULL, NULL},
+  {0x652C331CE138362FLL, "is_string", &ci_is_string},
+  {0x7D4D28D561392124LL, "drawsettextalignment", &ci_drawsettextalignment},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4B30FBA18042E346LL, "session_cache_expire", &ci_session_cache_expire},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6B4DE6865142285ELL, "destroypixeliterator", &ci_destroypixeliterator},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x166D5E2336878690LL, "imagepolygon", &ci_imagepolygon},
+  {0x21E44C7C7A911BD8LL, "phpinfo", &ci_phpinfo},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7CA1300231493693LL, "imap_get_quota", &ci_imap_get_quota},
+  {-1, NULL, NULL},
+  {0x7FC00035D14B9FD6LL, "apc_delete_file", &ci_apc_delete_file},
+  {0x34BA3AAA6711C795LL, "dom_document_create_entity_reference", &ci_dom_document_create_entity_reference},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6E6C0E9A715073B6LL, "dom_xpath_register_php_functions", &ci_dom_xpath_register_php_functions},
+  {0x21EFB0B9D1514426LL, "magicksetpassphrase", &ci_magicksetpassphrase},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5B7F6E0A642BBBF9LL, "sleep", &ci_sleep},
+  {0x52401023E146AAD8LL, "xmlwriter_end_dtd", &ci_xmlwriter_end_dtd},
+  {0x46EC26486531ABF4LL, "imap_deletemailbox", &ci_imap_deletemailbox},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4C024573FCD5B3F8LL, "var_dump", &ci_var_dump},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1AE08377A1630DD7LL, "mysql_insert_id", &ci_mysql_insert_id},
+  {-1, NULL, NULL},
+  {0x480797DB7165A0F9LL, "xmlwriter_set_indent", &ci_xmlwriter_set_indent},
+  {-1, NULL, NULL},
+  {0x28DE19828167FB7DLL, "magickmapimage", &ci_magickmapimage},
+  {0x6A351AEDFC4D0D8ELL, "magickgetimagemimetype", &ci_magickgetimagemimetype},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0C16C797916C2977LL, "posix_setegid", &ci_posix_setegid},
+  {0x517941D034E3015DLL, "iterator_to_array", &ci_iterator_to_array},
+  {0x67C1ED9B816E503ELL, "md5_file", &ci_md5_file},
+  {-1, NULL, NULL},
+  {0x41E394B12170BE14LL, "socket_send", &ci_socket_send},
+  {0x7CDF1FB642529A45LL, "dom_characterdata_insert_data", &ci_dom_characterdata_insert_data},
+  {0x5088945958DD4A57LL, "mktime", &ci_mktime},
+  {-1, NULL, NULL},
+  {0x261F403C4174D264LL, "posix_getsid", &ci_posix_getsid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6C6B4B739AE1B8A7LL, "curl_close", &ci_curl_close},
+  {-1, NULL, NULL},
+  {0x6C4B9D0271790EE4LL, "imap_rfc822_parse_adrlist", &ci_imap_rfc822_parse_adrlist},
+  {0x632D50B69429ED29LL, "socket_set_block", &ci_socket_set_block},
+  {0x557A08AC57724667LL, "hphp_splfileinfo_getpathinfo", &ci_hphp_splfileinfo_getpathinfo},
+  {0x4894583F517C6A4CLL, "intl_get_error_code", &ci_intl_get_error_code},
+  {-1, NULL, NULL},
+  {0x04F822B7817E5911LL, "bindec", &ci_bindec},
+  {-1, NULL, NULL},
+  {0x7964DE73DCA17DBALL, "magickhasnextimage", &ci_magickhasnextimage},
+  {0x132776D93181E57ELL, "ldap_set_option", &ci_ldap_set_option},
+  {-1, NULL, NULL},
+  {0x470F990B218315E5LL, "fb_unset_taint", &ci_fb_unset_taint},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x36B9C440B1881401LL, "fmod", &ci_fmod},
+  {0x00CFD56391DF82F9LL, "mysql_data_seek", &ci_mysql_data_seek},
+  {0x333FB673518A1B55LL, "ldap_get_entries", &ci_ldap_get_entries},
+  {0x79A4E240F18BAC28LL, "rand", &ci_rand},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4F1E663AE18FD315LL, "msg_remove_queue", &ci_msg_remove_queue},
+  {0x734FD402E190E3D3LL, "evhttp_async_get", &ci_evhttp_async_get},
+  {-1, NULL, NULL},
+  {0x55FAF12AF1920AA0LL, "sha1_file", &ci_sha1_file},
+  {0x1D583AA4F7F6547ELL, "drawpathlinetorelative", &ci_drawpathlinetorelative},
+  {-1, NULL, NULL},
+  {0x784F675D436004ECLL, "imap_close", &ci_imap_close},
+  {0x6D265875A19685D6LL, "is_float", &ci_is_float},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x072690BF719D7DFELL, "hphp_recursivedirectoryiterator_rewind", &ci_hphp_recursivedirectoryiterator_rewind},
+  {0x5B1DFB89BFC1CE68LL, "realpath", &ci_realpath},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0D4891A5E1A20792LL, "get_defined_functions", &ci_get_defined_functions},
+  {-1, NULL, NULL},
+  {0x5A6EFF8C71A431ADLL, "socket_get_status", &ci_socket_get_status},
+  {0x1A90213EE1A56083LL, "array_pop", &ci_array_pop},
+  {0x152D1AB941A647C0LL, "hphp_get_extension_info", &ci_hphp_get_extension_info},
+  {-1, NULL, NULL},
+  {0x677F33E78342A0C7LL, "function_exists", &ci_function_exists},
+  {0x2F29627AF1A97619LL, "shm_attach", &ci_shm_attach},
+  {0x21B07F1F212BDE57LL, "hphp_get_original_class_name", &ci_hphp_get_original_class_name},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x04C0582DB1AD7BF0LL, "mt_srand", &ci_mt_srand},
+  {0x3F56AF1511AEDBBELL, "magicklabelimage", &ci_magicklabelimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3F9C5B4708FC55B5LL, "timezone_name_get", &ci_timezone_name_get},
+  {-1, NULL, NULL},
+  {0x3617DAE43A23D1C4LL, "xml_parser_set_option", &ci_xml_parser_set_option},
+  {0x060619D7A1B5F4B1LL, "checkdate", &ci_checkdate},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x134B37520683DED6LL, "imagesetbrush", &ci_imagesetbrush},
+  {0x131D11F79A8801E3LL, "mb_http_output", &ci_mb_http_output},
+  {0x4234F2B59531FFD8LL, "posix_getlogin", &ci_posix_getlogin},
+  {-1, NULL, NULL},
+  {0x3E65EF9761BE5A38LL, "pixelgetiteratorexceptiontype", &ci_pixelgetiteratorexceptiontype},
+  {-1, NULL, NULL},
+  {0x4C06B4AFC1C08873LL, "str_shuffle", &ci_str_shuffle},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x560637BE51C36CB6LL, "ezmlm_hash", &ci_ezmlm_hash},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2B130322DEC4B09FLL, "pixelgetopacityquantum", &ci_pixelgetopacityquantum},
+  {0x56B908FC91C834D8LL, "magickflopimage", &ci_magickflopimage},
+  {0x08AA4EA901C9B079LL, "session_encode", &ci_session_encode},
+  {-1, NULL, NULL},
+  {0x0BD9C5D811CB04F7LL, "dom_element_set_id_attribute_ns", &ci_dom_element_set_id_attribute_ns},
+  {0x0664323CB1CC2FBALL, "imagecolorset", &ci_imagecolorset},
+  {0x7DFF9707F1CD9EF0LL, "dangling_server_proxy_old_request", &ci_dangling_server_proxy_old_request},
+  {-1, NULL, NULL},
+  {0x1D803CE961921765LL, "md5", &ci_md5},
+  {0x5067A65AD1D0297ELL, "pixelgetiteratorexception", &ci_pixelgetiteratorexception},
+  {0x5025B43B46679B77LL, "openssl_x509_free", &ci_openssl_x509_free},
+  {0x1FBF8A270331C2A2LL, "write_hdf_file", &ci_write_hdf_file},
+  {0x32643AE461D3F46ALL, "mailparse_stream_encode", &ci_mailparse_stream_encode},
+  {0x52DCFB6F41D41809LL, "dom_characterdata_append_data", &ci_dom_characterdata_append_data},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1FF03B7DE19DD74ALL, "drawpathmovetorelative", &ci_drawpathmovetorelative},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5998E61D600D634DLL, "drawaffine", &ci_drawaffine},
+  {-1, NULL, NULL},
+  {0x5860ACF621DD948BLL, "is_file", &ci_is_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0F7E33D551E0727CLL, "posix_getpid", &ci_posix_getpid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1A80392751AA7701LL, "magickgetformat", &ci_magickgetformat},
+  {-1, NULL, NULL},
+  {0x43B74276235F4BBCLL, "is_bool", &ci_is_bool},
+  {-1, NULL, NULL},
+  {0x6C1415DAD1E7C9F2LL, "fb_get_flush_stat", &ci_fb_get_flush_stat},
+  {0x564D8D3DA1E8E99BLL, "xml_get_current_line_number", &ci_xml_get_current_line_number},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1C6246FA51EBDE25LL, "hphp_get_static_property", &ci_hphp_get_static_property},
+  {0x32354CC291ECF38BLL, "fb_intercept", &ci_fb_intercept},
+  {-1, NULL, NULL},
+  {0x214532C4A2BC28FBLL, "ldap_next_entry", &ci_ldap_next_entry},
+  {0x6884FAF0D1EF3179LL, "posix_mknod", &ci_posix_mknod},
+  {-1, NULL, NULL},
+  {0x1371413B4F6F8D5CLL, "pixelgetred", &ci_pixelgetred},
+  {-1, NULL, NULL},
+  {0x0E80D04691227536LL, "eval", &ci_eval},
+  {0x26DD46D8C1F47152LL, "ldap_bind", &ci_ldap_bind},
+  {0x0C6F751411F5E30BLL, "strrev", &ci_strrev},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1D2C305EA5C82397LL, "idn_to_utf8", &ci_idn_to_utf8},
+  {-1, NULL, NULL},
+  {0x6751946191FBE5CBLL, "override_function", &ci_override_function},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2987B15E11FE890BLL, "clock_settime", &ci_clock_settime},
+  {-1, NULL, NULL},
+  {0x081D5EA9920076BELL, "drawgetfillalpha", &ci_drawgetfillalpha},
+  {0x32458C11C6E74B03LL, "pixelsetblackquantum", &ci_pixelsetblackquantum},
+  {0x268706C46202C475LL, "sem_acquire", &ci_sem_acquire},
+  {0x376FB2649384A7F9LL, "str_pad", &ci_str_pad},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x10E7B5A0E29CF2A3LL, "bcscale", &ci_bcscale},
+  {0x283E167EB3F04EFDLL, "posix_getgid", &ci_posix_getgid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x67B879A1120C190BLL, "headers_sent", &ci_headers_sent},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1765A63835CC4E84LL, "drawgetfontfamily", &ci_drawgetfontfamily},
+  {-1, NULL, NULL},
+  {0x44BC069A75EE98AALL, "xhprof_disable", &ci_xhprof_disable},
+  {0x66D59E4DBC7382FCLL, "drawscale", &ci_drawscale},
+  {0x1491ED033E39465ELL, "dom_document_schema_validate_xml", &ci_dom_document_schema_validate_xml},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0F71D3E47044E29CLL, "drawpathcurvetosmoothrelative", &ci_drawpathcurvetosmoothrelative},
+  {-1, NULL, NULL},
+  {0x1DC8A386E219C579LL, "ldap_add", &ci_ldap_add},
+  {0x4A694B42B21A9E19LL, "destroymagickwand", &ci_destroymagickwand},
+  {0x1C31A9E1207209D3LL, "mb_split", &ci_mb_split},
+  {0x6B268C26E21C1078LL, "arsort", &ci_arsort},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x29E2771785CCBEDALL, "magickgettextdescent", &ci_magickgettextdescent},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3E0C793B95A9713BLL, "imap_bodystruct", &ci_imap_bodystruct},
+  {0x7C565AD57BC84943LL, "pixelsetindex", &ci_pixelsetindex},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x74F20C284227219BLL, "similar_text", &ci_similar_text},
+  {0x48E30DE7A228BB5FLL, "spl_autoload_register", &ci_spl_autoload_register},
+  {0x567A7139AD476843LL, "socket_listen", &ci_socket_listen},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7D8DCC72522CBD73LL, "mb_detect_encoding", &ci_mb_detect_encoding},
+  {0x07F83D5C022D8336LL, "mysql_async_wait", &ci_mysql_async_wait},
+  {0x2052D8D4822EF392LL, "is_subclass_of", &ci_is_subclass_of},
+  {0x4B1501C4C22FFA94LL, "quoted_printable_encode", &ci_quoted_printable_encode},
+  {-1, NULL, NULL},
+  {0x1FF5B9A4FC78BF21LL, "drawsettextantialias", &ci_drawsettextantialias},
+  {0x014BD9A6823256F0LL, "extract", &ci_extract},
+  {0x3DF488365DAAF1CCLL, "drawgettextencoding", &ci_drawgettextencoding},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x505B44DDF2383BEBLL, "drawgetfillcolor", &ci_drawgetfillcolor},
+  {0x1D626FADDFCA11DCLL, "imap_num_msg", &ci_imap_num_msg},
+  {0x25CA0794823AA2F0LL, "openssl_csr_get_public_key", &ci_openssl_csr_get_public_key},
+  {0x349A0DF6723B6804LL, "pixelsetcolorcount", &ci_pixelsetcolorcount},
+  {0x08CC1E49661DB273LL, "dom_element_get_attribute_ns", &ci_dom_element_get_attribute_ns},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4B57E07A323FE7F3LL, "drawpathlinetoverticalabsolute", &ci_drawpathlinetoverticalabsolute},
+  {0x7084C6294240CDA0LL, "octdec", &ci_octdec},
+  {0x309E780586D6C161LL, "socket_set_nonblock", &ci_socket_set_nonblock},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x032DFAC5B24679CBLL, "header_remove", &ci_header_remove},
+  {0x3E5C990C32470DCELL, "array_combine", &ci_array_combine},
+  {0x4C915E3480E94018LL, "mb_substr_count", &ci_mb_substr_count},
+  {-1, NULL, NULL},
+  {0x2B31A877824A1119LL, "stristr", &ci_stristr},
+  {0x0DB9DD4AE24B0240LL, "base64_encode", &ci_base64_encode},
+  {-1, NULL, NULL},
+  {0x6FE3C5FF5E883BD2LL, "round", &ci_round},
+  {0x56EDB60C824E8C51LL, "key", &ci_key},
+  {0x0DD7A2DB53093696LL, "utf8_decode", &ci_utf8_decode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x442B1E05FC146B31LL, "stream_context_set_param", &ci_stream_context_set_param},
+  {0x22607B4EE253DF2CLL, "imap_savebody", &ci_imap_savebody},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x567276D68FE12D60LL, "preg_quote", &ci_preg_quote},
+  {-1, NULL, NULL},
+  {0x6F9651265C096F97LL, "magickreadimages", &ci_magickreadimages},
+  {0x57A9E8878872D34BLL, "parse_ini_file", &ci_parse_ini_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5351290CD139A4B9LL, "mb_strrpos", &ci_mb_strrpos},
+  {0x7AAC29849263C4C3LL, "getprotobyname", &ci_getprotobyname},
+  {-1, NULL, NULL},
+  {0x15EC581662651C3ELL, "date_parse", &ci_date_parse},
+  {0x576C5DC462663CD1LL, "explode", &ci_explode},
+  {0x55814D0EC267B9FCLL, "imap_status", &ci_imap_status},
+  {0x15B61E061268B16ELL, "magickenhanceimage", &ci_magickenhanceimage},
+  {-1, NULL, NULL},
+  {0x41B5E3D2AADE2D5BLL, "drawroundrectangle", &ci_drawroundrectangle},
+  {-1, NULL, NULL},
+  {0x534C1A5E626C26F6LL, "collator_get_error_code", &ci_collator_get_error_code},
+  {-1, NULL, NULL},
+  {0x658444BB4E29E11ELL, "openssl_free_key", &ci_openssl_free_key},
+  {0x4330CE9C9002477ALL, "array_udiff_uassoc", &ci_array_udiff_uassoc},
+  {-1, NULL, NULL},
+  {0x6A3412DE82715948LL, "openssl_x509_checkpurpose", &ci_openssl_x509_checkpurpose},
+  {0x0D8B1D0A8C381817LL, "stream_bucket_new", &ci_stream_bucket_new},
+  {0x6BB8AC68771287E9LL, "strcmp", &ci_strcmp},
+  {0x7056E766A274895ALL, "virtual", &ci_virtual},
+  {-1, NULL, NULL},
+  {0x5E0C6E797607DDBALL, "mysql_result", &ci_mysql_result},
+  {-1, NULL, NULL},
+  {0x0A5EFECAE87EA6ECLL, "hphp_splfileobject_eof", &ci_hphp_splfileobject_eof},
+  {-1, NULL, NULL},
+  {0x438CD1A0327A8211LL, "apc_define_constants", &ci_apc_define_constants},
+  {0x0F8242C6327B5C93LL, "dns_check_record", &ci_dns_check_record},
+  {0x1382CEA1527CFA99LL, "imap_utf7_encode", &ci_imap_utf7_encode},
+  {0x2B661CD43C6006EDLL, "hphpd_break", &ci_hphpd_break},
+  {-1, NULL, NULL},
+  {0x43B1BAFFB27F367CLL, "session_is_registered", &ci_session_is_registered},
+  {0x16BE0DBA42800692LL, "magickgetimagesize", &ci_magickgetimagesize},
+  {-1, NULL, NULL},
+  {0x33A532FDB8EAC304LL, "memcache_delete", &ci_memcache_delete},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x02BEFBEE8287D3CELL, "get_magic_quotes_runtime", &ci_get_magic_quotes_runtime},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x43672229728A648FLL, "drawpushpattern", &ci_drawpushpattern},
+  {0x32AD0455A7689A68LL, "magickoilpaintimage", &ci_magickoilpaintimage},
+  {0x3A5D921797669C1FLL, "hphp_log", &ci_hphp_log},
+  {0x38498DD4C28D0FC5LL, "hphp_splfileinfo_getatime", &ci_hphp_splfileinfo_getatime},
+  {0x0125F8B9428E416ELL, "hphp_create_object", &ci_hphp_create_object},
+  {0x38246B6BDE246F59LL, "magickgetimagedispose", &ci_magickgetimagedispose},
+  {0x5B9B2C3B32906911LL, "drawsetfillpatternurl", &ci_drawsetfillpatternurl},
+  {0x319407AC92912F67LL, "ereg", &ci_ereg},
+  {0x315CCBC8C5C7D0F3LL, "xmlwriter_write_raw", &ci_xmlwriter_write_raw},
+  {-1, NULL, NULL},
+  {0x732DAA2292946EB3LL, "imap_header", &ci_imap_header},
+  {0x1FE65AFCC92967DCLL, "rmdir", &ci_rmdir},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5BFDE63106CE713FLL, "dom_element_get_attribute", &ci_dom_element_get_attribute},
+  {0x79AD7C6D77A3A993LL, "imap_reopen", &ci_imap_reopen},
+  {0x4CF625DF902F8CC8LL, "imap_get_quotaroot", &ci_imap_get_quotaroot},
+  {-1, NULL, NULL},
+  {0x3D6D684AF537A7C6LL, "ldap_explode_dn", &ci_ldap_explode_dn},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7D1FAF3322A360D2LL, "hphp_splfileobject___construct", &ci_hphp_splfileobject___construct},
+  {-1, NULL, NULL},
+  {0x5CA55E62F2A5953CLL, "drawgetstrokeopacity", &ci_drawgetstrokeopacity},
+  {0x575C5AE3D2A694D8LL, "ob_end_clean", &ci_ob_end_clean},
+  {0x3238A5BD362443AALL, "escapeshellcmd", &ci_escapeshellcmd},
+  {0x57BA0BC1A4870691LL, "magickgetquantumdepth", &ci_magickgetquantumdepth},
+  {0x7817FA38BAAEFE2DLL, "fsockopen", &ci_fsockopen},
+  {0x2755DD4112AA5F8BLL, "magicksampleimage", &ci_magicksampleimage},
+  {-1, NULL, NULL},
+  {0x78183A24F2ACB243LL, "strtotime", &ci_strtotime},
+  {-1, NULL, NULL},
+  {0x7C48F6EA39B7B5F8LL, "magickadaptivethresholdimage", &ci_magickadaptivethresholdimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x66273C5932B1FCCELL, "clock_gettime", &ci_clock_gettime},
+  {0x49A45F75B2B25B3ALL, "apd_breakpoint", &ci_apd_breakpoint},
+  {0x46AFE55982B371F2LL, "posix_geteuid", &ci_posix_geteuid},
+  {-1, NULL, NULL},
+  {0x44530C37F2B522B3LL, "drawgetstrokedasharray", &ci_drawgetstrokedasharray},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3FC127C442BAEA22LL, "session_id", &ci_session_id},
+  {-1, NULL, NULL},
+  {0x23511F83C2BC548DLL, "header", &ci_header},
+  {0x04534F26B8D05C50LL, "drawgetstrokecolor", &ci_drawgetstrokecolor},
+  {0x474566F3A2BE0FCDLL, "mcrypt_enc_is_block_algorithm", &ci_mcrypt_enc_is_block_algorithm},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x20E2B1D920122543LL, "die", &ci_die},
+  {-1, NULL, NULL},
+  {0x7FCAAAB932C57D77LL, "iterator_count", &ci_iterator_count},
+  {-1, NULL, NULL},
+  {0x488BFCC942C73851LL, "gzopen", &ci_gzopen},
+  {0x4363FF80EEC953D2LL, "imap_undelete", &ci_imap_undelete},
+  {0x74F0D6D8F1F2709ELL, "drawsetstrokedashoffset", &ci_drawsetstrokedashoffset},
+  {0x15EF510022CAF210LL, "xml_parser_create_ns", &ci_xml_parser_create_ns},
+  {0x160A82E3E2CBBAEELL, "is_finite", &ci_is_finite},
+  {-1, NULL, NULL},
+  {0x1F98B41362CDA72ALL, "magickgetimagegreenprimary", &ci_magickgetimagegreenprimary},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0B88D3F582D16A04LL, "memcache_get_extended_stats", &ci_memcache_get_extended_stats},
+  {0x528AC8D252D224F5LL, "log10", &ci_log10},
+  {0x0D95DD13A2D3BBA4LL, "drawtranslate", &ci_drawtranslate},
+  {0x0012B121E023458ELL, "hphp_set_iostatus_address", &ci_hphp_set_iostatus_address},
+  {0x4F3C0DB2F6C8F70DLL, "unlink", &ci_unlink},
+  {0x5B7C1B74BA3452C0LL, "newpixelregioniterator", &ci_newpixelregioniterator},
+  {-1, NULL, NULL},
+  {0x1A9EFDD653DB8F3FLL, "pcntl_wstopsig", &ci_pcntl_wstopsig},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5543A0CACD153B6BLL, "substr_replace", &ci_substr_replace},
+  {0x1AD83CBEA1E87B79LL, "imap_getmailboxes", &ci_imap_getmailboxes},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x43D1339C52E309A3LL, "hphp_service_thread_started", &ci_hphp_service_thread_started},
+  {-1, NULL, NULL},
+  {0x10DF7941C3F3E0A2LL, "socket_bind", &ci_socket_bind},
+  {0x42684202E2E62BBELL, "mcrypt_get_iv_size", &ci_mcrypt_get_iv_size},
+  {0x632D491E42E7E84FLL, "session_get_cookie_params", &ci_session_get_cookie_params},
+  {-1, NULL, NULL},
+  {0x6F242340B2E930DALL, "hphp_splfileinfo_setfileclass", &ci_hphp_splfileinfo_setfileclass},
+  {0x268EE73DB2EA555ALL, "get_object_vars", &ci_get_object_vars},
+  {0x11DA0A0EB8E0D6E1LL, "clock_getres", &ci_clock_getres},
+  {0x0DC2C2D372EC97EDLL, "hphp_crash_log", &ci_hphp_crash_log},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x01D2367A02F0A9A2LL, "magicksetsize", &ci_magicksetsize},
+  {0x03F50E435DE20BEELL, "magickclippathimage", &ci_magickclippathimage},
+  {0x11EC19E702F2C80DLL, "getmyinode", &ci_getmyinode},
+  {0x5E4360FC28D0AD90LL, "magicksetinterlacescheme", &ci_magicksetinterlacescheme},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x146109BDD2F97D58LL, "hphp_splfileobject_setmaxlinelen", &ci_hphp_splfileobject_setmaxlinelen},
+  {0x68B7597C22FA484BLL, "openssl_public_encrypt", &ci_openssl_public_encrypt},
+  {0x53BA3992F8C240EALL, "imagegrabwindow", &ci_imagegrabwindow},
+  {0x6842585E79988F05LL, "magickmosaicimages", &ci_magickmosaicimages},
+  {0x64E390E5F2FDC0CELL, "ismagickwand", &ci_ismagickwand},
+  {-1, NULL, NULL},
+  {0x3D3AD12E52FF294DLL, "imagecreatefromwbmp", &ci_imagecreatefromwbmp},
+  {0x7C6B37BF6300AC6BLL, "iconv_mime_encode", &ci_iconv_mime_encode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0FD7C3144B4007FALL, "libxml_set_streams_context", &ci_libxml_set_streams_context},
+  {-1, NULL, NULL},
+  {0x746DC7AD953EA536LL, "memcache_set_compress_threshold", &ci_memcache_set_compress_threshold},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x25DF28703309C39BLL, "idate", &ci_idate},
+  {0x737253E9FC112CA3LL, "socket_close", &ci_socket_close},
+  {0x7E773A36449576B5LL, "imagecharup", &ci_imagecharup},
+  {0x308D76DB12424EA9LL, "magicksetimageindex", &ci_magicksetimageindex},
+  {0x12F502A88E0AA599LL, "magickcompositeimage", &ci_magickcompositeimage},
+  {0x0ED4D905630EB75BLL, "openssl_random_pseudo_bytes", &ci_openssl_random_pseudo_bytes},
+  {0x357BAB6E700EBD61LL, "destroypixelwandarray", &ci_destroypixelwandarray},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x175B86BCB3124537LL, "magickgetexceptionstring", &ci_magickgetexceptionstring},
+  {-1, NULL, NULL},
+  {0x21B3935EB3140570LL, "mysql_fetch_object", &ci_mysql_fetch_object},
+  {0x13048F0A79F7CE3ALL, "magicksetsamplingfactors", &ci_magicksetsamplingfactors},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0ED729A444C611E1LL, "openssl_x509_read", &ci_openssl_x509_read},
+  {0x7C833A303C7CFBAALL, "getrandmax", &ci_getrandmax},
+  {0x03BE37E94875C3B5LL, "fb_set_exit_callback", &ci_fb_set_exit_callback},
+  {0x30DE78E7131B954FLL, "furchash_hphp_ext_supported", &ci_furchash_hphp_ext_supported},
+  {0x4F7ED8C3156AD8E8LL, "magicksetimagedispose", &ci_magicksetimagedispose},
+  {0x06486B6912479935LL, "zlib_get_coding_type", &ci_zlib_get_coding_type},
+  {0x1A397501431EC7EBLL, "is_numeric", &ci_is_numeric},
+  {0x0A2A4AA078D433A2LL, "hexdec", &ci_hexdec},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0890F9052322E838LL, "fstat", &ci_fstat},
+  {-1, NULL, NULL},
+  {0x31830AA5032428B2LL, "is_double", &ci_is_double},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x45B30CD663284ACALL, "is_int", &ci_is_int},
+  {0x378A73FF98B60044LL, "curl_init", &ci_curl_init},
+  {0x506BBFC1B32AEA50LL, "memcache_replace", &ci_memcache_replace},
+  {-1, NULL, NULL},
+  {0x4BF5DEBDB76EC35ALL, "mcrypt_enc_get_iv_size", &ci_mcrypt_enc_get_iv_size},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x67EAC6D7332F3DB1LL, "hphp_splfileobject_fgetcsv", &ci_hphp_splfileobject_fgetcsv},
+  {0x306F1D92E413A23CLL, "check_user_func_async", &ci_check_user_func_async},
+  {0x7A59813AC331449DLL, "mb_ereg_search_regs", &ci_mb_ereg_search_regs},
+  {0x6A45EB471332A9E9LL, "imagecolorexactalpha", &ci_imagecolorexactalpha},
+  {0x61465CD8C67905C0LL, "openssl_pkey_free", &ci_openssl_pkey_free},
+  {0x54F84DC9A334287DLL, "gzencode", &ci_gzencode},
+  {0x4162939E6335F48DLL, "xhprof_network_disable", &ci_xhprof_network_disable},
+  {0x7E26D48503362975LL, "drawpathcurvetoabsolute", &ci_drawpathcurvetoabsolute},
+  {0x65BD541EAB38E4F1LL, "mysql_close", &ci_mysql_close},
+  {-1, NULL, NULL},
+  {0x7FB39C41E339ADA8LL, "imap_setflag_full", &ci_imap_setflag_full},
+  {0x60BF7CDD733A2989LL, "bzerrstr", &ci_bzerrstr},
+  {0x55B68546CFAC87CALL, "magicksetimageresolution", &ci_magicksetimageresolution},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x54242D2846BC60A3LL, "magickunsharpmaskimage", &ci_magickunsharpmaskimage},
+  {0x3C0DFA15D3447814LL, "rawurldecode", &ci_rawurldecode},
+  {0x4129FFBF3548E22CLL, "mb_strpos", &ci_mb_strpos},
+  {0x4605D48C234606BALL, "dom_document_import_node", &ci_dom_document_import_node},
+  {0x6CD7466174B9A15CLL, "pixelsetredquantum", &ci_pixelsetredquantum},
+  {-1, NULL, NULL},
+  {0x7AE3AE9B634988BCLL, "stream_context_create", &ci_stream_context_create},
+  {-1, NULL, NULL},
+  {0x4E36A077234B8F45LL, "pixelgetblack", &ci_pixelgetblack},
+  {0x7681C631B34CC709LL, "hphp_splfileobject_fflush", &ci_hphp_splfileobject_fflush},
+  {0x249340DF734D9C02LL, "magickgetimageheight", &ci_magickgetimageheight},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x053B14F52350FB37LL, "socket_shutdown", &ci_socket_shutdown},
+  {0x0551AAE8F1A6FF58LL, "magicklevelimage", &ci_magicklevelimage},
+  {-1, NULL, NULL},
+  {0x41276F8DE35354F2LL, "dom_document_get_elements_by_tag_name", &ci_dom_document_get_elements_by_tag_name},
+  {0x63A08D6AD1209508LL, "magickgetexception", &ci_magickgetexception},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5229C0069FD7D46DLL, "vfprintf", &ci_vfprintf},
+  {0x75B299F5E35A95C9LL, "mb_strwidth", &ci_mb_strwidth},
+  {0x249399CEC35B7B1CLL, "png2wbmp", &ci_png2wbmp},
+  {0x3FEBBC0DA79F31DBLL, "fb_call_user_func_safe", &ci_fb_call_user_func_safe},
+  {0x7DE1BEE0C35D010BLL, "pcntl_signal", &ci_pcntl_signal},
+  {0x5EC0A3DD935EEA25LL, "magickresampleimage", &ci_magickresampleimage},
+  {0x0B7BB85A435F8238LL, "bzdecompress", &ci_bzdecompress},
+  {0x22E08DEDF360057DLL, "pixelsetmagenta", &ci_pixelsetmagenta},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5EFE573046B565B5LL, "mcrypt_module_close", &ci_mcrypt_module_close},
+  {-1, NULL, NULL},
+  {0x446D76A95365D2C3LL, "pixelgetyellow", &ci_pixelgetyellow},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x78831282736801D6LL, "stream_context_get_default", &ci_stream_context_get_default},
+  {0x769E5C6A5369F64ELL, "ob_list_handlers", &ci_ob_list_handlers},
+  {0x1B44CF284E9B09E6LL, "interface_exists", &ci_interface_exists},
+  {0x135D5CBF936B11FALL, "msg_receive", &ci_msg_receive},
+  {0x7D3F626E636C084ALL, "ldap_delete", &ci_ldap_delete},
+  {0x4FB6B5C2636D1DFALL, "apc_exists", &ci_apc_exists},
+  {-1, NULL, NULL},
+  {0x30AB38D851C440C8LL, "magickgetimagebackgroundcolor", &ci_magickgetimagebackgroundcolor},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7046755D8374EBD0LL, "ctype_digit", &ci_ctype_digit},
+  {0x552D7CAD93755600LL, "dom_document_create_comment", &ci_dom_document_create_comment},
+  {-1, NULL, NULL},
+  {0x5019A1FBF377C43ALL, "imagepsbbox", &ci_imagepsbbox},
+  {0x600AFF0A6378ABCELL, "is_writeable", &ci_is_writeable},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6E22C6D840B44914LL, "mcrypt_generic_init", &ci_mcrypt_generic_init},
+  {-1, NULL, NULL},
+  {0x19ECDD5A937DD4D6LL, "mailparse_msg_get_part_data", &ci_mailparse_msg_get_part_data},
+  {0x04A0E6E8337E56D4LL, "drawcolor", &ci_drawcolor},
+  {-1, NULL, NULL},
+  {0x25DADFF238A15D1ELL, "collator_create", &ci_collator_create},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3D3BE7A6EBB6544ELL, "openssl_cipher_iv_length", &ci_openssl_cipher_iv_length},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x238E501F2536E7FDLL, "drawsetclippath", &ci_drawsetclippath},
+  {-1, NULL, NULL},
+  {0x772E8BF114FEF513LL, "eregi_replace", &ci_eregi_replace},
+  {0x70448A629A74FB18LL, "ksort", &ci_ksort},
+  {0x71DF0C17F47EDD25LL, "getprotobynumber", &ci_getprotobynumber},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x418EC805C5FD32F4LL, "mcrypt_get_key_size", &ci_mcrypt_get_key_size},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x62C934CD93938E4FLL, "magickimplodeimage", &ci_magickimplodeimage},
+  {0x4590C853C2027482LL, "magickembossimage", &ci_magickembossimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7BDA06BD1F8AD05BLL, "imap_scanmailbox", &ci_imap_scanmailbox},
+  {0x4FBB1F662399A5A8LL, "is_soap_fault", &ci_is_soap_fault},
+  {0x161D8EA3339AB426LL, "apc_cas", &ci_apc_cas},
+  {0x69887F054A1E28E6LL, "strtok", &ci_strtok},
+  {0x2ACAD5A7A8C78A79LL, "qlzuncompress", &ci_qlzuncompress},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x06D5979AB150EBD8LL, "dom_node_lookup_namespace_uri", &ci_dom_node_lookup_namespace_uri},
+  {0x7C5A22328CAB4A87LL, "ereg_replace", &ci_ereg_replace},
+  {0x069EE6F604BA2DC3LL, "array_reverse", &ci_array_reverse},
+  {0x5542AABF33A2F236LL, "stream_filter_remove", &ci_stream_filter_remove},
+  {0x08C1A5A05B6A0A84LL, "ob_get_length", &ci_ob_get_length},
+  {-1, NULL, NULL},
+  {0x2B422699C3A57351LL, "sha1", &ci_sha1},
+  {0x27BFAF1293A60CD9LL, "ldap_get_dn", &ci_ldap_get_dn},
+  {0x4C2AFB2EFDB1B8FCLL, "stripslashes", &ci_stripslashes},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6F4497457F1584A8LL, "dom_element_set_id_attribute_node", &ci_dom_element_set_id_attribute_node},
+  {0x2D15262403ADDD82LL, "drawcomposite", &ci_drawcomposite},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x79F2E516A3B070D8LL, "libxml_disable_entity_loader", &ci_libxml_disable_entity_loader},
+  {0x38373F6643B14E5DLL, "ldap_parse_reference", &ci_ldap_parse_reference},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2E5E5A0FC3B5C4DFLL, "xml_set_character_data_handler", &ci_xml_set_character_data_handler},
+  {0x17BC6942AAE442A5LL, "curl_multi_await", &ci_curl_multi_await},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0CFFD02753B98076LL, "bzread", &ci_bzread},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0D669C546C0EC6B2LL, "proc_terminate", &ci_proc_terminate},
+  {0x27FF9DB54420531ELL, "xml_error_string", &ci_xml_error_string},
+  {0x5FA07E8B63BEAF24LL, "mcrypt_enc_get_modes_name", &ci_mcrypt_enc_get_modes_name},
+  {0x407EF03C23BF92CCLL, "drawpathellipticarcabsolute", &ci_drawpathellipticarcabsolute},
+  {0x5666016FA3C0F137LL, "socket_clear_error", &ci_socket_clear_error},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1C7B8161F3C412C4LL, "dom_document_create_document_fragment", &ci_dom_document_create_document_fragment},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7C5CA3E2E3C8F385LL, "magickflipimage", &ci_magickflipimage},
+  {0x66F099E732977BAELL, "imap_renamemailbox", &ci_imap_renamemailbox},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7FF6C2A693CE119BLL, "magickcyclecolormapimage", &ci_magickcyclecolormapimage},
+  {-1, NULL, NULL},
+  {0x2A483AD7A3D07EB9LL, "magickgetwandsize", &ci_magickgetwandsize},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4A0B5F4676578FB0LL, "imagecolorresolvealpha", &ci_imagecolorresolvealpha},
+  {0x5772A0B8C16DAEAELL, "posix_setuid", &ci_posix_setuid},
+  {0x56DA17241B793C85LL, "mysql_set_timeout", &ci_mysql_set_timeout},
+  {0x6BF7D7B5FBFF77C9LL, "hphp_get_thread_id", &ci_hphp_get_thread_id},
+  {0x35F4A0789F367B3CLL, "drawpathlinetohorizontalrelative", &ci_drawpathlinetohorizontalrelative},
+  {0x44201A16F3D876E7LL, "trim", &ci_trim},
+  {0x128914E131AFFA42LL, "microtime", &ci_microtime},
+  {-1, NULL, NULL},
+  {0x0962EACAE0F0B543LL, "hphp_splfileinfo_getlinktarget", &ci_hphp_splfileinfo_getlinktarget},
+  {-1, NULL, NULL},
+  {0x4EC7C66593DDEE75LL, "sql_regcase", &ci_sql_regcase},
+  {-1, NULL, NULL},
+  {0x4A3D2113D3DFD2BALL, "newpixelwandarray", &ci_newpixelwandarray},
+  {0x0246AF48CD31245DLL, "count_chars", &ci_count_chars},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5A22BA9B012A9BECLL, "dom_document_save_html", &ci_dom_document_save_html},
+  {0x10C82F357BB7E9D3LL, "curl_version", &ci_curl_version},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4E69A952E3EA4847LL, "magicksetfilename", &ci_magicksetfilename},
+  {0x33E08846F3EB42BCLL, "ldap_get_values", &ci_ldap_get_values},
+  {-1, NULL, NULL},
+  {0x3C88F0FAC3EDD539LL, "phpversion", &ci_phpversion},
+  {-1, NULL, NULL},
+  {0x34C52EF423EFD439LL, "proc_open", &ci_proc_open},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x636C871213F37574LL, "mcrypt_encrypt", &ci_mcrypt_encrypt},
+  {0x53FD8C9AC3F4D084LL, "dangling_server_proxy_new_request", &ci_dangling_server_proxy_new_request},
+  {0x44273F8BA3F542CCLL, "imagesx", &ci_imagesx},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2FC27987B3F88767LL, "dom_node_clone_node", &ci_dom_node_clone_node},
+  {0x73210FEAA2EACDC6LL, "imagecolorsforindex", &ci_imagecolorsforindex},
+  {0x3DCCD1FEAD8759D2LL, "array_sum", &ci_array_sum},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x25C0C5E961AFDE6ALL, "xmlwriter_full_end_element", &ci_xmlwriter_full_end_element},
+  {0x1B09A9A533FFA1EDLL, "drawgetexceptiontype", &ci_drawgetexceptiontype},
+  {-1, NULL, NULL},
+  {0x0CE1918B30DF5067LL, "sys_getloadavg", &ci_sys_getloadavg},
+  {-1, NULL, NULL},
+  {0x1FBF36B5D65E677ALL, "fb_call_user_func_safe_return", &ci_fb_call_user_func_safe_return},
+  {-1, NULL, NULL},
+  {0x4D05DD57E4052294LL, "xmlwriter_output_memory", &ci_xmlwriter_output_memory},
+  {0x1F936B3C5406DEB4LL, "fb_set_taint", &ci_fb_set_taint},
+  {0x66137942508EBF01LL, "date_create", &ci_date_create},
+  {-1, NULL, NULL},
+  {0x497E31C70409603ELL, "timezone_name_from_abbr", &ci_timezone_name_from_abbr},
+  {0x0B7D52E2540ABB34LL, "tan", &ci_tan},
+  {-1, NULL, NULL},
+  {0x04D9076808F79775LL, "getenv", &ci_getenv},
+  {0x7BCD0D27FFD953DCLL, "imap_num_recent", &ci_imap_num_recent},
+  {0x0B1348D1540E7D6ELL, "magicksetimageformat", &ci_magicksetimageformat},
+  {0x2E7741B5440FB1CELL, "magicksetlastiterator", &ci_magicksetlastiterator},
+  {-1, NULL, NULL},
+  {0x2D41D7F8F4113210LL, "sinh", &ci_sinh},
+  {-1, NULL, NULL},
+  {0x20D579E7E4131005LL, "imagecolorclosest", &ci_imagecolorclosest},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0E66983DD04B0800LL, "get_current_user", &ci_get_current_user},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x58D0D9B66F045BDELL, "strpos", &ci_strpos},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x11681FDE841D0E40LL, "drawskewy", &ci_drawskewy},
+  {0x1818A3CFBA357A88LL, "magicksetwandsize", &ci_magicksetwandsize},
+  {-1, NULL, NULL},
+  {0x3E62C1A48E9EEE2ELL, "hphp_splfileinfo_getsize", &ci_hphp_splfileinfo_getsize},
+  {0x615723D21421A1A2LL, "sem_remove", &ci_sem_remove},
+  {0x7FA0B63054221E1BLL, "magickrollimage", &ci_magickrollimage},
+  {0x6E8FFA56842304ACLL, "drawgetfont", &ci_drawgetfont},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0547079C94282042LL, "imap_utf7_decode", &ci_imap_utf7_decode},
+  {0x3D8327794429585ELL, "hphpd_install_user_command", &ci_hphpd_install_user_command},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x673A96C50F00FB03LL, "str_word_count", &ci_str_word_count},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4F0DF8BBC4340E64LL, "stream_socket_server", &ci_stream_socket_server},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1636FBA5043CF5AFLL, "ldap_error", &ci_ldap_error},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2A38BA8B4A0F9DC4LL, "apc_fetch", &ci_apc_fetch},
+  {-1, NULL, NULL},
+  {0x525F197D74423E15LL, "get_resource_type", &ci_get_resource_type},
+  {-1, NULL, NULL},
+  {0x367CFD20B4446EE5LL, "is_array", &ci_is_array},
+  {0x7D57A0D72D6254E3LL, "ob_implicit_flush", &ci_ob_implicit_flush},
+  {-1, NULL, NULL},
+  {0x56377FCC2447D493LL, "magicksetimagepixels", &ci_magicksetimagepixels},
+  {-1, NULL, NULL},
+  {0x0E11D317044974B0LL, "magickgetnumberimages", &ci_magickgetnumberimages},
+  {-1, NULL, NULL},
+  {0x12D324CC744BF42CLL, "pixelgetcolorasstring", &ci_pixelgetcolorasstring},
+  {0x4D9C5B9A944CCE7CLL, "convert_uudecode", &ci_convert_uudecode},
+  {0x246EC2B1844DB869LL, "pixelgetexception", &ci_pixelgetexception},
+  {0x703D339DD44E8F5FLL, "dom_element_get_elements_by_tag_name", &ci_dom_element_get_elements_by_tag_name},
+  {0x7B0E6DB649084F7ALL, "clearstatcache", &ci_clearstatcache},
+  {0x488C2F267BF2884ELL, "array_intersect", &ci_array_intersect},
+  {0x1E154D823451B577LL, "magicksetresolution", &ci_magicksetresolution},
+  {0x3F46374E6E1B07BFLL, "posix_getpwuid", &ci_posix_getpwuid},
+  {0x553940FCE453330CLL, "hphp_splfileobject_getmaxlinelen", &ci_hphp_splfileobject_getmaxlinelen},
+  {-1, NULL, NULL},
+  {0x7AE1BE187F18FDF3LL, "fgets", &ci_fgets},
+  {0x4019A6916456339FLL, "dom_node_remove_child", &ci_dom_node_remove_child},
+  {0x073ACDF9B3F06A2CLL, "memcache_setoptimeout", &ci_memcache_setoptimeout},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3ED47399FE1D6AAFLL, "dom_document_create_attribute_ns", &ci_dom_document_create_attribute_ns},
+  {-1, NULL, NULL},
+  {0x0D7BBA9608A36748LL, "magickcombineimages", &ci_magickcombineimages},
+  {0x054503DBBF5CA5D1LL, "imagecopy", &ci_imagecopy},
+  {-1, NULL, NULL},
+  {0x299F1A5895461E5BLL, "curl_multi_close", &ci_curl_multi_close},
+  {0x02ABC00C046291F5LL, "imageellipse", &ci_imageellipse},
+  {0x7F843353646391E8LL, "rad2deg", &ci_rad2deg},
+  {0x3D98ACFCEBB764ADLL, "hphp_set_property", &ci_hphp_set_property},
+  {0x76988956F35329A5LL, "xmlwriter_end_cdata", &ci_xmlwriter_end_cdata},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5D49AF7004696C84LL, "shm_detach", &ci_shm_detach},
+  {0x57105D4E43B078A7LL, "magicksetformat", &ci_magicksetformat},
+  {0x47AB4A08446BD0AELL, "bcmod", &ci_bcmod},
+  {-1, NULL, NULL},
+  {0x5CEA60D9C54A162CLL, "pcntl_wifstopped", &ci_pcntl_wifstopped},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4127DE142CD4A38DLL, "xml_get_error_code", &ci_xml_get_error_code},
+  {0x589E24C7664D5386LL, "doubleval", &ci_doubleval},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6CA22E62D4762FC2LL, "magickpainttransparentimage", &ci_magickpainttransparentimage},
+  {0x61A61E91C477514FLL, "chop", &ci_chop},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x30972530BD557930LL, "shell_exec", &ci_shell_exec},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x77EC28645855AF21LL, "magicksetcompressionquality", &ci_magicksetcompressionquality},
+  {-1, NULL, NULL},
+  {0x5B8F2ABBB480346FLL, "bzwrite", &ci_bzwrite},
+  {-1, NULL, NULL},
+  {0x50088ED5D482C846LL, "ldap_mod_add", &ci_ldap_mod_add},
+  {0x13E90F8874839185LL, "ob_get_status", &ci_ob_get_status},
+  {0x35B661C87484D7D1LL, "openssl_csr_sign", &ci_openssl_csr_sign},
+  {-1, NULL, NULL},
+  {0x757229A894864AF8LL, "session_set_cookie_params", &ci_session_set_cookie_params},
+  {0x1189B7C4F4874FF0LL, "php_check_syntax", &ci_php_check_syntax},
+  {0x7DA08D9D148837ADLL, "posix_mkfifo", &ci_posix_mkfifo},
+  {0x582D10141D5601F3LL, "stream_context_set_option", &ci_stream_context_set_option},
+  {0x25268012A48A99AFLL, "magickclipimage", &ci_magickclipimage},
+  {0x749E45FBD48BEC7BLL, "hphp_recursivedirectoryiterator___tostring", &ci_hphp_recursivedirectoryiterator___tostring},
+  {0x7F5F29D8E63ABB77LL, "mcrypt_module_self_test", &ci_mcrypt_module_self_test},
+  {-1, NULL, NULL},
+  {0x406A1404F48E4465LL, "posix_getuid", &ci_posix_getuid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x41D3B07854936CBBLL, "token_get_all", &ci_token_get_all},
+  {0x319EF52B36AAB2F9LL, "posix_isatty", &ci_posix_isatty},
+  {0x773E3809C4954B15LL, "hphp_recursivedirectoryiterator_current", &ci_hphp_recursivedirectoryiterator_current},
+  {0x763BA2B1C60A55ACLL, "pixelgetalphaquantum", &ci_pixelgetalphaquantum},
+  {0x1FC307200E8959F0LL, "stream_bucket_append", &ci_stream_bucket_append},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x680A7EB3DA1F5D7BLL, "prev", &ci_prev},
+  {0x253AC5D4E450A957LL, "magickgetreleasedate", &ci_magickgetreleasedate},
+  {-1, NULL, NULL},
+  {0x04666D6F67C7A1DDLL, "mysql_list_processes", &ci_mysql_list_processes},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5672949384A4F26ELL, "stream_filter_register", &ci_stream_filter_register},
+  {0x4BD4E9D9D4A56B6ALL, "exif_tagname", &ci_exif_tagname},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x006481EAF2A70BABLL, "ldap_errno", &ci_ldap_errno},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3FFAA982E4B1E8CELL, "date_offset_get", &ci_date_offset_get},
+  {-1, NULL, NULL},
+  {0x66C7616225F1C616LL, "pixelsetgreen", &ci_pixelsetgreen},
+  {0x0D5DAF8034B41AD5LL, "get_include_path", &ci_get_include_path},
+  {0x24F698A8A4B5AF5BLL, "imagecolordeallocate", &ci_imagecolordeallocate},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x116C3EC924B9AC2CLL, "imagegd", &ci_imagegd},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3D3445105C335980LL, "filectime", &ci_filectime},
+  {-1, NULL, NULL},
+  {0x24CE95457EACBB26LL, "get_parent_class", &ci_get_parent_class},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2A019CAA1188BE9BLL, "preg_grep", &ci_preg_grep},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6E27DC1E74C5B0ACLL, "drawpathstart", &ci_drawpathstart},
+  {0x5A0D1AE1D4C6F80ALL, "array_slice", &ci_array_slice},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6F9CF95104CAE9A9LL, "pixelgetyellowquantum", &ci_pixelgetyellowquantum},
+  {0x0CA96856E5BEFBF1LL, "iptcparse", &ci_iptcparse},
+  {0x0FF21F9BE4CCC3D4LL, "call_user_func_rpc", &ci_call_user_func_rpc},
+  {0x0B0B8765A4CDD385LL, "hphp_splfileobject_fgets", &ci_hphp_splfileobject_fgets},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7160AA24D4251B1ELL, "mb_strripos", &ci_mb_strripos},
+  {-1, NULL, NULL},
+  {0x1056EF1C14D2A452LL, "socket_connect", &ci_socket_connect},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x44911AEE34D63228LL, "time_sleep_until", &ci_time_sleep_until},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3B00B916C3682DDDLL, "ctype_upper", &ci_ctype_upper},
+  {0x7585739E84DBF001LL, "imap_delete", &ci_imap_delete},
+  {-1, NULL, NULL},
+  {0x5B1F4C6424DDD8ACLL, "openlog", &ci_openlog},
+  {0x2673FAB2B4DE4694LL, "destroypixelwands", &ci_destroypixelwands},
+  {-1, NULL, NULL},
+  {0x78842C1950B38B35LL, "drawpathfinish", &ci_drawpathfinish},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x345E070844E3F174LL, "create_function", &ci_create_function},
+  {0x1C4AE57BF4E4A82DLL, "apc_dec", &ci_apc_dec},
+  {0x7C1CE38F14E529B1LL, "date_default_timezone_set", &ci_date_default_timezone_set},
+  {-1, NULL, NULL},
+  {0x2418528164415AA5LL, "magickscaleimage", &ci_magickscaleimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x01681C307C5AE4BFLL, "strtoupper", &ci_strtoupper},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1FC855F0E4F1189DLL, "magickminifyimage", &ci_magickminifyimage},
+  {0x0629158C42C893BCLL, "compact", &ci_compact},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0384346A8857D256LL, "clonemagickwand", &ci_clonemagickwand},
+  {-1, NULL, NULL},
+  {0x115CC08BC872FEECLL, "fb_output_compression", &ci_fb_output_compression},
+  {0x47B7D3745D80B9C4LL, "socket_get_option", &ci_socket_get_option},
+  {0x777FE52584FAE065LL, "apc_bin_dump", &ci_apc_bin_dump},
+  {0x280DE04F84FB235FLL, "popdrawingwand", &ci_popdrawingwand},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3A3CFC1F001A6FCFLL, "magickreadimagefile", &ci_magickreadimagefile},
+  {0x76418F884500DF5BLL, "stream_socket_enable_crypto", &ci_stream_socket_enable_crypto},
+  {-1, NULL, NULL},
+  {0x407B1F3AFEC43CCFLL, "pixelgetblue", &ci_pixelgetblue},
+  {0x3C0304A55503D511LL, "magickgetimageiterations", &ci_magickgetimageiterations},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x280EC96FB50A9035LL, "imap_ping", &ci_imap_ping},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x13A6C6CAF50EB92FLL, "imap_search", &ci_imap_search},
+  {0x1DD37E722E11AA69LL, "session_regenerate_id", &ci_session_regenerate_id},
+  {0x5CEFA5A265104D10LL, "count", &ci_count},
+  {0x05C5AD90751159ADLL, "drawpathcurvetoquadraticbeziersmoothabsolute", &ci_drawpathcurvetoquadraticbeziersmoothabsolute},
+  {-1, NULL, NULL},
+  {0x48D57F17C5132339LL, "drawgetclippath", &ci_drawgetclippath},
+  {-1, NULL, NULL},
+  {0x616DDB67073A0776LL, "ord", &ci_ord},
+  {-1, NULL, NULL},
+  {0x3754E97715176AC5LL, "hphp_get_stats", &ci_hphp_get_stats},
+  {-1, NULL, NULL},
+  {0x6465CD999F4C5FB7LL, "hphp_invoke_method", &ci_hphp_invoke_method},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x09A98E99D51E8C2BLL, "hphp_recursivedirectoryiterator_seek", &ci_hphp_recursivedirectoryiterator_seek},
+  {-1, NULL, NULL},
+  {0x3669138315204123LL, "mcrypt_module_get_algo_key_size", &ci_mcrypt_module_get_algo_key_size},
+  {-1, NULL, NULL},
+  {0x7EF68B9A55222F85LL, "wandgetexceptionstring", &ci_wandgetexceptionstring},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x103C12985527295ALL, "hphp_splfileobject_setcsvcontrol", &ci_hphp_splfileobject_setcsvcontrol},
+  {0x3ACD2F1EA5282CAELL, "magickmattefloodfillimage", &ci_magickmattefloodfillimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2884B7B3252B02EELL, "imagealphablending", &ci_imagealphablending},
+  {0x2B451EF5D52C4FB6LL, "array_diff", &ci_array_diff},
+  {-1, NULL, NULL},
+  {0x628069E483F35DB3LL, "hphp_splfileobject_fstat", &ci_hphp_splfileobject_fstat},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6AC751181531F4AFLL, "simplexml_load_string", &ci_simplexml_load_string},
+  {-1, NULL, NULL},
+  {0x0DF945F12533F0A1LL, "abs", &ci_abs},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x13EE24AF67113FFALL, "ob_end_flush", &ci_ob_end_flush},
+  {0x11641BE0F11CD727LL, "magickgammaimage", &ci_magickgammaimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2BC61637253BE9F5LL, "drawgetfontweight", &ci_drawgetfontweight},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2D484921B5400D11LL, "magickradialblurimage", &ci_magickradialblurimage},
+  {0x595E413CAA7E11CFLL, "qlzcompress", &ci_qlzcompress},
+  {0x08069ECE0EA3C5E6LL, "imagecopymergegray", &ci_imagecopymergegray},
+  {-1, NULL, NULL},
+  {0x2D213FD80048F720LL, "usleep", &ci_usleep},
+  {-1, NULL, NULL},
+  {0x34DDF0DFC546033ALL, "xbox_task_start", &ci_xbox_task_start},
+  {-1, NULL, NULL},
+  {0x001DBE44BC0B55B3LL, "magicksetimagecolormapcolor", &ci_magicksetimagecolormapcolor},
+  {0x296C739F28D6C143LL, "drawsetfontsize", &ci_drawsetfontsize},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x00DCD60DD8752B33LL, "set_exception_handler", &ci_set_exception_handler},
+  {0x00621C58E54D44B4LL, "hphp_recursiveiteratoriterator_key", &ci_hphp_recursiveiteratoriterator_key},
+  {-1, NULL, NULL},
+  {0x02A2C373E54FFB39LL, "hash_init", &ci_hash_init},
+  {0x474A096265502DA8LL, "glob", &ci_glob},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0E1C354339208DD0LL, "imagetypes", &ci_imagetypes},
+  {-1, NULL, NULL},
+  {0x126FC82D358E9673LL, "magicksetimagevirtualpixelmethod", &ci_magicksetimagevirtualpixelmethod},
+  {-1, NULL, NULL},
+  {0x472CA39715598A11LL, "mb_eregi_replace", &ci_mb_eregi_replace},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x79215854355CBAC7LL, "proc_get_status", &ci_proc_get_status},
+  {0x6F6C85F4855DE1B4LL, "imap_check", &ci_imap_check},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x34F50577C14C6870LL, "array_diff_uassoc", &ci_array_diff_uassoc},
+  {-1, NULL, NULL},
+  {0x19B643D858DC6D07LL, "magickgetimagerenderingintent", &ci_magickgetimagerenderingintent},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3F0C947E68D02C90LL, "ini_get_all", &ci_ini_get_all},
+  {0x4EF9496D16F9D17FLL, "xmlwriter_start_element_ns", &ci_xmlwriter_start_element_ns},
+  {-1, NULL, NULL},
+  {0x076E66D4089A3B99LL, "mb_stripos", &ci_mb_stripos},
+  {0x267529454569840DLL, "ob_flush", &ci_ob_flush},
+  {-1, NULL, NULL},
+  {0x7039B1C3356B8A4CLL, "hphp_splfileobject_rewind", &ci_hphp_splfileobject_rewind},
+  {0x3E9519FE856C4592LL, "curl_multi_init", &ci_curl_multi_init},
+  {-1, NULL, NULL},
+  {0x44055093E56E4C47LL, "mcrypt_enc_get_key_size", &ci_mcrypt_enc_get_key_size},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2BA9FB0F8B76DD06LL, "number_format", &ci_number_format},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x72882DBF2D49CEEBLL, "set_magic_quotes_runtime", &ci_set_magic_quotes_runtime},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x379F7BF525FF1E82LL, "magicksetimagecolorspace", &ci_magicksetimagecolorspace},
+  {0x3E4AE974AFA9708ELL, "pixelsetquantumcolor", &ci_pixelsetquantumcolor},
+  {-1, NULL, NULL},
+  {0x72B3F8E02D8B16ABLL, "array_unshift", &ci_array_unshift},
+  {-1, NULL, NULL},
+  {0x5BCED33A57D9B67BLL, "intval", &ci_intval},
+  {-1, NULL, NULL},
+  {0x7E6223D0CF184E6FLL, "magickqueryformats", &ci_magickqueryformats},
+  {-1, NULL, NULL},
+  {0x13F52A829BAC0F89LL, "timezone_identifiers_list", &ci_timezone_identifiers_list},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3DCB1C92B5864401LL, "gzrewind", &ci_gzrewind},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3A90CC67D58A021BLL, "hash_hmac_file", &ci_hash_hmac_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4ACE27EC476632CFLL, "apc_bin_dumpfile", &ci_apc_bin_dumpfile},
+  {0x43A96BA7F58EB835LL, "hphp_splfileobject_valid", &ci_hphp_splfileobject_valid},
+  {-1, NULL, NULL},
+  {0x047EF9173590C9A0LL, "session_decode", &ci_session_decode},
+  {0x7071BB6F0591E248LL, "serialize", &ci_serialize},
+  {0x04D1CF7E4592106FLL, "imap_mail_move", &ci_imap_mail_move},
+  {0x3741447B159359B8LL, "mcrypt_get_cipher_name", &ci_mcrypt_get_cipher_name},
+  {-1, NULL, NULL},
+  {0x566465036CCBCD1FLL, "min", &ci_min},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1257DB9F159E9A92LL, "magickmontageimage", &ci_magickmontageimage},
+  {0x257BEA4D6DC9920CLL, "ctype_alnum", &ci_ctype_alnum},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x745910AD5C922062LL, "magickgetmimetype", &ci_magickgetmimetype},
+  {0x29824AAA934CE780LL, "array_filter", &ci_array_filter},
+  {0x69EA8DC005FEC37ALL, "hphp_splfileobject_fwrite", &ci_hphp_splfileobject_fwrite},
+  {0x3C696836396BE7C4LL, "mb_language", &ci_mb_language},
+  {0x19C1872E55A7ECBCLL, "is_long", &ci_is_long},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2C4206A0BD904F20LL, "hphp_splfileobject_fseek", &ci_hphp_splfileobject_fseek},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x45382D0BA5B262E3LL, "mysql_get_proto_info", &ci_mysql_get_proto_info},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6C9AE626DAD02D3BLL, "mailparse_msg_extract_part_file", &ci_mailparse_msg_extract_part_file},
+  {0x4DDB82A3632FA850LL, "atan", &ci_atan},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5B3C354575BB8203LL, "mysql_free_result", &ci_mysql_free_result},
+  {-1, NULL, NULL},
+  {0x0B1F0EB755BDB582LL, "ispixeliterator", &ci_ispixeliterator},
+  {0x5B51DD18C3E13DECLL, "openssl_x509_parse", &ci_openssl_x509_parse},
+  {-1, NULL, NULL},
+  {0x134EF88685C0396FLL, "magickgetexceptiontype", &ci_magickgetexceptiontype},
+  {-1, NULL, NULL},
+  {0x002387F1D23B44FDLL, "mcrypt_list_modes", &ci_mcrypt_list_modes},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x73B43ABDD5C61DA0LL, "shuffle", &ci_shuffle},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1CF3544CB5C9D6E4LL, "xml_set_processing_instruction_handler", &ci_xml_set_processing_instruction_handler},
+  {-1, NULL, NULL},
+  {0x2D8D57FC1DC6CB6FLL, "import_request_variables", &ci_import_request_variables},
+  {0x2E42ED1E15CCFE36LL, "mysql_affected_rows", &ci_mysql_affected_rows},
+  {0x16331E18B5CD8EDBLL, "timezone_open", &ci_timezone_open},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6451BCB825D1787CLL, "chroot", &ci_chroot},
+  {0x6C280D5855D20767LL, "drawsetfillalpha", &ci_drawsetfillalpha},
+  {0x7CE752299E80B70DLL, "unserialize", &ci_unserialize},
+  {0x21B30164F5D49863LL, "is_resource", &ci_is_resource},
+  {0x08F41A00D5D57D10LL, "mb_decode_mimeheader", &ci_mb_decode_mimeheader},
+  {-1, NULL, NULL},
+  {0x02688986D5D76582LL, "magickspreadimage", &ci_magickspreadimage},
+  {0x6406BC03A5D84CD3LL, "dom_element_remove_attribute", &ci_dom_element_remove_attribute},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6497CC8295DDB478LL, "fb_thrift_unserialize", &ci_fb_thrift_unserialize},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3B8E5E63B5E0F87BLL, "spl_autoload_call", &ci_spl_autoload_call},
+  {0x298BA735FA3ABD42LL, "nl_langinfo", &ci_nl_langinfo},
+  {0x6846CA07A5E21BD0LL, "hphp_directoryiterator___construct", &ci_hphp_directoryiterator___construct},
+  {0x7D992445F5E37C46LL, "magicktextureimage", &ci_magicktextureimage},
+  {0x39B11A2A25E40D50LL, "mysql_get_server_info", &ci_mysql_get_server_info},
+  {-1, NULL, NULL},
+  {0x758A62BD65E6FC1CLL, "imagegd2", &ci_imagegd2},
+  {0x2D52FB9B52EC2821LL, "xml_set_notation_decl_handler", &ci_xml_set_notation_decl_handler},
+  {-1, NULL, NULL},
+  {0x1F4AACF075E9CEE3LL, "memcache_get_server_status", &ci_memcache_get_server_status},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x037055C215998332LL, "bcsub", &ci_bcsub},
+  {0x250DD3D58EA37485LL, "gmstrftime", &ci_gmstrftime},
+  {0x4F7230DC25F0E001LL, "magicknormalizeimage", &ci_magicknormalizeimage},
+  {-1, NULL, NULL},
+  {0x39F11BA6A4D778ABLL, "strnatcmp", &ci_strnatcmp},
+  {0x21564F9315F3FC38LL, "drawsettextdecoration", &ci_drawsettextdecoration},
+  {0x38237A4515F42FCBLL, "array_pad", &ci_array_pad},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5EA7052A00E88961LL, "magickgetcopyright", &ci_magickgetcopyright},
+  {0x1D4136B4CEAE4B6BLL, "stripcslashes", &ci_stripcslashes},
+  {0x6794CFB89DEEF343LL, "curl_exec", &ci_curl_exec},
+  {-1, NULL, NULL},
+  {0x689D60184DD81306LL, "htmlspecialchars_decode", &ci_htmlspecialchars_decode},
+  {0x2B5AEDF1A5FC47DDLL, "strripos", &ci_strripos},
+  {0x3AD6E084483B2E0CLL, "array_udiff_assoc", &ci_array_udiff_assoc},
+  {0x384E8BC9B5FE2D7ELL, "magickfximage", &ci_magickfximage},
+  {0x73FEB3BF75FFB328LL, "ctype_space", &ci_ctype_space},
+  {0x542FBDCF960031F5LL, "fprintf", &ci_fprintf},
+  {0x72293DCE8CC4BDEFLL, "htmlspecialchars", &ci_htmlspecialchars},
+  {0x679ABBE5A08C523ALL, "xml_parse_into_struct", &ci_xml_parse_into_struct},
+  {0x436AB52B2099145CLL, "ldap_close", &ci_ldap_close},
+  {0x4215DDB57604F7E7LL, "xmlwriter_start_pi", &ci_xmlwriter_start_pi},
+  {-1, NULL, NULL},
+  {0x08F6B727D60670D9LL, "magicksetimagedepth", &ci_magicksetimagedepth},
+  {0x0B9B362534621C32LL, "isdrawingwand", &ci_isdrawingwand},
+  {0x6B6DA1EE18673D41LL, "xmlwriter_end_dtd_entity", &ci_xmlwriter_end_dtd_entity},
+  {0x6D9B9BE3CED388C7LL, "apc_load_constants", &ci_apc_load_constants},
+  {0x5BFC6198960A5785LL, "in_array", &ci_in_array},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2A1F1B52160DE56ELL, "zend_logo_guid", &ci_zend_logo_guid},
+  {0x7403251412E931DFLL, "syslog", &ci_syslog},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x62519270CC9F1AB2LL, "stream_get_meta_data", &ci_stream_get_meta_data},
+  {-1, NULL, NULL},
+  {0x1D7B8E395613AEA6LL, "dom_element_remove_attribute_ns", &ci_dom_element_remove_attribute_ns},
+  {0x72925D2DF7E61FDELL, "drawpathcurvetoquadraticbeziersmoothrelative", &ci_drawpathcurvetoquadraticbeziersmoothrelative},
+  {0x4F7EAF5B37663489LL, "magickgetimageredprimary", &ci_magickgetimageredprimary},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3BE730D90618202DLL, "collator_sort_with_sort_keys", &ci_collator_sort_with_sort_keys},
+  {-1, NULL, NULL},
+  {0x72D6F9B3661AB2BELL, "magickgetimage", &ci_magickgetimage},
+  {0x4E2C55C92D71F91FLL, "magickcolorfloodfillimage", &ci_magickcolorfloodfillimage},
+  {0x05F3BC04D61CAC7ALL, "get_defined_vars", &ci_get_defined_vars},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x29203294F6214B5BLL, "memcache_debug", &ci_memcache_debug},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7E7BF1BDA6DB49BCLL, "hphp_splfileinfo_getgroup", &ci_hphp_splfileinfo_getgroup},
+  {0x3044E9F91628E151LL, "mb_strlen", &ci_mb_strlen},
+  {0x59ECE01C7629643CLL, "mysql_drop_db", &ci_mysql_drop_db},
+  {0x6A7BDB900E7429C2LL, "magickconstituteimage", &ci_magickconstituteimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0293F60B46511F98LL, "drawsetfontstretch", &ci_drawsetfontstretch},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3978BE548631ECBCLL, "hash_final", &ci_hash_final},
+  {0x1A05907F563235B6LL, "collator_set_attribute", &ci_collator_set_attribute},
+  {0x297690F3A63335A1LL, "magickrotateimage", &ci_magickrotateimage},
+  {-1, NULL, NULL},
+  {0x1C4A162E6635B835LL, "imageftbbox", &ci_imageftbbox},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7C0C145EFE0EBF1FLL, "defined", &ci_defined},
+  {0x60E9E392663921D8LL, "readlink", &ci_readlink},
+  {0x1B8BBFC882FDB4C8LL, "magicktintimage", &ci_magicktintimage},
+  {-1, NULL, NULL},
+  {0x36783304F63C4613LL, "sscanf", &ci_sscanf},
+  {0x6C715D7DD63DA369LL, "is_integer", &ci_is_integer},
+  {0x3076D369F63E65EELL, "pixelgetalpha", &ci_pixelgetalpha},
+  {-1, NULL, NULL},
+  {0x71DCF11E3640C50BLL, "hphp_directoryiterator_valid", &ci_hphp_directoryiterator_valid},
+  {-1, NULL, NULL},
+  {0x5695393CF6428D91LL, "dom_element_set_id_attribute", &ci_dom_element_set_id_attribute},
+  {-1, NULL, NULL},
+  {0x0C8A7BE6ABC957C6LL, "clearpixeliterator", &ci_clearpixeliterator},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2F5144AB3647C20BLL, "dom_text_is_whitespace_in_element_content", &ci_dom_text_is_whitespace_in_element_content},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x751283FE764CAFD5LL, "mysql_select_db", &ci_mysql_select_db},
+  {0x022B16C0D64D7919LL, "file_put_contents", &ci_file_put_contents},
+  {0x0433140BB339DDC3LL, "log", &ci_log},
+  {-1, NULL, NULL},
+  {0x76636D0F0C090E12LL, "curl_copy_handle", &ci_curl_copy_handle},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3AF65A9F3653E4B0LL, "addslashes", &ci_addslashes},
+  {0x0C393EE8F6540D66LL, "bccomp", &ci_bccomp},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4B70746F965E705FLL, "preg_last_error", &ci_preg_last_error},
+  {0x5CC40F6A365FE69ALL, "session_register", &ci_session_register},
+  {0x09637D7CA2E33F00LL, "fgetc", &ci_fgetc},
+  {-1, NULL, NULL},
+  {0x3C042C09F662C6C4LL, "drawsetstrokepatternurl", &ci_drawsetstrokepatternurl},
+  {0x4710320ED6638E85LL, "rename_function", &ci_rename_function},
+  {-1, NULL, NULL},
+  {0x5DB5E45860801186LL, "openssl_csr_export", &ci_openssl_csr_export},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x11C0B5DA066891C8LL, "preg_match_all", &ci_preg_match_all},
+  {0x0A8D4FAF266973D3LL, "bcpow", &ci_bcpow},
+  {0x35C8BD7DFDADEA1FLL, "hphp_directoryiterator_current", &ci_hphp_directoryiterator_current},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x120E7B01366DFC4BLL, "call_user_func_serialized", &ci_call_user_func_serialized},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3DB7EBC0B670C3B2LL, "magicksetimageredprimary", &ci_magicksetimageredprimary},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5D406167C673D368LL, "magickcompareimages", &ci_magickcompareimages},
+  {0x333D4DFD4927898ELL, "magickgetimagewhitepoint", &ci_magickgetimagewhitepoint},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x60302D15A677963ELL, "ldap_free_result", &ci_ldap_free_result},
+  {0x4B6FE37D66784E63LL, "imagesy", &ci_imagesy},
+  {0x53F2C6F5AE244DB3LL, "drawpushdefs", &ci_drawpushdefs},
+  {0x000A2D80D67ADB0CLL, "imap_mail", &ci_imap_mail},
+  {0x4C70C24C84F5511FLL, "magicksetimagegamma", &ci_magicksetimagegamma},
+  {-1, NULL, NULL},
+  {0x57E72C21F67D039FLL, "user_error", &ci_user_error},
+  {-1, NULL, NULL},
+  {0x152C7161567F940DLL, "func_num_args", &ci_func_num_args},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x58D6464A3A9127AALL, "apc_bin_loadfile", &ci_apc_bin_loadfile},
+  {-1, NULL, NULL},
+  {0x65A68A31B96E7867LL, "hash", &ci_hash},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x14279BB1A6872A21LL, "atan2", &ci_atan2},
+  {-1, NULL, NULL},
+  {0x4C9108B5A5807423LL, "drawsetfillcolor", &ci_drawsetfillcolor},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6ECE4BDB8842E986LL, "posix_strerror", &ci_posix_strerror},
+  {0x5D43C0E4868EC2EELL, "forward_static_call", &ci_forward_static_call},
+  {0x344091B785FE8D87LL, "socket_set_timeout", &ci_socket_set_timeout},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x37340B707E7CD1CDLL, "magickgetimagebordercolor", &ci_magickgetimagebordercolor},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5247425ED698B440LL, "hphp_thread_is_warmup_enabled", &ci_hphp_thread_is_warmup_enabled},
+  {0x30C1AE2B06990D9ELL, "gzseek", &ci_gzseek},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x28D343EC901608BALL, "imap_listsubscribed", &ci_imap_listsubscribed},
+  {0x353E2A635A47F497LL, "evhttp_get", &ci_evhttp_get},
+  {0x2BDB1EE3869E132BLL, "restore_error_handler", &ci_restore_error_handler},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x168EDA8238EEE864LL, "mb_detect_order", &ci_mb_detect_order},
+  {0x00141B0E3E6F77AELL, "xml_set_unparsed_entity_decl_handler", &ci_xml_set_unparsed_entity_decl_handler},
+  {0x2C6826999658AA5ELL, "getopt", &ci_getopt},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x34184B42D6AA86C4LL, "mb_ereg_search_pos", &ci_mb_ereg_search_pos},
+  {-1, NULL, NULL},
+  {0x681CD0E7D9DB71BFLL, "pow", &ci_pow},
+  {0x0E09D0FEA30B6AE6LL, "hphp_get_function_info", &ci_hphp_get_function_info},
+  {0x40F0B69D55F7EB53LL, "drawsetstrokealpha", &ci_drawsetstrokealpha},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6077CFE09EE4D3B3LL, "session_save_path", &ci_session_save_path},
+  {-1, NULL, NULL},
+  {0x390A267EC6B51B9FLL, "socket_sendto", &ci_socket_sendto},
+  {-1, NULL, NULL},
+  {0x044B276686B77923LL, "fscanf", &ci_fscanf},
+  {0x47D0510206B89E74LL, "ini_restore", &ci_ini_restore},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x08F7A6C37FC7B1E4LL, "shm_get_var", &ci_shm_get_var},
+  {0x1F3F16CED6BDD64FLL, "imap_utf8", &ci_imap_utf8},
+  {0x33EC567341B9C827LL, "magickgetmaxtextadvance", &ci_magickgetmaxtextadvance},
+  {0x1F61AFCDC510413BLL, "imagefilter", &ci_imagefilter},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x08DC8BF3ADAE520FLL, "getallheaders", &ci_getallheaders},
+  {-1, NULL, NULL},
+  {0x5E6328F2E6C61634LL, "imap_binary", &ci_imap_binary},
+  {0x6DB4EE8696C7E8D4LL, "magicksetimageiterations", &ci_magicksetimageiterations},
+  {0x0B07AD87DF1B5B3FLL, "urldecode", &ci_urldecode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5ACCF9166CD9D043LL, "ftruncate", &ci_ftruncate},
+  {-1, NULL, NULL},
+  {0x608729F27FA428E7LL, "error_get_last", &ci_error_get_last},
+  {0x6CB6650E66CE4EE8LL, "magicksetimagebordercolor", &ci_magicksetimagebordercolor},
+  {-1, NULL, NULL},
+  {0x47A4BA8616D02DE8LL, "restore_exception_handler", &ci_restore_exception_handler},
+  {0x60B8B61133F59108LL, "quoted_printable_decode", &ci_quoted_printable_decode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6B49D11E633274BALL, "fopen", &ci_fopen},
+  {0x07A946E3DD8E968DLL, "ldap_connect", &ci_ldap_connect},
+  {0x40C3C7DE46D62DCELL, "ob_start", &ci_ob_start},
+  {0x2238FC7870E9CAA9LL, "strspn", &ci_strspn},
+  {-1, NULL, NULL},
+  {0x7467E8107EF08D76LL, "unpack", &ci_unpack},
+  {-1, NULL, NULL},
+  {0x11166D3106DB6CD6LL, "wandhasexception", &ci_wandhasexception},
+  {0x5338F971C6DCEAD5LL, "hphp_splfileinfo_islink", &ci_hphp_splfileinfo_islink},
+  {0x07FF92CF46DDFF5DLL, "imagepsfreefont", &ci_imagepsfreefont},
+  {-1, NULL, NULL},
+  {0x7821BD05E5228CEALL, "imagewbmp", &ci_imagewbmp},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x331E7DFBE6E240BBLL, "libxml_get_errors", &ci_libxml_get_errors},
+  {-1, NULL, NULL},
+  {0x368DBC0699272B0DLL, "magicknegateimage", &ci_magicknegateimage},
+  {-1, NULL, NULL},
+  {0x174C510386E6492ALL, "hphp_directoryiterator_key", &ci_hphp_directoryiterator_key},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x47B15A7136E94AE4LL, "strnatcasecmp", &ci_strnatcasecmp},
+  {0x5FC1B94446EA59B6LL, "magickremoveimageprofiles", &ci_magickremoveimageprofiles},
+  {0x135CE067FA0A6271LL, "bzerrno", &ci_bzerrno},
+  {0x5B0759F776EC2664LL, "newdrawingwand", &ci_newdrawingwand},
+  {0x397D3C6576ED75FELL, "set_include_path", &ci_set_include_path},
+  {0x0DDFE3B1F6EEE1A9LL, "array_reduce", &ci_array_reduce},
+  {-1, NULL, NULL},
+  {0x3E1343B4A3AD717CLL, "magickgettextascent", &ci_magickgettextascent},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x20F0AAA486F39C74LL, "dom_element_get_elements_by_tag_name_ns", &ci_dom_element_get_elements_by_tag_name_ns},
+  {0x6193A26936F4D532LL, "disk_total_space", &ci_disk_total_space},
+  {0x40D620CBA0D41F95LL, "opendir", &ci_opendir},
+  {0x5409127FEDE332A8LL, "exif_imagetype", &ci_exif_imagetype},
+  {0x1FC294B806F76C52LL, "php_sapi_name", &ci_php_sapi_name},
+  {0x1B45CFF586F85A47LL, "utf8_encode", &ci_utf8_encode},
+  {0x1F22C82816F9AD88LL, "hphp_splfileinfo_getpath", &ci_hphp_splfileinfo_getpath},
+  {0x338D9D95095D1ED8LL, "magicksetimagedelay", &ci_magicksetimagedelay},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x269A220896FD2394LL, "deg2rad", &ci_deg2rad},
+  {0x1A73FD4416FECB70LL, "magickwriteimagefile", &ci_magickwriteimagefile},
+  {-1, NULL, NULL},
+  {0x532D0D905CE60E5CLL, "posix_times", &ci_posix_times},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x72DECE786967A4CFLL, "magickpreviousimage", &ci_magickpreviousimage},
+  {-1, NULL, NULL},
+  {0x5AB266C6E7075A34LL, "mysql_error", &ci_mysql_error},
+  {0x51647BC5C0A14FFCLL, "imap_clearflag_full", &ci_imap_clearflag_full},
+  {-1, NULL, NULL},
+  {0x16699E33370A8202LL, "idn_to_unicode", &ci_idn_to_unicode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5D2F899A270D9AC7LL, "xmlwriter_end_dtd_element", &ci_xmlwriter_end_dtd_element},
+  {-1, NULL, NULL},
+  {0x3AB82455A70F5119LL, "imagecolortransparent", &ci_imagecolortransparent},
+  {-1, NULL, NULL},
+  {0x3A702EF906B37C17LL, "collator_get_locale", &ci_collator_get_locale},
+  {0x1A895A2307126285LL, "openssl_pkcs7_decrypt", &ci_openssl_pkcs7_decrypt},
+  {-1, NULL, NULL},
+  {0x12BB5E00E714ED17LL, "magickgetimagecompose", &ci_magickgetimagecompose},
+  {0x080594ABE715B478LL, "hphp_splfileobject_current", &ci_hphp_splfileobject_current},
+  {0x39EE4CCCA716E829LL, "stream_context_get_options", &ci_stream_context_get_options},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7AB5E6EA37196760LL, "date_timezone_set", &ci_date_timezone_set},
+  {-1, NULL, NULL},
+  {0x4842AF70A71BE6C4LL, "uksort", &ci_uksort},
+  {0x20740D956F0236F9LL, "image2wbmp", &ci_image2wbmp},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x345E2BAE171FA221LL, "date_sunrise", &ci_date_sunrise},
+  {0x56EF59D6CB0A5F6BLL, "dom_document_save_html_file", &ci_dom_document_save_html_file},
+  {0x24BD9EBDC721E29ALL, "hphp_debug_caller_info", &ci_hphp_debug_caller_info},
+  {0x39994614C6315D1ALL, "hphp_recursivedirectoryiterator_key", &ci_hphp_recursivedirectoryiterator_key},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0E38CDC93E5893BFLL, "magicksetimagemattecolor", &ci_magicksetimagemattecolor},
+  {0x35BE8F6E7726C4BDLL, "dechex", &ci_dechex},
+  {-1, NULL, NULL},
+  {0x5623A698A728F016LL, "getlastmod", &ci_getlastmod},
+  {0x5B1D9F56698A40ABLL, "html_entity_decode", &ci_html_entity_decode},
+  {0x05556EDFC1BB0C90LL, "mysql_info", &ci_mysql_info},
+  {-1, NULL, NULL},
+  {0x25D578B4772C1715LL, "define", &ci_define},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x313E8EB28A111C57LL, "hphp_splfileinfo_setinfoclass", &ci_hphp_splfileinfo_setinfoclass},
+  {0x34B6388D7730BCC2LL, "drawline", &ci_drawline},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2E4612DF112010E0LL, "imagecopyresized", &ci_imagecopyresized},
+  {-1, NULL, NULL},
+  {0x45AB8F419BA666A8LL, "drawpathlinetohorizontalabsolute", &ci_drawpathlinetohorizontalabsolute},
+  {-1, NULL, NULL},
+  {0x69E1368FD737F61DLL, "dom_namednodemap_get_named_item", &ci_dom_namednodemap_get_named_item},
+  {0x215403F1E335C4D7LL, "magicksolarizeimage", &ci_magicksolarizeimage},
+  {0x5C29B6D7973903A1LL, "proc_nice", &ci_proc_nice},
+  {0x52D5698F31D12609LL, "pcntl_setpriority", &ci_pcntl_setpriority},
+  {-1, NULL, NULL},
+  {0x53A88C8F973CFBCDLL, "apc_clear_cache", &ci_apc_clear_cache},
+  {0x7A9FB932873D09CELL, "gmmktime", &ci_gmmktime},
+  {0x15C9E5C16374EE8ALL, "gzclose", &ci_gzclose},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7E978C38D741664ELL, "fgetcsv", &ci_fgetcsv},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x01E6FF7D9746CDBDLL, "stream_socket_accept", &ci_stream_socket_accept},
+  {0x26C49BBC67475CF2LL, "magicksetimagewhitepoint", &ci_magicksetimagewhitepoint},
+  {0x41B15671649A320CLL, "curl_multi_getcontent", &ci_curl_multi_getcontent},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x608EA42B08A7462ALL, "linkinfo", &ci_linkinfo},
+  {-1, NULL, NULL},
+  {0x629EDDC1E74ED655LL, "array_uintersect_assoc", &ci_array_uintersect_assoc},
+  {0x1A9DC76AB74F6344LL, "openssl_verify", &ci_openssl_verify},
+  {0x56E867A1F7507ADBLL, "dom_document_create_processing_instruction", &ci_dom_document_create_processing_instruction},
+  {-1, NULL, NULL},
+  {0x7978A278AEAFAF50LL, "pixelgetmagenta", &ci_pixelgetmagenta},
+  {-1, NULL, NULL},
+  {0x4FDCCE1C7754600BLL, "ob_iconv_handler", &ci_ob_iconv_handler},
+  {0x48A2F2A7A4620CFFLL, "pixelsetyellowquantum", &ci_pixelsetyellowquantum},
+  {-1, NULL, NULL},
+  {0x035EFF9E1757DF2CLL, "http_build_query", &ci_http_build_query},
+  {-1, NULL, NULL},
+  {0x0183A548B759BCCELL, "posix_getpgid", &ci_posix_getpgid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7CFF820207DC6E9FLL, "debug_backtrace", &ci_debug_backtrace},
+  {0x7F5FC3CAF8CE9FDELL, "gzcompress", &ci_gzcompress},
+  {0x547E7EE64761AADCLL, "imagecreatefromxbm", &ci_imagecreatefromxbm},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x316F054CB76446B9LL, "openssl_sign", &ci_openssl_sign},
+  {-1, NULL, NULL},
+  {0x36F7F9FD7766DC9BLL, "xmlwriter_end_comment", &ci_xmlwriter_end_comment},
+  {-1, NULL, NULL},
+  {0x73EF3A19F76872A6LL, "iconv_strrpos", &ci_iconv_strrpos},
+  {-1, NULL, NULL},
+  {0x381BBFEABFEC865CLL, "libxml_get_last_error", &ci_libxml_get_last_error},
+  {-1, NULL, NULL},
+  {0x0F3403D8676C2601LL, "mysql_query", &ci_mysql_query},
+  {0x33D6CC3959D3CE90LL, "clearmagickwand", &ci_clearmagickwand},
+  {0x750D0396676E6ACCLL, "imagecolorexact", &ci_imagecolorexact},
+  {0x245860A2FE4CB9D5LL, "socket_set_blocking", &ci_socket_set_blocking},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x230E7AD147721D89LL, "end", &ci_end},
+  {0x0CC562CBD773639ALL, "i18n_loc_get_default", &ci_i18n_loc_get_default},
+  {0x2E10B74DC6067BE0LL, "strip_tags", &ci_strip_tags},
+  {-1, NULL, NULL},
+  {0x0D841874977646A6LL, "krsort", &ci_krsort},
+  {-1, NULL, NULL},
+  {0x17CD0E68E778C04BLL, "drawsetstrokelinejoin", &ci_drawsetstrokelinejoin},
+  {0x528BA9796BD0FEE1LL, "fb_rpc_intercept_handler", &ci_fb_rpc_intercept_handler},
+  {0x601C5152277AE028LL, "readfile", &ci_readfile},
+  {0x2ED6760DAA3A67D9LL, "strcasecmp", &ci_strcasecmp},
+  {-1, NULL, NULL},
+  {0x7C251B7DE8DB87A9LL, "mcrypt_list_algorithms", &ci_mcrypt_list_algorithms},
+  {-1, NULL, NULL},
+  {0x130B62A8C77F3182LL, "mb_ereg_search_getregs", &ci_mb_ereg_search_getregs},
+  {-1, NULL, NULL},
+  {0x73877357478137F3LL, "posix_ctermid", &ci_posix_ctermid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4810A9774785C367LL, "posix_getpgrp", &ci_posix_getpgrp},
+  {0x63E2EA180786B83BLL, "pixelsetblack", &ci_pixelsetblack},
+  {-1, NULL, NULL},
+  {0x56C4896BA2FF52D8LL, "drawsetstrokeopacity", &ci_drawsetstrokeopacity},
+  {-1, NULL, NULL},
+  {0x23AAF570C78AC6B0LL, "ip2long", &ci_ip2long},
+  {-1, NULL, NULL},
+  {0x560C2F71978CE58CLL, "shm_put_var", &ci_shm_put_var},
+  {-1, NULL, NULL},
+  {0x6BB9D669DDB703E8LL, "xml_get_current_byte_index", &ci_xml_get_current_byte_index},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7EE74F798791CF3BLL, "magickedgeimage", &ci_magickedgeimage},
+  {-1, NULL, NULL},
+  {0x1EFFE951E79348ACLL, "imap_expunge", &ci_imap_expunge},
+  {0x406BDC51A3FD81E3LL, "pcntl_waitpid", &ci_pcntl_waitpid},
+  {0x37A3DF6E0795091BLL, "memcache_increment", &ci_memcache_increment},
+  {0x4901517CB796F646LL, "msg_set_queue", &ci_msg_set_queue},
+  {-1, NULL, NULL},
+  {0x14563723F798172DLL, "magickpaintopaqueimage", &ci_magickpaintopaqueimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4F43FE32079C0155LL, "magickgetimagesblob", &ci_magickgetimagesblob},
+  {0x0830FF7C379D7537LL, "dom_text_split_text", &ci_dom_text_split_text},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x22B3CF8DD3D1A987LL, "pixelsynciterator", &ci_pixelsynciterator},
+  {0x21972B2BC7A14709LL, "imageistruecolor", &ci_imageistruecolor},
+  {-1, NULL, NULL},
+  {0x1DB9A1FB97A3AA25LL, "magicksetimageoption", &ci_magicksetimageoption},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x798B4197212456B5LL, "bcpowmod", &ci_bcpowmod},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3D13FD5FE3AF6E17LL, "imagestringup", &ci_imagestringup},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5EFE15CE970A5704LL, "drawpolyline", &ci_drawpolyline},
+  {-1, NULL, NULL},
+  {0x73E4417BA7B49749LL, "curl_multi_info_read", &ci_curl_multi_info_read},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x55757E1242390913LL, "cos", &ci_cos},
+  {-1, NULL, NULL},
+  {0x6B1A3BCE67BAC8A0LL, "openssl_csr_new", &ci_openssl_csr_new},
+  {0x7F436B50B7BBD7F3LL, "getcwd", &ci_getcwd},
+  {0x7636825871399B61LL, "highlight_file", &ci_highlight_file},
+  {-1, NULL, NULL},
+  {0x1AA83A1057BE6ECALL, "mysql_field_len", &ci_mysql_field_len},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7CE90898E882F36ELL, "pixelsetyellow", &ci_pixelsetyellow},
+  {0x3703D22147C24F8BLL, "pixelsetcyan", &ci_pixelsetcyan},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1CE8175A87C785C8LL, "dom_document_validate", &ci_dom_document_validate},
+  {0x4102C410C5031776LL, "magickcolorizeimage", &ci_magickcolorizeimage},
+  {-1, NULL, NULL},
+  {0x4CE852AAFF77E4E7LL, "inclued_get_data", &ci_inclued_get_data},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x002CCCD877D9640DLL, "drawpathclose", &ci_drawpathclose},
+  {0x37DF53E4D9348B4DLL, "xbox_post_message", &ci_xbox_post_message},
+  {0x2B78E204F615A824LL, "openssl_pkcs12_export_to_file", &ci_openssl_pkcs12_export_to_file},
+  {0x1C8D554F57DCAD15LL, "hphp_object_pointer", &ci_hphp_object_pointer},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x36AB9E6AA687F2AELL, "xmlwriter_start_dtd_element", &ci_xmlwriter_start_dtd_element},
+  {0x047A8BF04DB51049LL, "range", &ci_range},
+  {0x4022005DE7E24E50LL, "openssl_pkcs7_sign", &ci_openssl_pkcs7_sign},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x70A1EC006032E78ALL, "pixelgetquantumcolor", &ci_pixelgetquantumcolor},
+  {-1, NULL, NULL},
+  {0x63F18DE0DB807F80LL, "magickqueryfonts", &ci_magickqueryfonts},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7EB48D1BB5B7AD02LL, "dom_element_set_attribute", &ci_dom_element_set_attribute},
+  {0x418D937957ECE037LL, "tanh", &ci_tanh},
+  {0x7883232CD1A7CFF7LL, "dom_node_is_same_node", &ci_dom_node_is_same_node},
+  {0x515841235FADCD36LL, "class_implements", &ci_class_implements},
+  {0x275D127C87EF048DLL, "mysql_db_query", &ci_mysql_db_query},
+  {0x76B9D87BC7F02F94LL, "preg_match", &ci_preg_match},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5208E8B08455E223LL, "dom_node_has_child_nodes", &ci_dom_node_has_child_nodes},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x61E7A36CA7FF5F0FLL, "drawsetcliprule", &ci_drawsetcliprule},
+  {0x18666906A8001477LL, "array_diff_assoc", &ci_array_diff_assoc},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x09367774F803EA81LL, "hphp_recursiveiteratoriterator_valid", &ci_hphp_recursiveiteratoriterator_valid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x539868C56806688FLL, "imagecopyresampled", &ci_imagecopyresampled},
+  {0x4C24BC37D807D39ALL, "collator_get_strength", &ci_collator_get_strength},
+  {0x501AAD31C8086998LL, "posix_getcwd", &ci_posix_getcwd},
+  {-1, NULL, NULL},
+  {0x0FBDB0B22A59B818LL, "mailparse_msg_parse", &ci_mailparse_msg_parse},
+  {0x24B836D2C79D0E69LL, "magickgetimagepixels", &ci_magickgetimagepixels},
+  {0x32F8747E480CCFFELL, "connection_status", &ci_connection_status},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x67EADCF4E81084C4LL, "mb_ereg", &ci_mb_ereg},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x71B7756BD1B43E44LL, "dom_document_savexml", &ci_dom_document_savexml},
+  {0x000AAF93F814AE32LL, "drawsetvectorgraphics", &ci_drawsetvectorgraphics},
+  {0x5ED8901DB5D14379LL, "magickcharcoalimage", &ci_magickcharcoalimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x09D5355CA8198511LL, "mb_internal_encoding", &ci_mb_internal_encoding},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x476F4B6CC987E0E8LL, "magickframeimage", &ci_magickframeimage},
+  {0x3ACF745D381E9D37LL, "rtrim", &ci_rtrim},
+  {0x36953788781F4394LL, "mailparse_msg_extract_part", &ci_mailparse_msg_extract_part},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2621680306BC97E4LL, "magicksetimagescene", &ci_magicksetimagescene},
+  {0x080F661DB8BFC9C6LL, "hphp_splfileinfo_getmtime", &ci_hphp_splfileinfo_getmtime},
+  {0x0551EACBE8278B19LL, "decoct", &ci_decoct},
+  {0x2B36081E0828487DLL, "debug_print_backtrace", &ci_debug_print_backtrace},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1635DCC4882CBA4ELL, "dom_node_has_attributes", &ci_dom_node_has_attributes},
+  {-1, NULL, NULL},
+  {0x4970B72A182E4FD4LL, "readdir", &ci_readdir},
+  {-1, NULL, NULL},
+  {0x3AE33FEA6830C7CELL, "magickshearimage", &ci_magickshearimage},
+  {-1, NULL, NULL},
+  {0x2FB2FA1DD832C70FLL, "xmlwriter_write_attribute_ns", &ci_xmlwriter_write_attribute_ns},
+  {0x5C8B3B9FA833934FLL, "ldap_first_attribute", &ci_ldap_first_attribute},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5B2F2A23D8368BD4LL, "magickraiseimage", &ci_magickraiseimage},
+  {0x58F426377837AE14LL, "imap_body", &ci_imap_body},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7DD6461A6290B32FLL, "mysql_real_escape_string", &ci_mysql_real_escape_string},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x43F22CB4E3E8F3F7LL, "apache_note", &ci_apache_note},
+  {0x40497FCA4EC4DD42LL, "posix_seteuid", &ci_posix_seteuid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x79A05154A7F5482FLL, "magickgetimagedelay", &ci_magickgetimagedelay},
+  {-1, NULL, NULL},
+  {0x48D3CA6CA0B29935LL, "mb_regex_set_options", &ci_mb_regex_set_options},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x225F05071947BAEBLL, "drawpathlinetoabsolute", &ci_drawpathlinetoabsolute},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x217067889854CFE7LL, "xmlwriter_start_dtd", &ci_xmlwriter_start_dtd},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x314317450857FAD1LL, "ctype_punct", &ci_ctype_punct},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x187C049E785A1BF0LL, "iconv_get_encoding", &ci_iconv_get_encoding},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x26A2BBC465A2B84CLL, "strcoll", &ci_strcoll},
+  {-1, NULL, NULL},
+  {0x32C51FFF185F4258LL, "memcache_set", &ci_memcache_set},
+  {0x5C659372B2CD80B9LL, "imagecolorstotal", &ci_imagecolorstotal},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x557C72DE98679537LL, "hash_update_stream", &ci_hash_update_stream},
+  {-1, NULL, NULL},
+  {0x7D9E024FD8696D6DLL, "get_class", &ci_get_class},
+  {0x35828C81A86A9DA9LL, "cpu_get_count", &ci_cpu_get_count},
+  {0x04A24B397CF46BB1LL, "strrchr", &ci_strrchr},
+  {0x1C32BB63986C8091LL, "socket_strerror", &ci_socket_strerror},
+  {0x1765A2E5186DE281LL, "socket_write", &ci_socket_write},
+  {0x234F6A0A486E8646LL, "natcasesort", &ci_natcasesort},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3B3D5CE69B1565C6LL, "mcrypt_module_is_block_mode", &ci_mcrypt_module_is_block_mode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x74ABB4A1E10BBBF7LL, "time", &ci_time},
+  {0x65D40C6B4842F305LL, "clearpixelwand", &ci_clearpixelwand},
+  {0x28AC28C54C4E6A79LL, "openssl_error_string", &ci_openssl_error_string},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x67D4BA8513BF41E2LL, "newpixelwand", &ci_newpixelwand},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5B5DA6AD0AD63A71LL, "drawannotation", &ci_drawannotation},
+  {0x1C65F32FF28BC272LL, "pathinfo", &ci_pathinfo},
+  {0x5A3F5AAD1B13A3BBLL, "is_executable", &ci_is_executable},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x70075DC878825A0BLL, "ctype_lower", &ci_ctype_lower},
+  {0x215E0E2EFA7422EDLL, "drawgetstrokeantialias", &ci_drawgetstrokeantialias},
+  {0x5176725DA884DC61LL, "curl_setopt", &ci_curl_setopt},
+  {0x465E6C67F885AA94LL, "drawgetstrokelinejoin", &ci_drawgetstrokelinejoin},
+  {0x2DEF52641933CE57LL, "magickgetimagemattecolor", &ci_magickgetimagemattecolor},
+  {0x604572CB0314EACDLL, "imap_listscan", &ci_imap_listscan},
+  {0x1806DC9468882D8FLL, "gzfile", &ci_gzfile},
+  {0x696241660648B3F2LL, "magickwhitethresholdimage", &ci_magickwhitethresholdimage},
+  {0x51060D186C703E7ELL, "headers_list", &ci_headers_list},
+  {-1, NULL, NULL},
+  {0x4D100C70E86593C8LL, "stream_set_write_buffer", &ci_stream_set_write_buffer},
+  {0x39E03AAC188D3CB7LL, "magickgetimagecompressionquality", &ci_magickgetimagecompressionquality},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0F8F276A48900473LL, "drawgetstrokelinecap", &ci_drawgetstrokelinecap},
+  {-1, NULL, NULL},
+  {0x29DD2C9F889246C8LL, "passthru", &ci_passthru},
+  {-1, NULL, NULL},
+  {0x49A34964289453BELL, "eregi", &ci_eregi},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x188D37410B6051C6LL, "session_unregister", &ci_session_unregister},
+  {-1, NULL, NULL},
+  {0x501F4DF5C8997354LL, "hphp_get_property", &ci_hphp_get_property},
+  {0x48F35DFD653D7033LL, "pclose", &ci_pclose},
+  {0x081F76AC889BC546LL, "getrusage", &ci_getrusage},
+  {0x224004A728974E9FLL, "spl_object_hash", &ci_spl_object_hash},
+  {0x14F700DD189DB7F0LL, "drawsetclipunits", &ci_drawsetclipunits},
+  {-1, NULL, NULL},
+  {0x7107AE03689F5372LL, "hphp_invoke", &ci_hphp_invoke},
+  {0x5464E148E8A0C592LL, "get_extension_funcs", &ci_get_extension_funcs},
+  {-1, NULL, NULL},
+  {0x6CB3DEB458A2DE66LL, "apc_bin_load", &ci_apc_bin_load},
+  {0x69FB5DBA88A308D8LL, "imap_8bit", &ci_imap_8bit},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5895ADDD91F354EELL, "hphp_thread_set_warmup_enabled", &ci_hphp_thread_set_warmup_enabled},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5A26F00A81BA5227LL, "xmlwriter_start_attribute_ns", &ci_xmlwriter_start_attribute_ns},
+  {0x59BB7B8078AC22B3LL, "tempnam", &ci_tempnam},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7FF66005524E649FLL, "drawgettextdecoration", &ci_drawgettextdecoration},
+  {0x333D1E2E28B0942DLL, "imagejpeg", &ci_imagejpeg},
+  {0x45A53A884414A7AALL, "pack", &ci_pack},
+  {0x044386A0E8B25435LL, "drawgetclipunits", &ci_drawgetclipunits},
+  {0x4983571BFEAE6169LL, "magickaffinetransformimage", &ci_magickaffinetransformimage},
+  {0x14FB46333D6D11DCLL, "xml_set_default_handler", &ci_xml_set_default_handler},
+  {-1, NULL, NULL},
+  {0x2A420675E6AF0A20LL, "basename", &ci_basename},
+  {-1, NULL, NULL},
+  {0x31F50FDA18B888DCLL, "magickgetimagetype", &ci_magickgetimagetype},
+  {0x112A0ACDD8B9D4F5LL, "mb_list_mime_names", &ci_mb_list_mime_names},
+  {-1, NULL, NULL},
+  {0x24D34E49C21DE69BLL, "mb_stristr", &ci_mb_stristr},
+  {-1, NULL, NULL},
+  {0x4C83B098C8BDA283LL, "posix_setsid", &ci_posix_setsid},
+  {-1, NULL, NULL},
+  {0x21D924BA98BFCD6DLL, "file_get_contents", &ci_file_get_contents},
+  {0x0089115038C03A97LL, "array_diff_ukey", &ci_array_diff_ukey},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7A147B8B98C76CC3LL, "key_exists", &ci_key_exists},
+  {-1, NULL, NULL},
+  {0x42795829DF700753LL, "mysql_get_host_info", &ci_mysql_get_host_info},
+  {0x4BAA5B688E6F6F27LL, "gd_info", &ci_gd_info},
+  {-1, NULL, NULL},
+  {0x146A1A7658CCA8C5LL, "asinh", &ci_asinh},
+  {0x4EDEDA4278CD3FDDLL, "magickchopimage", &ci_magickchopimage},
+  {0x0C626F268F120470LL, "__halt_compiler", &ci___halt_compiler},
+  {0x255D919D501C5087LL, "dom_characterdata_delete_data", &ci_dom_characterdata_delete_data},
+  {0x528D41A17B8FCAEBLL, "imap_set_quota", &ci_imap_set_quota},
+  {0x0F78ECF42C30DFB1LL, "array_chunk", &ci_array_chunk},
+  {0x3C6D50F3BB8102B8LL, "next", &ci_next},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x12D83A92EFB0EEAFLL, "xmlwriter_open_uri", &ci_xmlwriter_open_uri},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x69868C648BC12295LL, "apc_store", &ci_apc_store},
+  {0x12A9166E68DCF4B6LL, "pixelgetgreen", &ci_pixelgetgreen},
+  {0x495316E596537EC0LL, "imagefttext", &ci_imagefttext},
+  {0x47E2B4F7B8DE5AD1LL, "xmlwriter_write_dtd_attlist", &ci_xmlwriter_write_dtd_attlist},
+  {-1, NULL, NULL},
+  {0x18D9ED67E8E0FC71LL, "dom_attr_is_id", &ci_dom_attr_is_id},
+  {-1, NULL, NULL},
+  {0x46B2F287D2FC7DA5LL, "memcache_get", &ci_memcache_get},
+  {0x51E8B5B728E33D74LL, "imap_last_error", &ci_imap_last_error},
+  {0x541926FB6D6FC6AALL, "magickgetimagecolors", &ci_magickgetimagecolors},
+  {0x735555B148E58CB1LL, "ldap_read", &ci_ldap_read},
+  {0x48444F8F18E60D91LL, "strftime", &ci_strftime},
+  {0x68C09D6CB8E79B38LL, "class_exists", &ci_class_exists},
+  {-1, NULL, NULL},
+  {0x14AF32A23B507B0ALL, "metaphone", &ci_metaphone},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7CAE3FE798EC0A5FLL, "php_logo_guid", &ci_php_logo_guid},
+  {0x784FD2E7191A3784LL, "drawpathellipticarcrelative", &ci_drawpathellipticarcrelative},
+  {0x4173EFD9A8EECC8FLL, "magicknewimage", &ci_magicknewimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x02103322F88C71C2LL, "pixelgetcolorcount", &ci_pixelgetcolorcount},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4888951358F53B5DLL, "dom_document_get_elements_by_tag_name_ns", &ci_dom_document_get_elements_by_tag_name_ns},
+  {-1, NULL, NULL},
+  {0x467470230015AC8ELL, "mcrypt_module_is_block_algorithm_mode", &ci_mcrypt_module_is_block_algorithm_mode},
+  {-1, NULL, NULL},
+  {0x38433635F28B4E33LL, "is_readable", &ci_is_readable},
+  {0x37F356F578FA394BLL, "substr", &ci_substr},
+  {-1, NULL, NULL},
+  {0x6D5B592E524AF75CLL, "hphp_splfileinfo_getbasename", &ci_hphp_splfileinfo_getbasename},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3C466098FF7B5070LL, "mb_check_encoding", &ci_mb_check_encoding},
+  {0x6C2CE092B900D40BLL, "hphp_splfileinfo___construct", &ci_hphp_splfileinfo___construct},
+  {-1, NULL, NULL},
+  {0x6DA49696220FE3EALL, "mailparse_rfc822_parse_addresses", &ci_mailparse_rfc822_parse_addresses},
+  {-1, NULL, NULL},
+  {0x153F7DBFC9047D09LL, "pixelsetred", &ci_pixelsetred},
+  {-1, NULL, NULL},
+  {0x651F7FBBA90604C6LL, "magickgetimageindex", &ci_magickgetimageindex},
+  {0x12F09EAED9078F15LL, "mysql_fetch_field", &ci_mysql_fetch_field},
+  {0x59594143EFC7617BLL, "mcrypt_module_open", &ci_mcrypt_module_open},
+  {0x0784B2B034560D3BLL, "destroypixelwand", &ci_destroypixelwand},
+  {-1, NULL, NULL},
+  {0x191B5F1B190BC0B1LL, "dom_xpath_register_ns", &ci_dom_xpath_register_ns},
+  {0x50C88817090C63CCLL, "pcntl_wait", &ci_pcntl_wait},
+  {-1, NULL, NULL},
+  {0x672DA903B52249BCLL, "xhprof_frame_begin", &ci_xhprof_frame_begin},
+  {0x60276BC7990F9637LL, "mysql_list_dbs", &ci_mysql_list_dbs},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2B3D5B9AF915D6D1LL, "imagecopymerge", &ci_imagecopymerge},
+  {0x11DFC3C9D916387CLL, "hphp_splfileobject_ftruncate", &ci_hphp_splfileobject_ftruncate},
+  {0x35BABFBC091759F5LL, "socket_server", &ci_socket_server},
+  {0x00DAFE46631AE331LL, "stream_set_timeout", &ci_stream_set_timeout},
+  {0x3DFD5CA79919DCB7LL, "imageantialias", &ci_imageantialias},
+  {0x46BD9A56BDE40935LL, "mysql_escape_string", &ci_mysql_escape_string},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6237393C71E56B50LL, "array_fill_keys", &ci_array_fill_keys},
+  {0x042492DDA48C4F12LL, "gzdeflate", &ci_gzdeflate},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x00D8FE7A00252B46LL, "escapeshellarg", &ci_escapeshellarg},
+  {-1, NULL, NULL},
+  {0x2CEF8DDC092698B0LL, "drawgetvectorgraphics", &ci_drawgetvectorgraphics},
+  {0x1340509769275EDBLL, "magickgetimagecompression", &ci_magickgetimagecompression},
+  {0x422C51C95928A234LL, "str_replace", &ci_str_replace},
+  {0x406AC1DDB92925CELL, "parse_hdf_file", &ci_parse_hdf_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x05D72365192CE465LL, "fwrite", &ci_fwrite},
+  {0x1D011CB0E810D54CLL, "pdo_drivers", &ci_pdo_drivers},
+  {0x3A096F905FBF7B7CLL, "magickcommentimage", &ci_magickcommentimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0136F8F03932E39CLL, "session_unset", &ci_session_unset},
+  {-1, NULL, NULL},
+  {0x40DDE277D934061BLL, "gzputs", &ci_gzputs},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6F2182E089377D37LL, "imap_list", &ci_imap_list},
+  {-1, NULL, NULL},
+  {0x555D7A3FB939300ALL, "apache_setenv", &ci_apache_setenv},
+  {0x1E47C281193ABC0ALL, "collator_compare", &ci_collator_compare},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2AFF8525E93D6D88LL, "drawsetfillopacity", &ci_drawsetfillopacity},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x21104CCA2942AFD0LL, "fb_const_fetch", &ci_fb_const_fetch},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4E04B71729485C91LL, "clonedrawingwand", &ci_clonedrawingwand},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x04C11602C720A290LL, "convert_cyr_string", &ci_convert_cyr_string},
+  {-1, NULL, NULL},
+  {0x54AE7140B95027EBLL, "pixelgetgreenquantum", &ci_pixelgetgreenquantum},
+  {-1, NULL, NULL},
+  {0x0EEE484739520C0BLL, "magickthresholdimage", &ci_magickthresholdimage},
+  {0x0F5759A501FAFE17LL, "imagecreatefromgd2part", &ci_imagecreatefromgd2part},
+  {0x686C5142FD0337C7LL, "lcg_value", &ci_lcg_value},
+  {0x464EB9B1F955202CLL, "apc_add", &ci_apc_add},
+  {0x459330C31956A5F4LL, "vsprintf", &ci_vsprintf},
+  {0x6FFF1304EA444F66LL, "drawsetstrokemiterlimit", &ci_drawsetstrokemiterlimit},
+  {0x1F3E4C6660247BB0LL, "imagecolorresolve", &ci_imagecolorresolve},
+  {-1, NULL, NULL},
+  {0x528366F3195ACC75LL, "xbox_task_result", &ci_xbox_task_result},
+  {0x73A1F34DF95B35F5LL, "get_defined_constants", &ci_get_defined_constants},
+  {-1, NULL, NULL},
+  {0x7CD3C6F6495D3228LL, "memcache_get_stats", &ci_memcache_get_stats},
+  {-1, NULL, NULL},
+  {0x23C478B2D95F3234LL, "dom_element_has_attribute_ns", &ci_dom_element_has_attribute_ns},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5768A80BB0B926F3LL, "apd_set_session_trace_socket", &ci_apd_set_session_trace_socket},
+  {-1, NULL, NULL},
+  {0x6DB71D850799D76ELL, "hphp_splfileobject_fscanf", &ci_hphp_splfileobject_fscanf},
+  {0x1F4505BE6460D766LL, "scandir", &ci_scandir},
+  {0x219F3257BA3371D4LL, "decbin", &ci_decbin},
+  {0x1AB55BBA0967952CLL, "mb_convert_variables", &ci_mb_convert_variables},
+  {0x400A44045A999D45LL, "rawurlencode", &ci_rawurlencode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3A56371CDDEA0F6ELL, "gzgetc", &ci_gzgetc},
+  {0x1CBD3B58296C8181LL, "xmlwriter_write_dtd", &ci_xmlwriter_write_dtd},
+  {-1, NULL, NULL},
+  {0x0912965F4440FA6BLL, "str_repeat", &ci_str_repeat},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x679B81CE06EE0629LL, "bcdiv", &ci_bcdiv},
+  {0x08A6AD20C2C5A665LL, "hphp_set_static_property", &ci_hphp_set_static_property},
+  {-1, NULL, NULL},
+  {0x45CFDEE19995398ELL, "hphp_recursiveiteratoriterator_next", &ci_hphp_recursiveiteratoriterator_next},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6FB5104FC97A31A0LL, "drawpathcurvetorelative", &ci_drawpathcurvetorelative},
+  {0x3900FDF1C97BEFB4LL, "drawrotate", &ci_drawrotate},
+  {-1, NULL, NULL},
+  {0x17582BEA497D48F7LL, "ctype_alpha", &ci_ctype_alpha},
+  {0x72C0C89D897E721ALL, "magicksetimagetype", &ci_magicksetimagetype},
+  {0x5E968924197F5E93LL, "mcrypt_ofb", &ci_mcrypt_ofb},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x01DD2057FD9B1A68LL, "xmlwriter_write_cdata", &ci_xmlwriter_write_cdata},
+  {0x71B0FF80B88459EBLL, "diskfreespace", &ci_diskfreespace},
+  {0x6E9D4D3A119D76AALL, "wandgetexceptiontype", &ci_wandgetexceptiontype},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x50A7146A79877A0DLL, "pcntl_alarm", &ci_pcntl_alarm},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x50538F37398AF1ADLL, "ldap_get_option", &ci_ldap_get_option},
+  {0x4110AF96B98B25ADLL, "gzeof", &ci_gzeof},
+  {-1, NULL, NULL},
+  {0x52FDAC1D298D67C0LL, "mcrypt_enc_get_algorithms_name", &ci_mcrypt_enc_get_algorithms_name},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x60294C2616F6A3BDLL, "mcrypt_enc_get_supported_key_sizes", &ci_mcrypt_enc_get_supported_key_sizes},
+  {0x2771C632A60371E1LL, "ftok", &ci_ftok},
+  {0x40D0E3AF799226E4LL, "bin2hex", &ci_bin2hex},
+  {0x036A5935D9936230LL, "hphp_splfileinfo_openfile", &ci_hphp_splfileinfo_openfile},
+  {0x4E4EB301A994DBD4LL, "drawpolygon", &ci_drawpolygon},
+  {0x442A28FB6F6C3971LL, "xmlwriter_start_attribute", &ci_xmlwriter_start_attribute},
+  {0x7F802A06996BBED9LL, "apd_set_browser_trace", &ci_apd_set_browser_trace},
+  {0x2D948E4099975A34LL, "restore_include_path", &ci_restore_include_path},
+  {0x48E1616EE837FC08LL, "is_uploaded_file", &ci_is_uploaded_file},
+  {0x5C039967E60089DELL, "array_intersect_ukey", &ci_array_intersect_ukey},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x42BCEFCF899D0CC2LL, "magickgetimagecolorspace", &ci_magickgetimagecolorspace},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1F76E954F9A147A7LL, "magickcontrastimage", &ci_magickcontrastimage},
+  {0x63837ECAF6235D14LL, "preg_replace", &ci_preg_replace},
+  {-1, NULL, NULL},
+  {0x083B8F01AE15B808LL, "assert", &ci_assert},
+  {0x4A09634AE6DFF29BLL, "fileperms", &ci_fileperms},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x79265AADD9A8AF45LL, "mcrypt_cbc", &ci_mcrypt_cbc},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3ACE8A8BC9ACDD0DLL, "iconv_mime_decode", &ci_iconv_mime_decode},
+  {-1, NULL, NULL},
+  {0x2FAB1F75659707CFLL, "is_scalar", &ci_is_scalar},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4E903B706977ABE8LL, "imagepsslantfont", &ci_imagepsslantfont},
+  {-1, NULL, NULL},
+  {0x44279BB3E2191BECLL, "socket_accept", &ci_socket_accept},
+  {-1, NULL, NULL},
+  {0x76C320EDB9B6E002LL, "xmlwriter_flush", &ci_xmlwriter_flush},
+  {0x18BE9B1C2DE6D4A5LL, "imagexbm", &ci_imagexbm},
+  {-1, NULL, NULL},
+  {0x53B7BF8991FA67E8LL, "i18n_loc_get_error_code", &ci_i18n_loc_get_error_code},
+  {-1, NULL, NULL},
+  {0x5230E4C9D8D64E0ELL, "highlight_string", &ci_highlight_string},
+  {0x7EEBC81AF9BC54B7LL, "xml_parser_free", &ci_xml_parser_free},
+  {-1, NULL, NULL},
+  {0x5365BD7509BE60D2LL, "ldap_dn2ufn", &ci_ldap_dn2ufn},
+  {-1, NULL, NULL},
+  {0x2A6F86821A39C5CCLL, "expm1", &ci_expm1},
+  {0x684966A7B9C15532LL, "hphp_get_iterator", &ci_hphp_get_iterator},
+  {0x06A796D329C21D98LL, "call_user_func", &ci_call_user_func},
+  {-1, NULL, NULL},
+  {0x561DB8F1DC0BC265LL, "magickseparateimagechannel", &ci_magickseparateimagechannel},
+  {-1, NULL, NULL},
+  {0x0C44E5EEB9C646B7LL, "memcache_connect", &ci_memcache_connect},
+  {-1, NULL, NULL},
+  {0x4D393D30CE1112FBLL, "drawpathmovetoabsolute", &ci_drawpathmovetoabsolute},
+  {0x6F8676B049C919A4LL, "array_intersect_uassoc", &ci_array_intersect_uassoc},
+  {-1, NULL, NULL},
+  {0x26DC8AB4A9CBE8D6LL, "iconv", &ci_iconv},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x69C07B1F19CE83F0LL, "imap_rfc822_parse_headers", &ci_imap_rfc822_parse_headers},
+  {-1, NULL, NULL},
+  {0x2B9A380A29D0EC35LL, "session_write_close", &ci_session_write_close},
+  {-1, NULL, NULL},
+  {0x107DBCA79C15B821LL, "addcslashes", &ci_addcslashes},
+  {0x7DA98E0379D33522LL, "chdir", &ci_chdir},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6ECDF24B29D789C7LL, "strtolower", &ci_strtolower},
+  {0x1C1216F2B7C16CADLL, "ftell", &ci_ftell},
+  {0x3900350CD9D990BCLL, "imagecreatefromjpeg", &ci_imagecreatefromjpeg},
+  {0x13E0C91488484A0CLL, "imap_unsubscribe", &ci_imap_unsubscribe},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4AF87BA91163D09ELL, "mysql_db_name", &ci_mysql_db_name},
+  {0x510B683F2E764C12LL, "fb_load_local_databases", &ci_fb_load_local_databases},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x695AC59F79E2A238LL, "mb_encode_mimeheader", &ci_mb_encode_mimeheader},
+  {0x0B7559F53F31D22ELL, "fb_stubout_intercept_handler", &ci_fb_stubout_intercept_handler},
+  {0x572AE270D9E4FDA8LL, "socket_set_option", &ci_socket_set_option},
+  {0x18FEAF2459E5ADA8LL, "dom_element_has_attribute", &ci_dom_element_has_attribute},
+  {-1, NULL, NULL},
+  {0x3F7DCC3A00800BB5LL, "imagecolorallocate", &ci_imagecolorallocate},
+  {0x3A0B58797E8FE08CLL, "xml_set_external_entity_ref_handler", &ci_xml_set_external_entity_ref_handler},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x545A7BE199EC4A3BLL, "pcntl_getpriority", &ci_pcntl_getpriority},
+  {0x208B66A8731F72FELL, "sem_get", &ci_sem_get},
+  {0x00AB6FC4E9EE62ADLL, "imagefilledrectangle", &ci_imagefilledrectangle},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2AD6B0E3B9F3B861LL, "array_search", &ci_array_search},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x44244ECFB9F76F9BLL, "dom_document_create_element_ns", &ci_dom_document_create_element_ns},
+  {0x7C12261259F87D28LL, "mcrypt_enc_is_block_algorithm_mode", &ci_mcrypt_enc_is_block_algorithm_mode},
+  {0x2EC378A759F9EC05LL, "xbox_task_status", &ci_xbox_task_status},
+  {-1, NULL, NULL},
+  {0x5ABB7486CE861DECLL, "array_merge_recursive", &ci_array_merge_recursive},
+  {0x40A557CBB9FC35FFLL, "mysql_tablename", &ci_mysql_tablename},
+  {0x2D5A5580B9FD2CE2LL, "imap_setacl", &ci_imap_setacl},
+  {0x35117886C885DF97LL, "hphp_recursivedirectoryiterator_getsubpathname", &ci_hphp_recursivedirectoryiterator_getsubpathname},
+  {-1, NULL, NULL},
+  {0x76382756EA00B6EELL, "is_object", &ci_is_object},
+  {-1, NULL, NULL},
+  {0x41FBEF9F7A024CB4LL, "xmlwriter_end_element", &ci_xmlwriter_end_element},
+  {0x7ACBCD9CF335AA8BLL, "xmlwriter_start_document", &ci_xmlwriter_start_document},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2B1D442AEA06ADB8LL, "strpbrk", &ci_strpbrk},
+  {-1, NULL, NULL},
+  {0x031F9B7B9A08ECBBLL, "bzcompress", &ci_bzcompress},
+  {0x5E8606470A09BDA0LL, "magickposterizeimage", &ci_magickposterizeimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1FDF80EA9B8A96D2LL, "collator_set_strength", &ci_collator_set_strength},
+  {0x5D9818B3E1C385CFLL, "openssl_pkey_export_to_file", &ci_openssl_pkey_export_to_file},
+  {-1, NULL, NULL},
+  {0x13BB9EC5A2D2E747LL, "hphp_splfileinfo_isdir", &ci_hphp_splfileinfo_isdir},
+  {0x01AE1DE8FA116078LL, "call_user_func_array_async", &ci_call_user_func_array_async},
+  {0x743EA4BF2CC8F2A3LL, "mysql_field_type", &ci_mysql_field_type},
+  {0x32D8CE5D0FA6D788LL, "ldap_rename", &ci_ldap_rename},
+  {-1, NULL, NULL},
+  {0x71C6E38BC56CE432LL, "stream_wrapper_register", &ci_stream_wrapper_register},
+  {0x14C550B86A16ACCDLL, "hphp_get_this", &ci_hphp_get_this},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5866C5DF3A1AD8B6LL, "dom_element_get_attribute_node", &ci_dom_element_get_attribute_node},
+  {0x1612E331D1726169LL, "drawsetstrokecolor", &ci_drawsetstrokecolor},
+  {-1, NULL, NULL},
+  {0x6DC61C51FA1D340ALL, "show_source", &ci_show_source},
+  {0x31529E9BCA1E157ELL, "shm_remove", &ci_shm_remove},
+  {0x43EA586FBFC6A141LL, "spl_autoload_unregister", &ci_spl_autoload_unregister},
+  {-1, NULL, NULL},
+  {0x700A75BF904DAF10LL, "magickgetcharwidth", &ci_magickgetcharwidth},
+  {-1, NULL, NULL},
+  {0x439DF153FC32D0ABLL, "printf", &ci_printf},
+  {0x41EF51E62AD3DF64LL, "pagelet_server_is_enabled", &ci_pagelet_server_is_enabled},
+  {0x7B6A0D7510184F01LL, "mysql_fetch_assoc", &ci_mysql_fetch_assoc},
+  {0x3DA64BF893DBF983LL, "strncmp", &ci_strncmp},
+  {-1, NULL, NULL},
+  {0x07D959A8C0CF546CLL, "stream_wrapper_unregister", &ci_stream_wrapper_unregister},
+  {-1, NULL, NULL},
+  {0x74FDC4596C654D71LL, "dom_node_is_default_namespace", &ci_dom_node_is_default_namespace},
+  {0x4EF3469306E44366LL, "floatval", &ci_floatval},
+  {-1, NULL, NULL},
+  {0x57FFCEB7FA2D9829LL, "usort", &ci_usort},
+  {0x2A9015499A2EB1A2LL, "fnmatch", &ci_fnmatch},
+  {0x6E8C61326DCE40A8LL, "var_export", &ci_var_export},
+  {0x36D6B73D289DD163LL, "date_sunset", &ci_date_sunset},
+  {-1, NULL, NULL},
+  {0x3E319E451A32FADDLL, "magicksharpenimage", &ci_magicksharpenimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7B0552A224E27395LL, "bcsqrt", &ci_bcsqrt},
+  {0x68C257B62A36EF70LL, "magicksetimagebackgroundcolor", &ci_magicksetimagebackgroundcolor},
+  {-1, NULL, NULL},
+  {0x062C0FFA8E29DC12LL, "intl_error_name", &ci_intl_error_name},
+  {-1, NULL, NULL},
+  {0x69003892F71C798DLL, "apache_get_scoreboard", &ci_apache_get_scoreboard},
+  {0x79D3B90DEF10AFB5LL, "spl_autoload_extensions", &ci_spl_autoload_extensions},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x70742211FA3EFB2CLL, "imagettftext", &ci_imagettftext},
+  {0x4D397FE5D0C0B544LL, "magickmedianfilterimage", &ci_magickmedianfilterimage},
+  {0x1756D4437A4098A1LL, "date_modify", &ci_date_modify},
+  {0x3590F3AAC94E0A65LL, "array_change_key_case", &ci_array_change_key_case},
+  {0x25CA0299103F49D3LL, "magickgetsize", &ci_magickgetsize},
+  {0x05B8EB2C515885BALL, "vprintf", &ci_vprintf},
+  {0x173EDC165B673ACDLL, "magicktransformimage", &ci_magicktransformimage},
+  {0x758EA7E9AA45C33ELL, "xmlwriter_end_document", &ci_xmlwriter_end_document},
+  {-1, NULL, NULL},
+  {0x47279C717370B41BLL, "acos", &ci_acos},
+  {-1, NULL, NULL},
+  {0x3E5CF6378A49C091LL, "ldap_get_attributes", &ci_ldap_get_attributes},
+  {0x6E8996DD071CED0ALL, "dom_element_remove_attribute_node", &ci_dom_element_remove_attribute_node},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3DE291DCBA5134B6LL, "dom_document_create_element", &ci_dom_document_create_element},
+  {0x1234AB687C515A9DLL, "mb_encode_numericentity", &ci_mb_encode_numericentity},
+  {0x6EC476E42A53A4A4LL, "ldap_err2str", &ci_ldap_err2str},
+  {-1, NULL, NULL},
+  {0x0FEC4ED541B7F5FBLL, "magickgetimagevirtualpixelmethod", &ci_magickgetimagevirtualpixelmethod},
+  {0x73A3F87C0A56238BLL, "stat", &ci_stat},
+  {0x4D832DD6A72AB806LL, "dom_document_create_attribute", &ci_dom_document_create_attribute},
+  {0x3B426B13FA584E81LL, "fb_unserialize", &ci_fb_unserialize},
+  {0x1FFD204252F60F63LL, "magicksetimageprofile", &ci_magicksetimageprofile},
+  {0x277D7E2D1F5C191FLL, "drawpathcurvetoquadraticbezierrelative", &ci_drawpathcurvetoquadraticbezierrelative},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3B0FE36F9A7AE22DLL, "bzflush", &ci_bzflush},
+  {0x674AA2DBDA5E4CDALL, "imageloadfont", &ci_imageloadfont},
+  {0x29A2FBD427647E8ELL, "mysql_connect", &ci_mysql_connect},
+  {0x0ED191E71A60545ELL, "magicksetfirstiterator", &ci_magicksetfirstiterator},
+  {-1, NULL, NULL},
+  {0x4C6FD8808A62506FLL, "session_set_save_handler", &ci_session_set_save_handler},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5AD6595ACA656631LL, "pixelresetiterator", &ci_pixelresetiterator},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6AC126DCE941FE71LL, "memory_get_peak_usage", &ci_memory_get_peak_usage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x257371BC40186DB2LL, "magickblurimage", &ci_magickblurimage},
+  {0x7848970191D5A04CLL, "mysql_connect_with_db", &ci_mysql_connect_with_db},
+  {-1, NULL, NULL},
+  {0x15A9EB33DA6E9053LL, "getimagesize", &ci_getimagesize},
+  {-1, NULL, NULL},
+  {0x513787A813DB0597LL, "date_date_set", &ci_date_date_set},
+  {-1, NULL, NULL},
+  {0x280051555A21DF64LL, "rename", &ci_rename},
+  {-1, NULL, NULL},
+  {0x502CF4EB0A747D46LL, "magicksetimagebias", &ci_magicksetimagebias},
+  {0x488141281A75E975LL, "imagecreatefromgif", &ci_imagecreatefromgif},
+  {-1, NULL, NULL},
+  {0x57034CAD772AF4B3LL, "magickgetimagechannelmean", &ci_magickgetimagechannelmean},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7DA9307A6149B74BLL, "get_meta_tags", &ci_get_meta_tags},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x317FFA522A7D96D5LL, "imagefilledpolygon", &ci_imagefilledpolygon},
+  {0x1FC9406FD7FCD7B9LL, "strrpos", &ci_strrpos},
+  {0x27AD0D17AA7FB39ELL, "ldap_set_rebind_proc", &ci_ldap_set_rebind_proc},
+  {0x742AD1AA5A80ECB4LL, "output_reset_rewrite_vars", &ci_output_reset_rewrite_vars},
+  {0x19DCB392D4686763LL, "hphp_get_timers", &ci_hphp_get_timers},
+  {-1, NULL, NULL},
+  {0x5F9DDC342A83807ALL, "date_default_timezone_get", &ci_date_default_timezone_get},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6E2CF6ECA0987E3ALL, "get_headers", &ci_get_headers},
+  {-1, NULL, NULL},
+  {0x65F586C35A88030BLL, "magickresizeimage", &ci_magickresizeimage},
+  {-1, NULL, NULL},
+  {0x5932D2750A8A91E0LL, "magickgetpackagename", &ci_magickgetpackagename},
+  {-1, NULL, NULL},
+  {0x6C87406DDC0AB535LL, "mcrypt_ecb", &ci_mcrypt_ecb},
+  {0x56C95225813A5218LL, "memory_get_usage", &ci_memory_get_usage},
+  {-1, NULL, NULL},
+  {0x200FC256EB093EF9LL, "gettimeofday", &ci_gettimeofday},
+  {0x3B2CD86F5DB72583LL, "magickblackthresholdimage", &ci_magickblackthresholdimage},
+  {0x40D8DC24FA917CB1LL, "hphp_splfileobject_fgetss", &ci_hphp_splfileobject_fgetss},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4FC99DC20A955EC7LL, "session_module_name", &ci_session_module_name},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3535B6615F2B05FBLL, "session_cache_limiter", &ci_session_cache_limiter},
+  {-1, NULL, NULL},
+  {0x3B28CA1BE1D0DE73LL, "xbox_get_thread_timeout", &ci_xbox_get_thread_timeout},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x15AD9CE061C75197LL, "timezone_transitions_get", &ci_timezone_transitions_get},
+  {-1, NULL, NULL},
+  {0x3B197C0731233F13LL, "dom_characterdata_substring_data", &ci_dom_characterdata_substring_data},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0F71DDE51AA55621LL, "hphp_output_global_state", &ci_hphp_output_global_state},
+  {0x31FFFC333AA6D6E4LL, "drawsetfillrule", &ci_drawsetfillrule},
+  {0x64D269A505D51FAELL, "array_map", &ci_array_map},
+  {0x4B22EF06BAA83F72LL, "version_compare", &ci_version_compare},
+  {0x6414504A6658286CLL, "stripos", &ci_stripos},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4BC4B81CC5F32217LL, "dom_node_append_child", &ci_dom_node_append_child},
+  {-1, NULL, NULL},
+  {0x3E9146C06AAEFF39LL, "magicksetimagecompressionquality", &ci_magicksetimagecompressionquality},
+  {0x70725954DC99F61CLL, "mcrypt_create_iv", &ci_mcrypt_create_iv},
+  {0x1EF2C1426AB0A58BLL, "dom_node_replace_child", &ci_dom_node_replace_child},
+  {0x1355AFB40AB1165FLL, "drawsetfontstyle", &ci_drawsetfontstyle},
+  {-1, NULL, NULL},
+  {0x188720048AB37DABLL, "magickquantizeimages", &ci_magickquantizeimages},
+  {0x66F9A476DAB47B17LL, "pixelsetcolor", &ci_pixelsetcolor},
+  {-1, NULL, NULL},
+  {0x7E7718CC939D63E4LL, "setrawcookie", &ci_setrawcookie},
+  {0x5DDC2A079AB7988FLL, "dom_document_schema_validate_file", &ci_dom_document_schema_validate_file},
+  {-1, NULL, NULL},
+  {0x1D30F1E638D71729LL, "readgzfile", &ci_readgzfile},
+  {0x6B92530A9ABA0CE2LL, "session_commit", &ci_session_commit},
+  {-1, NULL, NULL},
+  {0x74EB6C564ABC68D2LL, "dom_document_create_text_node", &ci_dom_document_create_text_node},
+  {0x404236CC5ABD973ALL, "xhprof_run_trace", &ci_xhprof_run_trace},
+  {0x0436CA4DFB315A08LL, "soundex", &ci_soundex},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x458B5ABEDAC1C9BELL, "disk_free_space", &ci_disk_free_space},
+  {0x59A44591E67D4542LL, "drawrender", &ci_drawrender},
+  {0x33BD672B4AC301B6LL, "mt_rand", &ci_mt_rand},
+  {0x4D7AEC41CFD73FE8LL, "hphp_recursivedirectoryiterator_getsubpath", &ci_hphp_recursivedirectoryiterator_getsubpath},
+  {0x43901543EA8625D5LL, "curl_multi_select", &ci_curl_multi_select},
+  {0x08E6C1CD3AC64ECALL, "hphp_splfileinfo_gettype", &ci_hphp_splfileinfo_gettype},
+  {0x0CF27A6BC84CEEFDLL, "openssl_get_publickey", &ci_openssl_get_publickey},
+  {-1, NULL, NULL},
+  {0x7D1DCB9F4168032ELL, "imap_getsubscribed", &ci_imap_getsubscribed},
+  {0x7D68CADB8069466FLL, "magickaverageimages", &ci_magickaverageimages},
+  {0x373B3FADEACB7CB0LL, "openssl_private_encrypt", &ci_openssl_private_encrypt},
+  {-1, NULL, NULL},
+  {0x4E19AFB75A62AD7FLL, "imagerotate", &ci_imagerotate},
+  {-1, NULL, NULL},
+  {0x2EC0ABF9A979FAF4LL, "ob_get_level", &ci_ob_get_level},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5E3767128C04CF7FLL, "imap_open", &ci_imap_open},
+  {0x544302E2FAD3FCD3LL, "magicknextimage", &ci_magicknextimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6829094421CDB433LL, "touch", &ci_touch},
+  {0x4A3127C309B0C3E8LL, "drawsetstrokelinecap", &ci_drawsetstrokelinecap},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7FA6D13B0D38E616LL, "imagegif", &ci_imagegif},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4E4449EBAADD7B44LL, "magickpingimage", &ci_magickpingimage},
+  {0x20DD4631AD975F21LL, "imap_rfc822_write_address", &ci_imap_rfc822_write_address},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1062CF2DA5443888LL, "imagedashedline", &ci_imagedashedline},
+  {-1, NULL, NULL},
+  {0x4282E0231F600049LL, "fseek", &ci_fseek},
+  {0x2FE56B4C457AB5D4LL, "ctype_graph", &ci_ctype_graph},
+  {0x10C5CF7B55173BC7LL, "settype", &ci_settype},
+  {-1, NULL, NULL},
+  {0x4ACCF26A7AE80D5ALL, "imagefilltoborder", &ci_imagefilltoborder},
+  {0x0E7E9AA21AE99FA4LL, "hphp_recursiveiteratoriterator_current", &ci_hphp_recursiveiteratoriterator_current},
+  {0x1B7CE8114AEACB1BLL, "magickannotateimage", &ci_magickannotateimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7E6024E53AEEE25DLL, "apc_delete", &ci_apc_delete},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2B7CAC006AF27F9ALL, "fflush", &ci_fflush},
+  {-1, NULL, NULL},
+  {0x5697E5F6AAF47E63LL, "mb_http_input", &ci_mb_http_input},
+  {0x46832743CAF5C5FDLL, "dom_element_set_attribute_node", &ci_dom_element_set_attribute_node},
+  {-1, NULL, NULL},
+  {0x2F9816D9A2B2CE6ALL, "mysql_set_charset", &ci_mysql_set_charset},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3C7B86F57AFA0872LL, "hebrev", &ci_hebrev},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x063200B5AAFEC54FLL, "mysql_thread_id", &ci_mysql_thread_id},
+  {0x45D6BA980AFFDBCELL, "msg_get_queue", &ci_msg_get_queue},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4A24DB9D6B0334C4LL, "hphp_recursivedirectoryiterator_next", &ci_hphp_recursivedirectoryiterator_next},
+  {0x3B72159A4B04FB8BLL, "set_time_limit", &ci_set_time_limit},
+  {0x34F0E032AB05C82CLL, "pixelsetblue", &ci_pixelsetblue},
+  {0x349E2E0F2CD7B9DFLL, "magickgetversion", &ci_magickgetversion},
+  {0x0F5984B8A7FD8593LL, "hphp_splfileinfo_getperms", &ci_hphp_splfileinfo_getperms},
+  {0x0C4B98B47B0862B6LL, "apd_echo", &ci_apd_echo},
+  {0x205BB9CFF397B65ELL, "ldap_mod_replace", &ci_ldap_mod_replace},
+  {0x11149278DB0A9A83LL, "levenshtein", &ci_levenshtein},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x12580A083B0D7CAELL, "iterator_apply", &ci_iterator_apply},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7F6A6306BBE8AA44LL, "imagelayereffect", &ci_imagelayereffect},
+  {-1, NULL, NULL},
+  {0x41BCD0A72B1396CALL, "xmlwriter_start_dtd_attlist", &ci_xmlwriter_start_dtd_attlist},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7052903F1B17AEC4LL, "parse_str", &ci_parse_str},
+  {0x7505924F05854489LL, "dom_element_set_attribute_ns", &ci_dom_element_set_attribute_ns},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x070A63F6A0B8711CLL, "array_walk_recursive", &ci_array_walk_recursive},
+  {0x49D986274B1C5F55LL, "collator_asort", &ci_collator_asort},
+  {0x2EFF4F69EB1DF68FLL, "apache_get_config", &ci_apache_get_config},
+  {0x4991643BD854D787LL, "drawgetexceptionstring", &ci_drawgetexceptionstring},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x558D62FBEB210872LL, "str_rot13", &ci_str_rot13},
+  {-1, NULL, NULL},
+  {0x2227E30BAB23B181LL, "dom_xpath_query", &ci_dom_xpath_query},
+  {0x044D7013BDB33DDFLL, "spl_autoload_functions", &ci_spl_autoload_functions},
+  {0x2B7532A070BF605CLL, "openssl_get_privatekey", &ci_openssl_get_privatekey},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6349C9658B2A2430LL, "memcache_pconnect", &ci_memcache_pconnect},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3880550F6AD8034BLL, "session_destroy", &ci_session_destroy},
+  {-1, NULL, NULL},
+  {0x5B6FF42ACB2FBEE4LL, "getmyuid", &ci_getmyuid},
+  {0x4111669F4862E27ELL, "drawpathlinetoverticalrelative", &ci_drawpathlinetoverticalrelative},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7FCE6DD53FED6763LL, "intl_is_failure", &ci_intl_is_failure},
+  {0x58B9EFA0FB35FEB7LL, "stream_filter_prepend", &ci_stream_filter_prepend},
+  {0x7588BD0546C8BA8BLL, "hphp_recursivedirectoryiterator_valid", &ci_hphp_recursivedirectoryiterator_valid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x357F73CEBD6E2C49LL, "write_hdf_string", &ci_write_hdf_string},
+  {0x7731B90FB7C975C1LL, "magickremoveimageprofile", &ci_magickremoveimageprofile},
+  {0x316F2725AC15042FLL, "stream_resolve_include_path", &ci_stream_resolve_include_path},
+  {0x7601F38FDB3DDEF2LL, "hphp_service_thread_stopped", &ci_hphp_service_thread_stopped},
+  {0x31242F51AA828B79LL, "drawpoppattern", &ci_drawpoppattern},
+  {-1, NULL, NULL},
+  {0x738D381800CE946DLL, "ldap_parse_result", &ci_ldap_parse_result},
+  {-1, NULL, NULL},
+  {0x7B6BF544EB420E54LL, "hphp_recursivedirectoryiterator_haschildren", &ci_hphp_recursivedirectoryiterator_haschildren},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4FC9FE38A748B507LL, "intl_get_error_message", &ci_intl_get_error_message},
+  {-1, NULL, NULL},
+  {0x45DA105C5B48F8F5LL, "apd_set_pprof_trace", &ci_apd_set_pprof_trace},
+  {0x3C23768CFB492C4ALL, "gzinflate", &ci_gzinflate},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6CA8CF41D27D1CF3LL, "imap_headerinfo", &ci_imap_headerinfo},
+  {-1, NULL, NULL},
+  {0x3EBD8F559B4EA883LL, "hphp_splfileobject_getflags", &ci_hphp_splfileobject_getflags},
+  {0x0ECFC3676B4FDE81LL, "chr", &ci_chr},
+  {0x00F8C6758B50B878LL, "drawpathcurvetoquadraticbezierabsolute", &ci_drawpathcurvetoquadraticbezierabsolute},
+  {-1, NULL, NULL},
+  {0x71E3372AA1AD0105LL, "is_infinite", &ci_is_infinite},
+  {0x1B9FC9E27B8AB2EDLL, "memcache_flush", &ci_memcache_flush},
+  {-1, NULL, NULL},
+  {0x145D42B2AB55D022LL, "drawmatte", &ci_drawmatte},
+  {-1, NULL, NULL},
+  {0x5B42B2AB1B57D796LL, "array_replace", &ci_array_replace},
+  {0x7BD43EB167198C20LL, "xmlwriter_write_pi", &ci_xmlwriter_write_pi},
+  {0x134550B9EB596622LL, "drawgetfontstyle", &ci_drawgetfontstyle},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7E98B97C1B5D861DLL, "magickqueryconfigureoptions", &ci_magickqueryconfigureoptions},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x71B0B871CB62B8A1LL, "spl_autoload", &ci_spl_autoload},
+  {-1, NULL, NULL},
+  {0x5F780851DB5240DDLL, "hphp_current_ref", &ci_hphp_current_ref},
+  {0x4E172EA6743697C1LL, "ldap_first_entry", &ci_ldap_first_entry},
+  {0x09B4EE276DCCFCFBLL, "mysql_fetch_row", &ci_mysql_fetch_row},
+  {-1, NULL, NULL},
+  {0x6F0F82818B68A8FALL, "array_values", &ci_array_values},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1EEBDFD62B6BEE4CLL, "mcrypt_module_get_algo_block_size", &ci_mcrypt_module_get_algo_block_size},
+  {0x3801923AD84670DBLL, "apc_inc", &ci_apc_inc},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x61499C92F4FBA485LL, "hphp_splfileobject_fgetc", &ci_hphp_splfileobject_fgetc},
+  {-1, NULL, NULL},
+  {0x41924CBA5B717859LL, "imap_append", &ci_imap_append},
+  {-1, NULL, NULL},
+  {0x6AA3788C9B737877LL, "magickdespeckleimage", &ci_magickdespeckleimage},
+  {-1, NULL, NULL},
+  {0x48B2E069B89489DBLL, "magickappendimages", &ci_magickappendimages},
+  {0x28DC1AD6DA9E7DA6LL, "gethostbyname", &ci_gethostbyname},
+  {0x623CE67C41A9E6B5LL, "ldap_next_attribute", &ci_ldap_next_attribute},
+  {0x5E54CE856B78223ELL, "array_flip", &ci_array_flip},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x24D0895FBB7BCB15LL, "is_callable", &ci_is_callable},
+  {0x5C1F75D51C077CF3LL, "pixelgetindex", &ci_pixelgetindex},
+  {0x66EF68EF3C144C07LL, "imap_gc", &ci_imap_gc},
+  {0x5B33B55D4B7E339BLL, "fpassthru", &ci_fpassthru},
+  {0x48BBFB59FB7F90B2LL, "iconv_strlen", &ci_iconv_strlen},
+  {-1, NULL, NULL},
+  {0x5E73B9F3B7C8224DLL, "parse_hdf_string", &ci_parse_hdf_string},
+  {0x5F585DF7CB82E2DDLL, "hphp_splfileinfo_iswritable", &ci_hphp_splfileinfo_iswritable},
+  {-1, NULL, NULL},
+  {0x40329F2A6B84D03BLL, "dom_node_lookup_prefix", &ci_dom_node_lookup_prefix},
+  {-1, NULL, NULL},
+  {0x755A9950B65472FELL, "drawgetgravity", &ci_drawgetgravity},
+  {-1, NULL, NULL},
+  {0x5ECB0B145B88EBBELL, "imagefilledarc", &ci_imagefilledarc},
+  {0x69488CC69B897C3CLL, "hphp_recursiveiteratoriterator_getinneriterator", &ci_hphp_recursiveiteratoriterator_getinneriterator},
+  {-1, NULL, NULL},
+  {0x291088666B8BF11DLL, "drawsetfontfamily", &ci_drawsetfontfamily},
+  {0x4AC405EA2B8C4613LL, "magickresetiterator", &ci_magickresetiterator},
+  {0x78261FA60B8D89A3LL, "imagepsloadfont", &ci_imagepsloadfont},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x25FA64929C619391LL, "asin", &ci_asin},
+  {-1, NULL, NULL},
+  {0x7D85E9FACB92D214LL, "magickgetimageblob", &ci_magickgetimageblob},
+  {-1, NULL, NULL},
+  {0x5062777D2B947741LL, "wordwrap", &ci_wordwrap},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x569EED88F20BAAB2LL, "drawgettextundercolor", &ci_drawgettextundercolor},
+  {-1, NULL, NULL},
+  {0x7039C5EBB1D6BC1ELL, "array_walk", &ci_array_walk},
+  {0x24206A195B9C203FLL, "ucfirst", &ci_ucfirst},
+  {0x429D088E9779CD26LL, "dom_document_normalize_document", &ci_dom_document_normalize_document},
+  {-1, NULL, NULL},
+  {0x5629E14D6B9FF662LL, "dom_document_get_element_by_id", &ci_dom_document_get_element_by_id},
+  {0x5D170BCBBBA02152LL, "system", &ci_system},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x28FB6C2FF0372CE0LL, "openssl_decrypt", &ci_openssl_decrypt},
+  {0x4DAC43060BA57D32LL, "stream_wrapper_restore", &ci_stream_wrapper_restore},
+  {0x4623383F8534E8C7LL, "array_multisort", &ci_array_multisort},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x42F0AED7599C1B75LL, "magickechoimageblob", &ci_magickechoimageblob},
+  {-1, NULL, NULL},
+  {0x6DFC0765EBAB81A2LL, "mcrypt_decrypt", &ci_mcrypt_decrypt},
+  {0x068438AFD33A9953LL, "imagecolorclosesthwb", &ci_imagecolorclosesthwb},
+  {-1, NULL, NULL},
+  {0x31EAD049860CE725LL, "posix_kill", &ci_posix_kill},
+  {0x12859AD75BAF3AF8LL, "magickreadimageblob", &ci_magickreadimageblob},
+  {-1, NULL, NULL},
+  {0x1BD984C11BB16760LL, "array_merge", &ci_array_merge},
+  {-1, NULL, NULL},
+  {0x13D0427F3BB3E570LL, "get_declared_interfaces", &ci_get_declared_interfaces},
+  {0x160B01F095B20E42LL, "mb_output_handler", &ci_mb_output_handler},
+  {-1, NULL, NULL},
+  {0x56C0CCB57BB6EFB6LL, "magicksetimageunits", &ci_magicksetimageunits},
+  {0x3E4E7C561D3A541ELL, "fgetss", &ci_fgetss},
+  {0x2EE56D216BB832F2LL, "time_nanosleep", &ci_time_nanosleep},
+  {0x20502FCACBB9F5A0LL, "convert_uuencode", &ci_convert_uuencode},
+  {0x016722439BBA756FLL, "filetype", &ci_filetype},
+  {-1, NULL, NULL},
+  {0x32D5F30455C90C1ELL, "imap_subscribe", &ci_imap_subscribe},
+  {-1, NULL, NULL},
+  {0x348888DDF223AACBLL, "mt_getrandmax", &ci_mt_getrandmax},
+  {0x6352349F97557D78LL, "stream_socket_get_name", &ci_stream_socket_get_name},
+  {0x25FBB61480091BE1LL, "mysql_client_encoding", &ci_mysql_client_encoding},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1C35934C6BC52C76LL, "libxml_clear_errors", &ci_libxml_clear_errors},
+  {0x09C6455B4BC6FCDALL, "drawsetviewbox", &ci_drawsetviewbox},
+  {0x51201EE65BC729F4LL, "localtime", &ci_localtime},
+  {0x0D4446B2DBC8EF39LL, "hphp_splfileinfo_getinode", &ci_hphp_splfileinfo_getinode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x455DB7F86BCEDD46LL, "pixelsetopacityquantum", &ci_pixelsetopacityquantum},
+  {0x5A8AF4F880DA4CEALL, "mailparse_msg_extract_whole_part_file", &ci_mailparse_msg_extract_whole_part_file},
+  {0x17B83C425BD09A04LL, "atanh", &ci_atanh},
+  {-1, NULL, NULL},
+  {0x5BBFA7EAEBD25830LL, "pixelgetcyanquantum", &ci_pixelgetcyanquantum},
+  {0x4DAA3FBC2BD3A724LL, "magickequalizeimage", &ci_magickequalizeimage},
+  {0x665F08996BD4AC78LL, "magicksetimagegreenprimary", &ci_magicksetimagegreenprimary},
+  {0x60C4B9EEDBD5FA66LL, "pos", &ci_pos},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x31D1C58F7BD89ADELL, "hphp_directoryiterator_seek", &ci_hphp_directoryiterator_seek},
+  {0x00EEEE9C6CEA5FEFLL, "xmlwriter_write_element_ns", &ci_xmlwriter_write_element_ns},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x21D5A3208639EE65LL, "dom_element_get_attribute_node_ns", &ci_dom_element_get_attribute_node_ns},
+  {0x77EB4D2F5BDDB354LL, "magickgetimageresolution", &ci_magickgetimageresolution},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0A8ED0466E41AFBCLL, "bzclose", &ci_bzclose},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2AD3361DE8B1D571LL, "pcntl_signal_dispatch", &ci_pcntl_signal_dispatch},
+  {-1, NULL, NULL},
+  {0x07EB5C3A3BEA3053LL, "acosh", &ci_acosh},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x02BCE5B0FBED61F1LL, "strlen", &ci_strlen},
+  {0x78FFA0E69D6AACEELL, "mcrypt_cfb", &ci_mcrypt_cfb},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x748D3DFF0EB57CFFLL, "uniqid", &ci_uniqid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4AEC19D75BF652E2LL, "magickremoveimage", &ci_magickremoveimage},
+  {0x37B4612178EF91A6LL, "memcache_get_version", &ci_memcache_get_version},
+  {-1, NULL, NULL},
+  {0x768F3E6D1CBA5CFELL, "socket_recv", &ci_socket_recv},
+  {0x78257F34467BDF32LL, "drawsetstrokedasharray", &ci_drawsetstrokedasharray},
+  {0x7DB57C59E607627DLL, "mcrypt_generic_deinit", &ci_mcrypt_generic_deinit},
+  {0x27363CE6CBFC392DLL, "pcntl_wexitstatus", &ci_pcntl_wexitstatus},
+  {-1, NULL, NULL},
+  {0x2A5A519E4BFE442DLL, "mb_eregi", &ci_mb_eregi},
+  {-1, NULL, NULL},
+  {0x61A192D10C004231LL, "magickconvolveimage", &ci_magickconvolveimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x53AEFD595C044754LL, "max", &ci_max},
+  {-1, NULL, NULL},
+  {0x5E43280BC8DD1DF8LL, "magicktrimimage", &ci_magicktrimimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x327C865E52FD12BDLL, "ldap_get_values_len", &ci_ldap_get_values_len},
+  {-1, NULL, NULL},
+  {0x391E0A4CF1EC9A07LL, "stream_socket_recvfrom", &ci_stream_socket_recvfrom},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1D3B08AA0AF50F06LL, "gettype", &ci_gettype},
+  {0x7BB7C27B2C118182LL, "get_magic_quotes_gpc", &ci_get_magic_quotes_gpc},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x100385A0988FD514LL, "magickgetfilename", &ci_magickgetfilename},
+  {0x05D293F45C15F75BLL, "ldap_mod_del", &ci_ldap_mod_del},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7549612A72BA5880LL, "hphp_splfileinfo_getrealpath", &ci_hphp_splfileinfo_getrealpath},
+  {0x1F3E32847C1CCA31LL, "mb_ereg_match", &ci_mb_ereg_match},
+  {0x1331979EF8EF0AABLL, "mb_ereg_search", &ci_mb_ereg_search},
+  {0x25FCE64E12505FF6LL, "magicksetimagerenderingintent", &ci_magicksetimagerenderingintent},
+  {0x7756593AAC1F6F0BLL, "imagecreatefromstring", &ci_imagecreatefromstring},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x549D51040C250338LL, "cleardrawingwand", &ci_cleardrawingwand},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x735B81C45C2971A3LL, "drawgetfillopacity", &ci_drawgetfillopacity},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3CCD09EC3511CED2LL, "apd_stop_trace", &ci_apd_stop_trace},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0103FE1E2C307302LL, "socket_recvfrom", &ci_socket_recvfrom},
+  {0x724011CF7C31AE83LL, "sqrt", &ci_sqrt},
+  {0x7554E3E8674F2757LL, "mb_list_encodings", &ci_mb_list_encodings},
+  {0x37A9E8F91C33EE93LL, "magickborderimage", &ci_magickborderimage},
+  {0x42463E7E5C3434AFLL, "mb_strrichr", &ci_mb_strrichr},
+  {0x7D69B3537C353EC5LL, "hphp_splfileinfo_isfile", &ci_hphp_splfileinfo_isfile},
+  {-1, NULL, NULL},
+  {0x12B7B2D835B80E77LL, "chmod", &ci_chmod},
+  {0x5665CB664C38A299LL, "parse_ini_string", &ci_parse_ini_string},
+  {0x32F23F206C394036LL, "curl_setopt_array", &ci_curl_setopt_array},
+  {0x230FE1D6EC599525LL, "link", &ci_link},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x158348EB08F406D6LL, "strtr", &ci_strtr},
+  {0x1419B3BF428B2967LL, "evhttp_async_post", &ci_evhttp_async_post},
+  {0x2EAA47FA6C3FEFD0LL, "drawgetstrokealpha", &ci_drawgetstrokealpha},
+  {0x0833BCE91C40CC0BLL, "magickqueryconfigureoption", &ci_magickqueryconfigureoption},
+  {-1, NULL, NULL},
+  {0x04E86BA79B6CBAFELL, "stream_socket_shutdown", &ci_stream_socket_shutdown},
+  {0x537CF5DE8C43CCF9LL, "curl_getinfo", &ci_curl_getinfo},
+  {0x13B3172E092D99BALL, "is_dir", &ci_is_dir},
+  {-1, NULL, NULL},
+  {0x2BD6476D2C467ACCLL, "pagelet_server_task_status", &ci_pagelet_server_task_status},
+  {-1, NULL, NULL},
+  {0x03A183D73942B1DDLL, "apc_filehits", &ci_apc_filehits},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3FF63423EC4B280CLL, "posix_getegid", &ci_posix_getegid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7639C74DBC4F4E62LL, "array_splice", &ci_array_splice},
+  {0x1476A177CC50686FLL, "mb_strstr", &ci_mb_strstr},
+  {0x3A34B44E4C51C58BLL, "xml_set_element_handler", &ci_xml_set_element_handler},
+  {-1, NULL, NULL},
+  {0x41136A5F28E84F3CLL, "forward_static_call_array", &ci_forward_static_call_array},
+  {0x3DA2058E5C540566LL, "spliti", &ci_spliti},
+  {-1, NULL, NULL},
+  {0x2BA2A6480C563802LL, "imap_errors", &ci_imap_errors},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x011B54958C597878LL, "get_called_class", &ci_get_called_class},
+  {0x50AC61A28C5AC71CLL, "imagecolorclosestalpha", &ci_imagecolorclosestalpha},
+  {0x6C07640F7C5BD3B6LL, "imagettfbbox", &ci_imagettfbbox},
+  {-1, NULL, NULL},
+  {0x7E929ED7D9BE6A57LL, "ini_get", &ci_ini_get},
+  {0x41BD9EA0BC5E4C6ALL, "move_uploaded_file", &ci_move_uploaded_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x73FE5C79E14A0E29LL, "pixelsetbluequantum", &ci_pixelsetbluequantum},
+  {0x5B60C8396C624939LL, "mb_substitute_character", &ci_mb_substitute_character},
+  {0x17CB328F55FDF0E8LL, "drawsetstrokeantialias", &ci_drawsetstrokeantialias},
+  {0x6AA89C314C647CEFLL, "magickgetimagehistogram", &ci_magickgetimagehistogram},
+  {0x042193C97C65FFCELL, "magickwaveimage", &ci_magickwaveimage},
+  {-1, NULL, NULL},
+  {0x5C0DECC8CC67E20DLL, "magickwriteimagesfile", &ci_magickwriteimagesfile},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5A02EE8ED39F0C27LL, "posix_getgrnam", &ci_posix_getgrnam},
+  {0x3C16230CBC6D471BLL, "imagecreatetruecolor", &ci_imagecreatetruecolor},
+  {-1, NULL, NULL},
+  {0x208BB4C3C0BA534ALL, "xmlwriter_write_dtd_element", &ci_xmlwriter_write_dtd_element},
+  {0x0553DE5D0C70C6B6LL, "imap_headers", &ci_imap_headers},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3A2E2C40B019E286LL, "is_a", &ci_is_a},
+  {0x5EFE291585A713F1LL, "method_exists", &ci_method_exists},
+  {-1, NULL, NULL},
+  {0x454DAD4DE5C29902LL, "xhprof_frame_end", &ci_xhprof_frame_end},
+  {0x179A72074C778768LL, "openssl_x509_export_to_file", &ci_openssl_x509_export_to_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x38B376B9D9091267LL, "xmlwriter_write_attribute", &ci_xmlwriter_write_attribute},
+  {0x4512BD5EA7076067LL, "openssl_csr_export_to_file", &ci_openssl_csr_export_to_file},
+  {-1, NULL, NULL},
+  {0x5367B0F3A4D2D7EFLL, "ldap_list", &ci_ldap_list},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x245AA2790C87C4ACLL, "image_type_to_mime_type", &ci_image_type_to_mime_type},
+  {0x030DFC3D3C88BABFLL, "filegroup", &ci_filegroup},
+  {0x553ADA5A41AE976DLL, "mb_ereg_replace", &ci_mb_ereg_replace},
+  {-1, NULL, NULL},
+  {0x3CD58419E181A747LL, "magickstereoimage", &ci_magickstereoimage},
+  {0x4D9A87BD0CF742D2LL, "imagepsextendfont", &ci_imagepsextendfont},
+  {-1, NULL, NULL},
+  {0x5E5E4F998C8E7324LL, "pcntl_wifexited", &ci_pcntl_wifexited},
+  {0x3402C1E7544C382ELL, "lstat", &ci_lstat},
+  {-1, NULL, NULL},
+  {0x23E563F1EC919DF7LL, "hphp_splfileinfo_getpathname", &ci_hphp_splfileinfo_getpathname},
+  {0x0CADFE289C92893ELL, "socket_getpeername", &ci_socket_getpeername},
+  {-1, NULL, NULL},
+  {0x19279D6DB4F70808LL, "hash_hmac", &ci_hash_hmac},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x145702974C97F9B9LL, "ltrim", &ci_ltrim},
+  {-1, NULL, NULL},
+  {0x23B7D9E4EC992F16LL, "stream_get_line", &ci_stream_get_line},
+  {0x6770E2559C9A152FLL, "openssl_private_decrypt", &ci_openssl_private_decrypt},
+  {0x323FE1D92C9B3CD4LL, "gzdecode", &ci_gzdecode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x68272A37CC9E729ALL, "mb_strtolower", &ci_mb_strtolower},
+  {0x2B18DFF183C0BA5BLL, "mb_get_info", &ci_mb_get_info},
+  {-1, NULL, NULL},
+  {0x7C8969C75CA1783CLL, "get_declared_classes", &ci_get_declared_classes},
+  {-1, NULL, NULL},
+  {0x09837A82A928AB97LL, "is_null", &ci_is_null},
+  {0x26D226FD28566799LL, "date_isodate_set", &ci_date_isodate_set},
+  {0x7A957BEC6CA57A75LL, "preg_replace_callback", &ci_preg_replace_callback},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x48305E8ABB8BC261LL, "hphp_instanceof", &ci_hphp_instanceof},
+  {-1, NULL, NULL},
+  {0x03066277F647E652LL, "hphp_splfileobject_ftell", &ci_hphp_splfileobject_ftell},
+  {0x0173CC6FACAB93CBLL, "quotemeta", &ci_quotemeta},
+  {-1, NULL, NULL},
+  {0x514EA9C8FF5B33F8LL, "posix_getrlimit", &ci_posix_getrlimit},
+  {0x19932EEC5CAE01EDLL, "hphp_splfileinfo_getfileinfo", &ci_hphp_splfileinfo_getfileinfo},
+  {0x08B4BEBAB3312BF6LL, "image_type_to_extension", &ci_image_type_to_extension},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0E804FCE5C14CBE5LL, "imap_sort", &ci_imap_sort},
+  {0x30A8326034801D0CLL, "mysql_pconnect", &ci_mysql_pconnect},
+  {0x41785512C45FCD49LL, "mysql_ping", &ci_mysql_ping},
+  {0x023133732CB51B9ALL, "exif_thumbnail", &ci_exif_thumbnail},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x507CE1912FD74930LL, "mail", &ci_mail},
+  {0x271AB768D202F05ALL, "mcrypt_module_is_block_algorithm", &ci_mcrypt_module_is_block_algorithm},
+  {0x7D9BF61D6CDE3BB0LL, "fb_parallel_query", &ci_fb_parallel_query},
+  {0x797CEC173CBB7AA7LL, "ob_get_flush", &ci_ob_get_flush},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7628053EFCC0C9D7LL, "hphp_clear_unflushed", &ci_hphp_clear_unflushed},
+  {0x66ECE26DDCC12794LL, "imap_fetchheader", &ci_imap_fetchheader},
+  {0x4F39BD300305746CLL, "hphp_splfileobject_key", &ci_hphp_splfileobject_key},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7539134E1CC61451LL, "xmlwriter_start_cdata", &ci_xmlwriter_start_cdata},
+  {0x5F7940A713863813LL, "floor", &ci_floor},
+  {-1, NULL, NULL},
+  {0x56023CC5ECC9ECB2LL, "dns_get_mx", &ci_dns_get_mx},
+  {-1, NULL, NULL},
+  {0x44CE4DB1CE7E9F86LL, "flock", &ci_flock},
+  {-1, NULL, NULL},
+  {0x1196D899ACCD379BLL, "evhttp_recv", &ci_evhttp_recv},
+  {0x10DB229871AB794CLL, "imap_msgno", &ci_imap_msgno},
+  {-1, NULL, NULL},
+  {0x3E4DAD592CD0A0D2LL, "magickdescribeimage", &ci_magickdescribeimage},
+  {-1, NULL, NULL},
+  {0x3409D717D9246C64LL, "libxml_use_internal_errors", &ci_libxml_use_internal_errors},
+  {0x5E5C875DB04CFB71LL, "drawrectangle", &ci_drawrectangle},
+  {-1, NULL, NULL},
+  {0x22251ECF8CD58BCDLL, "array_product", &ci_array_product},
+  {0x747A7F585CD694DFLL, "zend_version", &ci_zend_version},
+  {0x3BF44C6DECD790D5LL, "xmlwriter_start_dtd_entity", &ci_xmlwriter_start_dtd_entity},
+  {-1, NULL, NULL},
+  {0x34A38DDF2CD914C5LL, "long2ip", &ci_long2ip},
+  {-1, NULL, NULL},
+  {0x6B477F3B9CDB10C5LL, "base64_decode", &ci_base64_decode},
+  {0x111DACCF8628267DLL, "array_replace_recursive", &ci_array_replace_recursive},
+  {0x35D259398CDDA2ADLL, "pixelgetredquantum", &ci_pixelgetredquantum},
+  {0x05D7B804ECDE8C7ALL, "checkdnsrr", &ci_checkdnsrr},
+  {-1, NULL, NULL},
+  {0x7DB9D839ACE0DEB3LL, "natsort", &ci_natsort},
+  {-1, NULL, NULL},
+  {0x047BF4D3D0ED08FELL, "strchr", &ci_strchr},
+  {0x32E6E5D3CCE3703ELL, "magickgetimagewidth", &ci_magickgetimagewidth},
+  {-1, NULL, NULL},
+  {0x7579DBE83CE5812DLL, "imagerectangle", &ci_imagerectangle},
+  {0x4D624A655A9B581DLL, "drawpoint", &ci_drawpoint},
+  {0x4297B1072CE76810LL, "fb_call_user_func_array_safe", &ci_fb_call_user_func_array_safe},
+  {-1, NULL, NULL},
+  {0x6535B60A4BC449F3LL, "dns_get_record", &ci_dns_get_record},
+  {0x496CF4113CEA8F39LL, "magicksetimagefilename", &ci_magicksetimagefilename},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x290E54137CF06801LL, "dom_nodelist_item", &ci_dom_nodelist_item},
+  {0x231BCE6071220AD6LL, "drawcircle", &ci_drawcircle},
+  {-1, NULL, NULL},
+  {0x399522EE0CF3EB1ALL, "drawsetstrokewidth", &ci_drawsetstrokewidth},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x62DE03461EF4663CLL, "symlink", &ci_symlink},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x340A51AE22A924E0LL, "reset", &ci_reset},
+  {0x0B1BA48B0CFB1112LL, "strval", &ci_strval},
+  {-1, NULL, NULL},
+  {0x46C33B4739C2FAEDLL, "shm_remove_var", &ci_shm_remove_var},
+  {0x2D3F0F8DB0C20C49LL, "dom_node_insert_before", &ci_dom_node_insert_before},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x71AFF1D58D103A72LL, "imagefontheight", &ci_imagefontheight},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x638690DF6D06FDD7LL, "imageconvolution", &ci_imageconvolution},
+  {0x11A5C66A3D0711AALL, "apc_sma_info", &ci_apc_sma_info},
+  {0x71B25229CD080C7BLL, "dom_element_set_attribute_node_ns", &ci_dom_element_set_attribute_node_ns},
+  {-1, NULL, NULL},
+  {0x7B4E25772D0AC78FLL, "simplexml_load_file", &ci_simplexml_load_file},
+  {-1, NULL, NULL},
+  {0x37D003B09D0C759BLL, "stream_get_contents", &ci_stream_get_contents},
+  {0x65B39B11F5D7C041LL, "array_unique", &ci_array_unique},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x47C62D58B0B65DFBLL, "thrift_protocol_write_binary", &ci_thrift_protocol_write_binary},
+  {0x78420E0B5D110723LL, "imagetruecolortopalette", &ci_imagetruecolortopalette},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x141EDCAE1D155311LL, "xbox_get_thread_time", &ci_xbox_get_thread_time},
+  {0x3946D67A0D16D93ELL, "hphp_splfileinfo_isreadable", &ci_hphp_splfileinfo_isreadable},
+  {-1, NULL, NULL},
+  {0x798F2776FECAEB25LL, "get_required_files", &ci_get_required_files},
+  {-1, NULL, NULL},
+  {0x7AFA32F70E8195B3LL, "xbox_set_thread_timeout", &ci_xbox_set_thread_timeout},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5388045C2D13D497LL, "mysql_num_fields", &ci_mysql_num_fields},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0FBCF35ADD209D4FLL, "drawarc", &ci_drawarc},
+  {0x15ACD9F32D214CBBLL, "mysql_fetch_lengths", &ci_mysql_fetch_lengths},
+  {0x6B03203C8A01C141LL, "imap_timeout", &ci_imap_timeout},
+  {-1, NULL, NULL},
+  {0x75CA86838D24A1CALL, "hash_algos", &ci_hash_algos},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0888289CBD2887E2LL, "iconv_substr", &ci_iconv_substr},
+  {0x1BB5D99C1D29CBE7LL, "strstr", &ci_strstr},
+  {-1, NULL, NULL},
+  {0x32B3951DFD2B9EE8LL, "hphp_directoryiterator_isdot", &ci_hphp_directoryiterator_isdot},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1F4D41588D2EA4BDLL, "hphp_get_status", &ci_hphp_get_status},
+  {0x6692475BA65A2F06LL, "imagearc", &ci_imagearc},
+  {0x4B96F870584541B2LL, "hphp_splfileobject_setflags", &ci_hphp_splfileobject_setflags},
+  {0x4F1D2858AD31AF60LL, "imagecreatefromgd", &ci_imagecreatefromgd},
+  {0x436B36C5EB8DB4F4LL, "mcrypt_generic", &ci_mcrypt_generic},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5F41821072A06C7ELL, "hphp_splfileinfo_getctime", &ci_hphp_splfileinfo_getctime},
+  {-1, NULL, NULL},
+  {0x5A017A4C6A41E85CLL, "curl_multi_add_handle", &ci_curl_multi_add_handle},
+  {0x0CC53B2F0D38D189LL, "timezone_offset_get", &ci_timezone_offset_get},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1A08C578AD3BC47CLL, "apache_response_headers", &ci_apache_response_headers},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x509B763CDAD9D105LL, "gethostbyaddr", &ci_gethostbyaddr},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x34F150F3D94E6D61LL, "gzpassthru", &ci_gzpassthru},
+  {0x2B9425038D4230E4LL, "imagecreatefromxpm", &ci_imagecreatefromxpm},
+  {0x5BDE96FD5015AB82LL, "base_convert", &ci_base_convert},
+  {-1, NULL, NULL},
+  {0x72E1FD3DCD45C577LL, "bzopen", &ci_bzopen},
+  {0x1B217E78CBC713FALL, "zend_thread_id", &ci_zend_thread_id},
+  {-1, NULL, NULL},
+  {0x682C14726D484A40LL, "fileatime", &ci_fileatime},
+  {0x66B19094ED494592LL, "imap_uid", &ci_imap_uid},
+  {-1, NULL, NULL},
+  {0x4F2D0EFF0D4B534FLL, "fb_get_taint", &ci_fb_get_taint},
+  {-1, NULL, NULL},
+  {0x22BA0903D344CBC9LL, "array_rand", &ci_array_rand},
+  {0x7E1E9C4C3D4E8A5DLL, "stream_select", &ci_stream_select},
+  {0x2180916F8D4F6A85LL, "drawcomment", &ci_drawcomment},
+  {0x43C0E9827D502C63LL, "array_intersect_assoc", &ci_array_intersect_assoc},
+  {0x2532EB687D51E4D8LL, "unregister_tick_function", &ci_unregister_tick_function},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6BF155774D546E54LL, "define_syslog_variables", &ci_define_syslog_variables},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x301963016A91741FLL, "hphp_stats", &ci_hphp_stats},
+  {-1, NULL, NULL},
+  {0x28C44527BD59D112LL, "is_link", &ci_is_link},
+  {0x4859AF715D5A3479LL, "magickmagnifyimage", &ci_magickmagnifyimage},
+  {-1, NULL, NULL},
+  {0x5C6A85B448C352DALL, "posix_uname", &ci_posix_uname},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7CC683891D5F038BLL, "imap_qprint", &ci_imap_qprint},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5FF7C3A6BDDCFA42LL, "mb_convert_kana", &ci_mb_convert_kana},
+  {0x41A19AE18BC8B3F2LL, "curl_error", &ci_curl_error},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7A4B37C23D674659LL, "collator_get_error_message", &ci_collator_get_error_message},
+  {0x6B259D5D9D681AF0LL, "register_postsend_function", &ci_register_postsend_function},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0D375A94E75ACBCALL, "hphp_throw_fatal_error", &ci_hphp_throw_fatal_error},
+  {0x0AFD4F231D6CB911LL, "magickaddimage", &ci_magickaddimage},
+  {0x1301F911ED6D54D8LL, "is_nan", &ci_is_nan},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2A57E5D29D73D13ALL, "register_tick_function", &ci_register_tick_function},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x007B6BD94D767226LL, "hphp_splfileobject_fpassthru", &ci_hphp_splfileobject_fpassthru},
+  {0x3B46305DA1154F42LL, "drawpopclippath", &ci_drawpopclippath},
+  {0x1A6B577442218813LL, "pixelsetmagentaquantum", &ci_pixelsetmagentaquantum},
+  {0x26D53A77483EF3F4LL, "drawbezier", &ci_drawbezier},
+  {0x4052842EC87038DBLL, "magickcropimage", &ci_magickcropimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x05FAA2085D94FE12LL, "urlencode", &ci_urlencode},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x07DC355325165C67LL, "magickwriteimage", &ci_magickwriteimage},
+  {0x4351AFD0FD818D6DLL, "magickmotionblurimage", &ci_magickmotionblurimage},
+  {-1, NULL, NULL},
+  {0x5B9F8B3E1D8330B0LL, "stream_socket_sendto", &ci_stream_socket_sendto},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x011006D90D79E4F8LL, "mysql_errno", &ci_mysql_errno},
+  {0x6E54EEDA1D887C61LL, "magicksetimageinterlacescheme", &ci_magicksetimageinterlacescheme},
+  {-1, NULL, NULL},
+  {0x363D0D4E6D8ACD82LL, "imap_alerts", &ci_imap_alerts},
+  {0x740DC7FFAD8BB1A9LL, "imagecolorat", &ci_imagecolorat},
+  {-1, NULL, NULL},
+  {0x18F2C246FACAD9B7LL, "each", &ci_each},
+  {0x36E9EC047FC73E76LL, "mb_convert_encoding", &ci_mb_convert_encoding},
+  {0x214EA70BDD8FB982LL, "magickmorphimages", &ci_magickmorphimages},
+  {0x05A4C165810A30B8LL, "gzread", &ci_gzread},
+  {0x3A9643992AC805E4LL, "magickdrawimage", &ci_magickdrawimage},
+  {-1, NULL, NULL},
+  {0x15EC64198D93C396LL, "openssl_pkcs12_read", &ci_openssl_pkcs12_read},
+  {0x63AC0EED6D946262LL, "pcntl_fork", &ci_pcntl_fork},
+  {0x7F18BA1FBD95B38CLL, "hphp_directoryiterator_next", &ci_hphp_directoryiterator_next},
+  {-1, NULL, NULL},
+  {0x28A98134BD97BEE3LL, "mb_regex_encoding", &ci_mb_regex_encoding},
+  {0x785ECCF53D98BA3BLL, "curl_multi_exec", &ci_curl_multi_exec},
+  {-1, NULL, NULL},
+  {0x308C90AD9478CB7FLL, "substr_compare", &ci_substr_compare},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x69616E2817E1967DLL, "fileinode", &ci_fileinode},
+  {-1, NULL, NULL},
+  {0x3C32181DDB860AFALL, "imap_getacl", &ci_imap_getacl},
+  {-1, NULL, NULL},
+  {0x30747B708DA1D250LL, "pushdrawingwand", &ci_pushdrawingwand},
+  {0x337D2252CDA22D50LL, "is_real", &ci_is_real},
+  {0x0287B907DDA3EF16LL, "hphpd_get_user_commands", &ci_hphpd_get_user_commands},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4F1D1ED7B087208CLL, "exec", &ci_exec},
+  {0x770DEDCB168B0DBCLL, "mb_ereg_search_setpos", &ci_mb_ereg_search_setpos},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x598472448937E3EELL, "magickqueryfontmetrics", &ci_magickqueryfontmetrics},
+  {0x198627C81DABAD40LL, "register_cleanup_function", &ci_register_cleanup_function},
+  {-1, NULL, NULL},
+  {0x1B8C3DA27170DC58LL, "dirname", &ci_dirname},
+  {0x709140577B2C6580LL, "xhprof_network_enable", &ci_xhprof_network_enable},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x27698DDEDAD6E287LL, "openssl_pkey_new", &ci_openssl_pkey_new},
+  {0x412521E7ADB21577LL, "iconv_mime_decode_headers", &ci_iconv_mime_decode_headers},
+  {0x57633BDF8DB3FC59LL, "i18n_loc_set_attribute", &ci_i18n_loc_set_attribute},
+  {0x2B1C192C419B8732LL, "drawgetexception", &ci_drawgetexception},
+  {0x5EBE067E3FAECDDCLL, "ob_gzhandler", &ci_ob_gzhandler},
+  {0x47CB27E8FDB60309LL, "array_fill", &ci_array_fill},
+  {0x330EE2729DB7C9E9LL, "drawgetfontstretch", &ci_drawgetfontstretch},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x14BF763DDDC014D8LL, "imagepsencodefont", &ci_imagepsencodefont},
+  {-1, NULL, NULL},
+  {0x35C74650867B7023LL, "imagesetpixel", &ci_imagesetpixel},
+  {-1, NULL, NULL},
+  {0x79786FABC5551A82LL, "jpeg2wbmp", &ci_jpeg2wbmp},
+  {0x589F7316EDC581BDLL, "fb_serialize", &ci_fb_serialize},
+  {0x6F6C5B9E3DC64770LL, "drawgetstrokemiterlimit", &ci_drawgetstrokemiterlimit},
+  {0x0FE12E46BC9853F2LL, "stream_filter_append", &ci_stream_filter_append},
+  {0x673B36244DC87091LL, "closelog", &ci_closelog},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3BB701F2BDD0ADCALL, "magickgetimageprofile", &ci_magickgetimageprofile},
+  {-1, NULL, NULL},
+  {0x113ED435AEFDDD49LL, "imagecolorallocatealpha", &ci_imagecolorallocatealpha},
+  {0x6EDC1E7A8D5710C0LL, "memcache_add_server", &ci_memcache_add_server},
+  {-1, NULL, NULL},
+  {0x74BE8836F3B13D9DLL, "session_name", &ci_session_name},
+  {0x0F5917FFCDD6C921LL, "mb_substr", &ci_mb_substr},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3EDB48C5DDD9675FLL, "socket_select", &ci_socket_select},
+  {0x7CB0596B6CCFA945LL, "split", &ci_split},
+  {0x2F585B36DDDB68D6LL, "mb_convert_case", &ci_mb_convert_case},
+  {-1, NULL, NULL},
+  {0x26E8B741BDDDC92ELL, "xmlwriter_start_element", &ci_xmlwriter_start_element},
+  {0x41F7E2214DDE12BCLL, "mcrypt_enc_self_test", &ci_mcrypt_enc_self_test},
+  {0x3ED49C2BBDDFAD77LL, "ldap_next_reference", &ci_ldap_next_reference},
+  {-1, NULL, NULL},
+  {0x6E823A722DE1EA58LL, "stream_socket_client", &ci_stream_socket_client},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x630288865DE68947LL, "php_strip_whitespace", &ci_php_strip_whitespace},
+  {0x13C241C02DE72822LL, "dom_document_relaxng_validate_xml", &ci_dom_document_relaxng_validate_xml},
+  {0x7E88764A1DE8548ALL, "drawgetstrokewidth", &ci_drawgetstrokewidth},
+  {-1, NULL, NULL},
+  {0x4B3F35310DEA31BDLL, "socket_create_pair", &ci_socket_create_pair},
+  {0x1AAF02CF6DEBB437LL, "magickdeconstructimages", &ci_magickdeconstructimages},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6B7347DF1AA7E6F1LL, "drawpopdefs", &ci_drawpopdefs},
+  {-1, NULL, NULL},
+  {0x27AF8F6A5DF0B70BLL, "dom_document_xinclude", &ci_dom_document_xinclude},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x45631C592AD6D765LL, "str_ireplace", &ci_str_ireplace},
+  {0x17242BC6C9C9563FLL, "crypt", &ci_crypt},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x757BC444FDF79CD5LL, "posix_get_last_error", &ci_posix_get_last_error},
+  {-1, NULL, NULL},
+  {0x4BBA1E164DF9CAA6LL, "localeconv", &ci_localeconv},
+  {-1, NULL, NULL},
+  {0x7829D2171DFBFE02LL, "magickgetimagegamma", &ci_magickgetimagegamma},
+  {0x05892E3C5B9EB441LL, "closedir", &ci_closedir},
+  {-1, NULL, NULL},
+  {0x0E1368A3BDFE6EE3LL, "hphp_recursiveiteratoriterator_rewind", &ci_hphp_recursiveiteratoriterator_rewind},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4BBD5D8A6E0110AELL, "error_log", &ci_error_log},
+  {0x221F5A9D5E021809LL, "magickwriteimages", &ci_magickwriteimages},
+  {0x7B965BB0B7A8EF53LL, "hphp_get_iostatus", &ci_hphp_get_iostatus},
+  {0x17C38BE3A6EE8B29LL, "mysql_field_flags", &ci_mysql_field_flags},
+  {-1, NULL, NULL},
+  {0x3954FFED1E0650AFLL, "stream_register_wrapper", &ci_stream_register_wrapper},
+  {-1, NULL, NULL},
+  {0x6F1968BE449FB6F3LL, "stream_socket_pair", &ci_stream_socket_pair},
+  {-1, NULL, NULL},
+  {0x38664EFE3E0A0F16LL, "json_decode", &ci_json_decode},
+  {0x23A1E13930E44287LL, "xbox_schedule_thread_reset", &ci_xbox_schedule_thread_reset},
+  {0x0207E332D629A3A2LL, "mailparse_msg_get_structure", &ci_mailparse_msg_get_structure},
+  {0x23FD09A13E0D8B5BLL, "xmlwriter_open_memory", &ci_xmlwriter_open_memory},
+  {0x57554E082E0ED385LL, "pcntl_exec", &ci_pcntl_exec},
+  {-1, NULL, NULL},
+  {0x67742A0F218F6C1BLL, "posix_initgroups", &ci_posix_initgroups},
+  {0x40CE61115E11154BLL, "msg_stat_queue", &ci_msg_stat_queue},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0AD6DE8829773F9DLL, "apc_compile_file", &ci_apc_compile_file},
+  {0x1922D51F3E1522CELL, "xmlwriter_end_dtd_attlist", &ci_xmlwriter_end_dtd_attlist},
+  {0x0AC36D9F961B247ELL, "newpixeliterator", &ci_newpixeliterator},
+  {0x2337F8C3EE17192DLL, "sprintf", &ci_sprintf},
+  {0x75DB75CA9DE56D1ALL, "xml_parser_get_option", &ci_xml_parser_get_option},
+  {0x19AFF8596E19DA9ALL, "xhprof_enable", &ci_xhprof_enable},
+  {0x605132E71CE7D834LL, "array_push", &ci_array_push},
+  {-1, NULL, NULL},
+  {0x59FE6A862E1CB172LL, "get_browser", &ci_get_browser},
+  {0x1F4984938E1DBB2ALL, "sort", &ci_sort},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2F8F40E95EDF925BLL, "sizeof", &ci_sizeof},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x18A0F1EE8E249005LL, "msg_send", &ci_msg_send},
+  {-1, NULL, NULL},
+  {0x727F5A6D8E26B80DLL, "extension_loaded", &ci_extension_loaded},
+  {0x1670096FDE27AF6ALL, "rewind", &ci_rewind},
+  {0x288D61E7DE28AF92LL, "ucwords", &ci_ucwords},
+  {0x2395B0A85E292392LL, "hphp_splfileobject_flock", &ci_hphp_splfileobject_flock},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x314DA880FE2CE6F2LL, "session_start", &ci_session_start},
+  {0x39156C7CCE2D75FCLL, "hash_update", &ci_hash_update},
+  {0x593EA675D239CE61LL, "ldap_first_reference", &ci_ldap_first_reference},
+  {0x6D450F078F02BEFBLL, "apd_continue", &ci_apd_continue},
+  {0x59DE3A26AFF570E7LL, "magickshaveimage", &ci_magickshaveimage},
+  {-1, NULL, NULL},
+  {0x5D3A31AB0E326F45LL, "crc32", &ci_crc32},
+  {0x4F7AA8120E33E4C6LL, "collator_get_attribute", &ci_collator_get_attribute},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7186EF5EF0581695LL, "exp", &ci_exp},
+  {0x3B5E32078E37A093LL, "imagedestroy", &ci_imagedestroy},
+  {-1, NULL, NULL},
+  {0x489355BDBE396988LL, "drawsettextencoding", &ci_drawsettextencoding},
+  {0x0368F1779E3AE39FLL, "mysql_field_table", &ci_mysql_field_table},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4282496A4BF42F21LL, "php_uname", &ci_php_uname},
+  {-1, NULL, NULL},
+  {0x42C4EC9D9F782F6FLL, "htmlentities", &ci_htmlentities},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x18B64D6BFE4208D9LL, "stream_get_transports", &ci_stream_get_transports},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x422599B9E8AC0395LL, "stream_bucket_make_writeable", &ci_stream_bucket_make_writeable},
+  {0x76EBE919625D8E9ELL, "openssl_pkcs12_export", &ci_openssl_pkcs12_export},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x48AA091B1E493DBDLL, "setlocale", &ci_setlocale},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x482D58D8EE3A521CLL, "imap_lsub", &ci_imap_lsub},
+  {0x04525BA2AE51EF14LL, "date_sun_info", &ci_date_sun_info},
+  {0x0E88ACEB15A581BFLL, "magickgetimageextrema", &ci_magickgetimageextrema},
+  {0x71D2D4757B7E4260LL, "apache_request_headers", &ci_apache_request_headers},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5749AD20CAFCD55CLL, "pixelgetbluequantum", &ci_pixelgetbluequantum},
+  {-1, NULL, NULL},
+  {0x39E05F957C7DD27ALL, "magickgetimagedepth", &ci_magickgetimagedepth},
+  {0x34BAEFD8AE59D378LL, "hphp_set_error_page", &ci_hphp_set_error_page},
+  {0x4122DFAC25BDFBCALL, "hphp_splfileinfo_getowner", &ci_hphp_splfileinfo_getowner},
+  {-1, NULL, NULL},
+  {0x71557D108E5C0F70LL, "xml_set_object", &ci_xml_set_object},
+  {0x3C014439AE5D75A4LL, "magickgetcharheight", &ci_magickgetcharheight},
+  {-1, NULL, NULL},
+  {0x1E074215FE5FCC71LL, "set_error_handler", &ci_set_error_handler},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x68DBF8ABB26A8365LL, "hphp_directoryiterator_rewind", &ci_hphp_directoryiterator_rewind},
+  {0x0B8B6A66FE646EDCLL, "openssl_encrypt", &ci_openssl_encrypt},
+  {0x5EB0A2F93E650E0DLL, "array_diff_key", &ci_array_diff_key},
+  {0x4AD5B65BCE665DCELL, "array_key_exists", &ci_array_key_exists},
+  {0x22D380E06E67E299LL, "stream_encoding", &ci_stream_encoding},
+  {0x02B0E99C1E68F4CDLL, "imap_createmailbox", &ci_imap_createmailbox},
+  {0x7707A7FEA07FB7A9LL, "hphp_recursivedirectoryiterator___construct", &ci_hphp_recursivedirectoryiterator___construct},
+  {0x5C28BE7FFE6A68C4LL, "xml_set_start_namespace_decl_handler", &ci_xml_set_start_namespace_decl_handler},
+  {-1, NULL, NULL},
+  {0x70B38AB9EAE16FBFLL, "ini_set", &ci_ini_set},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4A32653C8E719A93LL, "pixelgetcyan", &ci_pixelgetcyan},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2676902697E37138LL, "xmlwriter_start_comment", &ci_xmlwriter_start_comment},
+  {0x2E5E23ECA0525A9FLL, "bcadd", &ci_bcadd},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0CE71BC3B75D8199LL, "mb_strimwidth", &ci_mb_strimwidth},
+  {0x3A9A5D4FEE79A111LL, "getmxrr", &ci_getmxrr},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x18BC9BF6D1E3CF74LL, "magickpreviewimages", &ci_magickpreviewimages},
+  {0x756B92411E7FBE0DLL, "stream_get_wrappers", &ci_stream_get_wrappers},
+  {0x74C787060F7290A7LL, "icu_transliterate", &ci_icu_transliterate},
+  {0x42BEEC88EE81FD10LL, "imagechar", &ci_imagechar},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x391C68F2BE85E63BLL, "pixelgetiteratorexceptionstring", &ci_pixelgetiteratorexceptionstring},
+  {0x4C9252FB9C3300ADLL, "pixelsetalphaquantum", &ci_pixelsetalphaquantum},
+  {0x1F5B2728DE875EBALL, "magicksetimage", &ci_magicksetimage},
+  {0x19AB40AB4CC50E2CLL, "imap_fetch_overview", &ci_imap_fetch_overview},
+  {0x3A65182A3E8908D8LL, "openssl_open", &ci_openssl_open},
+  {-1, NULL, NULL},
+  {0x37C5AF6E7E8B5EA0LL, "fputs", &ci_fputs},
+  {0x66F1F0DB16C82F98LL, "imagesavealpha", &ci_imagesavealpha},
+  {-1, NULL, NULL},
+  {0x0C1904372E8EDBEBLL, "stream_copy_to_stream", &ci_stream_copy_to_stream},
+  {0x6158E2E0A5ACCB58LL, "idn_to_ascii", &ci_idn_to_ascii},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x50C5488E19492267LL, "mb_list_encodings_alias_names", &ci_mb_list_encodings_alias_names},
+  {0x57DDA4C3F7FF8526LL, "fputcsv", &ci_fputcsv},
+  {0x58C8DCAAE5B7CEC9LL, "get_cfg_var", &ci_get_cfg_var},
+  {0x12D49AD562F38A1CLL, "date_timezone_get", &ci_date_timezone_get},
+  {0x45FAE3D08E96B345LL, "curl_errno", &ci_curl_errno},
+  {-1, NULL, NULL},
+  {0x2C7C9772AE983AF6LL, "drawsetgravity", &ci_drawsetgravity},
+  {0x2B66EACB77AE9F32LL, "print_r", &ci_print_r},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7A8B3EC0235EF125LL, "magickprofileimage", &ci_magickprofileimage},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7CDDF96AFEA2DCE4LL, "chunk_split", &ci_chunk_split},
+  {0x16B481D0DEA32110LL, "call_user_func_async", &ci_call_user_func_async},
+  {-1, NULL, NULL},
+  {0x7EA6200B688459EFLL, "ldap_modify", &ci_ldap_modify},
+  {-1, NULL, NULL},
+  {0x25EA810DAEA74D81LL, "ob_clean", &ci_ob_clean},
+  {0x6370CF455EA8604BLL, "socket_create", &ci_socket_create},
+  {0x03012F3DDD7AB1D0LL, "getservbyport", &ci_getservbyport},
+  {0x4D63F2C9AAB79218LL, "fb_renamed_functions", &ci_fb_renamed_functions},
+  {-1, NULL, NULL},
+  {0x0C61AE35699F1280LL, "imap_thread", &ci_imap_thread},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0F0702D91EAFB54DLL, "drawgettextantialias", &ci_drawgettextantialias},
+  {0x5E2AF775FEB04B3ELL, "posix_getppid", &ci_posix_getppid},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x2EE0967F6EB5A0CALL, "date_format", &ci_date_format},
+  {0x5B3A4A72846B21DCLL, "current", &ci_current},
+  {0x167A11C41EB71DA0LL, "pixelgetexceptiontype", &ci_pixelgetexceptiontype},
+  {-1, NULL, NULL},
+  {0x65353A823EB91F44LL, "imap_mail_compose", &ci_imap_mail_compose},
+  {0x1E694036FEBA3947LL, "imap_fetchstructure", &ci_imap_fetchstructure},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x790B7C44A3442BEELL, "asort", &ci_asort},
+  {0x7379B5B97EC2EEB3LL, "hypot", &ci_hypot},
+  {0x1B9E769FFEC3C54DLL, "pcntl_wtermsig", &ci_pcntl_wtermsig},
+  {0x1876287F59CEB481LL, "bzerror", &ci_bzerror},
+  {0x7BDA47B5C47EAE20LL, "fread", &ci_fread},
+  {0x4E166ECE0EC6A33DLL, "openssl_pkey_get_public", &ci_openssl_pkey_get_public},
+  {-1, NULL, NULL},
+  {0x621590803EC88F56LL, "imageline", &ci_imageline},
+  {0x4590B5971EC9ACA1LL, "getmygid", &ci_getmygid},
+  {0x2D2BC1125ECA930BLL, "dom_document_relaxng_validate_file", &ci_dom_document_relaxng_validate_file},
+  {0x1DAE0831CECB63EBLL, "ob_get_clean", &ci_ob_get_clean},
+  {0x23D5E9E53D11BF6CLL, "gmdate", &ci_gmdate},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6DB2DB341ECF3FB8LL, "file_exists", &ci_file_exists},
+  {0x5304E6B47ED0B1FDLL, "srand", &ci_srand},
+  {0x684881C79ED1AB45LL, "func_get_args", &ci_func_get_args},
+  {-1, NULL, NULL},
+  {0x12A739BE0ED32546LL, "ignore_user_abort", &ci_ignore_user_abort},
+  {0x44C1BC500D175384LL, "wandgetexception", &ci_wandgetexception},
+  {0x7424946F7ED520C5LL, "magickgetimagefilename", &ci_magickgetimagefilename},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x14B366EF64A66B0ALL, "get_loaded_extensions", &ci_get_loaded_extensions},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x674F1DA24EDE7B68LL, "xmlwriter_end_attribute", &ci_xmlwriter_end_attribute},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0DE86977367F656BLL, "register_shutdown_function", &ci_register_shutdown_function},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x56EC1A6732D07413LL, "drawgetfontsize", &ci_drawgetfontsize},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x5F165B40AEEE5D12LL, "hphp_splfileinfo_getfilename", &ci_hphp_splfileinfo_getfilename},
+  {0x1AC48909BEEF935BLL, "func_get_arg", &ci_func_get_arg},
+  {0x36EA41EEA02D4F0ALL, "imap_mail_copy", &ci_imap_mail_copy},
+  {0x0C1BBEDECEF1C86BLL, "newmagickwand", &ci_newmagickwand},
+  {0x7D615C7E3ADB2C1BLL, "xmlwriter_write_comment", &ci_xmlwriter_write_comment},
+  {0x55BE7AE8DEF3F988LL, "magickgetstringheight", &ci_magickgetstringheight},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x38704D99FEA9B783LL, "mysql_fetch_array", &ci_mysql_fetch_array},
+  {-1, NULL, NULL},
+  {0x069C028EFEF8C91DLL, "date", &ci_date},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x02A4724E6A881114LL, "mb_decode_numericentity", &ci_mb_decode_numericentity},
+  {-1, NULL, NULL},
+  {0x7AA1691D3D94A7E1LL, "dom_xpath_evaluate", &ci_dom_xpath_evaluate},
+  {-1, NULL, NULL},
+  {0x03834225EBBC101ALL, "drawsettextundercolor", &ci_drawsettextundercolor},
+  {0x6DD51BF03F003619LL, "mailparse_uudecode_all", &ci_mailparse_uudecode_all},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0BA3AD85EB597D38LL, "pagelet_server_task_result", &ci_pagelet_server_task_result},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x683E88F441F9BDC1LL, "chgrp", &ci_chgrp},
+  {-1, NULL, NULL},
+  {0x174DB93CAF0D1177LL, "hphp_splfileinfo___tostring", &ci_hphp_splfileinfo___tostring},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7E1801C8E70D1DD5LL, "imagefontwidth", &ci_imagefontwidth},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x785C812E6292E868LL, "i18n_loc_set_default", &ci_i18n_loc_set_default},
+  {0x2B75B48A53AACAA3LL, "imagestring", &ci_imagestring},
+  {0x72C73F5DA7D6F971LL, "magickgetimagecolormapcolor", &ci_magickgetimagecolormapcolor},
+  {-1, NULL, NULL},
+  {0x5DD71E685F179770LL, "cpu_get_model", &ci_cpu_get_model},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6B2B942CAF1A2527LL, "array_shift", &ci_array_shift},
+  {0x6A3D9F8EDB005E7ALL, "flush", &ci_flush},
+  {0x1827F1C22F1CCAE4LL, "hebrevc", &ci_hebrevc},
+  {0x001F23CAC36E3677LL, "magickgetimagescene", &ci_magickgetimagescene},
+  {0x5B94A6962F1EC27FLL, "magickechoimagesblob", &ci_magickechoimagesblob},
+  {0x2A63A0BF9B7E3B76LL, "ini_alter", &ci_ini_alter},
+  {-1, NULL, NULL},
+  {0x469199B8FD886A65LL, "putenv", &ci_putenv},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x21DF7BAEEFABCA3CLL, "umask", &ci_umask},
+  {0x61720D771D1A23B3LL, "posix_getpwnam", &ci_posix_getpwnam},
+  {0x1E89F15B7F2805F4LL, "openssl_pkcs7_encrypt", &ci_openssl_pkcs7_encrypt},
+  {0x6FE2E44FBC44E5E6LL, "magickaddnoiseimage", &ci_magickaddnoiseimage},
+  {0x766CD15A7F2A0884LL, "array_uintersect", &ci_array_uintersect},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x758263CEBF2E8972LL, "assert_options", &ci_assert_options},
+  {-1, NULL, NULL},
+  {0x4D5D45D1F1EB3B33LL, "posix_access", &ci_posix_access},
+  {0x54EDBB6BAF318519LL, "memcache_add", &ci_memcache_add},
+  {0x5E9821F06711669ELL, "gethostbynamel", &ci_gethostbynamel},
+  {0x7863294A8F33D14FLL, "file", &ci_file},
+  {-1, NULL, NULL},
+  {0x755DEFDEDF35DA85LL, "ctype_print", &ci_ctype_print},
+  {0x5F6750E1C7E5D682LL, "imageinterlace", &ci_imageinterlace},
+  {0x21C8FC9A94404CF1LL, "php_ini_scanned_files", &ci_php_ini_scanned_files},
+  {0x60F8818C0F38D5C9LL, "hphp_directoryiterator___tostring", &ci_hphp_directoryiterator___tostring},
+  {-1, NULL, NULL},
+  {0x1FFCBCF1927D7103LL, "posix_setpgid", &ci_posix_setpgid},
+  {0x66A378C6BBC26A18LL, "dom_document_create_cdatasection", &ci_dom_document_create_cdatasection},
+  {0x10D6AE9D688D1C68LL, "copy", &ci_copy},
+  {-1, NULL, NULL},
+  {0x7833F4C337542AFFLL, "openssl_pkey_export", &ci_openssl_pkey_export},
+  {0x0B4E7B9180C4ABC9LL, "xml_set_end_namespace_decl_handler", &ci_xml_set_end_namespace_decl_handler},
+  {0x6018C9F7DF40C2C4LL, "xml_get_current_column_number", &ci_xml_get_current_column_number},
+  {0x0D1BD0E5AF4175F5LL, "drawsetfont", &ci_drawsetfont},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4CDD0B7BF826FEC2LL, "rewinddir", &ci_rewinddir},
+  {0x650E641CC0E3873FLL, "connection_aborted", &ci_connection_aborted},
+  {0x4FB95164A5F84934LL, "mcrypt_generic_end", &ci_mcrypt_generic_end},
+  {-1, NULL, NULL},
+  {0x57278846B8B0E4BELL, "ldap_count_entries", &ci_ldap_count_entries},
+  {0x1B0FF5C02F571D83LL, "fb_rename_function", &ci_fb_rename_function},
+  {0x59D2DFF08F4DB99ELL, "imagecreate", &ci_imagecreate},
+  {-1, NULL, NULL},
+  {0x7A69D0078F4F31D9LL, "ldap_start_tls", &ci_ldap_start_tls},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x70C22A7EEF54CD1BLL, "ldap_compare", &ci_ldap_compare},
+  {0x414038596F552309LL, "magickgetversionnumber", &ci_magickgetversionnumber},
+  {0x5CA9671385EF0AC9LL, "sem_release", &ci_sem_release},
+  {-1, NULL, NULL},
+  {0x34B8A4E5AE0EFA95LL, "pixelgetopacity", &ci_pixelgetopacity},
+  {0x188DF1EB5FD1B26CLL, "mailparse_msg_parse_file", &ci_mailparse_msg_parse_file},
+  {-1, NULL, NULL},
+  {0x5F7873F2DF5BE70BLL, "ctype_cntrl", &ci_ctype_cntrl},
+  {0x71583A8FEF5C7DA2LL, "sys_get_temp_dir", &ci_sys_get_temp_dir},
+  {0x0881440DCF5D3281LL, "magickflattenimages", &ci_magickflattenimages},
+  {-1, NULL, NULL},
+  {0x342D957A86A03990LL, "hphp_splfileobject_seek", &ci_hphp_splfileobject_seek},
+  {0x5BA371A93F60F4BDLL, "use_soap_error_handler", &ci_use_soap_error_handler},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x04BD4B43921956EDLL, "ldap_search", &ci_ldap_search},
+  {-1, NULL, NULL},
+  {0x4BD54A631F665F0FLL, "drawpathcurvetosmoothabsolute", &ci_drawpathcurvetosmoothabsolute},
+  {-1, NULL, NULL},
+  {0x6A7E0B15FF689133LL, "mb_ereg_search_init", &ci_mb_ereg_search_init},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x3B831DB1A615FB8DLL, "xhprof_sample_enable", &ci_xhprof_sample_enable},
+  {-1, NULL, NULL},
+  {0x07B5BF934F6EA192LL, "imagesettile", &ci_imagesettile},
+  {-1, NULL, NULL},
+  {0x374F20BDAF709C9ALL, "mb_preferred_mime_name", &ci_mb_preferred_mime_name},
+  {0x53631CF3A937320FLL, "get_class_methods", &ci_get_class_methods},
+  {0x6A2236CDDFF12BAFLL, "magickhaspreviousimage", &ci_magickhaspreviousimage},
+  {0x6FACBD7F02B6FD60LL, "uasort", &ci_uasort},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x60783C20BF7724CELL, "mailparse_msg_free", &ci_mailparse_msg_free},
+  {0x0AD3BFAB5F780548LL, "magickcoalesceimages", &ci_magickcoalesceimages},
+  {-1, NULL, NULL},
+  {0x0F32841DBF7A053DLL, "fb_crossall_query", &ci_fb_crossall_query},
+  {-1, NULL, NULL},
+  {0x62A4D7A03F7C3B8ELL, "ceil", &ci_ceil},
+  {0x65D7CBE8681CE9B2LL, "gzgetss", &ci_gzgetss},
+  {0x1D8FE8E68F7EA24FLL, "pixelsetiteratorrow", &ci_pixelsetiteratorrow},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x583AA7498A40E67ALL, "drawgetcliprule", &ci_drawgetcliprule},
+  {0x1676FB393F8493A4LL, "constant", &ci_constant},
+  {0x7A9C06B9CF853D2ALL, "substr_count", &ci_substr_count},
+  {-1, NULL, NULL},
+  {0x3886D2664F874AC7LL, "openssl_pkcs7_verify", &ci_openssl_pkcs7_verify},
+  {0x3FF9AAFF85DDDFC1LL, "class_parents", &ci_class_parents},
+  {0x6E2FDBD28F895566LL, "timezone_abbreviations_list", &ci_timezone_abbreviations_list},
+  {0x12B22A2E6B344057LL, "ldap_sort", &ci_ldap_sort},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4870ADD98EE02BA2LL, "pcntl_wifsignaled", &ci_pcntl_wifsignaled},
+  {0x736C133EFF8E5A0DLL, "mysql_list_fields", &ci_mysql_list_fields},
+  {0x6AD774816F8F7615LL, "mb_strrchr", &ci_mb_strrchr},
+  {0x77F1EDE7D5EF759ALL, "apc_cache_info", &ci_apc_cache_info},
+  {0x0D3C8F00B0C633EALL, "inet_pton", &ci_inet_pton},
+  {0x4D04C580CF9212D5LL, "posix_getgroups", &ci_posix_getgroups},
+  {-1, NULL, NULL},
+  {0x0E9C9B409F94B2B6LL, "setcookie", &ci_setcookie},
+  {-1, NULL, NULL},
+  {0x6A2EEE463F969A8CLL, "getservbyname", &ci_getservbyname},
+  {-1, NULL, NULL},
+  {0x79E6FD78989B10E7LL, "tmpfile", &ci_tmpfile},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x1112712715D75B20LL, "pixelgetblackquantum", &ci_pixelgetblackquantum},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0DEEA8C3E3A47FA6LL, "read_exif_data", &ci_read_exif_data},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x47B38F1E4FA29C5ELL, "fb_get_code_coverage", &ci_fb_get_code_coverage},
+  {0x10CDCF2BB4057A69LL, "debug_zval_dump", &ci_debug_zval_dump},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x78A02A603FA6FF02LL, "magickreducenoiseimage", &ci_magickreducenoiseimage},
+  {0x40FA17130FA7100DLL, "openssl_seal", &ci_openssl_seal},
+  {0x67C155632E5373D2LL, "mailparse_msg_create", &ci_mailparse_msg_create},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0FA74D85885F86EFLL, "output_add_rewrite_var", &ci_output_add_rewrite_var},
+  {0x39E4E0175FADC222LL, "drawskewx", &ci_drawskewx},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x7C40E2514FB5437DLL, "dom_namednodemap_get_named_item_ns", &ci_dom_namednodemap_get_named_item_ns},
+  {0x3101CE70BA49A3C8LL, "error_reporting", &ci_error_reporting},
+  {0x4B092931EFB7979FLL, "mysql_create_db", &ci_mysql_create_db},
+  {0x54C3E9AB6FB8E35DLL, "magickswirlimage", &ci_magickswirlimage},
+  {0x06E9C984B5F0B2D6LL, "furchash_hphp_ext", &ci_furchash_hphp_ext},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x444A3375EFBC2BA3LL, "openssl_public_decrypt", &ci_openssl_public_decrypt},
+  {0x7C2B3FE61FBDFD91LL, "openssl_pkey_get_details", &ci_openssl_pkey_get_details},
+  {0x36D672EF4FBEFD55LL, "json_encode", &ci_json_encode},
+  {0x0179CBA2C5F4DC21LL, "magickgetimageformat", &ci_magickgetimageformat},
+  {0x0C1CB24A3FC065FDLL, "bcmul", &ci_bcmul},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x63BE4CEF1FC47FFBLL, "imagefill", &ci_imagefill},
+  {0x258205B54DC06A82LL, "newpixelwands", &ci_newpixelwands},
+  {0x4BE9D91DD8624F79LL, "money_format", &ci_money_format},
+  {0x158E2271E381C441LL, "hash_file", &ci_hash_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x0BB22147ADADDDEFLL, "pfsockopen", &ci_pfsockopen},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x79617ED8EFD1ABBELL, "get_class_vars", &ci_get_class_vars},
+  {-1, NULL, NULL},
+  {0x29EE24C41FD3D4D1LL, "mysql_field_name", &ci_mysql_field_name},
+  {0x64F52E1DB5E95BFCLL, "curl_multi_remove_handle", &ci_curl_multi_remove_handle},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x4F9F68F60FD7A3CELL, "drawgetfillrule", &ci_drawgetfillrule},
+  {0x6EF89BCAD607CC45LL, "strncasecmp", &ci_strncasecmp},
+  {-1, NULL, NULL},
+  {0x3711AF36391EA15BLL, "mysql_list_tables", &ci_mysql_list_tables},
+  {0x5046A0D9DFDB5DF4LL, "strcspn", &ci_strcspn},
+  {0x5AE12CB1FFDC21C7LL, "drawellipse", &ci_drawellipse},
+  {0x2CEAE845E4F404FDLL, "dom_document_save", &ci_dom_document_save},
+  {-1, NULL, NULL},
+  {0x7971A5647C957718LL, "date_time_set", &ci_date_time_set},
+  {-1, NULL, NULL},
+  {0x5B1F9C2E9FE111AFLL, "fb_utf8ize", &ci_fb_utf8ize},
+  {0x4A6C46DC7FE29F8FLL, "hphp_recursivedirectoryiterator_getchildren", &ci_hphp_recursivedirectoryiterator_getchildren},
+  {-1, NULL, NULL},
+  {0x2E54EF1891172280LL, "hphp_splfileinfo_isexecutable", &ci_hphp_splfileinfo_isexecutable},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x67D1EE05DFE71FEBLL, "hphp_splfileobject_getcvscontrol", &ci_hphp_splfileobject_getcvscontrol},
+  {0x623C20A027A606FFLL, "array_uintersect_uassoc", &ci_array_uintersect_uassoc},
+  {0x25DDD924EFE979EALL, "hash_update_file", &ci_hash_update_file},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x618D2A98986B1A29LL, "ldap_unbind", &ci_ldap_unbind},
+  {0x1BC448670BA4E187LL, "iconv_strpos", &ci_iconv_strpos},
+  {-1, NULL, NULL},
+  {0x75DAFEF5BFEF1435LL, "imagesetstyle", &ci_imagesetstyle},
+  {-1, NULL, NULL},
+  {0x5A66CCB3D924450FLL, "xml_parser_create", &ci_xml_parser_create},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x66764CAABFF4CDABLL, "array_keys", &ci_array_keys},
+  {0x28526EF49FF516C5LL, "pixelsetgreenquantum", &ci_pixelsetgreenquantum},
+  {-1, NULL, NULL},
+  {0x59AD2C922FF75D46LL, "mdecrypt_generic", &ci_mdecrypt_generic},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x6326C14D0FFA7DAALL, "fb_thrift_serialize", &ci_fb_thrift_serialize},
+  {-1, NULL, NULL},
+  {-1, NULL, NULL},
+  {0x018F22AEA371ED02LL, "filemtime", &ci_filemtime},
+  {-1, NULL, NULL},
+  {0x4C19B770DFFFE7CDLL, "imap_listmailbox", &ci_imap_listmailbox},
+};
+
 bool get_call_info_builtin(const CallInfo *&ci, void *&extra, const char *s, int64 hash) {
   extra = NULL;
   if (hash < 0) hash = hash_string(s);
-  switch (hash & 8191) {
-    case 1:
-      HASH_GUARD(0x4F7230DC25F0E001LL, magicknormalizeimage) {
-        ci = &ci_magicknormalizeimage;
-        return true;
-      }
-      break;
-    case 2:
-      HASH_GUARD(0x76C320EDB9B6E002LL, xmlwriter_flush) {
-        ci = &ci_xmlwriter_flush;
-        return true;
-      }
-      break;
-    case 3:
-      HASH_GUARD(0x7E0EC3E131BCA003LL, token_name) {
-        ci = &ci_token_name;
-        return true;
-      }
-      break;
-    case 11:
-      HASH_GUARD(0x4FDCCE1C7754600BLL, ob_iconv_handler) {
-        ci = &ci_ob_iconv_handler;
-        return true;
-      }
-      break;
-    case 24:
-      HASH_GUARD(0x4C915E3480E94018LL, mb_substr_count) {
-        ci = &ci_mb_substr_count;
-        return true;
-      }
-      break;
-    case 40:
-      HASH_GUARD(0x601C5152277AE028LL, readfile) {
-        ci = &ci_readfile;
-        return true;
-      }
-      break;
-    case 44:
-      HASH_GUARD(0x464EB9B1F955202CLL, apc_add) {
-        ci = &ci_apc_add;
-        return true;
-      }
-      break;
-    case 45:
-      HASH_GUARD(0x3BE730D90618202DLL, collator_sort_with_sort_keys) {
-        ci = &ci_collator_sort_with_sort_keys;
-        return true;
-      }
-      break;
-    case 54:
-      HASH_GUARD(0x32F23F206C394036LL, curl_setopt_array) {
-        ci = &ci_curl_setopt_array;
-        return true;
-      }
-      break;
-    case 55:
-      HASH_GUARD(0x418D937957ECE037LL, tanh) {
-        ci = &ci_tanh;
-        return true;
-      }
-      break;
-    case 62:
-      HASH_GUARD(0x497E31C70409603ELL, timezone_name_from_abbr) {
-        ci = &ci_timezone_name_from_abbr;
-        return true;
-      }
-      break;
-    case 63:
-      HASH_GUARD(0x24206A195B9C203FLL, ucfirst) {
-        ci = &ci_ucfirst;
-        return true;
-      }
-      break;
-    case 65:
-      HASH_GUARD(0x65B39B11F5D7C041LL, array_unique) {
-        ci = &ci_array_unique;
-        return true;
-      }
-      break;
-    case 66:
-      HASH_GUARD(0x0547079C94282042LL, imap_utf7_decode) {
-        ci = &ci_imap_utf7_decode;
-        return true;
-      }
-      break;
-    case 68:
-      HASH_GUARD(0x378A73FF98B60044LL, curl_init) {
-        ci = &ci_curl_init;
-        return true;
-      }
-      break;
-    case 73:
-      HASH_GUARD(0x4282E0231F600049LL, fseek) {
-        ci = &ci_fseek;
-        return true;
-      }
-      break;
-    case 75:
-      HASH_GUARD(0x17CD0E68E778C04BLL, drawsetstrokelinejoin) {
-        ci = &ci_drawsetstrokelinejoin;
-        return true;
-      }
-      HASH_GUARD(0x6370CF455EA8604BLL, socket_create) {
-        ci = &ci_socket_create;
-        return true;
-      }
-      break;
-    case 76:
-      HASH_GUARD(0x7848970191D5A04CLL, mysql_connect_with_db) {
-        ci = &ci_mysql_connect_with_db;
-        return true;
-      }
-      HASH_GUARD(0x03047FD5FC67204CLL, exif_read_data) {
-        ci = &ci_exif_read_data;
-        return true;
-      }
-      break;
-    case 87:
-      HASH_GUARD(0x12B22A2E6B344057LL, ldap_sort) {
-        ci = &ci_ldap_sort;
-        return true;
-      }
-      break;
-    case 92:
-      HASH_GUARD(0x2B7532A070BF605CLL, openssl_get_privatekey) {
-        ci = &ci_openssl_get_privatekey;
-        return true;
-      }
-      break;
-    case 98:
-      HASH_GUARD(0x745910AD5C922062LL, magickgetmimetype) {
-        ci = &ci_magickgetmimetype;
-        return true;
-      }
-      break;
-    case 100:
-      HASH_GUARD(0x5CC8BA5ADFAC0064LL, imagegrabscreen) {
-        ci = &ci_imagegrabscreen;
-        return true;
-      }
-      break;
-    case 101:
-      HASH_GUARD(0x777FE52584FAE065LL, apc_bin_dump) {
-        ci = &ci_apc_bin_dump;
-        return true;
-      }
-      break;
-    case 103:
-      HASH_GUARD(0x4512BD5EA7076067LL, openssl_csr_export_to_file) {
-        ci = &ci_openssl_csr_export_to_file;
-        return true;
-      }
-      break;
-    case 118:
-      HASH_GUARD(0x0CFFD02753B98076LL, bzread) {
-        ci = &ci_bzread;
-        return true;
-      }
-      break;
-    case 120:
-      HASH_GUARD(0x01AE1DE8FA116078LL, call_user_func_array_async) {
-        ci = &ci_call_user_func_array_async;
-        return true;
-      }
-      break;
-    case 122:
-      HASH_GUARD(0x5F9DDC342A83807ALL, date_default_timezone_get) {
-        ci = &ci_date_default_timezone_get;
-        return true;
-      }
-      break;
-    case 131:
-      HASH_GUARD(0x1A90213EE1A56083LL, array_pop) {
-        ci = &ci_array_pop;
-        return true;
-      }
-      break;
-    case 137:
-      HASH_GUARD(0x4AD554CBAB9CC089LL, call_user_method_array) {
-        ci = &ci_call_user_method_array;
-        return true;
-      }
-      break;
-    case 140:
-      HASH_GUARD(0x4F1D1ED7B087208CLL, exec) {
-        ci = &ci_exec;
-        return true;
-      }
-      HASH_GUARD(0x3A0B58797E8FE08CLL, xml_set_external_entity_ref_handler) {
-        ci = &ci_xml_set_external_entity_ref_handler;
-        return true;
-      }
-      break;
-    case 141:
-      HASH_GUARD(0x200864F8F053C08DLL, magickgetversionstring) {
-        ci = &ci_magickgetversionstring;
-        return true;
-      }
-      break;
-    case 145:
-      HASH_GUARD(0x3E5CF6378A49C091LL, ldap_get_attributes) {
-        ci = &ci_ldap_get_attributes;
-        return true;
-      }
-      HASH_GUARD(0x1C32BB63986C8091LL, socket_strerror) {
-        ci = &ci_socket_strerror;
-        return true;
-      }
-      break;
-    case 147:
-      HASH_GUARD(0x3B5E32078E37A093LL, imagedestroy) {
-        ci = &ci_imagedestroy;
-        return true;
-      }
-      break;
-    case 162:
-      HASH_GUARD(0x10DF7941C3F3E0A2LL, socket_bind) {
-        ci = &ci_socket_bind;
-        return true;
-      }
-      break;
-    case 163:
-      HASH_GUARD(0x54242D2846BC60A3LL, magickunsharpmaskimage) {
-        ci = &ci_magickunsharpmaskimage;
-        return true;
-      }
-      break;
-    case 168:
-      HASH_GUARD(0x6E8C61326DCE40A8LL, var_export) {
-        ci = &ci_var_export;
-        return true;
-      }
-      break;
-    case 171:
-      HASH_GUARD(0x5B1D9F56698A40ABLL, html_entity_decode) {
-        ci = &ci_html_entity_decode;
-        return true;
-      }
-      break;
-    case 173:
-      HASH_GUARD(0x4C9252FB9C3300ADLL, pixelsetalphaquantum) {
-        ci = &ci_pixelsetalphaquantum;
-        return true;
-      }
-      break;
-    case 177:
-      HASH_GUARD(0x191B5F1B190BC0B1LL, dom_xpath_register_ns) {
-        ci = &ci_dom_xpath_register_ns;
-        return true;
-      }
-      break;
-    case 185:
-      HASH_GUARD(0x5C659372B2CD80B9LL, imagecolorstotal) {
-        ci = &ci_imagecolorstotal;
-        return true;
-      }
-      break;
-    case 187:
-      HASH_GUARD(0x331E7DFBE6E240BBLL, libxml_get_errors) {
-        ci = &ci_libxml_get_errors;
-        return true;
-      }
-      break;
-    case 197:
-      HASH_GUARD(0x7424946F7ED520C5LL, magickgetimagefilename) {
-        ci = &ci_magickgetimagefilename;
-        return true;
-      }
-      break;
-    case 199:
-      HASH_GUARD(0x677F33E78342A0C7LL, function_exists) {
-        ci = &ci_function_exists;
-        return true;
-      }
-      break;
-    case 200:
-      HASH_GUARD(0x30AB38D851C440C8LL, magickgetimagebackgroundcolor) {
-        ci = &ci_magickgetimagebackgroundcolor;
-        return true;
-      }
-      break;
-    case 202:
-      HASH_GUARD(0x2EE0967F6EB5A0CALL, date_format) {
-        ci = &ci_date_format;
-        return true;
-      }
-      HASH_GUARD(0x4C67DEE74080E0CALL, magicksetimagecompose) {
-        ci = &ci_magicksetimagecompose;
-        return true;
-      }
-      break;
-    case 206:
-      HASH_GUARD(0x64E390E5F2FDC0CELL, ismagickwand) {
-        ci = &ci_ismagickwand;
-        return true;
-      }
-      break;
-    case 210:
-      HASH_GUARD(0x7D1FAF3322A360D2LL, hphp_splfileobject___construct) {
-        ci = &ci_hphp_splfileobject___construct;
-        return true;
-      }
-      HASH_GUARD(0x5365BD7509BE60D2LL, ldap_dn2ufn) {
-        ci = &ci_ldap_dn2ufn;
-        return true;
-      }
-      HASH_GUARD(0x3E4DAD592CD0A0D2LL, magickdescribeimage) {
-        ci = &ci_magickdescribeimage;
-        return true;
-      }
-      break;
-    case 221:
-      HASH_GUARD(0x5F780851DB5240DDLL, hphp_current_ref) {
-        ci = &ci_hphp_current_ref;
-        return true;
-      }
-      break;
-    case 232:
-      HASH_GUARD(0x476F4B6CC987E0E8LL, magickframeimage) {
-        ci = &ci_magickframeimage;
-        return true;
-      }
-      break;
-    case 234:
-      HASH_GUARD(0x53BA3992F8C240EALL, imagegrabwindow) {
-        ci = &ci_imagegrabwindow;
-        return true;
-      }
-      break;
-    case 249:
-      HASH_GUARD(0x480797DB7165A0F9LL, xmlwriter_set_indent) {
-        ci = &ci_xmlwriter_set_indent;
-        return true;
-      }
-      break;
-    case 261:
-      HASH_GUARD(0x71E3372AA1AD0105LL, is_infinite) {
-        ci = &ci_is_infinite;
-        return true;
-      }
-      break;
-    case 267:
-      HASH_GUARD(0x7DE1BEE0C35D010BLL, pcntl_signal) {
-        ci = &ci_pcntl_signal;
-        return true;
-      }
-      break;
-    case 272:
-      HASH_GUARD(0x16B481D0DEA32110LL, call_user_func_async) {
-        ci = &ci_call_user_func_async;
-        return true;
-      }
-      break;
-    case 273:
-      HASH_GUARD(0x3A9A5D4FEE79A111LL, getmxrr) {
-        ci = &ci_getmxrr;
-        return true;
-      }
-      break;
-    case 286:
-      HASH_GUARD(0x658444BB4E29E11ELL, openssl_free_key) {
-        ci = &ci_openssl_free_key;
-        return true;
-      }
-      break;
-    case 291:
-      HASH_GUARD(0x3669138315204123LL, mcrypt_module_get_algo_key_size) {
-        ci = &ci_mcrypt_module_get_algo_key_size;
-        return true;
-      }
-      break;
-    case 292:
-      HASH_GUARD(0x7D4D28D561392124LL, drawsettextalignment) {
-        ci = &ci_drawsettextalignment;
-        return true;
-      }
-      break;
-    case 301:
-      HASH_GUARD(0x7579DBE83CE5812DLL, imagerectangle) {
-        ci = &ci_imagerectangle;
-        return true;
-      }
-      break;
-    case 315:
-      HASH_GUARD(0x1F61AFCDC510413BLL, imagefilter) {
-        ci = &ci_imagefilter;
-        return true;
-      }
-      break;
-    case 321:
-      HASH_GUARD(0x43EA586FBFC6A141LL, spl_autoload_unregister) {
-        ci = &ci_spl_autoload_unregister;
-        return true;
-      }
-      HASH_GUARD(0x6B03203C8A01C141LL, imap_timeout) {
-        ci = &ci_imap_timeout;
-        return true;
-      }
-      break;
-    case 323:
-      HASH_GUARD(0x296C739F28D6C143LL, drawsetfontsize) {
-        ci = &ci_drawsetfontsize;
-        return true;
-      }
-      break;
-    case 337:
-      HASH_GUARD(0x3044E9F91628E151LL, mb_strlen) {
-        ci = &ci_mb_strlen;
-        return true;
-      }
-      break;
-    case 338:
-      HASH_GUARD(0x5D170BCBBBA02152LL, system) {
-        ci = &ci_system;
-        return true;
-      }
-      break;
-    case 341:
-      HASH_GUARD(0x2623917110168155LL, fclose) {
-        ci = &ci_fclose;
-        return true;
-      }
-      HASH_GUARD(0x4F43FE32079C0155LL, magickgetimagesblob) {
-        ci = &ci_magickgetimagesblob;
-        return true;
-      }
-      break;
-    case 347:
-      HASH_GUARD(0x3711AF36391EA15BLL, mysql_list_tables) {
-        ci = &ci_mysql_list_tables;
-        return true;
-      }
-      break;
-    case 348:
-      HASH_GUARD(0x6CD7466174B9A15CLL, pixelsetredquantum) {
-        ci = &ci_pixelsetredquantum;
-        return true;
-      }
-      break;
-    case 349:
-      HASH_GUARD(0x517941D034E3015DLL, iterator_to_array) {
-        ci = &ci_iterator_to_array;
-        return true;
-      }
-      break;
-    case 353:
-      HASH_GUARD(0x309E780586D6C161LL, socket_set_nonblock) {
-        ci = &ci_socket_set_nonblock;
-        return true;
-      }
-      break;
-    case 361:
-      HASH_GUARD(0x4983571BFEAE6169LL, magickaffinetransformimage) {
-        ci = &ci_magickaffinetransformimage;
-        return true;
-      }
-      HASH_GUARD(0x1612E331D1726169LL, drawsetstrokecolor) {
-        ci = &ci_drawsetstrokecolor;
-        return true;
-      }
-      break;
-    case 366:
-      HASH_GUARD(0x0125F8B9428E416ELL, hphp_create_object) {
-        ci = &ci_hphp_create_object;
-        return true;
-      }
-      break;
-    case 379:
-      HASH_GUARD(0x59594143EFC7617BLL, mcrypt_module_open) {
-        ci = &ci_mcrypt_module_open;
-        return true;
-      }
-      break;
-    case 385:
-      HASH_GUARD(0x1CBD3B58296C8181LL, xmlwriter_write_dtd) {
-        ci = &ci_xmlwriter_write_dtd;
-        return true;
-      }
-      break;
-    case 386:
-      HASH_GUARD(0x7BB7C27B2C118182LL, get_magic_quotes_gpc) {
-        ci = &ci_get_magic_quotes_gpc;
-        return true;
-      }
-      break;
-    case 389:
-      HASH_GUARD(0x54DB5DC6A069A185LL, hphp_get_class_info) {
-        ci = &ci_hphp_get_class_info;
-        return true;
-      }
-      break;
-    case 391:
-      HASH_GUARD(0x1BC448670BA4E187LL, iconv_strpos) {
-        ci = &ci_iconv_strpos;
-        return true;
-      }
-      break;
-    case 402:
-      HASH_GUARD(0x07B5BF934F6EA192LL, imagesettile) {
-        ci = &ci_imagesettile;
-        return true;
-      }
-      break;
-    case 409:
-      HASH_GUARD(0x0CE71BC3B75D8199LL, mb_strimwidth) {
-        ci = &ci_mb_strimwidth;
-        return true;
-      }
-      break;
-    case 411:
-      HASH_GUARD(0x74F20C284227219BLL, similar_text) {
-        ci = &ci_similar_text;
-        return true;
-      }
-      break;
-    case 418:
-      HASH_GUARD(0x6DFC0765EBAB81A2LL, mcrypt_decrypt) {
-        ci = &ci_mcrypt_decrypt;
-        return true;
-      }
-      HASH_GUARD(0x615723D21421A1A2LL, sem_remove) {
-        ci = &ci_sem_remove;
-        return true;
-      }
-      break;
-    case 425:
-      HASH_GUARD(0x0DDFE3B1F6EEE1A9LL, array_reduce) {
-        ci = &ci_array_reduce;
-        return true;
-      }
-      break;
-    case 434:
-      HASH_GUARD(0x4B96F870584541B2LL, hphp_splfileobject_setflags) {
-        ci = &ci_hphp_splfileobject_setflags;
-        return true;
-      }
-      break;
-    case 436:
-      HASH_GUARD(0x6F6C85F4855DE1B4LL, imap_check) {
-        ci = &ci_imap_check;
-        return true;
-      }
-      break;
-    case 438:
-      HASH_GUARD(0x33BD672B4AC301B6LL, mt_rand) {
-        ci = &ci_mt_rand;
-        return true;
-      }
-      break;
-    case 445:
-      HASH_GUARD(0x589F7316EDC581BDLL, fb_serialize) {
-        ci = &ci_fb_serialize;
-        return true;
-      }
-      break;
-    case 447:
-      HASH_GUARD(0x0E88ACEB15A581BFLL, magickgetimageextrema) {
-        ci = &ci_magickgetimageextrema;
-        return true;
-      }
-      break;
-    case 455:
-      HASH_GUARD(0x5AE12CB1FFDC21C7LL, drawellipse) {
-        ci = &ci_drawellipse;
-        return true;
-      }
-      break;
-    case 458:
-      HASH_GUARD(0x75CA86838D24A1CALL, hash_algos) {
-        ci = &ci_hash_algos;
-        return true;
-      }
-      break;
-    case 470:
-      HASH_GUARD(0x78831282736801D6LL, stream_context_get_default) {
-        ci = &ci_stream_context_get_default;
-        return true;
-      }
-      break;
-    case 472:
-      HASH_GUARD(0x60E9E392663921D8LL, readlink) {
-        ci = &ci_readlink;
-        return true;
-      }
-      break;
-    case 476:
-      HASH_GUARD(0x5B3A4A72846B21DCLL, current) {
-        ci = &ci_current;
-        return true;
-      }
-      break;
-    case 477:
-      HASH_GUARD(0x04666D6F67C7A1DDLL, mysql_list_processes) {
-        ci = &ci_mysql_list_processes;
-        return true;
-      }
-      break;
-    case 482:
-      HASH_GUARD(0x67D4BA8513BF41E2LL, newpixelwand) {
-        ci = &ci_newpixelwand;
-        return true;
-      }
-      break;
-    case 483:
-      HASH_GUARD(0x131D11F79A8801E3LL, mb_http_output) {
-        ci = &ci_mb_http_output;
-        return true;
-      }
-      HASH_GUARD(0x406BDC51A3FD81E3LL, pcntl_waitpid) {
-        ci = &ci_pcntl_waitpid;
-        return true;
-      }
-      break;
-    case 493:
-      HASH_GUARD(0x1B09A9A533FFA1EDLL, drawgetexceptiontype) {
-        ci = &ci_drawgetexceptiontype;
-        return true;
-      }
-      HASH_GUARD(0x19932EEC5CAE01EDLL, hphp_splfileinfo_getfileinfo) {
-        ci = &ci_hphp_splfileinfo_getfileinfo;
-        return true;
-      }
-      break;
-    case 497:
-      HASH_GUARD(0x02BCE5B0FBED61F1LL, strlen) {
-        ci = &ci_strlen;
-        return true;
-      }
-      break;
-    case 499:
-      HASH_GUARD(0x582D10141D5601F3LL, stream_context_set_option) {
-        ci = &ci_stream_context_set_option;
-        return true;
-      }
-      break;
-    case 502:
-      HASH_GUARD(0x06DAF95935D221F6LL, dom_namednodemap_item) {
-        ci = &ci_dom_namednodemap_item;
-        return true;
-      }
-      break;
-    case 514:
-      HASH_GUARD(0x16699E33370A8202LL, idn_to_unicode) {
-        ci = &ci_idn_to_unicode;
-        return true;
-      }
-      break;
-    case 515:
-      HASH_GUARD(0x5B3C354575BB8203LL, mysql_free_result) {
-        ci = &ci_mysql_free_result;
-        return true;
-      }
-      break;
-    case 520:
-      HASH_GUARD(0x7B525920E026C208LL, gztell) {
-        ci = &ci_gztell;
-        return true;
-      }
-      break;
-    case 523:
-      HASH_GUARD(0x2F5144AB3647C20BLL, dom_text_is_whitespace_in_element_content) {
-        ci = &ci_dom_text_is_whitespace_in_element_content;
-        return true;
-      }
-      break;
-    case 525:
-      HASH_GUARD(0x5C0DECC8CC67E20DLL, magickwriteimagesfile) {
-        ci = &ci_magickwriteimagesfile;
-        return true;
-      }
-      break;
-    case 529:
-      HASH_GUARD(0x438CD1A0327A8211LL, apc_define_constants) {
-        ci = &ci_apc_define_constants;
-        return true;
-      }
-      break;
-    case 535:
-      HASH_GUARD(0x4BC4B81CC5F32217LL, dom_node_append_child) {
-        ci = &ci_dom_node_append_child;
-        return true;
-      }
-      break;
-    case 539:
-      HASH_GUARD(0x3A90CC67D58A021BLL, hash_hmac_file) {
-        ci = &ci_hash_hmac_file;
-        return true;
-      }
-      break;
-    case 545:
-      HASH_GUARD(0x345E2BAE171FA221LL, date_sunrise) {
-        ci = &ci_date_sunrise;
-        return true;
-      }
-      break;
-    case 546:
-      HASH_GUARD(0x39E4E0175FADC222LL, drawskewx) {
-        ci = &ci_drawskewx;
-        return true;
-      }
-      break;
-    case 547:
-      HASH_GUARD(0x5208E8B08455E223LL, dom_node_has_child_nodes) {
-        ci = &ci_dom_node_has_child_nodes;
-        return true;
-      }
-      break;
-    case 556:
-      HASH_GUARD(0x4129FFBF3548E22CLL, mb_strpos) {
-        ci = &ci_mb_strpos;
-        return true;
-      }
-      break;
-    case 557:
-      HASH_GUARD(0x3B0FE36F9A7AE22DLL, bzflush) {
-        ci = &ci_bzflush;
-        return true;
-      }
-      break;
-    case 560:
-      HASH_GUARD(0x036A5935D9936230LL, hphp_splfileinfo_openfile) {
-        ci = &ci_hphp_splfileinfo_openfile;
-        return true;
-      }
-      break;
-    case 561:
-      HASH_GUARD(0x61A192D10C004231LL, magickconvolveimage) {
-        ci = &ci_magickconvolveimage;
-        return true;
-      }
-      break;
-    case 564:
-      HASH_GUARD(0x422C51C95928A234LL, str_replace) {
-        ci = &ci_str_replace;
-        return true;
-      }
-      break;
-    case 568:
-      HASH_GUARD(0x0B7BB85A435F8238LL, bzdecompress) {
-        ci = &ci_bzdecompress;
-        return true;
-      }
-      HASH_GUARD(0x695AC59F79E2A238LL, mb_encode_mimeheader) {
-        ci = &ci_mb_encode_mimeheader;
-        return true;
-      }
-      break;
-    case 572:
-      HASH_GUARD(0x306F1D92E413A23CLL, check_user_func_async) {
-        ci = &ci_check_user_func_async;
-        return true;
-      }
-      break;
-    case 574:
-      HASH_GUARD(0x5E54CE856B78223ELL, array_flip) {
-        ci = &ci_array_flip;
-        return true;
-      }
-      break;
-    case 576:
-      HASH_GUARD(0x0DB9DD4AE24B0240LL, base64_encode) {
-        ci = &ci_base64_encode;
-        return true;
-      }
-      break;
-    case 584:
-      HASH_GUARD(0x7071BB6F0591E248LL, serialize) {
-        ci = &ci_serialize;
-        return true;
-      }
-      break;
-    case 589:
-      HASH_GUARD(0x5E73B9F3B7C8224DLL, parse_hdf_string) {
-        ci = &ci_parse_hdf_string;
-        return true;
-      }
-      break;
-    case 591:
-      HASH_GUARD(0x1D8FE8E68F7EA24FLL, pixelsetiteratorrow) {
-        ci = &ci_pixelsetiteratorrow;
-        return true;
-      }
-      break;
-    case 600:
-      HASH_GUARD(0x32C51FFF185F4258LL, memcache_set) {
-        ci = &ci_memcache_set;
-        return true;
-      }
-      break;
-    case 605:
-      HASH_GUARD(0x7E6024E53AEEE25DLL, apc_delete) {
-        ci = &ci_apc_delete;
-        return true;
-      }
-      break;
-    case 608:
-      HASH_GUARD(0x71D2D4757B7E4260LL, apache_request_headers) {
-        ci = &ci_apache_request_headers;
-        return true;
-      }
-      break;
-    case 609:
-      HASH_GUARD(0x48305E8ABB8BC261LL, hphp_instanceof) {
-        ci = &ci_hphp_instanceof;
-        return true;
-      }
-      break;
-    case 610:
-      HASH_GUARD(0x63AC0EED6D946262LL, pcntl_fork) {
-        ci = &ci_pcntl_fork;
-        return true;
-      }
-      break;
-    case 613:
-      HASH_GUARD(0x561DB8F1DC0BC265LL, magickseparateimagechannel) {
-        ci = &ci_magickseparateimagechannel;
-        return true;
-      }
-      break;
-    case 615:
-      HASH_GUARD(0x50C5488E19492267LL, mb_list_encodings_alias_names) {
-        ci = &ci_mb_list_encodings_alias_names;
-        return true;
-      }
-      break;
-    case 625:
-      HASH_GUARD(0x135CE067FA0A6271LL, bzerrno) {
-        ci = &ci_bzerrno;
-        return true;
-      }
-      break;
-    case 626:
-      HASH_GUARD(0x1C65F32FF28BC272LL, pathinfo) {
-        ci = &ci_pathinfo;
-        return true;
-      }
-      break;
-    case 637:
-      HASH_GUARD(0x7DB57C59E607627DLL, mcrypt_generic_deinit) {
-        ci = &ci_mcrypt_generic_deinit;
-        return true;
-      }
-      break;
-    case 638:
-      HASH_GUARD(0x4111669F4862E27ELL, drawpathlinetoverticalrelative) {
-        ci = &ci_drawpathlinetoverticalrelative;
-        return true;
-      }
-      break;
-    case 639:
-      HASH_GUARD(0x5B94A6962F1EC27FLL, magickechoimagesblob) {
-        ci = &ci_magickechoimagesblob;
-        return true;
-      }
-      break;
-    case 640:
-      HASH_GUARD(0x2E54EF1891172280LL, hphp_splfileinfo_isexecutable) {
-        ci = &ci_hphp_splfileinfo_isexecutable;
-        return true;
-      }
-      break;
-    case 641:
-      HASH_GUARD(0x1765A2E5186DE281LL, socket_write) {
-        ci = &ci_socket_write;
-        return true;
-      }
-      break;
-    case 643:
-      HASH_GUARD(0x4C83B098C8BDA283LL, posix_setsid) {
-        ci = &ci_posix_setsid;
-        return true;
-      }
-      break;
-    case 645:
-      HASH_GUARD(0x5F7DC3612050A285LL, drawsetfontweight) {
-        ci = &ci_drawsetfontweight;
-        return true;
-      }
-      HASH_GUARD(0x1A895A2307126285LL, openssl_pkcs7_decrypt) {
-        ci = &ci_openssl_pkcs7_decrypt;
-        return true;
-      }
-      break;
-    case 646:
-      HASH_GUARD(0x3A2E2C40B019E286LL, is_a) {
-        ci = &ci_is_a;
-        return true;
-      }
-      HASH_GUARD(0x4F028FA6AAEEC286LL, call_user_method) {
-        ci = &ci_call_user_method;
-        return true;
-      }
-      break;
-    case 647:
-      HASH_GUARD(0x27698DDEDAD6E287LL, openssl_pkey_new) {
-        ci = &ci_openssl_pkey_new;
-        return true;
-      }
-      HASH_GUARD(0x23A1E13930E44287LL, xbox_schedule_thread_reset) {
-        ci = &ci_xbox_schedule_thread_reset;
-        return true;
-      }
-      break;
-    case 656:
-      HASH_GUARD(0x04C11602C720A290LL, convert_cyr_string) {
-        ci = &ci_convert_cyr_string;
-        return true;
-      }
-      break;
-    case 660:
-      HASH_GUARD(0x4D05DD57E4052294LL, xmlwriter_output_memory) {
-        ci = &ci_xmlwriter_output_memory;
-        return true;
-      }
-      break;
-    case 661:
-      HASH_GUARD(0x69868C648BC12295LL, apc_store) {
-        ci = &ci_apc_store;
-        return true;
-      }
-      break;
-    case 665:
-      HASH_GUARD(0x22D380E06E67E299LL, stream_encoding) {
-        ci = &ci_stream_encoding;
-        return true;
-      }
-      HASH_GUARD(0x5665CB664C38A299LL, parse_ini_string) {
-        ci = &ci_parse_ini_string;
-        return true;
-      }
-      break;
-    case 666:
-      HASH_GUARD(0x24BD9EBDC721E29ALL, hphp_debug_caller_info) {
-        ci = &ci_hphp_debug_caller_info;
-        return true;
-      }
-      break;
-    case 668:
-      HASH_GUARD(0x0F71D3E47044E29CLL, drawpathcurvetosmoothrelative) {
-        ci = &ci_drawpathcurvetosmoothrelative;
-        return true;
-      }
-      break;
-    case 674:
-      HASH_GUARD(0x1FBF8A270331C2A2LL, write_hdf_file) {
-        ci = &ci_write_hdf_file;
-        return true;
-      }
-      break;
-    case 685:
-      HASH_GUARD(0x35D259398CDDA2ADLL, pixelgetredquantum) {
-        ci = &ci_pixelgetredquantum;
-        return true;
-      }
-      HASH_GUARD(0x00AB6FC4E9EE62ADLL, imagefilledrectangle) {
-        ci = &ci_imagefilledrectangle;
-        return true;
-      }
-      break;
-    case 691:
-      HASH_GUARD(0x44530C37F2B522B3LL, drawgetstrokedasharray) {
-        ci = &ci_drawgetstrokedasharray;
-        return true;
-      }
-      HASH_GUARD(0x59BB7B8078AC22B3LL, tempnam) {
-        ci = &ci_tempnam;
-        return true;
-      }
-      break;
-    case 694:
-      HASH_GUARD(0x0C4B98B47B0862B6LL, apd_echo) {
-        ci = &ci_apd_echo;
-        return true;
-      }
-      break;
-    case 696:
-      HASH_GUARD(0x3C6D50F3BB8102B8LL, next) {
-        ci = &ci_next;
-        return true;
-      }
-      break;
-    case 700:
-      HASH_GUARD(0x33E08846F3EB42BCLL, ldap_get_values) {
-        ci = &ci_ldap_get_values;
-        return true;
-      }
-      break;
-    case 708:
-      HASH_GUARD(0x6018C9F7DF40C2C4LL, xml_get_current_column_number) {
-        ci = &ci_xml_get_current_column_number;
-        return true;
-      }
-      break;
-    case 716:
-      HASH_GUARD(0x44273F8BA3F542CCLL, imagesx) {
-        ci = &ci_imagesx;
-        return true;
-      }
-      break;
-    case 718:
-      HASH_GUARD(0x1922D51F3E1522CELL, xmlwriter_end_dtd_attlist) {
-        ci = &ci_xmlwriter_end_dtd_attlist;
-        return true;
-      }
-      break;
-    case 722:
-      HASH_GUARD(0x4D9A87BD0CF742D2LL, imagepsextendfont) {
-        ci = &ci_imagepsextendfont;
-        return true;
-      }
-      break;
-    case 733:
-      HASH_GUARD(0x5F585DF7CB82E2DDLL, hphp_splfileinfo_iswritable) {
-        ci = &ci_hphp_splfileinfo_iswritable;
-        return true;
-      }
-      break;
-    case 739:
-      HASH_GUARD(0x45382D0BA5B262E3LL, mysql_get_proto_info) {
-        ci = &ci_mysql_get_proto_info;
-        return true;
-      }
-      break;
-    case 749:
-      HASH_GUARD(0x215E0E2EFA7422EDLL, drawgetstrokeantialias) {
-        ci = &ci_drawgetstrokeantialias;
-        return true;
-      }
-      break;
-    case 750:
-      HASH_GUARD(0x5D43C0E4868EC2EELL, forward_static_call) {
-        ci = &ci_forward_static_call;
-        return true;
-      }
-      HASH_GUARD(0x2884B7B3252B02EELL, imagealphablending) {
-        ci = &ci_imagealphablending;
-        return true;
-      }
-      break;
-    case 752:
-      HASH_GUARD(0x25CA0794823AA2F0LL, openssl_csr_get_public_key) {
-        ci = &ci_openssl_csr_get_public_key;
-        return true;
-      }
-      break;
-    case 761:
-      HASH_GUARD(0x00CFD56391DF82F9LL, mysql_data_seek) {
-        ci = &ci_mysql_data_seek;
-        return true;
-      }
-      break;
-    case 764:
-      HASH_GUARD(0x66D59E4DBC7382FCLL, drawscale) {
-        ci = &ci_drawscale;
-        return true;
-      }
-      break;
-    case 772:
-      HASH_GUARD(0x33A532FDB8EAC304LL, memcache_delete) {
-        ci = &ci_memcache_delete;
-        return true;
-      }
-      break;
-    case 777:
-      HASH_GUARD(0x414038596F552309LL, magickgetversionnumber) {
-        ci = &ci_magickgetversionnumber;
-        return true;
-      }
-      HASH_GUARD(0x47CB27E8FDB60309LL, array_fill) {
-        ci = &ci_array_fill;
-        return true;
-      }
-      break;
-    case 779:
-      HASH_GUARD(0x0C6F751411F5E30BLL, strrev) {
-        ci = &ci_strrev;
-        return true;
-      }
-      HASH_GUARD(0x65F586C35A88030BLL, magickresizeimage) {
-        ci = &ci_magickresizeimage;
-        return true;
-      }
-      break;
-    case 814:
-      HASH_GUARD(0x7D1DCB9F4168032ELL, imap_getsubscribed) {
-        ci = &ci_imap_getsubscribed;
-        return true;
-      }
-      break;
-    case 816:
-      HASH_GUARD(0x300F758BB0E16330LL, mysql_num_rows) {
-        ci = &ci_mysql_num_rows;
-        return true;
-      }
-      break;
-    case 817:
-      HASH_GUARD(0x00DAFE46631AE331LL, stream_set_timeout) {
-        ci = &ci_stream_set_timeout;
-        return true;
-      }
-      break;
-    case 818:
-      HASH_GUARD(0x037055C215998332LL, bcsub) {
-        ci = &ci_bcsub;
-        return true;
-      }
-      break;
-    case 824:
-      HASH_GUARD(0x549D51040C250338LL, cleardrawingwand) {
-        ci = &ci_cleardrawingwand;
-        return true;
-      }
-      break;
-    case 825:
-      HASH_GUARD(0x48D57F17C5132339LL, drawgetclippath) {
-        ci = &ci_drawgetclippath;
-        return true;
-      }
-      break;
-    case 826:
-      HASH_GUARD(0x34DDF0DFC546033ALL, xbox_task_start) {
-        ci = &ci_xbox_task_start;
-        return true;
-      }
-      break;
-    case 829:
-      HASH_GUARD(0x4E166ECE0EC6A33DLL, openssl_pkey_get_public) {
-        ci = &ci_openssl_pkey_get_public;
-        return true;
-      }
-      break;
-    case 830:
-      HASH_GUARD(0x758EA7E9AA45C33ELL, xmlwriter_end_document) {
-        ci = &ci_xmlwriter_end_document;
-        return true;
-      }
-      break;
-    case 836:
-      HASH_GUARD(0x1A9DC76AB74F6344LL, openssl_verify) {
-        ci = &ci_openssl_verify;
-        return true;
-      }
-      break;
-    case 838:
-      HASH_GUARD(0x4B30FBA18042E346LL, session_cache_expire) {
-        ci = &ci_session_cache_expire;
-        return true;
-      }
-      break;
-    case 843:
-      HASH_GUARD(0x3880550F6AD8034BLL, session_destroy) {
-        ci = &ci_session_destroy;
-        return true;
-      }
-      break;
-    case 845:
-      HASH_GUARD(0x5998E61D600D634DLL, drawaffine) {
-        ci = &ci_drawaffine;
-        return true;
-      }
-      break;
-    case 858:
-      HASH_GUARD(0x4BF5DEBDB76EC35ALL, mcrypt_enc_get_iv_size) {
-        ci = &ci_mcrypt_enc_get_iv_size;
-        return true;
-      }
-      HASH_GUARD(0x0E0C79E42812235ALL, imagepng) {
-        ci = &ci_imagepng;
-        return true;
-      }
-      break;
-    case 861:
-      HASH_GUARD(0x54C3E9AB6FB8E35DLL, magickswirlimage) {
-        ci = &ci_magickswirlimage;
-        return true;
-      }
-      break;
-    case 863:
-      HASH_GUARD(0x280DE04F84FB235FLL, popdrawingwand) {
-        ci = &ci_popdrawingwand;
-        return true;
-      }
-      break;
-    case 869:
-      HASH_GUARD(0x68DBF8ABB26A8365LL, hphp_directoryiterator_rewind) {
-        ci = &ci_hphp_directoryiterator_rewind;
-        return true;
-      }
-      break;
-    case 870:
-      HASH_GUARD(0x4EF3469306E44366LL, floatval) {
-        ci = &ci_floatval;
-        return true;
-      }
-      break;
-    case 871:
-      HASH_GUARD(0x4810A9774785C367LL, posix_getpgrp) {
-        ci = &ci_posix_getpgrp;
-        return true;
-      }
-      break;
-    case 873:
-      HASH_GUARD(0x6C715D7DD63DA369LL, is_integer) {
-        ci = &ci_is_integer;
-        return true;
-      }
-      break;
-    case 889:
-      HASH_GUARD(0x5ED8901DB5D14379LL, magickcharcoalimage) {
-        ci = &ci_magickcharcoalimage;
-        return true;
-      }
-      break;
-    case 890:
-      HASH_GUARD(0x69EA8DC005FEC37ALL, hphp_splfileobject_fwrite) {
-        ci = &ci_hphp_splfileobject_fwrite;
-        return true;
-      }
-      break;
-    case 893:
-      HASH_GUARD(0x7C40E2514FB5437DLL, dom_namednodemap_get_named_item_ns) {
-        ci = &ci_dom_namednodemap_get_named_item_ns;
-        return true;
-      }
-      break;
-    case 904:
-      HASH_GUARD(0x791E946E04F50388LL, magicksetresourcelimit) {
-        ci = &ci_magicksetresourcelimit;
-        return true;
-      }
-      break;
-    case 907:
-      HASH_GUARD(0x7CC683891D5F038BLL, imap_qprint) {
-        ci = &ci_imap_qprint;
-        return true;
-      }
-      HASH_GUARD(0x73A3F87C0A56238BLL, stat) {
-        ci = &ci_stat;
-        return true;
-      }
-      break;
-    case 909:
-      HASH_GUARD(0x4127DE142CD4A38DLL, xml_get_error_code) {
-        ci = &ci_xml_get_error_code;
-        return true;
-      }
-      break;
-    case 914:
-      HASH_GUARD(0x2395B0A85E292392LL, hphp_splfileobject_flock) {
-        ci = &ci_hphp_splfileobject_flock;
-        return true;
-      }
-      break;
-    case 916:
-      HASH_GUARD(0x269A220896FD2394LL, deg2rad) {
-        ci = &ci_deg2rad;
-        return true;
-      }
-      HASH_GUARD(0x36953788781F4394LL, mailparse_msg_extract_part) {
-        ci = &ci_mailparse_msg_extract_part;
-        return true;
-      }
-      break;
-    case 917:
-      HASH_GUARD(0x422599B9E8AC0395LL, stream_bucket_make_writeable) {
-        ci = &ci_stream_bucket_make_writeable;
-        return true;
-      }
-      break;
-    case 918:
-      HASH_GUARD(0x15EC64198D93C396LL, openssl_pkcs12_read) {
-        ci = &ci_openssl_pkcs12_read;
-        return true;
-      }
-      break;
-    case 919:
-      HASH_GUARD(0x1D2C305EA5C82397LL, idn_to_utf8) {
-        ci = &ci_idn_to_utf8;
-        return true;
-      }
-      break;
-    case 920:
-      HASH_GUARD(0x215547858BA7E398LL, hphp_recursiveiteratoriterator___construct) {
-        ci = &ci_hphp_recursiveiteratoriterator___construct;
-        return true;
-      }
-      break;
-    case 922:
-      HASH_GUARD(0x0CC562CBD773639ALL, i18n_loc_get_default) {
-        ci = &ci_i18n_loc_get_default;
-        return true;
-      }
-      break;
-    case 923:
-      HASH_GUARD(0x25DF28703309C39BLL, idate) {
-        ci = &ci_idate;
-        return true;
-      }
-      break;
-    case 924:
-      HASH_GUARD(0x0136F8F03932E39CLL, session_unset) {
-        ci = &ci_session_unset;
-        return true;
-      }
-      break;
-    case 927:
-      HASH_GUARD(0x57E72C21F67D039FLL, user_error) {
-        ci = &ci_user_error;
-        return true;
-      }
-      HASH_GUARD(0x0368F1779E3AE39FLL, mysql_field_table) {
-        ci = &ci_mysql_field_table;
-        return true;
-      }
-      break;
-    case 929:
-      HASH_GUARD(0x5C29B6D7973903A1LL, proc_nice) {
-        ci = &ci_proc_nice;
-        return true;
-      }
-      break;
-    case 930:
-      HASH_GUARD(0x0207E332D629A3A2LL, mailparse_msg_get_structure) {
-        ci = &ci_mailparse_msg_get_structure;
-        return true;
-      }
-      break;
-    case 936:
-      HASH_GUARD(0x0121CD6CDCE1C3A8LL, mysql_pconnect_with_db) {
-        ci = &ci_mysql_pconnect_with_db;
-        return true;
-      }
-      break;
-    case 937:
-      HASH_GUARD(0x7F9E810BC93023A9LL, memcache_close) {
-        ci = &ci_memcache_close;
-        return true;
-      }
-      break;
-    case 938:
-      HASH_GUARD(0x3238A5BD362443AALL, escapeshellcmd) {
-        ci = &ci_escapeshellcmd;
-        return true;
-      }
-      break;
-    case 946:
-      HASH_GUARD(0x3DB7EBC0B670C3B2LL, magicksetimageredprimary) {
-        ci = &ci_magicksetimageredprimary;
-        return true;
-      }
-      break;
-    case 947:
-      HASH_GUARD(0x61720D771D1A23B3LL, posix_getpwnam) {
-        ci = &ci_posix_getpwnam;
-        return true;
-      }
-      break;
-    case 949:
-      HASH_GUARD(0x03BE37E94875C3B5LL, fb_set_exit_callback) {
-        ci = &ci_fb_set_exit_callback;
-        return true;
-      }
-      break;
-    case 955:
-      HASH_GUARD(0x5A3F5AAD1B13A3BBLL, is_executable) {
-        ci = &ci_is_executable;
-        return true;
-      }
-      break;
-    case 957:
-      HASH_GUARD(0x60294C2616F6A3BDLL, mcrypt_enc_get_supported_key_sizes) {
-        ci = &ci_mcrypt_enc_get_supported_key_sizes;
-        return true;
-      }
-      break;
-    case 968:
-      HASH_GUARD(0x3101CE70BA49A3C8LL, error_reporting) {
-        ci = &ci_error_reporting;
-        return true;
-      }
-      break;
-    case 971:
-      HASH_GUARD(0x4C3B6BE9112E63CBLL, str_split) {
-        ci = &ci_str_split;
-        return true;
-      }
-      break;
-    case 972:
-      HASH_GUARD(0x50C88817090C63CCLL, pcntl_wait) {
-        ci = &ci_pcntl_wait;
-        return true;
-      }
-      break;
-    case 974:
-      HASH_GUARD(0x4F9F68F60FD7A3CELL, drawgetfillrule) {
-        ci = &ci_drawgetfillrule;
-        return true;
-      }
-      break;
-    case 979:
-      HASH_GUARD(0x734FD402E190E3D3LL, evhttp_async_get) {
-        ci = &ci_evhttp_async_get;
-        return true;
-      }
-      break;
-    case 980:
-      HASH_GUARD(0x0FF21F9BE4CCC3D4LL, call_user_func_rpc) {
-        ci = &ci_call_user_func_rpc;
-        return true;
-      }
-      break;
-    case 996:
-      HASH_GUARD(0x7E7718CC939D63E4LL, setrawcookie) {
-        ci = &ci_setrawcookie;
-        return true;
-      }
-      break;
-    case 1000:
-      HASH_GUARD(0x6BB9D669DDB703E8LL, xml_get_current_byte_index) {
-        ci = &ci_xml_get_current_byte_index;
-        return true;
-      }
-      HASH_GUARD(0x4A3127C309B0C3E8LL, drawsetstrokelinecap) {
-        ci = &ci_drawsetstrokelinecap;
-        return true;
-      }
-      break;
-    case 1002:
-      HASH_GUARD(0x6DA49696220FE3EALL, mailparse_rfc822_parse_addresses) {
-        ci = &ci_mailparse_rfc822_parse_addresses;
-        return true;
-      }
-      break;
-    case 1003:
-      HASH_GUARD(0x1DAE0831CECB63EBLL, ob_get_clean) {
-        ci = &ci_ob_get_clean;
-        return true;
-      }
-      break;
-    case 1006:
-      HASH_GUARD(0x598472448937E3EELL, magickqueryfontmetrics) {
-        ci = &ci_magickqueryfontmetrics;
-        return true;
-      }
-      break;
-    case 1008:
-      HASH_GUARD(0x69C07B1F19CE83F0LL, imap_rfc822_parse_headers) {
-        ci = &ci_imap_rfc822_parse_headers;
-        return true;
-      }
-      break;
-    case 1012:
-      HASH_GUARD(0x1938C8715806E3F4LL, spl_classes) {
-        ci = &ci_spl_classes;
-        return true;
-      }
-      break;
-    case 1025:
-      HASH_GUARD(0x3DCB1C92B5864401LL, gzrewind) {
-        ci = &ci_gzrewind;
-        return true;
-      }
-      break;
-    case 1028:
-      HASH_GUARD(0x2B12B0E9109D0404LL, iptcembed) {
-        ci = &ci_iptcembed;
-        return true;
-      }
-      break;
-    case 1033:
-      HASH_GUARD(0x2E57E06900594409LL, xbox_send_message) {
-        ci = &ci_xbox_send_message;
-        return true;
-      }
-      break;
-    case 1037:
-      HASH_GUARD(0x2939C5BAE0C4A40DLL, nl2br) {
-        ci = &ci_nl2br;
-        return true;
-      }
-      HASH_GUARD(0x267529454569840DLL, ob_flush) {
-        ci = &ci_ob_flush;
-        return true;
-      }
-      HASH_GUARD(0x002CCCD877D9640DLL, drawpathclose) {
-        ci = &ci_drawpathclose;
-        return true;
-      }
-      break;
-    case 1062:
-      HASH_GUARD(0x21EFB0B9D1514426LL, magicksetpassphrase) {
-        ci = &ci_magicksetpassphrase;
-        return true;
-      }
-      break;
-    case 1069:
-      HASH_GUARD(0x2A5A519E4BFE442DLL, mb_eregi) {
-        ci = &ci_mb_eregi;
-        return true;
-      }
-      break;
-    case 1071:
-      HASH_GUARD(0x316F2725AC15042FLL, stream_resolve_include_path) {
-        ci = &ci_stream_resolve_include_path;
-        return true;
-      }
-      break;
-    case 1072:
-      HASH_GUARD(0x6349C9658B2A2430LL, memcache_pconnect) {
-        ci = &ci_memcache_pconnect;
-        return true;
-      }
-      break;
-    case 1074:
-      HASH_GUARD(0x71C6E38BC56CE432LL, stream_wrapper_register) {
-        ci = &ci_stream_wrapper_register;
-        return true;
-      }
-      break;
-    case 1082:
-      HASH_GUARD(0x5019A1FBF377C43ALL, imagepsbbox) {
-        ci = &ci_imagepsbbox;
-        return true;
-      }
-      break;
-    case 1084:
-      HASH_GUARD(0x59ECE01C7629643CLL, mysql_drop_db) {
-        ci = &ci_mysql_drop_db;
-        return true;
-      }
-      break;
-    case 1089:
-      HASH_GUARD(0x158E2271E381C441LL, hash_file) {
-        ci = &ci_hash_file;
-        return true;
-      }
-      break;
-    case 1090:
-      HASH_GUARD(0x3F869126D0336442LL, trigger_error) {
-        ci = &ci_trigger_error;
-        return true;
-      }
-      break;
-    case 1106:
-      HASH_GUARD(0x1056EF1C14D2A452LL, socket_connect) {
-        ci = &ci_socket_connect;
-        return true;
-      }
-      break;
-    case 1117:
-      HASH_GUARD(0x0246AF48CD31245DLL, count_chars) {
-        ci = &ci_count_chars;
-        return true;
-      }
-      break;
-    case 1125:
-      HASH_GUARD(0x05D72365192CE465LL, fwrite) {
-        ci = &ci_fwrite;
-        return true;
-      }
-      HASH_GUARD(0x406A1404F48E4465LL, posix_getuid) {
-        ci = &ci_posix_getuid;
-        return true;
-      }
-      break;
-    case 1136:
-      HASH_GUARD(0x0C626F268F120470LL, __halt_compiler) {
-        ci = &ci___halt_compiler;
-        return true;
-      }
-      break;
-    case 1139:
-      HASH_GUARD(0x0F8F276A48900473LL, drawgetstrokelinecap) {
-        ci = &ci_drawgetstrokelinecap;
-        return true;
-      }
-      break;
-    case 1141:
-      HASH_GUARD(0x268706C46202C475LL, sem_acquire) {
-        ci = &ci_sem_acquire;
-        return true;
-      }
-      break;
-    case 1148:
-      HASH_GUARD(0x1A08C578AD3BC47CLL, apache_response_headers) {
-        ci = &ci_apache_response_headers;
-        return true;
-      }
-      break;
-    case 1150:
-      HASH_GUARD(0x0AC36D9F961B247ELL, newpixeliterator) {
-        ci = &ci_newpixeliterator;
-        return true;
-      }
-      break;
-    case 1157:
-      HASH_GUARD(0x61499C92F4FBA485LL, hphp_splfileobject_fgetc) {
-        ci = &ci_hphp_splfileobject_fgetc;
-        return true;
-      }
-      break;
-    case 1161:
-      HASH_GUARD(0x7505924F05854489LL, dom_element_set_attribute_ns) {
-        ci = &ci_dom_element_set_attribute_ns;
-        return true;
-      }
-      break;
-    case 1165:
-      HASH_GUARD(0x275D127C87EF048DLL, mysql_db_query) {
-        ci = &ci_mysql_db_query;
-        return true;
-      }
-      break;
-    case 1167:
-      HASH_GUARD(0x43672229728A648FLL, drawpushpattern) {
-        ci = &ci_drawpushpattern;
-        return true;
-      }
-      break;
-    case 1181:
-      HASH_GUARD(0x7A59813AC331449DLL, mb_ereg_search_regs) {
-        ci = &ci_mb_ereg_search_regs;
-        return true;
-      }
-      break;
-    case 1183:
-      HASH_GUARD(0x7FF66005524E649FLL, drawgettextdecoration) {
-        ci = &ci_drawgettextdecoration;
-        return true;
-      }
-      break;
-    case 1188:
-      HASH_GUARD(0x6EC476E42A53A4A4LL, ldap_err2str) {
-        ci = &ci_ldap_err2str;
-        return true;
-      }
-      break;
-    case 1192:
-      HASH_GUARD(0x6F4497457F1584A8LL, dom_element_set_id_attribute_node) {
-        ci = &ci_dom_element_set_id_attribute_node;
-        return true;
-      }
-      break;
-    case 1196:
-      HASH_GUARD(0x245AA2790C87C4ACLL, image_type_to_mime_type) {
-        ci = &ci_image_type_to_mime_type;
-        return true;
-      }
-      HASH_GUARD(0x6E8FFA56842304ACLL, drawgetfont) {
-        ci = &ci_drawgetfont;
-        return true;
-      }
-      break;
-    case 1197:
-      HASH_GUARD(0x3D98ACFCEBB764ADLL, hphp_set_property) {
-        ci = &ci_hphp_set_property;
-        return true;
-      }
-      break;
-    case 1200:
-      HASH_GUARD(0x3AF65A9F3653E4B0LL, addslashes) {
-        ci = &ci_addslashes;
-        return true;
-      }
-      break;
-    case 1204:
-      HASH_GUARD(0x00621C58E54D44B4LL, hphp_recursiveiteratoriterator_key) {
-        ci = &ci_hphp_recursiveiteratoriterator_key;
-        return true;
-      }
-      break;
-    case 1209:
-      HASH_GUARD(0x5351290CD139A4B9LL, mb_strrpos) {
-        ci = &ci_mb_strrpos;
-        return true;
-      }
-      break;
-    case 1213:
-      HASH_GUARD(0x35BE8F6E7726C4BDLL, dechex) {
-        ci = &ci_dechex;
-        return true;
-      }
-      HASH_GUARD(0x1F4D41588D2EA4BDLL, hphp_get_status) {
-        ci = &ci_hphp_get_status;
-        return true;
-      }
-      break;
-    case 1214:
-      HASH_GUARD(0x57278846B8B0E4BELL, ldap_count_entries) {
-        ci = &ci_ldap_count_entries;
-        return true;
-      }
-      break;
-    case 1215:
-      HASH_GUARD(0x01681C307C5AE4BFLL, strtoupper) {
-        ci = &ci_strtoupper;
-        return true;
-      }
-      break;
-    case 1219:
-      HASH_GUARD(0x7AAC29849263C4C3LL, getprotobyname) {
-        ci = &ci_getprotobyname;
-        return true;
-      }
-      break;
-    case 1220:
-      HASH_GUARD(0x67EADCF4E81084C4LL, mb_ereg) {
-        ci = &ci_mb_ereg;
-        return true;
-      }
-      break;
-    case 1222:
-      HASH_GUARD(0x651F7FBBA90604C6LL, magickgetimageindex) {
-        ci = &ci_magickgetimageindex;
-        return true;
-      }
-      HASH_GUARD(0x4F7AA8120E33E4C6LL, collator_get_attribute) {
-        ci = &ci_collator_get_attribute;
-        return true;
-      }
-      break;
-    case 1230:
-      HASH_GUARD(0x60783C20BF7724CELL, mailparse_msg_free) {
-        ci = &ci_mailparse_msg_free;
-        return true;
-      }
-      break;
-    case 1231:
-      HASH_GUARD(0x72DECE786967A4CFLL, magickpreviousimage) {
-        ci = &ci_magickpreviousimage;
-        return true;
-      }
-      break;
-    case 1239:
-      HASH_GUARD(0x215403F1E335C4D7LL, magicksolarizeimage) {
-        ci = &ci_magicksolarizeimage;
-        return true;
-      }
-      break;
-    case 1240:
-      HASH_GUARD(0x2532EB687D51E4D8LL, unregister_tick_function) {
-        ci = &ci_unregister_tick_function;
-        return true;
-      }
-      break;
-    case 1247:
-      HASH_GUARD(0x2E5E5A0FC3B5C4DFLL, xml_set_character_data_handler) {
-        ci = &ci_xml_set_character_data_handler;
-        return true;
-      }
-      break;
-    case 1248:
-      HASH_GUARD(0x340A51AE22A924E0LL, reset) {
-        ci = &ci_reset;
-        return true;
-      }
-      break;
-    case 1255:
-      HASH_GUARD(0x4CE852AAFF77E4E7LL, inclued_get_data) {
-        ci = &ci_inclued_get_data;
-        return true;
-      }
-      break;
-    case 1260:
-      HASH_GUARD(0x784F675D436004ECLL, imap_close) {
-        ci = &ci_imap_close;
-        return true;
-      }
-      break;
-    case 1265:
-      HASH_GUARD(0x65BD541EAB38E4F1LL, mysql_close) {
-        ci = &ci_mysql_close;
-        return true;
-      }
-      break;
-    case 1269:
-      HASH_GUARD(0x528AC8D252D224F5LL, log10) {
-        ci = &ci_log10;
-        return true;
-      }
-      break;
-    case 1271:
-      HASH_GUARD(0x0BD9C5D811CB04F7LL, dom_element_set_id_attribute_ns) {
-        ci = &ci_dom_element_set_id_attribute_ns;
-        return true;
-      }
-      break;
-    case 1272:
-      HASH_GUARD(0x011006D90D79E4F8LL, mysql_errno) {
-        ci = &ci_mysql_errno;
-        return true;
-      }
-      break;
-    case 1277:
-      HASH_GUARD(0x002387F1D23B44FDLL, mcrypt_list_modes) {
-        ci = &ci_mcrypt_list_modes;
-        return true;
-      }
-      HASH_GUARD(0x2CEAE845E4F404FDLL, dom_document_save) {
-        ci = &ci_dom_document_save;
-        return true;
-      }
-      break;
-    case 1287:
-      HASH_GUARD(0x197A5D237BD4C507LL, mb_ereg_search_getpos) {
-        ci = &ci_mb_ereg_search_getpos;
-        return true;
-      }
-      break;
-    case 1291:
-      HASH_GUARD(0x71DCF11E3640C50BLL, hphp_directoryiterator_valid) {
-        ci = &ci_hphp_directoryiterator_valid;
-        return true;
-      }
-      break;
-    case 1295:
-      HASH_GUARD(0x5A66CCB3D924450FLL, xml_parser_create) {
-        ci = &ci_xml_parser_create;
-        return true;
-      }
-      break;
-    case 1297:
-      HASH_GUARD(0x09D5355CA8198511LL, mb_internal_encoding) {
-        ci = &ci_mb_internal_encoding;
-        return true;
-      }
-      break;
-    case 1305:
-      HASH_GUARD(0x54EDBB6BAF318519LL, memcache_add) {
-        ci = &ci_memcache_add;
-        return true;
-      }
-      break;
-    case 1316:
-      HASH_GUARD(0x28E724EDE0BB6524LL, mb_strcut) {
-        ci = &ci_mb_strcut;
-        return true;
-      }
-      break;
-    case 1318:
-      HASH_GUARD(0x57DDA4C3F7FF8526LL, fputcsv) {
-        ci = &ci_fputcsv;
-        return true;
-      }
-      break;
-    case 1319:
-      HASH_GUARD(0x6B2B942CAF1A2527LL, array_shift) {
-        ci = &ci_array_shift;
-        return true;
-      }
-      break;
-    case 1331:
-      HASH_GUARD(0x313D2A505076A533LL, dir) {
-        ci = &ci_dir;
-        return true;
-      }
-      break;
-    case 1334:
-      HASH_GUARD(0x746DC7AD953EA536LL, memcache_set_compress_threshold) {
-        ci = &ci_memcache_set_compress_threshold;
-        return true;
-      }
-      break;
-    case 1335:
-      HASH_GUARD(0x175B86BCB3124537LL, magickgetexceptionstring) {
-        ci = &ci_magickgetexceptionstring;
-        return true;
-      }
-      break;
-    case 1341:
-      HASH_GUARD(0x0F32841DBF7A053DLL, fb_crossall_query) {
-        ci = &ci_fb_crossall_query;
-        return true;
-      }
-      break;
-    case 1346:
-      HASH_GUARD(0x59A44591E67D4542LL, drawrender) {
-        ci = &ci_drawrender;
-        return true;
-      }
-      break;
-    case 1347:
-      HASH_GUARD(0x20E2B1D920122543LL, die) {
-        ci = &ci_die;
-        return true;
-      }
-      break;
-    case 1350:
-      HASH_GUARD(0x12A739BE0ED32546LL, ignore_user_abort) {
-        ci = &ci_ignore_user_abort;
-        return true;
-      }
-      HASH_GUARD(0x081F76AC889BC546LL, getrusage) {
-        ci = &ci_getrusage;
-        return true;
-      }
-      break;
-    case 1352:
-      HASH_GUARD(0x0AD3BFAB5F780548LL, magickcoalesceimages) {
-        ci = &ci_magickcoalesceimages;
-        return true;
-      }
-      break;
-    case 1357:
-      HASH_GUARD(0x1B9E769FFEC3C54DLL, pcntl_wtermsig) {
-        ci = &ci_pcntl_wtermsig;
-        return true;
-      }
-      break;
-    case 1359:
-      HASH_GUARD(0x063200B5AAFEC54FLL, mysql_thread_id) {
-        ci = &ci_mysql_thread_id;
-        return true;
-      }
-      break;
-    case 1382:
-      HASH_GUARD(0x3DA2058E5C540566LL, spliti) {
-        ci = &ci_spliti;
-        return true;
-      }
-      break;
-    case 1386:
-      HASH_GUARD(0x74599147803DC56ALL, magickgetstringwidth) {
-        ci = &ci_magickgetstringwidth;
-        return true;
-      }
-      break;
-    case 1387:
-      HASH_GUARD(0x0DE86977367F656BLL, register_shutdown_function) {
-        ci = &ci_register_shutdown_function;
-        return true;
-      }
-      break;
-    case 1390:
-      HASH_GUARD(0x2A1F1B52160DE56ELL, zend_logo_guid) {
-        ci = &ci_zend_logo_guid;
-        return true;
-      }
-      break;
-    case 1392:
-      HASH_GUARD(0x13D0427F3BB3E570LL, get_declared_interfaces) {
-        ci = &ci_get_declared_interfaces;
-        return true;
-      }
-      HASH_GUARD(0x21B3935EB3140570LL, mysql_fetch_object) {
-        ci = &ci_mysql_fetch_object;
-        return true;
-      }
-      break;
-    case 1399:
-      HASH_GUARD(0x72E1FD3DCD45C577LL, bzopen) {
-        ci = &ci_bzopen;
-        return true;
-      }
-      break;
-    case 1401:
-      HASH_GUARD(0x1DC8A386E219C579LL, ldap_add) {
-        ci = &ci_ldap_add;
-        return true;
-      }
-      break;
-    case 1405:
-      HASH_GUARD(0x78EDB608B02A857DLL, join) {
-        ci = &ci_join;
-        return true;
-      }
-      HASH_GUARD(0x22E08DEDF360057DLL, pixelsetmagenta) {
-        ci = &ci_pixelsetmagenta;
-        return true;
-      }
-      break;
-    case 1406:
-      HASH_GUARD(0x132776D93181E57ELL, ldap_set_option) {
-        ci = &ci_ldap_set_option;
-        return true;
-      }
-      break;
-    case 1408:
-      HASH_GUARD(0x709140577B2C6580LL, xhprof_network_enable) {
-        ci = &ci_xhprof_network_enable;
-        return true;
-      }
-      break;
-    case 1410:
-      HASH_GUARD(0x02688986D5D76582LL, magickspreadimage) {
-        ci = &ci_magickspreadimage;
-        return true;
-      }
-      break;
-    case 1411:
-      HASH_GUARD(0x3B2CD86F5DB72583LL, magickblackthresholdimage) {
-        ci = &ci_magickblackthresholdimage;
-        return true;
-      }
-      break;
-    case 1419:
-      HASH_GUARD(0x1EF2C1426AB0A58BLL, dom_node_replace_child) {
-        ci = &ci_dom_node_replace_child;
-        return true;
-      }
-      HASH_GUARD(0x3A34B44E4C51C58BLL, xml_set_element_handler) {
-        ci = &ci_xml_set_element_handler;
-        return true;
-      }
-      break;
-    case 1420:
-      HASH_GUARD(0x560C2F71978CE58CLL, shm_put_var) {
-        ci = &ci_shm_put_var;
-        return true;
-      }
-      break;
-    case 1422:
-      HASH_GUARD(0x0012B121E023458ELL, hphp_set_iostatus_address) {
-        ci = &ci_hphp_set_iostatus_address;
-        return true;
-      }
-      break;
-    case 1426:
-      HASH_GUARD(0x3E9519FE856C4592LL, curl_multi_init) {
-        ci = &ci_curl_multi_init;
-        return true;
-      }
-      HASH_GUARD(0x5464E148E8A0C592LL, get_extension_funcs) {
-        ci = &ci_get_extension_funcs;
-        return true;
-      }
-      HASH_GUARD(0x7F65501600346592LL, mcrypt_get_block_size) {
-        ci = &ci_mcrypt_get_block_size;
-        return true;
-      }
-      HASH_GUARD(0x66B19094ED494592LL, imap_uid) {
-        ci = &ci_imap_uid;
-        return true;
-      }
-      break;
-    case 1427:
-      HASH_GUARD(0x0F5984B8A7FD8593LL, hphp_splfileinfo_getperms) {
-        ci = &ci_hphp_splfileinfo_getperms;
-        return true;
-      }
-      break;
-    case 1431:
-      HASH_GUARD(0x513787A813DB0597LL, date_date_set) {
-        ci = &ci_date_date_set;
-        return true;
-      }
-      break;
-    case 1433:
-      HASH_GUARD(0x12F502A88E0AA599LL, magickcompositeimage) {
-        ci = &ci_magickcompositeimage;
-        return true;
-      }
-      break;
-    case 1448:
-      HASH_GUARD(0x4FBB1F662399A5A8LL, is_soap_fault) {
-        ci = &ci_is_soap_fault;
-        return true;
-      }
-      break;
-    case 1453:
-      HASH_GUARD(0x4110AF96B98B25ADLL, gzeof) {
-        ci = &ci_gzeof;
-        return true;
-      }
-      break;
-    case 1461:
-      HASH_GUARD(0x5EFE573046B565B5LL, mcrypt_module_close) {
-        ci = &ci_mcrypt_module_close;
-        return true;
-      }
-      break;
-    case 1466:
-      HASH_GUARD(0x05B8EB2C515885BALL, vprintf) {
-        ci = &ci_vprintf;
-        return true;
-      }
-      break;
-    case 1472:
-      HASH_GUARD(0x61465CD8C67905C0LL, openssl_pkey_free) {
-        ci = &ci_openssl_pkey_free;
-        return true;
-      }
-      break;
-    case 1478:
-      HASH_GUARD(0x3B3D5CE69B1565C6LL, mcrypt_module_is_block_mode) {
-        ci = &ci_mcrypt_module_is_block_mode;
-        return true;
-      }
-      break;
-    case 1480:
-      HASH_GUARD(0x1CE8175A87C785C8LL, dom_document_validate) {
-        ci = &ci_dom_document_validate;
-        return true;
-      }
-      break;
-    case 1483:
-      HASH_GUARD(0x6751946191FBE5CBLL, override_function) {
-        ci = &ci_override_function;
-        return true;
-      }
-      break;
-    case 1484:
-      HASH_GUARD(0x2A6F86821A39C5CCLL, expm1) {
-        ci = &ci_expm1;
-        return true;
-      }
-      break;
-    case 1486:
-      HASH_GUARD(0x406AC1DDB92925CELL, parse_hdf_file) {
-        ci = &ci_parse_hdf_file;
-        return true;
-      }
-      break;
-    case 1487:
-      HASH_GUARD(0x5D9818B3E1C385CFLL, openssl_pkey_export_to_file) {
-        ci = &ci_openssl_pkey_export_to_file;
-        return true;
-      }
-      break;
-    case 1489:
-      HASH_GUARD(0x054503DBBF5CA5D1LL, imagecopy) {
-        ci = &ci_imagecopy;
-        return true;
-      }
-      break;
-    case 1493:
-      HASH_GUARD(0x43901543EA8625D5LL, curl_multi_select) {
-        ci = &ci_curl_multi_select;
-        return true;
-      }
-      break;
-    case 1494:
-      HASH_GUARD(0x6D265875A19685D6LL, is_float) {
-        ci = &ci_is_float;
-        return true;
-      }
-      break;
-    case 1495:
-      HASH_GUARD(0x617AD1AD708785D7LL, magickmodulateimage) {
-        ci = &ci_magickmodulateimage;
-        return true;
-      }
-      break;
-    case 1508:
-      HASH_GUARD(0x3A9643992AC805E4LL, magickdrawimage) {
-        ci = &ci_magickdrawimage;
-        return true;
-      }
-      break;
-    case 1510:
-      HASH_GUARD(0x6FE2E44FBC44E5E6LL, magickaddnoiseimage) {
-        ci = &ci_magickaddnoiseimage;
-        return true;
-      }
-      HASH_GUARD(0x08069ECE0EA3C5E6LL, imagecopymergegray) {
-        ci = &ci_imagecopymergegray;
-        return true;
-      }
-      break;
-    case 1518:
-      HASH_GUARD(0x3076D369F63E65EELL, pixelgetalpha) {
-        ci = &ci_pixelgetalpha;
-        return true;
-      }
-      break;
-    case 1524:
-      HASH_GUARD(0x1E89F15B7F2805F4LL, openssl_pkcs7_encrypt) {
-        ci = &ci_openssl_pkcs7_encrypt;
-        return true;
-      }
-      HASH_GUARD(0x459330C31956A5F4LL, vsprintf) {
-        ci = &ci_vsprintf;
-        return true;
-      }
-      break;
-    case 1527:
-      HASH_GUARD(0x18E4CC945005E5F7LL, drawpushclippath) {
-        ci = &ci_drawpushclippath;
-        return true;
-      }
-      break;
-    case 1531:
-      HASH_GUARD(0x3535B6615F2B05FBLL, session_cache_limiter) {
-        ci = &ci_session_cache_limiter;
-        return true;
-      }
-      break;
-    case 1533:
-      HASH_GUARD(0x0C1CB24A3FC065FDLL, bcmul) {
-        ci = &ci_bcmul;
-        return true;
-      }
-      HASH_GUARD(0x46832743CAF5C5FDLL, dom_element_set_attribute_node) {
-        ci = &ci_dom_element_set_attribute_node;
-        return true;
-      }
-      break;
-    case 1537:
-      HASH_GUARD(0x0F3403D8676C2601LL, mysql_query) {
-        ci = &ci_mysql_query;
-        return true;
-      }
-      break;
-    case 1545:
-      HASH_GUARD(0x52D5698F31D12609LL, pcntl_setpriority) {
-        ci = &ci_pcntl_setpriority;
-        return true;
-      }
-      break;
-    case 1555:
-      HASH_GUARD(0x36783304F63C4613LL, sscanf) {
-        ci = &ci_sscanf;
-        return true;
-      }
-      HASH_GUARD(0x4AC405EA2B8C4613LL, magickresetiterator) {
-        ci = &ci_magickresetiterator;
-        return true;
-      }
-      break;
-    case 1558:
-      HASH_GUARD(0x66C7616225F1C616LL, pixelsetgreen) {
-        ci = &ci_pixelsetgreen;
-        return true;
-      }
-      HASH_GUARD(0x7FA6D13B0D38E616LL, imagegif) {
-        ci = &ci_imagegif;
-        return true;
-      }
-      break;
-    case 1563:
-      HASH_GUARD(0x40DDE277D934061BLL, gzputs) {
-        ci = &ci_gzputs;
-        return true;
-      }
-      break;
-    case 1565:
-      HASH_GUARD(0x7E98B97C1B5D861DLL, magickqueryconfigureoptions) {
-        ci = &ci_magickqueryconfigureoptions;
-        return true;
-      }
-      break;
-    case 1570:
-      HASH_GUARD(0x134550B9EB596622LL, drawgetfontstyle) {
-        ci = &ci_drawgetfontstyle;
-        return true;
-      }
-      break;
-    case 1577:
-      HASH_GUARD(0x679B81CE06EE0629LL, bcdiv) {
-        ci = &ci_bcdiv;
-        return true;
-      }
-      break;
-    case 1578:
-      HASH_GUARD(0x608EA42B08A7462ALL, linkinfo) {
-        ci = &ci_linkinfo;
-        return true;
-      }
-      break;
-    case 1585:
-      HASH_GUARD(0x5AD6595ACA656631LL, pixelresetiterator) {
-        ci = &ci_pixelresetiterator;
-        return true;
-      }
-      break;
-    case 1595:
-      HASH_GUARD(0x391C68F2BE85E63BLL, pixelgetiteratorexceptionstring) {
-        ci = &ci_pixelgetiteratorexceptionstring;
-        return true;
-      }
-      break;
-    case 1596:
-      HASH_GUARD(0x62DE03461EF4663CLL, symlink) {
-        ci = &ci_symlink;
-        return true;
-      }
-      break;
-    case 1606:
-      HASH_GUARD(0x234F6A0A486E8646LL, natcasesort) {
-        ci = &ci_natcasesort;
-        return true;
-      }
-      break;
-    case 1614:
-      HASH_GUARD(0x7E978C38D741664ELL, fgetcsv) {
-        ci = &ci_fgetcsv;
-        return true;
-      }
-      break;
-    case 1618:
-      HASH_GUARD(0x03066277F647E652LL, hphp_splfileobject_ftell) {
-        ci = &ci_hphp_splfileobject_ftell;
-        return true;
-      }
-      break;
-    case 1623:
-      HASH_GUARD(0x33CBF1153473A657LL, imap_base64) {
-        ci = &ci_imap_base64;
-        return true;
-      }
-      break;
-    case 1625:
-      HASH_GUARD(0x7A4B37C23D674659LL, collator_get_error_message) {
-        ci = &ci_collator_get_error_message;
-        return true;
-      }
-      break;
-    case 1628:
-      HASH_GUARD(0x381BBFEABFEC865CLL, libxml_get_last_error) {
-        ci = &ci_libxml_get_last_error;
-        return true;
-      }
-      break;
-    case 1630:
-      HASH_GUARD(0x1491ED033E39465ELL, dom_document_schema_validate_xml) {
-        ci = &ci_dom_document_schema_validate_xml;
-        return true;
-      }
-      break;
-    case 1636:
-      HASH_GUARD(0x5B0759F776EC2664LL, newdrawingwand) {
-        ci = &ci_newdrawingwand;
-        return true;
-      }
-      break;
-    case 1637:
-      HASH_GUARD(0x08A6AD20C2C5A665LL, hphp_set_static_property) {
-        ci = &ci_hphp_set_static_property;
-        return true;
-      }
-      break;
-    case 1639:
-      HASH_GUARD(0x557A08AC57724667LL, hphp_splfileinfo_getpathinfo) {
-        ci = &ci_hphp_splfileinfo_getpathinfo;
-        return true;
-      }
-      break;
-    case 1647:
-      HASH_GUARD(0x7D68CADB8069466FLL, magickaverageimages) {
-        ci = &ci_magickaverageimages;
-        return true;
-      }
-      break;
-    case 1658:
-      HASH_GUARD(0x583AA7498A40E67ALL, drawgetcliprule) {
-        ci = &ci_drawgetcliprule;
-        return true;
-      }
-      break;
-    case 1661:
-      HASH_GUARD(0x111DACCF8628267DLL, array_replace_recursive) {
-        ci = &ci_array_replace_recursive;
-        return true;
-      }
-      break;
-    case 1666:
-      HASH_GUARD(0x665D2615E377A682LL, pagelet_server_task_start) {
-        ci = &ci_pagelet_server_task_start;
-        return true;
-      }
-      break;
-    case 1680:
-      HASH_GUARD(0x166D5E2336878690LL, imagepolygon) {
-        ci = &ci_imagepolygon;
-        return true;
-      }
-      break;
-    case 1681:
-      HASH_GUARD(0x57BA0BC1A4870691LL, magickgetquantumdepth) {
-        ci = &ci_magickgetquantumdepth;
-        return true;
-      }
-      break;
-    case 1682:
-      HASH_GUARD(0x16BE0DBA42800692LL, magickgetimagesize) {
-        ci = &ci_magickgetimagesize;
-        return true;
-      }
-      break;
-    case 1684:
-      HASH_GUARD(0x2673FAB2B4DE4694LL, destroypixelwands) {
-        ci = &ci_destroypixelwands;
-        return true;
-      }
-      break;
-    case 1690:
-      HASH_GUARD(0x5CC40F6A365FE69ALL, session_register) {
-        ci = &ci_session_register;
-        return true;
-      }
-      break;
-    case 1691:
-      HASH_GUARD(0x24D34E49C21DE69BLL, mb_stristr) {
-        ci = &ci_mb_stristr;
-        return true;
-      }
-      break;
-    case 1694:
-      HASH_GUARD(0x5E9821F06711669ELL, gethostbynamel) {
-        ci = &ci_gethostbynamel;
-        return true;
-      }
-      break;
-    case 1702:
-      HASH_GUARD(0x0D841874977646A6LL, krsort) {
-        ci = &ci_krsort;
-        return true;
-      }
-      break;
-    case 1704:
-      HASH_GUARD(0x45AB8F419BA666A8LL, drawpathlinetohorizontalabsolute) {
-        ci = &ci_drawpathlinetohorizontalabsolute;
-        return true;
-      }
-      break;
-    case 1706:
-      HASH_GUARD(0x541926FB6D6FC6AALL, magickgetimagecolors) {
-        ci = &ci_magickgetimagecolors;
-        return true;
-      }
-      break;
-    case 1712:
-      HASH_GUARD(0x23AAF570C78AC6B0LL, ip2long) {
-        ci = &ci_ip2long;
-        return true;
-      }
-      break;
-    case 1714:
-      HASH_GUARD(0x0D669C546C0EC6B2LL, proc_terminate) {
-        ci = &ci_proc_terminate;
-        return true;
-      }
-      break;
-    case 1717:
-      HASH_GUARD(0x623CE67C41A9E6B5LL, ldap_next_attribute) {
-        ci = &ci_ldap_next_attribute;
-        return true;
-      }
-      break;
-    case 1718:
-      HASH_GUARD(0x0553DE5D0C70C6B6LL, imap_headers) {
-        ci = &ci_imap_headers;
-        return true;
-      }
-      break;
-    case 1719:
-      HASH_GUARD(0x0C44E5EEB9C646B7LL, memcache_connect) {
-        ci = &ci_memcache_connect;
-        return true;
-      }
-      break;
-    case 1721:
-      HASH_GUARD(0x316F054CB76446B9LL, openssl_sign) {
-        ci = &ci_openssl_sign;
-        return true;
-      }
-      break;
-    case 1722:
-      HASH_GUARD(0x4605D48C234606BALL, dom_document_import_node) {
-        ci = &ci_dom_document_import_node;
-        return true;
-      }
-      break;
-    case 1732:
-      HASH_GUARD(0x4842AF70A71BE6C4LL, uksort) {
-        ci = &ci_uksort;
-        return true;
-      }
-      HASH_GUARD(0x34184B42D6AA86C4LL, mb_ereg_search_pos) {
-        ci = &ci_mb_ereg_search_pos;
-        return true;
-      }
-      HASH_GUARD(0x3C042C09F662C6C4LL, drawsetstrokepatternurl) {
-        ci = &ci_drawsetstrokepatternurl;
-        return true;
-      }
-      break;
-    case 1736:
-      HASH_GUARD(0x29DD2C9F889246C8LL, passthru) {
-        ci = &ci_passthru;
-        return true;
-      }
-      break;
-    case 1737:
-      HASH_GUARD(0x2D8DF100C30D06C9LL, xmlwriter_set_indent_string) {
-        ci = &ci_xmlwriter_set_indent_string;
-        return true;
-      }
-      break;
-    case 1750:
-      HASH_GUARD(0x158348EB08F406D6LL, strtr) {
-        ci = &ci_strtr;
-        return true;
-      }
-      break;
-    case 1764:
-      HASH_GUARD(0x40D0E3AF799226E4LL, bin2hex) {
-        ci = &ci_bin2hex;
-        return true;
-      }
-      break;
-    case 1772:
-      HASH_GUARD(0x0A5EFECAE87EA6ECLL, hphp_splfileobject_eof) {
-        ci = &ci_hphp_splfileobject_eof;
-        return true;
-      }
-      break;
-    case 1773:
-      HASH_GUARD(0x2B661CD43C6006EDLL, hphpd_break) {
-        ci = &ci_hphpd_break;
-        return true;
-      }
-      break;
-    case 1775:
-      HASH_GUARD(0x0FA74D85885F86EFLL, output_add_rewrite_var) {
-        ci = &ci_output_add_rewrite_var;
-        return true;
-      }
-      break;
-    case 1777:
-      HASH_GUARD(0x6B7347DF1AA7E6F1LL, drawpopdefs) {
-        ci = &ci_drawpopdefs;
-        return true;
-      }
-      break;
-    case 1778:
-      HASH_GUARD(0x314DA880FE2CE6F2LL, session_start) {
-        ci = &ci_session_start;
-        return true;
-      }
-      break;
-    case 1779:
-      HASH_GUARD(0x5768A80BB0B926F3LL, apd_set_session_trace_socket) {
-        ci = &ci_apd_set_session_trace_socket;
-        return true;
-      }
-      break;
-    case 1782:
-      HASH_GUARD(0x534C1A5E626C26F6LL, collator_get_error_code) {
-        ci = &ci_collator_get_error_code;
-        return true;
-      }
-      break;
-    case 1791:
-      HASH_GUARD(0x623C20A027A606FFLL, array_uintersect_uassoc) {
-        ci = &ci_array_uintersect_uassoc;
-        return true;
-      }
-      break;
-    case 1801:
-      HASH_GUARD(0x7681C631B34CC709LL, hphp_splfileobject_fflush) {
-        ci = &ci_hphp_splfileobject_fflush;
-        return true;
-      }
-      HASH_GUARD(0x21972B2BC7A14709LL, imageistruecolor) {
-        ci = &ci_imageistruecolor;
-        return true;
-      }
-      break;
-    case 1803:
-      HASH_GUARD(0x5F7873F2DF5BE70BLL, ctype_cntrl) {
-        ci = &ci_ctype_cntrl;
-        return true;
-      }
-      break;
-    case 1807:
-      HASH_GUARD(0x2FB2FA1DD832C70FLL, xmlwriter_write_attribute_ns) {
-        ci = &ci_xmlwriter_write_attribute_ns;
-        return true;
-      }
-      break;
-    case 1819:
-      HASH_GUARD(0x3C16230CBC6D471BLL, imagecreatetruecolor) {
-        ci = &ci_imagecreatetruecolor;
-        return true;
-      }
-      break;
-    case 1820:
-      HASH_GUARD(0x50AC61A28C5AC71CLL, imagecolorclosestalpha) {
-        ci = &ci_imagecolorclosestalpha;
-        return true;
-      }
-      break;
-    case 1827:
-      HASH_GUARD(0x78420E0B5D110723LL, imagetruecolortopalette) {
-        ci = &ci_imagetruecolortopalette;
-        return true;
-      }
-      break;
-    case 1828:
-      HASH_GUARD(0x4DAA3FBC2BD3A724LL, magickequalizeimage) {
-        ci = &ci_magickequalizeimage;
-        return true;
-      }
-      break;
-    case 1829:
-      HASH_GUARD(0x31EAD049860CE725LL, posix_kill) {
-        ci = &ci_posix_kill;
-        return true;
-      }
-      break;
-    case 1834:
-      HASH_GUARD(0x17C0D9B1C10B872ALL, openssl_x509_export) {
-        ci = &ci_openssl_x509_export;
-        return true;
-      }
-      HASH_GUARD(0x1F98B41362CDA72ALL, magickgetimagegreenprimary) {
-        ci = &ci_magickgetimagegreenprimary;
-        return true;
-      }
-      break;
-    case 1840:
-      HASH_GUARD(0x0D558F552A784730LL, ob_get_contents) {
-        ci = &ci_ob_get_contents;
-        return true;
-      }
-      break;
-    case 1842:
-      HASH_GUARD(0x2B1C192C419B8732LL, drawgetexception) {
-        ci = &ci_drawgetexception;
-        return true;
-      }
-      break;
-    case 1855:
-      HASH_GUARD(0x650E641CC0E3873FLL, connection_aborted) {
-        ci = &ci_connection_aborted;
-        return true;
-      }
-      break;
-    case 1863:
-      HASH_GUARD(0x3CD58419E181A747LL, magickstereoimage) {
-        ci = &ci_magickstereoimage;
-        return true;
-      }
-      HASH_GUARD(0x13BB9EC5A2D2E747LL, hphp_splfileinfo_isdir) {
-        ci = &ci_hphp_splfileinfo_isdir;
-        return true;
-      }
-      break;
-    case 1864:
-      HASH_GUARD(0x0D7BBA9608A36748LL, magickcombineimages) {
-        ci = &ci_magickcombineimages;
-        return true;
-      }
-      break;
-    case 1875:
-      HASH_GUARD(0x42795829DF700753LL, mysql_get_host_info) {
-        ci = &ci_mysql_get_host_info;
-        return true;
-      }
-      break;
-    case 1876:
-      HASH_GUARD(0x53AEFD595C044754LL, max) {
-        ci = &ci_max;
-        return true;
-      }
-      break;
-    case 1879:
-      HASH_GUARD(0x7554E3E8674F2757LL, mb_list_encodings) {
-        ci = &ci_mb_list_encodings;
-        return true;
-      }
-      break;
-    case 1887:
-      HASH_GUARD(0x3EDB48C5DDD9675FLL, socket_select) {
-        ci = &ci_socket_select;
-        return true;
-      }
-      break;
-    case 1888:
-      HASH_GUARD(0x1BD984C11BB16760LL, array_merge) {
-        ci = &ci_array_merge;
-        return true;
-      }
-      HASH_GUARD(0x7AB5E6EA37196760LL, date_timezone_set) {
-        ci = &ci_date_timezone_set;
-        return true;
-      }
-      break;
-    case 1889:
-      HASH_GUARD(0x6AF50085AC2AC761LL, xmlwriter_write_element) {
-        ci = &ci_xmlwriter_write_element;
-        return true;
-      }
-      break;
-    case 1891:
-      HASH_GUARD(0x7FCE6DD53FED6763LL, intl_is_failure) {
-        ci = &ci_intl_is_failure;
-        return true;
-      }
-      HASH_GUARD(0x19DCB392D4686763LL, hphp_get_timers) {
-        ci = &ci_hphp_get_timers;
-        return true;
-      }
-      break;
-    case 1895:
-      HASH_GUARD(0x2FC27987B3F88767LL, dom_node_clone_node) {
-        ci = &ci_dom_node_clone_node;
-        return true;
-      }
-      HASH_GUARD(0x6C280D5855D20767LL, drawsetfillalpha) {
-        ci = &ci_drawsetfillalpha;
-        return true;
-      }
-      break;
-    case 1896:
-      HASH_GUARD(0x179A72074C778768LL, openssl_x509_export_to_file) {
-        ci = &ci_openssl_x509_export_to_file;
-        return true;
-      }
-      break;
-    case 1904:
-      HASH_GUARD(0x6F6C5B9E3DC64770LL, drawgetstrokemiterlimit) {
-        ci = &ci_drawgetstrokemiterlimit;
-        return true;
-      }
-      break;
-    case 1910:
-      HASH_GUARD(0x616DDB67073A0776LL, ord) {
-        ci = &ci_ord;
-        return true;
-      }
-      break;
-    case 1914:
-      HASH_GUARD(0x1FBF36B5D65E677ALL, fb_call_user_func_safe_return) {
-        ci = &ci_fb_call_user_func_safe_return;
-        return true;
-      }
-      HASH_GUARD(0x4330CE9C9002477ALL, array_udiff_uassoc) {
-        ci = &ci_array_udiff_uassoc;
-        return true;
-      }
-      break;
-    case 1920:
-      HASH_GUARD(0x29824AAA934CE780LL, array_filter) {
-        ci = &ci_array_filter;
-        return true;
-      }
-      break;
-    case 1923:
-      HASH_GUARD(0x53B4DBE58B356783LL, imagesetthickness) {
-        ci = &ci_imagesetthickness;
-        return true;
-      }
-      break;
-    case 1930:
-      HASH_GUARD(0x70A1EC006032E78ALL, pixelgetquantumcolor) {
-        ci = &ci_pixelgetquantumcolor;
-        return true;
-      }
-      break;
-    case 1935:
-      HASH_GUARD(0x7B4E25772D0AC78FLL, simplexml_load_file) {
-        ci = &ci_simplexml_load_file;
-        return true;
-      }
-      break;
-    case 1938:
-      HASH_GUARD(0x0D4891A5E1A20792LL, get_defined_functions) {
-        ci = &ci_get_defined_functions;
-        return true;
-      }
-      break;
-    case 1940:
-      HASH_GUARD(0x66ECE26DDCC12794LL, imap_fetchheader) {
-        ci = &ci_imap_fetchheader;
-        return true;
-      }
-      break;
-    case 1941:
-      HASH_GUARD(0x34BA3AAA6711C795LL, dom_document_create_entity_reference) {
-        ci = &ci_dom_document_create_entity_reference;
-        return true;
-      }
-      break;
-    case 1945:
-      HASH_GUARD(0x26D226FD28566799LL, date_isodate_set) {
-        ci = &ci_date_isodate_set;
-        return true;
-      }
-      break;
-    case 1959:
-      HASH_GUARD(0x1F76E954F9A147A7LL, magickcontrastimage) {
-        ci = &ci_magickcontrastimage;
-        return true;
-      }
-      break;
-    case 1961:
-      HASH_GUARD(0x7C251B7DE8DB87A9LL, mcrypt_list_algorithms) {
-        ci = &ci_mcrypt_list_algorithms;
-        return true;
-      }
-      break;
-    case 1962:
-      HASH_GUARD(0x45A53A884414A7AALL, pack) {
-        ci = &ci_pack;
-        return true;
-      }
-      HASH_GUARD(0x58D6464A3A9127AALL, apc_bin_loadfile) {
-        ci = &ci_apc_bin_loadfile;
-        return true;
-      }
-      break;
-    case 1977:
-      HASH_GUARD(0x1B6467AD87E167B9LL, log1p) {
-        ci = &ci_log1p;
-        return true;
-      }
-      break;
-    case 1983:
-      HASH_GUARD(0x3F46374E6E1B07BFLL, posix_getpwuid) {
-        ci = &ci_posix_getpwuid;
-        return true;
-      }
-      break;
-    case 1984:
-      HASH_GUARD(0x152D1AB941A647C0LL, hphp_get_extension_info) {
-        ci = &ci_hphp_get_extension_info;
-        return true;
-      }
-      HASH_GUARD(0x52FDAC1D298D67C0LL, mcrypt_enc_get_algorithms_name) {
-        ci = &ci_mcrypt_enc_get_algorithms_name;
-        return true;
-      }
-      break;
-    case 1988:
-      HASH_GUARD(0x3C696836396BE7C4LL, mb_language) {
-        ci = &ci_mb_language;
-        return true;
-      }
-      break;
-    case 1990:
-      HASH_GUARD(0x3D6D684AF537A7C6LL, ldap_explode_dn) {
-        ci = &ci_ldap_explode_dn;
-        return true;
-      }
-      break;
-    case 1994:
-      HASH_GUARD(0x3C781898488687CALL, xml_parse) {
-        ci = &ci_xml_parse;
-        return true;
-      }
-      HASH_GUARD(0x55B68546CFAC87CALL, magicksetimageresolution) {
-        ci = &ci_magicksetimageresolution;
-        return true;
-      }
-      break;
-    case 1997:
-      HASH_GUARD(0x4C19B770DFFFE7CDLL, imap_listmailbox) {
-        ci = &ci_imap_listmailbox;
-        return true;
-      }
-      break;
-    case 1998:
-      HASH_GUARD(0x3AE33FEA6830C7CELL, magickshearimage) {
-        ci = &ci_magickshearimage;
-        return true;
-      }
-      break;
-    case 1999:
-      HASH_GUARD(0x2FAB1F75659707CFLL, is_scalar) {
-        ci = &ci_is_scalar;
-        return true;
-      }
-      break;
-    case 2009:
-      HASH_GUARD(0x2ED6760DAA3A67D9LL, strcasecmp) {
-        ci = &ci_strcasecmp;
-        return true;
-      }
-      break;
-    case 2012:
-      HASH_GUARD(0x1FE65AFCC92967DCLL, rmdir) {
-        ci = &ci_rmdir;
-        return true;
-      }
-      break;
-    case 2013:
-      HASH_GUARD(0x2B5AEDF1A5FC47DDLL, strripos) {
-        ci = &ci_strripos;
-        return true;
-      }
-      break;
-    case 2017:
-      HASH_GUARD(0x7AA1691D3D94A7E1LL, dom_xpath_evaluate) {
-        ci = &ci_dom_xpath_evaluate;
-        return true;
-      }
-      break;
-    case 2018:
-      HASH_GUARD(0x0888289CBD2887E2LL, iconv_substr) {
-        ci = &ci_iconv_substr;
-        return true;
-      }
-      break;
-    case 2024:
-      HASH_GUARD(0x53B7BF8991FA67E8LL, i18n_loc_get_error_code) {
-        ci = &ci_i18n_loc_get_error_code;
-        return true;
-      }
-      break;
-    case 2025:
-      HASH_GUARD(0x6BB8AC68771287E9LL, strcmp) {
-        ci = &ci_strcmp;
-        return true;
-      }
-      break;
-    case 2027:
-      HASH_GUARD(0x54AE7140B95027EBLL, pixelgetgreenquantum) {
-        ci = &ci_pixelgetgreenquantum;
-        return true;
-      }
-      HASH_GUARD(0x1A397501431EC7EBLL, is_numeric) {
-        ci = &ci_is_numeric;
-        return true;
-      }
-      break;
-    case 2035:
-      HASH_GUARD(0x4B57E07A323FE7F3LL, drawpathlinetoverticalabsolute) {
-        ci = &ci_drawpathlinetoverticalabsolute;
-        return true;
-      }
-      break;
-    case 2041:
-      HASH_GUARD(0x376FB2649384A7F9LL, str_pad) {
-        ci = &ci_str_pad;
-        return true;
-      }
-      break;
-    case 2042:
-      HASH_GUARD(0x0FD7C3144B4007FALL, libxml_set_streams_context) {
-        ci = &ci_libxml_set_streams_context;
-        return true;
-      }
-      break;
-    case 2045:
-      HASH_GUARD(0x238E501F2536E7FDLL, drawsetclippath) {
-        ci = &ci_drawsetclippath;
-        return true;
-      }
-      break;
-    case 2048:
-      HASH_GUARD(0x0E66983DD04B0800LL, get_current_user) {
-        ci = &ci_get_current_user;
-        return true;
-      }
-      break;
-    case 2049:
-      HASH_GUARD(0x290E54137CF06801LL, dom_nodelist_item) {
-        ci = &ci_dom_nodelist_item;
-        return true;
-      }
-      break;
-    case 2052:
-      HASH_GUARD(0x349A0DF6723B6804LL, pixelsetcolorcount) {
-        ci = &ci_pixelsetcolorcount;
-        return true;
-      }
-      break;
-    case 2056:
-      HASH_GUARD(0x19279D6DB4F70808LL, hash_hmac) {
-        ci = &ci_hash_hmac;
-        return true;
-      }
-      break;
-    case 2060:
-      HASH_GUARD(0x3FF63423EC4B280CLL, posix_getegid) {
-        ci = &ci_posix_getegid;
-        return true;
-      }
-      break;
-    case 2061:
-      HASH_GUARD(0x11EC19E702F2C80DLL, getmyinode) {
-        ci = &ci_getmyinode;
-        return true;
-      }
-      break;
-    case 2064:
-      HASH_GUARD(0x4297B1072CE76810LL, fb_call_user_func_array_safe) {
-        ci = &ci_fb_call_user_func_array_safe;
-        return true;
-      }
-      break;
-    case 2067:
-      HASH_GUARD(0x1A6B577442218813LL, pixelsetmagentaquantum) {
-        ci = &ci_pixelsetmagentaquantum;
-        return true;
-      }
-      break;
-    case 2081:
-      HASH_GUARD(0x2D52FB9B52EC2821LL, xml_set_notation_decl_handler) {
-        ci = &ci_xml_set_notation_decl_handler;
-        return true;
-      }
-      break;
-    case 2082:
-      HASH_GUARD(0x13C241C02DE72822LL, dom_document_relaxng_validate_xml) {
-        ci = &ci_dom_document_relaxng_validate_xml;
-        return true;
-      }
-      break;
-    case 2084:
-      HASH_GUARD(0x2B78E204F615A824LL, openssl_pkcs12_export_to_file) {
-        ci = &ci_openssl_pkcs12_export_to_file;
-        return true;
-      }
-      break;
-    case 2087:
-      HASH_GUARD(0x33EC567341B9C827LL, magickgetmaxtextadvance) {
-        ci = &ci_magickgetmaxtextadvance;
-        return true;
-      }
-      break;
-    case 2089:
-      HASH_GUARD(0x39EE4CCCA716E829LL, stream_context_get_options) {
-        ci = &ci_stream_context_get_options;
-        return true;
-      }
-      break;
-    case 2092:
-      HASH_GUARD(0x34F0E032AB05C82CLL, pixelsetblue) {
-        ci = &ci_pixelsetblue;
-        return true;
-      }
-      break;
-    case 2093:
-      HASH_GUARD(0x1C4AE57BF4E4A82DLL, apc_dec) {
-        ci = &ci_apc_dec;
-        return true;
-      }
-      break;
-    case 2095:
-      HASH_GUARD(0x79A05154A7F5482FLL, magickgetimagedelay) {
-        ci = &ci_magickgetimagedelay;
-        return true;
-      }
-      break;
-    case 2104:
-      HASH_GUARD(0x63E554E0F11CE838LL, mysql_unbuffered_query) {
-        ci = &ci_mysql_unbuffered_query;
-        return true;
-      }
-      HASH_GUARD(0x0890F9052322E838LL, fstat) {
-        ci = &ci_fstat;
-        return true;
-      }
-      break;
-    case 2115:
-      HASH_GUARD(0x567A7139AD476843LL, socket_listen) {
-        ci = &ci_socket_listen;
-        return true;
-      }
-      break;
-    case 2118:
-      HASH_GUARD(0x50088ED5D482C846LL, ldap_mod_add) {
-        ci = &ci_ldap_mod_add;
-        return true;
-      }
-      break;
-    case 2119:
-      HASH_GUARD(0x4E69A952E3EA4847LL, magicksetfilename) {
-        ci = &ci_magicksetfilename;
-        return true;
-      }
-      break;
-    case 2122:
-      HASH_GUARD(0x7D3F626E636C084ALL, ldap_delete) {
-        ci = &ci_ldap_delete;
-        return true;
-      }
-      break;
-    case 2123:
-      HASH_GUARD(0x68B7597C22FA484BLL, openssl_public_encrypt) {
-        ci = &ci_openssl_public_encrypt;
-        return true;
-      }
-      break;
-    case 2126:
-      HASH_GUARD(0x488C2F267BF2884ELL, array_intersect) {
-        ci = &ci_array_intersect;
-        return true;
-      }
-      break;
-    case 2127:
-      HASH_GUARD(0x632D491E42E7E84FLL, session_get_cookie_params) {
-        ci = &ci_session_get_cookie_params;
-        return true;
-      }
-      break;
-    case 2128:
-      HASH_GUARD(0x4DDB82A3632FA850LL, atan) {
-        ci = &ci_atan;
-        return true;
-      }
-      break;
-    case 2140:
-      HASH_GUARD(0x5A017A4C6A41E85CLL, curl_multi_add_handle) {
-        ci = &ci_curl_multi_add_handle;
-        return true;
-      }
-      break;
-    case 2142:
-      HASH_GUARD(0x6B4DE6865142285ELL, destroypixeliterator) {
-        ci = &ci_destroypixeliterator;
-        return true;
-      }
-      break;
-    case 2148:
-      HASH_GUARD(0x168EDA8238EEE864LL, mb_detect_order) {
-        ci = &ci_mb_detect_order;
-        return true;
-      }
-      break;
-    case 2152:
-      HASH_GUARD(0x785C812E6292E868LL, i18n_loc_set_default) {
-        ci = &ci_i18n_loc_set_default;
-        return true;
-      }
-      break;
-    case 2155:
-      HASH_GUARD(0x0C1BBEDECEF1C86BLL, newmagickwand) {
-        ci = &ci_newmagickwand;
-        return true;
-      }
-      break;
-    case 2156:
-      HASH_GUARD(0x6414504A6658286CLL, stripos) {
-        ci = &ci_stripos;
-        return true;
-      }
-      break;
-    case 2159:
-      HASH_GUARD(0x1476A177CC50686FLL, mb_strstr) {
-        ci = &ci_mb_strstr;
-        return true;
-      }
-      break;
-    case 2160:
-      HASH_GUARD(0x34F50577C14C6870LL, array_diff_uassoc) {
-        ci = &ci_array_diff_uassoc;
-        return true;
-      }
-      break;
-    case 2162:
-      HASH_GUARD(0x3C7B86F57AFA0872LL, hebrev) {
-        ci = &ci_hebrev;
-        return true;
-      }
-      HASH_GUARD(0x558D62FBEB210872LL, str_rot13) {
-        ci = &ci_str_rot13;
-        return true;
-      }
-      break;
-    case 2163:
-      HASH_GUARD(0x4C06B4AFC1C08873LL, str_shuffle) {
-        ci = &ci_str_shuffle;
-        return true;
-      }
-      break;
-    case 2173:
-      HASH_GUARD(0x54F84DC9A334287DLL, gzencode) {
-        ci = &ci_gzencode;
-        return true;
-      }
-      HASH_GUARD(0x2B36081E0828487DLL, debug_print_backtrace) {
-        ci = &ci_debug_print_backtrace;
-        return true;
-      }
-      break;
-    case 2179:
-      HASH_GUARD(0x3EBD8F559B4EA883LL, hphp_splfileobject_getflags) {
-        ci = &ci_hphp_splfileobject_getflags;
-        return true;
-      }
-      break;
-    case 2180:
-      HASH_GUARD(0x766CD15A7F2A0884LL, array_uintersect) {
-        ci = &ci_array_uintersect;
-        return true;
-      }
-      break;
-    case 2191:
-      HASH_GUARD(0x539868C56806688FLL, imagecopyresampled) {
-        ci = &ci_imagecopyresampled;
-        return true;
-      }
-      break;
-    case 2200:
-      HASH_GUARD(0x4AC522FF7BB60898LL, xmlwriter_write_dtd_entity) {
-        ci = &ci_xmlwriter_write_dtd_entity;
-        return true;
-      }
-      break;
-    case 2208:
-      HASH_GUARD(0x6B1A3BCE67BAC8A0LL, openssl_csr_new) {
-        ci = &ci_openssl_csr_new;
-        return true;
-      }
-      break;
-    case 2220:
-      HASH_GUARD(0x1EFFE951E79348ACLL, imap_expunge) {
-        ci = &ci_imap_expunge;
-        return true;
-      }
-      break;
-    case 2226:
-      HASH_GUARD(0x31830AA5032428B2LL, is_double) {
-        ci = &ci_is_double;
-        return true;
-      }
-      break;
-    case 2234:
-      HASH_GUARD(0x28D343EC901608BALL, imap_listsubscribed) {
-        ci = &ci_imap_listsubscribed;
-        return true;
-      }
-      break;
-    case 2236:
-      HASH_GUARD(0x7AE3AE9B634988BCLL, stream_context_create) {
-        ci = &ci_stream_context_create;
-        return true;
-      }
-      break;
-    case 2244:
-      HASH_GUARD(0x5C28BE7FFE6A68C4LL, xml_set_start_namespace_decl_handler) {
-        ci = &ci_xml_set_start_namespace_decl_handler;
-        return true;
-      }
-      break;
-    case 2245:
-      HASH_GUARD(0x146A1A7658CCA8C5LL, asinh) {
-        ci = &ci_asinh;
-        return true;
-      }
-      break;
-    case 2247:
-      HASH_GUARD(0x4623383F8534E8C7LL, array_multisort) {
-        ci = &ci_array_multisort;
-        return true;
-      }
-      HASH_GUARD(0x6D9B9BE3CED388C7LL, apc_load_constants) {
-        ci = &ci_apc_load_constants;
-        return true;
-      }
-      break;
-    case 2254:
-      HASH_GUARD(0x3FFAA982E4B1E8CELL, date_offset_get) {
-        ci = &ci_date_offset_get;
-        return true;
-      }
-      break;
-    case 2258:
-      HASH_GUARD(0x74EB6C564ABC68D2LL, dom_document_create_text_node) {
-        ci = &ci_dom_document_create_text_node;
-        return true;
-      }
-      break;
-    case 2260:
-      HASH_GUARD(0x6DB4EE8696C7E8D4LL, magicksetimageiterations) {
-        ci = &ci_magicksetimageiterations;
-        return true;
-      }
-      break;
-    case 2262:
-      HASH_GUARD(0x2F585B36DDDB68D6LL, mb_convert_case) {
-        ci = &ci_mb_convert_case;
-        return true;
-      }
-      HASH_GUARD(0x26DC8AB4A9CBE8D6LL, iconv) {
-        ci = &ci_iconv;
-        return true;
-      }
-      break;
-    case 2264:
-      HASH_GUARD(0x69FB5DBA88A308D8LL, imap_8bit) {
-        ci = &ci_imap_8bit;
-        return true;
-      }
-      HASH_GUARD(0x3A65182A3E8908D8LL, openssl_open) {
-        ci = &ci_openssl_open;
-        return true;
-      }
-      break;
-    case 2265:
-      HASH_GUARD(0x18B64D6BFE4208D9LL, stream_get_transports) {
-        ci = &ci_stream_get_transports;
-        return true;
-      }
-      break;
-    case 2268:
-      HASH_GUARD(0x31F50FDA18B888DCLL, magickgetimagetype) {
-        ci = &ci_magickgetimagetype;
-        return true;
-      }
-      break;
-    case 2276:
-      HASH_GUARD(0x16A18007E10F48E4LL, socket_getsockname) {
-        ci = &ci_socket_getsockname;
-        return true;
-      }
-      break;
-    case 2278:
-      HASH_GUARD(0x69887F054A1E28E6LL, strtok) {
-        ci = &ci_strtok;
-        return true;
-      }
-      break;
-    case 2279:
-      HASH_GUARD(0x608729F27FA428E7LL, error_get_last) {
-        ci = &ci_error_get_last;
-        return true;
-      }
-      break;
-    case 2295:
-      HASH_GUARD(0x17582BEA497D48F7LL, ctype_alpha) {
-        ci = &ci_ctype_alpha;
-        return true;
-      }
-      break;
-    case 2298:
-      HASH_GUARD(0x6F0F82818B68A8FALL, array_values) {
-        ci = &ci_array_values;
-        return true;
-      }
-      break;
-    case 2299:
-      HASH_GUARD(0x214532C4A2BC28FBLL, ldap_next_entry) {
-        ci = &ci_ldap_next_entry;
-        return true;
-      }
-      break;
-    case 2302:
-      HASH_GUARD(0x047BF4D3D0ED08FELL, strchr) {
-        ci = &ci_strchr;
-        return true;
-      }
-      break;
-    case 2315:
-      HASH_GUARD(0x2987B15E11FE890BLL, clock_settime) {
-        ci = &ci_clock_settime;
-        return true;
-      }
-      break;
-    case 2321:
-      HASH_GUARD(0x5B9B2C3B32906911LL, drawsetfillpatternurl) {
-        ci = &ci_drawsetfillpatternurl;
-        return true;
-      }
-      break;
-    case 2323:
-      HASH_GUARD(0x55757E1242390913LL, cos) {
-        ci = &ci_cos;
-        return true;
-      }
-      break;
-    case 2324:
-      HASH_GUARD(0x6E22C6D840B44914LL, mcrypt_generic_init) {
-        ci = &ci_mcrypt_generic_init;
-        return true;
-      }
-      break;
-    case 2331:
-      HASH_GUARD(0x37A3DF6E0795091BLL, memcache_increment) {
-        ci = &ci_memcache_increment;
-        return true;
-      }
-      break;
-    case 2333:
-      HASH_GUARD(0x069C028EFEF8C91DLL, date) {
-        ci = &ci_date;
-        return true;
-      }
-      break;
-    case 2337:
-      HASH_GUARD(0x0F5917FFCDD6C921LL, mb_substr) {
-        ci = &ci_mb_substr;
-        return true;
-      }
-      break;
-    case 2346:
-      HASH_GUARD(0x174C510386E6492ALL, hphp_directoryiterator_key) {
-        ci = &ci_hphp_directoryiterator_key;
-        return true;
-      }
-      break;
-    case 2350:
-      HASH_GUARD(0x26E8B741BDDDC92ELL, xmlwriter_start_element) {
-        ci = &ci_xmlwriter_start_element;
-        return true;
-      }
-      break;
-    case 2352:
-      HASH_GUARD(0x507CE1912FD74930LL, mail) {
-        ci = &ci_mail;
-        return true;
-      }
-      break;
-    case 2356:
-      HASH_GUARD(0x4FB95164A5F84934LL, mcrypt_generic_end) {
-        ci = &ci_mcrypt_generic_end;
-        return true;
-      }
-      break;
-    case 2357:
-      HASH_GUARD(0x46BD9A56BDE40935LL, mysql_escape_string) {
-        ci = &ci_mysql_escape_string;
-        return true;
-      }
-      break;
-    case 2361:
-      HASH_GUARD(0x5B60C8396C624939LL, mb_substitute_character) {
-        ci = &ci_mb_substitute_character;
-        return true;
-      }
-      break;
-    case 2366:
-      HASH_GUARD(0x0CADFE289C92893ELL, socket_getpeername) {
-        ci = &ci_socket_getpeername;
-        return true;
-      }
-      break;
-    case 2371:
-      HASH_GUARD(0x7C565AD57BC84943LL, pixelsetindex) {
-        ci = &ci_pixelsetindex;
-        return true;
-      }
-      break;
-    case 2373:
-      HASH_GUARD(0x7CB0596B6CCFA945LL, split) {
-        ci = &ci_split;
-        return true;
-      }
-      break;
-    case 2375:
-      HASH_GUARD(0x630288865DE68947LL, php_strip_whitespace) {
-        ci = &ci_php_strip_whitespace;
-        return true;
-      }
-      break;
-    case 2381:
-      HASH_GUARD(0x3D3AD12E52FF294DLL, imagecreatefromwbmp) {
-        ci = &ci_imagecreatefromwbmp;
-        return true;
-      }
-      break;
-    case 2391:
-      HASH_GUARD(0x253AC5D4E450A957LL, magickgetreleasedate) {
-        ci = &ci_magickgetreleasedate;
-        return true;
-      }
-      break;
-    case 2394:
-      HASH_GUARD(0x103C12985527295ALL, hphp_splfileobject_setcsvcontrol) {
-        ci = &ci_hphp_splfileobject_setcsvcontrol;
-        return true;
-      }
-      HASH_GUARD(0x7056E766A274895ALL, virtual) {
-        ci = &ci_virtual;
-        return true;
-      }
-      break;
-    case 2397:
-      HASH_GUARD(0x21DBCE74EB1FC95DLL, xmlwriter_text) {
-        ci = &ci_xmlwriter_text;
-        return true;
-      }
-      break;
-    case 2401:
-      HASH_GUARD(0x5EA7052A00E88961LL, magickgetcopyright) {
-        ci = &ci_magickgetcopyright;
-        return true;
-      }
-      break;
-    case 2407:
-      HASH_GUARD(0x1419B3BF428B2967LL, evhttp_async_post) {
-        ci = &ci_evhttp_async_post;
-        return true;
-      }
-      break;
-    case 2418:
-      HASH_GUARD(0x758263CEBF2E8972LL, assert_options) {
-        ci = &ci_assert_options;
-        return true;
-      }
-      break;
-    case 2421:
-      HASH_GUARD(0x7E26D48503362975LL, drawpathcurvetoabsolute) {
-        ci = &ci_drawpathcurvetoabsolute;
-        return true;
-      }
-      HASH_GUARD(0x488141281A75E975LL, imagecreatefromgif) {
-        ci = &ci_imagecreatefromgif;
-        return true;
-      }
-      break;
-    case 2423:
-      HASH_GUARD(0x0C16C797916C2977LL, posix_setegid) {
-        ci = &ci_posix_setegid;
-        return true;
-      }
-      break;
-    case 2430:
-      HASH_GUARD(0x5067A65AD1D0297ELL, pixelgetiteratorexception) {
-        ci = &ci_pixelgetiteratorexception;
-        return true;
-      }
-      break;
-    case 2438:
-      HASH_GUARD(0x6ECE4BDB8842E986LL, posix_strerror) {
-        ci = &ci_posix_strerror;
-        return true;
-      }
-      break;
-    case 2439:
-      HASH_GUARD(0x22B3CF8DD3D1A987LL, pixelsynciterator) {
-        ci = &ci_pixelsynciterator;
-        return true;
-      }
-      break;
-    case 2440:
-      HASH_GUARD(0x489355BDBE396988LL, drawsettextencoding) {
-        ci = &ci_drawsettextencoding;
-        return true;
-      }
-      break;
-    case 2441:
-      HASH_GUARD(0x60BF7CDD733A2989LL, bzerrstr) {
-        ci = &ci_bzerrstr;
-        return true;
-      }
-      break;
-    case 2446:
-      HASH_GUARD(0x333D4DFD4927898ELL, magickgetimagewhitepoint) {
-        ci = &ci_magickgetimagewhitepoint;
-        return true;
-      }
-      break;
-    case 2451:
-      HASH_GUARD(0x79AD7C6D77A3A993LL, imap_reopen) {
-        ci = &ci_imap_reopen;
-        return true;
-      }
-      break;
-    case 2456:
-      HASH_GUARD(0x501AAD31C8086998LL, posix_getcwd) {
-        ci = &ci_posix_getcwd;
-        return true;
-      }
-      break;
-    case 2459:
-      HASH_GUARD(0x564D8D3DA1E8E99BLL, xml_get_current_line_number) {
-        ci = &ci_xml_get_current_line_number;
-        return true;
-      }
-      break;
-    case 2464:
-      HASH_GUARD(0x047EF9173590C9A0LL, session_decode) {
-        ci = &ci_session_decode;
-        return true;
-      }
-      break;
-    case 2466:
-      HASH_GUARD(0x01D2367A02F0A9A2LL, magicksetsize) {
-        ci = &ci_magicksetsize;
-        return true;
-      }
-      break;
-    case 2467:
-      HASH_GUARD(0x43D1339C52E309A3LL, hphp_service_thread_started) {
-        ci = &ci_hphp_service_thread_started;
-        return true;
-      }
-      HASH_GUARD(0x78261FA60B8D89A3LL, imagepsloadfont) {
-        ci = &ci_imagepsloadfont;
-        return true;
-      }
-      break;
-    case 2469:
-      HASH_GUARD(0x76988956F35329A5LL, xmlwriter_end_cdata) {
-        ci = &ci_xmlwriter_end_cdata;
-        return true;
-      }
-      break;
-    case 2473:
-      HASH_GUARD(0x6F9CF95104CAE9A9LL, pixelgetyellowquantum) {
-        ci = &ci_pixelgetyellowquantum;
-        return true;
-      }
-      break;
-    case 2481:
-      HASH_GUARD(0x7C1CE38F14E529B1LL, date_default_timezone_set) {
-        ci = &ci_date_default_timezone_set;
-        return true;
-      }
-      break;
-    case 2482:
-      HASH_GUARD(0x65D7CBE8681CE9B2LL, gzgetss) {
-        ci = &ci_gzgetss;
-        return true;
-      }
-      break;
-    case 2492:
-      HASH_GUARD(0x7E7BF1BDA6DB49BCLL, hphp_splfileinfo_getgroup) {
-        ci = &ci_hphp_splfileinfo_getgroup;
-        return true;
-      }
-      HASH_GUARD(0x672DA903B52249BCLL, xhprof_frame_begin) {
-        ci = &ci_xhprof_frame_begin;
-        return true;
-      }
-      break;
-    case 2494:
-      HASH_GUARD(0x458B5ABEDAC1C9BELL, disk_free_space) {
-        ci = &ci_disk_free_space;
-        return true;
-      }
-      break;
-    case 2498:
-      HASH_GUARD(0x6A7BDB900E7429C2LL, magickconstituteimage) {
-        ci = &ci_magickconstituteimage;
-        return true;
-      }
-      break;
-    case 2502:
-      HASH_GUARD(0x080F661DB8BFC9C6LL, hphp_splfileinfo_getmtime) {
-        ci = &ci_hphp_splfileinfo_getmtime;
-        return true;
-      }
-      break;
-    case 2503:
-      HASH_GUARD(0x6ECDF24B29D789C7LL, strtolower) {
-        ci = &ci_strtolower;
-        return true;
-      }
-      break;
-    case 2509:
-      HASH_GUARD(0x4E61FE901C1C29CDLL, array_intersect_key) {
-        ci = &ci_array_intersect_key;
-        return true;
-      }
-      break;
-    case 2510:
-      HASH_GUARD(0x7A9FB932873D09CELL, gmmktime) {
-        ci = &ci_gmmktime;
-        return true;
-      }
-      break;
-    case 2511:
-      HASH_GUARD(0x415B91CAEE0689CFLL, magickgetimageinterlacescheme) {
-        ci = &ci_magickgetimageinterlacescheme;
-        return true;
-      }
-      break;
-    case 2515:
-      HASH_GUARD(0x1C31A9E1207209D3LL, mb_split) {
-        ci = &ci_mb_split;
-        return true;
-      }
-      HASH_GUARD(0x10C82F357BB7E9D3LL, curl_version) {
-        ci = &ci_curl_version;
-        return true;
-      }
-      HASH_GUARD(0x25CA0299103F49D3LL, magickgetsize) {
-        ci = &ci_magickgetsize;
-        return true;
-      }
-      break;
-    case 2519:
-      HASH_GUARD(0x7628053EFCC0C9D7LL, hphp_clear_unflushed) {
-        ci = &ci_hphp_clear_unflushed;
-        return true;
-      }
-      break;
-    case 2523:
-      HASH_GUARD(0x48B2E069B89489DBLL, magickappendimages) {
-        ci = &ci_magickappendimages;
-        return true;
-      }
-      break;
-    case 2526:
-      HASH_GUARD(0x5C039967E60089DELL, array_intersect_ukey) {
-        ci = &ci_array_intersect_ukey;
-        return true;
-      }
-      break;
-    case 2534:
-      HASH_GUARD(0x1B44CF284E9B09E6LL, interface_exists) {
-        ci = &ci_interface_exists;
-        return true;
-      }
-      break;
-    case 2537:
-      HASH_GUARD(0x6A45EB471332A9E9LL, imagecolorexactalpha) {
-        ci = &ci_imagecolorexactalpha;
-        return true;
-      }
-      HASH_GUARD(0x330EE2729DB7C9E9LL, drawgetfontstretch) {
-        ci = &ci_drawgetfontstretch;
-        return true;
-      }
-      break;
-    case 2546:
-      HASH_GUARD(0x6C1415DAD1E7C9F2LL, fb_get_flush_stat) {
-        ci = &ci_fb_get_flush_stat;
-        return true;
-      }
-      break;
-    case 2547:
-      HASH_GUARD(0x6535B60A4BC449F3LL, dns_get_record) {
-        ci = &ci_dns_get_record;
-        return true;
-      }
-      break;
-    case 2548:
-      HASH_GUARD(0x51201EE65BC729F4LL, localtime) {
-        ci = &ci_localtime;
-        return true;
-      }
-      break;
-    case 2549:
-      HASH_GUARD(0x2BC61637253BE9F5LL, drawgetfontweight) {
-        ci = &ci_drawgetfontweight;
-        return true;
-      }
-      break;
-    case 2557:
-      HASH_GUARD(0x2394D4E030AB69FDLL, getmypid) {
-        ci = &ci_getmypid;
-        return true;
-      }
-      break;
-    case 2564:
-      HASH_GUARD(0x0B88D3F582D16A04LL, memcache_get_extended_stats) {
-        ci = &ci_memcache_get_extended_stats;
-        return true;
-      }
-      break;
-    case 2572:
-      HASH_GUARD(0x13E0C91488484A0CLL, imap_unsubscribe) {
-        ci = &ci_imap_unsubscribe;
-        return true;
-      }
-      break;
-    case 2577:
-      HASH_GUARD(0x472CA39715598A11LL, mb_eregi_replace) {
-        ci = &ci_mb_eregi_replace;
-        return true;
-      }
-      break;
-    case 2584:
-      HASH_GUARD(0x66A378C6BBC26A18LL, dom_document_create_cdatasection) {
-        ci = &ci_dom_document_create_cdatasection;
-        return true;
-      }
-      break;
-    case 2588:
-      HASH_GUARD(0x12D49AD562F38A1CLL, date_timezone_get) {
-        ci = &ci_date_timezone_get;
-        return true;
-      }
-      break;
-    case 2591:
-      HASH_GUARD(0x35C8BD7DFDADEA1FLL, hphp_directoryiterator_current) {
-        ci = &ci_hphp_directoryiterator_current;
-        return true;
-      }
-      break;
-    case 2592:
-      HASH_GUARD(0x2A420675E6AF0A20LL, basename) {
-        ci = &ci_basename;
-        return true;
-      }
-      break;
-    case 2593:
-      HASH_GUARD(0x14279BB1A6872A21LL, atan2) {
-        ci = &ci_atan2;
-        return true;
-      }
-      break;
-    case 2594:
-      HASH_GUARD(0x3FC127C442BAEA22LL, session_id) {
-        ci = &ci_session_id;
-        return true;
-      }
-      break;
-    case 2597:
-      HASH_GUARD(0x5EC0A3DD935EEA25LL, magickresampleimage) {
-        ci = &ci_magickresampleimage;
-        return true;
-      }
-      HASH_GUARD(0x1DB9A1FB97A3AA25LL, magicksetimageoption) {
-        ci = &ci_magicksetimageoption;
-        return true;
-      }
-      break;
-    case 2602:
-      HASH_GUARD(0x3CAEA6B8D1C92A2ALL, stream_bucket_prepend) {
-        ci = &ci_stream_bucket_prepend;
-        return true;
-      }
-      break;
-    case 2604:
-      HASH_GUARD(0x073ACDF9B3F06A2CLL, memcache_setoptimeout) {
-        ci = &ci_memcache_setoptimeout;
-        return true;
-      }
-      break;
-    case 2609:
-      HASH_GUARD(0x1F3E32847C1CCA31LL, mb_ereg_match) {
-        ci = &ci_mb_ereg_match;
-        return true;
-      }
-      break;
-    case 2619:
-      HASH_GUARD(0x545A7BE199EC4A3BLL, pcntl_getpriority) {
-        ci = &ci_pcntl_getpriority;
-        return true;
-      }
-      break;
-    case 2620:
-      HASH_GUARD(0x21DF7BAEEFABCA3CLL, umask) {
-        ci = &ci_umask;
-        return true;
-      }
-      break;
-    case 2624:
-      HASH_GUARD(0x4926EE59103B2A40LL, destroydrawingwand) {
-        ci = &ci_destroydrawingwand;
-        return true;
-      }
-      HASH_GUARD(0x682C14726D484A40LL, fileatime) {
-        ci = &ci_fileatime;
-        return true;
-      }
-      break;
-    case 2628:
-      HASH_GUARD(0x7F6A6306BBE8AA44LL, imagelayereffect) {
-        ci = &ci_imagelayereffect;
-        return true;
-      }
-      break;
-    case 2636:
-      HASH_GUARD(0x4894583F517C6A4CLL, intl_get_error_code) {
-        ci = &ci_intl_get_error_code;
-        return true;
-      }
-      HASH_GUARD(0x7039B1C3356B8A4CLL, hphp_splfileobject_rewind) {
-        ci = &ci_hphp_splfileobject_rewind;
-        return true;
-      }
-      break;
-    case 2640:
-      HASH_GUARD(0x506BBFC1B32AEA50LL, memcache_replace) {
-        ci = &ci_memcache_replace;
-        return true;
-      }
-      break;
-    case 2647:
-      HASH_GUARD(0x5088945958DD4A57LL, mktime) {
-        ci = &ci_mktime;
-        return true;
-      }
-      HASH_GUARD(0x7E929ED7D9BE6A57LL, ini_get) {
-        ci = &ci_ini_get;
-        return true;
-      }
-      break;
-    case 2648:
-      HASH_GUARD(0x6E823A722DE1EA58LL, stream_socket_client) {
-        ci = &ci_stream_socket_client;
-        return true;
-      }
-      break;
-    case 2653:
-      HASH_GUARD(0x7E1E9C4C3D4E8A5DLL, stream_select) {
-        ci = &ci_stream_select;
-        return true;
-      }
-      break;
-    case 2654:
-      HASH_GUARD(0x2C6826999658AA5ELL, getopt) {
-        ci = &ci_getopt;
-        return true;
-      }
-      break;
-    case 2655:
-      HASH_GUARD(0x7CAE3FE798EC0A5FLL, php_logo_guid) {
-        ci = &ci_php_logo_guid;
-        return true;
-      }
-      break;
-    case 2661:
-      HASH_GUARD(0x469199B8FD886A65LL, putenv) {
-        ci = &ci_putenv;
-        return true;
-      }
-      HASH_GUARD(0x3590F3AAC94E0A65LL, array_change_key_case) {
-        ci = &ci_array_change_key_case;
-        return true;
-      }
-      break;
-    case 2665:
-      HASH_GUARD(0x1DD37E722E11AA69LL, session_regenerate_id) {
-        ci = &ci_session_regenerate_id;
-        return true;
-      }
-      break;
-    case 2681:
-      HASH_GUARD(0x28AC28C54C4E6A79LL, openssl_error_string) {
-        ci = &ci_openssl_error_string;
-        return true;
-      }
-      HASH_GUARD(0x2ACAD5A7A8C78A79LL, qlzuncompress) {
-        ci = &ci_qlzuncompress;
-        return true;
-      }
-      break;
-    case 2689:
-      HASH_GUARD(0x09367774F803EA81LL, hphp_recursiveiteratoriterator_valid) {
-        ci = &ci_hphp_recursiveiteratoriterator_valid;
-        return true;
-      }
-      break;
-    case 2690:
-      HASH_GUARD(0x258205B54DC06A82LL, newpixelwands) {
-        ci = &ci_newpixelwands;
-        return true;
-      }
-      break;
-    case 2692:
-      HASH_GUARD(0x08C1A5A05B6A0A84LL, ob_get_length) {
-        ci = &ci_ob_get_length;
-        return true;
-      }
-      break;
-    case 2693:
-      HASH_GUARD(0x2180916F8D4F6A85LL, drawcomment) {
-        ci = &ci_drawcomment;
-        return true;
-      }
-      break;
-    case 2695:
-      HASH_GUARD(0x7C5A22328CAB4A87LL, ereg_replace) {
-        ci = &ci_ereg_replace;
-        return true;
-      }
-      break;
-    case 2699:
-      HASH_GUARD(0x7ACBCD9CF335AA8BLL, xmlwriter_start_document) {
-        ci = &ci_xmlwriter_start_document;
-        return true;
-      }
-      break;
-    case 2708:
-      HASH_GUARD(0x465E6C67F885AA94LL, drawgetstrokelinejoin) {
-        ci = &ci_drawgetstrokelinejoin;
-        return true;
-      }
-      HASH_GUARD(0x7761D019E0B5EA94LL, magickstripimage) {
-        ci = &ci_magickstripimage;
-        return true;
-      }
-      HASH_GUARD(0x0AC7CBCE30442A94LL, imagepalettecopy) {
-        ci = &ci_imagepalettecopy;
-        return true;
-      }
-      break;
-    case 2720:
-      HASH_GUARD(0x55FAF12AF1920AA0LL, sha1_file) {
-        ci = &ci_sha1_file;
-        return true;
-      }
-      break;
-    case 2723:
-      HASH_GUARD(0x2B75B48A53AACAA3LL, imagestring) {
-        ci = &ci_imagestring;
-        return true;
-      }
-      break;
-    case 2726:
-      HASH_GUARD(0x4BBA1E164DF9CAA6LL, localeconv) {
-        ci = &ci_localeconv;
-        return true;
-      }
-      break;
-    case 2729:
-      HASH_GUARD(0x2238FC7870E9CAA9LL, strspn) {
-        ci = &ci_strspn;
-        return true;
-      }
-      break;
-    case 2731:
-      HASH_GUARD(0x1331979EF8EF0AABLL, mb_ereg_search) {
-        ci = &ci_mb_ereg_search;
-        return true;
-      }
-      break;
-    case 2732:
-      HASH_GUARD(0x18CF3E4A60E4AAACLL, pi) {
-        ci = &ci_pi;
-        return true;
-      }
-      break;
-    case 2735:
-      HASH_GUARD(0x3ED47399FE1D6AAFLL, dom_document_create_attribute_ns) {
-        ci = &ci_dom_document_create_attribute_ns;
-        return true;
-      }
-      break;
-    case 2738:
-      HASH_GUARD(0x569EED88F20BAAB2LL, drawgettextundercolor) {
-        ci = &ci_drawgettextundercolor;
-        return true;
-      }
-      break;
-    case 2740:
-      HASH_GUARD(0x1BAFB965204D0AB4LL, openssl_x509_check_private_key) {
-        ci = &ci_openssl_x509_check_private_key;
-        return true;
-      }
-      break;
-    case 2757:
-      HASH_GUARD(0x3754E97715176AC5LL, hphp_get_stats) {
-        ci = &ci_hphp_get_stats;
-        return true;
-      }
-      break;
-    case 2759:
-      HASH_GUARD(0x3886D2664F874AC7LL, openssl_pkcs7_verify) {
-        ci = &ci_openssl_pkcs7_verify;
-        return true;
-      }
-      break;
-    case 2761:
-      HASH_GUARD(0x5CA9671385EF0AC9LL, sem_release) {
-        ci = &ci_sem_release;
-        return true;
-      }
-      break;
-    case 2762:
-      HASH_GUARD(0x45B30CD663284ACALL, is_int) {
-        ci = &ci_is_int;
-        return true;
-      }
-      break;
-    case 2763:
-      HASH_GUARD(0x348888DDF223AACBLL, mt_getrandmax) {
-        ci = &ci_mt_getrandmax;
-        return true;
-      }
-      break;
-    case 2764:
-      HASH_GUARD(0x750D0396676E6ACCLL, imagecolorexact) {
-        ci = &ci_imagecolorexact;
-        return true;
-      }
-      break;
-    case 2765:
-      HASH_GUARD(0x604572CB0314EACDLL, imap_listscan) {
-        ci = &ci_imap_listscan;
-        return true;
-      }
-      break;
-    case 2773:
-      HASH_GUARD(0x5338F971C6DCEAD5LL, hphp_splfileinfo_islink) {
-        ci = &ci_hphp_splfileinfo_islink;
-        return true;
-      }
-      break;
-    case 2774:
-      HASH_GUARD(0x231BCE6071220AD6LL, drawcircle) {
-        ci = &ci_drawcircle;
-        return true;
-      }
-      break;
-    case 2776:
-      HASH_GUARD(0x52401023E146AAD8LL, xmlwriter_end_dtd) {
-        ci = &ci_xmlwriter_end_dtd;
-        return true;
-      }
-      break;
-    case 2780:
-      HASH_GUARD(0x547E7EE64761AADCLL, imagecreatefromxbm) {
-        ci = &ci_imagecreatefromxbm;
-        return true;
-      }
-      break;
-    case 2788:
-      HASH_GUARD(0x47B15A7136E94AE4LL, strnatcasecmp) {
-        ci = &ci_strnatcasecmp;
-        return true;
-      }
-      HASH_GUARD(0x1827F1C22F1CCAE4LL, hebrevc) {
-        ci = &ci_hebrevc;
-        return true;
-      }
-      break;
-    case 2790:
-      HASH_GUARD(0x0E09D0FEA30B6AE6LL, hphp_get_function_info) {
-        ci = &ci_hphp_get_function_info;
-        return true;
-      }
-      break;
-    case 2795:
-      HASH_GUARD(0x528D41A17B8FCAEBLL, imap_set_quota) {
-        ci = &ci_imap_set_quota;
-        return true;
-      }
-      break;
-    case 2808:
-      HASH_GUARD(0x757229A894864AF8LL, session_set_cookie_params) {
-        ci = &ci_session_set_cookie_params;
-        return true;
-      }
-      break;
-    case 2810:
-      HASH_GUARD(0x3C32181DDB860AFALL, imap_getacl) {
-        ci = &ci_imap_getacl;
-        return true;
-      }
-      break;
-    case 2815:
-      HASH_GUARD(0x7833F4C337542AFFLL, openssl_pkey_export) {
-        ci = &ci_openssl_pkey_export;
-        return true;
-      }
-      break;
-    case 2819:
-      HASH_GUARD(0x32458C11C6E74B03LL, pixelsetblackquantum) {
-        ci = &ci_pixelsetblackquantum;
-        return true;
-      }
-      break;
-    case 2826:
-      HASH_GUARD(0x14B366EF64A66B0ALL, get_loaded_extensions) {
-        ci = &ci_get_loaded_extensions;
-        return true;
-      }
-      break;
-    case 2829:
-      HASH_GUARD(0x368DBC0699272B0DLL, magicknegateimage) {
-        ci = &ci_magicknegateimage;
-        return true;
-      }
-      break;
-    case 2836:
-      HASH_GUARD(0x76675F14C1138B14LL, gzuncompress) {
-        ci = &ci_gzuncompress;
-        return true;
-      }
-      break;
-    case 2837:
-      HASH_GUARD(0x24D0895FBB7BCB15LL, is_callable) {
-        ci = &ci_is_callable;
-        return true;
-      }
-      HASH_GUARD(0x773E3809C4954B15LL, hphp_recursivedirectoryiterator_current) {
-        ci = &ci_hphp_recursivedirectoryiterator_current;
-        return true;
-      }
-      break;
-    case 2841:
-      HASH_GUARD(0x0551EACBE8278B19LL, decoct) {
-        ci = &ci_decoct;
-        return true;
-      }
-      break;
-    case 2842:
-      HASH_GUARD(0x399522EE0CF3EB1ALL, drawsetstrokewidth) {
-        ci = &ci_drawsetstrokewidth;
-        return true;
-      }
-      break;
-    case 2843:
-      HASH_GUARD(0x1B7CE8114AEACB1BLL, magickannotateimage) {
-        ci = &ci_magickannotateimage;
-        return true;
-      }
-      break;
-    case 2853:
-      HASH_GUARD(0x798F2776FECAEB25LL, get_required_files) {
-        ci = &ci_get_required_files;
-        return true;
-      }
-      break;
-    case 2857:
-      HASH_GUARD(0x17C38BE3A6EE8B29LL, mysql_field_flags) {
-        ci = &ci_mysql_field_flags;
-        return true;
-      }
-      break;
-    case 2865:
-      HASH_GUARD(0x442B1E05FC146B31LL, stream_context_set_param) {
-        ci = &ci_stream_context_set_param;
-        return true;
-      }
-      break;
-    case 2867:
-      HASH_GUARD(0x00DCD60DD8752B33LL, set_exception_handler) {
-        ci = &ci_set_exception_handler;
-        return true;
-      }
-      break;
-    case 2869:
-      HASH_GUARD(0x78842C1950B38B35LL, drawpathfinish) {
-        ci = &ci_drawpathfinish;
-        return true;
-      }
-      break;
-    case 2878:
-      HASH_GUARD(0x5E2AF775FEB04B3ELL, posix_getppid) {
-        ci = &ci_posix_getppid;
-        return true;
-      }
-      break;
-    case 2885:
-      HASH_GUARD(0x684881C79ED1AB45LL, func_get_args) {
-        ci = &ci_func_get_args;
-        return true;
-      }
-      break;
-    case 2886:
-      HASH_GUARD(0x00D8FE7A00252B46LL, escapeshellarg) {
-        ci = &ci_escapeshellarg;
-        return true;
-      }
-      break;
-    case 2893:
-      HASH_GUARD(0x37DF53E4D9348B4DLL, xbox_post_message) {
-        ci = &ci_xbox_post_message;
-        return true;
-      }
-      break;
-    case 2896:
-      HASH_GUARD(0x6237393C71E56B50LL, array_fill_keys) {
-        ci = &ci_array_fill_keys;
-        return true;
-      }
-      break;
-    case 2899:
-      HASH_GUARD(0x40F0B69D55F7EB53LL, drawsetstrokealpha) {
-        ci = &ci_drawsetstrokealpha;
-        return true;
-      }
-      break;
-    case 2904:
-      HASH_GUARD(0x6158E2E0A5ACCB58LL, idn_to_ascii) {
-        ci = &ci_idn_to_ascii;
-        return true;
-      }
-      break;
-    case 2907:
-      HASH_GUARD(0x29203294F6214B5BLL, memcache_debug) {
-        ci = &ci_memcache_debug;
-        return true;
-      }
-      HASH_GUARD(0x23FD09A13E0D8B5BLL, xmlwriter_open_memory) {
-        ci = &ci_xmlwriter_open_memory;
-        return true;
-      }
-      break;
-    case 2922:
-      HASH_GUARD(0x4BD4E9D9D4A56B6ALL, exif_tagname) {
-        ci = &ci_exif_tagname;
-        return true;
-      }
-      break;
-    case 2923:
-      HASH_GUARD(0x1D4136B4CEAE4B6BLL, stripcslashes) {
-        ci = &ci_stripcslashes;
-        return true;
-      }
-      break;
-    case 2927:
-      HASH_GUARD(0x2D8D57FC1DC6CB6FLL, import_request_variables) {
-        ci = &ci_import_request_variables;
-        return true;
-      }
-      break;
-    case 2928:
-      HASH_GUARD(0x1A73FD4416FECB70LL, magickwriteimagefile) {
-        ci = &ci_magickwriteimagefile;
-        return true;
-      }
-      break;
-    case 2937:
-      HASH_GUARD(0x31242F51AA828B79LL, drawpoppattern) {
-        ci = &ci_drawpoppattern;
-        return true;
-      }
-      break;
-    case 2943:
-      HASH_GUARD(0x308C90AD9478CB7FLL, substr_compare) {
-        ci = &ci_substr_compare;
-        return true;
-      }
-      break;
-    case 2946:
-      HASH_GUARD(0x5BDE96FD5015AB82LL, base_convert) {
-        ci = &ci_base_convert;
-        return true;
-      }
-      break;
-    case 2949:
-      HASH_GUARD(0x41F8FDD700C0CB85LL, socket_last_error) {
-        ci = &ci_socket_last_error;
-        return true;
-      }
-      break;
-    case 2967:
-      HASH_GUARD(0x09837A82A928AB97LL, is_null) {
-        ci = &ci_is_null;
-        return true;
-      }
-      break;
-    case 2978:
-      HASH_GUARD(0x4870ADD98EE02BA2LL, pcntl_wifsignaled) {
-        ci = &ci_pcntl_wifsignaled;
-        return true;
-      }
-      break;
-    case 2979:
-      HASH_GUARD(0x444A3375EFBC2BA3LL, openssl_public_decrypt) {
-        ci = &ci_openssl_public_decrypt;
-        return true;
-      }
-      break;
-    case 2987:
-      HASH_GUARD(0x006481EAF2A70BABLL, ldap_errno) {
-        ci = &ci_ldap_errno;
-        return true;
-      }
-      break;
-    case 2991:
-      HASH_GUARD(0x6A2236CDDFF12BAFLL, magickhaspreviousimage) {
-        ci = &ci_magickhaspreviousimage;
-        return true;
-      }
-      break;
-    case 2993:
-      HASH_GUARD(0x04A24B397CF46BB1LL, strrchr) {
-        ci = &ci_strrchr;
-        return true;
-      }
-      break;
-    case 2997:
-      HASH_GUARD(0x3F7DCC3A00800BB5LL, imagecolorallocate) {
-        ci = &ci_imagecolorallocate;
-        return true;
-      }
-      break;
-    case 3004:
-      HASH_GUARD(0x43B74276235F4BBCLL, is_bool) {
-        ci = &ci_is_bool;
-        return true;
-      }
-      break;
-    case 3006:
-      HASH_GUARD(0x79617ED8EFD1ABBELL, get_class_vars) {
-        ci = &ci_get_class_vars;
-        return true;
-      }
-      HASH_GUARD(0x5ECB0B145B88EBBELL, imagefilledarc) {
-        ci = &ci_imagefilledarc;
-        return true;
-      }
-      HASH_GUARD(0x42684202E2E62BBELL, mcrypt_get_iv_size) {
-        ci = &ci_mcrypt_get_iv_size;
-        return true;
-      }
-      break;
-    case 3017:
-      HASH_GUARD(0x0B4E7B9180C4ABC9LL, xml_set_end_namespace_decl_handler) {
-        ci = &ci_xml_set_end_namespace_decl_handler;
-        return true;
-      }
-      HASH_GUARD(0x22BA0903D344CBC9LL, array_rand) {
-        ci = &ci_array_rand;
-        return true;
-      }
-      break;
-    case 3018:
-      HASH_GUARD(0x0D375A94E75ACBCALL, hphp_throw_fatal_error) {
-        ci = &ci_hphp_throw_fatal_error;
-        return true;
-      }
-      break;
-    case 3021:
-      HASH_GUARD(0x22251ECF8CD58BCDLL, array_product) {
-        ci = &ci_array_product;
-        return true;
-      }
-      break;
-    case 3022:
-      HASH_GUARD(0x600AFF0A6378ABCELL, is_writeable) {
-        ci = &ci_is_writeable;
-        return true;
-      }
-      break;
-    case 3024:
-      HASH_GUARD(0x7046755D8374EBD0LL, ctype_digit) {
-        ci = &ci_ctype_digit;
-        return true;
-      }
-      break;
-    case 3028:
-      HASH_GUARD(0x5B2F2A23D8368BD4LL, magickraiseimage) {
-        ci = &ci_magickraiseimage;
-        return true;
-      }
-      break;
-    case 3032:
-      HASH_GUARD(0x06D5979AB150EBD8LL, dom_node_lookup_namespace_uri) {
-        ci = &ci_dom_node_lookup_namespace_uri;
-        return true;
-      }
-      break;
-    case 3045:
-      HASH_GUARD(0x0E804FCE5C14CBE5LL, imap_sort) {
-        ci = &ci_imap_sort;
-        return true;
-      }
-      break;
-    case 3047:
-      HASH_GUARD(0x1BB5D99C1D29CBE7LL, strstr) {
-        ci = &ci_strstr;
-        return true;
-      }
-      break;
-    case 3048:
-      HASH_GUARD(0x4E903B706977ABE8LL, imagepsslantfont) {
-        ci = &ci_imagepsslantfont;
-        return true;
-      }
-      break;
-    case 3054:
-      HASH_GUARD(0x03F50E435DE20BEELL, magickclippathimage) {
-        ci = &ci_magickclippathimage;
-        return true;
-      }
-      HASH_GUARD(0x790B7C44A3442BEELL, asort) {
-        ci = &ci_asort;
-        return true;
-      }
-      break;
-    case 3060:
-      HASH_GUARD(0x46EC26486531ABF4LL, imap_deletemailbox) {
-        ci = &ci_imap_deletemailbox;
-        return true;
-      }
-      break;
-    case 3062:
-      HASH_GUARD(0x08B4BEBAB3312BF6LL, image_type_to_extension) {
-        ci = &ci_image_type_to_extension;
-        return true;
-      }
-      break;
-    case 3077:
-      HASH_GUARD(0x2EC378A759F9EC05LL, xbox_task_status) {
-        ci = &ci_xbox_task_status;
-        return true;
-      }
-      break;
-    case 3079:
-      HASH_GUARD(0x66EF68EF3C144C07LL, imap_gc) {
-        ci = &ci_imap_gc;
-        return true;
-      }
-      break;
-    case 3083:
-      HASH_GUARD(0x0EEE484739520C0BLL, magickthresholdimage) {
-        ci = &ci_magickthresholdimage;
-        return true;
-      }
-      HASH_GUARD(0x0833BCE91C40CC0BLL, magickqueryconfigureoption) {
-        ci = &ci_magickqueryconfigureoption;
-        return true;
-      }
-      break;
-    case 3090:
-      HASH_GUARD(0x510B683F2E764C12LL, fb_load_local_databases) {
-        ci = &ci_fb_load_local_databases;
-        return true;
-      }
-      break;
-    case 3099:
-      HASH_GUARD(0x67742A0F218F6C1BLL, posix_initgroups) {
-        ci = &ci_posix_initgroups;
-        return true;
-      }
-      HASH_GUARD(0x7D615C7E3ADB2C1BLL, xmlwriter_write_comment) {
-        ci = &ci_xmlwriter_write_comment;
-        return true;
-      }
-      break;
-    case 3102:
-      HASH_GUARD(0x32D5F30455C90C1ELL, imap_subscribe) {
-        ci = &ci_imap_subscribe;
-        return true;
-      }
-      break;
-    case 3104:
-      HASH_GUARD(0x7BD43EB167198C20LL, xmlwriter_write_pi) {
-        ci = &ci_xmlwriter_write_pi;
-        return true;
-      }
-      break;
-    case 3111:
-      HASH_GUARD(0x5A02EE8ED39F0C27LL, posix_getgrnam) {
-        ci = &ci_posix_getgrnam;
-        return true;
-      }
-      break;
-    case 3112:
-      HASH_GUARD(0x79A4E240F18BAC28LL, rand) {
-        ci = &ci_rand;
-        return true;
-      }
-      break;
-    case 3115:
-      HASH_GUARD(0x09A98E99D51E8C2BLL, hphp_recursivedirectoryiterator_seek) {
-        ci = &ci_hphp_recursivedirectoryiterator_seek;
-        return true;
-      }
-      break;
-    case 3116:
-      HASH_GUARD(0x116C3EC924B9AC2CLL, imagegd) {
-        ci = &ci_imagegd;
-        return true;
-      }
-      break;
-    case 3125:
-      HASH_GUARD(0x2B9A380A29D0EC35LL, session_write_close) {
-        ci = &ci_session_write_close;
-        return true;
-      }
-      break;
-    case 3141:
-      HASH_GUARD(0x6EF89BCAD607CC45LL, strncasecmp) {
-        ci = &ci_strncasecmp;
-        return true;
-      }
-      break;
-    case 3143:
-      HASH_GUARD(0x44055093E56E4C47LL, mcrypt_enc_get_key_size) {
-        ci = &ci_mcrypt_enc_get_key_size;
-        return true;
-      }
-      break;
-    case 3145:
-      HASH_GUARD(0x2D3F0F8DB0C20C49LL, dom_node_insert_before) {
-        ci = &ci_dom_node_insert_before;
-        return true;
-      }
-      HASH_GUARD(0x357F73CEBD6E2C49LL, write_hdf_string) {
-        ci = &ci_write_hdf_string;
-        return true;
-      }
-      break;
-    case 3146:
-      HASH_GUARD(0x3C23768CFB492C4ALL, gzinflate) {
-        ci = &ci_gzinflate;
-        return true;
-      }
-      break;
-    case 3150:
-      HASH_GUARD(0x5DAC1C64D8F08C4ELL, openssl_pkey_get_private) {
-        ci = &ci_openssl_pkey_get_private;
-        return true;
-      }
-      break;
-    case 3153:
-      HASH_GUARD(0x56EDB60C824E8C51LL, key) {
-        ci = &ci_key;
-        return true;
-      }
-      break;
-    case 3154:
-      HASH_GUARD(0x1FC294B806F76C52LL, php_sapi_name) {
-        ci = &ci_php_sapi_name;
-        return true;
-      }
-      break;
-    case 3159:
-      HASH_GUARD(0x793259E03C37CC57LL, memcache_decrement) {
-        ci = &ci_memcache_decrement;
-        return true;
-      }
-      break;
-    case 3171:
-      HASH_GUARD(0x43C0E9827D502C63LL, array_intersect_assoc) {
-        ci = &ci_array_intersect_assoc;
-        return true;
-      }
-      break;
-    case 3172:
-      HASH_GUARD(0x3409D717D9246C64LL, libxml_use_internal_errors) {
-        ci = &ci_libxml_use_internal_errors;
-        return true;
-      }
-      break;
-    case 3178:
-      HASH_GUARD(0x41BD9EA0BC5E4C6ALL, move_uploaded_file) {
-        ci = &ci_move_uploaded_file;
-        return true;
-      }
-      break;
-    case 3179:
-      HASH_GUARD(0x7C6B37BF6300AC6BLL, iconv_mime_encode) {
-        ci = &ci_iconv_mime_encode;
-        return true;
-      }
-      break;
-    case 3185:
-      HASH_GUARD(0x1E074215FE5FCC71LL, set_error_handler) {
-        ci = &ci_set_error_handler;
-        return true;
-      }
-      break;
-    case 3189:
-      HASH_GUARD(0x528366F3195ACC75LL, xbox_task_result) {
-        ci = &ci_xbox_task_result;
-        return true;
-      }
-      break;
-    case 3190:
-      HASH_GUARD(0x1C35934C6BC52C76LL, libxml_clear_errors) {
-        ci = &ci_libxml_clear_errors;
-        return true;
-      }
-      break;
-    case 3192:
-      HASH_GUARD(0x665F08996BD4AC78LL, magicksetimagegreenprimary) {
-        ci = &ci_magicksetimagegreenprimary;
-        return true;
-      }
-      break;
-    case 3194:
-      HASH_GUARD(0x05D7B804ECDE8C7ALL, checkdnsrr) {
-        ci = &ci_checkdnsrr;
-        return true;
-      }
-      HASH_GUARD(0x05F3BC04D61CAC7ALL, get_defined_vars) {
-        ci = &ci_get_defined_vars;
-        return true;
-      }
-      break;
-    case 3195:
-      HASH_GUARD(0x749E45FBD48BEC7BLL, hphp_recursivedirectoryiterator___tostring) {
-        ci = &ci_hphp_recursivedirectoryiterator___tostring;
-        return true;
-      }
-      HASH_GUARD(0x71B25229CD080C7BLL, dom_element_set_attribute_node_ns) {
-        ci = &ci_dom_element_set_attribute_node_ns;
-        return true;
-      }
-      break;
-    case 3198:
-      HASH_GUARD(0x5F41821072A06C7ELL, hphp_splfileinfo_getctime) {
-        ci = &ci_hphp_splfileinfo_getctime;
-        return true;
-      }
-      break;
-    case 3204:
-      HASH_GUARD(0x5D49AF7004696C84LL, shm_detach) {
-        ci = &ci_shm_detach;
-        return true;
-      }
-      break;
-    case 3209:
-      HASH_GUARD(0x0F9C0C82F40F2C89LL, pixelsetcyanquantum) {
-        ci = &ci_pixelsetcyanquantum;
-        return true;
-      }
-      break;
-    case 3214:
-      HASH_GUARD(0x467470230015AC8ELL, mcrypt_module_is_block_algorithm_mode) {
-        ci = &ci_mcrypt_module_is_block_algorithm_mode;
-        return true;
-      }
-      break;
-    case 3215:
-      HASH_GUARD(0x4173EFD9A8EECC8FLL, magicknewimage) {
-        ci = &ci_magicknewimage;
-        return true;
-      }
-      break;
-    case 3216:
-      HASH_GUARD(0x05556EDFC1BB0C90LL, mysql_info) {
-        ci = &ci_mysql_info;
-        return true;
-      }
-      HASH_GUARD(0x3F0C947E68D02C90LL, ini_get_all) {
-        ci = &ci_ini_get_all;
-        return true;
-      }
-      break;
-    case 3222:
-      HASH_GUARD(0x47C5BC101A512C96LL, magickquantizeimage) {
-        ci = &ci_magickquantizeimage;
-        return true;
-      }
-      break;
-    case 3225:
-      HASH_GUARD(0x2EA6E1D600786C99LL, mb_strtoupper) {
-        ci = &ci_mb_strtoupper;
-        return true;
-      }
-      break;
-    case 3230:
-      HASH_GUARD(0x50296037C7968C9ELL, preg_split) {
-        ci = &ci_preg_split;
-        return true;
-      }
-      break;
-    case 3233:
-      HASH_GUARD(0x4590B5971EC9ACA1LL, getmygid) {
-        ci = &ci_getmygid;
-        return true;
-      }
-      break;
-    case 3235:
-      HASH_GUARD(0x737253E9FC112CA3LL, socket_close) {
-        ci = &ci_socket_close;
-        return true;
-      }
-      break;
-    case 3245:
-      HASH_GUARD(0x1C1216F2B7C16CADLL, ftell) {
-        ci = &ci_ftell;
-        return true;
-      }
-      break;
-    case 3246:
-      HASH_GUARD(0x3ACD2F1EA5282CAELL, magickmattefloodfillimage) {
-        ci = &ci_magickmattefloodfillimage;
-        return true;
-      }
-      break;
-    case 3249:
-      HASH_GUARD(0x735555B148E58CB1LL, ldap_read) {
-        ci = &ci_ldap_read;
-        return true;
-      }
-      break;
-    case 3250:
-      HASH_GUARD(0x56023CC5ECC9ECB2LL, dns_get_mx) {
-        ci = &ci_dns_get_mx;
-        return true;
-      }
-      break;
-    case 3252:
-      HASH_GUARD(0x41FBEF9F7A024CB4LL, xmlwriter_end_element) {
-        ci = &ci_xmlwriter_end_element;
-        return true;
-      }
-      HASH_GUARD(0x742AD1AA5A80ECB4LL, output_reset_rewrite_vars) {
-        ci = &ci_output_reset_rewrite_vars;
-        return true;
-      }
-      break;
-    case 3254:
-      HASH_GUARD(0x560637BE51C36CB6LL, ezmlm_hash) {
-        ci = &ci_ezmlm_hash;
-        return true;
-      }
-      break;
-    case 3259:
-      HASH_GUARD(0x031F9B7B9A08ECBBLL, bzcompress) {
-        ci = &ci_bzcompress;
-        return true;
-      }
-      HASH_GUARD(0x41D3B07854936CBBLL, token_get_all) {
-        ci = &ci_token_get_all;
-        return true;
-      }
-      HASH_GUARD(0x15ACD9F32D214CBBLL, mysql_fetch_lengths) {
-        ci = &ci_mysql_fetch_lengths;
-        return true;
-      }
-      break;
-    case 3260:
-      HASH_GUARD(0x19C1872E55A7ECBCLL, is_long) {
-        ci = &ci_is_long;
-        return true;
-      }
-      HASH_GUARD(0x3978BE548631ECBCLL, hash_final) {
-        ci = &ci_hash_final;
-        return true;
-      }
-      HASH_GUARD(0x733137183026ACBCLL, hphp_splfileobject_next) {
-        ci = &ci_hphp_splfileobject_next;
-        return true;
-      }
-      break;
-    case 3266:
-      HASH_GUARD(0x42BCEFCF899D0CC2LL, magickgetimagecolorspace) {
-        ci = &ci_magickgetimagecolorspace;
-        return true;
-      }
-      break;
-    case 3267:
-      HASH_GUARD(0x7A147B8B98C76CC3LL, key_exists) {
-        ci = &ci_key_exists;
-        return true;
-      }
-      break;
-    case 3272:
-      HASH_GUARD(0x4CF625DF902F8CC8LL, imap_get_quotaroot) {
-        ci = &ci_imap_get_quotaroot;
-        return true;
-      }
-      break;
-    case 3277:
-      HASH_GUARD(0x14C550B86A16ACCDLL, hphp_get_this) {
-        ci = &ci_hphp_get_this;
-        return true;
-      }
-      break;
-    case 3282:
-      HASH_GUARD(0x1FD3FB2AB0F48CD2LL, magickgetimagesignature) {
-        ci = &ci_magickgetimagesignature;
-        return true;
-      }
-      break;
-    case 3283:
-      HASH_GUARD(0x6406BC03A5D84CD3LL, dom_element_remove_attribute) {
-        ci = &ci_dom_element_remove_attribute;
-        return true;
-      }
-      break;
-    case 3286:
-      HASH_GUARD(0x11166D3106DB6CD6LL, wandhasexception) {
-        ci = &ci_wandhasexception;
-        return true;
-      }
-      break;
-    case 3289:
-      HASH_GUARD(0x27BFAF1293A60CD9LL, ldap_get_dn) {
-        ci = &ci_ldap_get_dn;
-        return true;
-      }
-      break;
-    case 3290:
-      HASH_GUARD(0x674AA2DBDA5E4CDALL, imageloadfont) {
-        ci = &ci_imageloadfont;
-        return true;
-      }
-      break;
-    case 3296:
-      HASH_GUARD(0x28FB6C2FF0372CE0LL, openssl_decrypt) {
-        ci = &ci_openssl_decrypt;
-        return true;
-      }
-      break;
-    case 3298:
-      HASH_GUARD(0x6B92530A9ABA0CE2LL, session_commit) {
-        ci = &ci_session_commit;
-        return true;
-      }
-      HASH_GUARD(0x2D5A5580B9FD2CE2LL, imap_setacl) {
-        ci = &ci_imap_setacl;
-        return true;
-      }
-      break;
-    case 3306:
-      HASH_GUARD(0x5A8AF4F880DA4CEALL, mailparse_msg_extract_whole_part_file) {
-        ci = &ci_mailparse_msg_extract_whole_part_file;
-        return true;
-      }
-      HASH_GUARD(0x7821BD05E5228CEALL, imagewbmp) {
-        ci = &ci_imagewbmp;
-        return true;
-      }
-      break;
-    case 3310:
-      HASH_GUARD(0x78FFA0E69D6AACEELL, mcrypt_cfb) {
-        ci = &ci_mcrypt_cfb;
-        return true;
-      }
-      break;
-    case 3313:
-      HASH_GUARD(0x21C8FC9A94404CF1LL, php_ini_scanned_files) {
-        ci = &ci_php_ini_scanned_files;
-        return true;
-      }
-      break;
-    case 3317:
-      HASH_GUARD(0x26729ECB00B8ECF5LL, end_user_func_async) {
-        ci = &ci_end_user_func_async;
-        return true;
-      }
-      break;
-    case 3319:
-      HASH_GUARD(0x1C30C8470100ECF7LL, mcrypt_enc_is_block_mode) {
-        ci = &ci_mcrypt_enc_is_block_mode;
-        return true;
-      }
-      break;
-    case 3321:
-      HASH_GUARD(0x537CF5DE8C43CCF9LL, curl_getinfo) {
-        ci = &ci_curl_getinfo;
-        return true;
-      }
-      break;
-    case 3327:
-      HASH_GUARD(0x48A2F2A7A4620CFFLL, pixelsetyellowquantum) {
-        ci = &ci_pixelsetyellowquantum;
-        return true;
-      }
-      break;
-    case 3330:
-      HASH_GUARD(0x018F22AEA371ED02LL, filemtime) {
-        ci = &ci_filemtime;
-        return true;
-      }
-      HASH_GUARD(0x7EB48D1BB5B7AD02LL, dom_element_set_attribute) {
-        ci = &ci_dom_element_set_attribute;
-        return true;
-      }
-      break;
-    case 3332:
-      HASH_GUARD(0x1248250E701DAD04LL, magickgaussianblurimage) {
-        ci = &ci_magickgaussianblurimage;
-        return true;
-      }
-      break;
-    case 3335:
-      HASH_GUARD(0x19B643D858DC6D07LL, magickgetimagerenderingintent) {
-        ci = &ci_magickgetimagerenderingintent;
-        return true;
-      }
-      break;
-    case 3338:
-      HASH_GUARD(0x6E8996DD071CED0ALL, dom_element_remove_attribute_node) {
-        ci = &ci_dom_element_remove_attribute_node;
-        return true;
-      }
-      break;
-    case 3344:
-      HASH_GUARD(0x5CEFA5A265104D10LL, count) {
-        ci = &ci_count;
-        return true;
-      }
-      break;
-    case 3345:
-      HASH_GUARD(0x2D484921B5400D11LL, magickradialblurimage) {
-        ci = &ci_magickradialblurimage;
-        return true;
-      }
-      break;
-    case 3349:
-      HASH_GUARD(0x1C8D554F57DCAD15LL, hphp_object_pointer) {
-        ci = &ci_hphp_object_pointer;
-        return true;
-      }
-      break;
-    case 3351:
-      HASH_GUARD(0x12BB5E00E714ED17LL, magickgetimagecompose) {
-        ci = &ci_magickgetimagecompose;
-        return true;
-      }
-      break;
-    case 3354:
-      HASH_GUARD(0x75DB75CA9DE56D1ALL, xml_parser_get_option) {
-        ci = &ci_xml_parser_get_option;
-        return true;
-      }
-      break;
-    case 3355:
-      HASH_GUARD(0x70C22A7EEF54CD1BLL, ldap_compare) {
-        ci = &ci_ldap_compare;
-        return true;
-      }
-      break;
-    case 3359:
-      HASH_GUARD(0x566465036CCBCD1FLL, min) {
-        ci = &ci_min;
-        return true;
-      }
-      break;
-    case 3366:
-      HASH_GUARD(0x429D088E9779CD26LL, dom_document_normalize_document) {
-        ci = &ci_dom_document_normalize_document;
-        return true;
-      }
-      break;
-    case 3369:
-      HASH_GUARD(0x632D50B69429ED29LL, socket_set_block) {
-        ci = &ci_socket_set_block;
-        return true;
-      }
-      break;
-    case 3382:
-      HASH_GUARD(0x515841235FADCD36LL, class_implements) {
-        ci = &ci_class_implements;
-        return true;
-      }
-      break;
-    case 3387:
-      HASH_GUARD(0x0784B2B034560D3BLL, destroypixelwand) {
-        ci = &ci_destroypixelwand;
-        return true;
-      }
-      HASH_GUARD(0x6C9AE626DAD02D3BLL, mailparse_msg_extract_part_file) {
-        ci = &ci_mailparse_msg_extract_part_file;
-        return true;
-      }
-      break;
-    case 3392:
-      HASH_GUARD(0x198627C81DABAD40LL, register_cleanup_function) {
-        ci = &ci_register_cleanup_function;
-        return true;
-      }
-      break;
-    case 3401:
-      HASH_GUARD(0x41785512C45FCD49LL, mysql_ping) {
-        ci = &ci_mysql_ping;
-        return true;
-      }
-      break;
-    case 3408:
-      HASH_GUARD(0x39B11A2A25E40D50LL, mysql_get_server_info) {
-        ci = &ci_mysql_get_server_info;
-        return true;
-      }
-      HASH_GUARD(0x337D2252CDA22D50LL, is_real) {
-        ci = &ci_is_real;
-        return true;
-      }
-      break;
-    case 3418:
-      HASH_GUARD(0x4ACCF26A7AE80D5ALL, imagefilltoborder) {
-        ci = &ci_imagefilltoborder;
-        return true;
-      }
-      break;
-    case 3419:
-      HASH_GUARD(0x41B5E3D2AADE2D5BLL, drawroundrectangle) {
-        ci = &ci_drawroundrectangle;
-        return true;
-      }
-      break;
-    case 3420:
-      HASH_GUARD(0x1371413B4F6F8D5CLL, pixelgetred) {
-        ci = &ci_pixelgetred;
-        return true;
-      }
-      break;
-    case 3424:
-      HASH_GUARD(0x567276D68FE12D60LL, preg_quote) {
-        ci = &ci_preg_quote;
-        return true;
-      }
-      break;
-    case 3425:
-      HASH_GUARD(0x34F150F3D94E6D61LL, gzpassthru) {
-        ci = &ci_gzpassthru;
-        return true;
-      }
-      break;
-    case 3430:
-      HASH_GUARD(0x0C393EE8F6540D66LL, bccomp) {
-        ci = &ci_bccomp;
-        return true;
-      }
-      break;
-    case 3437:
-      HASH_GUARD(0x21D924BA98BFCD6DLL, file_get_contents) {
-        ci = &ci_file_get_contents;
-        return true;
-      }
-      HASH_GUARD(0x7D9E024FD8696D6DLL, get_class) {
-        ci = &ci_get_class;
-        return true;
-      }
-      HASH_GUARD(0x4351AFD0FD818D6DLL, magickmotionblurimage) {
-        ci = &ci_magickmotionblurimage;
-        return true;
-      }
-      break;
-    case 3441:
-      HASH_GUARD(0x74FDC4596C654D71LL, dom_node_is_default_namespace) {
-        ci = &ci_dom_node_is_default_namespace;
-        return true;
-      }
-      break;
-    case 3446:
-      HASH_GUARD(0x7467E8107EF08D76LL, unpack) {
-        ci = &ci_unpack;
-        return true;
-      }
-      break;
-    case 3447:
-      HASH_GUARD(0x3ED49C2BBDDFAD77LL, ldap_next_reference) {
-        ci = &ci_ldap_next_reference;
-        return true;
-      }
-      break;
-    case 3454:
-      HASH_GUARD(0x384E8BC9B5FE2D7ELL, magickfximage) {
-        ci = &ci_magickfximage;
-        return true;
-      }
-      break;
-    case 3455:
-      HASH_GUARD(0x4E19AFB75A62AD7FLL, imagerotate) {
-        ci = &ci_imagerotate;
-        return true;
-      }
-      break;
-    case 3457:
-      HASH_GUARD(0x25EA810DAEA74D81LL, ob_clean) {
-        ci = &ci_ob_clean;
-        return true;
-      }
-      break;
-    case 3458:
-      HASH_GUARD(0x363D0D4E6D8ACD82LL, imap_alerts) {
-        ci = &ci_imap_alerts;
-        return true;
-      }
-      break;
-    case 3463:
-      HASH_GUARD(0x344091B785FE8D87LL, socket_set_timeout) {
-        ci = &ci_socket_set_timeout;
-        return true;
-      }
-      break;
-    case 3464:
-      HASH_GUARD(0x2AFF8525E93D6D88LL, drawsetfillopacity) {
-        ci = &ci_drawsetfillopacity;
-        return true;
-      }
-      HASH_GUARD(0x1F22C82816F9AD88LL, hphp_splfileinfo_getpath) {
-        ci = &ci_hphp_splfileinfo_getpath;
-        return true;
-      }
-      break;
-    case 3470:
-      HASH_GUARD(0x6A351AEDFC4D0D8ELL, magickgetimagemimetype) {
-        ci = &ci_magickgetimagemimetype;
-        return true;
-      }
-      break;
-    case 3471:
-      HASH_GUARD(0x1806DC9468882D8FLL, gzfile) {
-        ci = &ci_gzfile;
-        return true;
-      }
-      break;
-    case 3472:
-      HASH_GUARD(0x5E4360FC28D0AD90LL, magicksetinterlacescheme) {
-        ci = &ci_magicksetinterlacescheme;
-        return true;
-      }
-      break;
-    case 3473:
-      HASH_GUARD(0x5695393CF6428D91LL, dom_element_set_id_attribute) {
-        ci = &ci_dom_element_set_id_attribute;
-        return true;
-      }
-      HASH_GUARD(0x48444F8F18E60D91LL, strftime) {
-        ci = &ci_strftime;
-        return true;
-      }
-      break;
-    case 3486:
-      HASH_GUARD(0x30C1AE2B06990D9ELL, gzseek) {
-        ci = &ci_gzseek;
-        return true;
-      }
-      break;
-    case 3488:
-      HASH_GUARD(0x7084C6294240CDA0LL, octdec) {
-        ci = &ci_octdec;
-        return true;
-      }
-      break;
-    case 3496:
-      HASH_GUARD(0x18FEAF2459E5ADA8LL, dom_element_has_attribute) {
-        ci = &ci_dom_element_has_attribute;
-        return true;
-      }
-      HASH_GUARD(0x474A096265502DA8LL, glob) {
-        ci = &ci_glob;
-        return true;
-      }
-      HASH_GUARD(0x7FB39C41E339ADA8LL, imap_setflag_full) {
-        ci = &ci_imap_setflag_full;
-        return true;
-      }
-      break;
-    case 3499:
-      HASH_GUARD(0x66764CAABFF4CDABLL, array_keys) {
-        ci = &ci_array_keys;
-        return true;
-      }
-      break;
-    case 3506:
-      HASH_GUARD(0x257371BC40186DB2LL, magickblurimage) {
-        ci = &ci_magickblurimage;
-        return true;
-      }
-      break;
-    case 3507:
-      HASH_GUARD(0x53F2C6F5AE244DB3LL, drawpushdefs) {
-        ci = &ci_drawpushdefs;
-        return true;
-      }
-      break;
-    case 3512:
-      HASH_GUARD(0x2B1D442AEA06ADB8LL, strpbrk) {
-        ci = &ci_strpbrk;
-        return true;
-      }
-      break;
-    case 3516:
-      HASH_GUARD(0x770DEDCB168B0DBCLL, mb_ereg_search_setpos) {
-        ci = &ci_mb_ereg_search_setpos;
-        return true;
-      }
-      break;
-    case 3517:
-      HASH_GUARD(0x01E6FF7D9746CDBDLL, stream_socket_accept) {
-        ci = &ci_stream_socket_accept;
-        return true;
-      }
-      break;
-    case 3523:
-      HASH_GUARD(0x069EE6F604BA2DC3LL, array_reverse) {
-        ci = &ci_array_reverse;
-        return true;
-      }
-      break;
-    case 3526:
-      HASH_GUARD(0x73210FEAA2EACDC6LL, imagecolorsforindex) {
-        ci = &ci_imagecolorsforindex;
-        return true;
-      }
-      break;
-    case 3530:
-      HASH_GUARD(0x3BB701F2BDD0ADCALL, magickgetimageprofile) {
-        ci = &ci_magickgetimageprofile;
-        return true;
-      }
-      break;
-    case 3534:
-      HASH_GUARD(0x3E5C990C32470DCELL, array_combine) {
-        ci = &ci_array_combine;
-        return true;
-      }
-      HASH_GUARD(0x40C3C7DE46D62DCELL, ob_start) {
-        ci = &ci_ob_start;
-        return true;
-      }
-      break;
-    case 3536:
-      HASH_GUARD(0x0E1C354339208DD0LL, imagetypes) {
-        ci = &ci_imagetypes;
-        return true;
-      }
-      break;
-    case 3543:
-      HASH_GUARD(0x1AE08377A1630DD7LL, mysql_insert_id) {
-        ci = &ci_mysql_insert_id;
-        return true;
-      }
-      break;
-    case 3548:
-      HASH_GUARD(0x5EBE067E3FAECDDCLL, ob_gzhandler) {
-        ci = &ci_ob_gzhandler;
-        return true;
-      }
-      HASH_GUARD(0x2497295AC9F72DDCLL, stream_set_blocking) {
-        ci = &ci_stream_set_blocking;
-        return true;
-      }
-      break;
-    case 3549:
-      HASH_GUARD(0x3B00B916C3682DDDLL, ctype_upper) {
-        ci = &ci_ctype_upper;
-        return true;
-      }
-      break;
-    case 3560:
-      HASH_GUARD(0x47A4BA8616D02DE8LL, restore_exception_handler) {
-        ci = &ci_restore_exception_handler;
-        return true;
-      }
-      break;
-    case 3572:
-      HASH_GUARD(0x73B30E65808A6DF4LL, ctype_xdigit) {
-        ci = &ci_ctype_xdigit;
-        return true;
-      }
-      break;
-    case 3596:
-      HASH_GUARD(0x3AD6E084483B2E0CLL, array_udiff_assoc) {
-        ci = &ci_array_udiff_assoc;
-        return true;
-      }
-      break;
-    case 3597:
-      HASH_GUARD(0x5EB0A2F93E650E0DLL, array_diff_key) {
-        ci = &ci_array_diff_key;
-        return true;
-      }
-      break;
-    case 3598:
-      HASH_GUARD(0x5230E4C9D8D64E0ELL, highlight_string) {
-        ci = &ci_highlight_string;
-        return true;
-      }
-      break;
-    case 3602:
-      HASH_GUARD(0x76636D0F0C090E12LL, curl_copy_handle) {
-        ci = &ci_curl_copy_handle;
-        return true;
-      }
-      break;
-    case 3604:
-      HASH_GUARD(0x58F426377837AE14LL, imap_body) {
-        ci = &ci_imap_body;
-        return true;
-      }
-      break;
-    case 3607:
-      HASH_GUARD(0x3D13FD5FE3AF6E17LL, imagestringup) {
-        ci = &ci_imagestringup;
-        return true;
-      }
-      break;
-    case 3616:
-      HASH_GUARD(0x7BDA47B5C47EAE20LL, fread) {
-        ci = &ci_fread;
-        return true;
-      }
-      break;
-    case 3617:
-      HASH_GUARD(0x5B7F218FA08D8E21LL, imagefilledellipse) {
-        ci = &ci_imagefilledellipse;
-        return true;
-      }
-      break;
-    case 3625:
-      HASH_GUARD(0x73FE5C79E14A0E29LL, pixelsetbluequantum) {
-        ci = &ci_pixelsetbluequantum;
-        return true;
-      }
-      break;
-    case 3628:
-      HASH_GUARD(0x19AB40AB4CC50E2CLL, imap_fetch_overview) {
-        ci = &ci_imap_fetch_overview;
-        return true;
-      }
-      break;
-    case 3630:
-      HASH_GUARD(0x3E62C1A48E9EEE2ELL, hphp_splfileinfo_getsize) {
-        ci = &ci_hphp_splfileinfo_getsize;
-        return true;
-      }
-      break;
-    case 3634:
-      HASH_GUARD(0x000AAF93F814AE32LL, drawsetvectorgraphics) {
-        ci = &ci_drawsetvectorgraphics;
-        return true;
-      }
-      break;
-    case 3635:
-      HASH_GUARD(0x38433635F28B4E33LL, is_readable) {
-        ci = &ci_is_readable;
-        return true;
-      }
-      break;
-    case 3642:
-      HASH_GUARD(0x13048F0A79F7CE3ALL, magicksetsamplingfactors) {
-        ci = &ci_magicksetsamplingfactors;
-        return true;
-      }
-      break;
-    case 3648:
-      HASH_GUARD(0x11681FDE841D0E40LL, drawskewy) {
-        ci = &ci_drawskewy;
-        return true;
-      }
-      break;
-    case 3650:
-      HASH_GUARD(0x160B01F095B20E42LL, mb_output_handler) {
-        ci = &ci_mb_output_handler;
-        return true;
-      }
-      break;
-    case 3654:
-      HASH_GUARD(0x7F4C1DF551150E46LL, pixelgetnextiteratorrow) {
-        ci = &ci_pixelgetnextiteratorrow;
-        return true;
-      }
-      break;
-    case 3660:
-      HASH_GUARD(0x1EEBDFD62B6BEE4CLL, mcrypt_module_get_algo_block_size) {
-        ci = &ci_mcrypt_module_get_algo_block_size;
-        return true;
-      }
-      break;
-    case 3663:
-      HASH_GUARD(0x62C934CD93938E4FLL, magickimplodeimage) {
-        ci = &ci_magickimplodeimage;
-        return true;
-      }
-      break;
-    case 3664:
-      HASH_GUARD(0x4022005DE7E24E50LL, openssl_pkcs7_sign) {
-        ci = &ci_openssl_pkcs7_sign;
-        return true;
-      }
-      break;
-    case 3668:
-      HASH_GUARD(0x6BF155774D546E54LL, define_syslog_variables) {
-        ci = &ci_define_syslog_variables;
-        return true;
-      }
-      HASH_GUARD(0x7B6BF544EB420E54LL, hphp_recursivedirectoryiterator_haschildren) {
-        ci = &ci_hphp_recursivedirectoryiterator_haschildren;
-        return true;
-      }
-      break;
-    case 3671:
-      HASH_GUARD(0x2DEF52641933CE57LL, magickgetimagemattecolor) {
-        ci = &ci_magickgetimagemattecolor;
-        return true;
-      }
-      break;
-    case 3676:
-      HASH_GUARD(0x532D0D905CE60E5CLL, posix_times) {
-        ci = &ci_posix_times;
-        return true;
-      }
-      break;
-    case 3677:
-      HASH_GUARD(0x38373F6643B14E5DLL, ldap_parse_reference) {
-        ci = &ci_ldap_parse_reference;
-        return true;
-      }
-      break;
-    case 3681:
-      HASH_GUARD(0x593EA675D239CE61LL, ldap_first_reference) {
-        ci = &ci_ldap_first_reference;
-        return true;
-      }
-      break;
-    case 3682:
-      HASH_GUARD(0x7639C74DBC4F4E62LL, array_splice) {
-        ci = &ci_array_splice;
-        return true;
-      }
-      break;
-    case 3683:
-      HASH_GUARD(0x4B6FE37D66784E63LL, imagesy) {
-        ci = &ci_imagesy;
-        return true;
-      }
-      break;
-    case 3684:
-      HASH_GUARD(0x4F0DF8BBC4340E64LL, stream_socket_server) {
-        ci = &ci_stream_socket_server;
-        return true;
-      }
-      break;
-    case 3685:
-      HASH_GUARD(0x21D5A3208639EE65LL, dom_element_get_attribute_node_ns) {
-        ci = &ci_dom_element_get_attribute_node_ns;
-        return true;
-      }
-      break;
-    case 3688:
-      HASH_GUARD(0x5B1DFB89BFC1CE68LL, realpath) {
-        ci = &ci_realpath;
-        return true;
-      }
-      break;
-    case 3689:
-      HASH_GUARD(0x24B836D2C79D0E69LL, magickgetimagepixels) {
-        ci = &ci_magickgetimagepixels;
-        return true;
-      }
-      break;
-    case 3690:
-      HASH_GUARD(0x2F9816D9A2B2CE6ALL, mysql_set_charset) {
-        ci = &ci_mysql_set_charset;
-        return true;
-      }
-      break;
-    case 3693:
-      HASH_GUARD(0x714001ABB0D76E6DLL, magickgetinterlacescheme) {
-        ci = &ci_magickgetinterlacescheme;
-        return true;
-      }
-      break;
-    case 3695:
-      HASH_GUARD(0x7E6223D0CF184E6FLL, magickqueryformats) {
-        ci = &ci_magickqueryformats;
-        return true;
-      }
-      break;
-    case 3701:
-      HASH_GUARD(0x4EC7C66593DDEE75LL, sql_regcase) {
-        ci = &ci_sql_regcase;
-        return true;
-      }
-      break;
-    case 3703:
-      HASH_GUARD(0x12B7B2D835B80E77LL, chmod) {
-        ci = &ci_chmod;
-        return true;
-      }
-      break;
-    case 3708:
-      HASH_GUARD(0x4D9C5B9A944CCE7CLL, convert_uudecode) {
-        ci = &ci_convert_uudecode;
-        return true;
-      }
-      break;
-    case 3713:
-      HASH_GUARD(0x3B426B13FA584E81LL, fb_unserialize) {
-        ci = &ci_fb_unserialize;
-        return true;
-      }
-      break;
-    case 3715:
-      HASH_GUARD(0x724011CF7C31AE83LL, sqrt) {
-        ci = &ci_sqrt;
-        return true;
-      }
-      break;
-    case 3716:
-      HASH_GUARD(0x1765A63835CC4E84LL, drawgetfontfamily) {
-        ci = &ci_drawgetfontfamily;
-        return true;
-      }
-      break;
-    case 3717:
-      HASH_GUARD(0x4710320ED6638E85LL, rename_function) {
-        ci = &ci_rename_function;
-        return true;
-      }
-      break;
-    case 3720:
-      HASH_GUARD(0x1569DCC552EE8E88LL, cosh) {
-        ci = &ci_cosh;
-        return true;
-      }
-      break;
-    case 3722:
-      HASH_GUARD(0x15C9E5C16374EE8ALL, gzclose) {
-        ci = &ci_gzclose;
-        return true;
-      }
-      break;
-    case 3728:
-      HASH_GUARD(0x33D6CC3959D3CE90LL, clearmagickwand) {
-        ci = &ci_clearmagickwand;
-        return true;
-      }
-      break;
-    case 3731:
-      HASH_GUARD(0x37A9E8F91C33EE93LL, magickborderimage) {
-        ci = &ci_magickborderimage;
-        return true;
-      }
-      break;
-    case 3742:
-      HASH_GUARD(0x76EBE919625D8E9ELL, openssl_pkcs12_export) {
-        ci = &ci_openssl_pkcs12_export;
-        return true;
-      }
-      break;
-    case 3743:
-      HASH_GUARD(0x224004A728974E9FLL, spl_object_hash) {
-        ci = &ci_spl_object_hash;
-        return true;
-      }
-      HASH_GUARD(0x7CFF820207DC6E9FLL, debug_backtrace) {
-        ci = &ci_debug_backtrace;
-        return true;
-      }
-      break;
-    case 3750:
-      HASH_GUARD(0x1D7B8E395613AEA6LL, dom_element_remove_attribute_ns) {
-        ci = &ci_dom_element_remove_attribute_ns;
-        return true;
-      }
-      break;
-    case 3753:
-      HASH_GUARD(0x308D76DB12424EA9LL, magicksetimageindex) {
-        ci = &ci_magicksetimageindex;
-        return true;
-      }
-      break;
-    case 3758:
-      HASH_GUARD(0x5772A0B8C16DAEAELL, posix_setuid) {
-        ci = &ci_posix_setuid;
-        return true;
-      }
-      break;
-    case 3759:
-      HASH_GUARD(0x12D83A92EFB0EEAFLL, xmlwriter_open_uri) {
-        ci = &ci_xmlwriter_open_uri;
-        return true;
-      }
-      break;
-    case 3761:
-      HASH_GUARD(0x33FE101882726EB1LL, proc_close) {
-        ci = &ci_proc_close;
-        return true;
-      }
-      break;
-    case 3763:
-      HASH_GUARD(0x732DAA2292946EB3LL, imap_header) {
-        ci = &ci_imap_header;
-        return true;
-      }
-      HASH_GUARD(0x7379B5B97EC2EEB3LL, hypot) {
-        ci = &ci_hypot;
-        return true;
-      }
-      break;
-    case 3776:
-      HASH_GUARD(0x2475D7045D9DEEC0LL, magicksetimagecompression) {
-        ci = &ci_magicksetimagecompression;
-        return true;
-      }
-      break;
-    case 3780:
-      HASH_GUARD(0x7052903F1B17AEC4LL, parse_str) {
-        ci = &ci_parse_str;
-        return true;
-      }
-      break;
-    case 3785:
-      HASH_GUARD(0x58C8DCAAE5B7CEC9LL, get_cfg_var) {
-        ci = &ci_get_cfg_var;
-        return true;
-      }
-      break;
-    case 3786:
-      HASH_GUARD(0x08E6C1CD3AC64ECALL, hphp_splfileinfo_gettype) {
-        ci = &ci_hphp_splfileinfo_gettype;
-        return true;
-      }
-      HASH_GUARD(0x1AA83A1057BE6ECALL, mysql_field_len) {
-        ci = &ci_mysql_field_len;
-        return true;
-      }
-      break;
-    case 3794:
-      HASH_GUARD(0x3CCD09EC3511CED2LL, apd_stop_trace) {
-        ci = &ci_apd_stop_trace;
-        return true;
-      }
-      break;
-    case 3803:
-      HASH_GUARD(0x16331E18B5CD8EDBLL, timezone_open) {
-        ci = &ci_timezone_open;
-        return true;
-      }
-      break;
-    case 3804:
-      HASH_GUARD(0x0B8B6A66FE646EDCLL, openssl_encrypt) {
-        ci = &ci_openssl_encrypt;
-        return true;
-      }
-      break;
-    case 3808:
-      HASH_GUARD(0x7A1C6E429399CEE0LL, iconv_set_encoding) {
-        ci = &ci_iconv_set_encoding;
-        return true;
-      }
-      break;
-    case 3811:
-      HASH_GUARD(0x1F4AACF075E9CEE3LL, memcache_get_server_status) {
-        ci = &ci_memcache_get_server_status;
-        return true;
-      }
-      HASH_GUARD(0x0E1368A3BDFE6EE3LL, hphp_recursiveiteratoriterator_rewind) {
-        ci = &ci_hphp_recursiveiteratoriterator_rewind;
-        return true;
-      }
-      break;
-    case 3812:
-      HASH_GUARD(0x6C4B9D0271790EE4LL, imap_rfc822_parse_adrlist) {
-        ci = &ci_imap_rfc822_parse_adrlist;
-        return true;
-      }
-      break;
-    case 3813:
-      HASH_GUARD(0x367CFD20B4446EE5LL, is_array) {
-        ci = &ci_is_array;
-        return true;
-      }
-      break;
-    case 3816:
-      HASH_GUARD(0x6CB6650E66CE4EE8LL, magicksetimagebordercolor) {
-        ci = &ci_magicksetimagebordercolor;
-        return true;
-      }
-      break;
-    case 3819:
-      HASH_GUARD(0x72882DBF2D49CEEBLL, set_magic_quotes_runtime) {
-        ci = &ci_set_magic_quotes_runtime;
-        return true;
-      }
-      break;
-    case 3832:
-      HASH_GUARD(0x33FD10AC81146EF8LL, thrift_protocol_read_binary) {
-        ci = &ci_thrift_protocol_read_binary;
-        return true;
-      }
-      break;
-    case 3837:
-      HASH_GUARD(0x0CF27A6BC84CEEFDLL, openssl_get_publickey) {
-        ci = &ci_openssl_get_publickey;
-        return true;
-      }
-      HASH_GUARD(0x283E167EB3F04EFDLL, posix_getgid) {
-        ci = &ci_posix_getgid;
-        return true;
-      }
-      break;
-    case 3841:
-      HASH_GUARD(0x7B6A0D7510184F01LL, mysql_fetch_assoc) {
-        ci = &ci_mysql_fetch_assoc;
-        return true;
-      }
-      break;
-    case 3845:
-      HASH_GUARD(0x6842585E79988F05LL, magickmosaicimages) {
-        ci = &ci_magickmosaicimages;
-        return true;
-      }
-      break;
-    case 3846:
-      HASH_GUARD(0x1D3B08AA0AF50F06LL, gettype) {
-        ci = &ci_gettype;
-        return true;
-      }
-      HASH_GUARD(0x6692475BA65A2F06LL, imagearc) {
-        ci = &ci_imagearc;
-        return true;
-      }
-      break;
-    case 3850:
-      HASH_GUARD(0x36EA41EEA02D4F0ALL, imap_mail_copy) {
-        ci = &ci_imap_mail_copy;
-        return true;
-      }
-      break;
-    case 3851:
-      HASH_GUARD(0x7756593AAC1F6F0BLL, imagecreatefromstring) {
-        ci = &ci_imagecreatefromstring;
-        return true;
-      }
-      break;
-    case 3856:
-      HASH_GUARD(0x700A75BF904DAF10LL, magickgetcharwidth) {
-        ci = &ci_magickgetcharwidth;
-        return true;
-      }
-      break;
-    case 3858:
-      HASH_GUARD(0x042492DDA48C4F12LL, gzdeflate) {
-        ci = &ci_gzdeflate;
-        return true;
-      }
-      break;
-    case 3860:
-      HASH_GUARD(0x04525BA2AE51EF14LL, date_sun_info) {
-        ci = &ci_date_sun_info;
-        return true;
-      }
-      break;
-    case 3861:
-      HASH_GUARD(0x12F09EAED9078F15LL, mysql_fetch_field) {
-        ci = &ci_mysql_fetch_field;
-        return true;
-      }
-      break;
-    case 3862:
-      HASH_GUARD(0x23B7D9E4EC992F16LL, stream_get_line) {
-        ci = &ci_stream_get_line;
-        return true;
-      }
-      HASH_GUARD(0x38664EFE3E0A0F16LL, json_decode) {
-        ci = &ci_json_decode;
-        return true;
-      }
-      HASH_GUARD(0x0287B907DDA3EF16LL, hphpd_get_user_commands) {
-        ci = &ci_hphpd_get_user_commands;
-        return true;
-      }
-      break;
-    case 3872:
-      HASH_GUARD(0x2C4206A0BD904F20LL, hphp_splfileobject_fseek) {
-        ci = &ci_hphp_splfileobject_fseek;
-        return true;
-      }
-      break;
-    case 3873:
-      HASH_GUARD(0x4282496A4BF42F21LL, php_uname) {
-        ci = &ci_php_uname;
-        return true;
-      }
-      HASH_GUARD(0x77EC28645855AF21LL, magicksetcompressionquality) {
-        ci = &ci_magicksetcompressionquality;
-        return true;
-      }
-      break;
-    case 3876:
-      HASH_GUARD(0x05BD68F1D09CEF24LL, array_count_values) {
-        ci = &ci_array_count_values;
-        return true;
-      }
-      HASH_GUARD(0x5FA07E8B63BEAF24LL, mcrypt_enc_get_modes_name) {
-        ci = &ci_mcrypt_enc_get_modes_name;
-        return true;
-      }
-      break;
-    case 3879:
-      HASH_GUARD(0x4BAA5B688E6F6F27LL, gd_info) {
-        ci = &ci_gd_info;
-        return true;
-      }
-      break;
-    case 3897:
-      HASH_GUARD(0x0D4446B2DBC8EF39LL, hphp_splfileinfo_getinode) {
-        ci = &ci_hphp_splfileinfo_getinode;
-        return true;
-      }
-      HASH_GUARD(0x496CF4113CEA8F39LL, magicksetimagefilename) {
-        ci = &ci_magicksetimagefilename;
-        return true;
-      }
-      break;
-    case 3899:
-      HASH_GUARD(0x7EE74F798791CF3BLL, magickedgeimage) {
-        ci = &ci_magickedgeimage;
-        return true;
-      }
-      break;
-    case 3900:
-      HASH_GUARD(0x41136A5F28E84F3CLL, forward_static_call_array) {
-        ci = &ci_forward_static_call_array;
-        return true;
-      }
-      break;
-    case 3903:
-      HASH_GUARD(0x1A9EFDD653DB8F3FLL, pcntl_wstopsig) {
-        ci = &ci_pcntl_wstopsig;
-        return true;
-      }
-      break;
-    case 3906:
-      HASH_GUARD(0x3B46305DA1154F42LL, drawpopclippath) {
-        ci = &ci_drawpopclippath;
-        return true;
-      }
-      break;
-    case 3909:
-      HASH_GUARD(0x4E36A077234B8F45LL, pixelgetblack) {
-        ci = &ci_pixelgetblack;
-        return true;
-      }
-      HASH_GUARD(0x79265AADD9A8AF45LL, mcrypt_cbc) {
-        ci = &ci_mcrypt_cbc;
-        return true;
-      }
-      HASH_GUARD(0x5D3A31AB0E326F45LL, crc32) {
-        ci = &ci_crc32;
-        return true;
-      }
-      break;
-    case 3910:
-      HASH_GUARD(0x079EA27F72594F46LL, gzgets) {
-        ci = &ci_gzgets;
-        return true;
-      }
-      break;
-    case 3920:
-      HASH_GUARD(0x7978A278AEAFAF50LL, pixelgetmagenta) {
-        ci = &ci_pixelgetmagenta;
-        return true;
-      }
-      break;
-    case 3923:
-      HASH_GUARD(0x7B965BB0B7A8EF53LL, hphp_get_iostatus) {
-        ci = &ci_hphp_get_iostatus;
-        return true;
-      }
-      break;
-    case 3926:
-      HASH_GUARD(0x621590803EC88F56LL, imageline) {
-        ci = &ci_imageline;
-        return true;
-      }
-      break;
-    case 3929:
-      HASH_GUARD(0x38246B6BDE246F59LL, magickgetimagedispose) {
-        ci = &ci_magickgetimagedispose;
-        return true;
-      }
-      break;
-    case 3931:
-      HASH_GUARD(0x24F698A8A4B5AF5BLL, imagecolordeallocate) {
-        ci = &ci_imagecolordeallocate;
-        return true;
-      }
-      break;
-    case 3935:
-      HASH_GUARD(0x703D339DD44E8F5FLL, dom_element_get_elements_by_tag_name) {
-        ci = &ci_dom_element_get_elements_by_tag_name;
-        return true;
-      }
-      break;
-    case 3936:
-      HASH_GUARD(0x4F1D2858AD31AF60LL, imagecreatefromgd) {
-        ci = &ci_imagecreatefromgd;
-        return true;
-      }
-      break;
-    case 3939:
-      HASH_GUARD(0x1FFD204252F60F63LL, magicksetimageprofile) {
-        ci = &ci_magicksetimageprofile;
-        return true;
-      }
-      break;
-    case 3942:
-      HASH_GUARD(0x6FFF1304EA444F66LL, drawsetstrokemiterlimit) {
-        ci = &ci_drawsetstrokemiterlimit;
-        return true;
-      }
-      break;
-    case 3943:
-      HASH_GUARD(0x319407AC92912F67LL, ereg) {
-        ci = &ci_ereg;
-        return true;
-      }
-      break;
-    case 3946:
-      HASH_GUARD(0x1670096FDE27AF6ALL, rewind) {
-        ci = &ci_rewind;
-        return true;
-      }
-      break;
-    case 3950:
-      HASH_GUARD(0x3A56371CDDEA0F6ELL, gzgetc) {
-        ci = &ci_gzgetc;
-        return true;
-      }
-      break;
-    case 3951:
-      HASH_GUARD(0x42C4EC9D9F782F6FLL, htmlentities) {
-        ci = &ci_htmlentities;
-        return true;
-      }
-      break;
-    case 3952:
-      HASH_GUARD(0x68C257B62A36EF70LL, magicksetimagebackgroundcolor) {
-        ci = &ci_magicksetimagebackgroundcolor;
-        return true;
-      }
-      HASH_GUARD(0x71557D108E5C0F70LL, xml_set_object) {
-        ci = &ci_xml_set_object;
-        return true;
-      }
-      break;
-    case 3956:
-      HASH_GUARD(0x18BC9BF6D1E3CF74LL, magickpreviewimages) {
-        ci = &ci_magickpreviewimages;
-        return true;
-      }
-      break;
-    case 3961:
-      HASH_GUARD(0x4BE9D91DD8624F79LL, money_format) {
-        ci = &ci_money_format;
-        return true;
-      }
-      break;
-    case 3962:
-      HASH_GUARD(0x7B0E6DB649084F7ALL, clearstatcache) {
-        ci = &ci_clearstatcache;
-        return true;
-      }
-      break;
-    case 3967:
-      HASH_GUARD(0x5E3767128C04CF7FLL, imap_open) {
-        ci = &ci_imap_open;
-        return true;
-      }
-      break;
-    case 3973:
-      HASH_GUARD(0x7EF68B9A55222F85LL, wandgetexceptionstring) {
-        ci = &ci_wandgetexceptionstring;
-        return true;
-      }
-      break;
-    case 3977:
-      HASH_GUARD(0x13F52A829BAC0F89LL, timezone_identifiers_list) {
-        ci = &ci_timezone_identifiers_list;
-        return true;
-      }
-      break;
-    case 3979:
-      HASH_GUARD(0x3703D22147C24F8BLL, pixelsetcyan) {
-        ci = &ci_pixelsetcyan;
-        return true;
-      }
-      break;
-    case 3986:
-      HASH_GUARD(0x288D61E7DE28AF92LL, ucwords) {
-        ci = &ci_ucwords;
-        return true;
-      }
-      break;
-    case 3988:
-      HASH_GUARD(0x76B9D87BC7F02F94LL, preg_match) {
-        ci = &ci_preg_match;
-        return true;
-      }
-      break;
-    case 3991:
-      HASH_GUARD(0x6F9651265C096F97LL, magickreadimages) {
-        ci = &ci_magickreadimages;
-        return true;
-      }
-      break;
-    case 3992:
-      HASH_GUARD(0x66F1F0DB16C82F98LL, imagesavealpha) {
-        ci = &ci_imagesavealpha;
-        return true;
-      }
-      break;
-    case 3995:
-      HASH_GUARD(0x44244ECFB9F76F9BLL, dom_document_create_element_ns) {
-        ci = &ci_dom_document_create_element_ns;
-        return true;
-      }
-      break;
-    case 4015:
-      HASH_GUARD(0x03979AACDBB24FAFLL, mailparse_msg_get_part) {
-        ci = &ci_mailparse_msg_get_part;
-        return true;
-      }
-      break;
-    case 4016:
-      HASH_GUARD(0x4A0B5F4676578FB0LL, imagecolorresolvealpha) {
-        ci = &ci_imagecolorresolvealpha;
-        return true;
-      }
-      break;
-    case 4020:
-      HASH_GUARD(0x3900FDF1C97BEFB4LL, drawrotate) {
-        ci = &ci_drawrotate;
-        return true;
-      }
-      break;
-    case 4021:
-      HASH_GUARD(0x79D3B90DEF10AFB5LL, spl_autoload_extensions) {
-        ci = &ci_spl_autoload_extensions;
-        return true;
-      }
-      break;
-    case 4022:
-      HASH_GUARD(0x56C0CCB57BB6EFB6LL, magicksetimageunits) {
-        ci = &ci_magicksetimageunits;
-        return true;
-      }
-      HASH_GUARD(0x2B451EF5D52C4FB6LL, array_diff) {
-        ci = &ci_array_diff;
-        return true;
-      }
-      break;
-    case 4026:
-      HASH_GUARD(0x0664323CB1CC2FBALL, imagecolorset) {
-        ci = &ci_imagecolorset;
-        return true;
-      }
-      break;
-    case 4028:
-      HASH_GUARD(0x0A8ED0466E41AFBCLL, bzclose) {
-        ci = &ci_bzclose;
-        return true;
-      }
-      break;
-    case 4031:
-      HASH_GUARD(0x70B38AB9EAE16FBFLL, ini_set) {
-        ci = &ci_ini_set;
-        return true;
-      }
-      break;
-    case 4034:
-      HASH_GUARD(0x6CA22E62D4762FC2LL, magickpainttransparentimage) {
-        ci = &ci_magickpainttransparentimage;
-        return true;
-      }
-      break;
-    case 4037:
-      HASH_GUARD(0x38498DD4C28D0FC5LL, hphp_splfileinfo_getatime) {
-        ci = &ci_hphp_splfileinfo_getatime;
-        return true;
-      }
-      break;
-    case 4043:
-      HASH_GUARD(0x38237A4515F42FCBLL, array_pad) {
-        ci = &ci_array_pad;
-        return true;
-      }
-      break;
-    case 4045:
-      HASH_GUARD(0x474566F3A2BE0FCDLL, mcrypt_enc_is_block_algorithm) {
-        ci = &ci_mcrypt_enc_is_block_algorithm;
-        return true;
-      }
-      break;
-    case 4047:
-      HASH_GUARD(0x3A3CFC1F001A6FCFLL, magickreadimagefile) {
-        ci = &ci_magickreadimagefile;
-        return true;
-      }
-      break;
-    case 4048:
-      HASH_GUARD(0x21104CCA2942AFD0LL, fb_const_fetch) {
-        ci = &ci_fb_const_fetch;
-        return true;
-      }
-      HASH_GUARD(0x2EAA47FA6C3FEFD0LL, drawgetstrokealpha) {
-        ci = &ci_drawgetstrokealpha;
-        return true;
-      }
-      break;
-    case 4052:
-      HASH_GUARD(0x4970B72A182E4FD4LL, readdir) {
-        ci = &ci_readdir;
-        return true;
-      }
-      break;
-    case 4053:
-      HASH_GUARD(0x751283FE764CAFD5LL, mysql_select_db) {
-        ci = &ci_mysql_select_db;
-        return true;
-      }
-      break;
-    case 4071:
-      HASH_GUARD(0x217067889854CFE7LL, xmlwriter_start_dtd) {
-        ci = &ci_xmlwriter_start_dtd;
-        return true;
-      }
-      break;
-    case 4080:
-      HASH_GUARD(0x1189B7C4F4874FF0LL, php_check_syntax) {
-        ci = &ci_php_check_syntax;
-        return true;
-      }
-      break;
-    case 4085:
-      HASH_GUARD(0x191ECE88E06E6FF5LL, dom_node_is_supported) {
-        ci = &ci_dom_node_is_supported;
-        return true;
-      }
-      break;
-    case 4087:
-      HASH_GUARD(0x7883232CD1A7CFF7LL, dom_node_is_same_node) {
-        ci = &ci_dom_node_is_same_node;
-        return true;
-      }
-      break;
-    case 4092:
-      HASH_GUARD(0x51647BC5C0A14FFCLL, imap_clearflag_full) {
-        ci = &ci_imap_clearflag_full;
-        return true;
-      }
-      break;
-    case 4094:
-      HASH_GUARD(0x32F8747E480CCFFELL, connection_status) {
-        ci = &ci_connection_status;
-        return true;
-      }
-      break;
-    case 4097:
-      HASH_GUARD(0x7585739E84DBF001LL, imap_delete) {
-        ci = &ci_imap_delete;
-        return true;
-      }
-      break;
-    case 4101:
-      HASH_GUARD(0x20D579E7E4131005LL, imagecolorclosest) {
-        ci = &ci_imagecolorclosest;
-        return true;
-      }
-      HASH_GUARD(0x18A0F1EE8E249005LL, msg_send) {
-        ci = &ci_msg_send;
-        return true;
-      }
-      break;
-    case 4106:
-      HASH_GUARD(0x555D7A3FB939300ALL, apache_setenv) {
-        ci = &ci_apache_setenv;
-        return true;
-      }
-      break;
-    case 4109:
-      HASH_GUARD(0x40FA17130FA7100DLL, openssl_seal) {
-        ci = &ci_openssl_seal;
-        return true;
-      }
-      break;
-    case 4118:
-      HASH_GUARD(0x5623A698A728F016LL, getlastmod) {
-        ci = &ci_getlastmod;
-        return true;
-      }
-      break;
-    case 4122:
-      HASH_GUARD(0x03834225EBBC101ALL, drawsettextundercolor) {
-        ci = &ci_drawsettextundercolor;
-        return true;
-      }
-      break;
-    case 4130:
-      HASH_GUARD(0x145D42B2AB55D022LL, drawmatte) {
-        ci = &ci_drawmatte;
-        return true;
-      }
-      break;
-    case 4131:
-      HASH_GUARD(0x35C74650867B7023LL, imagesetpixel) {
-        ci = &ci_imagesetpixel;
-        return true;
-      }
-      break;
-    case 4147:
-      HASH_GUARD(0x48F35DFD653D7033LL, pclose) {
-        ci = &ci_pclose;
-        return true;
-      }
-      break;
-    case 4149:
-      HASH_GUARD(0x280EC96FB50A9035LL, imap_ping) {
-        ci = &ci_imap_ping;
-        return true;
-      }
-      break;
-    case 4155:
-      HASH_GUARD(0x40329F2A6B84D03BLL, dom_node_lookup_prefix) {
-        ci = &ci_dom_node_lookup_prefix;
-        return true;
-      }
-      break;
-    case 4158:
-      HASH_GUARD(0x32E6E5D3CCE3703ELL, magickgetimagewidth) {
-        ci = &ci_magickgetimagewidth;
-        return true;
-      }
-      HASH_GUARD(0x43461C4D9130103ELL, exit) {
-        ci = &ci_exit;
-        return true;
-      }
-      HASH_GUARD(0x67C1ED9B816E503ELL, md5_file) {
-        ci = &ci_md5_file;
-        return true;
-      }
-      break;
-    case 4163:
-      HASH_GUARD(0x5ACCF9166CD9D043LL, ftruncate) {
-        ci = &ci_ftruncate;
-        return true;
-      }
-      break;
-    case 4169:
-      HASH_GUARD(0x047A8BF04DB51049LL, range) {
-        ci = &ci_range;
-        return true;
-      }
-      break;
-    case 4179:
-      HASH_GUARD(0x15A9EB33DA6E9053LL, getimagesize) {
-        ci = &ci_getimagesize;
-        return true;
-      }
-      HASH_GUARD(0x07EB5C3A3BEA3053LL, acosh) {
-        ci = &ci_acosh;
-        return true;
-      }
-      break;
-    case 4186:
-      HASH_GUARD(0x271AB768D202F05ALL, mcrypt_module_is_block_algorithm) {
-        ci = &ci_mcrypt_module_is_block_algorithm;
-        return true;
-      }
-      break;
-    case 4187:
-      HASH_GUARD(0x7BDA06BD1F8AD05BLL, imap_scanmailbox) {
-        ci = &ci_imap_scanmailbox;
-        return true;
-      }
-      break;
-    case 4191:
-      HASH_GUARD(0x4B70746F965E705FLL, preg_last_error) {
-        ci = &ci_preg_last_error;
-        return true;
-      }
-      break;
-    case 4199:
-      HASH_GUARD(0x0CE1918B30DF5067LL, sys_getloadavg) {
-        ci = &ci_sys_getloadavg;
-        return true;
-      }
-      break;
-    case 4207:
-      HASH_GUARD(0x04D1CF7E4592106FLL, imap_mail_move) {
-        ci = &ci_imap_mail_move;
-        return true;
-      }
-      HASH_GUARD(0x4C6FD8808A62506FLL, session_set_save_handler) {
-        ci = &ci_session_set_save_handler;
-        return true;
-      }
-      break;
-    case 4208:
-      HASH_GUARD(0x3C466098FF7B5070LL, mb_check_encoding) {
-        ci = &ci_mb_check_encoding;
-        return true;
-      }
-      break;
-    case 4216:
-      HASH_GUARD(0x6B268C26E21C1078LL, arsort) {
-        ci = &ci_arsort;
-        return true;
-      }
-      break;
-    case 4217:
-      HASH_GUARD(0x08AA4EA901C9B079LL, session_encode) {
-        ci = &ci_session_encode;
-        return true;
-      }
-      break;
-    case 4228:
-      HASH_GUARD(0x53FD8C9AC3F4D084LL, dangling_server_proxy_new_request) {
-        ci = &ci_dangling_server_proxy_new_request;
-        return true;
-      }
-      break;
-    case 4231:
-      HASH_GUARD(0x255D919D501C5087LL, dom_characterdata_delete_data) {
-        ci = &ci_dom_characterdata_delete_data;
-        return true;
-      }
-      break;
-    case 4238:
-      HASH_GUARD(0x3E4AE974AFA9708ELL, pixelsetquantumcolor) {
-        ci = &ci_pixelsetquantumcolor;
-        return true;
-      }
-      break;
-    case 4241:
-      HASH_GUARD(0x673B36244DC87091LL, closelog) {
-        ci = &ci_closelog;
-        return true;
-      }
-      break;
-    case 4254:
-      HASH_GUARD(0x4AF87BA91163D09ELL, mysql_db_name) {
-        ci = &ci_mysql_db_name;
-        return true;
-      }
-      HASH_GUARD(0x74F0D6D8F1F2709ELL, drawsetstrokedashoffset) {
-        ci = &ci_drawsetstrokedashoffset;
-        return true;
-      }
-      break;
-    case 4255:
-      HASH_GUARD(0x2B130322DEC4B09FLL, pixelgetopacityquantum) {
-        ci = &ci_pixelgetopacityquantum;
-        return true;
-      }
-      break;
-    case 4257:
-      HASH_GUARD(0x0DF945F12533F0A1LL, abs) {
-        ci = &ci_abs;
-        return true;
-      }
-      break;
-    case 4263:
-      HASH_GUARD(0x74C787060F7290A7LL, icu_transliterate) {
-        ci = &ci_icu_transliterate;
-        return true;
-      }
-      break;
-    case 4267:
-      HASH_GUARD(0x439DF153FC32D0ABLL, printf) {
-        ci = &ci_printf;
-        return true;
-      }
-      break;
-    case 4268:
-      HASH_GUARD(0x6E27DC1E74C5B0ACLL, drawpathstart) {
-        ci = &ci_drawpathstart;
-        return true;
-      }
-      break;
-    case 4270:
-      HASH_GUARD(0x47AB4A08446BD0AELL, bcmod) {
-        ci = &ci_bcmod;
-        return true;
-      }
-      HASH_GUARD(0x4BBD5D8A6E0110AELL, error_log) {
-        ci = &ci_error_log;
-        return true;
-      }
-      break;
-    case 4271:
-      HASH_GUARD(0x3954FFED1E0650AFLL, stream_register_wrapper) {
-        ci = &ci_stream_register_wrapper;
-        return true;
-      }
-      break;
-    case 4272:
-      HASH_GUARD(0x5B9F8B3E1D8330B0LL, stream_socket_sendto) {
-        ci = &ci_stream_socket_sendto;
-        return true;
-      }
-      break;
-    case 4274:
-      HASH_GUARD(0x48BBFB59FB7F90B2LL, iconv_strlen) {
-        ci = &ci_iconv_strlen;
-        return true;
-      }
-      break;
-    case 4280:
-      HASH_GUARD(0x05A4C165810A30B8LL, gzread) {
-        ci = &ci_gzread;
-        return true;
-      }
-      break;
-    case 4284:
-      HASH_GUARD(0x3900350CD9D990BCLL, imagecreatefromjpeg) {
-        ci = &ci_imagecreatefromjpeg;
-        return true;
-      }
-      break;
-    case 4288:
-      HASH_GUARD(0x6EDC1E7A8D5710C0LL, memcache_add_server) {
-        ci = &ci_memcache_add_server;
-        return true;
-      }
-      break;
-    case 4293:
-      HASH_GUARD(0x6B477F3B9CDB10C5LL, base64_decode) {
-        ci = &ci_base64_decode;
-        return true;
-      }
-      break;
-    case 4309:
-      HASH_GUARD(0x3BF44C6DECD790D5LL, xmlwriter_start_dtd_entity) {
-        ci = &ci_xmlwriter_start_dtd_entity;
-        return true;
-      }
-      break;
-    case 4312:
-      HASH_GUARD(0x79F2E516A3B070D8LL, libxml_disable_entity_loader) {
-        ci = &ci_libxml_disable_entity_loader;
-        return true;
-      }
-      break;
-    case 4313:
-      HASH_GUARD(0x08F6B727D60670D9LL, magicksetimagedepth) {
-        ci = &ci_magicksetimagedepth;
-        return true;
-      }
-      break;
-    case 4314:
-      HASH_GUARD(0x6F242340B2E930DALL, hphp_splfileinfo_setfileclass) {
-        ci = &ci_hphp_splfileinfo_setfileclass;
-        return true;
-      }
-      break;
-    case 4315:
-      HASH_GUARD(0x3801923AD84670DBLL, apc_inc) {
-        ci = &ci_apc_inc;
-        return true;
-      }
-      break;
-    case 4320:
-      HASH_GUARD(0x2E4612DF112010E0LL, imagecopyresized) {
-        ci = &ci_imagecopyresized;
-        return true;
-      }
-      break;
-    case 4324:
-      HASH_GUARD(0x2B9425038D4230E4LL, imagecreatefromxpm) {
-        ci = &ci_imagecreatefromxpm;
-        return true;
-      }
-      break;
-    case 4327:
-      HASH_GUARD(0x79E6FD78989B10E7LL, tmpfile) {
-        ci = &ci_tmpfile;
-        return true;
-      }
-      HASH_GUARD(0x59DE3A26AFF570E7LL, magickshaveimage) {
-        ci = &ci_magickshaveimage;
-        return true;
-      }
-      break;
-    case 4328:
-      HASH_GUARD(0x17CB328F55FDF0E8LL, drawsetstrokeantialias) {
-        ci = &ci_drawsetstrokeantialias;
-        return true;
-      }
-      break;
-    case 4339:
-      HASH_GUARD(0x315CCBC8C5C7D0F3LL, xmlwriter_write_raw) {
-        ci = &ci_xmlwriter_write_raw;
-        return true;
-      }
-      break;
-    case 4355:
-      HASH_GUARD(0x1FFCBCF1927D7103LL, posix_setpgid) {
-        ci = &ci_posix_setpgid;
-        return true;
-      }
-      break;
-    case 4357:
-      HASH_GUARD(0x509B763CDAD9D105LL, gethostbyaddr) {
-        ci = &ci_gethostbyaddr;
-        return true;
-      }
-      break;
-    case 4360:
-      HASH_GUARD(0x60B8B61133F59108LL, quoted_printable_decode) {
-        ci = &ci_quoted_printable_decode;
-        return true;
-      }
-      break;
-    case 4370:
-      HASH_GUARD(0x0B1BA48B0CFB1112LL, strval) {
-        ci = &ci_strval;
-        return true;
-      }
-      HASH_GUARD(0x28C44527BD59D112LL, is_link) {
-        ci = &ci_is_link;
-        return true;
-      }
-      break;
-    case 4372:
-      HASH_GUARD(0x02A4724E6A881114LL, mb_decode_numericentity) {
-        ci = &ci_mb_decode_numericentity;
-        return true;
-      }
-      break;
-    case 4377:
-      HASH_GUARD(0x3AB82455A70F5119LL, imagecolortransparent) {
-        ci = &ci_imagecolortransparent;
-        return true;
-      }
-      HASH_GUARD(0x2B31A877824A1119LL, stristr) {
-        ci = &ci_stristr;
-        return true;
-      }
-      break;
-    case 4380:
-      HASH_GUARD(0x070A63F6A0B8711CLL, array_walk_recursive) {
-        ci = &ci_array_walk_recursive;
-        return true;
-      }
-      break;
-    case 4381:
-      HASH_GUARD(0x291088666B8BF11DLL, drawsetfontfamily) {
-        ci = &ci_drawsetfontfamily;
-        return true;
-      }
-      break;
-    case 4383:
-      HASH_GUARD(0x4C70C24C84F5511FLL, magicksetimagegamma) {
-        ci = &ci_magicksetimagegamma;
-        return true;
-      }
-      break;
-    case 4389:
-      HASH_GUARD(0x7A8B3EC0235EF125LL, magickprofileimage) {
-        ci = &ci_magickprofileimage;
-        return true;
-      }
-      break;
-    case 4403:
-      HASH_GUARD(0x6A7E0B15FF689133LL, mb_ereg_search_init) {
-        ci = &ci_mb_ereg_search_init;
-        return true;
-      }
-      break;
-    case 4407:
-      HASH_GUARD(0x5666016FA3C0F137LL, socket_clear_error) {
-        ci = &ci_socket_clear_error;
-        return true;
-      }
-      break;
-    case 4408:
-      HASH_GUARD(0x2676902697E37138LL, xmlwriter_start_comment) {
-        ci = &ci_xmlwriter_start_comment;
-        return true;
-      }
-      break;
-    case 4410:
-      HASH_GUARD(0x2A57E5D29D73D13ALL, register_tick_function) {
-        ci = &ci_register_tick_function;
-        return true;
-      }
-      break;
-    case 4411:
-      HASH_GUARD(0x3E0C793B95A9713BLL, imap_bodystruct) {
-        ci = &ci_imap_bodystruct;
-        return true;
-      }
-      break;
-    case 4415:
-      HASH_GUARD(0x5BFDE63106CE713FLL, dom_element_get_attribute) {
-        ci = &ci_dom_element_get_attribute;
-        return true;
-      }
-      break;
-    case 4431:
-      HASH_GUARD(0x61A61E91C477514FLL, chop) {
-        ci = &ci_chop;
-        return true;
-      }
-      HASH_GUARD(0x7863294A8F33D14FLL, file) {
-        ci = &ci_file;
-        return true;
-      }
-      break;
-    case 4434:
-      HASH_GUARD(0x26DD46D8C1F47152LL, ldap_bind) {
-        ci = &ci_ldap_bind;
-        return true;
-      }
-      break;
-    case 4451:
-      HASH_GUARD(0x36D6B73D289DD163LL, date_sunset) {
-        ci = &ci_date_sunset;
-        return true;
-      }
-      break;
-    case 4456:
-      HASH_GUARD(0x14E46EA3CBCFB168LL, magickgetsamplingfactors) {
-        ci = &ci_magickgetsamplingfactors;
-        return true;
-      }
-      break;
-    case 4462:
-      HASH_GUARD(0x15B61E061268B16ELL, magickenhanceimage) {
-        ci = &ci_magickenhanceimage;
-        return true;
-      }
-      break;
-    case 4466:
-      HASH_GUARD(0x59FE6A862E1CB172LL, get_browser) {
-        ci = &ci_get_browser;
-        return true;
-      }
-      break;
-    case 4468:
-      HASH_GUARD(0x345E070844E3F174LL, create_function) {
-        ci = &ci_create_function;
-        return true;
-      }
-      break;
-    case 4471:
-      HASH_GUARD(0x174DB93CAF0D1177LL, hphp_splfileinfo___tostring) {
-        ci = &ci_hphp_splfileinfo___tostring;
-        return true;
-      }
-      break;
-    case 4473:
-      HASH_GUARD(0x6884FAF0D1EF3179LL, posix_mknod) {
-        ci = &ci_posix_mknod;
-        return true;
-      }
-      break;
-    case 4476:
-      HASH_GUARD(0x3E1343B4A3AD717CLL, magickgettextascent) {
-        ci = &ci_magickgettextascent;
-        return true;
-      }
-      break;
-    case 4479:
-      HASH_GUARD(0x4EF9496D16F9D17FLL, xmlwriter_start_element_ns) {
-        ci = &ci_xmlwriter_start_element_ns;
-        return true;
-      }
-      break;
-    case 4481:
-      HASH_GUARD(0x2227E30BAB23B181LL, dom_xpath_query) {
-        ci = &ci_dom_xpath_query;
-        return true;
-      }
-      break;
-    case 4482:
-      HASH_GUARD(0x130B62A8C77F3182LL, mb_ereg_search_getregs) {
-        ci = &ci_mb_ereg_search_getregs;
-        return true;
-      }
-      break;
-    case 4485:
-      HASH_GUARD(0x13E90F8874839185LL, ob_get_status) {
-        ci = &ci_ob_get_status;
-        return true;
-      }
-      break;
-    case 4486:
-      HASH_GUARD(0x5DB5E45860801186LL, openssl_csr_export) {
-        ci = &ci_openssl_csr_export;
-        return true;
-      }
-      break;
-    case 4489:
-      HASH_GUARD(0x0CC53B2F0D38D189LL, timezone_offset_get) {
-        ci = &ci_timezone_offset_get;
-        return true;
-      }
-      break;
-    case 4503:
-      HASH_GUARD(0x15AD9CE061C75197LL, timezone_transitions_get) {
-        ci = &ci_timezone_transitions_get;
-        return true;
-      }
-      break;
-    case 4507:
-      HASH_GUARD(0x7FF6C2A693CE119BLL, magickcyclecolormapimage) {
-        ci = &ci_magickcyclecolormapimage;
-        return true;
-      }
-      break;
-    case 4512:
-      HASH_GUARD(0x6FB5104FC97A31A0LL, drawpathcurvetorelative) {
-        ci = &ci_drawpathcurvetorelative;
-        return true;
-      }
-      break;
-    case 4514:
-      HASH_GUARD(0x2A9015499A2EB1A2LL, fnmatch) {
-        ci = &ci_fnmatch;
-        return true;
-      }
-      break;
-    case 4515:
-      HASH_GUARD(0x735B81C45C2971A3LL, drawgetfillopacity) {
-        ci = &ci_drawgetfillopacity;
-        return true;
-      }
-      break;
-    case 4518:
-      HASH_GUARD(0x37B4612178EF91A6LL, memcache_get_version) {
-        ci = &ci_memcache_get_version;
-        return true;
-      }
-      break;
-    case 4521:
-      HASH_GUARD(0x740DC7FFAD8BB1A9LL, imagecolorat) {
-        ci = &ci_imagecolorat;
-        return true;
-      }
-      break;
-    case 4522:
-      HASH_GUARD(0x11A5C66A3D0711AALL, apc_sma_info) {
-        ci = &ci_apc_sma_info;
-        return true;
-      }
-      break;
-    case 4525:
-      HASH_GUARD(0x5A6EFF8C71A431ADLL, socket_get_status) {
-        ci = &ci_socket_get_status;
-        return true;
-      }
-      HASH_GUARD(0x50538F37398AF1ADLL, ldap_get_option) {
-        ci = &ci_ldap_get_option;
-        return true;
-      }
-      break;
-    case 4527:
-      HASH_GUARD(0x5B1F9C2E9FE111AFLL, fb_utf8ize) {
-        ci = &ci_fb_utf8ize;
-        return true;
-      }
-      break;
-    case 4541:
-      HASH_GUARD(0x4B3F35310DEA31BDLL, socket_create_pair) {
-        ci = &ci_socket_create_pair;
-        return true;
-      }
-      break;
-    case 4543:
-      HASH_GUARD(0x681CD0E7D9DB71BFLL, pow) {
-        ci = &ci_pow;
-        return true;
-      }
-      break;
-    case 4546:
-      HASH_GUARD(0x02103322F88C71C2LL, pixelgetcolorcount) {
-        ci = &ci_pixelgetcolorcount;
-        return true;
-      }
-      break;
-    case 4548:
-      HASH_GUARD(0x3617DAE43A23D1C4LL, xml_parser_set_option) {
-        ci = &ci_xml_parser_set_option;
-        return true;
-      }
-      break;
-    case 4550:
-      HASH_GUARD(0x188D37410B6051C6LL, session_unregister) {
-        ci = &ci_session_unregister;
-        return true;
-      }
-      break;
-    case 4552:
-      HASH_GUARD(0x11C0B5DA066891C8LL, preg_match_all) {
-        ci = &ci_preg_match_all;
-        return true;
-      }
-      break;
-    case 4556:
-      HASH_GUARD(0x3DF488365DAAF1CCLL, drawgettextencoding) {
-        ci = &ci_drawgettextencoding;
-        return true;
-      }
-      break;
-    case 4557:
-      HASH_GUARD(0x37340B707E7CD1CDLL, magickgetimagebordercolor) {
-        ci = &ci_magickgetimagebordercolor;
-        return true;
-      }
-      break;
-    case 4558:
-      HASH_GUARD(0x2E7741B5440FB1CELL, magicksetlastiterator) {
-        ci = &ci_magicksetlastiterator;
-        return true;
-      }
-      break;
-    case 4559:
-      HASH_GUARD(0x595E413CAA7E11CFLL, qlzcompress) {
-        ci = &ci_qlzcompress;
-        return true;
-      }
-      break;
-    case 4560:
-      HASH_GUARD(0x03012F3DDD7AB1D0LL, getservbyport) {
-        ci = &ci_getservbyport;
-        return true;
-      }
-      break;
-    case 4564:
-      HASH_GUARD(0x219F3257BA3371D4LL, decbin) {
-        ci = &ci_decbin;
-        return true;
-      }
-      break;
-    case 4569:
-      HASH_GUARD(0x7A69D0078F4F31D9LL, ldap_start_tls) {
-        ci = &ci_ldap_start_tls;
-        return true;
-      }
-      break;
-    case 4570:
-      HASH_GUARD(0x0482E069503A91DALL, posix_setgid) {
-        ci = &ci_posix_setgid;
-        return true;
-      }
-      break;
-    case 4571:
-      HASH_GUARD(0x3FEBBC0DA79F31DBLL, fb_call_user_func_safe) {
-        ci = &ci_fb_call_user_func_safe;
-        return true;
-      }
-      break;
-    case 4572:
-      HASH_GUARD(0x1D626FADDFCA11DCLL, imap_num_msg) {
-        ci = &ci_imap_num_msg;
-        return true;
-      }
-      HASH_GUARD(0x14FB46333D6D11DCLL, xml_set_default_handler) {
-        ci = &ci_xml_set_default_handler;
-        return true;
-      }
-      break;
-    case 4573:
-      HASH_GUARD(0x03A183D73942B1DDLL, apc_filehits) {
-        ci = &ci_apc_filehits;
-        return true;
-      }
-      break;
-    case 4574:
-      HASH_GUARD(0x44563CC8FA9B11DELL, memcache_set_server_params) {
-        ci = &ci_memcache_set_server_params;
-        return true;
-      }
-      break;
-    case 4575:
-      HASH_GUARD(0x7403251412E931DFLL, syslog) {
-        ci = &ci_syslog;
-        return true;
-      }
-      break;
-    case 4576:
-      HASH_GUARD(0x5932D2750A8A91E0LL, magickgetpackagename) {
-        ci = &ci_magickgetpackagename;
-        return true;
-      }
-      break;
-    case 4577:
-      HASH_GUARD(0x2771C632A60371E1LL, ftok) {
-        ci = &ci_ftok;
-        return true;
-      }
-      HASH_GUARD(0x0ED729A444C611E1LL, openssl_x509_read) {
-        ci = &ci_openssl_x509_read;
-        return true;
-      }
-      break;
-    case 4580:
-      HASH_GUARD(0x08F7A6C37FC7B1E4LL, shm_get_var) {
-        ci = &ci_shm_get_var;
-        return true;
-      }
-      break;
-    case 4584:
-      HASH_GUARD(0x7F843353646391E8LL, rad2deg) {
-        ci = &ci_rad2deg;
-        return true;
-      }
-      break;
-    case 4594:
-      HASH_GUARD(0x46AFE55982B371F2LL, posix_geteuid) {
-        ci = &ci_posix_geteuid;
-        return true;
-      }
-      break;
-    case 4595:
-      HASH_GUARD(0x11BB3CDC5E4971F3LL, xmlwriter_end_pi) {
-        ci = &ci_xmlwriter_end_pi;
-        return true;
-      }
-      break;
-    case 4597:
-      HASH_GUARD(0x542FBDCF960031F5LL, fprintf) {
-        ci = &ci_fprintf;
-        return true;
-      }
-      HASH_GUARD(0x02ABC00C046291F5LL, imageellipse) {
-        ci = &ci_imageellipse;
-        return true;
-      }
-      break;
-    case 4602:
-      HASH_GUARD(0x135D5CBF936B11FALL, msg_receive) {
-        ci = &ci_msg_receive;
-        return true;
-      }
-      break;
-    case 4605:
-      HASH_GUARD(0x5304E6B47ED0B1FDLL, srand) {
-        ci = &ci_srand;
-        return true;
-      }
-      break;
-    case 4620:
-      HASH_GUARD(0x41B15671649A320CLL, curl_multi_getcontent) {
-        ci = &ci_curl_multi_getcontent;
-        return true;
-      }
-      HASH_GUARD(0x257BEA4D6DC9920CLL, ctype_alnum) {
-        ci = &ci_ctype_alnum;
-        return true;
-      }
-      break;
-    case 4622:
-      HASH_GUARD(0x533642044A00520ELL, pixelgetmagentaquantum) {
-        ci = &ci_pixelgetmagentaquantum;
-        return true;
-      }
-      break;
-    case 4623:
-      HASH_GUARD(0x08DC8BF3ADAE520FLL, getallheaders) {
-        ci = &ci_getallheaders;
-        return true;
-      }
-      HASH_GUARD(0x53631CF3A937320FLL, get_class_methods) {
-        ci = &ci_get_class_methods;
-        return true;
-      }
-      break;
-    case 4624:
-      HASH_GUARD(0x15EF510022CAF210LL, xml_parser_create_ns) {
-        ci = &ci_xml_parser_create_ns;
-        return true;
-      }
-      HASH_GUARD(0x2D41D7F8F4113210LL, sinh) {
-        ci = &ci_sinh;
-        return true;
-      }
-      break;
-    case 4628:
-      HASH_GUARD(0x7D85E9FACB92D214LL, magickgetimageblob) {
-        ci = &ci_magickgetimageblob;
-        return true;
-      }
-      break;
-    case 4632:
-      HASH_GUARD(0x56C95225813A5218LL, memory_get_usage) {
-        ci = &ci_memory_get_usage;
-        return true;
-      }
-      HASH_GUARD(0x4D63F2C9AAB79218LL, fb_renamed_functions) {
-        ci = &ci_fb_renamed_functions;
-        return true;
-      }
-      break;
-    case 4634:
-      HASH_GUARD(0x72C0C89D897E721ALL, magicksetimagetype) {
-        ci = &ci_magicksetimagetype;
-        return true;
-      }
-      break;
-    case 4636:
-      HASH_GUARD(0x482D58D8EE3A521CLL, imap_lsub) {
-        ci = &ci_imap_lsub;
-        return true;
-      }
-      break;
-    case 4646:
-      HASH_GUARD(0x007B6BD94D767226LL, hphp_splfileobject_fpassthru) {
-        ci = &ci_hphp_splfileobject_fpassthru;
-        return true;
-      }
-      break;
-    case 4647:
-      HASH_GUARD(0x5A26F00A81BA5227LL, xmlwriter_start_attribute_ns) {
-        ci = &ci_xmlwriter_start_attribute_ns;
-        return true;
-      }
-      break;
-    case 4648:
-      HASH_GUARD(0x44911AEE34D63228LL, time_sleep_until) {
-        ci = &ci_time_sleep_until;
-        return true;
-      }
-      HASH_GUARD(0x7CD3C6F6495D3228LL, memcache_get_stats) {
-        ci = &ci_memcache_get_stats;
-        return true;
-      }
-      break;
-    case 4654:
-      HASH_GUARD(0x0B7559F53F31D22ELL, fb_stubout_intercept_handler) {
-        ci = &ci_fb_stubout_intercept_handler;
-        return true;
-      }
-      break;
-    case 4657:
-      HASH_GUARD(0x7C07D66F70E43231LL, mailparse_determine_best_xfer_encoding) {
-        ci = &ci_mailparse_determine_best_xfer_encoding;
-        return true;
-      }
-      break;
-    case 4660:
-      HASH_GUARD(0x23C478B2D95F3234LL, dom_element_has_attribute_ns) {
-        ci = &ci_dom_element_has_attribute_ns;
-        return true;
-      }
-      break;
-    case 4662:
-      HASH_GUARD(0x5542AABF33A2F236LL, stream_filter_remove) {
-        ci = &ci_stream_filter_remove;
-        return true;
-      }
-      break;
-    case 4666:
-      HASH_GUARD(0x679ABBE5A08C523ALL, xml_parse_into_struct) {
-        ci = &ci_xml_parse_into_struct;
-        return true;
-      }
-      break;
-    case 4675:
-      HASH_GUARD(0x78183A24F2ACB243LL, strtotime) {
-        ci = &ci_strtotime;
-        return true;
-      }
-      break;
-    case 4688:
-      HASH_GUARD(0x30747B708DA1D250LL, pushdrawingwand) {
-        ci = &ci_pushdrawingwand;
-        return true;
-      }
-      break;
-    case 4694:
-      HASH_GUARD(0x0384346A8857D256LL, clonemagickwand) {
-        ci = &ci_clonemagickwand;
-        return true;
-      }
-      break;
-    case 4699:
-      HASH_GUARD(0x2F8F40E95EDF925BLL, sizeof) {
-        ci = &ci_sizeof;
-        return true;
-      }
-      break;
-    case 4708:
-      HASH_GUARD(0x261F403C4174D264LL, posix_getsid) {
-        ci = &ci_posix_getsid;
-        return true;
-      }
-      break;
-    case 4711:
-      HASH_GUARD(0x38B376B9D9091267LL, xmlwriter_write_attribute) {
-        ci = &ci_xmlwriter_write_attribute;
-        return true;
-      }
-      break;
-    case 4716:
-      HASH_GUARD(0x188DF1EB5FD1B26CLL, mailparse_msg_parse_file) {
-        ci = &ci_mailparse_msg_parse_file;
-        return true;
-      }
-      break;
-    case 4718:
-      HASH_GUARD(0x5672949384A4F26ELL, stream_filter_register) {
-        ci = &ci_stream_filter_register;
-        return true;
-      }
-      break;
-    case 4723:
-      HASH_GUARD(0x61C991F216E85273LL, inet_ntop) {
-        ci = &ci_inet_ntop;
-        return true;
-      }
-      HASH_GUARD(0x08CC1E49661DB273LL, dom_element_get_attribute_ns) {
-        ci = &ci_dom_element_get_attribute_ns;
-        return true;
-      }
-      break;
-    case 4730:
-      HASH_GUARD(0x39E05F957C7DD27ALL, magickgetimagedepth) {
-        ci = &ci_magickgetimagedepth;
-        return true;
-      }
-      break;
-    case 4732:
-      HASH_GUARD(0x0F7E33D551E0727CLL, posix_getpid) {
-        ci = &ci_posix_getpid;
-        return true;
-      }
-      break;
-    case 4735:
-      HASH_GUARD(0x57E8781CF111727FLL, fileowner) {
-        ci = &ci_fileowner;
-        return true;
-      }
-      break;
-    case 4736:
-      HASH_GUARD(0x0C61AE35699F1280LL, imap_thread) {
-        ci = &ci_imap_thread;
-        return true;
-      }
-      break;
-    case 4737:
-      HASH_GUARD(0x0881440DCF5D3281LL, magickflattenimages) {
-        ci = &ci_magickflattenimages;
-        return true;
-      }
-      break;
-    case 4762:
-      HASH_GUARD(0x68272A37CC9E729ALL, mb_strtolower) {
-        ci = &ci_mb_strtolower;
-        return true;
-      }
-      break;
-    case 4763:
-      HASH_GUARD(0x4A09634AE6DFF29BLL, fileperms) {
-        ci = &ci_fileperms;
-        return true;
-      }
-      break;
-    case 4771:
-      HASH_GUARD(0x10E7B5A0E29CF2A3LL, bcscale) {
-        ci = &ci_bcscale;
-        return true;
-      }
-      HASH_GUARD(0x743EA4BF2CC8F2A3LL, mysql_field_type) {
-        ci = &ci_mysql_field_type;
-        return true;
-      }
-      break;
-    case 4774:
-      HASH_GUARD(0x73EF3A19F76872A6LL, iconv_strrpos) {
-        ci = &ci_iconv_strrpos;
-        return true;
-      }
-      break;
-    case 4776:
-      HASH_GUARD(0x5409127FEDE332A8LL, exif_imagetype) {
-        ci = &ci_exif_imagetype;
-        return true;
-      }
-      break;
-    case 4782:
-      HASH_GUARD(0x36AB9E6AA687F2AELL, xmlwriter_start_dtd_element) {
-        ci = &ci_xmlwriter_start_dtd_element;
-        return true;
-      }
-      break;
-    case 4790:
-      HASH_GUARD(0x0E9C9B409F94B2B6LL, setcookie) {
-        ci = &ci_setcookie;
-        return true;
-      }
-      break;
-    case 4794:
-      HASH_GUARD(0x4A3D2113D3DFD2BALL, newpixelwandarray) {
-        ci = &ci_newpixelwandarray;
-        return true;
-      }
-      break;
-    case 4796:
-      HASH_GUARD(0x41F7E2214DDE12BCLL, mcrypt_enc_self_test) {
-        ci = &ci_mcrypt_enc_self_test;
-        return true;
-      }
-      break;
-    case 4797:
-      HASH_GUARD(0x327C865E52FD12BDLL, ldap_get_values_len) {
-        ci = &ci_ldap_get_values_len;
-        return true;
-      }
-      break;
-    case 4798:
-      HASH_GUARD(0x72D6F9B3661AB2BELL, magickgetimage) {
-        ci = &ci_magickgetimage;
-        return true;
-      }
-      break;
-    case 4800:
-      HASH_GUARD(0x5B7C1B74BA3452C0LL, newpixelregioniterator) {
-        ci = &ci_newpixelregioniterator;
-        return true;
-      }
-      break;
-    case 4803:
-      HASH_GUARD(0x446D76A95365D2C3LL, pixelgetyellow) {
-        ci = &ci_pixelgetyellow;
-        return true;
-      }
-      break;
-    case 4804:
-      HASH_GUARD(0x1C7B8161F3C412C4LL, dom_document_create_document_fragment) {
-        ci = &ci_dom_document_create_document_fragment;
-        return true;
-      }
-      break;
-    case 4812:
-      HASH_GUARD(0x407EF03C23BF92CCLL, drawpathellipticarcabsolute) {
-        ci = &ci_drawpathellipticarcabsolute;
-        return true;
-      }
-      break;
-    case 4815:
-      HASH_GUARD(0x4ACE27EC476632CFLL, apc_bin_dumpfile) {
-        ci = &ci_apc_bin_dumpfile;
-        return true;
-      }
-      break;
-    case 4821:
-      HASH_GUARD(0x4D04C580CF9212D5LL, posix_getgroups) {
-        ci = &ci_posix_getgroups;
-        return true;
-      }
-      break;
-    case 4822:
-      HASH_GUARD(0x06E9C984B5F0B2D6LL, furchash_hphp_ext) {
-        ci = &ci_furchash_hphp_ext;
-        return true;
-      }
-      break;
-    case 4824:
-      HASH_GUARD(0x56C4896BA2FF52D8LL, drawsetstrokeopacity) {
-        ci = &ci_drawsetstrokeopacity;
-        return true;
-      }
-      break;
-    case 4826:
-      HASH_GUARD(0x5C6A85B448C352DALL, posix_uname) {
-        ci = &ci_posix_uname;
-        return true;
-      }
-      break;
-    case 4834:
-      HASH_GUARD(0x4AEC19D75BF652E2LL, magickremoveimage) {
-        ci = &ci_magickremoveimage;
-        return true;
-      }
-      break;
-    case 4845:
-      HASH_GUARD(0x1B9FC9E27B8AB2EDLL, memcache_flush) {
-        ci = &ci_memcache_flush;
-        return true;
-      }
-      break;
-    case 4850:
-      HASH_GUARD(0x2EE56D216BB832F2LL, time_nanosleep) {
-        ci = &ci_time_nanosleep;
-        return true;
-      }
-      break;
-    case 4852:
-      HASH_GUARD(0x418EC805C5FD32F4LL, mcrypt_get_key_size) {
-        ci = &ci_mcrypt_get_key_size;
-        return true;
-      }
-      break;
-    case 4857:
-      HASH_GUARD(0x319EF52B36AAB2F9LL, posix_isatty) {
-        ci = &ci_posix_isatty;
-        return true;
-      }
-      break;
-    case 4859:
-      HASH_GUARD(0x4D393D30CE1112FBLL, drawpathmovetoabsolute) {
-        ci = &ci_drawpathmovetoabsolute;
-        return true;
-      }
-      break;
-    case 4862:
-      HASH_GUARD(0x208B66A8731F72FELL, sem_get) {
-        ci = &ci_sem_get;
-        return true;
-      }
-      HASH_GUARD(0x755A9950B65472FELL, drawgetgravity) {
-        ci = &ci_drawgetgravity;
-        return true;
-      }
-      break;
-    case 4866:
-      HASH_GUARD(0x0103FE1E2C307302LL, socket_recvfrom) {
-        ci = &ci_socket_recvfrom;
-        return true;
-      }
-      break;
-    case 4869:
-      HASH_GUARD(0x65D40C6B4842F305LL, clearpixelwand) {
-        ci = &ci_clearpixelwand;
-        return true;
-      }
-      break;
-    case 4870:
-      HASH_GUARD(0x689D60184DD81306LL, htmlspecialchars_decode) {
-        ci = &ci_htmlspecialchars_decode;
-        return true;
-      }
-      break;
-    case 4875:
-      HASH_GUARD(0x2D2BC1125ECA930BLL, dom_document_relaxng_validate_file) {
-        ci = &ci_dom_document_relaxng_validate_file;
-        return true;
-      }
-      break;
-    case 4876:
-      HASH_GUARD(0x553940FCE453330CLL, hphp_splfileobject_getmaxlinelen) {
-        ci = &ci_hphp_splfileobject_getmaxlinelen;
-        return true;
-      }
-      break;
-    case 4881:
-      HASH_GUARD(0x141EDCAE1D155311LL, xbox_get_thread_time) {
-        ci = &ci_xbox_get_thread_time;
-        return true;
-      }
-      break;
-    case 4885:
-      HASH_GUARD(0x4F1E663AE18FD315LL, msg_remove_queue) {
-        ci = &ci_msg_remove_queue;
-        return true;
-      }
-      break;
-    case 4894:
-      HASH_GUARD(0x27FF9DB54420531ELL, xml_error_string) {
-        ci = &ci_xml_error_string;
-        return true;
-      }
-      break;
-    case 4900:
-      HASH_GUARD(0x5E5E4F998C8E7324LL, pcntl_wifexited) {
-        ci = &ci_pcntl_wifexited;
-        return true;
-      }
-      break;
-    case 4904:
-      HASH_GUARD(0x73FEB3BF75FFB328LL, ctype_space) {
-        ci = &ci_ctype_space;
-        return true;
-      }
-      break;
-    case 4907:
-      HASH_GUARD(0x2BDB1EE3869E132BLL, restore_error_handler) {
-        ci = &ci_restore_error_handler;
-        return true;
-      }
-      break;
-    case 4911:
-      HASH_GUARD(0x7DD6461A6290B32FLL, mysql_real_escape_string) {
-        ci = &ci_mysql_real_escape_string;
-        return true;
-      }
-      break;
-    case 4912:
-      HASH_GUARD(0x1601C1826E90B330LL, strptime) {
-        ci = &ci_strptime;
-        return true;
-      }
-      break;
-    case 4931:
-      HASH_GUARD(0x6794CFB89DEEF343LL, curl_exec) {
-        ci = &ci_curl_exec;
-        return true;
-      }
-      break;
-    case 4933:
-      HASH_GUARD(0x45FAE3D08E96B345LL, curl_errno) {
-        ci = &ci_curl_errno;
-        return true;
-      }
-      break;
-    case 4938:
-      HASH_GUARD(0x208BB4C3C0BA534ALL, xmlwriter_write_dtd_element) {
-        ci = &ci_xmlwriter_write_dtd_element;
-        return true;
-      }
-      break;
-    case 4939:
-      HASH_GUARD(0x57A9E8878872D34BLL, parse_ini_file) {
-        ci = &ci_parse_ini_file;
-        return true;
-      }
-      break;
-    case 4940:
-      HASH_GUARD(0x0644E5FB91C8134CLL, array_udiff) {
-        ci = &ci_array_udiff;
-        return true;
-      }
-      break;
-    case 4943:
-      HASH_GUARD(0x4F2D0EFF0D4B534FLL, fb_get_taint) {
-        ci = &ci_fb_get_taint;
-        return true;
-      }
-      HASH_GUARD(0x5C8B3B9FA833934FLL, ldap_first_attribute) {
-        ci = &ci_ldap_first_attribute;
-        return true;
-      }
-      break;
-    case 4945:
-      HASH_GUARD(0x2B422699C3A57351LL, sha1) {
-        ci = &ci_sha1;
-        return true;
-      }
-      break;
-    case 4948:
-      HASH_GUARD(0x501F4DF5C8997354LL, hphp_get_property) {
-        ci = &ci_hphp_get_property;
-        return true;
-      }
-      HASH_GUARD(0x77EB4D2F5BDDB354LL, magickgetimageresolution) {
-        ci = &ci_magickgetimageresolution;
-        return true;
-      }
-      break;
-    case 4955:
-      HASH_GUARD(0x1AC48909BEEF935BLL, func_get_arg) {
-        ci = &ci_func_get_arg;
-        return true;
-      }
-      break;
-    case 4968:
-      HASH_GUARD(0x5D406167C673D368LL, magickcompareimages) {
-        ci = &ci_magickcompareimages;
-        return true;
-      }
-      break;
-    case 4974:
-      HASH_GUARD(0x7CE90898E882F36ELL, pixelsetyellow) {
-        ci = &ci_pixelsetyellow;
-        return true;
-      }
-      break;
-    case 4978:
-      HASH_GUARD(0x7107AE03689F5372LL, hphp_invoke) {
-        ci = &ci_hphp_invoke;
-        return true;
-      }
-      break;
-    case 4984:
-      HASH_GUARD(0x34BAEFD8AE59D378LL, hphp_set_error_page) {
-        ci = &ci_hphp_set_error_page;
-        return true;
-      }
-      break;
-    case 4996:
-      HASH_GUARD(0x44C1BC500D175384LL, wandgetexception) {
-        ci = &ci_wandgetexception;
-        return true;
-      }
-      break;
-    case 4997:
-      HASH_GUARD(0x7C5CA3E2E3C8F385LL, magickflipimage) {
-        ci = &ci_magickflipimage;
-        return true;
-      }
-      HASH_GUARD(0x57554E082E0ED385LL, pcntl_exec) {
-        ci = &ci_pcntl_exec;
-        return true;
-      }
-      HASH_GUARD(0x0B0B8765A4CDD385LL, hphp_splfileobject_fgets) {
-        ci = &ci_hphp_splfileobject_fgets;
-        return true;
-      }
-      break;
-    case 4998:
-      HASH_GUARD(0x589E24C7664D5386LL, doubleval) {
-        ci = &ci_doubleval;
-        return true;
-      }
-      break;
-    case 5003:
-      HASH_GUARD(0x32354CC291ECF38BLL, fb_intercept) {
-        ci = &ci_fb_intercept;
-        return true;
-      }
-      break;
-    case 5004:
-      HASH_GUARD(0x7F18BA1FBD95B38CLL, hphp_directoryiterator_next) {
-        ci = &ci_hphp_directoryiterator_next;
-        return true;
-      }
-      break;
-    case 5009:
-      HASH_GUARD(0x25FA64929C619391LL, asin) {
-        ci = &ci_asin;
-        return true;
-      }
-      break;
-    case 5010:
-      HASH_GUARD(0x2052D8D4822EF392LL, is_subclass_of) {
-        ci = &ci_is_subclass_of;
-        return true;
-      }
-      break;
-    case 5013:
-      HASH_GUARD(0x7B0552A224E27395LL, bcsqrt) {
-        ci = &ci_bcsqrt;
-        return true;
-      }
-      break;
-    case 5017:
-      HASH_GUARD(0x66DA89629BA5D399LL, posix_getgrgid) {
-        ci = &ci_posix_getgrgid;
-        return true;
-      }
-      break;
-    case 5018:
-      HASH_GUARD(0x4C24BC37D807D39ALL, collator_get_strength) {
-        ci = &ci_collator_get_strength;
-        return true;
-      }
-      break;
-    case 5019:
-      HASH_GUARD(0x5B33B55D4B7E339BLL, fpassthru) {
-        ci = &ci_fpassthru;
-        return true;
-      }
-      break;
-    case 5022:
-      HASH_GUARD(0x27AD0D17AA7FB39ELL, ldap_set_rebind_proc) {
-        ci = &ci_ldap_set_rebind_proc;
-        return true;
-      }
-      break;
-    case 5023:
-      HASH_GUARD(0x4019A6916456339FLL, dom_node_remove_child) {
-        ci = &ci_dom_node_remove_child;
-        return true;
-      }
-      break;
-    case 5026:
-      HASH_GUARD(0x0A2A4AA078D433A2LL, hexdec) {
-        ci = &ci_hexdec;
-        return true;
-      }
-      break;
-    case 5028:
-      HASH_GUARD(0x1676FB393F8493A4LL, constant) {
-        ci = &ci_constant;
-        return true;
-      }
-      break;
-    case 5030:
-      HASH_GUARD(0x40E0D496EE29B3A6LL, call_user_func_array) {
-        ci = &ci_call_user_func_array;
-        return true;
-      }
-      break;
-    case 5032:
-      HASH_GUARD(0x4120B8157ED413A8LL, i18n_loc_set_strength) {
-        ci = &ci_i18n_loc_set_strength;
-        return true;
-      }
-      break;
-    case 5043:
-      HASH_GUARD(0x6077CFE09EE4D3B3LL, session_save_path) {
-        ci = &ci_session_save_path;
-        return true;
-      }
-      break;
-    case 5046:
-      HASH_GUARD(0x6E6C0E9A715073B6LL, dom_xpath_register_php_functions) {
-        ci = &ci_dom_xpath_register_php_functions;
-        return true;
-      }
-      HASH_GUARD(0x6C07640F7C5BD3B6LL, imagettfbbox) {
-        ci = &ci_imagettfbbox;
-        return true;
-      }
-      break;
-    case 5052:
-      HASH_GUARD(0x0629158C42C893BCLL, compact) {
-        ci = &ci_compact;
-        return true;
-      }
-      break;
-    case 5054:
-      HASH_GUARD(0x49A34964289453BELL, eregi) {
-        ci = &ci_eregi;
-        return true;
-      }
-      break;
-    case 5055:
-      HASH_GUARD(0x0E38CDC93E5893BFLL, magicksetimagemattecolor) {
-        ci = &ci_magicksetimagemattecolor;
-        return true;
-      }
-      break;
-    case 5064:
-      HASH_GUARD(0x4D100C70E86593C8LL, stream_set_write_buffer) {
-        ci = &ci_stream_set_write_buffer;
-        return true;
-      }
-      break;
-    case 5067:
-      HASH_GUARD(0x0173CC6FACAB93CBLL, quotemeta) {
-        ci = &ci_quotemeta;
-        return true;
-      }
-      break;
-    case 5070:
-      HASH_GUARD(0x02BEFBEE8287D3CELL, get_magic_quotes_runtime) {
-        ci = &ci_get_magic_quotes_runtime;
-        return true;
-      }
-      break;
-    case 5074:
-      HASH_GUARD(0x67C155632E5373D2LL, mailparse_msg_create) {
-        ci = &ci_mailparse_msg_create;
-        return true;
-      }
-      HASH_GUARD(0x4363FF80EEC953D2LL, imap_undelete) {
-        ci = &ci_imap_undelete;
-        return true;
-      }
-      break;
-    case 5075:
-      HASH_GUARD(0x0A8D4FAF266973D3LL, bcpow) {
-        ci = &ci_bcpow;
-        return true;
-      }
-      break;
-    case 5079:
-      HASH_GUARD(0x382B5B1EF00153D7LL, imagecreatefrompng) {
-        ci = &ci_imagecreatefrompng;
-        return true;
-      }
-      break;
-    case 5084:
-      HASH_GUARD(0x7BCD0D27FFD953DCLL, imap_num_recent) {
-        ci = &ci_imap_num_recent;
-        return true;
-      }
-      break;
-    case 5098:
-      HASH_GUARD(0x0D3C8F00B0C633EALL, inet_pton) {
-        ci = &ci_inet_pton;
-        return true;
-      }
-      break;
-    case 5105:
-      HASH_GUARD(0x5EFE291585A713F1LL, method_exists) {
-        ci = &ci_method_exists;
-        return true;
-      }
-      break;
-    case 5106:
-      HASH_GUARD(0x0FE12E46BC9853F2LL, stream_filter_append) {
-        ci = &ci_stream_filter_append;
-        return true;
-      }
-      HASH_GUARD(0x41A19AE18BC8B3F2LL, curl_error) {
-        ci = &ci_curl_error;
-        return true;
-      }
-      HASH_GUARD(0x696241660648B3F2LL, magickwhitethresholdimage) {
-        ci = &ci_magickwhitethresholdimage;
-        return true;
-      }
-      break;
-    case 5108:
-      HASH_GUARD(0x26D53A77483EF3F4LL, drawbezier) {
-        ci = &ci_drawbezier;
-        return true;
-      }
-      break;
-    case 5111:
-      HASH_GUARD(0x43F22CB4E3E8F3F7LL, apache_note) {
-        ci = &ci_apache_note;
-        return true;
-      }
-      break;
-    case 5112:
-      HASH_GUARD(0x4C024573FCD5B3F8LL, var_dump) {
-        ci = &ci_var_dump;
-        return true;
-      }
-      HASH_GUARD(0x514EA9C8FF5B33F8LL, posix_getrlimit) {
-        ci = &ci_posix_getrlimit;
-        return true;
-      }
-      break;
-    case 5114:
-      HASH_GUARD(0x1B217E78CBC713FALL, zend_thread_id) {
-        ci = &ci_zend_thread_id;
-        return true;
-      }
-      break;
-    case 5121:
-      HASH_GUARD(0x36B9C440B1881401LL, fmod) {
-        ci = &ci_fmod;
-        return true;
-      }
-      break;
-    case 5130:
-      HASH_GUARD(0x6DC61C51FA1D340ALL, show_source) {
-        ci = &ci_show_source;
-        return true;
-      }
-      break;
-    case 5131:
-      HASH_GUARD(0x6C2CE092B900D40BLL, hphp_splfileinfo___construct) {
-        ci = &ci_hphp_splfileinfo___construct;
-        return true;
-      }
-      break;
-    case 5133:
-      HASH_GUARD(0x152C7161567F940DLL, func_num_args) {
-        ci = &ci_func_num_args;
-        return true;
-      }
-      break;
-    case 5139:
-      HASH_GUARD(0x56EC1A6732D07413LL, drawgetfontsize) {
-        ci = &ci_drawgetfontsize;
-        return true;
-      }
-      HASH_GUARD(0x20C24D873DC65413LL, openssl_csr_get_subject) {
-        ci = &ci_openssl_csr_get_subject;
-        return true;
-      }
-      break;
-    case 5147:
-      HASH_GUARD(0x47279C717370B41BLL, acos) {
-        ci = &ci_acos;
-        return true;
-      }
-      break;
-    case 5150:
-      HASH_GUARD(0x3E4E7C561D3A541ELL, fgetss) {
-        ci = &ci_fgetss;
-        return true;
-      }
-      break;
-    case 5151:
-      HASH_GUARD(0x301963016A91741FLL, hphp_stats) {
-        ci = &ci_hphp_stats;
-        return true;
-      }
-      break;
-    case 5155:
-      HASH_GUARD(0x4C9108B5A5807423LL, drawsetfillcolor) {
-        ci = &ci_drawsetfillcolor;
-        return true;
-      }
-      break;
-    case 5158:
-      HASH_GUARD(0x161D8EA3339AB426LL, apc_cas) {
-        ci = &ci_apc_cas;
-        return true;
-      }
-      break;
-    case 5164:
-      HASH_GUARD(0x12D324CC744BF42CLL, pixelgetcolorasstring) {
-        ci = &ci_pixelgetcolorasstring;
-        return true;
-      }
-      break;
-    case 5165:
-      HASH_GUARD(0x333D1E2E28B0942DLL, imagejpeg) {
-        ci = &ci_imagejpeg;
-        return true;
-      }
-      break;
-    case 5171:
-      HASH_GUARD(0x6829094421CDB433LL, touch) {
-        ci = &ci_touch;
-        return true;
-      }
-      break;
-    case 5173:
-      HASH_GUARD(0x75DAFEF5BFEF1435LL, imagesetstyle) {
-        ci = &ci_imagesetstyle;
-        return true;
-      }
-      HASH_GUARD(0x044386A0E8B25435LL, drawgetclipunits) {
-        ci = &ci_drawgetclipunits;
-        return true;
-      }
-      break;
-    case 5175:
-      HASH_GUARD(0x1AAF02CF6DEBB437LL, magickdeconstructimages) {
-        ci = &ci_magickdeconstructimages;
-        return true;
-      }
-      break;
-    case 5177:
-      HASH_GUARD(0x34C52EF423EFD439LL, proc_open) {
-        ci = &ci_proc_open;
-        return true;
-      }
-      break;
-    case 5184:
-      HASH_GUARD(0x5247425ED698B440LL, hphp_thread_is_warmup_enabled) {
-        ci = &ci_hphp_thread_is_warmup_enabled;
-        return true;
-      }
-      break;
-    case 5185:
-      HASH_GUARD(0x05892E3C5B9EB441LL, closedir) {
-        ci = &ci_closedir;
-        return true;
-      }
-      break;
-    case 5198:
-      HASH_GUARD(0x3D3BE7A6EBB6544ELL, openssl_cipher_iv_length) {
-        ci = &ci_openssl_cipher_iv_length;
-        return true;
-      }
-      break;
-    case 5201:
-      HASH_GUARD(0x7539134E1CC61451LL, xmlwriter_start_cdata) {
-        ci = &ci_xmlwriter_start_cdata;
-        return true;
-      }
-      break;
-    case 5212:
-      HASH_GUARD(0x436AB52B2099145CLL, ldap_close) {
-        ci = &ci_ldap_close;
-        return true;
-      }
-      break;
-    case 5214:
-      HASH_GUARD(0x0ED191E71A60545ELL, magicksetfirstiterator) {
-        ci = &ci_magicksetfirstiterator;
-        return true;
-      }
-      break;
-    case 5226:
-      HASH_GUARD(0x32643AE461D3F46ALL, mailparse_stream_encode) {
-        ci = &ci_mailparse_stream_encode;
-        return true;
-      }
-      break;
-    case 5228:
-      HASH_GUARD(0x07D959A8C0CF546CLL, stream_wrapper_unregister) {
-        ci = &ci_stream_wrapper_unregister;
-        return true;
-      }
-      HASH_GUARD(0x4F39BD300305746CLL, hphp_splfileobject_key) {
-        ci = &ci_hphp_splfileobject_key;
-        return true;
-      }
-      break;
-    case 5229:
-      HASH_GUARD(0x738D381800CE946DLL, ldap_parse_result) {
-        ci = &ci_ldap_parse_result;
-        return true;
-      }
-      HASH_GUARD(0x5229C0069FD7D46DLL, vfprintf) {
-        ci = &ci_vfprintf;
-        return true;
-      }
-      break;
-    case 5231:
-      HASH_GUARD(0x5B8F2ABBB480346FLL, bzwrite) {
-        ci = &ci_bzwrite;
-        return true;
-      }
-      break;
-    case 5239:
-      HASH_GUARD(0x18666906A8001477LL, array_diff_assoc) {
-        ci = &ci_array_diff_assoc;
-        return true;
-      }
-      break;
-    case 5240:
-      HASH_GUARD(0x080594ABE715B478LL, hphp_splfileobject_current) {
-        ci = &ci_hphp_splfileobject_current;
-        return true;
-      }
-      HASH_GUARD(0x6497CC8295DDB478LL, fb_thrift_unserialize) {
-        ci = &ci_fb_thrift_unserialize;
-        return true;
-      }
-      break;
-    case 5241:
-      HASH_GUARD(0x4859AF715D5A3479LL, magickmagnifyimage) {
-        ci = &ci_magickmagnifyimage;
-        return true;
-      }
-      break;
-    case 5244:
-      HASH_GUARD(0x2FA7269AB0E1147CLL, mysql_field_seek) {
-        ci = &ci_mysql_field_seek;
-        return true;
-      }
-      break;
-    case 5246:
-      HASH_GUARD(0x1D583AA4F7F6547ELL, drawpathlinetorelative) {
-        ci = &ci_drawpathlinetorelative;
-        return true;
-      }
-      break;
-    case 5247:
-      HASH_GUARD(0x68AE04B02253B47FLL, mb_parse_str) {
-        ci = &ci_mb_parse_str;
-        return true;
-      }
-      break;
-    case 5249:
-      HASH_GUARD(0x1876287F59CEB481LL, bzerror) {
-        ci = &ci_bzerror;
-        return true;
-      }
-      break;
-    case 5250:
-      HASH_GUARD(0x4590C853C2027482LL, magickembossimage) {
-        ci = &ci_magickembossimage;
-        return true;
-      }
-      break;
-    case 5253:
-      HASH_GUARD(0x250DD3D58EA37485LL, gmstrftime) {
-        ci = &ci_gmstrftime;
-        return true;
-      }
-      break;
-    case 5257:
-      HASH_GUARD(0x4F7EAF5B37663489LL, magickgetimageredprimary) {
-        ci = &ci_magickgetimageredprimary;
-        return true;
-      }
-      break;
-    case 5258:
-      HASH_GUARD(0x7E88764A1DE8548ALL, drawgetstrokewidth) {
-        ci = &ci_drawgetstrokewidth;
-        return true;
-      }
-      break;
-    case 5259:
-      HASH_GUARD(0x5860ACF621DD948BLL, is_file) {
-        ci = &ci_is_file;
-        return true;
-      }
-      break;
-    case 5261:
-      HASH_GUARD(0x23511F83C2BC548DLL, header) {
-        ci = &ci_header;
-        return true;
-      }
-      HASH_GUARD(0x4162939E6335F48DLL, xhprof_network_disable) {
-        ci = &ci_xhprof_network_disable;
-        return true;
-      }
-      break;
-    case 5267:
-      HASH_GUARD(0x56377FCC2447D493LL, magicksetimagepixels) {
-        ci = &ci_magicksetimagepixels;
-        return true;
-      }
-      break;
-    case 5271:
-      HASH_GUARD(0x353E2A635A47F497LL, evhttp_get) {
-        ci = &ci_evhttp_get;
-        return true;
-      }
-      HASH_GUARD(0x5388045C2D13D497LL, mysql_num_fields) {
-        ci = &ci_mysql_num_fields;
-        return true;
-      }
-      break;
-    case 5285:
-      HASH_GUARD(0x18BE9B1C2DE6D4A5LL, imagexbm) {
-        ci = &ci_imagexbm;
-        return true;
-      }
-      break;
-    case 5289:
-      HASH_GUARD(0x386378F2BA3234A9LL, magickevaluateimage) {
-        ci = &ci_magickevaluateimage;
-        return true;
-      }
-      break;
-    case 5295:
-      HASH_GUARD(0x42463E7E5C3434AFLL, mb_strrichr) {
-        ci = &ci_mb_strrichr;
-        return true;
-      }
-      HASH_GUARD(0x6AC751181531F4AFLL, simplexml_load_string) {
-        ci = &ci_simplexml_load_string;
-        return true;
-      }
-      break;
-    case 5296:
-      HASH_GUARD(0x0E11D317044974B0LL, magickgetnumberimages) {
-        ci = &ci_magickgetnumberimages;
-        return true;
-      }
-      break;
-    case 5297:
-      HASH_GUARD(0x060619D7A1B5F4B1LL, checkdate) {
-        ci = &ci_checkdate;
-        return true;
-      }
-      break;
-    case 5299:
-      HASH_GUARD(0x57034CAD772AF4B3LL, magickgetimagechannelmean) {
-        ci = &ci_magickgetimagechannelmean;
-        return true;
-      }
-      break;
-    case 5302:
-      HASH_GUARD(0x3DE291DCBA5134B6LL, dom_document_create_element) {
-        ci = &ci_dom_document_create_element;
-        return true;
-      }
-      HASH_GUARD(0x12A9166E68DCF4B6LL, pixelgetgreen) {
-        ci = &ci_pixelgetgreen;
-        return true;
-      }
-      break;
-    case 5303:
-      HASH_GUARD(0x7EEBC81AF9BC54B7LL, xml_parser_free) {
-        ci = &ci_xml_parser_free;
-        return true;
-      }
-      break;
-    case 5306:
-      HASH_GUARD(0x6B49D11E633274BALL, fopen) {
-        ci = &ci_fopen;
-        return true;
-      }
-      break;
-    case 5309:
-      HASH_GUARD(0x5BA371A93F60F4BDLL, use_soap_error_handler) {
-        ci = &ci_use_soap_error_handler;
-        return true;
-      }
-      break;
-    case 5316:
-      HASH_GUARD(0x4A24DB9D6B0334C4LL, hphp_recursivedirectoryiterator_next) {
-        ci = &ci_hphp_recursivedirectoryiterator_next;
-        return true;
-      }
-      break;
-    case 5317:
-      HASH_GUARD(0x34A38DDF2CD914C5LL, long2ip) {
-        ci = &ci_long2ip;
-        return true;
-      }
-      break;
-    case 5320:
-      HASH_GUARD(0x1B8BBFC882FDB4C8LL, magicktintimage) {
-        ci = &ci_magicktintimage;
-        return true;
-      }
-      break;
-    case 5325:
-      HASH_GUARD(0x02B0E99C1E68F4CDLL, imap_createmailbox) {
-        ci = &ci_imap_createmailbox;
-        return true;
-      }
-      break;
-    case 5329:
-      HASH_GUARD(0x29EE24C41FD3D4D1LL, mysql_field_name) {
-        ci = &ci_mysql_field_name;
-        return true;
-      }
-      break;
-    case 5334:
-      HASH_GUARD(0x19ECDD5A937DD4D6LL, mailparse_msg_get_part_data) {
-        ci = &ci_mailparse_msg_get_part_data;
-        return true;
-      }
-      break;
-    case 5336:
-      HASH_GUARD(0x14BF763DDDC014D8LL, imagepsencodefont) {
-        ci = &ci_imagepsencodefont;
-        return true;
-      }
-      HASH_GUARD(0x56B908FC91C834D8LL, magickflopimage) {
-        ci = &ci_magickflopimage;
-        return true;
-      }
-      HASH_GUARD(0x1301F911ED6D54D8LL, is_nan) {
-        ci = &ci_is_nan;
-        return true;
-      }
-      HASH_GUARD(0x575C5AE3D2A694D8LL, ob_end_clean) {
-        ci = &ci_ob_end_clean;
-        return true;
-      }
-      break;
-    case 5343:
-      HASH_GUARD(0x747A7F585CD694DFLL, zend_version) {
-        ci = &ci_zend_version;
-        return true;
-      }
-      break;
-    case 5347:
-      HASH_GUARD(0x7D57A0D72D6254E3LL, ob_implicit_flush) {
-        ci = &ci_ob_implicit_flush;
-        return true;
-      }
-      break;
-    case 5358:
-      HASH_GUARD(0x5895ADDD91F354EELL, hphp_thread_set_warmup_enabled) {
-        ci = &ci_hphp_thread_set_warmup_enabled;
-        return true;
-      }
-      break;
-    case 5362:
-      HASH_GUARD(0x41276F8DE35354F2LL, dom_document_get_elements_by_tag_name) {
-        ci = &ci_dom_document_get_elements_by_tag_name;
-        return true;
-      }
-      break;
-    case 5364:
-      HASH_GUARD(0x436B36C5EB8DB4F4LL, mcrypt_generic) {
-        ci = &ci_mcrypt_generic;
-        return true;
-      }
-      break;
-    case 5365:
-      HASH_GUARD(0x112A0ACDD8B9D4F5LL, mb_list_mime_names) {
-        ci = &ci_mb_list_mime_names;
-        return true;
-      }
-      break;
-    case 5383:
-      HASH_GUARD(0x4FC9FE38A748B507LL, intl_get_error_message) {
-        ci = &ci_intl_get_error_message;
-        return true;
-      }
-      break;
-    case 5384:
-      HASH_GUARD(0x63A08D6AD1209508LL, magickgetexception) {
-        ci = &ci_magickgetexception;
-        return true;
-      }
-      break;
-    case 5393:
-      HASH_GUARD(0x3C0304A55503D511LL, magickgetimageiterations) {
-        ci = &ci_magickgetimageiterations;
-        return true;
-      }
-      break;
-    case 5395:
-      HASH_GUARD(0x772E8BF114FEF513LL, eregi_replace) {
-        ci = &ci_eregi_replace;
-        return true;
-      }
-      break;
-    case 5396:
-      HASH_GUARD(0x100385A0988FD514LL, magickgetfilename) {
-        ci = &ci_magickgetfilename;
-        return true;
-      }
-      break;
-    case 5410:
-      HASH_GUARD(0x7DA98E0379D33522LL, chdir) {
-        ci = &ci_chdir;
-        return true;
-      }
-      break;
-    case 5413:
-      HASH_GUARD(0x230FE1D6EC599525LL, link) {
-        ci = &ci_link;
-        return true;
-      }
-      break;
-    case 5420:
-      HASH_GUARD(0x1AB55BBA0967952CLL, mb_convert_variables) {
-        ci = &ci_mb_convert_variables;
-        return true;
-      }
-      break;
-    case 5423:
-      HASH_GUARD(0x6770E2559C9A152FLL, openssl_private_decrypt) {
-        ci = &ci_openssl_private_decrypt;
-        return true;
-      }
-      break;
-    case 5425:
-      HASH_GUARD(0x6776C27C6123D531LL, dl) {
-        ci = &ci_dl;
-        return true;
-      }
-      break;
-    case 5426:
-      HASH_GUARD(0x6193A26936F4D532LL, disk_total_space) {
-        ci = &ci_disk_total_space;
-        return true;
-      }
-      HASH_GUARD(0x684966A7B9C15532LL, hphp_get_iterator) {
-        ci = &ci_hphp_get_iterator;
-        return true;
-      }
-      break;
-    case 5429:
-      HASH_GUARD(0x6C87406DDC0AB535LL, mcrypt_ecb) {
-        ci = &ci_mcrypt_ecb;
-        return true;
-      }
-      break;
-    case 5430:
-      HASH_GUARD(0x0E80D04691227536LL, eval) {
-        ci = &ci_eval;
-        return true;
-      }
-      break;
-    case 5431:
-      HASH_GUARD(0x0830FF7C379D7537LL, dom_text_split_text) {
-        ci = &ci_dom_text_split_text;
-        return true;
-      }
-      HASH_GUARD(0x557C72DE98679537LL, hash_update_stream) {
-        ci = &ci_hash_update_stream;
-        return true;
-      }
-      break;
-    case 5433:
-      HASH_GUARD(0x3C88F0FAC3EDD539LL, phpversion) {
-        ci = &ci_phpversion;
-        return true;
-      }
-      break;
-    case 5436:
-      HASH_GUARD(0x5CA55E62F2A5953CLL, drawgetstrokeopacity) {
-        ci = &ci_drawgetstrokeopacity;
-        return true;
-      }
-      break;
-    case 5438:
-      HASH_GUARD(0x36A80B48E08B753ELL, implode) {
-        ci = &ci_implode;
-        return true;
-      }
-      break;
-    case 5443:
-      HASH_GUARD(0x0962EACAE0F0B543LL, hphp_splfileinfo_getlinktarget) {
-        ci = &ci_hphp_splfileinfo_getlinktarget;
-        return true;
-      }
-      break;
-    case 5444:
-      HASH_GUARD(0x4D397FE5D0C0B544LL, magickmedianfilterimage) {
-        ci = &ci_magickmedianfilterimage;
-        return true;
-      }
-      break;
-    case 5451:
-      HASH_GUARD(0x40CE61115E11154BLL, msg_stat_queue) {
-        ci = &ci_msg_stat_queue;
-        return true;
-      }
-      break;
-    case 5452:
-      HASH_GUARD(0x1D011CB0E810D54CLL, pdo_drivers) {
-        ci = &ci_pdo_drivers;
-        return true;
-      }
-      break;
-    case 5453:
-      HASH_GUARD(0x0F0702D91EAFB54DLL, drawgettextantialias) {
-        ci = &ci_drawgettextantialias;
-        return true;
-      }
-      break;
-    case 5455:
-      HASH_GUARD(0x30DE78E7131B954FLL, furchash_hphp_ext_supported) {
-        ci = &ci_furchash_hphp_ext_supported;
-        return true;
-      }
-      break;
-    case 5466:
-      HASH_GUARD(0x268EE73DB2EA555ALL, get_object_vars) {
-        ci = &ci_get_object_vars;
-        return true;
-      }
-      break;
-    case 5468:
-      HASH_GUARD(0x5749AD20CAFCD55CLL, pixelgetbluequantum) {
-        ci = &ci_pixelgetbluequantum;
-        return true;
-      }
-      break;
-    case 5475:
-      HASH_GUARD(0x1B1B2D70792D9563LL, mysql_get_client_info) {
-        ci = &ci_mysql_get_client_info;
-        return true;
-      }
-      break;
-    case 5478:
-      HASH_GUARD(0x6E2FDBD28F895566LL, timezone_abbreviations_list) {
-        ci = &ci_timezone_abbreviations_list;
-        return true;
-      }
-      break;
-    case 5487:
-      HASH_GUARD(0x016722439BBA756FLL, filetype) {
-        ci = &ci_filetype;
-        return true;
-      }
-      break;
-    case 5489:
-      HASH_GUARD(0x2AD3361DE8B1D571LL, pcntl_signal_dispatch) {
-        ci = &ci_pcntl_signal_dispatch;
-        return true;
-      }
-      break;
-    case 5492:
-      HASH_GUARD(0x636C871213F37574LL, mcrypt_encrypt) {
-        ci = &ci_mcrypt_encrypt;
-        return true;
-      }
-      break;
-    case 5495:
-      HASH_GUARD(0x412521E7ADB21577LL, iconv_mime_decode_headers) {
-        ci = &ci_iconv_mime_decode_headers;
-        return true;
-      }
-      HASH_GUARD(0x1E154D823451B577LL, magicksetresolution) {
-        ci = &ci_magicksetresolution;
-        return true;
-      }
-      break;
-    case 5502:
-      HASH_GUARD(0x31529E9BCA1E157ELL, shm_remove) {
-        ci = &ci_shm_remove;
-        return true;
-      }
-      break;
-    case 5506:
-      HASH_GUARD(0x0B1F0EB755BDB582LL, ispixeliterator) {
-        ci = &ci_ispixeliterator;
-        return true;
-      }
-      break;
-    case 5530:
-      HASH_GUARD(0x77F1EDE7D5EF759ALL, apc_cache_info) {
-        ci = &ci_apc_cache_info;
-        return true;
-      }
-      break;
-    case 5531:
-      HASH_GUARD(0x37D003B09D0C759BLL, stream_get_contents) {
-        ci = &ci_stream_get_contents;
-        return true;
-      }
-      break;
-    case 5536:
-      HASH_GUARD(0x20502FCACBB9F5A0LL, convert_uuencode) {
-        ci = &ci_convert_uuencode;
-        return true;
-      }
-      break;
-    case 5537:
-      HASH_GUARD(0x297690F3A63335A1LL, magickrotateimage) {
-        ci = &ci_magickrotateimage;
-        return true;
-      }
-      break;
-    case 5540:
-      HASH_GUARD(0x3C014439AE5D75A4LL, magickgetcharheight) {
-        ci = &ci_magickgetcharheight;
-        return true;
-      }
-      break;
-    case 5548:
-      HASH_GUARD(0x763BA2B1C60A55ACLL, pixelgetalphaquantum) {
-        ci = &ci_pixelgetalphaquantum;
-        return true;
-      }
-      break;
-    case 5551:
-      HASH_GUARD(0x1636FBA5043CF5AFLL, ldap_error) {
-        ci = &ci_ldap_error;
-        return true;
-      }
-      break;
-    case 5554:
-      HASH_GUARD(0x1887622B9AAE75B2LL, imap_mime_header_decode) {
-        ci = &ci_imap_mime_header_decode;
-        return true;
-      }
-      break;
-    case 5555:
-      HASH_GUARD(0x001DBE44BC0B55B3LL, magicksetimagecolormapcolor) {
-        ci = &ci_magicksetimagecolormapcolor;
-        return true;
-      }
-      HASH_GUARD(0x7AFA32F70E8195B3LL, xbox_set_thread_timeout) {
-        ci = &ci_xbox_set_thread_timeout;
-        return true;
-      }
-      break;
-    case 5557:
-      HASH_GUARD(0x3F9C5B4708FC55B5LL, timezone_name_get) {
-        ci = &ci_timezone_name_get;
-        return true;
-      }
-      break;
-    case 5558:
-      HASH_GUARD(0x1A05907F563235B6LL, collator_set_attribute) {
-        ci = &ci_collator_set_attribute;
-        return true;
-      }
-      break;
-    case 5569:
-      HASH_GUARD(0x7731B90FB7C975C1LL, magickremoveimageprofile) {
-        ci = &ci_magickremoveimageprofile;
-        return true;
-      }
-      break;
-    case 5577:
-      HASH_GUARD(0x75B299F5E35A95C9LL, mb_strwidth) {
-        ci = &ci_mb_strwidth;
-        return true;
-      }
-      HASH_GUARD(0x60F8818C0F38D5C9LL, hphp_directoryiterator___tostring) {
-        ci = &ci_hphp_directoryiterator___tostring;
-        return true;
-      }
-      break;
-    case 5588:
-      HASH_GUARD(0x2FE56B4C457AB5D4LL, ctype_graph) {
-        ci = &ci_ctype_graph;
-        return true;
-      }
-      break;
-    case 5605:
-      HASH_GUARD(0x470F990B218315E5LL, fb_unset_taint) {
-        ci = &ci_fb_unset_taint;
-        return true;
-      }
-      break;
-    case 5610:
-      HASH_GUARD(0x0B7ACBAB402015EALL, mb_send_mail) {
-        ci = &ci_mb_send_mail;
-        return true;
-      }
-      break;
-    case 5621:
-      HASH_GUARD(0x0D1BD0E5AF4175F5LL, drawsetfont) {
-        ci = &ci_drawsetfont;
-        return true;
-      }
-      HASH_GUARD(0x73A1F34DF95B35F5LL, get_defined_constants) {
-        ci = &ci_get_defined_constants;
-        return true;
-      }
-      break;
-    case 5624:
-      HASH_GUARD(0x7C48F6EA39B7B5F8LL, magickadaptivethresholdimage) {
-        ci = &ci_magickadaptivethresholdimage;
-        return true;
-      }
-      break;
-    case 5627:
-      HASH_GUARD(0x0FEC4ED541B7F5FBLL, magickgetimagevirtualpixelmethod) {
-        ci = &ci_magickgetimagevirtualpixelmethod;
-        return true;
-      }
-      break;
-    case 5628:
-      HASH_GUARD(0x39156C7CCE2D75FCLL, hash_update) {
-        ci = &ci_hash_update;
-        return true;
-      }
-      break;
-    case 5630:
-      HASH_GUARD(0x397D3C6576ED75FELL, set_include_path) {
-        ci = &ci_set_include_path;
-        return true;
-      }
-      break;
-    case 5631:
-      HASH_GUARD(0x40A557CBB9FC35FFLL, mysql_tablename) {
-        ci = &ci_mysql_tablename;
-        return true;
-      }
-      break;
-    case 5632:
-      HASH_GUARD(0x552D7CAD93755600LL, dom_document_create_comment) {
-        ci = &ci_dom_document_create_comment;
-        return true;
-      }
-      break;
-    case 5653:
-      HASH_GUARD(0x6AD774816F8F7615LL, mb_strrchr) {
-        ci = &ci_mb_strrchr;
-        return true;
-      }
-      break;
-    case 5657:
-      HASH_GUARD(0x6DD51BF03F003619LL, mailparse_uudecode_all) {
-        ci = &ci_mailparse_uudecode_all;
-        return true;
-      }
-      HASH_GUARD(0x2F29627AF1A97619LL, shm_attach) {
-        ci = &ci_shm_attach;
-        return true;
-      }
-      break;
-    case 5660:
-      HASH_GUARD(0x70725954DC99F61CLL, mcrypt_create_iv) {
-        ci = &ci_mcrypt_create_iv;
-        return true;
-      }
-      break;
-    case 5661:
-      HASH_GUARD(0x69E1368FD737F61DLL, dom_namednodemap_get_named_item) {
-        ci = &ci_dom_namednodemap_get_named_item;
-        return true;
-      }
-      break;
-    case 5665:
-      HASH_GUARD(0x0F71DDE51AA55621LL, hphp_output_global_state) {
-        ci = &ci_hphp_output_global_state;
-        return true;
-      }
-      break;
-    case 5672:
-      HASH_GUARD(0x1E77B3BCF062D628LL, magickreadimage) {
-        ci = &ci_magickreadimage;
-        return true;
-      }
-      break;
-    case 5676:
-      HASH_GUARD(0x5CEA60D9C54A162CLL, pcntl_wifstopped) {
-        ci = &ci_pcntl_wifstopped;
-        return true;
-      }
-      break;
-    case 5679:
-      HASH_GUARD(0x652C331CE138362FLL, is_string) {
-        ci = &ci_is_string;
-        return true;
-      }
-      break;
-    case 5684:
-      HASH_GUARD(0x5E6328F2E6C61634LL, imap_binary) {
-        ci = &ci_imap_binary;
-        return true;
-      }
-      break;
-    case 5687:
-      HASH_GUARD(0x60276BC7990F9637LL, mysql_list_dbs) {
-        ci = &ci_mysql_list_dbs;
-        return true;
-      }
-      HASH_GUARD(0x75AFA49220C9B637LL, collator_sort) {
-        ci = &ci_collator_sort;
-        return true;
-      }
-      break;
-    case 5694:
-      HASH_GUARD(0x60302D15A677963ELL, ldap_free_result) {
-        ci = &ci_ldap_free_result;
-        return true;
-      }
-      break;
-    case 5695:
-      HASH_GUARD(0x17242BC6C9C9563FLL, crypt) {
-        ci = &ci_crypt;
-        return true;
-      }
-      break;
-    case 5702:
-      HASH_GUARD(0x4901517CB796F646LL, msg_set_queue) {
-        ci = &ci_msg_set_queue;
-        return true;
-      }
-      break;
-    case 5710:
-      HASH_GUARD(0x769E5C6A5369F64ELL, ob_list_handlers) {
-        ci = &ci_ob_list_handlers;
-        return true;
-      }
-      break;
-    case 5711:
-      HASH_GUARD(0x1F3F16CED6BDD64FLL, imap_utf8) {
-        ci = &ci_imap_utf8;
-        return true;
-      }
-      break;
-    case 5717:
-      HASH_GUARD(0x629EDDC1E74ED655LL, array_uintersect_assoc) {
-        ci = &ci_array_uintersect_assoc;
-        return true;
-      }
-      break;
-    case 5726:
-      HASH_GUARD(0x205BB9CFF397B65ELL, ldap_mod_replace) {
-        ci = &ci_ldap_mod_replace;
-        return true;
-      }
-      break;
-    case 5727:
-      HASH_GUARD(0x1355AFB40AB1165FLL, drawsetfontstyle) {
-        ci = &ci_drawsetfontstyle;
-        return true;
-      }
-      break;
-    case 5730:
-      HASH_GUARD(0x5629E14D6B9FF662LL, dom_document_get_element_by_id) {
-        ci = &ci_dom_document_get_element_by_id;
-        return true;
-      }
-      break;
-    case 5747:
-      HASH_GUARD(0x126FC82D358E9673LL, magicksetimagevirtualpixelmethod) {
-        ci = &ci_magicksetimagevirtualpixelmethod;
-        return true;
-      }
-      break;
-    case 5751:
-      HASH_GUARD(0x001F23CAC36E3677LL, magickgetimagescene) {
-        ci = &ci_magickgetimagescene;
-        return true;
-      }
-      break;
-    case 5755:
-      HASH_GUARD(0x5BCED33A57D9B67BLL, intval) {
-        ci = &ci_intval;
-        return true;
-      }
-      break;
-    case 5756:
-      HASH_GUARD(0x43B1BAFFB27F367CLL, session_is_registered) {
-        ci = &ci_session_is_registered;
-        return true;
-      }
-      break;
-    case 5757:
-      HASH_GUARD(0x69616E2817E1967DLL, fileinode) {
-        ci = &ci_fileinode;
-        return true;
-      }
-      break;
-    case 5762:
-      HASH_GUARD(0x5F6750E1C7E5D682LL, imageinterlace) {
-        ci = &ci_imageinterlace;
-        return true;
-      }
-      break;
-    case 5773:
-      HASH_GUARD(0x07A946E3DD8E968DLL, ldap_connect) {
-        ci = &ci_ldap_connect;
-        return true;
-      }
-      break;
-    case 5775:
-      HASH_GUARD(0x2EFF4F69EB1DF68FLL, apache_get_config) {
-        ci = &ci_apache_get_config;
-        return true;
-      }
-      break;
-    case 5779:
-      HASH_GUARD(0x7CA1300231493693LL, imap_get_quota) {
-        ci = &ci_imap_get_quota;
-        return true;
-      }
-      break;
-    case 5781:
-      HASH_GUARD(0x7186EF5EF0581695LL, exp) {
-        ci = &ci_exp;
-        return true;
-      }
-      break;
-    case 5782:
-      HASH_GUARD(0x0DD7A2DB53093696LL, utf8_decode) {
-        ci = &ci_utf8_decode;
-        return true;
-      }
-      break;
-    case 5799:
-      HASH_GUARD(0x38BBEE42F136D6A7LL, magickgetimageblueprimary) {
-        ci = &ci_magickgetimageblueprimary;
-        return true;
-      }
-      break;
-    case 5802:
-      HASH_GUARD(0x6E9D4D3A119D76AALL, wandgetexceptiontype) {
-        ci = &ci_wandgetexceptiontype;
-        return true;
-      }
-      HASH_GUARD(0x48C4DB333172F6AALL, parse_url) {
-        ci = &ci_parse_url;
-        return true;
-      }
-      break;
-    case 5803:
-      HASH_GUARD(0x72B3F8E02D8B16ABLL, array_unshift) {
-        ci = &ci_array_unshift;
-        return true;
-      }
-      break;
-    case 5807:
-      HASH_GUARD(0x65497D63C0D716AFLL, getdate) {
-        ci = &ci_getdate;
-        return true;
-      }
-      break;
-    case 5813:
-      HASH_GUARD(0x798B4197212456B5LL, bcpowmod) {
-        ci = &ci_bcpowmod;
-        return true;
-      }
-      HASH_GUARD(0x7E773A36449576B5LL, imagecharup) {
-        ci = &ci_imagecharup;
-        return true;
-      }
-      break;
-    case 5818:
-      HASH_GUARD(0x72B901C3605CB6BALL, pixelsetopacity) {
-        ci = &ci_pixelsetopacity;
-        return true;
-      }
-      break;
-    case 5822:
-      HASH_GUARD(0x081D5EA9920076BELL, drawgetfillalpha) {
-        ci = &ci_drawgetfillalpha;
-        return true;
-      }
-      break;
-    case 5829:
-      HASH_GUARD(0x28526EF49FF516C5LL, pixelsetgreenquantum) {
-        ci = &ci_pixelsetgreenquantum;
-        return true;
-      }
-      break;
-    case 5834:
-      HASH_GUARD(0x41BCD0A72B1396CALL, xmlwriter_start_dtd_attlist) {
-        ci = &ci_xmlwriter_start_dtd_attlist;
-        return true;
-      }
-      break;
-    case 5841:
-      HASH_GUARD(0x2B3D5B9AF915D6D1LL, imagecopymerge) {
-        ci = &ci_imagecopymerge;
-        return true;
-      }
-      break;
-    case 5842:
-      HASH_GUARD(0x1FDF80EA9B8A96D2LL, collator_set_strength) {
-        ci = &ci_collator_set_strength;
-        return true;
-      }
-      break;
-    case 5844:
-      HASH_GUARD(0x04A0E6E8337E56D4LL, drawcolor) {
-        ci = &ci_drawcolor;
-        return true;
-      }
-      break;
-    case 5845:
-      HASH_GUARD(0x317FFA522A7D96D5LL, imagefilledpolygon) {
-        ci = &ci_imagefilledpolygon;
-        return true;
-      }
-      break;
-    case 5857:
-      HASH_GUARD(0x11DA0A0EB8E0D6E1LL, clock_getres) {
-        ci = &ci_clock_getres;
-        return true;
-      }
-      break;
-    case 5860:
-      HASH_GUARD(0x1CF3544CB5C9D6E4LL, xml_set_processing_instruction_handler) {
-        ci = &ci_xml_set_processing_instruction_handler;
-        return true;
-      }
-      HASH_GUARD(0x31FFFC333AA6D6E4LL, drawsetfillrule) {
-        ci = &ci_drawsetfillrule;
-        return true;
-      }
-      break;
-    case 5863:
-      HASH_GUARD(0x44201A16F3D876E7LL, trim) {
-        ci = &ci_trim;
-        return true;
-      }
-      break;
-    case 5869:
-      HASH_GUARD(0x04BD4B43921956EDLL, ldap_search) {
-        ci = &ci_ldap_search;
-        return true;
-      }
-      break;
-    case 5870:
-      HASH_GUARD(0x76382756EA00B6EELL, is_object) {
-        ci = &ci_is_object;
-        return true;
-      }
-      break;
-    case 5872:
-      HASH_GUARD(0x014BD9A6823256F0LL, extract) {
-        ci = &ci_extract;
-        return true;
-      }
-      break;
-    case 5875:
-      HASH_GUARD(0x6F1968BE449FB6F3LL, stream_socket_pair) {
-        ci = &ci_stream_socket_pair;
-        return true;
-      }
-      break;
-    case 5881:
-      HASH_GUARD(0x20740D956F0236F9LL, image2wbmp) {
-        ci = &ci_image2wbmp;
-        return true;
-      }
-      break;
-    case 5889:
-      HASH_GUARD(0x1A80392751AA7701LL, magickgetformat) {
-        ci = &ci_magickgetformat;
-        return true;
-      }
-      break;
-    case 5892:
-      HASH_GUARD(0x5EFE15CE970A5704LL, drawpolyline) {
-        ci = &ci_drawpolyline;
-        return true;
-      }
-      break;
-    case 5899:
-      HASH_GUARD(0x27AF8F6A5DF0B70BLL, dom_document_xinclude) {
-        ci = &ci_dom_document_xinclude;
-        return true;
-      }
-      break;
-    case 5901:
-      HASH_GUARD(0x7CE752299E80B70DLL, unserialize) {
-        ci = &ci_unserialize;
-        return true;
-      }
-      HASH_GUARD(0x4F3C0DB2F6C8F70DLL, unlink) {
-        ci = &ci_unlink;
-        return true;
-      }
-      break;
-    case 5908:
-      HASH_GUARD(0x1778ED2AF035F714LL, rsort) {
-        ci = &ci_rsort;
-        return true;
-      }
-      break;
-    case 5909:
-      HASH_GUARD(0x25D578B4772C1715LL, define) {
-        ci = &ci_define;
-        return true;
-      }
-      break;
-    case 5912:
-      HASH_GUARD(0x7971A5647C957718LL, date_time_set) {
-        ci = &ci_date_time_set;
-        return true;
-      }
-      break;
-    case 5920:
-      HASH_GUARD(0x2D213FD80048F720LL, usleep) {
-        ci = &ci_usleep;
-        return true;
-      }
-      break;
-    case 5926:
-      HASH_GUARD(0x523AB2EA95DAD726LL, get_included_files) {
-        ci = &ci_get_included_files;
-        return true;
-      }
-      break;
-    case 5927:
-      HASH_GUARD(0x11641BE0F11CD727LL, magickgammaimage) {
-        ci = &ci_magickgammaimage;
-        return true;
-      }
-      break;
-    case 5929:
-      HASH_GUARD(0x1D30F1E638D71729LL, readgzfile) {
-        ci = &ci_readgzfile;
-        return true;
-      }
-      break;
-    case 5933:
-      HASH_GUARD(0x14563723F798172DLL, magickpaintopaqueimage) {
-        ci = &ci_magickpaintopaqueimage;
-        return true;
-      }
-      break;
-    case 5946:
-      HASH_GUARD(0x404236CC5ABD973ALL, xhprof_run_trace) {
-        ci = &ci_xhprof_run_trace;
-        return true;
-      }
-      break;
-    case 5953:
-      HASH_GUARD(0x5062777D2B947741LL, wordwrap) {
-        ci = &ci_wordwrap;
-        return true;
-      }
-      break;
-    case 5961:
-      HASH_GUARD(0x73E4417BA7B49749LL, curl_multi_info_read) {
-        ci = &ci_curl_multi_info_read;
-        return true;
-      }
-      break;
-    case 5962:
-      HASH_GUARD(0x1FF03B7DE19DD74ALL, drawpathmovetorelative) {
-        ci = &ci_drawpathmovetorelative;
-        return true;
-      }
-      break;
-    case 5963:
-      HASH_GUARD(0x7DA9307A6149B74BLL, get_meta_tags) {
-        ci = &ci_get_meta_tags;
-        return true;
-      }
-      break;
-    case 5969:
-      HASH_GUARD(0x017FF216C00D9751LL, property_exists) {
-        ci = &ci_property_exists;
-        return true;
-      }
-      break;
-    case 5979:
-      HASH_GUARD(0x05D293F45C15F75BLL, ldap_mod_del) {
-        ci = &ci_ldap_mod_del;
-        return true;
-      }
-      HASH_GUARD(0x0ED4D905630EB75BLL, openssl_random_pseudo_bytes) {
-        ci = &ci_openssl_random_pseudo_bytes;
-        return true;
-      }
-      break;
-    case 5980:
-      HASH_GUARD(0x6D5B592E524AF75CLL, hphp_splfileinfo_getbasename) {
-        ci = &ci_hphp_splfileinfo_getbasename;
-        return true;
-      }
-      break;
-    case 5989:
-      HASH_GUARD(0x1D803CE961921765LL, md5) {
-        ci = &ci_md5;
-        return true;
-      }
-      HASH_GUARD(0x45631C592AD6D765LL, str_ireplace) {
-        ci = &ci_str_ireplace;
-        return true;
-      }
-      break;
-    case 5990:
-      HASH_GUARD(0x1F4505BE6460D766LL, scandir) {
-        ci = &ci_scandir;
-        return true;
-      }
-      break;
-    case 5997:
-      HASH_GUARD(0x3304663FBC6C976DLL, get_html_translation_table) {
-        ci = &ci_get_html_translation_table;
-        return true;
-      }
-      HASH_GUARD(0x553ADA5A41AE976DLL, mb_ereg_replace) {
-        ci = &ci_mb_ereg_replace;
-        return true;
-      }
-      break;
-    case 5998:
-      HASH_GUARD(0x6DB71D850799D76ELL, hphp_splfileobject_fscanf) {
-        ci = &ci_hphp_splfileobject_fscanf;
-        return true;
-      }
-      break;
-    case 6000:
-      HASH_GUARD(0x5DD71E685F179770LL, cpu_get_model) {
-        ci = &ci_cpu_get_model;
-        return true;
-      }
-      break;
-    case 6005:
-      HASH_GUARD(0x04D9076808F79775LL, getenv) {
-        ci = &ci_getenv;
-        return true;
-      }
-      break;
-    case 6006:
-      HASH_GUARD(0x4102C410C5031776LL, magickcolorizeimage) {
-        ci = &ci_magickcolorizeimage;
-        return true;
-      }
-      break;
-    case 6011:
-      HASH_GUARD(0x129E39AC523A977BLL, magickgethomeurl) {
-        ci = &ci_magickgethomeurl;
-        return true;
-      }
-      break;
-    case 6019:
-      HASH_GUARD(0x38704D99FEA9B783LL, mysql_fetch_array) {
-        ci = &ci_mysql_fetch_array;
-        return true;
-      }
-      break;
-    case 6020:
-      HASH_GUARD(0x784FD2E7191A3784LL, drawpathellipticarcrelative) {
-        ci = &ci_drawpathellipticarcrelative;
-        return true;
-      }
-      break;
-    case 6021:
-      HASH_GUARD(0x5BFC6198960A5785LL, in_array) {
-        ci = &ci_in_array;
-        return true;
-      }
-      break;
-    case 6023:
-      HASH_GUARD(0x4991643BD854D787LL, drawgetexceptionstring) {
-        ci = &ci_drawgetexceptionstring;
-        return true;
-      }
-      break;
-    case 6024:
-      HASH_GUARD(0x32D8CE5D0FA6D788LL, ldap_rename) {
-        ci = &ci_ldap_rename;
-        return true;
-      }
-      break;
-    case 6038:
-      HASH_GUARD(0x5B42B2AB1B57D796LL, array_replace) {
-        ci = &ci_array_replace;
-        return true;
-      }
-      break;
-    case 6043:
-      HASH_GUARD(0x1196D899ACCD379BLL, evhttp_recv) {
-        ci = &ci_evhttp_recv;
-        return true;
-      }
-      break;
-    case 6045:
-      HASH_GUARD(0x02ECD8C169DF579DLL, feof) {
-        ci = &ci_feof;
-        return true;
-      }
-      break;
-    case 6047:
-      HASH_GUARD(0x4B092931EFB7979FLL, mysql_create_db) {
-        ci = &ci_mysql_create_db;
-        return true;
-      }
-      break;
-    case 6057:
-      HASH_GUARD(0x7707A7FEA07FB7A9LL, hphp_recursivedirectoryiterator___construct) {
-        ci = &ci_hphp_recursivedirectoryiterator___construct;
-        return true;
-      }
-      break;
-    case 6061:
-      HASH_GUARD(0x7DA08D9D148837ADLL, posix_mkfifo) {
-        ci = &ci_posix_mkfifo;
-        return true;
-      }
-      break;
-    case 6062:
-      HASH_GUARD(0x00141B0E3E6F77AELL, xml_set_unparsed_entity_decl_handler) {
-        ci = &ci_xml_set_unparsed_entity_decl_handler;
-        return true;
-      }
-      break;
-    case 6063:
-      HASH_GUARD(0x16CB9891EF26D7AFLL, drawgetstrokedashoffset) {
-        ci = &ci_drawgetstrokedashoffset;
-        return true;
-      }
-      break;
-    case 6073:
-      HASH_GUARD(0x1FC9406FD7FCD7B9LL, strrpos) {
-        ci = &ci_strrpos;
-        return true;
-      }
-      break;
-    case 6081:
-      HASH_GUARD(0x4E172EA6743697C1LL, ldap_first_entry) {
-        ci = &ci_ldap_first_entry;
-        return true;
-      }
-      break;
-    case 6086:
-      HASH_GUARD(0x0C8A7BE6ABC957C6LL, clearpixeliterator) {
-        ci = &ci_clearpixeliterator;
-        return true;
-      }
-      break;
-    case 6087:
-      HASH_GUARD(0x686C5142FD0337C7LL, lcg_value) {
-        ci = &ci_lcg_value;
-        return true;
-      }
-      break;
-    case 6089:
-      HASH_GUARD(0x6BF7D7B5FBFF77C9LL, hphp_get_thread_id) {
-        ci = &ci_hphp_get_thread_id;
-        return true;
-      }
-      break;
-    case 6097:
-      HASH_GUARD(0x35B661C87484D7D1LL, openssl_csr_sign) {
-        ci = &ci_openssl_csr_sign;
-        return true;
-      }
-      break;
-    case 6116:
-      HASH_GUARD(0x2621680306BC97E4LL, magicksetimagescene) {
-        ci = &ci_magicksetimagescene;
-        return true;
-      }
-      break;
-    case 6119:
-      HASH_GUARD(0x4215DDB57604F7E7LL, xmlwriter_start_pi) {
-        ci = &ci_xmlwriter_start_pi;
-        return true;
-      }
-      break;
-    case 6125:
-      HASH_GUARD(0x0DC2C2D372EC97EDLL, hphp_crash_log) {
-        ci = &ci_hphp_crash_log;
-        return true;
-      }
-      break;
-    case 6127:
-      HASH_GUARD(0x5367B0F3A4D2D7EFLL, ldap_list) {
-        ci = &ci_ldap_list;
-        return true;
-      }
-      break;
-    case 6128:
-      HASH_GUARD(0x14F700DD189DB7F0LL, drawsetclipunits) {
-        ci = &ci_drawsetclipunits;
-        return true;
-      }
-      break;
-    case 6131:
-      HASH_GUARD(0x73877357478137F3LL, posix_ctermid) {
-        ci = &ci_posix_ctermid;
-        return true;
-      }
-      HASH_GUARD(0x7F436B50B7BBD7F3LL, getcwd) {
-        ci = &ci_getcwd;
-        return true;
-      }
-      break;
-    case 6146:
-      HASH_GUARD(0x2BA2A6480C563802LL, imap_errors) {
-        ci = &ci_imap_errors;
-        return true;
-      }
-      break;
-    case 6147:
-      HASH_GUARD(0x10F7244AA9CB5803LL, imagepstext) {
-        ci = &ci_imagepstext;
-        return true;
-      }
-      break;
-    case 6150:
-      HASH_GUARD(0x4D832DD6A72AB806LL, dom_document_create_attribute) {
-        ci = &ci_dom_document_create_attribute;
-        return true;
-      }
-      break;
-    case 6152:
-      HASH_GUARD(0x083B8F01AE15B808LL, assert) {
-        ci = &ci_assert;
-        return true;
-      }
-      break;
-    case 6153:
-      HASH_GUARD(0x52DCFB6F41D41809LL, dom_characterdata_append_data) {
-        ci = &ci_dom_characterdata_append_data;
-        return true;
-      }
-      HASH_GUARD(0x221F5A9D5E021809LL, magickwriteimages) {
-        ci = &ci_magickwriteimages;
-        return true;
-      }
-      break;
-    case 6154:
-      HASH_GUARD(0x5A0D1AE1D4C6F80ALL, array_slice) {
-        ci = &ci_array_slice;
-        return true;
-      }
-      break;
-    case 6157:
-      HASH_GUARD(0x727F5A6D8E26B80DLL, extension_loaded) {
-        ci = &ci_extension_loaded;
-        return true;
-      }
-      break;
-    case 6163:
-      HASH_GUARD(0x5F7940A713863813LL, floor) {
-        ci = &ci_floor;
-        return true;
-      }
-      break;
-    case 6164:
-      HASH_GUARD(0x3C0DFA15D3447814LL, rawurldecode) {
-        ci = &ci_rawurldecode;
-        return true;
-      }
-      break;
-    case 6167:
-      HASH_GUARD(0x0D8B1D0A8C381817LL, stream_bucket_new) {
-        ci = &ci_stream_bucket_new;
-        return true;
-      }
-      break;
-    case 6168:
-      HASH_GUARD(0x0FBDB0B22A59B818LL, mailparse_msg_parse) {
-        ci = &ci_mailparse_msg_parse;
-        return true;
-      }
-      break;
-    case 6173:
-      HASH_GUARD(0x4D624A655A9B581DLL, drawpoint) {
-        ci = &ci_drawpoint;
-        return true;
-      }
-      break;
-    case 6177:
-      HASH_GUARD(0x107DBCA79C15B821LL, addcslashes) {
-        ci = &ci_addcslashes;
-        return true;
-      }
-      break;
-    case 6185:
-      HASH_GUARD(0x57FFCEB7FA2D9829LL, usort) {
-        ci = &ci_usort;
-        return true;
-      }
-      break;
-    case 6190:
-      HASH_GUARD(0x3402C1E7544C382ELL, lstat) {
-        ci = &ci_lstat;
-        return true;
-      }
-      break;
-    case 6192:
-      HASH_GUARD(0x5BBFA7EAEBD25830LL, pixelgetcyanquantum) {
-        ci = &ci_pixelgetcyanquantum;
-        return true;
-      }
-      break;
-    case 6196:
-      HASH_GUARD(0x605132E71CE7D834LL, array_push) {
-        ci = &ci_array_push;
-        return true;
-      }
-      break;
-    case 6197:
-      HASH_GUARD(0x1C4A162E6635B835LL, imageftbbox) {
-        ci = &ci_imageftbbox;
-        return true;
-      }
-      HASH_GUARD(0x43A96BA7F58EB835LL, hphp_splfileobject_valid) {
-        ci = &ci_hphp_splfileobject_valid;
-        return true;
-      }
-      break;
-    case 6200:
-      HASH_GUARD(0x03098F16B0AD5838LL, mcrypt_module_get_supported_key_sizes) {
-        ci = &ci_mcrypt_module_get_supported_key_sizes;
-        return true;
-      }
-      break;
-    case 6203:
-      HASH_GUARD(0x63E2EA180786B83BLL, pixelsetblack) {
-        ci = &ci_pixelsetblack;
-        return true;
-      }
-      break;
-    case 6204:
-      HASH_GUARD(0x7C8969C75CA1783CLL, get_declared_classes) {
-        ci = &ci_get_declared_classes;
-        return true;
-      }
-      HASH_GUARD(0x034EDEBD109FD83CLL, filesize) {
-        ci = &ci_filesize;
-        return true;
-      }
-      break;
-    case 6220:
-      HASH_GUARD(0x26A2BBC465A2B84CLL, strcoll) {
-        ci = &ci_strcoll;
-        return true;
-      }
-      break;
-    case 6225:
-      HASH_GUARD(0x488BFCC942C73851LL, gzopen) {
-        ci = &ci_gzopen;
-        return true;
-      }
-      break;
-    case 6230:
-      HASH_GUARD(0x51FD8C9B5109F856LL, dom_characterdata_replace_data) {
-        ci = &ci_dom_characterdata_replace_data;
-        return true;
-      }
-      break;
-    case 6233:
-      HASH_GUARD(0x41924CBA5B717859LL, imap_append) {
-        ci = &ci_imap_append;
-        return true;
-      }
-      break;
-    case 6238:
-      HASH_GUARD(0x3D8327794429585ELL, hphpd_install_user_command) {
-        ci = &ci_hphpd_install_user_command;
-        return true;
-      }
-      break;
-    case 6241:
-      HASH_GUARD(0x2AD6B0E3B9F3B861LL, array_search) {
-        ci = &ci_array_search;
-        return true;
-      }
-      break;
-    case 6243:
-      HASH_GUARD(0x21B30164F5D49863LL, is_resource) {
-        ci = &ci_is_resource;
-        return true;
-      }
-      break;
-    case 6247:
-      HASH_GUARD(0x65A68A31B96E7867LL, hash) {
-        ci = &ci_hash;
-        return true;
-      }
-      break;
-    case 6249:
-      HASH_GUARD(0x246EC2B1844DB869LL, pixelgetexception) {
-        ci = &ci_pixelgetexception;
-        return true;
-      }
-      break;
-    case 6263:
-      HASH_GUARD(0x6AA3788C9B737877LL, magickdespeckleimage) {
-        ci = &ci_magickdespeckleimage;
-        return true;
-      }
-      break;
-    case 6264:
-      HASH_GUARD(0x011B54958C597878LL, get_called_class) {
-        ci = &ci_get_called_class;
-        return true;
-      }
-      HASH_GUARD(0x00F8C6758B50B878LL, drawpathcurvetoquadraticbezierabsolute) {
-        ci = &ci_drawpathcurvetoquadraticbezierabsolute;
-        return true;
-      }
-      break;
-    case 6267:
-      HASH_GUARD(0x3B8E5E63B5E0F87BLL, spl_autoload_call) {
-        ci = &ci_spl_autoload_call;
-        return true;
-      }
-      break;
-    case 6268:
-      HASH_GUARD(0x11DFC3C9D916387CLL, hphp_splfileobject_ftruncate) {
-        ci = &ci_hphp_splfileobject_ftruncate;
-        return true;
-      }
-      HASH_GUARD(0x6451BCB825D1787CLL, chroot) {
-        ci = &ci_chroot;
-        return true;
-      }
-      break;
-    case 6272:
-      HASH_GUARD(0x7549612A72BA5880LL, hphp_splfileinfo_getrealpath) {
-        ci = &ci_hphp_splfileinfo_getrealpath;
-        return true;
-      }
-      break;
-    case 6280:
-      HASH_GUARD(0x1062CF2DA5443888LL, imagedashedline) {
-        ci = &ci_imagedashedline;
-        return true;
-      }
-      break;
-    case 6287:
-      HASH_GUARD(0x5DDC2A079AB7988FLL, dom_document_schema_validate_file) {
-        ci = &ci_dom_document_schema_validate_file;
-        return true;
-      }
-      break;
-    case 6301:
-      HASH_GUARD(0x1FC855F0E4F1189DLL, magickminifyimage) {
-        ci = &ci_magickminifyimage;
-        return true;
-      }
-      break;
-    case 6305:
-      HASH_GUARD(0x1756D4437A4098A1LL, date_modify) {
-        ci = &ci_date_modify;
-        return true;
-      }
-      HASH_GUARD(0x71B0B871CB62B8A1LL, spl_autoload) {
-        ci = &ci_spl_autoload;
-        return true;
-      }
-      break;
-    case 6311:
-      HASH_GUARD(0x57105D4E43B078A7LL, magicksetformat) {
-        ci = &ci_magicksetformat;
-        return true;
-      }
-      HASH_GUARD(0x6C6B4B739AE1B8A7LL, curl_close) {
-        ci = &ci_curl_close;
-        return true;
-      }
-      break;
-    case 6313:
-      HASH_GUARD(0x346B2DB3BA2378A9LL, imagecolormatch) {
-        ci = &ci_imagecolormatch;
-        return true;
-      }
-      break;
-    case 6314:
-      HASH_GUARD(0x44BC069A75EE98AALL, xhprof_disable) {
-        ci = &ci_xhprof_disable;
-        return true;
-      }
-      break;
-    case 6315:
-      HASH_GUARD(0x39F11BA6A4D778ABLL, strnatcmp) {
-        ci = &ci_strnatcmp;
-        return true;
-      }
-      break;
-    case 6316:
-      HASH_GUARD(0x5B1F4C6424DDD8ACLL, openlog) {
-        ci = &ci_openlog;
-        return true;
-      }
-      break;
-    case 6320:
-      HASH_GUARD(0x2CEF8DDC092698B0LL, drawgetvectorgraphics) {
-        ci = &ci_drawgetvectorgraphics;
-        return true;
-      }
-      break;
-    case 6326:
-      HASH_GUARD(0x5866C5DF3A1AD8B6LL, dom_element_get_attribute_node) {
-        ci = &ci_dom_element_get_attribute_node;
-        return true;
-      }
-      break;
-    case 6363:
-      HASH_GUARD(0x4052842EC87038DBLL, magickcropimage) {
-        ci = &ci_magickcropimage;
-        return true;
-      }
-      break;
-    case 6376:
-      HASH_GUARD(0x4F7ED8C3156AD8E8LL, magicksetimagedispose) {
-        ci = &ci_magicksetimagedispose;
-        return true;
-      }
-      break;
-    case 6389:
-      HASH_GUARD(0x45DA105C5B48F8F5LL, apd_set_pprof_trace) {
-        ci = &ci_apd_set_pprof_trace;
-        return true;
-      }
-      break;
-    case 6396:
-      HASH_GUARD(0x4C2AFB2EFDB1B8FCLL, stripslashes) {
-        ci = &ci_stripslashes;
-        return true;
-      }
-      break;
-    case 6402:
-      HASH_GUARD(0x454DAD4DE5C29902LL, xhprof_frame_end) {
-        ci = &ci_xhprof_frame_end;
-        return true;
-      }
-      break;
-    case 6411:
-      HASH_GUARD(0x67B879A1120C190BLL, headers_sent) {
-        ci = &ci_headers_sent;
-        return true;
-      }
-      break;
-    case 6417:
-      HASH_GUARD(0x04F822B7817E5911LL, bindec) {
-        ci = &ci_bindec;
-        return true;
-      }
-      HASH_GUARD(0x0AFD4F231D6CB911LL, magickaddimage) {
-        ci = &ci_magickaddimage;
-        return true;
-      }
-      break;
-    case 6425:
-      HASH_GUARD(0x022B16C0D64D7919LL, file_put_contents) {
-        ci = &ci_file_put_contents;
-        return true;
-      }
-      break;
-    case 6431:
-      HASH_GUARD(0x277D7E2D1F5C191FLL, drawpathcurvetoquadraticbezierrelative) {
-        ci = &ci_drawpathcurvetoquadraticbezierrelative;
-        return true;
-      }
-      HASH_GUARD(0x4E2C55C92D71F91FLL, magickcolorfloodfillimage) {
-        ci = &ci_magickcolorfloodfillimage;
-        return true;
-      }
-      break;
-    case 6435:
-      HASH_GUARD(0x044B276686B77923LL, fscanf) {
-        ci = &ci_fscanf;
-        return true;
-      }
-      break;
-    case 6445:
-      HASH_GUARD(0x27363CE6CBFC392DLL, pcntl_wexitstatus) {
-        ci = &ci_pcntl_wexitstatus;
-        return true;
-      }
-      HASH_GUARD(0x2337F8C3EE17192DLL, sprintf) {
-        ci = &ci_sprintf;
-        return true;
-      }
-      break;
-    case 6447:
-      HASH_GUARD(0x13A6C6CAF50EB92FLL, imap_search) {
-        ci = &ci_imap_search;
-        return true;
-      }
-      break;
-    case 6448:
-      HASH_GUARD(0x30972530BD557930LL, shell_exec) {
-        ci = &ci_shell_exec;
-        return true;
-      }
-      break;
-    case 6450:
-      HASH_GUARD(0x72C01E1D90BE5932LL, mcrypt_enc_get_block_size) {
-        ci = &ci_mcrypt_enc_get_block_size;
-        return true;
-      }
-      break;
-    case 6453:
-      HASH_GUARD(0x06486B6912479935LL, zlib_get_coding_type) {
-        ci = &ci_zlib_get_coding_type;
-        return true;
-      }
-      HASH_GUARD(0x48D3CA6CA0B29935LL, mb_regex_set_options) {
-        ci = &ci_mb_regex_set_options;
-        return true;
-      }
-      break;
-    case 6462:
-      HASH_GUARD(0x3946D67A0D16D93ELL, hphp_splfileinfo_isreadable) {
-        ci = &ci_hphp_splfileinfo_isreadable;
-        return true;
-      }
-      break;
-    case 6471:
-      HASH_GUARD(0x1E694036FEBA3947LL, imap_fetchstructure) {
-        ci = &ci_imap_fetchstructure;
-        return true;
-      }
-      break;
-    case 6472:
-      HASH_GUARD(0x6A3412DE82715948LL, openssl_x509_checkpurpose) {
-        ci = &ci_openssl_x509_checkpurpose;
-        return true;
-      }
-      break;
-    case 6473:
-      HASH_GUARD(0x243BB8B284895949LL, apache_get_rewrite_rules) {
-        ci = &ci_apache_get_rewrite_rules;
-        return true;
-      }
-      break;
-    case 6475:
-      HASH_GUARD(0x37F356F578FA394BLL, substr) {
-        ci = &ci_substr;
-        return true;
-      }
-      break;
-    case 6476:
-      HASH_GUARD(0x10DB229871AB794CLL, imap_msgno) {
-        ci = &ci_imap_msgno;
-        return true;
-      }
-      break;
-    case 6483:
-      HASH_GUARD(0x068438AFD33A9953LL, imagecolorclosesthwb) {
-        ci = &ci_imagecolorclosesthwb;
-        return true;
-      }
-      break;
-    case 6511:
-      HASH_GUARD(0x134EF88685C0396FLL, magickgetexceptiontype) {
-        ci = &ci_magickgetexceptiontype;
-        return true;
-      }
-      break;
-    case 6513:
-      HASH_GUARD(0x442A28FB6F6C3971LL, xmlwriter_start_attribute) {
-        ci = &ci_xmlwriter_start_attribute;
-        return true;
-      }
-      HASH_GUARD(0x72C73F5DA7D6F971LL, magickgetimagecolormapcolor) {
-        ci = &ci_magickgetimagecolormapcolor;
-        return true;
-      }
-      break;
-    case 6528:
-      HASH_GUARD(0x3D3445105C335980LL, filectime) {
-        ci = &ci_filectime;
-        return true;
-      }
-      break;
-    case 6530:
-      HASH_GUARD(0x214EA70BDD8FB982LL, magickmorphimages) {
-        ci = &ci_magickmorphimages;
-        return true;
-      }
-      break;
-    case 6531:
-      HASH_GUARD(0x3DA64BF893DBF983LL, strncmp) {
-        ci = &ci_strncmp;
-        return true;
-      }
-      break;
-    case 6536:
-      HASH_GUARD(0x55BE7AE8DEF3F988LL, magickgetstringheight) {
-        ci = &ci_magickgetstringheight;
-        return true;
-      }
-      break;
-    case 6539:
-      HASH_GUARD(0x0E863EF8C11A598BLL, is_writable) {
-        ci = &ci_is_writable;
-        return true;
-      }
-      break;
-    case 6541:
-      HASH_GUARD(0x69003892F71C798DLL, apache_get_scoreboard) {
-        ci = &ci_apache_get_scoreboard;
-        return true;
-      }
-      HASH_GUARD(0x651A8CBB8D2A398DLL, mysql_stat) {
-        ci = &ci_mysql_stat;
-        return true;
-      }
-      break;
-    case 6542:
-      HASH_GUARD(0x45CFDEE19995398ELL, hphp_recursiveiteratoriterator_next) {
-        ci = &ci_hphp_recursiveiteratoriterator_next;
-        return true;
-      }
-      break;
-    case 6544:
-      HASH_GUARD(0x342D957A86A03990LL, hphp_splfileobject_seek) {
-        ci = &ci_hphp_splfileobject_seek;
-        return true;
-      }
-      break;
-    case 6558:
-      HASH_GUARD(0x59D2DFF08F4DB99ELL, imagecreate) {
-        ci = &ci_imagecreate;
-        return true;
-      }
-      break;
-    case 6564:
-      HASH_GUARD(0x6F8676B049C919A4LL, array_intersect_uassoc) {
-        ci = &ci_array_intersect_uassoc;
-        return true;
-      }
-      break;
-    case 6572:
-      HASH_GUARD(0x522256BAA78159ACLL, popen) {
-        ci = &ci_popen;
-        return true;
-      }
-      break;
-    case 6573:
-      HASH_GUARD(0x05C5AD90751159ADLL, drawpathcurvetoquadraticbeziersmoothabsolute) {
-        ci = &ci_drawpathcurvetoquadraticbeziersmoothabsolute;
-        return true;
-      }
-      break;
-    case 6575:
-      HASH_GUARD(0x25268012A48A99AFLL, magickclipimage) {
-        ci = &ci_magickclipimage;
-        return true;
-      }
-      break;
-    case 6582:
-      HASH_GUARD(0x5FC1B94446EA59B6LL, magickremoveimageprofiles) {
-        ci = &ci_magickremoveimageprofiles;
-        return true;
-      }
-      break;
-    case 6583:
-      HASH_GUARD(0x18F2C246FACAD9B7LL, each) {
-        ci = &ci_each;
-        return true;
-      }
-      break;
-    case 6584:
-      HASH_GUARD(0x3741447B159359B8LL, mcrypt_get_cipher_name) {
-        ci = &ci_mcrypt_get_cipher_name;
-        return true;
-      }
-      HASH_GUARD(0x4EFD7A9C90E559B8LL, posix_ttyname) {
-        ci = &ci_posix_ttyname;
-        return true;
-      }
-      break;
-    case 6585:
-      HASH_GUARD(0x145702974C97F9B9LL, ltrim) {
-        ci = &ci_ltrim;
-        return true;
-      }
-      break;
-    case 6586:
-      HASH_GUARD(0x13B3172E092D99BALL, is_dir) {
-        ci = &ci_is_dir;
-        return true;
-      }
-      break;
-    case 6596:
-      HASH_GUARD(0x47B7D3745D80B9C4LL, socket_get_option) {
-        ci = &ci_socket_get_option;
-        return true;
-      }
-      break;
-    case 6602:
-      HASH_GUARD(0x5C5B0CC85133B9CALL, mkdir) {
-        ci = &ci_mkdir;
-        return true;
-      }
-      break;
-    case 6603:
-      HASH_GUARD(0x032DFAC5B24679CBLL, header_remove) {
-        ci = &ci_header_remove;
-        return true;
-      }
-      break;
-    case 6610:
-      HASH_GUARD(0x3DCCD1FEAD8759D2LL, array_sum) {
-        ci = &ci_array_sum;
-        return true;
-      }
-      break;
-    case 6613:
-      HASH_GUARD(0x245860A2FE4CB9D5LL, socket_set_blocking) {
-        ci = &ci_socket_set_blocking;
-        return true;
-      }
-      break;
-    case 6623:
-      HASH_GUARD(0x349E2E0F2CD7B9DFLL, magickgetversion) {
-        ci = &ci_magickgetversion;
-        return true;
-      }
-      break;
-    case 6633:
-      HASH_GUARD(0x4ADFA265F07AB9E9LL, drawgettextalignment) {
-        ci = &ci_drawgettextalignment;
-        return true;
-      }
-      break;
-    case 6634:
-      HASH_GUARD(0x25DDD924EFE979EALL, hash_update_file) {
-        ci = &ci_hash_update_file;
-        return true;
-      }
-      break;
-    case 6635:
-      HASH_GUARD(0x71B0FF80B88459EBLL, diskfreespace) {
-        ci = &ci_diskfreespace;
-        return true;
-      }
-      break;
-    case 6639:
-      HASH_GUARD(0x7EA6200B688459EFLL, ldap_modify) {
-        ci = &ci_ldap_modify;
-        return true;
-      }
-      break;
-    case 6640:
-      HASH_GUARD(0x1FC307200E8959F0LL, stream_bucket_append) {
-        ci = &ci_stream_bucket_append;
-        return true;
-      }
-      break;
-    case 6645:
-      HASH_GUARD(0x35BABFBC091759F5LL, socket_server) {
-        ci = &ci_socket_server;
-        return true;
-      }
-      break;
-    case 6652:
-      HASH_GUARD(0x55814D0EC267B9FCLL, imap_status) {
-        ci = &ci_imap_status;
-        return true;
-      }
-      break;
-    case 6660:
-      HASH_GUARD(0x17B83C425BD09A04LL, atanh) {
-        ci = &ci_atanh;
-        return true;
-      }
-      break;
-    case 6663:
-      HASH_GUARD(0x391E0A4CF1EC9A07LL, stream_socket_recvfrom) {
-        ci = &ci_stream_socket_recvfrom;
-        return true;
-      }
-      break;
-    case 6664:
-      HASH_GUARD(0x0436CA4DFB315A08LL, soundex) {
-        ci = &ci_soundex;
-        return true;
-      }
-      break;
-    case 6667:
-      HASH_GUARD(0x70075DC878825A0BLL, ctype_lower) {
-        ci = &ci_ctype_lower;
-        return true;
-      }
-      break;
-    case 6669:
-      HASH_GUARD(0x736C133EFF8E5A0DLL, mysql_list_fields) {
-        ci = &ci_mysql_list_fields;
-        return true;
-      }
-      HASH_GUARD(0x50A7146A79877A0DLL, pcntl_alarm) {
-        ci = &ci_pcntl_alarm;
-        return true;
-      }
-      break;
-    case 6697:
-      HASH_GUARD(0x618D2A98986B1A29LL, ldap_unbind) {
-        ci = &ci_ldap_unbind;
-        return true;
-      }
-      break;
-    case 6708:
-      HASH_GUARD(0x2D948E4099975A34LL, restore_include_path) {
-        ci = &ci_restore_include_path;
-        return true;
-      }
-      HASH_GUARD(0x5AB266C6E7075A34LL, mysql_error) {
-        ci = &ci_mysql_error;
-        return true;
-      }
-      break;
-    case 6712:
-      HASH_GUARD(0x3E65EF9761BE5A38LL, pixelgetiteratorexceptiontype) {
-        ci = &ci_pixelgetiteratorexceptiontype;
-        return true;
-      }
-      break;
-    case 6715:
-      HASH_GUARD(0x785ECCF53D98BA3BLL, curl_multi_exec) {
-        ci = &ci_curl_multi_exec;
-        return true;
-      }
-      break;
-    case 6718:
-      HASH_GUARD(0x31C3A072D092FA3ELL, socket_create_listen) {
-        ci = &ci_socket_create_listen;
-        return true;
-      }
-      break;
-    case 6719:
-      HASH_GUARD(0x4C0E2C6882051A3FLL, magickgetresourcelimit) {
-        ci = &ci_magickgetresourcelimit;
-        return true;
-      }
-      break;
-    case 6722:
-      HASH_GUARD(0x128914E131AFFA42LL, microtime) {
-        ci = &ci_microtime;
-        return true;
-      }
-      HASH_GUARD(0x5FF7C3A6BDDCFA42LL, mb_convert_kana) {
-        ci = &ci_mb_convert_kana;
-        return true;
-      }
-      break;
-    case 6725:
-      HASH_GUARD(0x7CDF1FB642529A45LL, dom_characterdata_insert_data) {
-        ci = &ci_dom_characterdata_insert_data;
-        return true;
-      }
-      break;
-    case 6727:
-      HASH_GUARD(0x1B45CFF586F85A47LL, utf8_encode) {
-        ci = &ci_utf8_encode;
-        return true;
-      }
-      break;
-    case 6734:
-      HASH_GUARD(0x1635DCC4882CBA4ELL, dom_node_has_attributes) {
-        ci = &ci_dom_node_has_attributes;
-        return true;
-      }
-      break;
-    case 6747:
-      HASH_GUARD(0x2B18DFF183C0BA5BLL, mb_get_info) {
-        ci = &ci_mb_get_info;
-        return true;
-      }
-      break;
-    case 6758:
-      HASH_GUARD(0x60C4B9EEDBD5FA66LL, pos) {
-        ci = &ci_pos;
-        return true;
-      }
-      break;
-    case 6760:
-      HASH_GUARD(0x01DD2057FD9B1A68LL, xmlwriter_write_cdata) {
-        ci = &ci_xmlwriter_write_cdata;
-        return true;
-      }
-      HASH_GUARD(0x32AD0455A7689A68LL, magickoilpaintimage) {
-        ci = &ci_magickoilpaintimage;
-        return true;
-      }
-      break;
-    case 6761:
-      HASH_GUARD(0x10CDCF2BB4057A69LL, debug_zval_dump) {
-        ci = &ci_debug_zval_dump;
-        return true;
-      }
-      break;
-    case 6763:
-      HASH_GUARD(0x0912965F4440FA6BLL, str_repeat) {
-        ci = &ci_str_repeat;
-        return true;
-      }
-      break;
-    case 6769:
-      HASH_GUARD(0x5B5DA6AD0AD63A71LL, drawannotation) {
-        ci = &ci_drawannotation;
-        return true;
-      }
-      break;
-    case 6770:
-      HASH_GUARD(0x71AFF1D58D103A72LL, imagefontheight) {
-        ci = &ci_imagefontheight;
-        return true;
-      }
-      break;
-    case 6773:
-      HASH_GUARD(0x7A957BEC6CA57A75LL, preg_replace_callback) {
-        ci = &ci_preg_replace_callback;
-        return true;
-      }
-      break;
-    case 6781:
-      HASH_GUARD(0x414C2E31304E9A7DLL, stream_get_filters) {
-        ci = &ci_stream_get_filters;
-        return true;
-      }
-      break;
-    case 6786:
-      HASH_GUARD(0x79786FABC5551A82LL, jpeg2wbmp) {
-        ci = &ci_jpeg2wbmp;
-        return true;
-      }
-      break;
-    case 6787:
-      HASH_GUARD(0x11149278DB0A9A83LL, levenshtein) {
-        ci = &ci_levenshtein;
-        return true;
-      }
-      break;
-    case 6789:
-      HASH_GUARD(0x755DEFDEDF35DA85LL, ctype_print) {
-        ci = &ci_ctype_print;
-        return true;
-      }
-      break;
-    case 6792:
-      HASH_GUARD(0x1818A3CFBA357A88LL, magicksetwandsize) {
-        ci = &ci_magicksetwandsize;
-        return true;
-      }
-      break;
-    case 6795:
-      HASH_GUARD(0x7588BD0546C8BA8BLL, hphp_recursivedirectoryiterator_valid) {
-        ci = &ci_hphp_recursivedirectoryiterator_valid;
-        return true;
-      }
-      break;
-    case 6796:
-      HASH_GUARD(0x6A2EEE463F969A8CLL, getservbyname) {
-        ci = &ci_getservbyname;
-        return true;
-      }
-      break;
-    case 6802:
-      HASH_GUARD(0x1257DB9F159E9A92LL, magickmontageimage) {
-        ci = &ci_magickmontageimage;
-        return true;
-      }
-      break;
-    case 6803:
-      HASH_GUARD(0x4A32653C8E719A93LL, pixelgetcyan) {
-        ci = &ci_pixelgetcyan;
-        return true;
-      }
-      break;
-    case 6804:
-      HASH_GUARD(0x4B1501C4C22FFA94LL, quoted_printable_encode) {
-        ci = &ci_quoted_printable_encode;
-        return true;
-      }
-      break;
-    case 6805:
-      HASH_GUARD(0x34B8A4E5AE0EFA95LL, pixelgetopacity) {
-        ci = &ci_pixelgetopacity;
-        return true;
-      }
-      break;
-    case 6807:
-      HASH_GUARD(0x0089115038C03A97LL, array_diff_ukey) {
-        ci = &ci_array_diff_ukey;
-        return true;
-      }
-      break;
-    case 6809:
-      HASH_GUARD(0x1382CEA1527CFA99LL, imap_utf7_encode) {
-        ci = &ci_imap_utf7_encode;
-        return true;
-      }
-      break;
-    case 6810:
-      HASH_GUARD(0x19AFF8596E19DA9ALL, xhprof_enable) {
-        ci = &ci_xhprof_enable;
-        return true;
-      }
-      break;
-    case 6813:
-      HASH_GUARD(0x1234AB687C515A9DLL, mb_encode_numericentity) {
-        ci = &ci_mb_encode_numericentity;
-        return true;
-      }
-      break;
-    case 6815:
-      HASH_GUARD(0x2E5E23ECA0525A9FLL, bcadd) {
-        ci = &ci_bcadd;
-        return true;
-      }
-      break;
-    case 6821:
-      HASH_GUARD(0x2418528164415AA5LL, magickscaleimage) {
-        ci = &ci_magickscaleimage;
-        return true;
-      }
-      break;
-    case 6823:
-      HASH_GUARD(0x797CEC173CBB7AA7LL, ob_get_flush) {
-        ci = &ci_ob_get_flush;
-        return true;
-      }
-      break;
-    case 6834:
-      HASH_GUARD(0x62519270CC9F1AB2LL, stream_get_meta_data) {
-        ci = &ci_stream_get_meta_data;
-        return true;
-      }
-      break;
-    case 6847:
-      HASH_GUARD(0x030DFC3D3C88BABFLL, filegroup) {
-        ci = &ci_filegroup;
-        return true;
-      }
-      break;
-    case 6855:
-      HASH_GUARD(0x5D2F899A270D9AC7LL, xmlwriter_end_dtd_element) {
-        ci = &ci_xmlwriter_end_dtd_element;
-        return true;
-      }
-      HASH_GUARD(0x79215854355CBAC7LL, proc_get_status) {
-        ci = &ci_proc_get_status;
-        return true;
-      }
-      break;
-    case 6860:
-      HASH_GUARD(0x2BD6476D2C467ACCLL, pagelet_server_task_status) {
-        ci = &ci_pagelet_server_task_status;
-        return true;
-      }
-      break;
-    case 6861:
-      HASH_GUARD(0x173EDC165B673ACDLL, magicktransformimage) {
-        ci = &ci_magicktransformimage;
-        return true;
-      }
-      break;
-    case 6865:
-      HASH_GUARD(0x47E2B4F7B8DE5AD1LL, xmlwriter_write_dtd_attlist) {
-        ci = &ci_xmlwriter_write_dtd_attlist;
-        return true;
-      }
-      HASH_GUARD(0x314317450857FAD1LL, ctype_punct) {
-        ci = &ci_ctype_punct;
-        return true;
-      }
-      break;
-    case 6869:
-      HASH_GUARD(0x0D5DAF8034B41AD5LL, get_include_path) {
-        ci = &ci_get_include_path;
-        return true;
-      }
-      break;
-    case 6875:
-      HASH_GUARD(0x56E867A1F7507ADBLL, dom_document_create_processing_instruction) {
-        ci = &ci_dom_document_create_processing_instruction;
-        return true;
-      }
-      break;
-    case 6877:
-      HASH_GUARD(0x3E319E451A32FADDLL, magicksharpenimage) {
-        ci = &ci_magicksharpenimage;
-        return true;
-      }
-      break;
-    case 6878:
-      HASH_GUARD(0x31D1C58F7BD89ADELL, hphp_directoryiterator_seek) {
-        ci = &ci_hphp_directoryiterator_seek;
-        return true;
-      }
-      break;
-    case 6891:
-      HASH_GUARD(0x225F05071947BAEBLL, drawpathlinetoabsolute) {
-        ci = &ci_drawpathlinetoabsolute;
-        return true;
-      }
-      break;
-    case 6893:
-      HASH_GUARD(0x46C33B4739C2FAEDLL, shm_remove_var) {
-        ci = &ci_shm_remove_var;
-        return true;
-      }
-      break;
-    case 6894:
-      HASH_GUARD(0x160A82E3E2CBBAEELL, is_finite) {
-        ci = &ci_is_finite;
-        return true;
-      }
-      break;
-    case 6896:
-      HASH_GUARD(0x6B259D5D9D681AF0LL, register_postsend_function) {
-        ci = &ci_register_postsend_function;
-        return true;
-      }
-      break;
-    case 6900:
-      HASH_GUARD(0x2EC0ABF9A979FAF4LL, ob_get_level) {
-        ci = &ci_ob_get_level;
-        return true;
-      }
-      break;
-    case 6902:
-      HASH_GUARD(0x2C7C9772AE983AF6LL, drawsetgravity) {
-        ci = &ci_drawsetgravity;
-        return true;
-      }
-      break;
-    case 6904:
-      HASH_GUARD(0x12859AD75BAF3AF8LL, magickreadimageblob) {
-        ci = &ci_magickreadimageblob;
-        return true;
-      }
-      break;
-    case 6909:
-      HASH_GUARD(0x16BA422EB6C51AFDLL, gzwrite) {
-        ci = &ci_gzwrite;
-        return true;
-      }
-      break;
-    case 6910:
-      HASH_GUARD(0x04E86BA79B6CBAFELL, stream_socket_shutdown) {
-        ci = &ci_stream_socket_shutdown;
-        return true;
-      }
-      break;
-    case 6913:
-      HASH_GUARD(0x6F3503C7FB12DB01LL, lchgrp) {
-        ci = &ci_lchgrp;
-        return true;
-      }
-      break;
-    case 6915:
-      HASH_GUARD(0x673A96C50F00FB03LL, str_word_count) {
-        ci = &ci_str_word_count;
-        return true;
-      }
-      break;
-    case 6922:
-      HASH_GUARD(0x14AF32A23B507B0ALL, metaphone) {
-        ci = &ci_metaphone;
-        return true;
-      }
-      break;
-    case 6924:
-      HASH_GUARD(0x000A2D80D67ADB0CLL, imap_mail) {
-        ci = &ci_imap_mail;
-        return true;
-      }
-      break;
-    case 6935:
-      HASH_GUARD(0x66F9A476DAB47B17LL, pixelsetcolor) {
-        ci = &ci_pixelsetcolor;
-        return true;
-      }
-      break;
-    case 6936:
-      HASH_GUARD(0x70448A629A74FB18LL, ksort) {
-        ci = &ci_ksort;
-        return true;
-      }
-      break;
-    case 6940:
-      HASH_GUARD(0x249399CEC35B7B1CLL, png2wbmp) {
-        ci = &ci_png2wbmp;
-        return true;
-      }
-      break;
-    case 6942:
-      HASH_GUARD(0x7160AA24D4251B1ELL, mb_strripos) {
-        ci = &ci_mb_strripos;
-        return true;
-      }
-      break;
-    case 6944:
-      HASH_GUARD(0x1112712715D75B20LL, pixelgetblackquantum) {
-        ci = &ci_pixelgetblackquantum;
-        return true;
-      }
-      break;
-    case 6950:
-      HASH_GUARD(0x24CE95457EACBB26LL, get_parent_class) {
-        ci = &ci_get_parent_class;
-        return true;
-      }
-      break;
-    case 6954:
-      HASH_GUARD(0x1F4984938E1DBB2ALL, sort) {
-        ci = &ci_sort;
-        return true;
-      }
-      break;
-    case 6956:
-      HASH_GUARD(0x70742211FA3EFB2CLL, imagettftext) {
-        ci = &ci_imagettftext;
-        return true;
-      }
-      break;
-    case 6963:
-      HASH_GUARD(0x4D5D45D1F1EB3B33LL, posix_access) {
-        ci = &ci_posix_access;
-        return true;
-      }
-      break;
-    case 6964:
-      HASH_GUARD(0x0B7D52E2540ABB34LL, tan) {
-        ci = &ci_tan;
-        return true;
-      }
-      break;
-    case 6967:
-      HASH_GUARD(0x053B14F52350FB37LL, socket_shutdown) {
-        ci = &ci_socket_shutdown;
-        return true;
-      }
-      break;
-    case 6968:
-      HASH_GUARD(0x68C09D6CB8E79B38LL, class_exists) {
-        ci = &ci_class_exists;
-        return true;
-      }
-      break;
-    case 6969:
-      HASH_GUARD(0x02A2C373E54FFB39LL, hash_init) {
-        ci = &ci_hash_init;
-        return true;
-      }
-      break;
-    case 6970:
-      HASH_GUARD(0x49A45F75B2B25B3ALL, apd_breakpoint) {
-        ci = &ci_apd_breakpoint;
-        return true;
-      }
-      break;
-    case 6972:
-      HASH_GUARD(0x35F4A0789F367B3CLL, drawpathlinetohorizontalrelative) {
-        ci = &ci_drawpathlinetohorizontalrelative;
-        return true;
-      }
-      break;
-    case 6975:
-      HASH_GUARD(0x0B07AD87DF1B5B3FLL, urldecode) {
-        ci = &ci_urldecode;
-        return true;
-      }
-      break;
-    case 6976:
-      HASH_GUARD(0x24CBCBA5C4407B40LL, evhttp_set_cache) {
-        ci = &ci_evhttp_set_cache;
-        return true;
-      }
-      break;
-    case 6980:
-      HASH_GUARD(0x4E4449EBAADD7B44LL, magickpingimage) {
-        ci = &ci_magickpingimage;
-        return true;
-      }
-      break;
-    case 6981:
-      HASH_GUARD(0x72E3AE55A0B33B45LL, ispixelwand) {
-        ci = &ci_ispixelwand;
-        return true;
-      }
-      break;
-    case 6997:
-      HASH_GUARD(0x333FB673518A1B55LL, ldap_get_entries) {
-        ci = &ci_ldap_get_entries;
-        return true;
-      }
-      break;
-    case 7005:
-      HASH_GUARD(0x4888951358F53B5DLL, dom_document_get_elements_by_tag_name_ns) {
-        ci = &ci_dom_document_get_elements_by_tag_name_ns;
-        return true;
-      }
-      break;
-    case 7007:
-      HASH_GUARD(0x48E30DE7A228BB5FLL, spl_autoload_register) {
-        ci = &ci_spl_autoload_register;
-        return true;
-      }
-      break;
-    case 7009:
-      HASH_GUARD(0x7636825871399B61LL, highlight_file) {
-        ci = &ci_highlight_file;
-        return true;
-      }
-      break;
-    case 7016:
-      HASH_GUARD(0x674F1DA24EDE7B68LL, xmlwriter_end_attribute) {
-        ci = &ci_xmlwriter_end_attribute;
-        return true;
-      }
-      break;
-    case 7019:
-      HASH_GUARD(0x5543A0CACD153B6BLL, substr_replace) {
-        ci = &ci_substr_replace;
-        return true;
-      }
-      break;
-    case 7025:
-      HASH_GUARD(0x5E5C875DB04CFB71LL, drawrectangle) {
-        ci = &ci_drawrectangle;
-        return true;
-      }
-      break;
-    case 7029:
-      HASH_GUARD(0x42F0AED7599C1B75LL, magickechoimageblob) {
-        ci = &ci_magickechoimageblob;
-        return true;
-      }
-      break;
-    case 7030:
-      HASH_GUARD(0x2A63A0BF9B7E3B76LL, ini_alter) {
-        ci = &ci_ini_alter;
-        return true;
-      }
-      break;
-    case 7031:
-      HASH_GUARD(0x7F5F29D8E63ABB77LL, mcrypt_module_self_test) {
-        ci = &ci_mcrypt_module_self_test;
-        return true;
-      }
-      HASH_GUARD(0x5025B43B46679B77LL, openssl_x509_free) {
-        ci = &ci_openssl_x509_free;
-        return true;
-      }
-      break;
-    case 7033:
-      HASH_GUARD(0x1AD83CBEA1E87B79LL, imap_getmailboxes) {
-        ci = &ci_imap_getmailboxes;
-        return true;
-      }
-      break;
-    case 7036:
-      HASH_GUARD(0x3A096F905FBF7B7CLL, magickcommentimage) {
-        ci = &ci_magickcommentimage;
-        return true;
-      }
-      break;
-    case 7037:
-      HASH_GUARD(0x28DE19828167FB7DLL, magickmapimage) {
-        ci = &ci_magickmapimage;
-        return true;
-      }
-      break;
-    case 7051:
-      HASH_GUARD(0x3B72159A4B04FB8BLL, set_time_limit) {
-        ci = &ci_set_time_limit;
-        return true;
-      }
-      break;
-    case 7053:
-      HASH_GUARD(0x3B831DB1A615FB8DLL, xhprof_sample_enable) {
-        ci = &ci_xhprof_sample_enable;
-        return true;
-      }
-      break;
-    case 7054:
-      HASH_GUARD(0x62A4D7A03F7C3B8ELL, ceil) {
-        ci = &ci_ceil;
-        return true;
-      }
-      break;
-    case 7065:
-      HASH_GUARD(0x076E66D4089A3B99LL, mb_stripos) {
-        ci = &ci_mb_stripos;
-        return true;
-      }
-      break;
-    case 7066:
-      HASH_GUARD(0x023133732CB51B9ALL, exif_thumbnail) {
-        ci = &ci_exif_thumbnail;
-        return true;
-      }
-      break;
-    case 7071:
-      HASH_GUARD(0x390A267EC6B51B9FLL, socket_sendto) {
-        ci = &ci_socket_sendto;
-        return true;
-      }
-      break;
-    case 7076:
-      HASH_GUARD(0x0D95DD13A2D3BBA4LL, drawtranslate) {
-        ci = &ci_drawtranslate;
-        return true;
-      }
-      break;
-    case 7082:
-      HASH_GUARD(0x7C833A303C7CFBAALL, getrandmax) {
-        ci = &ci_getrandmax;
-        return true;
-      }
-      break;
-    case 7086:
-      HASH_GUARD(0x66F099E732977BAELL, imap_renamemailbox) {
-        ci = &ci_imap_renamemailbox;
-        return true;
-      }
-      break;
-    case 7088:
-      HASH_GUARD(0x1F3E4C6660247BB0LL, imagecolorresolve) {
-        ci = &ci_imagecolorresolve;
-        return true;
-      }
-      HASH_GUARD(0x7D9BF61D6CDE3BB0LL, fb_parallel_query) {
-        ci = &ci_fb_parallel_query;
-        return true;
-      }
-      break;
-    case 7102:
-      HASH_GUARD(0x3F56AF1511AEDBBELL, magicklabelimage) {
-        ci = &ci_magicklabelimage;
-        return true;
-      }
-      break;
-    case 7111:
-      HASH_GUARD(0x10C5CF7B55173BC7LL, settype) {
-        ci = &ci_settype;
-        return true;
-      }
-      break;
-    case 7114:
-      HASH_GUARD(0x4122DFAC25BDFBCALL, hphp_splfileinfo_getowner) {
-        ci = &ci_hphp_splfileinfo_getowner;
-        return true;
-      }
-      break;
-    case 7117:
-      HASH_GUARD(0x53A88C8F973CFBCDLL, apc_clear_cache) {
-        ci = &ci_apc_clear_cache;
-        return true;
-      }
-      break;
-    case 7118:
-      HASH_GUARD(0x45D6BA980AFFDBCELL, msg_get_queue) {
-        ci = &ci_msg_get_queue;
-        return true;
-      }
-      break;
-    case 7120:
-      HASH_GUARD(0x02A0F9CE4022BBD0LL, imap_fetchbody) {
-        ci = &ci_imap_fetchbody;
-        return true;
-      }
-      HASH_GUARD(0x6846CA07A5E21BD0LL, hphp_directoryiterator___construct) {
-        ci = &ci_hphp_directoryiterator___construct;
-        return true;
-      }
-      break;
-    case 7122:
-      HASH_GUARD(0x6FE3C5FF5E883BD2LL, round) {
-        ci = &ci_round;
-        return true;
-      }
-      break;
-    case 7124:
-      HASH_GUARD(0x4E4EB301A994DBD4LL, drawpolygon) {
-        ci = &ci_drawpolygon;
-        return true;
-      }
-      break;
-    case 7128:
-      HASH_GUARD(0x21E44C7C7A911BD8LL, phpinfo) {
-        ci = &ci_phpinfo;
-        return true;
-      }
-      break;
-    case 7134:
-      HASH_GUARD(0x58D0D9B66F045BDELL, strpos) {
-        ci = &ci_strpos;
-        return true;
-      }
-      break;
-    case 7136:
-      HASH_GUARD(0x2E10B74DC6067BE0LL, strip_tags) {
-        ci = &ci_strip_tags;
-        return true;
-      }
-      break;
-    case 7137:
-      HASH_GUARD(0x25FBB61480091BE1LL, mysql_client_encoding) {
-        ci = &ci_mysql_client_encoding;
-        return true;
-      }
-      break;
-    case 7147:
-      HASH_GUARD(0x505B44DDF2383BEBLL, drawgetfillcolor) {
-        ci = &ci_drawgetfillcolor;
-        return true;
-      }
-      HASH_GUARD(0x0C1904372E8EDBEBLL, stream_copy_to_stream) {
-        ci = &ci_stream_copy_to_stream;
-        return true;
-      }
-      break;
-    case 7148:
-      HASH_GUARD(0x44279BB3E2191BECLL, socket_accept) {
-        ci = &ci_socket_accept;
-        return true;
-      }
-      HASH_GUARD(0x5A22BA9B012A9BECLL, dom_document_save_html) {
-        ci = &ci_dom_document_save_html;
-        return true;
-      }
-      break;
-    case 7152:
-      HASH_GUARD(0x187C049E785A1BF0LL, iconv_get_encoding) {
-        ci = &ci_iconv_get_encoding;
-        return true;
-      }
-      HASH_GUARD(0x04C0582DB1AD7BF0LL, mt_srand) {
-        ci = &ci_mt_srand;
-        return true;
-      }
-      break;
-    case 7153:
-      HASH_GUARD(0x0CA96856E5BEFBF1LL, iptcparse) {
-        ci = &ci_iptcparse;
-        return true;
-      }
-      break;
-    case 7156:
-      HASH_GUARD(0x1444DB037B4D5BF4LL, imagegammacorrect) {
-        ci = &ci_imagegammacorrect;
-        return true;
-      }
-      break;
-    case 7159:
-      HASH_GUARD(0x74ABB4A1E10BBBF7LL, time) {
-        ci = &ci_time;
-        return true;
-      }
-      break;
-    case 7161:
-      HASH_GUARD(0x5B7F6E0A642BBBF9LL, sleep) {
-        ci = &ci_sleep;
-        return true;
-      }
-      break;
-    case 7164:
-      HASH_GUARD(0x64F52E1DB5E95BFCLL, curl_multi_remove_handle) {
-        ci = &ci_curl_multi_remove_handle;
-        return true;
-      }
-      break;
-    case 7170:
-      HASH_GUARD(0x249340DF734D9C02LL, magickgetimageheight) {
-        ci = &ci_magickgetimageheight;
-        return true;
-      }
-      break;
-    case 7176:
-      HASH_GUARD(0x48E1616EE837FC08LL, is_uploaded_file) {
-        ci = &ci_is_uploaded_file;
-        return true;
-      }
-      break;
-    case 7178:
-      HASH_GUARD(0x1E47C281193ABC0ALL, collator_compare) {
-        ci = &ci_collator_compare;
-        return true;
-      }
-      break;
-    case 7186:
-      HASH_GUARD(0x062C0FFA8E29DC12LL, intl_error_name) {
-        ci = &ci_intl_error_name;
-        return true;
-      }
-      break;
-    case 7191:
-      HASH_GUARD(0x3A702EF906B37C17LL, collator_get_locale) {
-        ci = &ci_collator_get_locale;
-        return true;
-      }
-      break;
-    case 7196:
-      HASH_GUARD(0x758A62BD65E6FC1CLL, imagegd2) {
-        ci = &ci_imagegd2;
-        return true;
-      }
-      break;
-    case 7198:
-      HASH_GUARD(0x7039C5EBB1D6BC1ELL, array_walk) {
-        ci = &ci_array_walk;
-        return true;
-      }
-      break;
-    case 7199:
-      HASH_GUARD(0x3A5D921797669C1FLL, hphp_log) {
-        ci = &ci_hphp_log;
-        return true;
-      }
-      break;
-    case 7201:
-      HASH_GUARD(0x0179CBA2C5F4DC21LL, magickgetimageformat) {
-        ci = &ci_magickgetimageformat;
-        return true;
-      }
-      break;
-    case 7218:
-      HASH_GUARD(0x0B9B362534621C32LL, isdrawingwand) {
-        ci = &ci_isdrawingwand;
-        return true;
-      }
-      break;
-    case 7219:
-      HASH_GUARD(0x49965C44E9EE3C33LL, set_file_buffer) {
-        ci = &ci_set_file_buffer;
-        return true;
-      }
-      break;
-    case 7224:
-      HASH_GUARD(0x21564F9315F3FC38LL, drawsettextdecoration) {
-        ci = &ci_drawsettextdecoration;
-        return true;
-      }
-      break;
-    case 7228:
-      HASH_GUARD(0x69488CC69B897C3CLL, hphp_recursiveiteratoriterator_getinneriterator) {
-        ci = &ci_hphp_recursiveiteratoriterator_getinneriterator;
-        return true;
-      }
-      break;
-    case 7230:
-      HASH_GUARD(0x15EC581662651C3ELL, date_parse) {
-        ci = &ci_date_parse;
-        return true;
-      }
-      break;
-    case 7238:
-      HASH_GUARD(0x7D992445F5E37C46LL, magicktextureimage) {
-        ci = &ci_magicktextureimage;
-        return true;
-      }
-      break;
-    case 7243:
-      HASH_GUARD(0x120E7B01366DFC4BLL, call_user_func_serialized) {
-        ci = &ci_call_user_func_serialized;
-        return true;
-      }
-      break;
-    case 7248:
-      HASH_GUARD(0x04534F26B8D05C50LL, drawgetstrokecolor) {
-        ci = &ci_drawgetstrokecolor;
-        return true;
-      }
-      break;
-    case 7255:
-      HASH_GUARD(0x313E8EB28A111C57LL, hphp_splfileinfo_setinfoclass) {
-        ci = &ci_hphp_splfileinfo_setinfoclass;
-        return true;
-      }
-      break;
-    case 7256:
-      HASH_GUARD(0x1B8C3DA27170DC58LL, dirname) {
-        ci = &ci_dirname;
-        return true;
-      }
-      break;
-    case 7257:
-      HASH_GUARD(0x57633BDF8DB3FC59LL, i18n_loc_set_attribute) {
-        ci = &ci_i18n_loc_set_attribute;
-        return true;
-      }
-      break;
-    case 7262:
-      HASH_GUARD(0x47B38F1E4FA29C5ELL, fb_get_code_coverage) {
-        ci = &ci_fb_get_code_coverage;
-        return true;
-      }
-      break;
-    case 7265:
-      HASH_GUARD(0x6E54EEDA1D887C61LL, magicksetimageinterlacescheme) {
-        ci = &ci_magicksetimageinterlacescheme;
-        return true;
-      }
-      HASH_GUARD(0x5176725DA884DC61LL, curl_setopt) {
-        ci = &ci_curl_setopt;
-        return true;
-      }
-      break;
-    case 7271:
-      HASH_GUARD(0x07DC355325165C67LL, magickwriteimage) {
-        ci = &ci_magickwriteimage;
-        return true;
-      }
-      break;
-    case 7272:
-      HASH_GUARD(0x10D6AE9D688D1C68LL, copy) {
-        ci = &ci_copy;
-        return true;
-      }
-      break;
-    case 7281:
-      HASH_GUARD(0x18D9ED67E8E0FC71LL, dom_attr_is_id) {
-        ci = &ci_dom_attr_is_id;
-        return true;
-      }
-      break;
-    case 7284:
-      HASH_GUARD(0x20F0AAA486F39C74LL, dom_element_get_elements_by_tag_name_ns) {
-        ci = &ci_dom_element_get_elements_by_tag_name_ns;
-        return true;
-      }
-      break;
-    case 7297:
-      HASH_GUARD(0x767806D6F1053C81LL, sin) {
-        ci = &ci_sin;
-        return true;
-      }
-      break;
-    case 7301:
-      HASH_GUARD(0x56DA17241B793C85LL, mysql_set_timeout) {
-        ci = &ci_mysql_set_timeout;
-        return true;
-      }
-      break;
-    case 7313:
-      HASH_GUARD(0x4E04B71729485C91LL, clonedrawingwand) {
-        ci = &ci_clonedrawingwand;
-        return true;
-      }
-      break;
-    case 7315:
-      HASH_GUARD(0x0F8242C6327B5C93LL, dns_check_record) {
-        ci = &ci_dns_check_record;
-        return true;
-      }
-      break;
-    case 7322:
-      HASH_GUARD(0x374F20BDAF709C9ALL, mb_preferred_mime_name) {
-        ci = &ci_mb_preferred_mime_name;
-        return true;
-      }
-      break;
-    case 7323:
-      HASH_GUARD(0x36F7F9FD7766DC9BLL, xmlwriter_end_comment) {
-        ci = &ci_xmlwriter_end_comment;
-        return true;
-      }
-      break;
-    case 7342:
-      HASH_GUARD(0x12580A083B0D7CAELL, iterator_apply) {
-        ci = &ci_iterator_apply;
-        return true;
-      }
-      break;
-    case 7344:
-      HASH_GUARD(0x373B3FADEACB7CB0LL, openssl_private_encrypt) {
-        ci = &ci_openssl_private_encrypt;
-        return true;
-      }
-      break;
-    case 7345:
-      HASH_GUARD(0x40D8DC24FA917CB1LL, hphp_splfileobject_fgetss) {
-        ci = &ci_hphp_splfileobject_fgetss;
-        return true;
-      }
-      break;
-    case 7351:
-      HASH_GUARD(0x3DFD5CA79919DCB7LL, imageantialias) {
-        ci = &ci_imageantialias;
-        return true;
-      }
-      HASH_GUARD(0x39E03AAC188D3CB7LL, magickgetimagecompressionquality) {
-        ci = &ci_magickgetimagecompressionquality;
-        return true;
-      }
-      break;
-    case 7360:
-      HASH_GUARD(0x3033FE14E114FCC0LL, magicksetimageblueprimary) {
-        ci = &ci_magicksetimageblueprimary;
-        return true;
-      }
-      break;
-    case 7362:
-      HASH_GUARD(0x34B6388D7730BCC2LL, drawline) {
-        ci = &ci_drawline;
-        return true;
-      }
-      break;
-    case 7374:
-      HASH_GUARD(0x0183A548B759BCCELL, posix_getpgid) {
-        ci = &ci_posix_getpgid;
-        return true;
-      }
-      HASH_GUARD(0x66273C5932B1FCCELL, clock_gettime) {
-        ci = &ci_clock_gettime;
-        return true;
-      }
-      break;
-    case 7375:
-      HASH_GUARD(0x407B1F3AFEC43CCFLL, pixelgetblue) {
-        ci = &ci_pixelgetblue;
-        return true;
-      }
-      break;
-    case 7377:
-      HASH_GUARD(0x576C5DC462663CD1LL, explode) {
-        ci = &ci_explode;
-        return true;
-      }
-      break;
-    case 7379:
-      HASH_GUARD(0x544302E2FAD3FCD3LL, magicknextimage) {
-        ci = &ci_magicknextimage;
-        return true;
-      }
-      break;
-    case 7380:
-      HASH_GUARD(0x323FE1D92C9B3CD4LL, gzdecode) {
-        ci = &ci_gzdecode;
-        return true;
-      }
-      break;
-    case 7381:
-      HASH_GUARD(0x757BC444FDF79CD5LL, posix_get_last_error) {
-        ci = &ci_posix_get_last_error;
-        return true;
-      }
-      break;
-    case 7386:
-      HASH_GUARD(0x09C6455B4BC6FCDALL, drawsetviewbox) {
-        ci = &ci_drawsetviewbox;
-        return true;
-      }
-      break;
-    case 7396:
-      HASH_GUARD(0x7CDDF96AFEA2DCE4LL, chunk_split) {
-        ci = &ci_chunk_split;
-        return true;
-      }
-      break;
-    case 7407:
-      HASH_GUARD(0x6AA89C314C647CEFLL, magickgetimagehistogram) {
-        ci = &ci_magickgetimagehistogram;
-        return true;
-      }
-      break;
-    case 7410:
-      HASH_GUARD(0x26C49BBC67475CF2LL, magicksetimagewhitepoint) {
-        ci = &ci_magicksetimagewhitepoint;
-        return true;
-      }
-      break;
-    case 7411:
-      HASH_GUARD(0x6CA8CF41D27D1CF3LL, imap_headerinfo) {
-        ci = &ci_imap_headerinfo;
-        return true;
-      }
-      HASH_GUARD(0x5C1F75D51C077CF3LL, pixelgetindex) {
-        ci = &ci_pixelgetindex;
-        return true;
-      }
-      break;
-    case 7419:
-      HASH_GUARD(0x09B4EE276DCCFCFBLL, mysql_fetch_row) {
-        ci = &ci_mysql_fetch_row;
-        return true;
-      }
-      break;
-    case 7422:
-      HASH_GUARD(0x768F3E6D1CBA5CFELL, socket_recv) {
-        ci = &ci_socket_recv;
-        return true;
-      }
-      break;
-    case 7423:
-      HASH_GUARD(0x748D3DFF0EB57CFFLL, uniqid) {
-        ci = &ci_uniqid;
-        return true;
-      }
-      break;
-    case 7430:
-      HASH_GUARD(0x2BA9FB0F8B76DD06LL, number_format) {
-        ci = &ci_number_format;
-        return true;
-      }
-      break;
-    case 7433:
-      HASH_GUARD(0x153F7DBFC9047D09LL, pixelsetred) {
-        ci = &ci_pixelsetred;
-        return true;
-      }
-      break;
-    case 7436:
-      HASH_GUARD(0x30A8326034801D0CLL, mysql_pconnect) {
-        ci = &ci_mysql_pconnect;
-        return true;
-      }
-      break;
-    case 7437:
-      HASH_GUARD(0x3ACE8A8BC9ACDD0DLL, iconv_mime_decode) {
-        ci = &ci_iconv_mime_decode;
-        return true;
-      }
-      break;
-    case 7440:
-      HASH_GUARD(0x42BEEC88EE81FD10LL, imagechar) {
-        ci = &ci_imagechar;
-        return true;
-      }
-      HASH_GUARD(0x08F41A00D5D57D10LL, mb_decode_mimeheader) {
-        ci = &ci_mb_decode_mimeheader;
-        return true;
-      }
-      break;
-    case 7442:
-      HASH_GUARD(0x5F165B40AEEE5D12LL, hphp_splfileinfo_getfilename) {
-        ci = &ci_hphp_splfileinfo_getfilename;
-        return true;
-      }
-      break;
-    case 7444:
-      HASH_GUARD(0x63837ECAF6235D14LL, preg_replace) {
-        ci = &ci_preg_replace;
-        return true;
-      }
-      break;
-    case 7450:
-      HASH_GUARD(0x39994614C6315D1ALL, hphp_recursivedirectoryiterator_key) {
-        ci = &ci_hphp_recursivedirectoryiterator_key;
-        return true;
-      }
-      break;
-    case 7454:
-      HASH_GUARD(0x25DADFF238A15D1ELL, collator_create) {
-        ci = &ci_collator_create;
-        return true;
-      }
-      break;
-    case 7461:
-      HASH_GUARD(0x71DF0C17F47EDD25LL, getprotobynumber) {
-        ci = &ci_getprotobynumber;
-        return true;
-      }
-      break;
-    case 7464:
-      HASH_GUARD(0x7C12261259F87D28LL, mcrypt_enc_is_block_algorithm_mode) {
-        ci = &ci_mcrypt_enc_is_block_algorithm_mode;
-        return true;
-      }
-      break;
-    case 7466:
-      HASH_GUARD(0x7A9C06B9CF853D2ALL, substr_count) {
-        ci = &ci_substr_count;
-        return true;
-      }
-      break;
-    case 7474:
-      HASH_GUARD(0x4DAC43060BA57D32LL, stream_wrapper_restore) {
-        ci = &ci_stream_wrapper_restore;
-        return true;
-      }
-      break;
-    case 7479:
-      HASH_GUARD(0x6F2182E089377D37LL, imap_list) {
-        ci = &ci_imap_list;
-        return true;
-      }
-      HASH_GUARD(0x3ACF745D381E9D37LL, rtrim) {
-        ci = &ci_rtrim;
-        return true;
-      }
-      break;
-    case 7480:
-      HASH_GUARD(0x0BA3AD85EB597D38LL, pagelet_server_task_result) {
-        ci = &ci_pagelet_server_task_result;
-        return true;
-      }
-      break;
-    case 7489:
-      HASH_GUARD(0x6B6DA1EE18673D41LL, xmlwriter_end_dtd_entity) {
-        ci = &ci_xmlwriter_end_dtd_entity;
-        return true;
-      }
-      break;
-    case 7490:
-      HASH_GUARD(0x40497FCA4EC4DD42LL, posix_seteuid) {
-        ci = &ci_posix_seteuid;
-        return true;
-      }
-      HASH_GUARD(0x298BA735FA3ABD42LL, nl_langinfo) {
-        ci = &ci_nl_langinfo;
-        return true;
-      }
-      break;
-    case 7493:
-      HASH_GUARD(0x400A44045A999D45LL, rawurlencode) {
-        ci = &ci_rawurlencode;
-        return true;
-      }
-      break;
-    case 7494:
-      HASH_GUARD(0x502CF4EB0A747D46LL, magicksetimagebias) {
-        ci = &ci_magicksetimagebias;
-        return true;
-      }
-      HASH_GUARD(0x455DB7F86BCEDD46LL, pixelsetopacityquantum) {
-        ci = &ci_pixelsetopacityquantum;
-        return true;
-      }
-      HASH_GUARD(0x59AD2C922FF75D46LL, mdecrypt_generic) {
-        ci = &ci_mdecrypt_generic;
-        return true;
-      }
-      break;
-    case 7497:
-      HASH_GUARD(0x113ED435AEFDDD49LL, imagecolorallocatealpha) {
-        ci = &ci_imagecolorallocatealpha;
-        return true;
-      }
-      break;
-    case 7503:
-      HASH_GUARD(0x0FBCF35ADD209D4FLL, drawarc) {
-        ci = &ci_drawarc;
-        return true;
-      }
-      break;
-    case 7509:
-      HASH_GUARD(0x36D672EF4FBEFD55LL, json_encode) {
-        ci = &ci_json_encode;
-        return true;
-      }
-      break;
-    case 7512:
-      HASH_GUARD(0x146109BDD2F97D58LL, hphp_splfileobject_setmaxlinelen) {
-        ci = &ci_hphp_splfileobject_setmaxlinelen;
-        return true;
-      }
-      break;
-    case 7520:
-      HASH_GUARD(0x6FACBD7F02B6FD60LL, uasort) {
-        ci = &ci_uasort;
-        return true;
-      }
-      break;
-    case 7521:
-      HASH_GUARD(0x357BAB6E700EBD61LL, destroypixelwandarray) {
-        ci = &ci_destroypixelwandarray;
-        return true;
-      }
-      break;
-    case 7534:
-      HASH_GUARD(0x0B1348D1540E7D6ELL, magicksetimageformat) {
-        ci = &ci_magicksetimageformat;
-        return true;
-      }
-      break;
-    case 7539:
-      HASH_GUARD(0x7D8DCC72522CBD73LL, mb_detect_encoding) {
-        ci = &ci_mb_detect_encoding;
-        return true;
-      }
-      break;
-    case 7540:
-      HASH_GUARD(0x51E8B5B728E33D74LL, imap_last_error) {
-        ci = &ci_imap_last_error;
-        return true;
-      }
-      break;
-    case 7543:
-      HASH_GUARD(0x7FCAAAB932C57D77LL, iterator_count) {
-        ci = &ci_iterator_count;
-        return true;
-      }
-      break;
-    case 7544:
-      HASH_GUARD(0x6352349F97557D78LL, stream_socket_get_name) {
-        ci = &ci_stream_socket_get_name;
-        return true;
-      }
-      break;
-    case 7547:
-      HASH_GUARD(0x680A7EB3DA1F5D7BLL, prev) {
-        ci = &ci_prev;
-        return true;
-      }
-      break;
-    case 7554:
-      HASH_GUARD(0x2D15262403ADDD82LL, drawcomposite) {
-        ci = &ci_drawcomposite;
-        return true;
-      }
-      break;
-    case 7555:
-      HASH_GUARD(0x1B0FF5C02F571D83LL, fb_rename_function) {
-        ci = &ci_fb_rename_function;
-        return true;
-      }
-      break;
-    case 7561:
-      HASH_GUARD(0x230E7AD147721D89LL, end) {
-        ci = &ci_end;
-        return true;
-      }
-      break;
-    case 7569:
-      HASH_GUARD(0x7C2B3FE61FBDFD91LL, openssl_pkey_get_details) {
-        ci = &ci_openssl_pkey_get_details;
-        return true;
-      }
-      break;
-    case 7576:
-      HASH_GUARD(0x06A796D329C21D98LL, call_user_func) {
-        ci = &ci_call_user_func;
-        return true;
-      }
-      break;
-    case 7581:
-      HASH_GUARD(0x74BE8836F3B13D9DLL, session_name) {
-        ci = &ci_session_name;
-        return true;
-      }
-      break;
-    case 7584:
-      HASH_GUARD(0x73B43ABDD5C61DA0LL, shuffle) {
-        ci = &ci_shuffle;
-        return true;
-      }
-      HASH_GUARD(0x5E8606470A09BDA0LL, magickposterizeimage) {
-        ci = &ci_magickposterizeimage;
-        return true;
-      }
-      HASH_GUARD(0x167A11C41EB71DA0LL, pixelgetexceptiontype) {
-        ci = &ci_pixelgetexceptiontype;
-        return true;
-      }
-      break;
-    case 7586:
-      HASH_GUARD(0x71583A8FEF5C7DA2LL, sys_get_temp_dir) {
-        ci = &ci_sys_get_temp_dir;
-        return true;
-      }
-      break;
-    case 7589:
-      HASH_GUARD(0x46B2F287D2FC7DA5LL, memcache_get) {
-        ci = &ci_memcache_get;
-        return true;
-      }
-      break;
-    case 7590:
-      HASH_GUARD(0x28DC1AD6DA9E7DA6LL, gethostbyname) {
-        ci = &ci_gethostbyname;
-        return true;
-      }
-      break;
-    case 7592:
-      HASH_GUARD(0x572AE270D9E4FDA8LL, socket_set_option) {
-        ci = &ci_socket_set_option;
-        return true;
-      }
-      break;
-    case 7593:
-      HASH_GUARD(0x35828C81A86A9DA9LL, cpu_get_count) {
-        ci = &ci_cpu_get_count;
-        return true;
-      }
-      break;
-    case 7594:
-      HASH_GUARD(0x6326C14D0FFA7DAALL, fb_thrift_serialize) {
-        ci = &ci_fb_thrift_serialize;
-        return true;
-      }
-      break;
-    case 7595:
-      HASH_GUARD(0x188720048AB37DABLL, magickquantizeimages) {
-        ci = &ci_magickquantizeimages;
-        return true;
-      }
-      break;
-    case 7601:
-      HASH_GUARD(0x67EAC6D7332F3DB1LL, hphp_splfileobject_fgetcsv) {
-        ci = &ci_hphp_splfileobject_fgetcsv;
-        return true;
-      }
-      break;
-    case 7603:
-      HASH_GUARD(0x628069E483F35DB3LL, hphp_splfileobject_fstat) {
-        ci = &ci_hphp_splfileobject_fstat;
-        return true;
-      }
-      break;
-    case 7610:
-      HASH_GUARD(0x5E0C6E797607DDBALL, mysql_result) {
-        ci = &ci_mysql_result;
-        return true;
-      }
-      HASH_GUARD(0x7964DE73DCA17DBALL, magickhasnextimage) {
-        ci = &ci_magickhasnextimage;
-        return true;
-      }
-      break;
-    case 7613:
-      HASH_GUARD(0x48AA091B1E493DBDLL, setlocale) {
-        ci = &ci_setlocale;
-        return true;
-      }
-      break;
-    case 7617:
-      HASH_GUARD(0x683E88F441F9BDC1LL, chgrp) {
-        ci = &ci_chgrp;
-        return true;
-      }
-      break;
-    case 7619:
-      HASH_GUARD(0x0433140BB339DDC3LL, log) {
-        ci = &ci_log;
-        return true;
-      }
-      break;
-    case 7620:
-      HASH_GUARD(0x2A38BA8B4A0F9DC4LL, apc_fetch) {
-        ci = &ci_apc_fetch;
-        return true;
-      }
-      break;
-    case 7624:
-      HASH_GUARD(0x66C3E73210067DC8LL, magickgetimageunits) {
-        ci = &ci_magickgetimageunits;
-        return true;
-      }
-      break;
-    case 7630:
-      HASH_GUARD(0x4AD5B65BCE665DCELL, array_key_exists) {
-        ci = &ci_array_key_exists;
-        return true;
-      }
-      break;
-    case 7637:
-      HASH_GUARD(0x7E1801C8E70D1DD5LL, imagefontwidth) {
-        ci = &ci_imagefontwidth;
-        return true;
-      }
-      break;
-    case 7639:
-      HASH_GUARD(0x638690DF6D06FDD7LL, imageconvolution) {
-        ci = &ci_imageconvolution;
-        return true;
-      }
-      break;
-    case 7647:
-      HASH_GUARD(0x044D7013BDB33DDFLL, spl_autoload_functions) {
-        ci = &ci_spl_autoload_functions;
-        return true;
-      }
-      break;
-    case 7660:
-      HASH_GUARD(0x5B51DD18C3E13DECLL, openssl_x509_parse) {
-        ci = &ci_openssl_x509_parse;
-        return true;
-      }
-      HASH_GUARD(0x5ABB7486CE861DECLL, array_merge_recursive) {
-        ci = &ci_array_merge_recursive;
-        return true;
-      }
-      break;
-    case 7663:
-      HASH_GUARD(0x0BB22147ADADDDEFLL, pfsockopen) {
-        ci = &ci_pfsockopen;
-        return true;
-      }
-      HASH_GUARD(0x72293DCE8CC4BDEFLL, htmlspecialchars) {
-        ci = &ci_htmlspecialchars;
-        return true;
-      }
-      break;
-    case 7667:
-      HASH_GUARD(0x7AE1BE187F18FDF3LL, fgets) {
-        ci = &ci_fgets;
-        return true;
-      }
-      break;
-    case 7668:
-      HASH_GUARD(0x5046A0D9DFDB5DF4LL, strcspn) {
-        ci = &ci_strcspn;
-        return true;
-      }
-      break;
-    case 7671:
-      HASH_GUARD(0x23E563F1EC919DF7LL, hphp_splfileinfo_getpathname) {
-        ci = &ci_hphp_splfileinfo_getpathname;
-        return true;
-      }
-      break;
-    case 7672:
-      HASH_GUARD(0x5E43280BC8DD1DF8LL, magicktrimimage) {
-        ci = &ci_magicktrimimage;
-        return true;
-      }
-      break;
-    case 7674:
-      HASH_GUARD(0x4FB6B5C2636D1DFALL, apc_exists) {
-        ci = &ci_apc_exists;
-        return true;
-      }
-      break;
-    case 7675:
-      HASH_GUARD(0x47C62D58B0B65DFBLL, thrift_protocol_write_binary) {
-        ci = &ci_thrift_protocol_write_binary;
-        return true;
-      }
-      break;
-    case 7678:
-      HASH_GUARD(0x21F24104004CFDFELL, evhttp_post) {
-        ci = &ci_evhttp_post;
-        return true;
-      }
-      HASH_GUARD(0x072690BF719D7DFELL, hphp_recursivedirectoryiterator_rewind) {
-        ci = &ci_hphp_recursivedirectoryiterator_rewind;
-        return true;
-      }
-      break;
-    case 7682:
-      HASH_GUARD(0x7829D2171DFBFE02LL, magickgetimagegamma) {
-        ci = &ci_magickgetimagegamma;
-        return true;
-      }
-      break;
-    case 7693:
-      HASH_GUARD(0x756B92411E7FBE0DLL, stream_get_wrappers) {
-        ci = &ci_stream_get_wrappers;
-        return true;
-      }
-      break;
-    case 7698:
-      HASH_GUARD(0x05FAA2085D94FE12LL, urlencode) {
-        ci = &ci_urlencode;
-        return true;
-      }
-      break;
-    case 7700:
-      HASH_GUARD(0x41E394B12170BE14LL, socket_send) {
-        ci = &ci_socket_send;
-        return true;
-      }
-      HASH_GUARD(0x3192209D50C1FE14LL, pixelsetalpha) {
-        ci = &ci_pixelsetalpha;
-        return true;
-      }
-      break;
-    case 7701:
-      HASH_GUARD(0x525F197D74423E15LL, get_resource_type) {
-        ci = &ci_get_resource_type;
-        return true;
-      }
-      break;
-    case 7703:
-      HASH_GUARD(0x0F5759A501FAFE17LL, imagecreatefromgd2part) {
-        ci = &ci_imagecreatefromgd2part;
-        return true;
-      }
-      break;
-    case 7705:
-      HASH_GUARD(0x4A694B42B21A9E19LL, destroymagickwand) {
-        ci = &ci_destroymagickwand;
-        return true;
-      }
-      break;
-    case 7707:
-      HASH_GUARD(0x7FA0B63054221E1BLL, magickrollimage) {
-        ci = &ci_magickrollimage;
-        return true;
-      }
-      break;
-    case 7717:
-      HASH_GUARD(0x1C6246FA51EBDE25LL, hphp_get_static_property) {
-        ci = &ci_hphp_get_static_property;
-        return true;
-      }
-      break;
-    case 7720:
-      HASH_GUARD(0x3456885FF0679E28LL, lchown) {
-        ci = &ci_lchown;
-        return true;
-      }
-      break;
-    case 7725:
-      HASH_GUARD(0x7817FA38BAAEFE2DLL, fsockopen) {
-        ci = &ci_fsockopen;
-        return true;
-      }
-      break;
-    case 7734:
-      HASH_GUARD(0x2E42ED1E15CCFE36LL, mysql_affected_rows) {
-        ci = &ci_mysql_affected_rows;
-        return true;
-      }
-      break;
-    case 7738:
-      HASH_GUARD(0x6E2CF6ECA0987E3ALL, get_headers) {
-        ci = &ci_get_headers;
-        return true;
-      }
-      break;
-    case 7748:
-      HASH_GUARD(0x71B7756BD1B43E44LL, dom_document_savexml) {
-        ci = &ci_dom_document_savexml;
-        return true;
-      }
-      break;
-    case 7767:
-      HASH_GUARD(0x21B07F1F212BDE57LL, hphp_get_original_class_name) {
-        ci = &ci_hphp_get_original_class_name;
-        return true;
-      }
-      break;
-    case 7771:
-      HASH_GUARD(0x299F1A5895461E5BLL, curl_multi_close) {
-        ci = &ci_curl_multi_close;
-        return true;
-      }
-      break;
-    case 7779:
-      HASH_GUARD(0x5697E5F6AAF47E63LL, mb_http_input) {
-        ci = &ci_mb_http_input;
-        return true;
-      }
-      break;
-    case 7782:
-      HASH_GUARD(0x6CB3DEB458A2DE66LL, apc_bin_load) {
-        ci = &ci_apc_bin_load;
-        return true;
-      }
-      break;
-    case 7786:
-      HASH_GUARD(0x25C0C5E961AFDE6ALL, xmlwriter_full_end_element) {
-        ci = &ci_xmlwriter_full_end_element;
-        return true;
-      }
-      break;
-    case 7793:
-      HASH_GUARD(0x6AC126DCE941FE71LL, memory_get_peak_usage) {
-        ci = &ci_memory_get_peak_usage;
-        return true;
-      }
-      break;
-    case 7795:
-      HASH_GUARD(0x3B28CA1BE1D0DE73LL, xbox_get_thread_timeout) {
-        ci = &ci_xbox_get_thread_timeout;
-        return true;
-      }
-      break;
-    case 7796:
-      HASH_GUARD(0x47D0510206B89E74LL, ini_restore) {
-        ci = &ci_ini_restore;
-        return true;
-      }
-      break;
-    case 7798:
-      HASH_GUARD(0x36E9EC047FC73E76LL, mb_convert_encoding) {
-        ci = &ci_mb_convert_encoding;
-        return true;
-      }
-      break;
-    case 7802:
-      HASH_GUARD(0x6A3D9F8EDB005E7ALL, flush) {
-        ci = &ci_flush;
-        return true;
-      }
-      break;
-    case 7806:
-      HASH_GUARD(0x51060D186C703E7ELL, headers_list) {
-        ci = &ci_headers_list;
-        return true;
-      }
-      break;
-    case 7809:
-      HASH_GUARD(0x0ECFC3676B4FDE81LL, chr) {
-        ci = &ci_chr;
-        return true;
-      }
-      break;
-    case 7810:
-      HASH_GUARD(0x379F7BF525FF1E82LL, magicksetimagecolorspace) {
-        ci = &ci_magicksetimagecolorspace;
-        return true;
-      }
-      break;
-    case 7822:
-      HASH_GUARD(0x29A2FBD427647E8ELL, mysql_connect) {
-        ci = &ci_mysql_connect;
-        return true;
-      }
-      break;
-    case 7827:
-      HASH_GUARD(0x5E968924197F5E93LL, mcrypt_ofb) {
-        ci = &ci_mcrypt_ofb;
-        return true;
-      }
-      break;
-    case 7831:
-      HASH_GUARD(0x6254E9BDC11F3E97LL, imagecreatefromgd2) {
-        ci = &ci_imagecreatefromgd2;
-        return true;
-      }
-      break;
-    case 7835:
-      HASH_GUARD(0x2A019CAA1188BE9BLL, preg_grep) {
-        ci = &ci_preg_grep;
-        return true;
-      }
-      break;
-    case 7840:
-      HASH_GUARD(0x37C5AF6E7E8B5EA0LL, fputs) {
-        ci = &ci_fputs;
-        return true;
-      }
-      break;
-    case 7843:
-      HASH_GUARD(0x6467FFB910B8BEA3LL, magickspliceimage) {
-        ci = &ci_magickspliceimage;
-        return true;
-      }
-      break;
-    case 7851:
-      HASH_GUARD(0x632D4FC346797EABLL, pixelgetexceptionstring) {
-        ci = &ci_pixelgetexceptionstring;
-        return true;
-      }
-      break;
-    case 7859:
-      HASH_GUARD(0x7DB9D839ACE0DEB3LL, natsort) {
-        ci = &ci_natsort;
-        return true;
-      }
-      break;
-    case 7860:
-      HASH_GUARD(0x1F936B3C5406DEB4LL, fb_set_taint) {
-        ci = &ci_fb_set_taint;
-        return true;
-      }
-      break;
-    case 7863:
-      HASH_GUARD(0x58B9EFA0FB35FEB7LL, stream_filter_prepend) {
-        ci = &ci_stream_filter_prepend;
-        return true;
-      }
-      break;
-    case 7865:
-      HASH_GUARD(0x2A483AD7A3D07EB9LL, magickgetwandsize) {
-        ci = &ci_magickgetwandsize;
-        return true;
-      }
-      break;
-    case 7866:
-      HASH_GUARD(0x1F5B2728DE875EBALL, magicksetimage) {
-        ci = &ci_magicksetimage;
-        return true;
-      }
-      break;
-    case 7869:
-      HASH_GUARD(0x31A30B274AD2DEBDLL, call_user_func_array_rpc) {
-        ci = &ci_call_user_func_array_rpc;
-        return true;
-      }
-      break;
-    case 7872:
-      HASH_GUARD(0x495316E596537EC0LL, imagefttext) {
-        ci = &ci_imagefttext;
-        return true;
-      }
-      break;
-    case 7874:
-      HASH_GUARD(0x4CDD0B7BF826FEC2LL, rewinddir) {
-        ci = &ci_rewinddir;
-        return true;
-      }
-      break;
-    case 7877:
-      HASH_GUARD(0x7D69B3537C353EC5LL, hphp_splfileinfo_isfile) {
-        ci = &ci_hphp_splfileinfo_isfile;
-        return true;
-      }
-      break;
-    case 7879:
-      HASH_GUARD(0x4FC99DC20A955EC7LL, session_module_name) {
-        ci = &ci_session_module_name;
-        return true;
-      }
-      break;
-    case 7894:
-      HASH_GUARD(0x134B37520683DED6LL, imagesetbrush) {
-        ci = &ci_imagesetbrush;
-        return true;
-      }
-      break;
-    case 7896:
-      HASH_GUARD(0x338D9D95095D1ED8LL, magicksetimagedelay) {
-        ci = &ci_magicksetimagedelay;
-        return true;
-      }
-      break;
-    case 7897:
-      HASH_GUARD(0x7F802A06996BBED9LL, apd_set_browser_trace) {
-        ci = &ci_apd_set_browser_trace;
-        return true;
-      }
-      break;
-    case 7898:
-      HASH_GUARD(0x29E2771785CCBEDALL, magickgettextdescent) {
-        ci = &ci_magickgettextdescent;
-        return true;
-      }
-      break;
-    case 7899:
-      HASH_GUARD(0x1340509769275EDBLL, magickgetimagecompression) {
-        ci = &ci_magickgetimagecompression;
-        return true;
-      }
-      break;
-    case 7905:
-      HASH_GUARD(0x528BA9796BD0FEE1LL, fb_rpc_intercept_handler) {
-        ci = &ci_fb_rpc_intercept_handler;
-        return true;
-      }
-      break;
-    case 7907:
-      HASH_GUARD(0x28A98134BD97BEE3LL, mb_regex_encoding) {
-        ci = &ci_mb_regex_encoding;
-        return true;
-      }
-      HASH_GUARD(0x0D76FFBE30B13EE3LL, imap_mailboxmsginfo) {
-        ci = &ci_imap_mailboxmsginfo;
-        return true;
-      }
-      break;
-    case 7908:
-      HASH_GUARD(0x5B6FF42ACB2FBEE4LL, getmyuid) {
-        ci = &ci_getmyuid;
-        return true;
-      }
-      break;
-    case 7912:
-      HASH_GUARD(0x32B3951DFD2B9EE8LL, hphp_directoryiterator_isdot) {
-        ci = &ci_hphp_directoryiterator_isdot;
-        return true;
-      }
-      break;
-    case 7916:
-      HASH_GUARD(0x115CC08BC872FEECLL, fb_output_compression) {
-        ci = &ci_fb_output_compression;
-        return true;
-      }
-      break;
-    case 7920:
-      HASH_GUARD(0x7DFF9707F1CD9EF0LL, dangling_server_proxy_old_request) {
-        ci = &ci_dangling_server_proxy_old_request;
-        return true;
-      }
-      break;
-    case 7922:
-      HASH_GUARD(0x7601F38FDB3DDEF2LL, hphp_service_thread_stopped) {
-        ci = &ci_hphp_service_thread_stopped;
-        return true;
-      }
-      break;
-    case 7929:
-      HASH_GUARD(0x200FC256EB093EF9LL, gettimeofday) {
-        ci = &ci_gettimeofday;
-        return true;
-      }
-      break;
-    case 7931:
-      HASH_GUARD(0x6D450F078F02BEFBLL, apd_continue) {
-        ci = &ci_apd_continue;
-        return true;
-      }
-      break;
-    case 7936:
-      HASH_GUARD(0x09637D7CA2E33F00LL, fgetc) {
-        ci = &ci_fgetc;
-        return true;
-      }
-      break;
-    case 7937:
-      HASH_GUARD(0x66137942508EBF01LL, date_create) {
-        ci = &ci_date_create;
-        return true;
-      }
-      break;
-    case 7938:
-      HASH_GUARD(0x78A02A603FA6FF02LL, magickreducenoiseimage) {
-        ci = &ci_magickreducenoiseimage;
-        return true;
-      }
-      break;
-    case 7951:
-      HASH_GUARD(0x61E7A36CA7FF5F0FLL, drawsetcliprule) {
-        ci = &ci_drawsetcliprule;
-        return true;
-      }
-      HASH_GUARD(0x4BD54A631F665F0FLL, drawpathcurvetosmoothabsolute) {
-        ci = &ci_drawpathcurvetosmoothabsolute;
-        return true;
-      }
-      break;
-    case 7955:
-      HASH_GUARD(0x3B197C0731233F13LL, dom_characterdata_substring_data) {
-        ci = &ci_dom_characterdata_substring_data;
-        return true;
-      }
-      break;
-    case 7963:
-      HASH_GUARD(0x27A4633381195F1BLL, chown) {
-        ci = &ci_chown;
-        return true;
-      }
-      break;
-    case 7967:
-      HASH_GUARD(0x7C0C145EFE0EBF1FLL, defined) {
-        ci = &ci_defined;
-        return true;
-      }
-      break;
-    case 7969:
-      HASH_GUARD(0x1FF5B9A4FC78BF21LL, drawsettextantialias) {
-        ci = &ci_drawsettextantialias;
-        return true;
-      }
-      HASH_GUARD(0x20DD4631AD975F21LL, imap_rfc822_write_address) {
-        ci = &ci_imap_rfc822_write_address;
-        return true;
-      }
-      break;
-    case 7980:
-      HASH_GUARD(0x035EFF9E1757DF2CLL, http_build_query) {
-        ci = &ci_http_build_query;
-        return true;
-      }
-      HASH_GUARD(0x22607B4EE253DF2CLL, imap_savebody) {
-        ci = &ci_imap_savebody;
-        return true;
-      }
-      break;
-    case 7986:
-      HASH_GUARD(0x78257F34467BDF32LL, drawsetstrokedasharray) {
-        ci = &ci_drawsetstrokedasharray;
-        return true;
-      }
-      HASH_GUARD(0x2B66EACB77AE9F32LL, print_r) {
-        ci = &ci_print_r;
-        return true;
-      }
-      break;
-    case 7993:
-      HASH_GUARD(0x3E9146C06AAEFF39LL, magicksetimagecompressionquality) {
-        ci = &ci_magicksetimagecompressionquality;
-        return true;
-      }
-      break;
-    case 8004:
-      HASH_GUARD(0x65353A823EB91F44LL, imap_mail_compose) {
-        ci = &ci_imap_mail_compose;
-        return true;
-      }
-      break;
-    case 8021:
-      HASH_GUARD(0x49D986274B1C5F55LL, collator_asort) {
-        ci = &ci_collator_asort;
-        return true;
-      }
-      break;
-    case 8024:
-      HASH_GUARD(0x0551AAE8F1A6FF58LL, magicklevelimage) {
-        ci = &ci_magicklevelimage;
-        return true;
-      }
-      break;
-    case 8027:
-      HASH_GUARD(0x76418F884500DF5BLL, stream_socket_enable_crypto) {
-        ci = &ci_stream_socket_enable_crypto;
-        return true;
-      }
-      break;
-    case 8029:
-      HASH_GUARD(0x07FF92CF46DDFF5DLL, imagepsfreefont) {
-        ci = &ci_imagepsfreefont;
-        return true;
-      }
-      break;
-    case 8036:
-      HASH_GUARD(0x41EF51E62AD3DF64LL, pagelet_server_is_enabled) {
-        ci = &ci_pagelet_server_is_enabled;
-        return true;
-      }
-      HASH_GUARD(0x280051555A21DF64LL, rename) {
-        ci = &ci_rename;
-        return true;
-      }
-      break;
-    case 8043:
-      HASH_GUARD(0x56EF59D6CB0A5F6BLL, dom_document_save_html_file) {
-        ci = &ci_dom_document_save_html_file;
-        return true;
-      }
-      break;
-    case 8044:
-      HASH_GUARD(0x23D5E9E53D11BF6CLL, gmdate) {
-        ci = &ci_gmdate;
-        return true;
-      }
-      break;
-    case 8050:
-      HASH_GUARD(0x4B22EF06BAA83F72LL, version_compare) {
-        ci = &ci_version_compare;
-        return true;
-      }
-      break;
-    case 8062:
-      HASH_GUARD(0x7064BEBF508F3F7ELL, socket_read) {
-        ci = &ci_socket_read;
-        return true;
-      }
-      break;
-    case 8064:
-      HASH_GUARD(0x63F18DE0DB807F80LL, magickqueryfonts) {
-        ci = &ci_magickqueryfonts;
-        return true;
-      }
-      break;
-    case 8068:
-      HASH_GUARD(0x14402B01D00E9F84LL, magicksteganoimage) {
-        ci = &ci_magicksteganoimage;
-        return true;
-      }
-      break;
-    case 8070:
-      HASH_GUARD(0x44CE4DB1CE7E9F86LL, flock) {
-        ci = &ci_flock;
-        return true;
-      }
-      break;
-    case 8075:
-      HASH_GUARD(0x2755DD4112AA5F8BLL, magicksampleimage) {
-        ci = &ci_magicksampleimage;
-        return true;
-      }
-      break;
-    case 8078:
-      HASH_GUARD(0x7A8F1104B0CCDF8ELL, phpcredits) {
-        ci = &ci_phpcredits;
-        return true;
-      }
-      break;
-    case 8079:
-      HASH_GUARD(0x4A6C46DC7FE29F8FLL, hphp_recursivedirectoryiterator_getchildren) {
-        ci = &ci_hphp_recursivedirectoryiterator_getchildren;
-        return true;
-      }
-      break;
-    case 8081:
-      HASH_GUARD(0x78463112BE739F91LL, connection_timeout) {
-        ci = &ci_connection_timeout;
-        return true;
-      }
-      break;
-    case 8085:
-      HASH_GUARD(0x40D620CBA0D41F95LL, opendir) {
-        ci = &ci_opendir;
-        return true;
-      }
-      break;
-    case 8087:
-      HASH_GUARD(0x35117886C885DF97LL, hphp_recursivedirectoryiterator_getsubpathname) {
-        ci = &ci_hphp_recursivedirectoryiterator_getsubpathname;
-        return true;
-      }
-      break;
-    case 8088:
-      HASH_GUARD(0x0293F60B46511F98LL, drawsetfontstretch) {
-        ci = &ci_drawsetfontstretch;
-        return true;
-      }
-      break;
-    case 8090:
-      HASH_GUARD(0x2B7CAC006AF27F9ALL, fflush) {
-        ci = &ci_fflush;
-        return true;
-      }
-      break;
-    case 8093:
-      HASH_GUARD(0x0AD6DE8829773F9DLL, apc_compile_file) {
-        ci = &ci_apc_compile_file;
-        return true;
-      }
-      break;
-    case 8100:
-      HASH_GUARD(0x0E7E9AA21AE99FA4LL, hphp_recursiveiteratoriterator_current) {
-        ci = &ci_hphp_recursiveiteratoriterator_current;
-        return true;
-      }
-      break;
-    case 8102:
-      HASH_GUARD(0x0DEEA8C3E3A47FA6LL, read_exif_data) {
-        ci = &ci_read_exif_data;
-        return true;
-      }
-      break;
-    case 8110:
-      HASH_GUARD(0x64D269A505D51FAELL, array_map) {
-        ci = &ci_array_map;
-        return true;
-      }
-      break;
-    case 8113:
-      HASH_GUARD(0x0F78ECF42C30DFB1LL, array_chunk) {
-        ci = &ci_array_chunk;
-        return true;
-      }
-      break;
-    case 8119:
-      HASH_GUARD(0x6465CD999F4C5FB7LL, hphp_invoke_method) {
-        ci = &ci_hphp_invoke_method;
-        return true;
-      }
-      break;
-    case 8120:
-      HASH_GUARD(0x6DB2DB341ECF3FB8LL, file_exists) {
-        ci = &ci_file_exists;
-        return true;
-      }
-      break;
-    case 8129:
-      HASH_GUARD(0x3FF9AAFF85DDDFC1LL, class_parents) {
-        ci = &ci_class_parents;
-        return true;
-      }
-      break;
-    case 8130:
-      HASH_GUARD(0x460470C490FAFFC2LL, dom_node_normalize) {
-        ci = &ci_dom_node_normalize;
-        return true;
-      }
-      break;
-    case 8142:
-      HASH_GUARD(0x042193C97C65FFCELL, magickwaveimage) {
-        ci = &ci_magickwaveimage;
-        return true;
-      }
-      break;
-    case 8144:
-      HASH_GUARD(0x53DB5D0490C51FD0LL, xhprof_sample_disable) {
-        ci = &ci_xhprof_sample_disable;
-        return true;
-      }
-      break;
-    case 8150:
-      HASH_GUARD(0x7FC00035D14B9FD6LL, apc_delete_file) {
-        ci = &ci_apc_delete_file;
-        return true;
-      }
-      break;
-    case 8152:
-      HASH_GUARD(0x4234F2B59531FFD8LL, posix_getlogin) {
-        ci = &ci_posix_getlogin;
-        return true;
-      }
-      break;
-    case 8157:
-      HASH_GUARD(0x4EDEDA4278CD3FDDLL, magickchopimage) {
-        ci = &ci_magickchopimage;
-        return true;
-      }
-      break;
-    case 8158:
-      HASH_GUARD(0x7F5FC3CAF8CE9FDELL, gzcompress) {
-        ci = &ci_gzcompress;
-        return true;
-      }
-      HASH_GUARD(0x72925D2DF7E61FDELL, drawpathcurvetoquadraticbeziersmoothrelative) {
-        ci = &ci_drawpathcurvetoquadraticbeziersmoothrelative;
-        return true;
-      }
-      break;
-    case 8168:
-      HASH_GUARD(0x4D7AEC41CFD73FE8LL, hphp_recursivedirectoryiterator_getsubpath) {
-        ci = &ci_hphp_recursivedirectoryiterator_getsubpath;
-        return true;
-      }
-      break;
-    case 8171:
-      HASH_GUARD(0x67D1EE05DFE71FEBLL, hphp_splfileobject_getcvscontrol) {
-        ci = &ci_hphp_splfileobject_getcvscontrol;
-        return true;
-      }
-      break;
-    case 8175:
-      HASH_GUARD(0x00EEEE9C6CEA5FEFLL, xmlwriter_write_element_ns) {
-        ci = &ci_xmlwriter_write_element_ns;
-        return true;
-      }
-      break;
-    case 8182:
-      HASH_GUARD(0x25FCE64E12505FF6LL, magicksetimagerenderingintent) {
-        ci = &ci_magicksetimagerenderingintent;
-        return true;
-      }
-      break;
-    case 8186:
-      HASH_GUARD(0x13EE24AF67113FFALL, ob_end_flush) {
-        ci = &ci_ob_end_flush;
-        return true;
-      }
-      break;
-    case 8187:
-      HASH_GUARD(0x63BE4CEF1FC47FFBLL, imagefill) {
-        ci = &ci_imagefill;
-        return true;
-      }
-      break;
-    default:
-      break;
+  const hashNodeCI &p = funcSlots[perfect_hash_slot(hash, funcDisps[hash & 1023], 4095)];
+  if (p.hash == hash && !strcasecmp(p.name, s)) {
+    ci = p.ci;
+    return true;
   }
   return false;
 }
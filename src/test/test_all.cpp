@@ -53,6 +53,16 @@ void Test::RunTestsImpl(bool &allPassed, std::string &suite,
     RUN_TESTSUITE(TestPerformance);
     return;
   }
+  if (suite == "TestBenchmark") {
+    RUN_TESTSUITE(TestBenchmark);
+    return;
+  }
+  if (suite == "TestBenchmarkEval") {
+    suite = "TestBenchmark";
+    Option::EnableEval = Option::FullEval;
+    RUN_TESTSUITE(TestBenchmark);
+    return;
+  }
 
   // fast unit tests
   if (set != "TestExt") {
@@ -0,0 +1,829 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <test/test_benchmark.h>
+#include <compiler/option.h>
+#include <runtime/ext/ext_json.h>
+#include <util/util.h>
+#include <util/process.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <math.h>
+
+using namespace std;
+
+#define BENCH_WARMUP 3
+#define BENCH_REPS 20
+
+// Benchmark body runs in bench_run() with $bench_i as loop counter. Whatever
+// it assigns to $sink is kept alive, so the optimizer can't drop the work.
+// The memory still held once setup has run is reported as well.
+#define BENCH_START                                                     \
+  "<?php\n"                                                             \
+  "function bench_keep($v) { static $keep; $keep = $v; }\n"             \
+  "function bench_setup_mem($v = null) {\n"                             \
+  "  static $mem = 0;\n"                                                \
+  "  if ($v !== null) $mem = $v;\n"                                     \
+  "  return $mem;\n"                                                    \
+  "}\n"
+
+#define BENCH_RUN                                                       \
+  "\n"                                                                  \
+  "if (getenv('HPHP_BENCH_EMPTY')) exit;\n"                             \
+  "function bench_run($bench_n) {\n"                                    \
+  "  $sink = null;\n"                                                   \
+  "  $bench_mem = memory_get_usage();\n"
+
+#define BENCH_LOOP                                                      \
+  "\n"                                                                  \
+  "  bench_setup_mem(memory_get_usage() - $bench_mem);\n"               \
+  "  $bench_start = microtime(true);\n"                                 \
+  "  for ($bench_i = 0; $bench_i < $bench_n; $bench_i++) {\n"
+
+#define BENCH_END                                                       \
+  "\n"                                                                  \
+  "  }\n"                                                               \
+  "  $bench_time = microtime(true) - $bench_start;\n"                   \
+  "  bench_keep($sink);\n"                                              \
+  "  return $bench_time;\n"                                             \
+  "}\n"                                                                 \
+  "for ($r = 0; $r < %d; $r++) bench_run(%d);\n"                        \
+  "for ($r = 0; $r < %d; $r++) {\n"                                     \
+  "  echo 'bench: ', (int)(bench_run(%d) * 1000000000), \"\\n\";\n"     \
+  "}\n"                                                                 \
+  "echo 'mem: ', bench_setup_mem(), \"\\n\";\n"
+
+#define BENCH(name, decls, setup, body, iterations)                     \
+  if (!addBenchmark(name, decls, setup, body, iterations)) return false
+
+#define BENCH_CONFIG(name, decls, setup, body, iterations, config)      \
+  if (!addBenchmark(name, decls, setup, body, iterations, config))      \
+    return false
+
+///////////////////////////////////////////////////////////////////////////////
+// hardware counters
+
+/**
+ * Counts hardware events of child processes started between start() and
+ * stop(). Counters the kernel or the CPU doesn't support read as -1.
+ */
+class HardwareCounters {
+public:
+  enum Counter { Cycles, Instructions, CacheMisses, BranchMisses, Count };
+
+  HardwareCounters() {
+    static const unsigned long long configs[Count] = {
+      PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_BRANCH_MISSES,
+    };
+    for (int i = 0; i < Count; i++) {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = configs[i];
+      attr.disabled = 1;
+      attr.inherit = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      m_fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+  }
+
+  ~HardwareCounters() {
+    for (int i = 0; i < Count; i++) {
+      if (m_fds[i] >= 0) close(m_fds[i]);
+    }
+  }
+
+  void start() {
+    for (int i = 0; i < Count; i++) {
+      if (m_fds[i] >= 0) {
+        ioctl(m_fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+  }
+
+  void stop() {
+    for (int i = 0; i < Count; i++) {
+      if (m_fds[i] >= 0) ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+
+  double get(Counter c) const {
+    unsigned long long value;
+    if (m_fds[c] < 0 ||
+        read(m_fds[c], &value, sizeof(value)) != sizeof(value)) {
+      return -1;
+    }
+    return value;
+  }
+
+private:
+  int m_fds[Count];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+TestBenchmark::TestBenchmark() {
+  TestCodeRun::FastMode = false;
+}
+
+bool TestBenchmark::RunTests(const std::string &which) {
+  bool ret = true;
+  RUN_TEST(BenchArrays);
+  RUN_TEST(BenchArrayShapes);
+  RUN_TEST(BenchStrings);
+  RUN_TEST(BenchFunctionCalls);
+  RUN_TEST(BenchObjects);
+  RUN_TEST(BenchSerialization);
+  RUN_TEST(BenchAPC);
+  RUN_TEST(BenchPreg);
+  RUN_TEST(BenchHashes);
+  RUN_TEST(BenchEncoding);
+  RUN_TEST(BenchSessions);
+
+  bool eval = Option::EnableEval >= Option::FullEval;
+  const char *output = getenv("BENCHMARK_OUTPUT");
+  const char *baseline = getenv("BENCHMARK_BASELINE");
+  const char *threshold = getenv("BENCHMARK_THRESHOLD");
+  if (!writeResults(output ? output : eval ? "runtime/tmp/benchmark_eval.json"
+                                           : "runtime/tmp/benchmark.json")) {
+    ret = false;
+  }
+  if (baseline && *baseline &&
+      !checkBaseline(baseline, threshold ? atof(threshold) : 0.1)) {
+    ret = false;
+  }
+  return ret;
+}
+
+bool TestBenchmark::preTest() {
+  m_benchmarks.clear();
+  return TestCodeRun::preTest();
+}
+
+bool TestBenchmark::postTest() {
+  if (Option::EnableEval < Option::FullEval && !CompileFiles()) {
+    return false;
+  }
+  bool ret = true;
+  for (unsigned int i = 0; i < m_benchmarks.size(); i++) {
+    ostringstream os;
+    os << "Test" << i;
+    if (!Count(runBenchmark(m_benchmarks[i], os.str().c_str()))) {
+      ret = false;
+    }
+  }
+  return ret;
+}
+
+bool TestBenchmark::addBenchmark(const char *name, const char *decls,
+                                 const char *setup, const char *body,
+                                 int iterations,
+                                 const char *config /* = NULL */) {
+  char end[1024];
+  snprintf(end, sizeof(end), BENCH_END,
+           BENCH_WARMUP, iterations, BENCH_REPS, iterations);
+  string input = string(BENCH_START) + decls + BENCH_RUN + setup +
+    BENCH_LOOP + body + end;
+
+  Benchmark bench;
+  bench.name = name;
+  bench.input = input;
+  bench.config = config ? config : "";
+  bench.iterations = iterations;
+  m_benchmarks.push_back(bench);
+  return RecordMulti(m_benchmarks.back().input.c_str(), NULL,
+                     __FILE__, __LINE__, false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool run_program(const char *subdir, const string &config,
+                        string &out, string &err) {
+  string dir = string("runtime/tmp/") + subdir + "/";
+  if (Option::EnableEval < Option::FullEval) {
+    string path = dir + "test";
+    const char *argv[] = {"", "--file=string", "--config=test/config.hdf",
+                          config.empty() ? NULL : "-v", config.c_str(), NULL};
+    return Process::Exec(path.c_str(), argv, NULL, out, &err);
+  }
+  string filearg = "--file=" + dir + "main.php";
+  const char *argv[] = {"", filearg.c_str(), "--config=test/config.hdf",
+                        config.empty() ? NULL : "-v", config.c_str(), NULL};
+  return Process::Exec("hphpi/hphpi", argv, NULL, out, &err);
+}
+
+static double percentile(const vector<double> &sorted, double p) {
+  int rank = (int)ceil(p * sorted.size()) - 1;
+  if (rank < 0) rank = 0;
+  return sorted[rank];
+}
+
+bool TestBenchmark::runBenchmark(const Benchmark &bench, const char *subdir) {
+  if (Option::EnableEval >= Option::FullEval) {
+    string path = string("runtime/tmp/") + subdir + "/main.php";
+    Util::mkdir(path.c_str());
+    ofstream f(path.c_str());
+    f << bench.input;
+    f.close();
+    if (!f) {
+      printf("Unable to write %s\n", path.c_str());
+      return false;
+    }
+  }
+
+  // startup and compilation costs, to be taken out of counter values
+  HardwareCounters counters;
+  double empty[HardwareCounters::Count];
+  string out, err;
+  setenv("HPHP_BENCH_EMPTY", "1", 1);
+  counters.start();
+  run_program(subdir, bench.config, out, err);
+  counters.stop();
+  unsetenv("HPHP_BENCH_EMPTY");
+  for (int i = 0; i < HardwareCounters::Count; i++) {
+    empty[i] = counters.get((HardwareCounters::Counter)i);
+  }
+
+  out.clear();
+  err.clear();
+  counters.start();
+  bool ok = run_program(subdir, bench.config, out, err);
+  counters.stop();
+
+  vector<double> times;
+  double setupBytes = 0;
+  istringstream is(out);
+  string line;
+  while (getline(is, line)) {
+    if (line.compare(0, 7, "bench: ") == 0) {
+      times.push_back(atof(line.c_str() + 7) / bench.iterations);
+    } else if (line.compare(0, 5, "mem: ") == 0) {
+      setupBytes = atof(line.c_str() + 5);
+    }
+  }
+  if (!ok || times.size() != BENCH_REPS) {
+    printf("%s: benchmark failed to run:\n%s%s\n",
+           bench.name.c_str(), out.c_str(), err.c_str());
+    return false;
+  }
+
+  Result r;
+  r.name = bench.name;
+  r.iterations = bench.iterations;
+  r.reps = times.size();
+  r.setupBytes = setupBytes;
+  double sum = 0.0;
+  for (unsigned int i = 0; i < times.size(); i++) sum += times[i];
+  r.mean = sum / times.size();
+  double var = 0.0;
+  for (unsigned int i = 0; i < times.size(); i++) {
+    var += (times[i] - r.mean) * (times[i] - r.mean);
+  }
+  r.stddev = sqrt(var / times.size());
+  sort(times.begin(), times.end());
+  r.min = times[0];
+  r.median = percentile(times, 0.5);
+  r.p90 = percentile(times, 0.9);
+  r.p99 = percentile(times, 0.99);
+
+  double *counts[] = {&r.cycles, &r.instructions, &r.cacheMisses,
+                      &r.branchMisses};
+  double runs = (double)(BENCH_WARMUP + BENCH_REPS) * bench.iterations;
+  for (int i = 0; i < HardwareCounters::Count; i++) {
+    double total = counters.get((HardwareCounters::Counter)i);
+    *counts[i] = (total < 0 || empty[i] < 0) ? -1 :
+      (total > empty[i] ? total - empty[i] : 0) / runs;
+  }
+  m_results.push_back(r);
+
+  printf("%-24s %10.1f ns  (min %.1f, p90 %.1f, p99 %.1f, stddev %.1f)"
+         "  setup %.0f bytes\n",
+         r.name.c_str(), r.median, r.min, r.p90, r.p99, r.stddev,
+         r.setupBytes);
+  return true;
+}
+
+bool TestBenchmark::writeResults(const std::string &file) {
+  string revision, err;
+  const char *argv[] = {"", "rev-parse", "HEAD", NULL};
+  if (!Process::Exec("git", argv, NULL, revision, &err)) {
+    revision.clear();
+  }
+  size_t pos = revision.find_first_of("\r\n");
+  if (pos != string::npos) revision = revision.substr(0, pos);
+
+  ofstream f(file.c_str());
+  f << "{\n"
+    << "  \"mode\": \""
+    << (Option::EnableEval >= Option::FullEval ? "eval" : "compiled")
+    << "\",\n"
+    << "  \"revision\": \"" << revision << "\",\n"
+    << "  \"warmup\": " << BENCH_WARMUP << ",\n"
+    << "  \"unit\": \"ns\",\n"
+    << "  \"benchmarks\": {";
+  for (unsigned int i = 0; i < m_results.size(); i++) {
+    const Result &r = m_results[i];
+    char buf[1024];
+    snprintf(buf, sizeof(buf),
+             "%s\n    \"%s\": {\"iterations\": %d, \"reps\": %d, "
+             "\"min\": %.2f, \"median\": %.2f, \"p90\": %.2f, "
+             "\"p99\": %.2f, \"mean\": %.2f, \"stddev\": %.2f, "
+             "\"cycles\": %.1f, \"instructions\": %.1f, "
+             "\"cache_misses\": %.3f, \"branch_misses\": %.3f, "
+             "\"setup_bytes\": %.0f}",
+             i ? "," : "", r.name.c_str(), r.iterations, r.reps,
+             r.min, r.median, r.p90, r.p99, r.mean, r.stddev,
+             r.cycles, r.instructions, r.cacheMisses, r.branchMisses,
+             r.setupBytes);
+    f << buf;
+  }
+  f << "\n  }\n}\n";
+  f.close();
+  if (!f) {
+    printf("Unable to write benchmark results to %s\n", file.c_str());
+    return false;
+  }
+  printf("Benchmark results written to %s\n", file.c_str());
+  return true;
+}
+
+bool TestBenchmark::checkBaseline(const std::string &file, double threshold) {
+  ifstream f(file.c_str());
+  ostringstream content;
+  content << f.rdbuf();
+  Variant baseline = f_json_decode(String(content.str()), true);
+  if (!baseline.isArray()) {
+    printf("Unable to read baseline %s\n", file.c_str());
+    return false;
+  }
+  Variant benchmarks = baseline.rvalAt("benchmarks");
+
+  bool ret = true;
+  for (unsigned int i = 0; i < m_results.size(); i++) {
+    const Result &r = m_results[i];
+    String name(r.name);
+    if (!benchmarks.isArray() || !benchmarks.toArray().exists(name)) continue;
+    double before = benchmarks.rvalAt(name).rvalAt("median").toDouble();
+    if (before <= 0) continue;
+    double change = (r.median - before) / before;
+    if (change > threshold) {
+      printf("%s regressed: %.1f ns -> %.1f ns (+%.1f%%)\n",
+             r.name.c_str(), before, r.median, change * 100);
+      ret = false;
+    } else if (change < -threshold) {
+      printf("%s improved: %.1f ns -> %.1f ns (%.1f%%)\n",
+             r.name.c_str(), before, r.median, change * 100);
+    }
+  }
+  return ret;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TestBenchmark::BenchArrays() {
+  BENCH("array_append", "", "",
+        "$a = array();\n"
+        "for ($j = 0; $j < 100; $j++) $a[] = $j;\n"
+        "$sink = $a;",
+        5000);
+
+  BENCH("array_iterate", "",
+        "$a = range(0, 999);",
+        "$s = 0;\n"
+        "foreach ($a as $v) $s += $v;\n"
+        "$sink = $s;",
+        1000);
+
+  BENCH("array_string_keys", "",
+        "$keys = array();\n"
+        "for ($j = 0; $j < 100; $j++) $keys[] = 'key' . $j;",
+        "$a = array();\n"
+        "foreach ($keys as $k) $a[$k] = $k;\n"
+        "$sink = isset($a['key50']);",
+        2000);
+
+  BENCH("array_copy_on_write", "",
+        "$a = range(0, 999);",
+        "$b = $a;\n"
+        "$b[] = $bench_i;\n"
+        "$sink = $b;",
+        2000);
+
+  BENCH("array_sort", "",
+        "mt_srand(1);\n"
+        "$a = array();\n"
+        "for ($j = 0; $j < 1000; $j++) $a[] = mt_rand();",
+        "$b = $a;\n"
+        "sort($b);\n"
+        "$sink = $b;",
+        200);
+
+  return true;
+}
+
+// All of these run under HphpArray, once on a list that is still packed and
+// once on the same list forced into the hashed layout by adding and removing
+// a string key. The setup memory shows what dropping the hash table saves.
+bool TestBenchmark::BenchArrayShapes() {
+  static const char *hphp = "Server.UseHphpArray=true";
+  static const char *packed = "$a = range(0, 999);";
+  static const char *hashed =
+    "$a = range(0, 999);\n"
+    "$a['x'] = 0;\n"
+    "unset($a['x']);";
+
+  static const char *build =
+    "$b = $a;\n"
+    "for ($j = 0; $j < 1000; $j++) $b[] = $j;\n"
+    "$sink = count($b);";
+  BENCH_CONFIG("list_build_packed", "", "$a = array();", build, 500, hphp);
+  BENCH_CONFIG("list_build_hashed", "",
+               "$a = array('x' => 0);\n"
+               "unset($a['x']);",
+               build, 500, hphp);
+
+  static const char *read =
+    "$s = 0;\n"
+    "for ($j = 0; $j < 1000; $j++) $s += $a[$j];\n"
+    "$sink = $s;";
+  BENCH_CONFIG("list_read_packed", "", packed, read, 500, hphp);
+  BENCH_CONFIG("list_read_hashed", "", hashed, read, 500, hphp);
+
+  static const char *iterate =
+    "$s = 0;\n"
+    "foreach ($a as $v) $s += $v;\n"
+    "$sink = $s;";
+  BENCH_CONFIG("list_iterate_packed", "", packed, iterate, 500, hphp);
+  BENCH_CONFIG("list_iterate_hashed", "", hashed, iterate, 500, hphp);
+
+  static const char *encode = "$sink = json_encode($a);";
+  BENCH_CONFIG("list_json_encode_packed", "", packed, encode, 200, hphp);
+  BENCH_CONFIG("list_json_encode_hashed", "", hashed, encode, 200, hphp);
+
+  return true;
+}
+
+bool TestBenchmark::BenchStrings() {
+  BENCH("string_concat", "", "",
+        "$s = '';\n"
+        "for ($j = 0; $j < 100; $j++) $s .= 'abc';\n"
+        "$sink = $s;",
+        5000);
+
+  BENCH("string_template", "",
+        "$rows = array();"
+        "for ($j = 0; $j < 50; $j++) {"
+        "  $rows[] = array('id' => $j, 'name' => 'item' . $j);"
+        "}",
+        "$html = '<table>';\n"
+        "foreach ($rows as $r) {\n"
+        "  $html .= '<tr><td>' . $r['id'] . '</td><td>';\n"
+        "  $html .= htmlspecialchars($r['name']);\n"
+        "  $html .= \"</td><td class=\\\"n{$r['id']}\\\">x</td></tr>\";\n"
+        "}\n"
+        "$html .= '</table>';\n"
+        "$sink = strlen($html);",
+        5000);
+
+  BENCH("string_functions", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = strlen(strtolower($s)) + strpos($s, 'World', 500);",
+        20000);
+
+  BENCH("string_replace", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = str_replace('World', 'There', $s);",
+        20000);
+
+  BENCH("string_htmlspecialchars", "",
+        "$s = str_repeat('<a href=\"x\">Tom & Jerry</a> text ', 50);",
+        "$sink = htmlspecialchars($s);",
+        20000);
+
+  BENCH("string_htmlspecialchars_page", "",
+        "$s = str_repeat('<div class=\"post\"><h2>Weekly update</h2>"
+        "<p>The team shipped the new search page, fixed a dozen bugs in "
+        "checkout and started on the mobile layout. Thanks to everyone who "
+        "filed reports &amp; tested the betas.</p>"
+        "<a href=\"/posts/42?ref=feed\">Read more</a></div>\n', 200);",
+        "$sink = htmlspecialchars($s);",
+        2000);
+
+  BENCH("string_htmlspecialchars_clean", "",
+        "$s = str_repeat('Plain text with no markup in it at all. ', 100);",
+        "$sink = htmlspecialchars($s);",
+        20000);
+
+  BENCH("string_strtolower", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = strtolower($s);",
+        20000);
+
+  BENCH("string_strtolower_clean", "",
+        "$s = str_repeat('hello world ', 100);",
+        "$sink = strtolower($s);",
+        20000);
+
+  BENCH("string_strtoupper", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = strtoupper($s);",
+        20000);
+
+  BENCH("string_trim", "",
+        "$s = '  ' . str_repeat('Hello World ', 100) . \"\\n\";",
+        "$sink = trim($s);",
+        20000);
+
+  BENCH("string_strpos", "",
+        "$s = str_repeat('Hello World ', 100) . 'needle';",
+        "$sink = strpos($s, 'needle');",
+        20000);
+
+  BENCH("string_stripos", "",
+        "$s = str_repeat('Hello World ', 100) . 'NeedLe';",
+        "$sink = stripos($s, 'needle');",
+        20000);
+
+  BENCH("string_str_ireplace", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = str_ireplace('world', 'There', $s);",
+        20000);
+
+  BENCH("string_replace_clean", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = str_replace('needle', 'There', $s);",
+        20000);
+
+  BENCH("string_strtr", "",
+        "$s = str_repeat('Hello World ', 100);",
+        "$sink = strtr($s, 'lo', 'LO');",
+        20000);
+
+  BENCH("string_strtr_array", "",
+        "$s = str_repeat('Hello {name}, welcome to {site}. ', 40);"
+        "$map = array('{name}' => 'Tom', '{site}' => 'example.com');",
+        "$sink = strtr($s, $map);",
+        20000);
+
+  BENCH("string_addslashes", "",
+        "$s = str_repeat('It\\'s a \"quoted\" string with a few quotes. ', 30);",
+        "$sink = addslashes($s);",
+        20000);
+
+  BENCH("string_sprintf", "", "",
+        "$sink = sprintf('%s:%d:%.2f', 'abc', $bench_i, 1.5);",
+        100000);
+
+  BENCH("string_explode_implode", "",
+        "$s = implode(',', range(0, 99));",
+        "$sink = implode(';', explode(',', $s));",
+        20000);
+
+  return true;
+}
+
+bool TestBenchmark::BenchFunctionCalls() {
+  static const char *decls =
+    "function bench_leaf($a, $b) { return $a + $b; }\n"
+    "function bench_fib($n) {\n"
+    "  return $n < 2 ? $n : bench_fib($n - 1) + bench_fib($n - 2);\n"
+    "}\n";
+
+  BENCH("call_leaf", decls, "",
+        "$sink = bench_leaf($bench_i, 1);",
+        500000);
+
+  BENCH("call_dynamic", decls,
+        "$f = 'bench_leaf';",
+        "$sink = $f($bench_i, 1);",
+        500000);
+
+  BENCH("call_user_func", decls, "",
+        "$sink = call_user_func('bench_leaf', $bench_i, 1);",
+        200000);
+
+  BENCH("call_builtin", decls, "",
+        "$sink = abs($bench_i);",
+        500000);
+
+  BENCH("call_recursive_fib", decls, "",
+        "$sink = bench_fib(15);",
+        200);
+
+  return true;
+}
+
+bool TestBenchmark::BenchObjects() {
+  static const char *decls =
+    "class BenchPoint {\n"
+    "  public $x;\n"
+    "  public $y;\n"
+    "  function __construct($x, $y) { $this->x = $x; $this->y = $y; }\n"
+    "  function len2() { return $this->x * $this->x + $this->y * $this->y; }\n"
+    "  static function make($x) { return new BenchPoint($x, $x); }\n"
+    "}\n";
+
+  BENCH("object_new", decls, "",
+        "$sink = new BenchPoint($bench_i, 2);",
+        200000);
+
+  BENCH("object_method", decls,
+        "$p = new BenchPoint(3, 4);",
+        "$sink = $p->len2();",
+        500000);
+
+  BENCH("object_static_method", decls, "",
+        "$sink = BenchPoint::make($bench_i);",
+        200000);
+
+  BENCH("object_property", decls,
+        "$p = new BenchPoint(3, 4);",
+        "$p->x = $bench_i;\n"
+        "$sink = $p->x + $p->y;",
+        500000);
+
+  BENCH("object_dynamic_property", decls,
+        "$o = new stdClass;",
+        "$o->{'p' . ($bench_i & 15)} = $bench_i;\n"
+        "$sink = $o;",
+        200000);
+
+  return true;
+}
+
+#define BENCH_DATA                                                      \
+  "$data = array();\n"                                                  \
+  "for ($j = 0; $j < 20; $j++) {\n"                                     \
+  "  $data[] = array('id' => $j, 'name' => 'user' . $j, 'score' => 1.5,\n" \
+  "                  'tags' => array('a', 'b', 'c'), 'active' => true);\n" \
+  "}\n"
+
+bool TestBenchmark::BenchSerialization() {
+  BENCH("serialize", "", BENCH_DATA,
+        "$sink = serialize($data);",
+        5000);
+
+  BENCH("unserialize", "", BENCH_DATA
+        "$s = serialize($data);",
+        "$sink = unserialize($s);",
+        5000);
+
+  BENCH("json_encode", "", BENCH_DATA,
+        "$sink = json_encode($data);",
+        5000);
+
+  BENCH("json_decode", "", BENCH_DATA
+        "$s = json_encode($data);",
+        "$sink = json_decode($s, true);",
+        5000);
+
+  return true;
+}
+
+bool TestBenchmark::BenchAPC() {
+  BENCH("apc_fetch_scalar", "",
+        "apc_store('bench_scalar', 'value');",
+        "$sink = apc_fetch('bench_scalar');",
+        200000);
+
+  BENCH("apc_fetch_array", "", BENCH_DATA
+        "apc_store('bench_array', $data);",
+        "$sink = apc_fetch('bench_array');",
+        20000);
+
+  BENCH("apc_nested_read", "",
+        "$cfg = array();"
+        "for ($i = 0; $i < 100; $i++) {"
+        "  $cfg['k' . $i] = array('name' => 'n' . $i, 'tags' => range(0, 9));"
+        "}"
+        "apc_store('bench_nested', $cfg);",
+        "$a = apc_fetch('bench_nested'); $sink = 0;"
+        "foreach ($a as $k => $v) {"
+        "  $sink += strlen($v['name']) + $v['tags'][9];"
+        "}",
+        2000);
+
+  BENCH("apc_store", "", "",
+        "$sink = apc_store('bench_key' . ($bench_i & 255), $bench_i);",
+        100000);
+
+  return true;
+}
+
+bool TestBenchmark::BenchPreg() {
+  BENCH("preg_match", "",
+        "$s = 'someone@example.com';",
+        "$sink = preg_match('/^([a-z]+)@([a-z.]+)$/', $s, $m);",
+        100000);
+
+  BENCH("preg_replace", "",
+        "$s = str_repeat('Hello   World  ', 50);",
+        "$sink = preg_replace('/\\\\s+/', ' ', $s);",
+        10000);
+
+  BENCH("preg_split", "",
+        "$s = implode(', ', range(0, 99));",
+        "$sink = preg_split('/,\\\\s*/', $s);",
+        10000);
+
+  return true;
+}
+
+bool TestBenchmark::BenchHashes() {
+  // a cache key, a small response, and a file-sized blob
+  static const struct {
+    const char *suffix;
+    const char *setup;
+    int iterations;
+  } sizes[] = {
+    {"32",  "$s = str_repeat('k', 32);",           200000},
+    {"1k",  "$s = str_repeat('abcdefgh', 128);",   50000},
+    {"64k", "$s = str_repeat('abcdefgh', 8192);",  1000},
+  };
+  static const struct {
+    const char *name;
+    const char *body;
+  } algos[] = {
+    {"md5",         "$sink = md5($s);"},
+    {"sha1",        "$sink = sha1($s);"},
+    {"crc32",       "$sink = crc32($s);"},
+    {"hash_sha256", "$sink = hash('sha256', $s);"},
+    {"hash_crc32",  "$sink = hash('crc32', $s);"},
+    {"hash_crc32b", "$sink = hash('crc32b', $s);"},
+  };
+
+  for (unsigned int i = 0; i < sizeof(algos) / sizeof(algos[0]); i++) {
+    for (unsigned int j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+      string name = string(algos[i].name) + "_" + sizes[j].suffix;
+      BENCH(name.c_str(), "", sizes[j].setup, algos[i].body,
+            sizes[j].iterations);
+    }
+  }
+  return true;
+}
+
+bool TestBenchmark::BenchEncoding() {
+  // a session token, and a blob the size of a serialized cache entry
+  BENCH("base64_encode_token", "", "$s = str_repeat('t0k', 16);",
+        "$sink = base64_encode($s);", 200000);
+  BENCH("base64_decode_token", "",
+        "$s = base64_encode(str_repeat('t0k', 16));",
+        "$sink = base64_decode($s);", 200000);
+  BENCH("base64_encode_48k", "", "$s = str_repeat('abcdefgh', 6144);",
+        "$sink = base64_encode($s);", 1000);
+  BENCH("base64_decode_48k", "",
+        "$s = base64_encode(str_repeat('abcdefgh', 6144));",
+        "$sink = base64_decode($s);", 1000);
+  BENCH("bin2hex_48k", "", "$s = str_repeat('abcdefgh', 6144);",
+        "$sink = bin2hex($s);", 1000);
+
+  // mostly unreserved characters with the odd separator, like a query string
+  const char *query =
+    "$s = str_repeat('q=hiphop+php&lang=en_US&page=12&ref=home.page ', 256);";
+  BENCH("urlencode_query", "", query, "$sink = urlencode($s);", 5000);
+  BENCH("rawurlencode_query", "", query, "$sink = rawurlencode($s);", 5000);
+  return true;
+}
+
+bool TestBenchmark::BenchSessions() {
+  // one user's request: load the session, bump a counter, save it back
+  static const char *handlers[] = { "files", "memory" };
+  for (unsigned int i = 0; i < sizeof(handlers) / sizeof(handlers[0]); i++) {
+    string setup = string("ini_set('session.save_handler', '") +
+      handlers[i] + "');\n"
+      "session_id('benchmark" + handlers[i] + "');\n"
+      "session_start();\n"
+      "$_SESSION['user'] = array('id' => 12345, 'name' => 'someone',\n"
+      "                          'roles' => array('admin', 'editor'));\n"
+      "session_write_close();";
+    BENCH((string("session_update_") + handlers[i]).c_str(), "",
+          setup.c_str(),
+          "session_start(); $_SESSION['n'] = $bench_i; session_write_close();",
+          10000);
+    BENCH((string("session_readonly_") + handlers[i]).c_str(), "",
+          setup.c_str(),
+          "session_start(); $sink = $_SESSION['user']; session_write_close();",
+          10000);
+  }
+  return true;
+}
@@ -0,0 +1,91 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __TEST_BENCHMARK_H__
+#define __TEST_BENCHMARK_H__
+
+#include <test/test_code_run.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Microbenchmarks of compiled (TestBenchmark) or interpreted
+ * (TestBenchmarkEval) PHP code.
+ *
+ * Each benchmark runs its body in a loop, a few times to warm up and then a
+ * fixed number of timed repetitions. Per-iteration time is reported as min,
+ * median, p90, p99, mean and standard deviation over the repetitions, along
+ * with hardware counters from perf_event_open() when the kernel allows it.
+ *
+ * Results are written as JSON to $BENCHMARK_OUTPUT (default
+ * runtime/tmp/benchmark.json, or benchmark_eval.json). If $BENCHMARK_BASELINE
+ * names such a file from an earlier run, a benchmark whose median got slower
+ * by more than $BENCHMARK_THRESHOLD (default 0.1, i.e. 10%) fails.
+ */
+class TestBenchmark : public TestCodeRun {
+ public:
+  TestBenchmark();
+
+  virtual bool preTest();
+  virtual bool postTest();
+  virtual bool RunTests(const std::string &which);
+
+  bool BenchArrays();
+  bool BenchArrayShapes();
+  bool BenchStrings();
+  bool BenchFunctionCalls();
+  bool BenchObjects();
+  bool BenchSerialization();
+  bool BenchAPC();
+  bool BenchPreg();
+  bool BenchHashes();
+  bool BenchEncoding();
+  bool BenchSessions();
+
+ private:
+  struct Benchmark {
+    std::string name;
+    std::string input;
+    std::string config; // extra -v setting, if any
+    int iterations;
+  };
+
+  struct Result {
+    std::string name;
+    int iterations;
+    int reps;
+    // nanoseconds per iteration
+    double min, median, p90, p99, mean, stddev;
+    // per iteration, averaged over warmup and timed runs; -1 if unavailable
+    double cycles, instructions, cacheMisses, branchMisses;
+    // memory_get_usage() growth across the setup code
+    double setupBytes;
+  };
+
+  std::deque<Benchmark> m_benchmarks; // RecordMulti() keeps input pointers
+  std::vector<Result> m_results;
+
+  bool addBenchmark(const char *name, const char *decls, const char *setup,
+                    const char *body, int iterations,
+                    const char *config = NULL);
+  bool runBenchmark(const Benchmark &bench, const char *subdir);
+  bool checkBaseline(const std::string &file, double threshold);
+  bool writeResults(const std::string &file);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // __TEST_BENCHMARK_H__
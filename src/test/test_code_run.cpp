@@ -204,7 +204,7 @@ static string escape(const std::string &s) {
 static bool verify_result(const char *input, const char *output, bool perfMode,
                           const char *file = "", int line = 0,
                           bool nowarnings = false, const char *subdir = "",
-                          bool fastMode = false) {
+                          bool fastMode = false, const char *config = NULL) {
   // generate main.php
   string fullPath = "runtime/tmp";
   if (subdir && subdir[0]) fullPath = fullPath + "/" + subdir;
@@ -236,11 +236,17 @@ static bool verify_result(const char *input, const char *output, bool perfMode,
         if (subdir) path = path + subdir + "/";
         path += "libtest.so";
         const char *argv[] = {"", "--file=string", "--config=test/config.hdf",
-                              path.c_str(), NULL};
+                              NULL, NULL, NULL, NULL};
+        int argc = 3;
+        if (config) {
+          argv[argc++] = "-v";
+          argv[argc++] = config;
+        }
+        argv[argc] = path.c_str();
         Process::Exec("runtime/tmp/run.sh", argv, NULL, actual, &err);
       } else {
         const char *argv[] = {"", "--file=string", "--config=test/config.hdf",
-                              NULL};
+                              config ? "-v" : NULL, config, NULL};
         string path = "runtime/tmp/";
         if (subdir) path = path + subdir + "/";
         path += "test";
@@ -254,7 +260,7 @@ static bool verify_result(const char *input, const char *output, bool perfMode,
                             "--config=test/config.hdf",
                             "-v Fiber.ThreadCount=5",
                             "-v Eval.EnableObjDestructCall=true",
-                            NULL};
+                            config ? "-v" : NULL, config, NULL};
       Process::Exec("hphpi/hphpi", argv, NULL, actual, &err);
     }
 
@@ -329,9 +335,10 @@ static bool verify_result(const char *input, const char *output, bool perfMode,
 }
 
 bool TestCodeRun::RecordMulti(const char *input, const char *output,
-                              const char *file, int line, bool flag) {
+                              const char *file, int line, bool flag,
+                              const char *config /* = NULL */) {
   size_t i = m_infos.size();
-  m_infos.push_back(VCRInfo(input, output, file, line, flag));
+  m_infos.push_back(VCRInfo(input, output, file, line, flag, config));
 
   if (Option::EnableEval < Option::FullEval) {
     ASSERT(m_infos[i].input);
@@ -356,7 +363,7 @@ bool TestCodeRun::MultiVerifyCodeRun() {
     if (!Count(verify_result(m_infos[i].input, m_infos[i].output, m_perfMode,
                              m_infos[i].file, m_infos[i].line,
                              m_infos[i].nowarnings, os.str().c_str(),
-                             FastMode))) {
+                             FastMode, m_infos[i].config))) {
       ret = false;
     }
   }
@@ -408,11 +415,13 @@ bool TestCodeRun::RunTests(const std::string &which) {
   RUN_TEST(TestArrayForEach);
   RUN_TEST(TestArrayAssignment);
   RUN_TEST(TestArrayFunctions);
+  RUN_TEST(TestPackedArray);
   RUN_TEST(TestScalarArray);
   RUN_TEST(TestRange);
   RUN_TEST(TestVariant);
   RUN_TEST(TestObject);
   RUN_TEST(TestObjectProperty);
+  RUN_TEST(TestObjectShapes);
   RUN_TEST(TestObjectMethod);
   RUN_TEST(TestClassMethod);
   RUN_TEST(TestObjectMagicMethod);
@@ -471,6 +480,7 @@ bool TestCodeRun::RunTests(const std::string &which) {
   RUN_TEST(TestCreateFunction);
   RUN_TEST(TestConstructorDestructor);
   RUN_TEST(TestConcat);
+  RUN_TEST(TestMemoryLimit);
   RUN_TEST(TestConstant);
   RUN_TEST(TestClassConstant);
   RUN_TEST(TestConstantFunction);
@@ -3338,6 +3348,65 @@ bool TestCodeRun::TestArrayFunctions() {
   return true;
 }
 
+bool TestCodeRun::TestPackedArray() {
+  // lists stay packed under HphpArray until a key breaks the 0..n-1 order
+  static const char *transitions =
+    "<?php\n"
+    "function dump($a) {\n"
+    "  var_dump($a);\n"
+    "  foreach ($a as $k => $v) echo \"$k=$v \";\n"
+    "  echo \"\\n\", json_encode($a), \"\\n\";\n"
+    "  var_dump(isset($a[0]), isset($a['x']), count($a));\n"
+    "}\n"
+    // string key insert
+    "$a = array(1, 2, 3);\n"
+    "$a['x'] = 4;\n"
+    "$a[] = 5;\n"
+    "dump($a);\n"
+    // out of order int key, then appends after it
+    "$b = array(1, 2, 3);\n"
+    "$b[10] = 4;\n"
+    "$b[] = 5;\n"
+    "$b[5] = 6;\n"
+    "dump($b);\n"
+    // unset in the middle, at the end, and of absent keys
+    "$c = range(0, 5);\n"
+    "unset($c[9]);\n"
+    "unset($c['x']);\n"
+    "dump($c);\n"
+    "unset($c[5]);\n"
+    "$c[] = 'end';\n"
+    "dump($c);\n"
+    "unset($c[2]);\n"
+    "$c[] = 'after gap';\n"
+    "dump($c);\n"
+    // copy-on-write of a packed array
+    "$d = range(0, 3);\n"
+    "$e = $d;\n"
+    "$e[] = 4;\n"
+    "$f = $d;\n"
+    "$f['x'] = 'y';\n"
+    "$g = $d;\n"
+    "unset($g[1]);\n"
+    "$h = $d;\n"
+    "unset($h[7]);\n"
+    "dump($d);\n"
+    "dump($e);\n"
+    "dump($f);\n"
+    "dump($g);\n"
+    "dump($h);\n"
+    // pop, shift and unshift
+    "$i = range(0, 4);\n"
+    "var_dump(array_pop($i), array_shift($i));\n"
+    "array_unshift($i, 'first');\n"
+    "$i[] = 'last';\n"
+    "dump($i);\n";
+
+  MVCR(transitions);
+  MVCRC(transitions, "Server.UseHphpArray=true");
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool TestCodeRun::TestVariant() {
@@ -4096,6 +4165,52 @@ bool TestCodeRun::TestObjectProperty() {
   return true;
 }
 
+bool TestCodeRun::TestObjectShapes() {
+  // dynamic properties, crossing from slots (the first 8) to o_properties
+  // (the rest, and names added back after an unset)
+  static const char *dynamics =
+    "<?php\n"
+    "class A { public $decl = 'd'; }\n"
+    "function dump($o) {\n"
+    "  var_dump($o);\n"
+    "  echo serialize($o), \"\\n\";\n"
+    "  foreach ($o as $k => $v) echo \"$k=$v\\n\";\n"
+    "}\n"
+    "$a = new A();\n"
+    "for ($i = 0; $i < 12; $i++) { $n = 'p' . $i; $a->$n = $i; }\n"
+    "unset($a->p3);\n"
+    "unset($a->p10);\n"
+    "var_dump(isset($a->p3), isset($a->p4), property_exists($a, 'p10'));\n"
+    "$a->p3 = 'back';\n"
+    "dump($a);\n"
+    "foreach ($a as $k => &$v) { $v = $k . '!'; }\n"
+    "unset($v);\n"
+    "dump($a);\n"
+    "$b = new A();\n"
+    "$b->x = 1;\n"
+    "$b->y = 2;\n"
+    "foreach ($b as &$v) { $v = $v . '0'; }\n"
+    "unset($v);\n"
+    "var_dump($b);\n"
+    "$c = unserialize(serialize($a));\n"
+    "var_dump($c == $a);\n"
+    "dump($c);\n"
+    "$d = clone $b;\n"
+    "$d->z = 3;\n"
+    "$d->x = 'changed';\n"
+    "var_dump($b, $d);\n"
+    "var_dump(get_object_vars($a));\n"
+    "var_dump((array)$b);\n"
+    "$e = new A();\n"
+    "$e->y = 1;\n"
+    "$e->x = 2;\n"
+    "var_dump($e);\n";
+
+  MVCR(dynamics);
+  MVCRC(dynamics, "Server.UseObjectShapes=true");
+  return true;
+}
+
 bool TestCodeRun::TestObjectMethod() {
   MVCR("<?php class A { function test() {}} "
       "$obj = new A(); $obj->test(); $obj = 1;");
@@ -12064,6 +12179,25 @@ bool TestCodeRun::TestConcat() {
   return true;
 }
 
+bool TestCodeRun::TestMemoryLimit() {
+#ifdef USE_JEMALLOC
+  // string buffers are malloc()ed, not smart allocated, and the loop makes
+  // no calls, so only the loop check can catch it
+  MVCRO("<?php\n"
+        "ini_set('memory_limit', 16 * 1024 * 1024);\n"
+        "$chunk = str_repeat('x', 1024);\n"
+        "$s = '';\n"
+        "echo \"start\\n\";\n"
+        "for ($i = 0; $i < 64 * 1024; $i++) {\n"
+        "  $s .= $chunk;\n"
+        "}\n"
+        "echo \"not reached\\n\";\n",
+
+        "start\n");
+#endif
+  return true;
+}
+
 bool TestCodeRun::TestConstant() {
   MVCR("<?php define('A', 'B'); define('A_'.A, 'B'); var_dump(A, A_B);");
 
@@ -24,14 +24,15 @@
 class VCRInfo {
 public:
   VCRInfo(const char *i, const char *o, const char *f = "", int l = 0,
-          bool nw = false)
-  : input(i), output(o), file(f), line(l), nowarnings(nw) { }
+          bool nw = false, const char *c = NULL)
+  : input(i), output(o), file(f), line(l), nowarnings(nw), config(c) { }
 
   const char *input;
   const char *output;
   const char *file;
   int line;
   bool nowarnings;
+  const char *config; // extra -v setting for the compiled program, if any
 };
 
 typedef std::vector<VCRInfo> VCRInfoVec;
@@ -76,11 +77,13 @@ class TestCodeRun : public TestBase {
   bool TestArrayForEach();
   bool TestArrayAssignment();
   bool TestArrayFunctions();
+  bool TestPackedArray();
   bool TestScalarArray();
   bool TestRange();
   bool TestVariant();
   bool TestObject();
   bool TestObjectProperty();
+  bool TestObjectShapes();
   bool TestObjectMethod();
   bool TestClassMethod();
   bool TestObjectMagicMethod();
@@ -129,6 +132,7 @@ class TestCodeRun : public TestBase {
   bool TestExit();
   bool TestConstructorDestructor();
   bool TestConcat();
+  bool TestMemoryLimit();
   bool TestConstant();
   bool TestClassConstant();
   bool TestConstantFunction();
@@ -197,7 +201,7 @@ class TestCodeRun : public TestBase {
   bool GenerateFiles(const char *input, const char *subdir = "");
   bool CompileFiles();
   bool RecordMulti(const char *input, const char *output, const char *file,
-                   int line, bool flag);
+                   int line, bool flag, const char *config = NULL);
 
   bool MultiVerifyCodeRun();
   bool VerifyCodeRun(const char *input, const char *output,
@@ -230,6 +234,10 @@ class TestCodeRun : public TestBase {
 #define MVCRNW(a)                                                       \
   if (!RecordMulti(a,NULL,__FILE__,__LINE__,true)) return false;
 
+// runs with a runtime option set, e.g. "Server.UseHphpArray=true"
+#define MVCRC(a, config)                                                \
+  if (!RecordMulti(a,NULL,__FILE__,__LINE__,false,config)) return false;
+
 ///////////////////////////////////////////////////////////////////////////////
 
 #endif // __TEST_CODE_RUN_H__
@@ -0,0 +1,228 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <test/test_compiler.h>
+#include <compiler/package.h>
+#include <compiler/incremental_cache.h>
+#include <compiler/compile_server.h>
+#include <compiler/builtin_symbols.h>
+#include <compiler/analysis/analysis_result.h>
+#include <compiler/option.h>
+#include <util/util.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+
+TestCompiler::TestCompiler() {
+  Option::IncludeRoots["$_SERVER['PHP_ROOT']"] = "";
+}
+
+bool TestCompiler::RunTests(const std::string &which) {
+  bool ret = true;
+  RUN_TEST(TestIncrementalCache);
+  RUN_TEST(TestCompileServer);
+  return ret;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void write_file(const string &path, const string &content) {
+  FILE *f = fopen(path.c_str(), "w");
+  fputs(content.c_str(), f);
+  fclose(f);
+}
+
+static bool up_to_date(const string &out, const string &key,
+                       const Package &package) {
+  IncrementalCache cache(out, key);
+  cache.load();
+  return cache.upToDate(package.getRoot(), package.getFilesToParse());
+}
+
+bool TestCompiler::TestIncrementalCache() {
+  string dir = "test/incremental_cache.tmp";
+  string src = dir + "/src/";
+  string out = dir + "/out";
+  boost::filesystem::remove_all(dir);
+  mkdir(dir.c_str(), 0777);
+  mkdir(src.c_str(), 0777);
+  mkdir(out.c_str(), 0777);
+  mkdir((out + "/php").c_str(), 0777);
+  write_file(src + "a.php",
+             "<?php include $_SERVER['PHP_ROOT'].'b.php'; echo f();");
+  write_file(src + "b.php", "<?php function f() { return 1; }");
+  write_file(out + "/php/a.cpp", "// a.php");
+
+  {
+    Package package(src.c_str());
+    AnalysisResultPtr ar = package.getAnalysisResult();
+    BuiltinSymbols::Load(ar);
+    ar->loadBuiltins();
+    ar->setPackage(&package);
+    ar->setParseOnDemand(true);
+    package.addSourceFile("a.php");
+
+    IncrementalCache cache(out, "key");
+    cache.load();
+    VERIFY(!cache.upToDate(package.getRoot(), package.getFilesToParse()));
+    VERIFY(cache.getChangedCount() == 1);
+    VERIFY(package.parse());
+    ar->analyzeProgram();
+    VERIFY(ar->findFileScope("b.php"));
+    cache.snapshot();
+    cache.update(ar, true);
+    VERIFY(cache.getOutputChanged() == 1);
+    VERIFY(cache.save());
+  }
+
+  Package package(src.c_str());
+  package.addSourceFile("a.php");
+  VERIFY(up_to_date(out, "key", package));
+  VERIFY(!up_to_date(out, "other key", package));
+
+  {
+    // b.php is only reached through a.php's include
+    IncrementalCache cache(out, "key");
+    cache.load();
+    cache.upToDate(package.getRoot(), package.getFilesToParse());
+    vector<string> prefetch;
+    cache.getPrefetch(prefetch);
+    VERIFY(prefetch.size() == 1 && prefetch[0] == "b.php");
+  }
+
+  write_file(src + "b.php", "<?php function f() { return 2; }");
+  {
+    IncrementalCache cache(out, "key");
+    cache.load();
+    VERIFY(!cache.upToDate(package.getRoot(), package.getFilesToParse()));
+    VERIFY(cache.getChangedCount() == 1);
+    VERIFY(cache.getAffectedCount() == 1);
+  }
+  write_file(src + "b.php", "<?php function f() { return 1; }");
+  VERIFY(up_to_date(out, "key", package));
+
+  // a generated file that was edited or rebuilt since
+  struct utimbuf times;
+  times.actime = times.modtime = time(NULL) - 3600;
+  VERIFY(utime((out + "/php/a.cpp").c_str(), &times) == 0);
+  VERIFY(!up_to_date(out, "key", package));
+
+  boost::filesystem::remove_all(dir);
+  return Count(true);
+}
+
+static string read_file(const string &path) {
+  string content;
+  FILE *f = fopen(path.c_str(), "r");
+  if (f) {
+    char buf[1024];
+    int n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+      content.append(buf, n);
+    }
+    fclose(f);
+  }
+  return content;
+}
+
+bool TestCompiler::TestCompileServer() {
+  {
+    // pieces a cluster file was split into count towards it
+    CompileServer::CostMap costs;
+    costs["php/x.cpp"] = 1.0;
+    costs["php/x-1.cpp"] = 2.0;
+    costs["php/x-2.cpp"] = 3.0;
+    costs["php/x-y.cpp"] = 100.0;
+    VERIFY(CompileServer::GetCost(costs, "php/x.cpp") == 6.0);
+    VERIFY(CompileServer::GetCost(costs, "php/z.cpp") == 0.0);
+  }
+
+  string dir = "test/compile_server.tmp";
+  string out = dir + "/out";
+  string cache = dir + "/cache";
+  string log = dir + "/compiled";
+  boost::filesystem::remove_all(dir);
+  Util::mkdir(out + "/sub/");
+  Util::mkdir(cache + "/");
+
+  // stands in for g++: "-E <source>" preprocesses, "-o <object> <source>"
+  // compiles, logging which source, and sources saying FAIL don't compile
+  write_file(dir + "/cc",
+             "if [ \"$1\" = -E ]; then cat \"$2\"; exit 0; fi\n"
+             "while [ \"$1\" != -o ]; do shift; done\n"
+             "if grep -q FAIL \"$3\"; then echo failed >&2; exit 1; fi\n"
+             "basename \"$3\" >> " + log + "\n"
+             "cp \"$3\" \"$2\"\n");
+  string cc = "sh " + dir + "/cc";
+
+  write_file(out + "/a.cpp", "// a.cpp\n");
+  write_file(out + "/b.cpp", "// b.cpp\n");
+  write_file(out + "/sub/c.cpp", string(1000, ' '));
+  // c.cpp was never compiled: estimated by size from what a and b took
+  write_file(cache + "/compile_costs", "1 a.cpp\n3 b.cpp\n");
+
+  {
+    CompileServer server(out, cc, cache, 1);
+    vector<string> objects;
+    VERIFY(server.compile(objects));
+    VERIFY(objects.size() == 3);
+    VERIFY(server.getCompiled() == 3);
+    VERIFY(server.getReused() == 0);
+    VERIFY(read_file(log) == "c.cpp\nb.cpp\na.cpp\n"); // longest first
+
+    VERIFY(server.link("echo $OBJECTS > " + dir + "/linked", objects));
+    string linked = read_file(dir + "/linked");
+    VERIFY(linked.find(out + "/a.o") != string::npos);
+    VERIFY(linked.find(out + "/sub/c.o") != string::npos);
+
+    CompileServer::CostMap costs;
+    CompileServer::LoadCosts(cache + "/compile_costs", costs);
+    VERIFY(costs.size() == 3);
+    VERIFY(costs.find("sub/c.cpp") != costs.end());
+  }
+
+  // nothing changed: every object comes from the cache
+  unlink(log.c_str());
+  unlink((out + "/b.o").c_str());
+  {
+    CompileServer server(out, cc, cache, 2);
+    vector<string> objects;
+    VERIFY(server.compile(objects));
+    VERIFY(server.getCompiled() == 0);
+    VERIFY(server.getReused() == 3);
+    VERIFY(read_file(log) == "");
+    VERIFY(read_file(out + "/b.o") == "// b.cpp\n");
+  }
+
+  // one file changed, and one that doesn't compile
+  write_file(out + "/a.cpp", "// a.cpp changed\n");
+  write_file(out + "/d.cpp", "FAIL\n");
+  {
+    CompileServer server(out, cc, cache, 2);
+    vector<string> objects;
+    VERIFY(!server.compile(objects));
+    VERIFY(server.getCompiled() == 1);
+    VERIFY(server.getReused() == 2);
+    VERIFY(read_file(log) == "a.cpp\n");
+  }
+
+  boost::filesystem::remove_all(dir);
+  return Count(true);
+}
+
@@ -26,6 +26,10 @@
 #include <runtime/base/shared/shared_store_base.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/server/ip_block_map.h>
+#include <runtime/base/util/stack_sampler.h>
+#include <runtime/base/frame_injection.h>
+#include <runtime/eval/runtime/code_coverage.h>
+#include <util/async_func.h>
 #include <test/test_mysql_info.inc>
 
 using namespace std;
@@ -49,6 +53,8 @@ bool TestCppBase::RunTests(const std::string &which) {
 #endif
   RUN_TEST(TestIpBlockMap);
   RUN_TEST(TestEqualAsStr);
+  RUN_TEST(TestStackSampler);
+  RUN_TEST(TestCodeCoverage);
   return ret;
 }
 
@@ -186,6 +192,35 @@ bool TestCppBase::TestString() {
     s = "\x50\x51"; s = ~s;              VS((const char *)s, "\xAF\xAE");
   }
 
+  // appends
+  {
+    String s(NEW(StringData)("ab", 2, CopyString));
+    VERIFY(s->isInline());
+    s += "cd";                     VS((const char *)s, "abcd");
+    VERIFY(s->isInline());
+    s += s;                        VS((const char *)s, "abcdabcd");
+    s += String(std::string(20, 'x'));
+    VERIFY(s->isMalloced());
+    VERIFY(s.size() == 28);
+    int cap = s->capacity();
+    VERIFY(cap >= 28);
+    while (s.size() < cap) s += "y";
+    VERIFY(s->capacity() == cap);
+    s += "z";
+    VERIFY(s->capacity() >= 2 * cap);
+    VERIFY(s.size() == cap + 1);
+    VERIFY(s.data()[cap] == 'z' && s.data()[cap + 1] == '\0');
+
+    String lit("literal");
+    lit += "!";                    VS((const char *)lit, "literal!");
+
+    StringBuffer sb;
+    sb.append("buffered");
+    String b = sb.detach();
+    VERIFY(b->capacity() > 8);
+    b += " string";                VS((const char *)b, "buffered string");
+  }
+
   // manipulations
   {
     String s = StringUtil::ToLower("Test");
@@ -1025,3 +1060,90 @@ bool TestCppBase::TestEqualAsStr() {
   }
   return Count(true);
 }
+
+bool TestCppBase::TestStackSampler() {
+  StackSampler::Clear();
+  VERIFY(StackSampler::Start(1000));
+  {
+    ThreadInfo *info;
+    FrameInjection outer(info, empty_string, "sampler_outer", true);
+    FrameInjection inner(info, empty_string, "sampler_inner", true);
+    // burn CPU time, which is what the profiling timer counts
+    volatile int64 sink = 0;
+    clock_t end = clock() + CLOCKS_PER_SEC / 5;
+    while (clock() < end) {
+      for (int i = 0; i < 10000; i++) sink += i;
+    }
+  }
+  StackSampler::Stop();
+  VERIFY(!StackSampler::IsRunning());
+
+  string out;
+  StackSampler::Report(out);
+  VERIFY(!out.empty());
+  VERIFY(out.find("sampler_outer;sampler_inner ") != string::npos);
+  StackSampler::Clear();
+  StackSampler::Report(out);
+  VS(String(out), "");
+  return Count(true);
+}
+
+class CoverageRecorder {
+public:
+  CoverageRecorder() : m_count(1000) {}
+  void run() {
+    for (int i = 0; i < m_count; i++) {
+      Eval::CodeCoverage::Record("coverage_a.php", 1, 3);
+      Eval::CodeCoverage::Record("coverage_b.php", 5, 5);
+    }
+  }
+  int m_count;
+};
+
+static void record_coverage(int threads) {
+  CoverageRecorder recorder;
+  std::vector<AsyncFunc<CoverageRecorder>*> funcs;
+  for (int i = 0; i < threads; i++) {
+    funcs.push_back(new AsyncFunc<CoverageRecorder>(&recorder,
+                                                    &CoverageRecorder::run));
+    funcs.back()->start();
+  }
+  recorder.run(); // and the calling thread, whose shard outlives Reset()
+  for (int i = 0; i < threads; i++) {
+    funcs[i]->waitForEnd();
+    delete funcs[i];
+  }
+}
+
+bool TestCppBase::TestCodeCoverage() {
+  Eval::CodeCoverage::Reset();
+  record_coverage(4);
+  {
+    Array report = Eval::CodeCoverage::Report();
+    VS(report.size(), 2);
+    Array a = report[String("coverage_a.php")];
+    VS(a.size(), 3);
+    VS(a[1], 5000);
+    VS(a[2], 5000);
+    VS(a[3], 5000);
+    Array b = report[String("coverage_b.php")];
+    VS(b.size(), 1);
+    VS(b[5], 5000);
+  }
+
+  Eval::CodeCoverage::Reset();
+  VS(Eval::CodeCoverage::Report().size(), 0);
+
+  record_coverage(2);
+  {
+    Array report = Eval::CodeCoverage::Report();
+    VS(report.size(), 2);
+    Array a = report[String("coverage_a.php")];
+    VS(a[1], 3000);
+    VS(a[3], 3000);
+    Array b = report[String("coverage_b.php")];
+    VS(b[5], 3000);
+  }
+  Eval::CodeCoverage::Reset();
+  return Count(true);
+}
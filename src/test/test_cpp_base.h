@@ -62,6 +62,12 @@ class TestCppBase : public TestBase {
 
   // EqualAsStr functions
   bool TestEqualAsStr();
+
+  // sampling profiler
+  bool TestStackSampler();
+
+  // line hits counted per thread
+  bool TestCodeCoverage();
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -89,6 +89,7 @@ bool TestExtCurl::RunTests(const std::string &which) {
   RUN_TEST(test_curl_multi_remove_handle);
   RUN_TEST(test_curl_multi_exec);
   RUN_TEST(test_curl_multi_select);
+  RUN_TEST(test_curl_multi_await);
   RUN_TEST(test_curl_multi_getcontent);
   RUN_TEST(test_curl_multi_info_read);
   RUN_TEST(test_curl_multi_close);
@@ -258,6 +259,46 @@ bool TestExtCurl::test_curl_multi_select() {
   return Count(true);
 }
 
+bool TestExtCurl::test_curl_multi_await() {
+  Object mh = f_curl_multi_init();
+  Variant c1 = f_curl_init(String(get_request_uri()));
+  Variant c2 = f_curl_init(String(get_request_uri()));
+  f_curl_setopt(c1, k_CURLOPT_RETURNTRANSFER, true);
+  f_curl_setopt(c2, k_CURLOPT_RETURNTRANSFER, true);
+  f_curl_multi_add_handle(mh, c1);
+  f_curl_multi_add_handle(mh, c2);
+
+  int done = 0;
+  while (done < 2) {
+    int ready = f_curl_multi_await(mh, 5.0).toInt32();
+    VERIFY(ready > 0);
+    for (int i = 0; i < ready; i++) {
+      Variant info = f_curl_multi_info_read(mh);
+      VS(info["msg"], k_CURLMSG_DONE);
+      VS(info["result"], 0);
+      done++;
+    }
+  }
+  VS(f_curl_multi_info_read(mh), false);
+  VS(f_curl_multi_await(mh, 0.1), 0);
+  VS(f_curl_multi_getcontent(c1), "OK");
+  VS(f_curl_multi_getcontent(c2), "OK");
+
+  // sockets opened by curl_multi_exec() before the first await
+  mh = f_curl_multi_init();
+  Variant c3 = f_curl_init(String(get_request_uri()));
+  f_curl_setopt(c3, k_CURLOPT_RETURNTRANSFER, true);
+  f_curl_multi_add_handle(mh, c3);
+  Variant still_running;
+  f_curl_multi_exec(mh, ref(still_running));
+  time_t start = time(NULL);
+  VS(f_curl_multi_await(mh, 5.0), 1);
+  VERIFY(time(NULL) - start < 4);
+  VS(f_curl_multi_info_read(mh)["result"], 0);
+  VS(f_curl_multi_getcontent(c3), "OK");
+  return Count(true);
+}
+
 bool TestExtCurl::test_curl_multi_getcontent() {
   Object mh = f_curl_multi_init();
   Variant c1 = f_curl_init(String(get_request_uri()));
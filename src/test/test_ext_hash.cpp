@@ -123,6 +123,24 @@ bool TestExtHash::test_hash() {
   VS(f_hash("haval224,5", data), expected[i++]);
   VS(f_hash("haval256,5", data), expected[i++]);
 
+  // long enough for the SHA and carry-less multiply kernels, and fed to
+  // them in pieces that don't line up with their blocks
+  String longData;
+  for (int j = 0; j < 100; j++) longData += data;
+  VS(f_hash("sha1", longData), "0c9e8ed538fc0addaebd6a43f38c35f0ca455460");
+  VS(f_hash("sha256", longData),
+     "bc0dc063a5e2ac9f614394f3377e63aeb9f9457d09f8247913ab50ebfd26f94c");
+  VS(f_hash("crc32",  longData), "2f351d96");
+  VS(f_hash("crc32b", longData), "46c8997c");
+  const char *algos[] = {"sha1", "sha256", "crc32", "crc32b"};
+  for (int j = 0; j < 4; j++) {
+    Object ctx = f_hash_init(algos[j]);
+    f_hash_update(ctx, longData.substr(0, 1001));
+    f_hash_update(ctx, longData.substr(1001, 30));
+    f_hash_update(ctx, longData.substr(1031));
+    VS(f_hash_final(ctx), f_hash(algos[j], longData));
+  }
+
   return Count(true);
 }
 
@@ -50,6 +50,8 @@ bool TestExtMysql::RunTests(const std::string &which) {
   RUN_TEST(test_mysql_set_timeout);
   RUN_TEST(test_mysql_query);
   RUN_TEST(test_mysql_unbuffered_query);
+  RUN_TEST(test_mysql_async_query);
+  RUN_TEST(test_mysql_async_wait);
   RUN_TEST(test_mysql_db_query);
   RUN_TEST(test_mysql_list_dbs);
   RUN_TEST(test_mysql_list_tables);
@@ -303,6 +305,58 @@ bool TestExtMysql::test_mysql_unbuffered_query() {
   return Count(true);
 }
 
+bool TestExtMysql::test_mysql_async_query() {
+  Variant conn = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD);
+  VERIFY(CreateTestTable());
+  VS(f_mysql_async_query("insert into test (name) values ('test')"), true);
+
+  // a plain query on the same connection discards the pending result
+  Variant res = f_mysql_query("select count(*) from test");
+  VS(f_mysql_result(res, 0), "1");
+  VS(f_mysql_async_wait(CREATE_VECTOR1(conn)), Array::Create());
+
+  // so does any other call that talks to the server
+  VS(f_mysql_async_query("select name from test"), true);
+  VS(f_mysql_ping(), true);
+  VS(f_mysql_async_query("select name from test"), true);
+  VERIFY(f_mysql_select_db(TEST_DATABASE));
+  VS(f_mysql_async_query("select name from test"), true);
+  VS(f_mysql_real_escape_string("a'b"), "a\\'b");
+  VS(f_mysql_async_wait(CREATE_VECTOR1(conn)), Array::Create());
+  VS(f_mysql_errno(), 0);
+  return Count(true);
+}
+
+bool TestExtMysql::test_mysql_async_wait() {
+  Variant conn1 = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD);
+  VERIFY(CreateTestTable());
+  VS(f_mysql_query("insert into test (name) values ('test'),('test2')"), true);
+  Variant conn2 = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD,
+                                  true);
+  VERIFY(f_mysql_select_db(TEST_DATABASE, conn2));
+
+  VS(f_mysql_async_query("select name from test where id = 1", conn1), true);
+  VS(f_mysql_async_query("select name from test where id = 2", conn2), true);
+
+  Array links = CREATE_MAP2("a", conn1, "b", conn2);
+  Array results;
+  while (results.size() < 2) {
+    Variant done = f_mysql_async_wait(links, 5.0);
+    VERIFY(done.isArray() && done.toArray().size() > 0);
+    results.merge(done.toArray());
+  }
+  VS(f_mysql_result(results["a"], 0), "test");
+  VS(f_mysql_result(results["b"], 0), "test2");
+
+  // a slow query times out without blocking and stays pending
+  VS(f_mysql_async_query("select sleep(1)", conn1), true);
+  VS(f_mysql_async_wait(links, 0.1), Array::Create());
+  Variant done = f_mysql_async_wait(links, 5.0);
+  VERIFY(done.isArray() && done.toArray().exists("a"));
+  VS(f_mysql_result(done["a"], 0), "0");
+  return Count(true);
+}
+
 bool TestExtMysql::test_mysql_db_query() {
   try {
     f_mysql_db_query("", "");
@@ -52,6 +52,8 @@ class TestExtMysql : public TestCppExt {
   bool test_mysql_set_timeout();
   bool test_mysql_query();
   bool test_mysql_unbuffered_query();
+  bool test_mysql_async_query();
+  bool test_mysql_async_wait();
   bool test_mysql_db_query();
   bool test_mysql_list_dbs();
   bool test_mysql_list_tables();
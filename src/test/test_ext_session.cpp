@@ -16,6 +16,8 @@
 
 #include <test/test_ext_session.h>
 #include <runtime/ext/ext_session.h>
+#include <runtime/ext/ext_options.h>
+#include <system/gen/sys/system_globals.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -71,6 +73,28 @@ bool TestExtSession::test_session_name() {
 }
 
 bool TestExtSession::test_session_module_name() {
+  SystemGlobals *g = (SystemGlobals*)get_global_variables();
+  g->GV(_SESSION) = CREATE_MAP1("a", 1);
+
+  VS(f_session_module_name("memory"), "files");
+  VS(f_session_module_name(), "memory");
+  VS(f_session_encode(), String("\x01a" "i:1;", 6, AttachLiteral));
+  VS(f_session_module_name("files"), "memory");
+  VS(f_session_module_name(), "files");
+  VS(f_session_encode(), "a|i:1;");
+
+  // an explicit serialize_handler sticks across save handlers
+  f_ini_set("session.serialize_handler", "php");
+  f_session_module_name("memory");
+  VS(f_session_encode(), "a|i:1;");
+  f_session_module_name("files");
+  f_ini_set("session.serialize_handler", "php_binary");
+  f_session_module_name("memory");
+  f_session_module_name("files");
+  VS(f_session_encode(), String("\x01a" "i:1;", 6, AttachLiteral));
+  f_ini_set("session.serialize_handler", "php");
+
+  g->GV(_SESSION) = Array::Create();
   return Count(true);
 }
 
@@ -109,6 +133,46 @@ bool TestExtSession::test_session_decode() {
 bool TestExtSession::test_session_start() {
   f_session_start();
   f_session_destroy();
+
+  f_session_module_name("memory");
+  f_session_start();
+  f_session_destroy();
+
+  // $_SESSION round trip
+  SystemGlobals *g = (SystemGlobals*)get_global_variables();
+  f_session_id("memorytest");
+  f_session_start();
+  VS(g->GV(_SESSION), Array::Create());
+  g->GV(_SESSION).set("a", 1);
+  g->GV(_SESSION).set("b", CREATE_VECTOR2("x", "y"));
+  f_session_write_close();
+  g->GV(_SESSION) = Array::Create();
+  f_session_start();
+  VS(g->GV(_SESSION), CREATE_MAP2("a", 1, "b", CREATE_VECTOR2("x", "y")));
+  f_session_write_close();
+
+  // An unchanged session is not written back, so its timestamp stays put:
+  // once gc_maxlifetime drops below its age it has expired, whereas one
+  // that was changed (and written) at the same time has not.
+  sleep(2);
+  f_session_start();
+  f_session_write_close();
+  f_session_id("memorytest2");
+  f_session_start();
+  g->GV(_SESSION).set("c", 3);
+  f_session_write_close();
+  f_ini_set("session.gc_maxlifetime", "1");
+  f_session_id("memorytest");
+  f_session_start();
+  VS(g->GV(_SESSION), Array::Create());
+  f_session_write_close();
+  f_session_id("memorytest2");
+  f_session_start();
+  VS(g->GV(_SESSION), CREATE_MAP1("c", 3));
+  f_session_destroy();
+  f_ini_set("session.gc_maxlifetime", "1440");
+
+  f_session_module_name("files");
   return Count(true);
 }
 
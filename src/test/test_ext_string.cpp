@@ -131,6 +131,8 @@ bool TestExtString::test_stripcslashes() {
 
 bool TestExtString::test_addslashes() {
   VS(f_addslashes("'\"\\\n"), "\\'\\\"\\\\\n");
+  VS(f_addslashes("a long run of plain text, then 'quotes'"),
+     "a long run of plain text, then \\'quotes\\'");
   return Count(true);
 }
 
@@ -141,6 +143,8 @@ bool TestExtString::test_stripslashes() {
 
 bool TestExtString::test_bin2hex() {
   VS(f_bin2hex("ABC\n"), "4142430a");
+  VS(f_bin2hex("0123456789ABCDEF\xff\x80\x01"),
+     "30313233343536373839414243444546ff8001");
   return Count(true);
 }
 
@@ -167,11 +171,17 @@ bool TestExtString::test_strrev() {
 
 bool TestExtString::test_strtolower() {
   VS(f_strtolower("ABC"), "abc");
+  VS(f_strtolower("already lower case text, 0-9"),
+     "already lower case text, 0-9");
+  VS(f_strtolower("Mixed Case Text Longer Than A Vector"),
+     "mixed case text longer than a vector");
   return Count(true);
 }
 
 bool TestExtString::test_strtoupper() {
   VS(f_strtoupper("abc"), "ABC");
+  VS(f_strtoupper("mixed case text longer than a vector"),
+     "MIXED CASE TEXT LONGER THAN A VECTOR");
   return Count(true);
 }
 
@@ -196,6 +206,8 @@ bool TestExtString::test_strip_tags() {
 
 bool TestExtString::test_trim() {
   VS(f_trim(" abc "), "abc");
+  VS(f_trim("abc"), "abc");
+  VS(f_trim(" \t\n"), "");
   return Count(true);
 }
 
@@ -384,6 +396,11 @@ bool TestExtString::test_str_ireplace() {
      "<body text='black'>");
   VS(f_str_ireplace("%body%", "Black", "<body Text='%BODY%'>"),
      "<body Text='Black'>");
+  VS(f_str_ireplace("WORLD", "There",
+                    "Hello World, hello world, HELLO WORLD"),
+     "Hello There, hello There, HELLO There");
+  VS(f_str_ireplace("needle", "x", "no match anywhere in this haystack"),
+     "no match anywhere in this haystack");
   return Count(true);
 }
 
@@ -493,6 +510,12 @@ bool TestExtString::test_htmlspecialchars() {
   VS(f_bin2hex(f_htmlspecialchars("\xc2\xA0", k_ENT_COMPAT, "")), "c2a0");
   VS(f_bin2hex(f_htmlspecialchars("\xc2\xA0", k_ENT_COMPAT, "UTF-8")), "c2a0");
 
+  // long enough to go through the vectorized scanner
+  VS(f_htmlspecialchars("0123456789abcdef0123456789<abcdef\"0123456789'"),
+     "0123456789abcdef0123456789&lt;abcdef&quot;0123456789'");
+  String clean("nothing to escape in this one, at all");
+  VERIFY(f_htmlspecialchars(clean).get() == clean.get());
+
   return Count(true);
 }
 
@@ -524,6 +547,8 @@ bool TestExtString::test_str_rot13() {
 
 bool TestExtString::test_crc32() {
   VS(f_crc32("The quick brown fox jumped over the lazy dog."), 2191738434LL);
+  VS(f_crc32(f_str_repeat("The quick brown fox jumped over the lazy dog.",
+                          100)), 2090453062LL);
   return Count(true);
 }
 
@@ -539,12 +564,19 @@ bool TestExtString::test_md5() {
 
 bool TestExtString::test_sha1() {
   VS(f_sha1("apple"), "d0be2dc421be4fcd0172e5afceea3970e2f3d940");
+  VS(f_sha1(f_str_repeat("The quick brown fox jumped over the lazy dog.",
+                         100)), "0c9e8ed538fc0addaebd6a43f38c35f0ca455460");
   return Count(true);
 }
 
 bool TestExtString::test_strtr() {
   Array trans = CREATE_MAP2("hello", "hi", "hi", "hello");
   VS(f_strtr("hi all, I said hello", trans), "hello all, I said hi");
+  VS(f_strtr("nothing to translate in here", trans),
+     "nothing to translate in here");
+  VS(f_strtr("a long enough prefix before the last word: hi", trans),
+     "a long enough prefix before the last word: hello");
+  VS(f_strtr("Hello World", "lo", "LO"), "HeLLO WOrLd");
   return Count(true);
 }
 
@@ -737,6 +769,8 @@ bool TestExtString::test_strpos() {
 
 bool TestExtString::test_stripos() {
   VS(f_stripos("abcdef abcdef", "A", 1), 7);
+  VS(f_stripos("a haystack longer than one vector NeedLe", "nEEdle"), 34);
+  VS(f_stripos("a haystack longer than one vector", "needle"), false);
   return Count(true);
 }
 
@@ -45,6 +45,17 @@ bool TestExtUrl::test_base64_decode() {
               String("\006\0\030v9", 5, AttachLiteral)));
   VERIFY(!same(f_base64_decode("dGVzdA=="),
                f_base64_decode("dGVzdA==CORRUPT")));
+
+  // long enough for the vectorized path, with and without stray characters
+  String plain;
+  for (int i = 0; i < 300; i++) plain += String::FromChar((char)(i * 7));
+  String encoded = f_base64_encode(plain);
+  VERIFY(same(f_base64_decode(encoded), plain));
+  VERIFY(same(f_base64_decode(encoded, true), plain));
+  String spaced = encoded.substr(0, 40) + "\n" + encoded.substr(40);
+  VERIFY(same(f_base64_decode(spaced), plain));
+  VERIFY(same(f_base64_decode(spaced, true), plain));
+  VS(f_base64_decode("VGhpcyBpcyBhbiBlbmNvZGVk*HN0cmluZw==", true), false);
   return Count(true);
 }
 
@@ -52,6 +63,8 @@ bool TestExtUrl::test_base64_encode() {
   VS(f_base64_encode("This is an encoded string"),
      "VGhpcyBpcyBhbiBlbmNvZGVkIHN0cmluZw==");
   VS(f_base64_encode(String("\006\0\030v9", 5, AttachLiteral)), "BgAYdjk=");
+  VS(f_base64_encode("The quick brown fox jumps over the lazy dog"),
+     "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==");
   return Count(true);
 }
 
@@ -156,6 +169,8 @@ bool TestExtUrl::test_rawurldecode() {
 
 bool TestExtUrl::test_rawurlencode() {
   VS(f_rawurlencode("foo bar@baz"), "foo%20bar%40baz");
+  VS(f_rawurlencode("name=John Smith&email=john.smith+x@example.com~"),
+     "name%3DJohn%20Smith%26email%3Djohn.smith%2Bx%40example.com~");
   return Count(true);
 }
 
@@ -166,5 +181,9 @@ bool TestExtUrl::test_urldecode() {
 
 bool TestExtUrl::test_urlencode() {
   VS(f_urlencode("foo bar@baz"), "foo+bar%40baz");
+  VS(f_urlencode("name=John Smith&email=john.smith+x@example.com~"),
+     "name%3DJohn+Smith%26email%3Djohn.smith%2Bx%40example.com%7E");
+  VS(f_urlencode("abcdefghijklmnopqrstuvwxyz-_.0123456789"),
+     "abcdefghijklmnopqrstuvwxyz-_.0123456789");
   return Count(true);
 }
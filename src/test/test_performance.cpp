@@ -48,6 +48,7 @@ TestPerformance::TestPerformance() {
 bool TestPerformance::RunTests(const std::string &which) {
   bool ret = true;
   RUN_TEST(TestBasicOperations);
+  RUN_TEST(TestFunctionCalls);
   RUN_TEST(TestMemoryUsage);
   RUN_TEST(TestAdHocFile);
   RUN_TEST(TestAdHoc);
@@ -139,6 +140,45 @@ bool TestPerformance::TestBasicOperations() {
   return true;
 }
 
+bool TestPerformance::TestFunctionCalls() {
+  // dominated by frame injection cost of very small functions
+  VCR(PERF_START
+      "function leaf($a) { return $a + 1;}\n"
+      "for ($i = 0; $i < 1000000; $i++) { leaf($i);}"
+      "\n\n/* Calling a leaf function */"
+      PERF_END);
+
+  VCR(PERF_START
+      "function f3($a) { return $a;}\n"
+      "function f2($a) { return f3($a);}\n"
+      "function f1($a) { return f2($a);}\n"
+      "for ($i = 0; $i < 1000000; $i++) { f1($i);}"
+      "\n\n/* Calling a chain of small functions */"
+      PERF_END);
+
+  VCR(PERF_START
+      "class A { public $v = 1; function get() { return $this->v;}\n"
+      "  static function sget($a) { return $a;}}\n"
+      "$obj = new A();\n"
+      "for ($i = 0; $i < 1000000; $i++) { $obj->get(); A::sget($i);}"
+      "\n\n/* Calling small methods */"
+      PERF_END);
+
+  VCR(PERF_START
+      "$s = 'test';\n"
+      "for ($i = 0; $i < 1000000; $i++) { strlen($s); abs($i);}"
+      "\n\n/* Calling builtin functions */"
+      PERF_END);
+
+  VCR(PERF_START
+      "function fib($n) { return $n < 2 ? $n : fib($n - 1) + fib($n - 2);}\n"
+      "fib(25);"
+      "\n\n/* Recursive calls */"
+      PERF_END);
+
+  return true;
+}
+
 bool TestPerformance::TestMemoryUsage() {
   VCR(PERF_START
       "$a = array();\n"
@@ -28,6 +28,7 @@
 #include <runtime/base/server/http_request_handler.h>
 #include <runtime/base/util/http_client.h>
 #include <runtime/base/runtime_option.h>
+#include <runtime/base/util/string_buffer.h>
 
 using namespace std;
 using namespace boost;
@@ -177,6 +178,8 @@ bool TestServer::RunTests(const std::string &which) {
   RUN_TEST(TestResponseHeader);
   RUN_TEST(TestSetCookie);
   //RUN_TEST(TestRequestHandling);
+  RUN_TEST(TestEarlyFlush);
+  RUN_TEST(TestSendBuffer);
   RUN_TEST(TestHttpClient);
   RUN_TEST(TestRPCServer);
   RUN_TEST(TestXboxServer);
@@ -398,6 +401,187 @@ bool TestServer::TestRequestHandling() {
   return Count(true);
 }
 
+/**
+ * Records each send that reaches it, and whether it came as a buffer it got
+ * to keep (sendBufferImpl) or as a copy (sendImpl). Kept blocks are freed
+ * when the transport goes away, so a buffer that frees them again, or keeps
+ * writing into them, shows up as a double free or a changed record.
+ */
+class RecordingTransport : public Transport {
+public:
+  struct Send {
+    std::string data;
+    bool chunked;
+    bool adopted;
+  };
+
+  RecordingTransport(const char *acceptEncoding = "")
+    : m_acceptEncoding(acceptEncoding) {}
+
+  ~RecordingTransport() {
+    for (unsigned int i = 0; i < m_blocks.size(); i++) {
+      free(m_blocks[i]);
+    }
+  }
+
+  std::string m_acceptEncoding;
+  std::vector<Send> m_sends;
+  std::vector<char *> m_blocks;
+
+  virtual const char *getUrl() { return "/string";}
+  virtual const char *getRemoteHost() { return "remote";}
+  virtual const void *getPostData(int &size) { size = 0; return NULL;}
+  virtual Method getMethod() { return Transport::GET;}
+  virtual std::string getHeader(const char *name) {
+    return strcasecmp(name, "Accept-Encoding") ? "" : m_acceptEncoding;
+  }
+  virtual void getHeaders(HeaderMap &headers) {}
+  virtual void addHeaderImpl(const char *name, const char *value) {}
+  virtual void removeHeaderImpl(const char *name) {}
+
+  virtual void sendImpl(const void *data, int size, int code, bool chunked) {
+    record((const char *)data, size, chunked, false);
+  }
+
+  virtual void sendBufferImpl(StringBuffer &buf, int code, bool chunked) {
+    int size;
+    char *data = buf.detach(size);
+    m_blocks.push_back(data);
+    record(data, size, chunked, true);
+  }
+
+  bool owns(const char *p) const {
+    for (unsigned int i = 0; i < m_blocks.size(); i++) {
+      if (m_blocks[i] == p) return true;
+    }
+    return false;
+  }
+
+private:
+  void record(const char *data, int size, bool chunked, bool adopted) {
+    Send send;
+    send.data.assign(data, size);
+    send.chunked = chunked;
+    send.adopted = adopted;
+    m_sends.push_back(send);
+  }
+};
+
+bool TestServer::TestEarlyFlush() {
+  bool earlyFlush = RuntimeOption::EnableEarlyFlush;
+  RuntimeOption::EnableEarlyFlush = true;
+  RecordingTransport transport;
+  g_context->setTransport(&transport);
+  g_context->obStart();
+  g_context->obProtect(true);
+
+  // by size
+  g_context->obSetStreaming(16, false);
+  echo("0123456789");
+  VS((int)transport.m_sends.size(), 0);
+  echo("0123456789");
+  VS((int)transport.m_sends.size(), 1);
+  VS(String(transport.m_sends[0].data), "01234567890123456789");
+  VERIFY(transport.m_sends[0].chunked);
+  VS(g_context->obGetContentLength(), 0);
+
+  // nothing goes out while a user output buffer collects the page
+  g_context->obStart();
+  echo("0123456789abcdefghijklmnopqrstuvwxyz");
+  VS((int)transport.m_sends.size(), 1);
+  g_context->obFlush(); // into the page buffer, but not through write()
+  g_context->obEnd();
+  VS((int)transport.m_sends.size(), 1);
+  g_context->obStart();
+  echo("0123456789abcdefghijklmnopqrstuvwxyz");
+  g_context->obClean();
+  g_context->obEnd();
+  VS((int)transport.m_sends.size(), 1);
+  echo("!");
+  VS((int)transport.m_sends.size(), 2);
+  VS(String(transport.m_sends[1].data),
+     "0123456789abcdefghijklmnopqrstuvwxyz!");
+
+  // after </head>, once, even when the tag is split across writes
+  g_context->obSetStreaming(0, true);
+  echo("<html><he");
+  echo("ad><title>t</title></he");
+  VS((int)transport.m_sends.size(), 2);
+  echo("AD><body>");
+  VS((int)transport.m_sends.size(), 3);
+  VS(String(transport.m_sends[2].data),
+     "<html><head><title>t</title></heAD><body>");
+  echo("</head></head>");
+  VS((int)transport.m_sends.size(), 3);
+  VS(g_context->obGetContentLength(), 14);
+
+  g_context->obSetStreaming(0, false);
+  g_context->obProtect(false);
+  g_context->obClean();
+  g_context->obEnd();
+  g_context->setTransport(NULL);
+  RuntimeOption::EnableEarlyFlush = earlyFlush;
+  return Count(true);
+}
+
+bool TestServer::TestSendBuffer() {
+  // whole response: the transport keeps the block, buf starts over
+  {
+    RecordingTransport transport;
+    StringBuffer buf;
+    buf.append("hello");
+    transport.sendBuffer(buf);
+    VS((int)transport.m_sends.size(), 1);
+    VERIFY(transport.m_sends[0].adopted);
+    VERIFY(!transport.m_sends[0].chunked);
+    VS(String(transport.m_sends[0].data), "hello");
+    VERIFY(buf.empty());
+    buf.append("again");
+    VERIFY(!transport.owns(buf.data()));
+    VS(String(transport.m_blocks[0], 5, AttachLiteral), "hello");
+  }
+
+  // chunks: each one is handed over on its own
+  {
+    RecordingTransport transport;
+    StringBuffer buf;
+    buf.append("one");
+    transport.sendBuffer(buf, 200, true);
+    buf.append("two");
+    transport.sendBuffer(buf, 200, true);
+    transport.sendBuffer(buf, 200, true); // empty, not sent
+    VS((int)transport.m_sends.size(), 2);
+    VERIFY(transport.m_sends[0].adopted && transport.m_sends[0].chunked);
+    VERIFY(transport.m_sends[1].adopted && transport.m_sends[1].chunked);
+    VS(String(transport.m_sends[1].data), "two");
+    VERIFY(transport.m_blocks[0] != transport.m_blocks[1]);
+    VS(String(transport.m_blocks[0], 3, AttachLiteral), "one");
+  }
+
+  // compressed bodies are new data, so the buffer is copied and kept
+  {
+    RecordingTransport transport("gzip, deflate");
+    StringBuffer buf;
+    for (int i = 0; i < 200; i++) buf.append("compress me ");
+    transport.sendBuffer(buf);
+    VS((int)transport.m_sends.size(), 1);
+    VERIFY(!transport.m_sends[0].adopted);
+    VERIFY(transport.m_sends[0].data.size() < 2400);
+    VS(String(transport.m_sends[0].data.substr(0, 2)), "\x1f\x8b");
+    VERIFY(buf.empty());
+    VERIFY(transport.m_blocks.empty());
+  }
+
+  // and through libevent, whole and chunked
+  string page;
+  for (int i = 0; i < 10000; i++) page += "0123456789";
+  VSR("<?php echo str_repeat('0123456789', 10000);", page.c_str());
+  VSR("<?php echo str_repeat('0123456789', 5000); flush();"
+      "echo str_repeat('0123456789', 5000); flush(); echo 'end';",
+      (page + "end").c_str());
+  return true;
+}
+
 class TestRequestHandler : public RequestHandler {
 public:
   // implementing RequestHandler
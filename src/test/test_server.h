@@ -48,6 +48,10 @@ public:
   bool TestRequestHandling();
   bool TestLibeventServer();
 
+  // test streaming output to the transport
+  bool TestEarlyFlush();
+  bool TestSendBuffer();
+
   // test HttpClient class that proxy server uses
   bool TestHttpClient();
 
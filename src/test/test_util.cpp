@@ -17,6 +17,10 @@
 #include <test/test_util.h>
 #include <util/logger.h>
 #include <util/lfu_table.h>
+#include <util/network.h>
+#include <util/async_log_writer.h>
+#include <util/stack_trace.h>
+#include <arpa/inet.h>
 #include <runtime/base/complex_types.h>
 #include <runtime/base/shared/shared_string.h>
 #include <runtime/base/zend/zend_string.h>
@@ -44,6 +48,9 @@ bool TestUtil::RunTests(const std::string &which) {
   RUN_TEST(TestSharedString);
   RUN_TEST(TestCanonicalize);
   RUN_TEST(TestHDF);
+  RUN_TEST(TestDnsCache);
+  RUN_TEST(TestAsyncLogWriter);
+  RUN_TEST(TestStackTrace);
   return ret;
 }
 
@@ -268,3 +275,241 @@ bool TestUtil::TestHDF() {
   node = doc["Node"];
   return Count(true);
 }
+
+static int s_fakeLookups;
+static int s_fakeTTL;
+
+/**
+ * Knows every name except "*.bad", and always answers 10.0.0.1.
+ */
+static bool fake_resolver(const char *host, Util::DnsCache::Answer &answer) {
+  s_fakeLookups++;
+  string name(host);
+  if (name.size() > 4 && name.substr(name.size() - 4) == ".bad") {
+    answer.herr = HOST_NOT_FOUND;
+    return false;
+  }
+  struct in_addr in;
+  inet_aton("10.0.0.1", &in);
+  answer.addrtype = AF_INET;
+  answer.length = sizeof(in.s_addr);
+  answer.name = host;
+  answer.addrs.push_back(string((const char *)&in.s_addr, sizeof(in.s_addr)));
+  answer.ttl = s_fakeTTL;
+  return true;
+}
+
+bool TestUtil::TestDnsCache() {
+  bool enabled = Util::DnsCache::Enabled;
+  int maxEntries = Util::DnsCache::MaxEntries;
+  int refreshAhead = Util::DnsCache::RefreshAhead;
+  Util::DnsCache::Enabled = true;
+  Util::DnsCache::RefreshAhead = 0;
+  Util::DnsCache::SetResolver(fake_resolver);
+  Util::DnsCache::Clear();
+  s_fakeLookups = 0;
+  s_fakeTTL = 60;
+
+  int64 hits0, misses0, neg0, refreshes0, resolves, micros, maxMicros;
+  Util::DnsCache::GetStats(hits0, misses0, neg0, refreshes0, resolves, micros,
+                           maxMicros);
+  {
+    Util::HostEnt result;
+    VERIFY(Util::safe_gethostbyname("www.example.com", result));
+    VERIFY(result.hostbuf.h_addr_list[0] != NULL);
+    VERIFY(result.hostbuf.h_addr_list[1] == NULL);
+    VERIFY(result.hostbuf.h_length == 4);
+  }
+  {
+    // names are case-insensitive
+    Util::HostEnt result;
+    VERIFY(Util::safe_gethostbyname("WWW.Example.COM", result));
+  }
+  VERIFY(s_fakeLookups == 1);
+  VERIFY(Util::DnsCache::ResolveToIP("www.example.com") == "10.0.0.1");
+  VERIFY(Util::DnsCache::ResolveToIP("127.0.0.1") == "127.0.0.1");
+  VERIFY(s_fakeLookups == 1);
+
+  // failures are remembered too
+  {
+    Util::HostEnt result;
+    VERIFY(!Util::safe_gethostbyname("www.example.bad", result));
+    VERIFY(!Util::safe_gethostbyname("www.example.bad", result));
+    VERIFY(result.herr == HOST_NOT_FOUND);
+  }
+  VERIFY(s_fakeLookups == 2);
+
+  // a TTL of 0 from the answer means not caching it
+  s_fakeTTL = 0;
+  VERIFY(Util::DnsCache::ResolveToIP("short.example.com") == "10.0.0.1");
+  VERIFY(Util::DnsCache::ResolveToIP("short.example.com") == "10.0.0.1");
+  VERIFY(s_fakeLookups == 4);
+
+  // expiring soon: a hit refreshes in the background
+  s_fakeTTL = 5;
+  Util::DnsCache::RefreshAhead = 10;
+  VERIFY(Util::DnsCache::ResolveToIP("hot.example.com") == "10.0.0.1");
+  VERIFY(Util::DnsCache::ResolveToIP("hot.example.com") == "10.0.0.1");
+  Util::DnsCache::Stop(); // runs what's queued
+  VERIFY(s_fakeLookups == 6);
+  Util::DnsCache::RefreshAhead = 0;
+
+  int64 hits, misses, neg, refreshes;
+  Util::DnsCache::GetStats(hits, misses, neg, refreshes, resolves, micros,
+                           maxMicros);
+  VERIFY(misses == misses0 + 5);
+  VERIFY(hits == hits0 + 3);
+  VERIFY(neg == neg0 + 1);
+  VERIFY(refreshes == refreshes0 + 1);
+
+  // a full cache drops its oldest entries, not everything
+  s_fakeTTL = 60;
+  Util::DnsCache::Clear();
+  Util::DnsCache::MaxEntries = 16;
+  for (int i = 0; i < 16; i++) {
+    char host[64];
+    snprintf(host, sizeof(host), "host%d.example.com", i);
+    Util::DnsCache::ResolveToIP(host);
+  }
+  VERIFY(Util::DnsCache::GetEntryCount() == 16);
+  Util::DnsCache::ResolveToIP("host16.example.com");
+  VERIFY(Util::DnsCache::GetEntryCount() == 15); // host0 and host1 went
+  s_fakeLookups = 0;
+  Util::DnsCache::ResolveToIP("host15.example.com");
+  Util::DnsCache::ResolveToIP("host16.example.com");
+  VERIFY(s_fakeLookups == 0);
+  Util::DnsCache::ResolveToIP("host0.example.com");
+  VERIFY(s_fakeLookups == 1);
+
+  Util::DnsCache::Clear();
+  Util::DnsCache::SetResolver(NULL);
+  Util::DnsCache::MaxEntries = maxEntries;
+  Util::DnsCache::RefreshAhead = refreshAhead;
+  Util::DnsCache::Enabled = enabled;
+  return Count(true);
+}
+
+class TestLogWriter : public AsyncLogWriter {
+public:
+  TestLogWriter(int capacity, FILE *f) : AsyncLogWriter(capacity), m_f(f) {}
+protected:
+  virtual FILE *getOutput(bool err) { return m_f;}
+private:
+  FILE *m_f;
+};
+
+class TestLogProducer {
+public:
+  enum { Lines = 5000 };
+  TestLogProducer() : writer(NULL), id(0) {}
+  void run() {
+    for (int i = 0; i < Lines; i++) {
+      char *line = (char *)malloc(32);
+      int len = snprintf(line, 32, "line %d %d\n", id, i);
+      writer->write(line, len, false);
+    }
+  }
+  AsyncLogWriter *writer;
+  int id;
+};
+
+bool TestUtil::TestAsyncLogWriter() {
+  const int count = 4;
+  FILE *f = tmpfile();
+  VERIFY(f);
+  {
+    // a small queue, so some lines get dropped
+    TestLogWriter writer(64, f);
+    writer.start();
+    TestLogProducer producers[count];
+    vector<AsyncFunc<TestLogProducer> *> funcs;
+    for (int i = 0; i < count; i++) {
+      producers[i].writer = &writer;
+      producers[i].id = i;
+      funcs.push_back(new AsyncFunc<TestLogProducer>(&producers[i],
+                                                     &TestLogProducer::run));
+      funcs.back()->start();
+    }
+    for (int i = 0; i < count; i++) {
+      funcs[i]->waitForEnd();
+      delete funcs[i];
+    }
+    writer.stop();
+
+    // every line is either written whole, in order, or counted as dropped
+    rewind(f);
+    int last[count];
+    for (int i = 0; i < count; i++) last[i] = -1;
+    int written = 0, reported = 0;
+    char buf[128];
+    while (fgets(buf, sizeof(buf), f)) {
+      int id, n;
+      if (sscanf(buf, "line %d %d", &id, &n) == 2) {
+        VERIFY(id >= 0 && id < count);
+        VERIFY(n > last[id]);
+        last[id] = n;
+        written++;
+      } else {
+        VERIFY(sscanf(buf, "[hphp] %d log lines dropped", &n) == 1);
+        reported += n;
+      }
+    }
+    VERIFY(reported == writer.getDropped());
+    VERIFY(written + reported == count * TestLogProducer::Lines);
+  }
+  fclose(f);
+
+  // drain() writes out what is queued without the writer thread, as when
+  // it crashed or never got to run
+  f = tmpfile();
+  VERIFY(f);
+  {
+    TestLogWriter writer(64, f);
+    for (int i = 0; i < 10; i++) {
+      char *line = (char *)malloc(32);
+      writer.write(line, snprintf(line, 32, "line 0 %d\n", i), false);
+    }
+    writer.drain();
+    rewind(f);
+    char buf[128];
+    int n = 0;
+    while (fgets(buf, sizeof(buf), f)) {
+      int id, i;
+      VERIFY(sscanf(buf, "line %d %d", &id, &i) == 2);
+      VERIFY(i == n);
+      n++;
+    }
+    VERIFY(n == 10);
+
+    // and a started writer still stops after a drain
+    writer.start();
+    writer.drain();
+    writer.stop();
+  }
+  fclose(f);
+  return Count(true);
+}
+
+bool TestUtil::TestStackTrace() {
+  bool enabled = StackTrace::Enabled;
+  StackTrace::Enabled = true;
+  StackTrace st;
+  StackTrace::Enabled = enabled;
+  vector<void*> bt;
+  st.get(bt);
+  VERIFY(!bt.empty());
+
+  StackTrace::FramePtr f1 = StackTrace::Translate(bt[0]);
+  StackTrace::FramePtr f2 = StackTrace::Translate(bt[0]);
+  VERIFY(f1 != f2);
+  VERIFY(f1->toString() == f2->toString());
+
+  // rewriting a translated frame must not change what the cache hands out
+  string expected = f1->toString();
+  f1->filename = "rewritten.php";
+  f1->lineno = 1;
+  VERIFY(StackTrace::Translate(bt[0])->toString() == expected);
+
+  VERIFY(StackTrace(st.hexEncode()).toString() == st.toString());
+  return Count(true);
+}
@@ -32,6 +32,9 @@ class TestUtil : public TestBase {
   bool TestSharedString();
   bool TestCanonicalize();
   bool TestHDF();
+  bool TestDnsCache();
+  bool TestAsyncLogWriter();
+  bool TestStackTrace();
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,235 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include "async_log_writer.h"
+#include "atomic.h"
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+// how long the writer thread sleeps when there is nothing to write
+static const long FlushIntervalNs = 10 * 1000 * 1000;
+
+// how long drain() waits, in 1ms steps, for the writer thread's batch
+static const int DrainTries = 100;
+
+AsyncLogWriter::AsyncLogWriter(int capacity)
+  : m_head(0), m_tail(0), m_dropped(0), m_reported(0), m_wake(0),
+    m_stopped(false), m_flushing(0), m_thread(this, &AsyncLogWriter::run) {
+  unsigned int size = 2;
+  while ((int)size < capacity) size <<= 1;
+  m_mask = size - 1;
+  m_slots = (Slot *)calloc(size, sizeof(Slot));
+  for (unsigned int i = 0; i < size; i++) {
+    m_slots[i].seq = i;
+  }
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+  Slot slot;
+  while (pop(slot)) {
+    free(slot.line);
+  }
+  free(m_slots);
+}
+
+void AsyncLogWriter::start() {
+  m_thread.start();
+}
+
+void AsyncLogWriter::stop() {
+  m_stopped = true;
+  wake();
+  m_thread.waitForEnd();
+  // anything pushed while the thread was winding down
+  if (lock(DrainTries)) {
+    while (flush()) {}
+    unlock();
+  }
+}
+
+void AsyncLogWriter::drain() {
+  m_stopped = true;
+  wake();
+  // no waiting for the thread to end: this may run in a signal handler,
+  // and the writer thread may never get to run again
+  if (lock(DrainTries)) {
+    while (flush()) {}
+    unlock();
+  }
+}
+
+bool AsyncLogWriter::lock(int tries) {
+  while (__sync_lock_test_and_set(&m_flushing, 1)) {
+    if (--tries < 0) return false;
+    struct timespec ts = { 0, 1000 * 1000 };
+    nanosleep(&ts, NULL); // async-signal-safe, unlike usleep()
+  }
+  return true;
+}
+
+void AsyncLogWriter::unlock() {
+  __sync_lock_release(&m_flushing);
+}
+
+bool AsyncLogWriter::write(char *line, int len, bool err) {
+  unsigned int pos = m_head;
+  Slot *slot;
+  while (true) {
+    slot = &m_slots[pos & m_mask];
+    int diff = (int)(slot->seq - pos);
+    if (diff == 0) {
+      unsigned int prev = __sync_val_compare_and_swap(&m_head, pos, pos + 1);
+      if (prev == pos) break;
+      pos = prev;
+    } else if (diff < 0) {
+      // full: the writer is behind by a whole queue, so drop the line
+      free(line);
+      atomic_inc(m_dropped);
+      return false;
+    } else {
+      pos = m_head;
+    }
+  }
+  slot->line = line;
+  slot->len = len;
+  slot->err = err;
+  __sync_synchronize();
+  slot->seq = pos + 1; // publish
+
+  if ((pos & (m_mask >> 1)) == 0) {
+    // every half lap, in case lines come faster than the idle wakeups
+    wake();
+  }
+  return true;
+}
+
+void AsyncLogWriter::wake() {
+  // FUTEX_WAKE never blocks, and a writer thread that is not asleep yet
+  // sees m_wake set and skips its next sleep
+  m_wake = 1;
+  __sync_synchronize();
+  syscall(SYS_futex, &m_wake, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+bool AsyncLogWriter::pop(Slot &out) {
+  Slot &slot = m_slots[m_tail & m_mask];
+  if ((int)(slot.seq - (m_tail + 1)) < 0) return false;
+  __sync_synchronize();
+  out.line = slot.line;
+  out.len = slot.len;
+  out.err = slot.err;
+  __sync_synchronize();
+  slot.seq = m_tail + m_mask + 1; // free for the next lap
+  m_tail++;
+  return true;
+}
+
+void AsyncLogWriter::run() {
+  while (!m_stopped) {
+    m_wake = 0;
+    __sync_synchronize();
+    // lock(0) only fails while drain() has taken over
+    int count = 0;
+    if (lock(0)) {
+      count = flush();
+      unlock();
+    }
+    if (count == BatchSize || m_stopped) continue;
+    // returns at once if a producer set m_wake since it was cleared
+    struct timespec timeout = { 0, FlushIntervalNs };
+    syscall(SYS_futex, &m_wake, FUTEX_WAIT_PRIVATE, 0, &timeout, NULL, 0);
+  }
+}
+
+int AsyncLogWriter::flush() {
+  char *lines[BatchSize];
+  int lens[BatchSize];
+  bool errs[BatchSize];
+  int count = 0;
+  Slot slot;
+  while (count < BatchSize && pop(slot)) {
+    lines[count] = slot.line;
+    lens[count] = slot.len;
+    errs[count] = slot.err;
+    count++;
+  }
+
+  // consecutive lines going to the same place are written together
+  for (int i = 0; i < count; ) {
+    int j = i + 1;
+    while (j < count && errs[j] == errs[i]) j++;
+    output(errs[i], lines + i, lens + i, j - i);
+    i = j;
+  }
+  for (int i = 0; i < count; i++) {
+    free(lines[i]);
+  }
+
+  int dropped = m_dropped;
+  if (dropped != m_reported) {
+    char buf[64];
+    char *line = buf;
+    int len = snprintf(buf, sizeof(buf), "[hphp] %d log lines dropped\n",
+                       dropped - m_reported);
+    output(true, &line, &len, 1);
+    m_reported = dropped;
+  }
+  return count;
+}
+
+void AsyncLogWriter::output(bool err, char **lines, int *lens, int count) {
+  FILE *f = getOutput(err);
+  if (!f) return;
+
+  struct iovec iov[BatchSize];
+  int bytes = 0;
+  for (int i = 0; i < count; i++) {
+    iov[i].iov_base = lines[i];
+    iov[i].iov_len = lens[i];
+    bytes += lens[i];
+  }
+
+  fflush(f); // in case stdio has anything buffered for the same file
+  int fd = fileno(f);
+  struct iovec *next = iov;
+  while (count > 0) {
+    ssize_t n = writev(fd, next, count);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      break; // nowhere to report a failing log
+    }
+    while (count > 0 && n >= (ssize_t)next->iov_len) {
+      n -= next->iov_len;
+      next++;
+      count--;
+    }
+    if (count > 0) {
+      next->iov_base = (char *)next->iov_base + n;
+      next->iov_len -= n;
+    }
+  }
+  onWritten(f, bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,117 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __ASYNC_LOG_WRITER_H__
+#define __ASYNC_LOG_WRITER_H__
+
+#include <stdio.h>
+#include "async_func.h"
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Writes log lines on a dedicated thread, so threads that log never wait on
+ * file I/O, stdio locks or each other.
+ *
+ * Lines go through a bounded lock-free queue (Dmitry Vyukov's sequence-per-
+ * slot ring): any number of threads push, and the writer thread pops batches
+ * and writes each with one writev(). When the queue is full, lines are
+ * dropped and counted instead of waiting; the writer reports the count in
+ * the log once it catches up.
+ */
+class AsyncLogWriter {
+public:
+  /**
+   * capacity is rounded up to a power of 2.
+   */
+  AsyncLogWriter(int capacity);
+  virtual ~AsyncLogWriter();
+
+  void start();
+
+  /**
+   * Stops the writer thread after writing out everything queued so far.
+   */
+  void stop();
+
+  /**
+   * Writes out everything queued so far on the calling thread, and stops
+   * the writer thread from writing any more. For paths that never reach
+   * stop(): fatal signals and exit(). Gives up after about 100ms if the
+   * writer thread is stuck in the middle of a batch, or was the one that
+   * crashed.
+   */
+  void drain();
+
+  /**
+   * Takes over line, a malloc-ed buffer of len bytes. Returns false, having
+   * freed it, if the queue is full.
+   */
+  bool write(char *line, int len, bool err);
+
+  int getDropped() const { return m_dropped;}
+
+  /**
+   * The writer thread.
+   */
+  void run();
+
+protected:
+  /**
+   * Where a line goes. Called on the writer thread for every batch, so
+   * rotation (e.g. Cronolog) takes effect there.
+   */
+  virtual FILE *getOutput(bool err) = 0;
+
+  /**
+   * Called after bytes have been written to f.
+   */
+  virtual void onWritten(FILE *f, int bytes) {}
+
+private:
+  struct Slot {
+    volatile unsigned int seq;
+    char *line;
+    int len;
+    bool err;
+  };
+
+  enum { BatchSize = 64 };
+
+  Slot *m_slots;
+  unsigned int m_mask;
+  volatile unsigned int m_head; // next slot to fill, shared by writers
+  unsigned int m_tail;          // next slot to drain, under m_flushing
+  int m_dropped;
+  int m_reported;
+  volatile int m_wake;          // futex word the writer thread sleeps on
+  volatile bool m_stopped;
+  volatile int m_flushing;      // held by whoever pops from the queue
+  AsyncFunc<AsyncLogWriter> m_thread;
+
+  bool lock(int tries);
+  void unlock();
+  bool pop(Slot &slot);
+  void wake();
+  int flush();
+  void output(bool err, char **lines, int *lens, int count);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __ASYNC_LOG_WRITER_H__
@@ -48,6 +48,21 @@ inline T atomic_add(T &mem, T val) {
   return r;
 }
 
+/**
+ * Loads and stores of aligned, word-sized values that are never torn or
+ * cached in a register, but are not ordered against other memory accesses.
+ * Good for counters one thread writes while others read them.
+ */
+template<class T>
+inline T atomic_load_relaxed(const T &mem) {
+  return *(const volatile T *)&mem;
+}
+
+template<class T>
+inline void atomic_store_relaxed(T &mem, T val) {
+  *(volatile T *)&mem = val;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 }
 
@@ -138,6 +138,16 @@ inline long long hash_string_i(const char *arKey) {
   return hash_string_i(arKey, strlen(arKey));
 }
 
+/**
+ * Slot of a key in a perfect hash table built by the compiler's
+ * PerfectHashTable: the low bits of the hash pick a displacement, which
+ * moves the key along a sequence given by the higher bits.
+ */
+inline int perfect_hash_slot(long long hash, int disp, int mask) {
+  unsigned long long h = hash;
+  return (int)(((h >> 16) + disp * ((h >> 40) | 1)) & mask);
+}
+
 // This function returns true and sets the res parameter if arKey
 // is a non-empty string that matches one of the following conditions:
 //   1) The string is "0".
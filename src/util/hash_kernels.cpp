@@ -0,0 +1,323 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include "hash_kernels.h"
+
+// The kernels are compiled for their instruction sets with target
+// attributes and only called once cpuid says the CPU has them, so the rest
+// of the build doesn't need -msse4.1 and friends. SHA intrinsics need GCC
+// 4.9 or later.
+#if defined(__x86_64__) && defined(__GNUC__) &&                         \
+  (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define HASH_KERNELS_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+// cpu features
+
+#ifdef HASH_KERNELS_X86
+struct CPUFeatures {
+  CPUFeatures() : sha(false), clmul(false) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return;
+    bool ssse3 = ecx & bit_SSSE3;
+    bool sse41 = ecx & bit_SSE4_1;
+    clmul = (ecx & bit_PCLMUL) && ssse3 && sse41;
+    if (__get_cpuid_max(0, NULL) >= 7) {
+      __cpuid_count(7, 0, eax, ebx, ecx, edx);
+      sha = (ebx & (1 << 29)) && ssse3 && sse41;
+    }
+  }
+  bool sha;
+  bool clmul;
+};
+static CPUFeatures s_cpu;
+#endif
+
+bool HashKernels::HasSHA() {
+#ifdef HASH_KERNELS_X86
+  return s_cpu.sha;
+#else
+  return false;
+#endif
+}
+
+bool HashKernels::HasCLMUL() {
+#ifdef HASH_KERNELS_X86
+  return s_cpu.clmul;
+#else
+  return false;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SHA-1 and SHA-256, after Intel's "Intel SHA Extensions" paper
+
+#ifdef HASH_KERNELS_X86
+// four rounds; w holds the message words for them, computed in place from
+// the previous four groups once the first 16 words are used up
+#define SHA1_GROUP(f)                                                   \
+  do {                                                                  \
+    __m128i &w = msg[g & 3];                                            \
+    if (g >= 4) {                                                       \
+      w = _mm_sha1msg1_epu32(w, msg[(g + 1) & 3]);                      \
+      w = _mm_xor_si128(w, msg[(g + 2) & 3]);                           \
+      w = _mm_sha1msg2_epu32(w, msg[(g + 3) & 3]);                      \
+    }                                                                   \
+    __m128i e1 = g ? _mm_sha1nexte_epu32(prev, w) : _mm_add_epi32(e, w); \
+    prev = abcd;                                                        \
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, f);                            \
+  } while (0)
+
+__attribute__((target("sha,ssse3,sse4.1")))
+static void sha1_blocks(unsigned int state[5], const unsigned char *data,
+                        int count) {
+  const __m128i bswap = _mm_set_epi64x(0x0001020304050607ULL,
+                                       0x08090a0b0c0d0e0fULL);
+  __m128i abcd = _mm_shuffle_epi32(
+    _mm_loadu_si128((const __m128i *)state), 0x1B);
+  __m128i e = _mm_set_epi32(state[4], 0, 0, 0);
+
+  for (; count > 0; count--, data += 64) {
+    __m128i abcd0 = abcd;
+    __m128i e0 = e;
+    __m128i prev = abcd;
+    __m128i msg[4];
+    for (int i = 0; i < 4; i++) {
+      msg[i] = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)(data + i * 16)), bswap);
+    }
+    int g = 0;
+    for (; g < 5; g++)  SHA1_GROUP(0);
+    for (; g < 10; g++) SHA1_GROUP(1);
+    for (; g < 15; g++) SHA1_GROUP(2);
+    for (; g < 20; g++) SHA1_GROUP(3);
+    e = _mm_sha1nexte_epu32(prev, e0);
+    abcd = _mm_add_epi32(abcd, abcd0);
+  }
+
+  _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1B));
+  state[4] = _mm_extract_epi32(e, 3);
+}
+
+#undef SHA1_GROUP
+
+static const unsigned int SHA256_K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+  0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+  0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+  0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+  0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+  0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+__attribute__((target("sha,ssse3,sse4.1")))
+static void sha256_blocks(unsigned int state[8], const unsigned char *data,
+                          int count) {
+  const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                       0x0405060700010203ULL);
+  // the instructions keep the state as ABEF and CDGH
+  __m128i dcba = _mm_shuffle_epi32(
+    _mm_loadu_si128((const __m128i *)&state[0]), 0xB1);
+  __m128i hgfe = _mm_shuffle_epi32(
+    _mm_loadu_si128((const __m128i *)&state[4]), 0x1B);
+  __m128i abef = _mm_alignr_epi8(dcba, hgfe, 8);
+  __m128i cdgh = _mm_blend_epi16(hgfe, dcba, 0xF0);
+
+  for (; count > 0; count--, data += 64) {
+    __m128i abef0 = abef;
+    __m128i cdgh0 = cdgh;
+    __m128i msg[4];
+    for (int g = 0; g < 16; g++) {
+      __m128i &w = msg[g & 3];
+      if (g < 4) {
+        w = _mm_shuffle_epi8(
+          _mm_loadu_si128((const __m128i *)(data + g * 16)), bswap);
+      } else {
+        __m128i w7 = _mm_alignr_epi8(msg[(g + 3) & 3], msg[(g + 2) & 3], 4);
+        w = _mm_add_epi32(_mm_sha256msg1_epu32(w, msg[(g + 1) & 3]), w7);
+        w = _mm_sha256msg2_epu32(w, msg[(g + 3) & 3]);
+      }
+      __m128i wk = _mm_add_epi32(
+        w, _mm_loadu_si128((const __m128i *)&SHA256_K[g * 4]));
+      cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+      abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0E));
+    }
+    abef = _mm_add_epi32(abef, abef0);
+    cdgh = _mm_add_epi32(cdgh, cdgh0);
+  }
+
+  __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+  __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+  _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(feba, dchg, 0xF0));
+  _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(dchg, feba, 8));
+}
+#endif
+
+bool HashKernels::SHA1Blocks(unsigned int state[5], const unsigned char *data,
+                             int count) {
+#ifdef HASH_KERNELS_X86
+  if (s_cpu.sha) {
+    if (count > 0) sha1_blocks(state, data, count);
+    return true;
+  }
+#endif
+  return false;
+}
+
+bool HashKernels::SHA256Blocks(unsigned int state[8],
+                               const unsigned char *data, int count) {
+#ifdef HASH_KERNELS_X86
+  if (s_cpu.sha) {
+    if (count > 0) sha256_blocks(state, data, count);
+    return true;
+  }
+#endif
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CRC-32 by folding, after Intel's "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction", with the bit-reflected constants
+// for 0x04C11DB7 that zlib uses.
+//
+// The MSB-first CRC of some bytes is the mirror image of the reflected CRC
+// of the same bytes with their bits reversed, so FoldCRC32MSB() reverses each
+// 16-byte load and the register, and shares the reflected code.
+
+#ifdef HASH_KERNELS_X86
+__attribute__((target("ssse3")))
+static inline __m128i reverse_bits(__m128i v) {
+  const __m128i lo = _mm_setr_epi8(0x00, 0x80, 0x40, (char)0xc0,
+                                   0x20, (char)0xa0, 0x60, (char)0xe0,
+                                   0x10, (char)0x90, 0x50, (char)0xd0,
+                                   0x30, (char)0xb0, 0x70, (char)0xf0);
+  const __m128i hi = _mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                   0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  return _mm_or_si128(
+    _mm_shuffle_epi8(lo, _mm_and_si128(v, nibble)),
+    _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(v, 4), nibble)));
+}
+
+template<bool msb>
+__attribute__((target("pclmul,ssse3,sse4.1")))
+static inline __m128i load_block(const unsigned char *p) {
+  __m128i v = _mm_loadu_si128((const __m128i *)p);
+  return msb ? reverse_bits(v) : v;
+}
+
+// a * k, folded 128 bits further along, plus b
+__attribute__((target("pclmul,sse4.1")))
+static inline __m128i fold(__m128i a, __m128i k, __m128i b) {
+  return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x00),
+                                     _mm_clmulepi64_si128(a, k, 0x11)), b);
+}
+
+// len is a multiple of 16, at least 64
+template<bool msb>
+__attribute__((target("pclmul,ssse3,sse4.1")))
+static unsigned int crc32_fold(unsigned int crc, const unsigned char *p,
+                               int len) {
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596ULL, 0x0154442bd4ULL);
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eULL, 0x01751997d0ULL);
+  const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124ULL);
+  const __m128i poly = _mm_set_epi64x(0x01f7011641ULL, 0x01db710641ULL);
+  const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+  __m128i x1 = _mm_xor_si128(load_block<msb>(p), _mm_cvtsi32_si128(crc));
+  __m128i x2 = load_block<msb>(p + 16);
+  __m128i x3 = load_block<msb>(p + 32);
+  __m128i x4 = load_block<msb>(p + 48);
+  p += 64;
+  len -= 64;
+
+  // four streams, 512 bits apart
+  for (; len >= 64; len -= 64, p += 64) {
+    x1 = fold(x1, k1k2, load_block<msb>(p));
+    x2 = fold(x2, k1k2, load_block<msb>(p + 16));
+    x3 = fold(x3, k1k2, load_block<msb>(p + 32));
+    x4 = fold(x4, k1k2, load_block<msb>(p + 48));
+  }
+
+  // down to one, then any 16-byte blocks left
+  x1 = fold(x1, k3k4, x2);
+  x1 = fold(x1, k3k4, x3);
+  x1 = fold(x1, k3k4, x4);
+  for (; len >= 16; len -= 16, p += 16) {
+    x1 = fold(x1, k3k4, load_block<msb>(p));
+  }
+
+  // 128 bits to 64, then Barrett reduction to 32
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return _mm_extract_epi32(x1, 1);
+}
+
+static unsigned int reverse_bits(unsigned int v) {
+  v = ((v >> 1) & 0x55555555) | ((v & 0x55555555) << 1);
+  v = ((v >> 2) & 0x33333333) | ((v & 0x33333333) << 2);
+  v = ((v >> 4) & 0x0f0f0f0f) | ((v & 0x0f0f0f0f) << 4);
+  return __builtin_bswap32(v);
+}
+#endif
+
+int HashKernels::FoldCRC32(unsigned int &crc, const unsigned char *data,
+                           int len) {
+#ifdef HASH_KERNELS_X86
+  if (s_cpu.clmul && len >= 64) {
+    len &= ~15;
+    crc = crc32_fold<false>(crc, data, len);
+    return len;
+  }
+#endif
+  return 0;
+}
+
+int HashKernels::FoldCRC32MSB(unsigned int &crc, const unsigned char *data,
+                              int len) {
+#ifdef HASH_KERNELS_X86
+  if (s_cpu.clmul && len >= 64) {
+    len &= ~15;
+    crc = reverse_bits(crc32_fold<true>(reverse_bits(crc), data, len));
+    return len;
+  }
+#endif
+  return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
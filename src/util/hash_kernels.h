@@ -0,0 +1,64 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HPHP_HASH_KERNELS_H__
+#define __HPHP_HASH_KERNELS_H__
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Block functions behind sha1(), crc32() and the matching hash() engines,
+ * using instructions that not every x86-64 CPU has: the SHA extensions for
+ * SHA-1 and SHA-256, and PCLMULQDQ carry-less multiplication for CRC-32.
+ *
+ * Support is detected once with cpuid. Each function reports when it did
+ * nothing, and the caller then runs its own portable code, so digests come
+ * out the same on every machine.
+ */
+class HashKernels {
+public:
+  static bool HasSHA();
+  static bool HasCLMUL();
+
+  /**
+   * Run the compression function over count 64-byte blocks. Returns false,
+   * leaving state alone, if the CPU can't.
+   */
+  static bool SHA1Blocks(unsigned int state[5], const unsigned char *data,
+                         int count);
+  static bool SHA256Blocks(unsigned int state[8], const unsigned char *data,
+                           int count);
+
+  /**
+   * Fold a prefix of data into a running CRC register (as it is before the
+   * final inversion) and return its length, a multiple of 16. Returns 0 if
+   * the CPU lacks PCLMULQDQ or len is under 64, which isn't worth it.
+   *
+   * Both use polynomial 0x04C11DB7: FoldCRC32() in the reflected form of
+   * zlib, crc32() and hash('crc32b'), FoldCRC32MSB() in the MSB-first form
+   * of bzip2 and hash('crc32').
+   */
+  static int FoldCRC32(unsigned int &crc, const unsigned char *data,
+                       int len);
+  static int FoldCRC32MSB(unsigned int &crc, const unsigned char *data,
+                          int len);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HPHP_HASH_KERNELS_H__
@@ -22,6 +22,7 @@
 #include "util.h"
 #include "log_aggregator.h"
 #include "text_color.h"
+#include "async_log_writer.h"
 #include <util/atomic.h>
 #include <runtime/base/runtime_option.h>
 
@@ -65,7 +66,9 @@ bool Logger::LogHeader = false;
 bool Logger::LogNativeStackTrace = true;
 std::string Logger::ExtraHeader;
 int Logger::MaxMessagesPerRequest = -1;
+int Logger::AsyncQueueSize = 0;
 IMPLEMENT_THREAD_LOCAL(Logger::ThreadData, Logger::s_threadData);
+AsyncLogWriter *Logger::s_asyncWriter = NULL;
 
 Logger *Logger::s_logger = new Logger();
 
@@ -132,8 +135,10 @@ void Logger::log(bool err, const std::string &msg,
     return;
   }
 
+  // backtrace() is not free; only take one if something will record it
   boost::shared_ptr<StackTrace> deleter;
-  if (stackTrace == NULL) {
+  if (stackTrace == NULL &&
+      (UseLogAggregator || (UseLogFile && LogHeader && LogNativeStackTrace))) {
     deleter = boost::shared_ptr<StackTrace>(new StackTrace());
     stackTrace = deleter.get();
   }
@@ -141,15 +146,7 @@ void Logger::log(bool err, const std::string &msg,
   if (UseLogAggregator) {
     LogAggregator::TheLogAggregator.log(*stackTrace, msg);
   }
-  FILE *stdf = err ? stderr : stdout;
   if (UseLogFile) {
-    FILE *f;
-    if (UseCronolog) {
-      f = cronOutput.getOutputFile();
-      if (!f) f = stdf;
-    } else {
-      f = Output ? Output : stdf;
-    }
     string header, sheader;
     if (LogHeader) {
       header = GetHeader();
@@ -161,16 +158,34 @@ void Logger::log(bool err, const std::string &msg,
     }
     const char *escaped = escape ? EscapeString(msg) : msg.c_str();
     const char *ending = escapeMore ? "\\n" : "\n";
-    int bytes;
-    if (f == stdf && Util::s_stderr_color) {
-      bytes =
-        fprintf(f, "%s%s%s%s%s",
-                Util::s_stderr_color, sheader.c_str(), msg.c_str(), ending,
-                ANSI_COLOR_END);
+    AsyncLogWriter *writer = s_asyncWriter;
+    if (writer) {
+      int hlen = sheader.size();
+      int mlen = strlen(escaped);
+      int elen = strlen(ending);
+      char *line = (char *)malloc(hlen + mlen + elen);
+      memcpy(line, sheader.data(), hlen);
+      memcpy(line + hlen, escaped, mlen);
+      memcpy(line + hlen + mlen, ending, elen);
+      writer->write(line, hlen + mlen + elen, err);
     } else {
-      bytes = fprintf(f, "%s%s%s", sheader.c_str(), escaped, ending);
+      FILE *stdf = err ? stderr : stdout;
+      FILE *f = GetOutputFile(err);
+      int bytes;
+      if (f == stdf && Util::s_stderr_color) {
+        bytes =
+          fprintf(f, "%s%s%s%s%s",
+                  Util::s_stderr_color, sheader.c_str(), msg.c_str(), ending,
+                  ANSI_COLOR_END);
+      } else {
+        bytes = fprintf(f, "%s%s%s", sheader.c_str(), escaped, ending);
+      }
+      atomic_add(bytesWritten, bytes);
+      fflush(f);
+      if (UseCronolog || (Output && RuntimeOption::LogFile[0] != '|')) {
+        checkDropCache(bytesWritten, prevBytesWritten, f);
+      }
     }
-    atomic_add(bytesWritten, bytes);
     FILE *tf = threadData->log;
     if (tf) {
       threadData->bytesWritten +=
@@ -187,12 +202,78 @@ void Logger::log(bool err, const std::string &msg,
     if (escape) {
       free((void*)escaped);
     }
+  }
+}
+
+FILE *Logger::GetOutputFile(bool err) {
+  FILE *stdf = err ? stderr : stdout;
+  if (UseCronolog) {
+    FILE *f = cronOutput.getOutputFile();
+    return f ? f : stdf;
+  }
+  return Output ? Output : stdf;
+}
+
+/**
+ * Writes the log file for Logger from a background thread.
+ */
+class LogFileWriter : public AsyncLogWriter {
+public:
+  LogFileWriter(int capacity) : AsyncLogWriter(capacity) {}
 
-    fflush(f);
-    if (UseCronolog || (Output && RuntimeOption::LogFile[0] != '|')) {
-      checkDropCache(bytesWritten, prevBytesWritten, f);
+protected:
+  virtual FILE *getOutput(bool err) {
+    return Logger::GetOutputFile(err);
+  }
+  virtual void onWritten(FILE *f, int bytes) {
+    atomic_add(Logger::bytesWritten, bytes);
+    if (Logger::UseCronolog ||
+        (Logger::Output && RuntimeOption::LogFile[0] != '|')) {
+      Logger::checkDropCache(Logger::bytesWritten, Logger::prevBytesWritten,
+                             f);
     }
   }
+};
+
+void Logger::AsyncWriterAfterFork() {
+  // the child has the queue but not the thread draining it: log directly
+  s_asyncWriter = NULL;
+}
+
+void Logger::StartAsyncWriter() {
+  if (s_asyncWriter || AsyncQueueSize <= 0) return;
+  static bool registered = false;
+  if (!registered) {
+    registered = true;
+    pthread_atfork(NULL, NULL, AsyncWriterAfterFork);
+    // exit() from anywhere but hphp_process_exit()
+    atexit(DrainAsyncWriter);
+  }
+  AsyncLogWriter *writer = new LogFileWriter(AsyncQueueSize);
+  writer->start();
+  s_asyncWriter = writer;
+}
+
+void Logger::StopAsyncWriter() {
+  AsyncLogWriter *writer = s_asyncWriter;
+  if (writer) {
+    s_asyncWriter = NULL;
+    writer->stop();
+    // not deleted: a thread that loaded the pointer may still be using it
+  }
+}
+
+void Logger::DrainAsyncWriter() {
+  AsyncLogWriter *writer = s_asyncWriter;
+  if (writer) {
+    s_asyncWriter = NULL;
+    writer->drain();
+  }
+}
+
+int Logger::GetDroppedLines() {
+  AsyncLogWriter *writer = s_asyncWriter;
+  return writer ? writer->getDropped() : 0;
 }
 
 std::string Logger::GetHeader() {
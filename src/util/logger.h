@@ -27,6 +27,7 @@ namespace HPHP {
 
 class StackTrace;
 class Exception;
+class AsyncLogWriter;
 
 class LogFileData {
 public:
@@ -60,6 +61,7 @@ public:
   static bool LogNativeStackTrace;
   static std::string ExtraHeader;
   static int MaxMessagesPerRequest;
+  static int AsyncQueueSize;
 
   static void Error(const std::string &msg);
   static void Warning(const std::string &msg);
@@ -87,6 +89,25 @@ public:
   static void ClearThreadLog();
   static void SetNewOutput(FILE *output);
 
+  /**
+   * Log file writes go through a queue of AsyncQueueSize lines to a
+   * background thread, and are dropped when it is full.
+   */
+  static void StartAsyncWriter();
+  static void StopAsyncWriter();
+
+  /**
+   * For crashes and exits that skip StopAsyncWriter(): writes out what is
+   * queued on the calling thread, and makes later lines go out directly.
+   */
+  static void DrainAsyncWriter();
+  static int GetDroppedLines();
+
+  /**
+   * The log file, or stderr/stdout when there is none.
+   */
+  static FILE *GetOutputFile(bool err);
+
   typedef void (*PFUNC_LOG)(const char *header, const char *msg,
                             const char *ending, void *data);
   static void SetThreadHook(PFUNC_LOG func, void *data);
@@ -116,6 +137,8 @@ protected:
     void *hookData;
   };
   static DECLARE_THREAD_LOCAL(ThreadData, s_threadData);
+  static AsyncLogWriter *s_asyncWriter;
+  static void AsyncWriterAfterFork();
 
   static void Log(bool err, const char *fmt, va_list ap);
   static void LogEscapeMore(bool err, const char *fmt, va_list ap);
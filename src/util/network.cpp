@@ -18,10 +18,14 @@
 #include "lock.h"
 #include "process.h"
 #include "util.h"
+#include "atomic.h"
+#include "timer.h"
+#include "job_queue.h"
 
 #include <netinet/in.h>
 #include <arpa/nameser.h>
 #include <resolv.h>
+#include <algorithm>
 
 using namespace std;
 
@@ -47,7 +51,7 @@ std::string Util::safe_inet_ntoa(struct in_addr &in) {
   return buf;
 }
 
-bool Util::safe_gethostbyname(const char *address, HostEnt &result) {
+static bool gethostbyname_impl(const char *address, Util::HostEnt &result) {
 #if defined(__APPLE__)
   struct hostent *hp = gethostbyname(address);
 
@@ -73,6 +77,400 @@ bool Util::safe_gethostbyname(const char *address, HostEnt &result) {
 #endif
 }
 
+bool Util::safe_gethostbyname(const char *address, HostEnt &result) {
+  if (DnsCache::Enabled) {
+    return DnsCache::Resolve(address, result);
+  }
+  return gethostbyname_impl(address, result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DnsCache
+
+bool Util::DnsCache::Enabled = false;
+int Util::DnsCache::DefaultTTL = 600;
+int Util::DnsCache::MaxTTL = 3600;
+int Util::DnsCache::NegativeTTL = 10;
+bool Util::DnsCache::HonorTTL = true;
+int Util::DnsCache::RefreshAhead = 10;
+int Util::DnsCache::ResolverThreads = 2;
+int Util::DnsCache::MaxEntries = 65536;
+
+namespace {
+
+struct DnsEntry {
+  DnsEntry() : addrtype(AF_INET), length(0), herr(0), expire(0), stored(0),
+               refreshing(false) {}
+
+  int addrtype;
+  int length;
+  std::string name;
+  std::vector<std::string> addrs; // raw network-order addresses
+  int herr;
+  time_t expire;
+  int64 stored; // insertion order, oldest are evicted first
+  bool refreshing;
+
+  bool negative() const { return addrs.empty();}
+};
+typedef hphp_string_map<DnsEntry> DnsEntryMap;
+
+struct DnsStats {
+  int64 hits;
+  int64 misses;
+  int64 negativeHits;
+  int64 refreshes;
+  int64 resolves;
+  int64 resolveMicros;
+  int64 maxResolveMicros;
+};
+
+static ReadWriteMutex s_dnsMutex;
+static DnsEntryMap s_dnsEntries;
+static int64 s_dnsStored;
+static DnsStats s_dnsStats;
+
+static std::string dns_key(const char *host) {
+  std::string key(host);
+  for (unsigned int i = 0; i < key.size(); i++) {
+    key[i] = tolower(key[i]);
+  }
+  return key;
+}
+
+/**
+ * Asks DNS for the A records of a name, following the search list like
+ * gethostbyname() does. The TTL is the smallest one along the answer, so a
+ * short-lived CNAME in front of a long-lived address still counts.
+ */
+static bool dns_query(const char *host, Util::DnsCache::Answer &answer) {
+  unsigned char buf[NS_PACKETSZ * 4];
+  int len = res_search(host, ns_c_in, ns_t_a, buf, sizeof(buf));
+  if (len < 0) return false;
+  if (len > (int)sizeof(buf)) len = sizeof(buf);
+
+  ns_msg msg;
+  if (ns_initparse(buf, len, &msg) < 0) return false;
+
+  int count = ns_msg_count(msg, ns_s_an);
+  for (int i = 0; i < count; i++) {
+    ns_rr rr;
+    if (ns_parserr(&msg, ns_s_an, i, &rr) < 0) continue;
+    int ttl = ns_rr_ttl(rr);
+    if (answer.ttl < 0 || ttl < answer.ttl) answer.ttl = ttl;
+    if (ns_rr_type(rr) == ns_t_a && ns_rr_rdlen(rr) == NS_INADDRSZ) {
+      if (answer.addrs.empty()) answer.name = ns_rr_name(rr);
+      answer.addrs.push_back(std::string((const char *)ns_rr_rdata(rr),
+                                         NS_INADDRSZ));
+    }
+  }
+  answer.addrtype = AF_INET;
+  answer.length = NS_INADDRSZ;
+  return !answer.addrs.empty();
+}
+
+static bool dns_default_resolver(const char *host,
+                                 Util::DnsCache::Answer &answer) {
+  if (Util::DnsCache::HonorTTL && dns_query(host, answer)) {
+    return true;
+  }
+
+  // names DNS doesn't have, or HonorTTL is off: no TTL to go by
+  answer = Util::DnsCache::Answer();
+  Util::HostEnt result;
+  if (!gethostbyname_impl(host, result)) {
+    answer.herr = result.herr;
+    return false;
+  }
+  answer.addrtype = result.hostbuf.h_addrtype;
+  answer.length = result.hostbuf.h_length;
+  if (result.hostbuf.h_name) answer.name = result.hostbuf.h_name;
+  for (int i = 0; result.hostbuf.h_addr_list[i]; i++) {
+    answer.addrs.push_back(std::string(result.hostbuf.h_addr_list[i],
+                                       answer.length));
+  }
+  return true;
+}
+
+static Util::DnsCache::Resolver s_dnsResolver = dns_default_resolver;
+
+/**
+ * Makes room for one more entry: drops whatever has expired and, if that's
+ * not enough, the oldest eighth of the cache, so a full cache doesn't pay
+ * for a scan on every miss. Called with the write lock held.
+ */
+static void dns_make_room() {
+  time_t now = time(NULL);
+  for (DnsEntryMap::iterator iter = s_dnsEntries.begin();
+       iter != s_dnsEntries.end();) {
+    if (iter->second.expire <= now) {
+      s_dnsEntries.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+
+  int excess = (int)s_dnsEntries.size() - Util::DnsCache::MaxEntries + 1;
+  if (excess <= 0) return;
+  int evict = Util::DnsCache::MaxEntries / 8;
+  if (evict < excess) evict = excess;
+
+  std::vector<int64> stored;
+  stored.reserve(s_dnsEntries.size());
+  for (DnsEntryMap::const_iterator iter = s_dnsEntries.begin();
+       iter != s_dnsEntries.end(); ++iter) {
+    stored.push_back(iter->second.stored);
+  }
+  if (evict > (int)stored.size()) evict = stored.size();
+  std::nth_element(stored.begin(), stored.begin() + evict - 1, stored.end());
+  int64 cutoff = stored[evict - 1];
+  for (DnsEntryMap::iterator iter = s_dnsEntries.begin();
+       iter != s_dnsEntries.end();) {
+    if (iter->second.stored <= cutoff) {
+      s_dnsEntries.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+/**
+ * Really resolves a name and stores the outcome, positive or negative. A
+ * failed background refresh keeps serving the old answer until it expires.
+ */
+static void dns_resolve_and_store(const char *host, DnsEntry &entry,
+                                  bool refresh = false) {
+  Timer timer(Timer::WallTime);
+  Util::DnsCache::Answer answer;
+  bool ok = s_dnsResolver(host, answer);
+  int64 elapsed = timer.getMicroSeconds();
+
+  atomic_add(s_dnsStats.resolves, 1LL);
+  atomic_add(s_dnsStats.resolveMicros, elapsed);
+  if (elapsed > s_dnsStats.maxResolveMicros) {
+    s_dnsStats.maxResolveMicros = elapsed; // racy, but only a watermark
+  }
+
+  entry = DnsEntry();
+  int ttl;
+  if (ok && !answer.addrs.empty()) {
+    entry.addrtype = answer.addrtype;
+    entry.length = answer.length;
+    entry.name = answer.name;
+    entry.addrs = answer.addrs;
+    ttl = answer.ttl;
+    if (ttl < 0 || !Util::DnsCache::HonorTTL) {
+      ttl = Util::DnsCache::DefaultTTL;
+    }
+    if (ttl > Util::DnsCache::MaxTTL) ttl = Util::DnsCache::MaxTTL;
+  } else {
+    ok = false;
+    entry.herr = answer.herr;
+    ttl = Util::DnsCache::NegativeTTL;
+  }
+  entry.expire = time(NULL) + ttl;
+
+  std::string key = dns_key(host);
+  WriteLock lock(s_dnsMutex);
+  if (refresh && !ok) {
+    DnsEntryMap::iterator iter = s_dnsEntries.find(key);
+    if (iter != s_dnsEntries.end()) {
+      iter->second.refreshing = false;
+    }
+    return;
+  }
+  if (ttl <= 0) return; // caching turned off for this kind of answer
+  if ((int)s_dnsEntries.size() >= Util::DnsCache::MaxEntries &&
+      s_dnsEntries.find(key) == s_dnsEntries.end()) {
+    dns_make_room();
+  }
+  entry.stored = ++s_dnsStored;
+  s_dnsEntries[key] = entry;
+}
+
+/**
+ * Rebuilds a hostent from a cached entry, in the caller's own buffer.
+ */
+static bool dns_fill_hostent(const DnsEntry &entry, Util::HostEnt &result) {
+  if (entry.negative()) {
+    result.herr = entry.herr ? entry.herr : HOST_NOT_FOUND;
+    return false;
+  }
+
+  int count = entry.addrs.size();
+  size_t size = sizeof(char*) * (count + 2) + entry.length * count +
+    entry.name.size() + 1;
+  if (result.tmphstbuf) free(result.tmphstbuf);
+  result.tmphstbuf = (char*)malloc(size);
+
+  char **ptrs = (char**)result.tmphstbuf;
+  char *addrs = result.tmphstbuf + sizeof(char*) * (count + 2);
+  char *name = addrs + entry.length * count;
+  for (int i = 0; i < count; i++) {
+    memcpy(addrs + entry.length * i, entry.addrs[i].data(), entry.length);
+    ptrs[i] = addrs + entry.length * i;
+  }
+  ptrs[count] = NULL;
+  ptrs[count + 1] = NULL; // empty alias list
+  memcpy(name, entry.name.c_str(), entry.name.size() + 1);
+
+  result.hostbuf.h_name = name;
+  result.hostbuf.h_aliases = ptrs + count + 1;
+  result.hostbuf.h_addrtype = entry.addrtype;
+  result.hostbuf.h_length = entry.length;
+  result.hostbuf.h_addr_list = ptrs;
+  result.herr = 0;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// resolver threads for background refreshes
+
+class DnsResolverWorker : public JobQueueWorker<std::string*> {
+public:
+  virtual void doJob(std::string *host) {
+    DnsEntry entry;
+    dns_resolve_and_store(host->c_str(), entry, true);
+    delete host;
+  }
+};
+
+typedef JobQueueDispatcher<std::string*, DnsResolverWorker> DnsDispatcher;
+static Mutex s_dispatcherMutex;
+static DnsDispatcher *s_dispatcher = NULL;
+
+static void dns_enqueue_refresh(const char *host) {
+  Lock lock(s_dispatcherMutex);
+  if (s_dispatcher == NULL) {
+    int threads = Util::DnsCache::ResolverThreads;
+    s_dispatcher = new DnsDispatcher(threads > 0 ? threads : 1, false, 0,
+                                     NULL);
+    s_dispatcher->start();
+  }
+  s_dispatcher->enqueue(new std::string(host));
+}
+
+}
+
+void Util::DnsCache::SetResolver(Resolver resolver) {
+  s_dnsResolver = resolver ? resolver : dns_default_resolver;
+}
+
+bool Util::DnsCache::Resolve(const char *host, HostEnt &result) {
+  std::string key = dns_key(host);
+  bool refresh = false;
+  {
+    DnsEntry entry;
+    bool found = false;
+    time_t now = time(NULL);
+    {
+      ReadLock lock(s_dnsMutex);
+      DnsEntryMap::const_iterator iter = s_dnsEntries.find(key);
+      if (iter != s_dnsEntries.end() && iter->second.expire > now) {
+        entry = iter->second;
+        found = true;
+      }
+    }
+    if (found) {
+      if (entry.negative()) {
+        atomic_add(s_dnsStats.negativeHits, 1LL);
+      } else {
+        atomic_add(s_dnsStats.hits, 1LL);
+        refresh = !entry.refreshing && RefreshAhead > 0 &&
+          entry.expire - now <= RefreshAhead;
+      }
+      if (refresh) {
+        WriteLock lock(s_dnsMutex);
+        DnsEntryMap::iterator iter = s_dnsEntries.find(key);
+        if (iter != s_dnsEntries.end() && !iter->second.refreshing) {
+          iter->second.refreshing = true;
+        } else {
+          refresh = false;
+        }
+      }
+      if (refresh) {
+        atomic_add(s_dnsStats.refreshes, 1LL);
+        dns_enqueue_refresh(host);
+      }
+      return dns_fill_hostent(entry, result);
+    }
+  }
+
+  atomic_add(s_dnsStats.misses, 1LL);
+  DnsEntry entry;
+  dns_resolve_and_store(host, entry);
+  return dns_fill_hostent(entry, result);
+}
+
+std::string Util::DnsCache::ResolveToIP(const char *host) {
+  struct in_addr in;
+  if (inet_aton(host, &in)) {
+    return host;
+  }
+  HostEnt result;
+  if (!safe_gethostbyname(host, result) ||
+      result.hostbuf.h_addrtype != AF_INET) {
+    return "";
+  }
+  memcpy(&in.s_addr, *(result.hostbuf.h_addr_list), sizeof(in.s_addr));
+  return safe_inet_ntoa(in);
+}
+
+void Util::DnsCache::Stop() {
+  DnsDispatcher *dispatcher;
+  {
+    Lock lock(s_dispatcherMutex);
+    dispatcher = s_dispatcher;
+    s_dispatcher = NULL;
+  }
+  if (dispatcher) {
+    dispatcher->stop();
+    delete dispatcher;
+  }
+}
+
+void Util::DnsCache::Clear() {
+  WriteLock lock(s_dnsMutex);
+  s_dnsEntries.clear();
+}
+
+int Util::DnsCache::GetEntryCount() {
+  ReadLock lock(s_dnsMutex);
+  return s_dnsEntries.size();
+}
+
+void Util::DnsCache::GetStats(int64 &hits, int64 &misses,
+                              int64 &negativeHits, int64 &refreshes,
+                              int64 &resolves, int64 &resolveMicros,
+                              int64 &maxResolveMicros) {
+  hits = s_dnsStats.hits;
+  misses = s_dnsStats.misses;
+  negativeHits = s_dnsStats.negativeHits;
+  refreshes = s_dnsStats.refreshes;
+  resolves = s_dnsStats.resolves;
+  resolveMicros = s_dnsStats.resolveMicros;
+  maxResolveMicros = s_dnsStats.maxResolveMicros;
+}
+
+std::string Util::DnsCache::ReportStats() {
+  int64 hits, misses, negativeHits, refreshes, resolves, micros, maxMicros;
+  GetStats(hits, misses, negativeHits, refreshes, resolves, micros,
+           maxMicros);
+  int entries = GetEntryCount();
+
+  std::ostringstream out;
+  out << "<Entries>" << entries << "</Entries>\n";
+  out << "<Hits>" << hits << "</Hits>\n";
+  out << "<Misses>" << misses << "</Misses>\n";
+  out << "<NegativeHits>" << negativeHits << "</NegativeHits>\n";
+  out << "<Refreshes>" << refreshes << "</Refreshes>\n";
+  out << "<Resolves>" << resolves << "</Resolves>\n";
+  out << "<AvgResolveMicros>" << (resolves ? micros / resolves : 0)
+      << "</AvgResolveMicros>\n";
+  out << "<MaxResolveMicros>" << maxMicros << "</MaxResolveMicros>\n";
+  return out.str();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 std::string Util::GetPrimaryIP() {
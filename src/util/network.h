@@ -18,7 +18,9 @@
 #define __NETWORK_H__
 
 #include "base.h"
+#include "mutex.h"
 #include <string>
+#include <vector>
 #include <netdb.h>
 #include <sys/socket.h>
 #include <stdlib.h>
@@ -40,9 +42,83 @@ public:
   int herr;
 };
 
+/**
+ * Resolves through DnsCache when it is enabled.
+ */
 bool safe_gethostbyname(const char *address, HostEnt &result);
 std::string safe_inet_ntoa(struct in_addr &in);
 
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Process-wide resolver cache shared by every outbound connection. Entries
+ * live for the TTL of the DNS answer (clamped by MaxTTL), failures are kept
+ * for NegativeTTL, and a hit within RefreshAhead seconds of expiry schedules
+ * a background re-resolve so hot names never block a request thread again.
+ */
+class DnsCache {
+public:
+  static bool Enabled;
+  static int DefaultTTL;    // when the answer carries no usable TTL
+  static int MaxTTL;
+  static int NegativeTTL;
+  static bool HonorTTL;     // query the resolver for record TTLs
+  static int RefreshAhead;  // seconds before expiry to start refreshing
+  static int ResolverThreads;
+  static int MaxEntries;
+
+  /**
+   * Synchronous lookup, served from cache when possible.
+   */
+  static bool Resolve(const char *host, HostEnt &result);
+
+  /**
+   * Returns the first address of a host in dotted form, or an empty string
+   * when the name does not resolve. IP literals are returned unchanged.
+   */
+  static std::string ResolveToIP(const char *host);
+
+  /**
+   * What one lookup found: addresses in network order, and the smallest TTL
+   * of the records they came from, or -1 when the source has none.
+   */
+  struct Answer {
+    Answer() : addrtype(AF_INET), length(0), herr(0), ttl(-1) {}
+
+    int addrtype;
+    int length;
+    std::string name;
+    std::vector<std::string> addrs;
+    int herr; // when the lookup failed
+    int ttl;
+  };
+
+  /**
+   * Does the real lookups on a miss or a refresh. The default one asks DNS
+   * once, taking addresses and TTL from the same answer, and only falls back
+   * to gethostbyname() (/etc/hosts, NIS, ...) when DNS has no address. With
+   * HonorTTL off it only uses gethostbyname(). NULL restores the default.
+   */
+  typedef bool (*Resolver)(const char *host, Answer &answer);
+  static void SetResolver(Resolver resolver);
+
+  /**
+   * Stop resolver threads. Cached entries are kept.
+   */
+  static void Stop();
+
+  /**
+   * Drop all entries.
+   */
+  static void Clear();
+
+  static int GetEntryCount();
+  static std::string ReportStats();
+  static void GetStats(int64 &hits, int64 &misses, int64 &negativeHits,
+                       int64 &refreshes, int64 &resolves,
+                       int64 &resolveMicros, int64 &maxResolveMicros);
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /**
  * Get local machine's primary IP address.
@@ -65,6 +65,10 @@ static void bt_handler(int sig) {
     // leave running for SIGTERM SIGFPE SIGABRT
   }
 
+  // Lines still queued for the log file would die with the process. This
+  // also makes the lines below go to the log directly.
+  Logger::DrainAsyncWriter();
+
   // Turn on stack traces for coredumps
   StackTrace::Enabled = true;
   StackTraceNoHeap st;
@@ -361,27 +365,51 @@ bool StackTraceBase::Translate(void *frame, StackTraceBase::Frame * f,
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Translated frames are kept for the life of the process, keyed by address,
+// so that a trace printed over and over only goes through bfd and the
+// demangler once per distinct frame. Lock profiling is off on these locks,
+// since the profiler takes stack traces of its own.
+
+typedef hphp_hash_map<void*, StackTrace::Frame, pointer_hash<void> > FrameMap;
+static ReadWriteMutex s_frameMutex;
+static FrameMap s_frames;
+static const unsigned int MaxCachedFrames = 65536;
+
 StackTrace::FramePtr StackTrace::Translate(void *frame) {
+  {
+    ReadLock lock(s_frameMutex, false);
+    FrameMap::const_iterator iter = s_frames.find(frame);
+    if (iter != s_frames.end()) {
+      // callers like SourceInfo::translate() rewrite frames in place
+      return FramePtr(new Frame(iter->second));
+    }
+  }
+
   Dl_info dlInfo;
   addr2line_data adata;
 
   Frame * f1 = new Frame(frame);
   FramePtr f(f1);
-  if (!StackTraceBase::Translate(frame, f1, dlInfo, &adata)) return f;
-
-  if (adata.filename) {
-    f->filename = adata.filename;
-  }
-  if (adata.functionname) {
-    f->funcname = Demangle(adata.functionname);
-  }
-  if (f->filename.empty() && dlInfo.dli_fname) {
-    f->filename = dlInfo.dli_fname;
-  }
-  if (f->funcname.empty() && dlInfo.dli_sname) {
-    f->funcname = Demangle(dlInfo.dli_sname);
+  if (StackTraceBase::Translate(frame, f1, dlInfo, &adata)) {
+    if (adata.filename) {
+      f->filename = adata.filename;
+    }
+    if (adata.functionname) {
+      f->funcname = Demangle(adata.functionname);
+    }
+    if (f->filename.empty() && dlInfo.dli_fname) {
+      f->filename = dlInfo.dli_fname;
+    }
+    if (f->funcname.empty() && dlInfo.dli_sname) {
+      f->funcname = Demangle(dlInfo.dli_sname);
+    }
   }
 
+  WriteLock lock(s_frameMutex, false);
+  if (s_frames.size() < MaxCachedFrames) {
+    s_frames.insert(FrameMap::value_type(frame, *f));
+  }
   return f;
 }
 
@@ -562,6 +590,17 @@ bool StackTraceBase::Addr2line(const char *filename, const char *address,
   return ret;
 }
 
+void StackTrace::PreloadSymbols() {
+  Dl_info dlInfo;
+  if (!dladdr((void*)&StackTrace::PreloadSymbols, &dlInfo) ||
+      !dlInfo.dli_fname) {
+    return;
+  }
+  // same key Addr2line() will look it up by
+  Lock lock(s_bfdMutex);
+  get_bfd_cache(dlInfo.dli_fname);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // copied and re-factored from demangle/c++filt
 
@@ -100,6 +100,13 @@ public:
    */
   static FramePtr Translate(void *bt);
 
+  /**
+   * Load the main binary's symbol tables now rather than on the first
+   * Translate() call, which would otherwise stall whichever request first
+   * needs a symbolized trace.
+   */
+  static void PreloadSymbols();
+
   /**
    * Demangle a function name.
    */
@@ -0,0 +1,455 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include "string_kernels.h"
+#include <ctype.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+// case mapping
+
+#ifdef __SSE2__
+// 0xff in every byte of v between lo and hi; bytes >= 0x80 never are, since
+// they compare as negative
+static inline __m128i in_range(__m128i v, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+static inline __m128i ascii_lower(__m128i v) {
+  return _mm_add_epi8(v, _mm_and_si128(in_range(v, 'A', 'Z'),
+                                       _mm_set1_epi8(0x20)));
+}
+#endif
+
+static inline bool changes_case(char c, bool lower) {
+  unsigned char u = c;
+  if (u < 0x80) {
+    return lower ? (c >= 'A' && c <= 'Z') : (c >= 'a' && c <= 'z');
+  }
+  return (lower ? tolower(u) : toupper(u)) != u;
+}
+
+static int find_case(const char *s, int len, bool lower) {
+  int i = 0;
+#ifdef __SSE2__
+  char lo = lower ? 'A' : 'a';
+  char hi = lower ? 'Z' : 'z';
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    // letters to map, and non-ASCII bytes that might have to be
+    int mask = _mm_movemask_epi8(in_range(v, lo, hi)) | _mm_movemask_epi8(v);
+    while (mask) {
+      int j = __builtin_ctz(mask);
+      if (changes_case(s[i + j], lower)) return i + j;
+      mask &= mask - 1;
+    }
+  }
+#endif
+  for (; i < len; i++) {
+    if (changes_case(s[i], lower)) return i;
+  }
+  return len;
+}
+
+int StringKernels::FindUpper(const char *s, int len) {
+  return find_case(s, len, true);
+}
+
+int StringKernels::FindLower(const char *s, int len) {
+  return find_case(s, len, false);
+}
+
+char StringKernels::LowerChar(char c) {
+  unsigned char u = c;
+  if (u < 0x80) return (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+  return tolower(u);
+}
+
+static inline char upper_char(char c) {
+  unsigned char u = c;
+  if (u < 0x80) return (c >= 'a' && c <= 'z') ? c - 0x20 : c;
+  return toupper(u);
+}
+
+static void map_case(char *dst, const char *src, int len, bool lower) {
+  int i = 0;
+#ifdef __SSE2__
+  char lo = lower ? 'A' : 'a';
+  char hi = lower ? 'Z' : 'z';
+  __m128i flip = _mm_set1_epi8(0x20);
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    int high = _mm_movemask_epi8(v);
+    // 'A' + 0x20 == 'a': xor flips the case of letters in range either way
+    v = _mm_xor_si128(v, _mm_and_si128(in_range(v, lo, hi), flip));
+    _mm_storeu_si128((__m128i *)(dst + i), v);
+    while (high) {
+      int j = __builtin_ctz(high);
+      dst[i + j] = lower ? StringKernels::LowerChar(src[i + j])
+                         : upper_char(src[i + j]);
+      high &= high - 1;
+    }
+  }
+#endif
+  for (; i < len; i++) {
+    dst[i] = lower ? StringKernels::LowerChar(src[i]) : upper_char(src[i]);
+  }
+}
+
+void StringKernels::ToLower(char *dst, const char *src, int len) {
+  map_case(dst, src, len, true);
+}
+
+void StringKernels::ToUpper(char *dst, const char *src, int len) {
+  map_case(dst, src, len, false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// character classes
+
+StringKernels::CharSet::CharSet() : m_count(0) {
+  memset(m_table, 0, sizeof(m_table));
+}
+
+StringKernels::CharSet::CharSet(const char *chars, int count) : m_count(0) {
+  memset(m_table, 0, sizeof(m_table));
+  for (int i = 0; i < count; i++) {
+    add(chars[i]);
+  }
+}
+
+void StringKernels::CharSet::add(char c) {
+  if (contains(c)) return;
+  m_table[(unsigned char)c] = true;
+  if (m_count < MaxVectorChars) {
+    m_chars[m_count] = c;
+  }
+  m_count++;
+}
+
+int StringKernels::FindAnyOf(const char *s, int len, const CharSet &set) {
+  int i = 0;
+  if (set.m_count == 0) return len;
+#ifdef __SSE2__
+  if (set.m_count <= CharSet::MaxVectorChars && len >= 16) {
+    __m128i chars[CharSet::MaxVectorChars];
+    int n = set.m_count;
+    for (int k = 0; k < n; k++) {
+      chars[k] = _mm_set1_epi8(set.m_chars[k]);
+    }
+    for (; i + 16 <= len; i += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+      __m128i m = _mm_cmpeq_epi8(v, chars[0]);
+      for (int k = 1; k < n; k++) {
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, chars[k]));
+      }
+      int mask = _mm_movemask_epi8(m);
+      if (mask) return i + __builtin_ctz(mask);
+    }
+  }
+#endif
+  for (; i < len; i++) {
+    if (set.contains(s[i])) return i;
+  }
+  return len;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// substring search
+
+int StringKernels::Find(const char *s, int len, const char *needle,
+                        int nlen) {
+  if (nlen <= 0 || nlen > len) return nlen == 0 ? 0 : -1;
+  if (nlen == 1) {
+    const char *p = (const char *)memchr(s, *needle, len);
+    return p ? p - s : -1;
+  }
+  int last = len - nlen; // last possible match position
+  int i = 0;
+#ifdef __SSE2__
+  __m128i first = _mm_set1_epi8(needle[0]);
+  __m128i tail = _mm_set1_epi8(needle[nlen - 1]);
+  for (; i + 15 <= last; i += 16) {
+    __m128i a = _mm_loadu_si128((const __m128i *)(s + i));
+    __m128i b = _mm_loadu_si128((const __m128i *)(s + i + nlen - 1));
+    int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first),
+                                               _mm_cmpeq_epi8(b, tail)));
+    while (mask) {
+      int j = __builtin_ctz(mask);
+      if (!memcmp(s + i + j + 1, needle + 1, nlen - 2)) return i + j;
+      mask &= mask - 1;
+    }
+  }
+#endif
+  for (; i <= last; i++) {
+    if (s[i] == needle[0] && s[i + nlen - 1] == needle[nlen - 1] &&
+        !memcmp(s + i + 1, needle + 1, nlen - 2)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static bool equal_lowered(const char *s, const char *lneedle, int nlen) {
+  for (int k = 0; k < nlen; k++) {
+    if (StringKernels::LowerChar(s[k]) != lneedle[k]) return false;
+  }
+  return true;
+}
+
+int StringKernels::FindCaseInsensitive(const char *s, int len,
+                                       const char *lneedle, int nlen) {
+  if (nlen <= 0 || nlen > len) return nlen == 0 ? 0 : -1;
+  int last = len - nlen;
+  int i = 0;
+#ifdef __SSE2__
+  // Non-ASCII bytes are lowered by the locale, which the vector compare
+  // can't follow, so needles that start or end with one stay scalar.
+  if ((unsigned char)lneedle[0] < 0x80 &&
+      (unsigned char)lneedle[nlen - 1] < 0x80) {
+    __m128i first = _mm_set1_epi8(lneedle[0]);
+    __m128i tail = _mm_set1_epi8(lneedle[nlen - 1]);
+    for (; i + 15 <= last; i += 16) {
+      __m128i a = ascii_lower(_mm_loadu_si128((const __m128i *)(s + i)));
+      __m128i b = ascii_lower(
+        _mm_loadu_si128((const __m128i *)(s + i + nlen - 1)));
+      int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first),
+                                                 _mm_cmpeq_epi8(b, tail)));
+      while (mask) {
+        int j = __builtin_ctz(mask);
+        if (equal_lowered(s + i + j, lneedle, nlen)) return i + j;
+        mask &= mask - 1;
+      }
+    }
+  }
+#endif
+  for (; i <= last; i++) {
+    if (LowerChar(s[i]) == lneedle[0] && equal_lowered(s + i, lneedle, nlen)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// encoding
+
+static const char s_hexLower[] = "0123456789abcdef";
+static const char s_hexUpper[] = "0123456789ABCDEF";
+
+#ifdef __SSE2__
+// hex digits of bytes that hold values 0 to 15
+static inline __m128i hex_digits(__m128i n) {
+  __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)),
+                                  _mm_set1_epi8('a' - '0' - 10));
+  return _mm_add_epi8(n, _mm_add_epi8(_mm_set1_epi8('0'), letters));
+}
+#endif
+
+void StringKernels::HexEncode(char *dst, const char *src, int len) {
+  int i = 0;
+#ifdef __SSE2__
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  for (; i + 16 <= len; i += 16, dst += 32) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+    __m128i lo = _mm_and_si128(v, nibble);
+    _mm_storeu_si128((__m128i *)dst, hex_digits(_mm_unpacklo_epi8(hi, lo)));
+    _mm_storeu_si128((__m128i *)(dst + 16),
+                     hex_digits(_mm_unpackhi_epi8(hi, lo)));
+  }
+#endif
+  for (; i < len; i++) {
+    unsigned char c = src[i];
+    *dst++ = s_hexLower[c >> 4];
+    *dst++ = s_hexLower[c & 15];
+  }
+}
+
+static inline bool url_plain(unsigned char c) {
+  return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') ||
+    (c >= 'a' && c <= 'z') || c == '-' || c == '.' || c == '_';
+}
+
+static inline char *url_escape(char *dst, unsigned char c, bool raw) {
+  if (c == ' ' && !raw) {
+    *dst++ = '+';
+    return dst;
+  }
+  dst[0] = '%';
+  dst[1] = s_hexUpper[c >> 4];
+  dst[2] = s_hexUpper[c & 15];
+  return dst + 3;
+}
+
+#ifdef __SSE2__
+// bits of the bytes url_plain() is false for
+static inline int url_special_mask(__m128i v) {
+  __m128i m = _mm_or_si128(in_range(v, '0', '9'),
+                           _mm_or_si128(in_range(v, 'A', 'Z'),
+                                        in_range(v, 'a', 'z')));
+  m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('-')));
+  m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('.')));
+  m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+  return ~_mm_movemask_epi8(m) & 0xffff;
+}
+#endif
+
+int StringKernels::CountURLEscapes(const char *s, int len, bool raw) {
+  int count = 0;
+  int i = 0;
+#ifdef __SSE2__
+  const __m128i space = _mm_set1_epi8(' ');
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    int mask = url_special_mask(v);
+    if (!raw) mask &= ~_mm_movemask_epi8(_mm_cmpeq_epi8(v, space));
+    count += __builtin_popcount(mask);
+  }
+#endif
+  for (; i < len; i++) {
+    unsigned char c = s[i];
+    if (!url_plain(c) && (raw || c != ' ')) count++;
+  }
+  return count;
+}
+
+int StringKernels::URLEncode(char *dst, const char *s, int len, bool raw) {
+  char *start = dst;
+  int i = 0;
+#ifdef __SSE2__
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    int mask = url_special_mask(v);
+    if (!mask) {
+      _mm_storeu_si128((__m128i *)dst, v);
+      dst += 16;
+      continue;
+    }
+    for (int k = 0; k < 16; k++) {
+      if (mask & (1 << k)) {
+        dst = url_escape(dst, s[i + k], raw);
+      } else {
+        *dst++ = s[i + k];
+      }
+    }
+  }
+#endif
+  for (; i < len; i++) {
+    unsigned char c = s[i];
+    if (url_plain(c)) {
+      *dst++ = c;
+    } else {
+      dst = url_escape(dst, c, raw);
+    }
+  }
+  return dst - start;
+}
+
+#ifdef __SSE2__
+// characters of 6-bit values, going by which range of the alphabet each is
+// in: 'A' + n, then 'a' - 26 + n, '0' - 52 + n, and '+' and '/'
+static inline __m128i base64_chars(__m128i n) {
+  __m128i off = _mm_set1_epi8('A');
+  off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(25)),
+                                        _mm_set1_epi8(6)));
+  off = _mm_sub_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(51)),
+                                        _mm_set1_epi8(75)));
+  off = _mm_sub_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(61)),
+                                        _mm_set1_epi8(15)));
+  off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(62)),
+                                        _mm_set1_epi8(3)));
+  return _mm_add_epi8(n, off);
+}
+
+static inline int load_be24(const unsigned char *p) {
+  unsigned int x;
+  memcpy(&x, p, 4);
+  return __builtin_bswap32(x) >> 8;
+}
+#endif
+
+int StringKernels::Base64EncodeBlocks(char *dst, const unsigned char *src,
+                                      int len) {
+  int i = 0;
+#ifdef __SSE2__
+  // three bytes to a 32-bit lane; the last load reads one byte further
+  for (; i + 13 <= len; i += 12, dst += 16) {
+    __m128i w = _mm_setr_epi32(load_be24(src + i), load_be24(src + i + 3),
+                               load_be24(src + i + 6), load_be24(src + i + 9));
+    // the four 6-bit values of each lane, one per byte, first one first
+    __m128i n = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi32(w, 18),
+                   _mm_and_si128(_mm_srli_epi32(w, 4),
+                                 _mm_set1_epi32(0x3f00))),
+      _mm_or_si128(_mm_and_si128(_mm_slli_epi32(w, 10),
+                                 _mm_set1_epi32(0x3f0000)),
+                   _mm_and_si128(_mm_slli_epi32(w, 24),
+                                 _mm_set1_epi32(0x3f000000))));
+    _mm_storeu_si128((__m128i *)dst, base64_chars(n));
+  }
+#endif
+  return i;
+}
+
+int StringKernels::Base64DecodeBlocks(unsigned char *dst, const char *src,
+                                      int len) {
+  int i = 0;
+#ifdef __SSE2__
+  for (; i + 16 <= len; i += 16, dst += 12) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    __m128i upper = in_range(v, 'A', 'Z');
+    __m128i lower = in_range(v, 'a', 'z');
+    __m128i digit = in_range(v, '0', '9');
+    __m128i plus = _mm_cmpeq_epi8(v, _mm_set1_epi8('+'));
+    __m128i slash = _mm_cmpeq_epi8(v, _mm_set1_epi8('/'));
+    __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                 _mm_or_si128(digit,
+                                              _mm_or_si128(plus, slash)));
+    if (_mm_movemask_epi8(valid) != 0xffff) break;
+
+    __m128i off = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    off = _mm_or_si128(off, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    off = _mm_or_si128(off, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    off = _mm_or_si128(off, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+    off = _mm_or_si128(off, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+    __m128i n = _mm_add_epi8(v, off);
+
+    // pairs of 6-bit values into 12 bits, pairs of those into 24
+    n = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(n, _mm_set1_epi16(0xff)),
+                                    6),
+                     _mm_srli_epi16(n, 8));
+    n = _mm_madd_epi16(n, _mm_set1_epi32(0x00011000));
+
+    unsigned int w[4];
+    _mm_storeu_si128((__m128i *)w, n);
+    for (int k = 0; k < 4; k++) {
+      unsigned int be = __builtin_bswap32(w[k] << 8);
+      memcpy(dst + k * 3, &be, 4);
+    }
+  }
+#endif
+  return i;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,125 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010 Facebook, Inc. (http://www.facebook.com)          |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HPHP_STRING_KERNELS_H__
+#define __HPHP_STRING_KERNELS_H__
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Byte-string primitives behind the hottest string builtins, working 16
+ * bytes at a time with SSE2 where available and a scalar loop otherwise.
+ *
+ * Case mapping treats ASCII the way the C locale does and only calls
+ * tolower()/toupper() on bytes >= 0x80, whose case depends on the locale.
+ * Positions are returned as offsets, with len (or -1 for searches) meaning
+ * "not found".
+ */
+class StringKernels {
+public:
+  /**
+   * First byte that ToLower()/ToUpper() would change, or len.
+   */
+  static int FindUpper(const char *s, int len);
+  static int FindLower(const char *s, int len);
+
+  /**
+   * dst and src may be the same buffer.
+   */
+  static void ToLower(char *dst, const char *src, int len);
+  static void ToUpper(char *dst, const char *src, int len);
+
+  /**
+   * Lower-cased byte, the same way ToLower() does it.
+   */
+  static char LowerChar(char c);
+
+  /**
+   * A set of bytes to scan for. Sets of up to MaxVectorChars bytes are
+   * compared 16 bytes at a time, bigger ones go through a lookup table.
+   */
+  class CharSet {
+  public:
+    static const int MaxVectorChars = 8;
+
+    CharSet();
+    CharSet(const char *chars, int count);
+
+    void add(char c);
+    bool contains(char c) const { return m_table[(unsigned char)c];}
+    int size() const { return m_count;}
+
+  private:
+    friend class StringKernels;
+    bool m_table[256];
+    char m_chars[MaxVectorChars];
+    int m_count;
+  };
+
+  /**
+   * First byte of s that is in set, or len.
+   */
+  static int FindAnyOf(const char *s, int len, const CharSet &set);
+
+  /**
+   * First occurrence of needle in s, or -1. Candidates are found by
+   * matching the first and the last byte of needle 16 positions at a time,
+   * and only those are compared in full.
+   */
+  static int Find(const char *s, int len, const char *needle, int nlen);
+
+  /**
+   * Same, ignoring case; lneedle has to be lower-cased with ToLower().
+   */
+  static int FindCaseInsensitive(const char *s, int len,
+                                 const char *lneedle, int nlen);
+
+  /**
+   * Two lower-case hex digits per byte; dst needs 2 * len bytes.
+   */
+  static void HexEncode(char *dst, const char *src, int len);
+
+  /**
+   * Bytes urlencode() (raw = false) or rawurlencode() turns into "%XX":
+   * everything but alphanumerics and "-._", except that urlencode() makes
+   * spaces "+". The output is len + 2 * CountURLEscapes() bytes long.
+   */
+  static int CountURLEscapes(const char *s, int len, bool raw);
+  static int URLEncode(char *dst, const char *s, int len, bool raw);
+
+  /**
+   * Base64-encode the longest prefix of src that is a multiple of 12 bytes
+   * and can be loaded 16 at a time, and return its length. dst receives
+   * 4 characters for every 3 bytes; the caller does the rest and padding.
+   */
+  static int Base64EncodeBlocks(char *dst, const unsigned char *src,
+                                int len);
+
+  /**
+   * Decode src 16 characters at a time for as long as they are all from the
+   * base64 alphabet, with no padding, whitespace or anything else the
+   * caller has rules for, and return how many characters were used. dst
+   * receives 3 bytes for every 4 characters, and one scratch byte after.
+   */
+  static int Base64DecodeBlocks(unsigned char *dst, const char *src,
+                                int len);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HPHP_STRING_KERNELS_H__